@@ -309,6 +309,11 @@ typedef const gdi_lcd_entry ** gdi_display_entries;
 #define GDI_GUI_HEAP_SIZE               (0)
 #endif
 
+/* Period of the tearing effect (TE) pulses of the panel, i.e. of its refresh, in microseconds */
+#ifndef GDI_TE_PERIOD_US
+#define GDI_TE_PERIOD_US                (16667)
+#endif
+
 #define GDI_RGB332_COLOR_BYTES          (1UL)
 #define GDI_RGB332_RED_POS              (5UL)
 #define GDI_RGB332_GREEN_POS            (2UL)
@@ -530,6 +535,28 @@ uint64_t gdi_get_sys_uptime_ticks(void);
  */
 uint64_t gdi_convert_ticks_to_us(uint64_t ticks);
 
+/**
+ * \brief Get system uptime in nanoseconds
+ *
+ * The time stamps of the profiler. On the target they have the resolution of the system timer (one
+ * tick of the low power clock, about 30 us), on the simulator the one of the host clock.
+ *
+ * \return The uptime in nanoseconds
+ */
+uint64_t gdi_get_sys_uptime_ns(void);
+
+/**
+ * \brief Get the time of the last tearing effect (TE) pulse of the panel
+ *
+ * The panel starts scanning out its memory every GDI_TE_PERIOD_US at the pulse, so a frame
+ * transferred right after it does not tear. The pulses are timed from the last frame cycle of the
+ * LCDC in continuous mode. In command mode the adapter gives no time of the pulses.
+ *
+ * \return The uptime of the pulse in microseconds, not later than the current time, or 0 if no
+ *         pulse can be timed
+ */
+uint64_t gdi_get_te_time(void);
+
 /**
  * \brief Power on the display
  */
@@ -849,6 +876,63 @@ void gdi_perf_transfer_end(void);
  */
 void gdi_perf_transfer_time(int time_us);
 
+/**
+ * brief Provides the time the transfer to LCD overlapped with the rendering of the current screen,
+ * measured by the caller (used for performance measurements)
+ *
+ * \param[in] time_us   Measured time in micro seconds
+ */
+void gdi_perf_overlap_time(int time_us);
+
+/**
+ * brief Provides the flushes and pixels the merging of the refreshed areas saved in the current
+ * frame (used for performance measurements)
+ *
+ * \param[in] flushes  Partial updates saved, negative if more were needed
+ * \param[in] pixels   Pixels saved, negative if more were transferred
+ */
+void gdi_perf_refr_saved(int flushes, int pixels);
+
+/**
+ * brief Provides the hits, misses and evictions of a cache of the renderer in the current frame
+ * (used for performance measurements)
+ *
+ * \param[in] cache    Tag of the cache
+ * \param[in] hits     Lookups served from the cache
+ * \param[in] misses   Entries computed and added
+ * \param[in] evicts   Entries dropped to make room for other ones, 0 if the cache does not count them
+ */
+void gdi_perf_cache(uint8_t cache, int hits, int misses, int evicts);
+
+/**
+ * brief Provides the state of the GUI heap after the current frame (used for performance
+ * measurements)
+ *
+ * \param[in] buf_allocs Temporal buffers of LVGL allocated from the heap in the frame
+ * \param[in] used       Bytes of the heap in use
+ * \param[in] frag_pct   Fragmentation of the free bytes, in percent
+ * \param[in] biggest    Bytes of the largest free block
+ */
+void gdi_perf_gui_heap(int buf_allocs, int used, int frag_pct, int biggest);
+
+/**
+ * brief Provides the bytes copied from the front to the back frame buffer to keep them in sync in
+ * the current frame (used for performance measurements)
+ *
+ * \param[in] bytes    Bytes copied
+ */
+void gdi_perf_fb_sync(int bytes);
+
+/**
+ * brief Provides the TE periods between the current frame and the previous one of an animation,
+ * and how many of them were missed because the frame took too long to render (used for performance
+ * measurements)
+ *
+ * \param[in] periods  TE periods since the previous frame, 0 if it is not part of an animation
+ * \param[in] drops    TE periods missed
+ */
+void gdi_perf_frame_pace(int periods, int drops);
+
 /**
  * brief Provides the information to LCD if it is the last area of the refreshing process. (used for performance measurements)
  *
@@ -192,9 +192,17 @@ PRIVILEGED_DATA OS_TIMER draw_async_timer_h;
 #if GDI_CONSOLE_LOG
 PRIVILEGED_DATA static uint64_t frame_render_op_start, frame_render_op_end, frame_render_start, frame_render_end, frame_transfer_start, frame_transfer_end;
 PRIVILEGED_DATA static int frame_render_op_duration_us, frame_render_duration_us, frame_transfer_duration_us, frame_total_duration_us;
+PRIVILEGED_DATA static int frame_overlap_duration_us;
+PRIVILEGED_DATA static int frame_flushes_saved, frame_pixels_saved;
+PRIVILEGED_DATA static int frame_buf_allocs, frame_gui_heap_used, frame_gui_heap_frag, frame_gui_heap_biggest;
+PRIVILEGED_DATA static int frame_fb_sync_bytes;
+PRIVILEGED_DATA static int frame_te_periods, frame_te_drops;
 PRIVILEGED_DATA static bool transfer_last;
 #endif
 
+/* Start of the last frame cycle of the LCDC in continuous mode, in microseconds */
+PRIVILEGED_DATA static uint64_t te_time_us;
+
 void *_gdi_get_frame_buffer_addr(void);
 #ifndef OS_BAREMETAL
 static void frame_update_async_cb(AD_LCDC_ERROR status, void *cb_data);
@@ -287,6 +295,40 @@ uint64_t gdi_convert_ticks_to_us(uint64_t ticks)
 #endif
 }
 
+uint64_t gdi_get_sys_uptime_ns(void)
+{
+        uint64_t ticks = gdi_get_sys_uptime_ticks();
+
+#if GDI_USE_OS_TIMER && !defined (OS_BAREMETAL)
+        return (uint64_t)OS_TICKS_2_MS(ticks) * 1000000;
+#else
+        /* Split so that the product does not overflow */
+        return (ticks / configSYSTICK_CLOCK_HZ) * 1000000000ULL
+                + ((ticks % configSYSTICK_CLOCK_HZ) * 1000000000ULL) / configSYSTICK_CLOCK_HZ;
+#endif
+}
+
+uint64_t gdi_get_te_time(void)
+{
+        uint64_t now = gdi_convert_ticks_to_us(gdi_get_sys_uptime_ticks());
+        uint64_t te;
+
+        /* Updated from the LCDC interrupt */
+        GLOBAL_INT_DISABLE();
+        te = te_time_us;
+        GLOBAL_INT_RESTORE();
+
+        /* No frame cycle timed since continuous mode was enabled */
+        if (!te) {
+                return 0;
+        }
+        if (te > now) {
+                return te;
+        }
+
+        return now - (now - te) % GDI_TE_PERIOD_US;
+}
+
 #if GDI_CONSOLE_LOG
 static void console_log(void)
 {
@@ -297,13 +339,29 @@ static void console_log(void)
                 metrics = get_metrics_data();
 
                 metrics.fps = 10000000UL / frame_total_duration_us;
+                metrics.frame_time = frame_total_duration_us;
                 metrics.frame_rendering_time = frame_render_duration_us;
                 metrics.display_transfer_time = frame_transfer_duration_us;
+                metrics.overlap_time = frame_overlap_duration_us;
                 metrics.pixel_count = pixel_count;
+                metrics.flushes_saved = frame_flushes_saved;
+                metrics.pixels_saved = frame_pixels_saved;
+                metrics.buf_heap_allocs = frame_buf_allocs;
+                metrics.gui_heap_used = frame_gui_heap_used;
+                metrics.gui_heap_frag = frame_gui_heap_frag;
+                metrics.gui_heap_biggest = frame_gui_heap_biggest;
+                metrics.fb_sync_bytes = frame_fb_sync_bytes;
+                metrics.te_periods = frame_te_periods;
+                metrics.te_drops = frame_te_drops;
                 metrics_add(&metrics);
 
                 /* Clear variables */
                 frame_render_duration_us = frame_transfer_duration_us = frame_total_duration_us = 0;
+                frame_overlap_duration_us = pixel_count = 0;
+                frame_flushes_saved = frame_pixels_saved = 0;
+                frame_buf_allocs = frame_gui_heap_used = frame_gui_heap_frag = frame_gui_heap_biggest = 0;
+                frame_fb_sync_bytes = 0;
+                frame_te_periods = frame_te_drops = 0;
         }
 
 #if !defined(PERFORMANCE_METRICS)
@@ -386,9 +444,58 @@ void gdi_perf_render_time(int time_us)
 #endif
 }
 
+void gdi_perf_overlap_time(int time_us)
+{
+#ifdef PERFORMANCE_METRICS
+        frame_overlap_duration_us = time_us;
+#endif
+}
+
+void gdi_perf_refr_saved(int flushes, int pixels)
+{
+#ifdef PERFORMANCE_METRICS
+        frame_flushes_saved = flushes;
+        frame_pixels_saved = pixels;
+#endif
+}
+
+void gdi_perf_cache(uint8_t cache, int hits, int misses, int evicts)
+{
+#ifdef PERFORMANCE_METRICS
+        metrics_cache_add(cache, hits, misses, evicts);
+#endif
+}
+
+void gdi_perf_gui_heap(int buf_allocs, int used, int frag_pct, int biggest)
+{
+#ifdef PERFORMANCE_METRICS
+        frame_buf_allocs = buf_allocs;
+        frame_gui_heap_used = used;
+        frame_gui_heap_frag = frag_pct;
+        frame_gui_heap_biggest = biggest;
+#endif
+}
+
+void gdi_perf_fb_sync(int bytes)
+{
+#ifdef PERFORMANCE_METRICS
+        frame_fb_sync_bytes = bytes;
+#endif
+}
+
+void gdi_perf_frame_pace(int periods, int drops)
+{
+#ifdef PERFORMANCE_METRICS
+        frame_te_periods = periods;
+        frame_te_drops = drops;
+#endif
+}
+
 void gdi_perf_transfer_start(void)
 {
 #ifdef PERFORMANCE_METRICS
+        /* A frame may be transferred in several areas */
+        pixel_count += (gdi->frame.endx - gdi->frame.startx + 1) * (gdi->frame.endy - gdi->frame.starty + 1);
         frame_transfer_start = gdi_get_sys_uptime_ticks();
 #endif
 }
@@ -648,6 +755,11 @@ static void frame_update_cb(AD_LCDC_ERROR status, void *cb_data)
 {
         gdi_t *data = (gdi_t *)cb_data;
 
+        /* In continuous mode every frame cycle is started by the TE pulse */
+        if (data->continuous_mode_enable_current) {
+                te_time_us = gdi_convert_ticks_to_us(gdi_get_sys_uptime_ticks());
+        }
+
         data->underflow = (status == AD_LCDC_ERROR_UNDERFLOW);
         if (status) {
                 handle_error(status);
@@ -675,6 +787,8 @@ static void dev_continuous_mode_disable(void)
               ad_lcdc_continuous_update_stop(gdi->display_h);
               /* Zero the flag so that, the device can close */
               gdi->continuous_mode_enable_current = false;
+              /* The pulses are no longer timed */
+              te_time_us = 0;
               dev_close_display();
       }
       DISPLAY_MUTEX_PUT();
@@ -1432,10 +1546,6 @@ void gdi_set_partial_update_area(gdi_coord_t x0, gdi_coord_t y0, gdi_coord_t x1,
         }
         memcpy(&gdi->frame, &frame, sizeof(frame));
 
-#ifdef PERFORMANCE_METRICS
-        pixel_count = (frame.endx - frame.startx + 1) * (frame.endy - frame.starty + 1);
-#endif
-
         dev_open_display();
         dev_set_partial_update();
         dev_close_display();
@@ -1550,10 +1660,13 @@ static void dma_2d_cb(void *user_data, dma_size_t len)
 
 static void _gdi_memcpy_2d(gdi_dma_t *dma_data, void *dst, const void *src, size_t length, int dst_step, int src_step, size_t reps)
 {
+        /* The bus width must suit every row, not only the length */
+        uint32_t align = length | (uint32_t)dst | (uint32_t)src | dst_step | src_step;
+
         dma_data->gdi = gdi;
 
-        dma_data->dma.bus_width = !(length & 3) ? HW_DMA_BW_WORD :
-                                 !(length & 1) ? HW_DMA_BW_HALFWORD : HW_DMA_BW_BYTE;
+        dma_data->dma.bus_width = !(align & 3) ? HW_DMA_BW_WORD :
+                                 !(align & 1) ? HW_DMA_BW_HALFWORD : HW_DMA_BW_BYTE;
         dma_data->dst_step = dst_step;
         dma_data->src_step = src_step;
 
@@ -1596,9 +1709,14 @@ void gdi_memmove(void *dst, const void *src, size_t length)
 void gdi_memcpy_2d(void *dst, const void *src, size_t length, int dst_step, int src_step, size_t reps)
 {
         gdi_dma_t dma_data;
+
+        if (reps == 0) {
+                return;
+        }
         dma_data.res = _gdi_dma_setup(&dma_data.dma, HW_DMA_CHANNEL_0);
 
-        _gdi_memcpy_2d(&dma_data, dst, src, length, dst_step, src_step, reps);
+        /* The first copy is started here, dma_2d_cb() runs the remaining ones */
+        _gdi_memcpy_2d(&dma_data, dst, src, length, dst_step, src_step, reps - 1);
 
         OS_EVENT_WAIT(gdi->dma_event, OS_EVENT_FOREVER);
 }
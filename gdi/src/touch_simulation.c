@@ -176,8 +176,10 @@ void touch_simulation_set_data(GESTURE_TYPE type)
 /* User-defined routine used by GDI to read touch events */
 void touch_simulation_read_event(void *dev, gdi_touch_data_t *data)
 {
+        /* Like a touch controller, report the point of the last event: the events notified while
+         * GDI was busy are read once */
         if (gesture.index < gesture.count) {
-                memcpy(data, &((gdi_touch_data_t *)gesture.data)[gesture.index++], sizeof(gdi_touch_data_t));
+                memcpy(data, &((gdi_touch_data_t *)gesture.data)[gesture.index], sizeof(gdi_touch_data_t));
         }
 }
 
@@ -186,6 +188,7 @@ void touch_simulation(GESTURE_TYPE type)
         touch_simulation_set_data(type);
 
         for (uint16_t i = 0; i < gesture.count; i++) {
+                gesture.index = i;
                 gdi_touch_event();
                 OS_DELAY(OS_MS_2_TICKS(TOUCH_DATA_DELAY_MS));
         }
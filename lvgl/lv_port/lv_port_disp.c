@@ -21,6 +21,12 @@
 #include "osal.h"
 #include "gdi.h"
 #include "demo.h"
+#ifdef PERFORMANCE_METRICS
+#include "metrics.h"
+#endif
+#if LV_PORT_DISP_HEAP_MAP_PERIOD
+#include "gdi_sim.h"
+#endif
 
 
 /*********************
@@ -29,9 +35,64 @@
 #define LAYER_OFFSET_X                  ((GDI_DISP_RESX - GDI_FB_RESX) / 2)
 #define LAYER_OFFSET_Y                  ((GDI_DISP_RESY - GDI_FB_RESY) / 2)
 
+/* The LCDC can blend the objects over the retained background only if they have an alpha channel */
+#define RETAINED_BG_BLEND               (LV_PORT_DISP_RETAINED_BG && LV_COLOR_DEPTH == 32 && LV_COLOR_SCREEN_TRANSP)
+
+/* Unit vector towards the side the destination of a transition comes from */
+#define TRANS_DIR_X(dir)                ((dir) == LV_DIR_RIGHT ? 1 : (dir) == LV_DIR_LEFT ? -1 : 0)
+#define TRANS_DIR_Y(dir)                ((dir) == LV_DIR_BOTTOM ? 1 : (dir) == LV_DIR_TOP ? -1 : 0)
+
+/* TE periods between two frames so as not to exceed a frame rate */
+#define PACE_INTERVAL(fps)              (MAX(1, (1000000 + (fps) * GDI_TE_PERIOD_US - 1) / ((fps) * GDI_TE_PERIOD_US)))
+
+#if LV_PORT_DISP_RETAINED_BG
+#if LV_PORT_DISP_RETAINED_BG_ADR
+#define RETAINED_BG_BUF                 ((lv_color_t *)LV_PORT_DISP_RETAINED_BG_ADR)
+#else
+#define RETAINED_BG_BUF                 (retained_bg_buf)
+#endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+typedef enum {
+        TRANS_IDLE,
+        TRANS_RENDER_SRC,
+        TRANS_RENDER_DST,
+        TRANS_SHOW,
+} trans_state_t;
+
+typedef struct {
+        trans_state_t state;
+        lv_port_disp_trans_t type;
+        lv_dir_t dir;
+        lv_obj_t *scr, *prev_scr;               /* Screens of lv_port_disp_trans_start() */
+        bool auto_del;
+        uint32_t anim_time;
+        lv_obj_t *scroll_obj;                   /* Object of lv_port_disp_trans_scroll() */
+        lv_coord_t scroll_x, scroll_y;          /* Its scroll position at the start */
+        lv_color_t *src_buf, *dst_buf;
+        lv_coord_t band_y;                      /* First row of the next band to render */
+        int32_t progress;                       /* Requested */
+        int32_t shown;                          /* On display */
+        int32_t zoomed;                         /* Drawn by the GPU into the source frame buffer */
+        volatile bool updating;
+        lv_timer_t *render_timer, *refr_timer, *dummy_timer;
+        /* Invalidated areas kept while rendering a band */
+        lv_area_t inv_areas[LV_INV_BUF_SIZE];
+        uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+        uint16_t inv_p;
+} trans_ctx_t;
+
+typedef struct {
+        uint64_t request;                       /* First run of the refresh timer since the last frame, 0 if none */
+        uint64_t slot;                          /* TE pulse of the last frame */
+        uint64_t flush;                         /* First flush of the refresh in progress, 0 before */
+        uint32_t interval;                      /* TE periods between two frames at least */
+        int periods, drops;                     /* Of the refresh in progress, for the metrics */
+        lv_port_disp_pace_stat_t stat;          /* cost_us is the prediction of the next refresh */
+} pace_ctx_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -41,6 +102,35 @@ static void disp_init(void);
 static void disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
 static void disp_rounder(struct _lv_disp_drv_t *disp_drv, lv_area_t *area);
 static void disp_wait(lv_disp_drv_t *disp_drv);
+#if LV_PORT_DISP_FLUSH_COST_NS
+static uint32_t disp_refr_cost(lv_disp_drv_t *disp_drv, const lv_area_t *area, uint32_t flush_cnt);
+#endif
+#if LV_PORT_DISP_DIRECT_MODE
+static uint32_t fb_sync_area(lv_color_t *dst, const lv_color_t *src, const lv_area_t *area, uint16_t i);
+#endif
+
+static bool trans_init(lv_disp_t *disp, lv_port_disp_trans_t type, lv_dir_t dir);
+static void trans_render_timer_cb(lv_timer_t *timer);
+static void trans_render_band(lv_disp_t *disp, bool dst, lv_coord_t y1, lv_coord_t y2);
+static void trans_show(int32_t progress);
+static void trans_update_cb(bool underflow, void *user_data);
+static void trans_update_wait(void);
+static void trans_scroll_event_cb(lv_event_t *e);
+static int32_t trans_scroll_progress(void);
+static void trans_anim_cb(void *var, int32_t progress);
+static void trans_anim_ready_cb(lv_anim_t *a);
+
+#if LV_PORT_DISP_PACE
+static void pace_refr_timer_cb(lv_timer_t *timer);
+static uint64_t pace_time(void);
+#endif
+
+#if LV_PORT_DISP_RETAINED_BG
+static void retained_bg_event_cb(lv_event_t *e);
+#endif
+#if RETAINED_BG_BLEND
+static void retained_bg_set_layer(bool enable);
+#endif
 
 #ifdef PERFORMANCE_METRICS
 static void perf_monitor(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
@@ -51,14 +141,63 @@ static void perf_monitor(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
 PRIVILEGED_DATA static lv_disp_draw_buf_t draw_buf_dsc;
 INITIALISED_PRIVILEGED_DATA static lv_color_t *fb_addr[2] = { 0 };
 PRIVILEGED_DATA static OS_EVENT flush_evt;
+INITIALISED_PRIVILEGED_DATA static HW_LCDC_LAYER flush_layer = HW_LCDC_LAYER_0;
+
+#if LV_PORT_DISP_DIRECT_MODE
+/* Areas drawn in the frame being rendered, [dirty_cur], and in the frame on display */
+PRIVILEGED_DATA static lv_area_t dirty_areas[2][LV_INV_BUF_SIZE];
+PRIVILEGED_DATA static uint16_t dirty_cnt[2];
+PRIVILEGED_DATA static uint8_t dirty_cur;
+/* Bytes copied to sync the back frame buffer in the last frame */
+PRIVILEGED_DATA static uint32_t fb_sync_bytes;
+#endif
+
+#if LV_PORT_DISP_RETAINED_BG
+#if !LV_PORT_DISP_RETAINED_BG_ADR
+PRIVILEGED_DATA static lv_color_t retained_bg_buf[LV_PORT_DISP_HOR_RES * LV_PORT_DISP_VER_RES];
+#endif
+PRIVILEGED_DATA static lv_img_dsc_t retained_bg_img;
+PRIVILEGED_DATA static lv_obj_t *retained_bg_obj;
+#endif
+#if RETAINED_BG_BLEND
+/* The retained background is shown by the LCDC background layer */
+PRIVILEGED_DATA static bool retained_bg_layer;
+#endif
+
+PRIVILEGED_DATA static trans_ctx_t trans;
+
+#if LV_PORT_DISP_PACE
+PRIVILEGED_DATA static pace_ctx_t pace;
+#endif
 
-#if TWO_LAYERS_HORIZONTAL_SLIDING
-INITIALISED_PRIVILEGED_DATA static void *flush_cb_def = NULL;
-PRIVILEGED_DATA static lv_timer_t *refr_timer_def, *dummy_timer;
+#if DLG_LVGL_USE_PROFILER
+/* The LCDC track of the profiler is busy from the request of an update until its completion */
+PRIVILEGED_DATA static uint8_t prof_track, prof_update;
 #endif
 
 #ifdef PERFORMANCE_METRICS
 PRIVILEGED_DATA static uint64_t flush_evt_wait;
+/* Transfer time of the tiles flushed before the last one and time spent waiting for them */
+PRIVILEGED_DATA static uint64_t tile_transfer_start, tile_transfer_time, tile_transfer_wait;
+PRIVILEGED_DATA static volatile bool tile_transfer_last;
+#if DLG_LVGL_USE_IMG_ROT_CACHE
+PRIVILEGED_DATA static lv_img_rot_cache_stat_t rot_cache_stat;
+#endif
+#if DLG_LVGL_USE_GLYPH_CACHE
+PRIVILEGED_DATA static lv_glyph_cache_stat_t glyph_cache_stat;
+#endif
+#if DLG_LVGL_USE_IMG_CACHE
+PRIVILEGED_DATA static lv_img_cache_stat_t img_cache_stat;
+#endif
+#if DLG_LVGL_USE_CORNER_CACHE
+PRIVILEGED_DATA static lv_corner_cache_stat_t corner_cache_stat;
+#endif
+#if DLG_LVGL_USE_STYLE_CACHE
+PRIVILEGED_DATA static lv_obj_style_cache_stat_t style_cache_stat;
+#endif
+#if DLG_LVGL_USE_MEM_BUF_POOL
+PRIVILEGED_DATA static uint32_t buf_heap_cnt;
+#endif
 #endif
 
 /**********************
@@ -105,15 +244,26 @@ void lv_port_disp_init(void)
         /* Set a display buffer */
         disp_drv.draw_buf = &draw_buf_dsc;
 
+        /* Render and transfer large areas in tiles */
+        disp_drv.tile_size = LV_PORT_DISP_TILE_SIZE;
+
         /* Set rounder callback to modify coordinates according to LCD requirements */
         disp_drv.rounder_cb = disp_rounder;
 
+#if LV_PORT_DISP_FLUSH_COST_NS
+        /* Merge the invalidated areas according to the cost of the partial updates */
+        disp_drv.refr_cost_cb = disp_refr_cost;
+#endif
+
         /* Enable task go to sleep while waiting for event */
         OS_EVENT_CREATE(flush_evt);
         disp_drv.wait_cb = disp_wait;
 
 //        disp_drv.full_refresh = 1;
 
+        /* Draw in place into the frame buffers and flip between them */
+        disp_drv.direct_mode = LV_PORT_DISP_DIRECT_MODE;
+
 #if LV_PORT_DISP_GPU_EN
         /* Initialize GPU module */
         lv_port_gpu_init();
@@ -122,85 +272,85 @@ void lv_port_disp_init(void)
         disp_drv.gpu_fill_cb = lv_port_gpu_fill;
         disp_drv.gpu_blit_cb = lv_port_gpu_blit;
         disp_drv.gpu_blit_with_mask_cb = lv_port_gpu_blit_with_mask;
+        disp_drv.gpu_blit_batch_cb = lv_port_gpu_blit_batch;
+        disp_drv.gpu_draw_shape_cb = lv_port_gpu_draw_shape;
         disp_drv.gpu_config_blit_cb = lv_port_gpu_config_blit;
         disp_drv.gpu_wait_cb = lv_port_gpu_wait;
+        disp_drv.gpu_invalidate_src_cb = lv_port_gpu_invalidate_src;
 #endif /* LV_PORT_DISP_GPU_EN */
 
 #ifdef PERFORMANCE_METRICS
         disp_drv.monitor_cb = perf_monitor;
+#if DLG_LVGL_USE_MEM_TELEMETRY && LV_PORT_DISP_HEAP_MAP_PERIOD
+        lv_mem_map_start(gdi_sim_heap_map, NULL, LV_PORT_DISP_HEAP_MAP_PERIOD);
+#endif
+#endif
+
+#if DLG_LVGL_USE_PROFILER
+        prof_track = lv_profiler_register_track("LCDC");
+        prof_update = lv_profiler_register("lcdc_update");
 #endif
 
         /* Finally register the driver */
-        lv_disp_drv_register(&disp_drv);
+        lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+
+#if LV_PORT_DISP_PACE
+        /* The refresh timer plans the next frame when something is invalidated */
+        pace.interval = 1;
+        lv_timer_set_cb(disp->refr_timer, pace_refr_timer_cb);
+#else
+        LV_UNUSED(disp);
+#endif
 }
 
-#if TWO_LAYERS_HORIZONTAL_SLIDING
-void lv_port_disp_slide_init(lv_obj_t *obj, lv_dir_t dir)
+bool lv_port_disp_trans_start(lv_obj_t *scr, lv_port_disp_trans_t type, lv_dir_t dir)
 {
-        int dx = 0;
-        lv_disp_t *disp;
-
-        disp = lv_disp_get_default();
+        lv_disp_t *disp = lv_obj_get_disp(scr);
 
-        if (dir == LV_DIR_RIGHT) {
-                dx = -lv_disp_get_hor_res(disp);
+        if (scr == lv_disp_get_scr_act(disp) || !trans_init(disp, type, dir)) {
+                return false;
         }
-        else if (dir == LV_DIR_LEFT) {
-                dx = lv_disp_get_hor_res(disp);
-        }
-
-        lv_obj_clear_state(obj, LV_STATE_SCROLLED);
-
-        /* When partial update is enabled full redraw of watch face is required */
-        lv_obj_invalidate(obj);
-
-        /* Force a full frame update (disable partial update) */
-        gdi_set_partial_update_area(LAYER_OFFSET_X + 0, LAYER_OFFSET_Y + 0,
-                LAYER_OFFSET_X + lv_disp_get_hor_res(disp),
-                LAYER_OFFSET_Y + lv_disp_get_ver_res(disp));
-
-        /* Store default display driver call backs */
-        flush_cb_def = *disp->driver->flush_cb;
-        refr_timer_def = disp->refr_timer;
-
-        /* Stop display update */
-        disp->driver->flush_cb = NULL;
 
-        /* Draw the whole watch face screen */
-        lv_refr_now(disp);
+        trans.scr = scr;
+        trans.prev_scr = disp->act_scr;
+        disp->act_scr = scr;
 
-        /* Inform the graphics library that you are ready with the flushing */
-        lv_disp_flush_ready(disp->driver);
+        return true;
+}
 
-        /* Pause the refresh time to prevent any display update or frame buffer switch */
-        lv_timer_pause(disp->refr_timer);
+bool lv_port_disp_trans_scroll(lv_obj_t *obj, lv_port_disp_trans_t type, lv_dir_t dir)
+{
+        if (!trans_init(lv_obj_get_disp(obj), type, dir)) {
+                return false;
+        }
 
-        /* Set the menu screen visible and invalidate the active screen */
-        lv_obj_move_children_by(obj, dx, 0, true);
-        lv_obj_invalidate(obj);
+        lv_obj_clear_state(obj, LV_STATE_SCROLLED);
 
-        /* Draw the menu screen in the non active frame buffer */
-        lv_refr_now(disp);
+        trans.scroll_obj = obj;
+        trans.scroll_x = lv_obj_get_scroll_x(obj);
+        trans.scroll_y = lv_obj_get_scroll_y(obj);
+        lv_obj_add_event_cb(obj, trans_scroll_event_cb, LV_EVENT_SCROLL, NULL);
 
-        /* Inform the graphics library that you are ready with the flushing */
-        lv_disp_flush_ready(disp->driver);
+        return true;
+}
 
-        /* Move back the position of the affected objects since scroll_by_raw handles it */
-        lv_obj_move_children_by(obj, -dx, 0, true);
+void lv_port_disp_trans_set_progress(int32_t progress)
+{
+        trans.progress = LV_CLAMP(0, progress, LV_PORT_DISP_TRANS_PROGRESS_MAX);
 
-        /* Create a dummy timer to prevent drawing triggered from objects invalidation */
-        dummy_timer = lv_timer_create_basic();
-        disp->refr_timer = dummy_timer;
+        /* Shown once both screens are rendered */
+        if (trans.state == TRANS_SHOW) {
+                trans_show(trans.progress);
+        }
 }
 
-void lv_port_disp_slide(int posXLayer0, int posXLayer1)
+void lv_port_disp_trans_end(void)
 {
-        int posYLayer0 = 0, posYLayer1 = 0;
-        lv_disp_t *disp;
-        lv_disp_draw_buf_t *draw_buf;
-
-        void *layer0_addr = NULL, *layer1_addr = NULL;
+        lv_disp_t *disp = lv_disp_get_default();
+        lv_disp_draw_buf_t *draw_buf = lv_disp_get_draw_buf(disp);
         gdi_color_fmt_t color_fmt = GDI_FORMAT_ARGB8888;
+        lv_color_t *front_buf;
+        bool to_dst, to_src;
 
 #if GDI_FB_COLOR_FORMAT == CF_NATIVE_RGB332
         color_fmt = GDI_FORMAT_RGB332;
@@ -210,85 +360,244 @@ void lv_port_disp_slide(int posXLayer0, int posXLayer1)
         color_fmt = GDI_FORMAT_ARGB8888;
 #endif
 
-        /* Set the position of Layer 0 in x direction */
-        gdi_set_layer_start(HW_LCDC_LAYER_0, posXLayer0 + LAYER_OFFSET_X,
-                posYLayer0 + LAYER_OFFSET_Y);
+        if (trans.state == TRANS_IDLE) {
+                return;
+        }
+
+        lv_anim_del(&trans, NULL);
+        if (trans.render_timer) {
+                lv_timer_del(trans.render_timer);
+                trans.render_timer = NULL;
+        }
 
-        /* Set the position of Layer 1 in x direction */
-        gdi_set_layer_start(HW_LCDC_LAYER_1, posXLayer1 + LAYER_OFFSET_X,
-                posYLayer1 + LAYER_OFFSET_Y);
+        if (trans.scroll_obj) {
+                lv_obj_remove_event_cb(trans.scroll_obj, trans_scroll_event_cb);
+                trans.progress = trans_scroll_progress();
 
-        if (!gdi_get_layer_enable(HW_LCDC_LAYER_1)) {
-                disp = lv_disp_get_default();
-                /* Manual refresh was triggered without display update.
-                 * Change the frame buffer addresses of both Layers */
-                draw_buf = lv_disp_get_draw_buf(disp);
-                if (draw_buf->buf1 && draw_buf->buf2) {
-                        if (draw_buf->buf_act == draw_buf->buf1) {
-                                layer0_addr = draw_buf->buf2;
-                                layer1_addr = draw_buf->buf1;
-                        }
-                        else if (draw_buf->buf_act == draw_buf->buf2) {
-                                layer0_addr = draw_buf->buf1;
-                                layer1_addr = draw_buf->buf2;
+                /* Scrolling invalidated the whole object all along */
+                lv_memset_00(disp->inv_areas, sizeof(disp->inv_areas));
+                lv_memset_00(disp->inv_area_joined, sizeof(disp->inv_area_joined));
+                disp->inv_p = 0;
+        }
+
+        /* Show the screen the transition ends on, if both have been rendered */
+        to_dst = trans.progress == LV_PORT_DISP_TRANS_PROGRESS_MAX;
+        to_src = trans.progress == 0 && trans.zoomed == 0;
+        if (trans.state == TRANS_SHOW && (to_dst || to_src)) {
+                trans_show(trans.progress);
+        }
+        trans_update_wait();
+
+        /* Re-enable the refresh timer */
+        lv_timer_del(trans.dummy_timer);
+        disp->refr_timer = trans.refr_timer;
+        lv_timer_resume(disp->refr_timer);
+
+        /* Back to a single layer */
+        gdi_set_layer_enable(HW_LCDC_LAYER_1, false);
+        gdi_set_layer_blending(HW_LCDC_LAYER_1, HW_LCDC_BL_SRC, 0xFF);
+        gdi_set_layer_src(HW_LCDC_LAYER_1, 0, DEMO_RESX, DEMO_RESY, color_fmt);
+        gdi_set_layer_start(HW_LCDC_LAYER_0, LAYER_OFFSET_X, LAYER_OFFSET_Y);
+
+        /* Render next into the frame buffer not on display */
+        front_buf = trans.shown == LV_PORT_DISP_TRANS_PROGRESS_MAX ? trans.dst_buf : trans.src_buf;
+        draw_buf->buf_act = front_buf == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+#if LV_PORT_DISP_DIRECT_MODE
+        /* Copy whatever the next frame does not draw from the one on display */
+        dirty_cnt[dirty_cur] = 0;
+        dirty_cnt[dirty_cur ^ 1] = 1;
+        lv_area_set(&dirty_areas[dirty_cur ^ 1][0], 0, 0, LV_PORT_DISP_HOR_RES - 1, LV_PORT_DISP_VER_RES - 1);
+#endif
+
+        if (trans.scr) {
+                if (to_dst) {
+                        lv_event_send(trans.prev_scr, LV_EVENT_SCREEN_UNLOADED, NULL);
+                        lv_event_send(trans.scr, LV_EVENT_SCREEN_LOADED, NULL);
+                        if (trans.auto_del) {
+                                lv_obj_del(trans.prev_scr);
                         }
                 }
+                else {
+                        disp->act_scr = trans.prev_scr;
+                }
+        }
 
-                /* Set the address of the video RAM of Layer 1 */
-                gdi_set_layer_src(HW_LCDC_LAYER_1, layer1_addr, DEMO_RESX, DEMO_RESY, color_fmt);
+        /* The display shows neither screen as it is */
+        if (!(to_dst && trans.shown == LV_PORT_DISP_TRANS_PROGRESS_MAX) && !(to_src && trans.shown == 0)) {
+                lv_obj_invalidate(lv_disp_get_scr_act(disp));
+        }
 
-                /* Enable the visibility of Layer 1 */
-                gdi_set_layer_enable(HW_LCDC_LAYER_1, 1);
+#if RETAINED_BG_BLEND
+        if (retained_bg_obj && lv_obj_get_screen(retained_bg_obj) == lv_disp_get_scr_act(disp)) {
+                retained_bg_set_layer(true);
+        }
+#endif
 
-                /* Set the address of the video RAM of Layer 0 */
-                gdi_set_layer_src(HW_LCDC_LAYER_0, layer0_addr, DEMO_RESX, DEMO_RESY, color_fmt);
+        lv_memset_00(&trans, sizeof(trans));
+}
+
+void lv_port_disp_scr_load(lv_obj_t *scr, lv_port_disp_trans_t type, lv_dir_t dir, uint32_t time,
+        bool auto_del)
+{
+        static const lv_scr_load_anim_t anim_types[][4] = {
+                /* LV_DIR_LEFT, LV_DIR_RIGHT, LV_DIR_TOP, LV_DIR_BOTTOM */
+                [LV_PORT_DISP_TRANS_SLIDE] = { LV_SCR_LOAD_ANIM_MOVE_RIGHT, LV_SCR_LOAD_ANIM_MOVE_LEFT,
+                        LV_SCR_LOAD_ANIM_MOVE_BOTTOM, LV_SCR_LOAD_ANIM_MOVE_TOP },
+                [LV_PORT_DISP_TRANS_COVER] = { LV_SCR_LOAD_ANIM_OVER_RIGHT, LV_SCR_LOAD_ANIM_OVER_LEFT,
+                        LV_SCR_LOAD_ANIM_OVER_BOTTOM, LV_SCR_LOAD_ANIM_OVER_TOP },
+                [LV_PORT_DISP_TRANS_UNCOVER] = { LV_SCR_LOAD_ANIM_MOVE_RIGHT, LV_SCR_LOAD_ANIM_MOVE_LEFT,
+                        LV_SCR_LOAD_ANIM_MOVE_BOTTOM, LV_SCR_LOAD_ANIM_MOVE_TOP },
+        };
+
+        /* Finish the running transition, a screen load on its destination */
+        if (trans.state != TRANS_IDLE) {
+                if (trans.scr == scr) {
+                        return;
+                }
+                if (trans.scr) {
+                        trans.progress = LV_PORT_DISP_TRANS_PROGRESS_MAX;
+                }
+                lv_port_disp_trans_end();
         }
 
-        /* Trigger an LCD display update */
-        gdi_display_update_async(NULL, NULL);
+        if (time == 0 || !lv_port_disp_trans_start(scr, type, dir)) {
+                lv_scr_load_anim_t anim_type = LV_SCR_LOAD_ANIM_FADE_ON;
+
+                if (time == 0) {
+                        anim_type = LV_SCR_LOAD_ANIM_NONE;
+                }
+                else if (type <= LV_PORT_DISP_TRANS_UNCOVER && dir != LV_DIR_NONE) {
+                        anim_type = anim_types[type][dir == LV_DIR_LEFT ? 0 : dir == LV_DIR_RIGHT ? 1 :
+                                dir == LV_DIR_TOP ? 2 : 3];
+                }
+                lv_scr_load_anim(scr, anim_type, time, 0, auto_del);
+                return;
+        }
+
+        /* The animation starts once the screens are rendered */
+        trans.auto_del = auto_del;
+        trans.anim_time = time;
 }
 
-void lv_port_disp_slide_end()
+
+#if LV_PORT_DISP_PACE
+void lv_port_disp_pace_set_fps(uint32_t fps)
 {
-        lv_disp_t *disp;
-        int posXLayer0 = 0, posYLayer0 = 0;
-        gdi_color_fmt_t color_fmt = GDI_FORMAT_ARGB8888;
+        pace.interval = fps ? PACE_INTERVAL(fps) : 1;
+}
 
-#if GDI_FB_COLOR_FORMAT == CF_NATIVE_RGB332
-        color_fmt = GDI_FORMAT_RGB332;
-#elif GDI_FB_COLOR_FORMAT == CF_NATIVE_RGB565
-        color_fmt = GDI_FORMAT_RGB565;
-#elif GDI_FB_COLOR_FORMAT == CF_NATIVE_ARGB8888
-        color_fmt = GDI_FORMAT_ARGB8888;
+void lv_port_disp_pace_get_stat(lv_port_disp_pace_stat_t *stat)
+{
+        *stat = pace.stat;
+}
 #endif
 
-        disp = lv_disp_get_default();
+#if LV_PORT_DISP_RETAINED_BG
+void lv_port_disp_retain_bg(lv_obj_t *obj)
+{
+        lv_disp_t *disp = lv_obj_get_disp(obj);
+        lv_disp_draw_buf_t *draw_buf = lv_disp_get_draw_buf(disp);
+        void (*flush_cb_prev)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *) = disp->driver->flush_cb;
+        uint32_t child_cnt, hidden_cnt = 0;
+        lv_obj_t **hidden;
+        lv_area_t coords;
+
+        lv_port_disp_release_bg();
+
+        lv_obj_update_layout(obj);
+        lv_obj_get_coords(obj, &coords);
+        if (coords.x1 != 0 || coords.y1 != 0 || lv_area_get_width(&coords) != LV_PORT_DISP_HOR_RES
+                || lv_area_get_height(&coords) != LV_PORT_DISP_VER_RES) {
+                return;
+        }
+
+        child_cnt = lv_obj_get_child_cnt(obj);
+        hidden = lv_mem_alloc(sizeof(lv_obj_t *) * (child_cnt + 1));
+        if (!hidden) {
+                return;
+        }
 
-        /*Clean up invalidated areas*/
-        lv_memset_00(disp->inv_areas, sizeof(disp->inv_areas));
-        lv_memset_00(disp->inv_area_joined, sizeof(disp->inv_area_joined));
-        disp->inv_p = 0;
+        /* Hide the dynamic objects */
+        for (uint32_t i = 0; i < child_cnt; i++) {
+                lv_obj_t *child = lv_obj_get_child(obj, i);
 
-        /* Re-enable display update and refresh timer callbacks */
-        disp->driver->flush_cb = flush_cb_def;
-        disp->refr_timer = refr_timer_def;
+                if (!lv_obj_has_flag_any(child, LV_PORT_DISP_FLAG_STATIC | LV_OBJ_FLAG_HIDDEN)) {
+                        lv_obj_add_flag(child, LV_OBJ_FLAG_HIDDEN);
+                        hidden[hidden_cnt++] = child;
+                }
+        }
 
-        lv_timer_del(dummy_timer);
-        dummy_timer = NULL;
+        /* Render the whole object at once in a frame buffer, without transferring it */
+        disp->driver->flush_cb = NULL;
+        disp->driver->tile_size = 0;
+        lv_obj_invalidate(obj);
+        lv_refr_now(disp);
+        lv_disp_flush_ready(disp->driver);
+        disp->driver->flush_cb = flush_cb_prev;
+        disp->driver->tile_size = LV_PORT_DISP_TILE_SIZE;
 
-        lv_timer_resume(disp->refr_timer);
+        /* The frame buffers have been swapped after rendering */
+        lv_memcpy(RETAINED_BG_BUF, draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1,
+                LV_PORT_DISP_HOR_RES * LV_PORT_DISP_VER_RES * sizeof(lv_color_t));
 
-        /* Disable the visibility of Layer 1 */
-        gdi_set_layer_enable(HW_LCDC_LAYER_1, 0);
+        for (uint32_t i = 0; i < hidden_cnt; i++) {
+                lv_obj_clear_flag(hidden[i], LV_OBJ_FLAG_HIDDEN);
+        }
+        lv_mem_free(hidden);
 
-        /* Reset the address of the video RAM of Layer 1 */
-        gdi_set_layer_src(HW_LCDC_LAYER_1, 0, DEMO_RESX, DEMO_RESY, color_fmt);
+        /* From now on the static objects are drawn from the retained background */
+        for (uint32_t i = 0; i < child_cnt; i++) {
+                lv_obj_t *child = lv_obj_get_child(obj, i);
 
-        /* Restore the position of Layer 0 */
-        gdi_set_layer_start(HW_LCDC_LAYER_0, posXLayer0 + LAYER_OFFSET_X,
-                posYLayer0 + LAYER_OFFSET_Y);
+                if (lv_obj_has_flag(child, LV_PORT_DISP_FLAG_STATIC)) {
+                        lv_obj_add_flag(child, LV_OBJ_FLAG_HIDDEN);
+                }
+        }
+
+        retained_bg_img.header.always_zero = 0;
+        retained_bg_img.header.w = LV_PORT_DISP_HOR_RES;
+        retained_bg_img.header.h = LV_PORT_DISP_VER_RES;
+        retained_bg_img.header.cf = LV_IMG_CF_TRUE_COLOR;
+        retained_bg_img.data_size = LV_PORT_DISP_HOR_RES * LV_PORT_DISP_VER_RES * sizeof(lv_color_t);
+        retained_bg_img.data = (const uint8_t *)RETAINED_BG_BUF;
+
+        retained_bg_obj = obj;
+        lv_obj_add_event_cb(obj, retained_bg_event_cb, LV_EVENT_ALL, NULL);
+
+#if RETAINED_BG_BLEND
+        retained_bg_set_layer(true);
+#endif
+        lv_obj_invalidate(obj);
 }
-#endif /* TWO_LAYERS_HORIZONTAL_SLIDING */
+
+void lv_port_disp_release_bg(void)
+{
+        lv_obj_t *obj = retained_bg_obj;
+
+        if (!obj) {
+                return;
+        }
+
+        lv_obj_remove_event_cb(obj, retained_bg_event_cb);
+        retained_bg_obj = NULL;
+
+        for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+                lv_obj_t *child = lv_obj_get_child(obj, i);
+
+                if (lv_obj_has_flag(child, LV_PORT_DISP_FLAG_STATIC)) {
+                        lv_obj_clear_flag(child, LV_OBJ_FLAG_HIDDEN);
+                }
+        }
+
+#if RETAINED_BG_BLEND
+        if (retained_bg_layer) {
+                retained_bg_set_layer(false);
+        }
+#endif
+        lv_img_cache_invalidate_src(&retained_bg_img);
+        lv_obj_invalidate(obj);
+}
+#endif /* LV_PORT_DISP_RETAINED_BG */
 
 /**********************
  *   STATIC FUNCTIONS
@@ -325,10 +634,76 @@ static void disp_rounder(lv_disp_drv_t *disp_drv, lv_area_t *area)
         area->y2 = MIN(y1 - LAYER_OFFSET_Y, GDI_FB_RESY - 1);
 }
 
+#if LV_PORT_DISP_FLUSH_COST_NS
+static uint32_t disp_refr_cost(lv_disp_drv_t *disp_drv, const lv_area_t *area, uint32_t flush_cnt)
+{
+        /* The area is already aligned by disp_rounder() */
+        return flush_cnt * LV_PORT_DISP_FLUSH_COST_NS + lv_area_get_size(area) * LV_PORT_DISP_PX_COST_NS;
+}
+#endif
+
+#if LV_PORT_DISP_DIRECT_MODE
+/* Copy the part of an area which is not covered by the drawn areas from the i-th one on, and return
+ * the number of bytes copied */
+static uint32_t fb_sync_area(lv_color_t *dst, const lv_color_t *src, const lv_area_t *area, uint16_t i)
+{
+        const lv_area_t *drawn = dirty_areas[dirty_cur];
+        lv_area_t common, part;
+        uint32_t offset, length, bytes = 0;
+
+        for (; i < dirty_cnt[dirty_cur]; i++) {
+                if (!_lv_area_intersect(&common, area, &drawn[i])) {
+                        continue;
+                }
+
+                /* Split the rest of the area in the bands above and below and the parts on the left
+                 * and on the right of the drawn area, and check them against the next ones */
+                if (common.y1 > area->y1) {
+                        lv_area_set(&part, area->x1, area->y1, area->x2, common.y1 - 1);
+                        bytes += fb_sync_area(dst, src, &part, i + 1);
+                }
+                if (common.y2 < area->y2) {
+                        lv_area_set(&part, area->x1, common.y2 + 1, area->x2, area->y2);
+                        bytes += fb_sync_area(dst, src, &part, i + 1);
+                }
+                if (common.x1 > area->x1) {
+                        lv_area_set(&part, area->x1, common.y1, common.x1 - 1, common.y2);
+                        bytes += fb_sync_area(dst, src, &part, i + 1);
+                }
+                if (common.x2 < area->x2) {
+                        lv_area_set(&part, common.x2 + 1, common.y1, area->x2, common.y2);
+                        bytes += fb_sync_area(dst, src, &part, i + 1);
+                }
+                return bytes;
+        }
+
+        offset = area->y1 * LV_PORT_DISP_HOR_RES + area->x1;
+        length = lv_area_get_width(area) * sizeof(lv_color_t);
+        if (lv_area_get_width(area) == LV_PORT_DISP_HOR_RES) {
+                gdi_memcpy(dst + offset, src + offset, length * lv_area_get_height(area));
+        }
+        else {
+                gdi_memcpy_2d(dst + offset, src + offset, length, LV_PORT_DISP_HOR_RES * sizeof(lv_color_t),
+                        LV_PORT_DISP_HOR_RES * sizeof(lv_color_t), lv_area_get_height(area));
+        }
+
+        return length * lv_area_get_height(area);
+}
+#endif
+
 static void flush_cb(bool underflow, void *user_data)
 {
         lv_disp_drv_t *disp_drv = (lv_disp_drv_t*)user_data;
 
+        LV_PROFILER_END_ON(prof_update, prof_track);
+
+#ifdef PERFORMANCE_METRICS
+        /* The transfer of a tile overlaps with the rendering of the next one */
+        if (!tile_transfer_last) {
+                tile_transfer_time += gdi_get_sys_uptime_ticks() - tile_transfer_start;
+        }
+#endif
+
         /* Inform the graphics library that you are ready with the flushing */
         lv_disp_flush_ready(disp_drv);
 
@@ -348,12 +723,55 @@ static void disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_
         color_fmt = GDI_FORMAT_ARGB8888;
 #endif
 
+#if LV_PORT_DISP_DIRECT_MODE
+        lv_area_t frame_area;
+        lv_color_t *front_buf = color_p == fb_addr[0] ? fb_addr[1] : fb_addr[0];
+
+        /* LVGL refreshes at most LV_INV_BUF_SIZE areas in a frame */
+        if (dirty_cnt[dirty_cur] < LV_INV_BUF_SIZE) {
+                dirty_areas[dirty_cur][dirty_cnt[dirty_cur]++] = *area;
+        }
+
+        /* The areas are drawn in place, the frame is shown after the last one */
+        if (!lv_disp_flush_is_last(disp_drv)) {
+                lv_disp_flush_ready(disp_drv);
+                return;
+        }
+
+        /* The back frame buffer misses the areas drawn in the frame on display */
+        fb_sync_bytes = 0;
+        if (front_buf && front_buf != color_p) {
+                for (uint16_t i = 0; i < dirty_cnt[dirty_cur ^ 1]; i++) {
+                        fb_sync_bytes += fb_sync_area(color_p, front_buf, &dirty_areas[dirty_cur ^ 1][i], 0);
+                }
+        }
+
+        /* Transfer the bounding box of the drawn areas */
+        frame_area = dirty_areas[dirty_cur][0];
+        for (uint16_t i = 1; i < dirty_cnt[dirty_cur]; i++) {
+                _lv_area_join(&frame_area, &frame_area, &dirty_areas[dirty_cur][i]);
+        }
+        area = &frame_area;
+
+        dirty_cur ^= 1;
+        dirty_cnt[dirty_cur] = 0;
+#endif
+
+#if LV_PORT_DISP_PACE
+        if (!pace.flush) {
+                pace.flush = pace_time();
+        }
+#endif
+
 #ifdef PERFORMANCE_METRICS
         uint64_t flush_evt_timestamp = gdi_get_sys_uptime_ticks();
 #endif
 
 #if LV_PORT_DISP_GPU_EN
-        lv_port_gpu_flush();
+        /* Keep the GPU open for the remaining tiles of the frame */
+        if (lv_disp_flush_is_last(disp_drv)) {
+                lv_port_gpu_flush();
+        }
 #endif
 
 #if 0
@@ -365,10 +783,21 @@ static void disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_
         gdi_set_partial_update_area(LAYER_OFFSET_X + area->x1, LAYER_OFFSET_Y + area->y1,
                 LAYER_OFFSET_X + area->x2, LAYER_OFFSET_Y + area->y2);
 
-        gdi_set_layer_src(HW_LCDC_LAYER_0, color_p, lv_area_get_width(area), lv_area_get_height(area), color_fmt);
-        gdi_set_layer_start(HW_LCDC_LAYER_0, LAYER_OFFSET_X + area->x1, LAYER_OFFSET_Y + area->y1);
+#if LV_PORT_DISP_DIRECT_MODE
+        /* Flip to the frame buffer, the partial update area selects the part to transfer */
+        gdi_set_layer_src(flush_layer, color_p, LV_PORT_DISP_HOR_RES, LV_PORT_DISP_VER_RES, color_fmt);
+        gdi_set_layer_start(flush_layer, LAYER_OFFSET_X, LAYER_OFFSET_Y);
+#else
+        gdi_set_layer_src(flush_layer, color_p, lv_area_get_width(area), lv_area_get_height(area), color_fmt);
+        gdi_set_layer_start(flush_layer, LAYER_OFFSET_X + area->x1, LAYER_OFFSET_Y + area->y1);
+#endif
 
         gdi_perf_transfer_last(lv_disp_flush_is_last(disp_drv));
+#ifdef PERFORMANCE_METRICS
+        tile_transfer_last = lv_disp_flush_is_last(disp_drv);
+        tile_transfer_start = gdi_get_sys_uptime_ticks();
+#endif
+        LV_PROFILER_BEGIN_ON(prof_update, prof_track);
         gdi_display_update_async(flush_cb, disp_drv);
 
 #ifdef PERFORMANCE_METRICS
@@ -383,9 +812,509 @@ static void disp_wait(lv_disp_drv_t *disp_drv)
 #endif
         OS_EVENT_WAIT(flush_evt, OS_EVENT_FOREVER);
 #ifdef PERFORMANCE_METRICS
-        flush_evt_wait += gdi_get_sys_uptime_ticks() - flush_evt_timestamp;
+        flush_evt_timestamp = gdi_get_sys_uptime_ticks() - flush_evt_timestamp;
+        flush_evt_wait += flush_evt_timestamp;
+        if (!tile_transfer_last) {
+                /* The transfer took longer than rendering the next tile */
+                tile_transfer_wait += flush_evt_timestamp;
+        }
+#endif
+}
+
+static bool trans_init(lv_disp_t *disp, lv_port_disp_trans_t type, lv_dir_t dir)
+{
+        lv_disp_draw_buf_t *draw_buf = lv_disp_get_draw_buf(disp);
+
+        /* Both screens need a frame buffer and the LCDC a layer for each */
+        if (!LV_PORT_DISP_TRANS_LAYERS || HW_LCDC_LAYER_MAX <= HW_LCDC_LAYER_1 || !draw_buf->buf2) {
+                return false;
+        }
+
+        lv_port_disp_trans_end();
+
+        /* The last transfer might still read a frame buffer */
+        while (draw_buf->flushing) {
+                disp_wait(disp->driver);
+        }
+
+#if RETAINED_BG_BLEND
+        /* Render the retained background in the frame buffers */
+        if (retained_bg_layer) {
+                retained_bg_set_layer(false);
+        }
+#endif
+
+#if !LV_PORT_DISP_GPU_EN
+        /* Zooming needs the GPU */
+        if (type == LV_PORT_DISP_TRANS_ZOOM) {
+                type = LV_PORT_DISP_TRANS_FADE;
+        }
+#endif
+        trans.type = type;
+        trans.dir = dir;
+
+#if LV_PORT_DISP_DIRECT_MODE
+        /* The frame buffer on display holds the source already */
+        trans.dst_buf = draw_buf->buf_act;
+        trans.src_buf = draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+        trans.state = TRANS_RENDER_DST;
+#else
+        trans.src_buf = draw_buf->buf1;
+        trans.dst_buf = draw_buf->buf2;
+        trans.state = TRANS_RENDER_SRC;
+#endif
+
+        /* Invalidating an object resumes the refresh timer, give it a dummy one until the end */
+        trans.refr_timer = disp->refr_timer;
+        lv_timer_pause(trans.refr_timer);
+        trans.dummy_timer = lv_timer_create_basic();
+        disp->refr_timer = trans.dummy_timer;
+
+        trans.render_timer = lv_timer_create(trans_render_timer_cb, 0, NULL);
+
+        return true;
+}
+
+static void trans_render_timer_cb(lv_timer_t *timer)
+{
+        lv_disp_t *disp = lv_disp_get_default();
+        lv_coord_t y2 = MIN(trans.band_y + LV_PORT_DISP_TRANS_BAND_ROWS, LV_PORT_DISP_VER_RES) - 1;
+        lv_anim_t a;
+
+        trans_render_band(disp, trans.state == TRANS_RENDER_DST, trans.band_y, y2);
+
+        trans.band_y = y2 + 1;
+        if (trans.band_y < LV_PORT_DISP_VER_RES) {
+                return;
+        }
+
+        trans.band_y = 0;
+        if (trans.state == TRANS_RENDER_SRC) {
+                trans.state = TRANS_RENDER_DST;
+                return;
+        }
+
+        lv_timer_del(timer);
+        trans.render_timer = NULL;
+        trans.state = TRANS_SHOW;
+
+        if (!trans.anim_time) {
+                trans_show(trans.progress);
+                return;
+        }
+
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &trans);
+        lv_anim_set_exec_cb(&a, trans_anim_cb);
+        lv_anim_set_values(&a, 0, LV_PORT_DISP_TRANS_PROGRESS_MAX);
+        lv_anim_set_time(&a, trans.anim_time);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+        lv_anim_set_ready_cb(&a, trans_anim_ready_cb);
+        lv_anim_start(&a);
+}
+
+/* Draw rows of the source or of the destination screen into its frame buffer */
+static void trans_render_band(lv_disp_t *disp, bool dst, lv_coord_t y1, lv_coord_t y2)
+{
+        lv_disp_draw_buf_t *draw_buf = lv_disp_get_draw_buf(disp);
+        void (*flush_cb_prev)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *) = disp->driver->flush_cb;
+        uint32_t direct_mode_prev = disp->driver->direct_mode;
+        lv_obj_t *act_scr = disp->act_scr, *prev_scr = disp->prev_scr;
+        lv_coord_t dx = 0, dy = 0;
+        lv_area_t band;
+
+        /* Bring the objects where they are on the screen to draw. The layout is updated first, as it
+         * might invalidate other areas than the band. */
+        if (trans.scr) {
+                disp->act_scr = dst ? trans.scr : trans.prev_scr;
+                disp->prev_scr = NULL;
+                lv_obj_update_layout(disp->act_scr);
+        }
+        else {
+                lv_obj_update_layout(trans.scroll_obj);
+
+                /* Undo the scrolling since the start and move to the destination page */
+                dx = lv_obj_get_scroll_x(trans.scroll_obj) - trans.scroll_x;
+                dy = lv_obj_get_scroll_y(trans.scroll_obj) - trans.scroll_y;
+                if (dst) {
+                        dx -= TRANS_DIR_X(trans.dir) * LV_PORT_DISP_HOR_RES;
+                        dy -= TRANS_DIR_Y(trans.dir) * LV_PORT_DISP_VER_RES;
+                }
+                lv_obj_move_children_by(trans.scroll_obj, dx, dy, true);
+        }
+
+        /* Keep the invalidated areas for the refresh after the transition */
+        lv_memcpy(trans.inv_areas, disp->inv_areas, sizeof(trans.inv_areas));
+        lv_memcpy(trans.inv_area_joined, disp->inv_area_joined, sizeof(trans.inv_area_joined));
+        trans.inv_p = disp->inv_p;
+        disp->inv_p = 0;
+
+        lv_area_set(&band, 0, y1, LV_PORT_DISP_HOR_RES - 1, y2);
+        _lv_inv_area(disp, &band);
+
+        /* Draw in place, without transferring */
+        disp->driver->flush_cb = NULL;
+        disp->driver->tile_size = 0;
+        disp->driver->direct_mode = 1;
+        draw_buf->buf_act = dst ? trans.dst_buf : trans.src_buf;
+
+        /* Not lv_refr_now(), the animations must not move the objects meanwhile */
+        _lv_disp_refr_timer(trans.refr_timer);
+        lv_disp_flush_ready(disp->driver);
+
+        disp->driver->flush_cb = flush_cb_prev;
+        disp->driver->tile_size = LV_PORT_DISP_TILE_SIZE;
+        disp->driver->direct_mode = direct_mode_prev;
+
+        lv_memcpy(disp->inv_areas, trans.inv_areas, sizeof(trans.inv_areas));
+        lv_memcpy(disp->inv_area_joined, trans.inv_area_joined, sizeof(trans.inv_area_joined));
+        disp->inv_p = trans.inv_p;
+
+        if (trans.scr) {
+                disp->act_scr = act_scr;
+                disp->prev_scr = prev_scr;
+        }
+        else {
+                lv_obj_move_children_by(trans.scroll_obj, -dx, -dy, true);
+        }
+}
+
+/* Show the source and the destination screens with the layers at a step of the transition */
+static void trans_show(int32_t progress)
+{
+        lv_coord_t ofs_x, ofs_y, size_x, size_y;
+        lv_color_t *bottom_buf, *top_buf = NULL;
+        lv_point_t bottom = { 0, 0 }, top = { 0, 0 };
+        lv_area_t area;
+        uint8_t alpha = 0xFF;
+        gdi_color_fmt_t color_fmt = GDI_FORMAT_ARGB8888;
+
+#if GDI_FB_COLOR_FORMAT == CF_NATIVE_RGB332
+        color_fmt = GDI_FORMAT_RGB332;
+#elif GDI_FB_COLOR_FORMAT == CF_NATIVE_RGB565
+        color_fmt = GDI_FORMAT_RGB565;
+#elif GDI_FB_COLOR_FORMAT == CF_NATIVE_ARGB8888
+        color_fmt = GDI_FORMAT_ARGB8888;
+#endif
+
+        /* What has been zoomed can't be undone */
+        if (trans.type == LV_PORT_DISP_TRANS_ZOOM) {
+                progress = MAX(progress, trans.zoomed);
+        }
+        if (progress == trans.shown) {
+                return;
+        }
+
+        /* The display size towards the destination and how far the screens moved that way */
+        size_x = TRANS_DIR_X(trans.dir) * LV_PORT_DISP_HOR_RES;
+        size_y = TRANS_DIR_Y(trans.dir) * LV_PORT_DISP_VER_RES;
+        ofs_x = size_x * progress / LV_PORT_DISP_TRANS_PROGRESS_MAX;
+        ofs_y = size_y * progress / LV_PORT_DISP_TRANS_PROGRESS_MAX;
+
+        lv_area_set(&area, 0, 0, LV_PORT_DISP_HOR_RES - 1, LV_PORT_DISP_VER_RES - 1);
+
+        /* The LCDC might still read a frame buffer changed below */
+        trans_update_wait();
+
+        if (progress == LV_PORT_DISP_TRANS_PROGRESS_MAX) {
+                bottom_buf = trans.dst_buf;
+        }
+        else if (progress == 0 && trans.zoomed == 0) {
+                bottom_buf = trans.src_buf;
+        }
+        else {
+                switch (trans.type) {
+                case LV_PORT_DISP_TRANS_SLIDE:
+                        bottom_buf = trans.src_buf;
+                        bottom.x = -ofs_x;
+                        bottom.y = -ofs_y;
+                        top_buf = trans.dst_buf;
+                        top.x = size_x - ofs_x;
+                        top.y = size_y - ofs_y;
+                        break;
+                case LV_PORT_DISP_TRANS_COVER:
+                        bottom_buf = trans.src_buf;
+                        top_buf = trans.dst_buf;
+                        top.x = size_x - ofs_x;
+                        top.y = size_y - ofs_y;
+                        break;
+                case LV_PORT_DISP_TRANS_UNCOVER:
+                        bottom_buf = trans.dst_buf;
+                        top_buf = trans.src_buf;
+                        top.x = -ofs_x;
+                        top.y = -ofs_y;
+                        break;
+#if LV_PORT_DISP_GPU_EN
+                case LV_PORT_DISP_TRANS_ZOOM:
+                {
+                        lv_disp_t *disp = lv_disp_get_default();
+                        lv_coord_t w = MAX(LV_PORT_DISP_HOR_RES * progress / LV_PORT_DISP_TRANS_PROGRESS_MAX, 1);
+                        lv_coord_t h = MAX(LV_PORT_DISP_VER_RES * progress / LV_PORT_DISP_TRANS_PROGRESS_MAX, 1);
+
+                        /* Scale the destination into the source, only the grown window changes */
+                        lv_area_set(&area, (LV_PORT_DISP_HOR_RES - w) / 2, (LV_PORT_DISP_VER_RES - h) / 2,
+                                (LV_PORT_DISP_HOR_RES - w) / 2 + w - 1, (LV_PORT_DISP_VER_RES - h) / 2 + h - 1);
+                        if (lv_port_gpu_blit_scaled(disp->driver, trans.src_buf, LV_PORT_DISP_HOR_RES, &area,
+                                trans.dst_buf, LV_PORT_DISP_HOR_RES, LV_PORT_DISP_VER_RES)) {
+                                lv_port_gpu_wait(disp->driver);
+                                lv_port_gpu_flush();
+                                trans.zoomed = progress;
+                                bottom_buf = trans.src_buf;
+                                break;
+                        }
+
+                        /* The GPU is not used */
+                        trans.type = LV_PORT_DISP_TRANS_FADE;
+                        lv_area_set(&area, 0, 0, LV_PORT_DISP_HOR_RES - 1, LV_PORT_DISP_VER_RES - 1);
+                }
+                /* no break */
+#endif
+                default:
+                        bottom_buf = trans.src_buf;
+                        top_buf = trans.dst_buf;
+                        alpha = progress * 0xFF / LV_PORT_DISP_TRANS_PROGRESS_MAX;
+                        break;
+                }
+        }
+
+        gdi_set_layer_src(HW_LCDC_LAYER_0, bottom_buf, LV_PORT_DISP_HOR_RES, LV_PORT_DISP_VER_RES, color_fmt);
+        gdi_set_layer_start(HW_LCDC_LAYER_0, LAYER_OFFSET_X + bottom.x, LAYER_OFFSET_Y + bottom.y);
+        if (top_buf) {
+                gdi_set_layer_src(HW_LCDC_LAYER_1, top_buf, LV_PORT_DISP_HOR_RES, LV_PORT_DISP_VER_RES, color_fmt);
+                gdi_set_layer_start(HW_LCDC_LAYER_1, LAYER_OFFSET_X + top.x, LAYER_OFFSET_Y + top.y);
+                gdi_set_layer_blending(HW_LCDC_LAYER_1, alpha == 0xFF ? HW_LCDC_BL_SRC : HW_LCDC_BL_SIMPLE, alpha);
+        }
+        gdi_set_layer_enable(HW_LCDC_LAYER_1, top_buf != NULL);
+
+        gdi_set_partial_update_area(LAYER_OFFSET_X + area.x1, LAYER_OFFSET_Y + area.y1,
+                LAYER_OFFSET_X + area.x2, LAYER_OFFSET_Y + area.y2);
+
+        gdi_perf_transfer_last(true);
+        trans.updating = true;
+        LV_PROFILER_BEGIN_ON(prof_update, prof_track);
+        gdi_display_update_async(trans_update_cb, NULL);
+
+        trans.shown = progress;
+}
+
+static void trans_update_cb(bool underflow, void *user_data)
+{
+        LV_PROFILER_END_ON(prof_update, prof_track);
+        trans.updating = false;
+
+        /* Trigger event in case task was blocked */
+        OS_EVENT_SIGNAL(flush_evt);
+}
+
+static void trans_update_wait(void)
+{
+        while (trans.updating) {
+                OS_EVENT_WAIT(flush_evt, OS_EVENT_FOREVER);
+        }
+}
+
+static void trans_scroll_event_cb(lv_event_t *e)
+{
+        lv_port_disp_trans_set_progress(trans_scroll_progress());
+}
+
+/* How far the object has been scrolled towards the destination page */
+static int32_t trans_scroll_progress(void)
+{
+        int32_t progress;
+
+        if (TRANS_DIR_X(trans.dir)) {
+                progress = (lv_obj_get_scroll_x(trans.scroll_obj) - trans.scroll_x) * TRANS_DIR_X(trans.dir)
+                        * LV_PORT_DISP_TRANS_PROGRESS_MAX / LV_PORT_DISP_HOR_RES;
+        }
+        else {
+                progress = (lv_obj_get_scroll_y(trans.scroll_obj) - trans.scroll_y) * TRANS_DIR_Y(trans.dir)
+                        * LV_PORT_DISP_TRANS_PROGRESS_MAX / LV_PORT_DISP_VER_RES;
+        }
+
+        return LV_CLAMP(0, progress, LV_PORT_DISP_TRANS_PROGRESS_MAX);
+}
+
+static void trans_anim_cb(void *var, int32_t progress)
+{
+        lv_port_disp_trans_set_progress(progress);
+}
+
+static void trans_anim_ready_cb(lv_anim_t *a)
+{
+        lv_port_disp_trans_end();
+}
+
+#if LV_PORT_DISP_PACE
+static void pace_refr_timer_cb(lv_timer_t *timer)
+{
+        lv_disp_t *disp = timer->user_data;
+        uint64_t now = pace_time();
+        uint64_t te = gdi_get_te_time();
+        uint64_t slot, start;
+        uint32_t interval = pace.interval;
+
+        /* Only the layouts to update, nothing to time */
+        if (disp->inv_p == 0) {
+                _lv_disp_refr_timer(timer);
+                return;
+        }
+
+        /* LVGL pauses the timer once everything is refreshed and an invalidation resumes it */
+        if (!pace.request) {
+                pace.request = now;
+        }
+
+#if LV_PORT_DISP_PACE_IDLE_FPS
+        if (lv_disp_get_inactive_time(disp) > LV_PORT_DISP_PACE_IDLE_MS) {
+                interval = MAX(interval, PACE_INTERVAL(LV_PORT_DISP_PACE_IDLE_FPS));
+        }
+#endif
+
+        if (te) {
+                /* The first pulse the first flush can make, not sooner than the frame rate cap allows */
+                slot = te + GDI_TE_PERIOD_US;
+                while (slot < now + pace.stat.cost_us || slot < pace.slot + interval * GDI_TE_PERIOD_US) {
+                        slot += GDI_TE_PERIOD_US;
+                }
+        } else {
+                /* No pulse to align on: the first flush as soon as the frame rate cap allows */
+                slot = MAX(now + pace.stat.cost_us, pace.slot + interval * GDI_TE_PERIOD_US);
+        }
+
+        /* Sleep until the refresh has to start, what is invalidated meanwhile is drawn with it. The
+         * margin is only needed for the wake up, a refresh started now can take the predicted time. */
+        start = slot - pace.stat.cost_us - LV_PORT_DISP_PACE_MARGIN_US;
+        if (start < slot && start >= now + 1000) {
+                lv_timer_set_period(timer, (start - now) / 1000);
+                return;
+        }
+
+        /* A frame of an animation if it was requested before the pulse following the previous one */
+        if (pace.slot && pace.request < pace.slot + GDI_TE_PERIOD_US) {
+                pace.periods = MAX(1, (int)((slot - pace.slot) / GDI_TE_PERIOD_US));
+                pace.drops = pace.periods > (int)interval ? pace.periods - interval : 0;
+                pace.stat.hist[MIN(pace.periods, LV_PORT_DISP_PACE_HIST_LEN) - 1]++;
+                pace.stat.drop_cnt += pace.drops;
+        }
+
+        pace.flush = 0;
+        _lv_disp_refr_timer(timer);
+
+        /* The prediction follows a longer refresh at once and shorter ones slowly */
+        if (pace.flush) {
+                uint32_t cost = pace.flush - now;
+
+                if (cost > pace.stat.cost_us) {
+                        pace.stat.cost_us = cost;
+                } else {
+                        pace.stat.cost_us -= (pace.stat.cost_us - cost) / 8;
+                }
+                pace.stat.frame_cnt++;
+                pace.slot = slot;
+        }
+
+        pace.request = 0;
+        pace.periods = pace.drops = 0;
+        lv_timer_set_period(timer, LV_DISP_DEF_REFR_PERIOD);
+}
+
+static uint64_t pace_time(void)
+{
+        return gdi_convert_ticks_to_us(gdi_get_sys_uptime_ticks());
+}
+#endif /* LV_PORT_DISP_PACE */
+
+#if LV_PORT_DISP_RETAINED_BG
+static void retained_bg_event_cb(lv_event_t *e)
+{
+        lv_event_code_t code = lv_event_get_code(e);
+        lv_obj_t *obj = lv_event_get_target(e);
+        lv_area_t coords;
+
+        lv_obj_get_coords(obj, &coords);
+
+        if (code == LV_EVENT_COVER_CHECK) {
+                lv_cover_check_info_t *info = lv_event_get_param(e);
+
+                /* The retained background is opaque, nothing behind the object has to be drawn */
+                if (info->res != LV_COVER_RES_MASKED && _lv_area_is_in(info->area, &coords, 0)) {
+                        info->res = LV_COVER_RES_COVER;
+                }
+        }
+        else if (code == LV_EVENT_DRAW_MAIN) {
+                const lv_area_t *clip_area = lv_event_get_clip_area(e);
+
+#if RETAINED_BG_BLEND
+                if (retained_bg_layer) {
+                        /* Let the LCDC show the background layer through */
+                        lv_disp_t *disp = lv_obj_get_disp(obj);
+                        lv_disp_draw_buf_t *draw_buf = lv_disp_get_draw_buf(disp);
+                        lv_coord_t buf_w = lv_area_get_width(&draw_buf->area);
+                        lv_area_t area;
+
+                        if (!_lv_area_intersect(&area, clip_area, &coords)) {
+                                return;
+                        }
+                        if (disp->driver->gpu_wait_cb) {
+                                disp->driver->gpu_wait_cb(disp->driver);
+                        }
+                        for (lv_coord_t y = area.y1; y <= area.y2; y++) {
+                                lv_memset_00(&draw_buf->buf_act[(y - draw_buf->area.y1) * buf_w
+                                        + area.x1 - draw_buf->area.x1],
+                                        lv_area_get_width(&area) * sizeof(lv_color_t));
+                        }
+                        return;
+                }
+#endif
+                lv_draw_img_dsc_t img_dsc;
+
+                lv_draw_img_dsc_init(&img_dsc);
+                lv_draw_img(&coords, clip_area, &retained_bg_img, &img_dsc);
+        }
+        else if (code == LV_EVENT_DELETE) {
+#if RETAINED_BG_BLEND
+                if (retained_bg_layer) {
+                        retained_bg_set_layer(false);
+                }
+#endif
+                retained_bg_obj = NULL;
+        }
+}
+#endif /* LV_PORT_DISP_RETAINED_BG */
+
+#if RETAINED_BG_BLEND
+static void retained_bg_set_layer(bool enable)
+{
+        gdi_color_fmt_t color_fmt = GDI_FORMAT_ARGB8888;
+
+#if GDI_FB_COLOR_FORMAT == CF_NATIVE_RGB332
+        color_fmt = GDI_FORMAT_RGB332;
+#elif GDI_FB_COLOR_FORMAT == CF_NATIVE_RGB565
+        color_fmt = GDI_FORMAT_RGB565;
+#elif GDI_FB_COLOR_FORMAT == CF_NATIVE_ARGB8888
+        color_fmt = GDI_FORMAT_ARGB8888;
 #endif
+
+        if (enable) {
+                /* The retained background on Layer 0, the rest is flushed to Layer 1 and blended over it */
+                gdi_set_layer_src(HW_LCDC_LAYER_0, RETAINED_BG_BUF, LV_PORT_DISP_HOR_RES, LV_PORT_DISP_VER_RES,
+                        color_fmt);
+                gdi_set_layer_start(HW_LCDC_LAYER_0, LAYER_OFFSET_X, LAYER_OFFSET_Y);
+                gdi_set_layer_blending(HW_LCDC_LAYER_1, HW_LCDC_BL_SIMPLE, 0xFF);
+                gdi_set_layer_enable(HW_LCDC_LAYER_1, true);
+                flush_layer = HW_LCDC_LAYER_1;
+        }
+        else {
+                gdi_set_layer_enable(HW_LCDC_LAYER_1, false);
+                gdi_set_layer_blending(HW_LCDC_LAYER_1, HW_LCDC_BL_SRC, 0xFF);
+                gdi_set_layer_src(HW_LCDC_LAYER_1, 0, DEMO_RESX, DEMO_RESY, color_fmt);
+                flush_layer = HW_LCDC_LAYER_0;
+        }
+
+        retained_bg_layer = enable;
 }
+#endif /* RETAINED_BG_BLEND */
 
 #ifdef PERFORMANCE_METRICS
 static void perf_monitor(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px)
@@ -393,5 +1322,85 @@ static void perf_monitor(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px)
         time -= gdi_convert_ticks_to_us(flush_evt_wait) / 1000;
         flush_evt_wait = 0;
         gdi_perf_render_time(time * 1000);
+
+        /* All the tiles but the last one have been transferred while rendering the next one */
+        gdi_perf_overlap_time(tile_transfer_time > tile_transfer_wait ?
+                gdi_convert_ticks_to_us(tile_transfer_time - tile_transfer_wait) : 0);
+        tile_transfer_time = tile_transfer_wait = 0;
+
+#if LV_PORT_DISP_FLUSH_COST_NS && DLG_LVGL_USE_REFR_STAT
+        /* Flushes and pixels saved compared to joining the overlapping areas by pixel count */
+        lv_disp_refr_stat_t *stat = &_lv_refr_get_disp_refreshing()->refr_stat;
+
+        gdi_perf_refr_saved((int)(stat->flush_cnt_legacy - stat->flush_cnt),
+                (int)(stat->px_cnt_legacy - stat->px_cnt));
+        lv_memset_00(stat, sizeof(*stat));
+#endif
+
+#if DLG_LVGL_USE_IMG_ROT_CACHE
+        lv_img_rot_cache_stat_t rot_cache_stat_new;
+
+        lv_img_rot_cache_get_stat(&rot_cache_stat_new);
+        gdi_perf_cache(METRICS_CACHE_ROT, rot_cache_stat_new.hit_cnt - rot_cache_stat.hit_cnt,
+                rot_cache_stat_new.miss_cnt - rot_cache_stat.miss_cnt, 0);
+        rot_cache_stat = rot_cache_stat_new;
+#endif
+
+#if DLG_LVGL_USE_GLYPH_CACHE
+        lv_glyph_cache_stat_t glyph_cache_stat_new;
+
+        lv_glyph_cache_get_stat(&glyph_cache_stat_new);
+        gdi_perf_cache(METRICS_CACHE_GLYPH, glyph_cache_stat_new.hit_cnt - glyph_cache_stat.hit_cnt,
+                glyph_cache_stat_new.miss_cnt - glyph_cache_stat.miss_cnt,
+                glyph_cache_stat_new.evict_cnt - glyph_cache_stat.evict_cnt);
+        glyph_cache_stat = glyph_cache_stat_new;
+#endif
+
+#if DLG_LVGL_USE_IMG_CACHE
+        lv_img_cache_stat_t img_cache_stat_new;
+
+        lv_img_cache_get_stat(&img_cache_stat_new);
+        gdi_perf_cache(METRICS_CACHE_IMG, img_cache_stat_new.hit_cnt - img_cache_stat.hit_cnt,
+                img_cache_stat_new.miss_cnt - img_cache_stat.miss_cnt,
+                img_cache_stat_new.evict_cnt - img_cache_stat.evict_cnt);
+        img_cache_stat = img_cache_stat_new;
+#endif
+
+#if DLG_LVGL_USE_CORNER_CACHE
+        lv_corner_cache_stat_t corner_cache_stat_new;
+
+        lv_corner_cache_get_stat(&corner_cache_stat_new);
+        gdi_perf_cache(METRICS_CACHE_CORNER, corner_cache_stat_new.hit_cnt - corner_cache_stat.hit_cnt,
+                corner_cache_stat_new.miss_cnt - corner_cache_stat.miss_cnt,
+                corner_cache_stat_new.evict_cnt - corner_cache_stat.evict_cnt);
+        corner_cache_stat = corner_cache_stat_new;
+#endif
+
+#if DLG_LVGL_USE_STYLE_CACHE
+        lv_obj_style_cache_stat_t style_cache_stat_new;
+
+        lv_obj_style_cache_get_stat(&style_cache_stat_new);
+        gdi_perf_cache(METRICS_CACHE_STYLE, style_cache_stat_new.hit_cnt - style_cache_stat.hit_cnt,
+                style_cache_stat_new.miss_cnt - style_cache_stat.miss_cnt, 0);
+        style_cache_stat = style_cache_stat_new;
+#endif
+
+        lv_mem_monitor_t mem_mon;
+
+        lv_mem_monitor(&mem_mon);
+#if DLG_LVGL_USE_MEM_BUF_POOL
+        gdi_perf_gui_heap(mem_mon.buf_heap_cnt - buf_heap_cnt, mem_mon.total_size - mem_mon.free_size,
+                mem_mon.frag_pct, mem_mon.free_biggest_size);
+        buf_heap_cnt = mem_mon.buf_heap_cnt;
+#else
+        gdi_perf_gui_heap(0, mem_mon.total_size - mem_mon.free_size, mem_mon.frag_pct, mem_mon.free_biggest_size);
+#endif
+
+#if LV_PORT_DISP_DIRECT_MODE
+        gdi_perf_fb_sync(fb_sync_bytes);
+#endif
+#if LV_PORT_DISP_PACE
+        gdi_perf_frame_pace(pace.periods, pace.drops);
+#endif
 }
 #endif
@@ -34,18 +34,209 @@
 #define LV_PORT_DISP_VER_RES                    (DEMO_RESY)
 #endif
 
+/* Pipelined refresh: the invalidated areas are rendered in tiles of at most this many pixels,
+ * alternating between the two frame buffers, so that the LCDC transfers a tile while the next
+ * one is rendered. Set to 0 to render each area at once. */
+#ifndef LV_PORT_DISP_TILE_SIZE
+#define LV_PORT_DISP_TILE_SIZE                  (LV_PORT_DISP_HOR_RES * LV_PORT_DISP_VER_RES / 3)
+#endif
+
+/* Direct mode: LVGL draws the invalidated areas in place into the back frame buffer, which is then
+ * shown by pointing the LCDC layer to it and transferring the bounding box of the areas. The areas
+ * of the previous frame which are not drawn again are copied with the DMA from the front frame
+ * buffer, so that both always hold a whole frame. LV_PORT_DISP_TILE_SIZE is not used in this mode. */
+#ifndef LV_PORT_DISP_DIRECT_MODE
+#define LV_PORT_DISP_DIRECT_MODE                (0)
+#endif
+
+/* Screen transitions: the source and the destination screens are rendered once, each whole into
+ * a frame buffer, and moved, blended or scaled by the LCDC layers and the GPU until the transition
+ * ends, without rendering any frame in between. The destination is rendered in bands of
+ * LV_PORT_DISP_TRANS_BAND_ROWS rows, one each time the LVGL timers run, so that the input and the
+ * other timers are not held up. Set LV_PORT_DISP_TRANS_LAYERS to 0 if the panel can't be driven
+ * with two layers: the screens are then loaded by LVGL and scrolled by refreshing every frame. */
+#ifndef LV_PORT_DISP_TRANS_LAYERS
+#define LV_PORT_DISP_TRANS_LAYERS               (1)
+#endif
+
+#ifndef LV_PORT_DISP_TRANS_BAND_ROWS
+#define LV_PORT_DISP_TRANS_BAND_ROWS            (LV_PORT_DISP_VER_RES / 4)
+#endif
+
+/* Progress of a transition at its end, it starts from 0 */
+#define LV_PORT_DISP_TRANS_PROGRESS_MAX         (1024)
+
+/* Frame pacing: a refresh is started so that its first area is flushed just before a TE pulse of the
+ * panel (gdi_get_te_time()), the time it takes being predicted from the previous frames. A frame that
+ * can't make the next pulse is drawn for the following one, together with what is invalidated
+ * meanwhile. The pulses are only timed with the LCDC in continuous mode (or on the simulator); without
+ * them the frames are not aligned and only the frame rate caps apply. Set to 0 to refresh every
+ * LV_DISP_DEF_REFR_PERIOD as soon as something is invalidated. */
+#ifndef LV_PORT_DISP_PACE
+#define LV_PORT_DISP_PACE                       (0)
+#endif
+
+/* Time kept between the predicted first flush and the pulse, for the resolution of the timers */
+#ifndef LV_PORT_DISP_PACE_MARGIN_US
+#define LV_PORT_DISP_PACE_MARGIN_US             (2000)
+#endif
+
+/* Frame rate cap once the display has not been touched for LV_PORT_DISP_PACE_IDLE_MS, to save power
+ * while a screen is only animated. 0: only the cap of lv_port_disp_pace_set_fps() applies. */
+#ifndef LV_PORT_DISP_PACE_IDLE_FPS
+#define LV_PORT_DISP_PACE_IDLE_FPS              (0)
+#endif
+
+#ifndef LV_PORT_DISP_PACE_IDLE_MS
+#define LV_PORT_DISP_PACE_IDLE_MS               (10000)
+#endif
+
+/* Buckets of the frame time histogram, one per TE period, the last one counting the longer frames too */
+#define LV_PORT_DISP_PACE_HIST_LEN              (4)
+
+/* Cost model of a partial update, used by LVGL to decide whether to merge or split the invalidated
+ * areas or to refresh the whole screen. Every flush pays a fixed cost (setting the partial update
+ * window of the panel, starting the LCDC and waiting for its completion) on top of the transfer
+ * of the (aligned) pixels. Set LV_PORT_DISP_FLUSH_COST_NS to 0 to only join overlapping areas
+ * by pixel count. */
+#ifndef LV_PORT_DISP_FLUSH_COST_NS
+#define LV_PORT_DISP_FLUSH_COST_NS              (100000)
+#endif
+
+/* 2 bytes per pixel over QSPI at 24 MB/s */
+#ifndef LV_PORT_DISP_PX_COST_NS
+#define LV_PORT_DISP_PX_COST_NS                 (84)
+#endif
+
+/* Retained background: the children of a screen flagged with LV_PORT_DISP_FLAG_STATIC are rendered
+ * once by lv_port_disp_retain_bg() into a buffer of the size of the display, a static array or the
+ * memory at LV_PORT_DISP_RETAINED_BG_ADR (e.g. in QSPI RAM). If the frame buffers have an alpha
+ * channel, the buffer is shown by the background layer of the LCDC and the other objects are rendered
+ * on a transparent foreground layer. Otherwise the GPU copies the buffer under the other objects.
+ * The buffer takes LV_PORT_DISP_HOR_RES * LV_PORT_DISP_VER_RES * LV_COLOR_SIZE / 8 bytes, 297 KB
+ * at 390x390 RGB565, which do not fit in SysRAM next to the two frame buffers: on target set
+ * LV_PORT_DISP_RETAINED_BG_ADR to a QSPI RAM address to enable it. */
+#ifndef LV_PORT_DISP_RETAINED_BG
+#define LV_PORT_DISP_RETAINED_BG                (0)
+#endif
+
+#ifndef LV_PORT_DISP_RETAINED_BG_ADR
+#define LV_PORT_DISP_RETAINED_BG_ADR            (0)
+#endif
+
+/* Period in ms of the maps of the GUI heap handed to gdi_sim_heap_map(), when the telemetry of the
+ * heap (DLG_LVGL_USE_MEM_TELEMETRY) is built in. 0: no periodic map. Simulator only (SIM_HEAP_MAP),
+ * the target has no channel for the maps. */
+#ifndef LV_PORT_DISP_HEAP_MAP_PERIOD
+#define LV_PORT_DISP_HEAP_MAP_PERIOD            (0)
+#endif
+
+/* Objects drawn in the retained background */
+#define LV_PORT_DISP_FLAG_STATIC                LV_OBJ_FLAG_USER_1
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/* How the destination screen replaces the source one */
+typedef enum {
+        LV_PORT_DISP_TRANS_SLIDE,               /* The destination pushes the source out */
+        LV_PORT_DISP_TRANS_COVER,               /* The destination moves in over the source */
+        LV_PORT_DISP_TRANS_UNCOVER,             /* The source moves out from over the destination */
+        LV_PORT_DISP_TRANS_FADE,                /* The destination fades in over the source */
+        LV_PORT_DISP_TRANS_ZOOM,                /* The destination grows from the center over the source */
+} lv_port_disp_trans_t;
+
+/* Frame pacing counters. They are never cleared, the user can compute the change between two readings. */
+typedef struct {
+        uint32_t frame_cnt;                             /* Frames refreshed */
+        uint32_t drop_cnt;                              /* TE periods missed by the frames of the animations */
+        uint32_t cost_us;                               /* Predicted time from the start of a refresh to its first flush */
+        uint32_t hist[LV_PORT_DISP_PACE_HIST_LEN];      /* Frames of the animations by TE periods since the previous one */
+} lv_port_disp_pace_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 void lv_port_disp_init(void);
-#if TWO_LAYERS_HORIZONTAL_SLIDING
-void lv_port_disp_slide_init(lv_obj_t *obj, lv_dir_t dir);
-void lv_port_disp_slide(int posXLayer0, int posXLayer1);
-void lv_port_disp_slide_end();
+
+/**
+ * Start a transition from the active screen to another one, driven by
+ * lv_port_disp_trans_set_progress() and completed by lv_port_disp_trans_end(). The other screen is
+ * the active one from now on and gets the input, as with lv_scr_load_anim().
+ * @param scr the destination screen
+ * @param type how the destination replaces the active screen
+ * @param dir the side the destination comes from for the slide, cover and uncover transitions,
+ *            e.g. LV_DIR_RIGHT to move the screens to the left
+ * @return false if the transition can't be shown with the LCDC layers, nothing is changed then
+ */
+bool lv_port_disp_trans_start(lv_obj_t *scr, lv_port_disp_trans_t type, lv_dir_t dir);
+
+/**
+ * Start a transition following the scrolling of an object by one page of the size of the display,
+ * e.g. from a tile of a tileview to the next one. The progress follows the scroll position and the
+ * transition has to be ended by lv_port_disp_trans_end() when the scrolling ends. Call it when the
+ * scrolling begins, before the object has been moved.
+ * @param obj the scrolled object
+ * @param type how the destination page replaces the current one, usually LV_PORT_DISP_TRANS_SLIDE
+ * @param dir the side of the destination page
+ * @return false if the transition can't be shown with the LCDC layers, the scrolling is then
+ *         refreshed as usual
+ */
+bool lv_port_disp_trans_scroll(lv_obj_t *obj, lv_port_disp_trans_t type, lv_dir_t dir);
+
+/**
+ * Show a step of the transition. The zoom transition only grows.
+ * @param progress 0 (the source) ... LV_PORT_DISP_TRANS_PROGRESS_MAX (the destination)
+ */
+void lv_port_disp_trans_set_progress(int32_t progress);
+
+/**
+ * End the transition. The destination is kept if the progress reached the end (or the scrolling the
+ * next page), otherwise the source is loaded back. Refreshing resumes and only what was invalidated
+ * meanwhile is drawn again, unless the transition stopped halfway.
+ */
+void lv_port_disp_trans_end(void);
+
+/**
+ * Load a screen with an animated transition, or with lv_scr_load_anim() if the LCDC layers can't be
+ * used. It ends the running transition first.
+ * @param scr the screen to load
+ * @param type how the screen replaces the active one
+ * @param dir see lv_port_disp_trans_start()
+ * @param time duration of the animation in ms, it starts once the screen is rendered
+ * @param auto_del delete the previous screen at the end
+ */
+void lv_port_disp_scr_load(lv_obj_t *scr, lv_port_disp_trans_t type, lv_dir_t dir, uint32_t time,
+        bool auto_del);
+
+#if LV_PORT_DISP_PACE
+/**
+ * Cap the frame rate, e.g. on a screen whose animations don't need to be smooth
+ * @param fps the maximum frames per second, 0 for the rate of the panel
+ */
+void lv_port_disp_pace_set_fps(uint32_t fps);
+
+/**
+ * Get the frame pacing counters
+ * @param stat the counters are copied here
+ */
+void lv_port_disp_pace_get_stat(lv_port_disp_pace_stat_t *stat);
+#endif
+
+#if LV_PORT_DISP_RETAINED_BG
+/**
+ * Render the children of a screen sized object flagged with LV_PORT_DISP_FLAG_STATIC, and what is
+ * behind them, once in the retained background. They are hidden until lv_port_disp_release_bg()
+ * and only the other children are rendered from then on. The object must be at the origin of the
+ * display and no other object may be in front of it. It replaces the previous retained background.
+ */
+void lv_port_disp_retain_bg(lv_obj_t *obj);
+
+/**
+ * Show the static objects again and free the retained background
+ */
+void lv_port_disp_release_bg(void);
 #endif
 
 /**********************
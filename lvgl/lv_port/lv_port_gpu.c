@@ -33,6 +33,22 @@
 #define LV_PORT_DISP_GPU_SUB_BYTE_SWAP          (DLG_LVGL_CF_SUB_BYTE_SWAP)
 #endif
 
+#if LV_PORT_DISP_GPU_SUB_BYTE_SWAP
+/* Bytes kept for the reordered copies of the sub-byte textures. 0: reorder them at every blit */
+#ifndef LV_PORT_DISP_GPU_TEX_CACHE_SIZE
+#define LV_PORT_DISP_GPU_TEX_CACHE_SIZE         (16 * 1024)
+#endif
+#ifndef LV_PORT_DISP_GPU_TEX_CACHE_ENTRIES
+#define LV_PORT_DISP_GPU_TEX_CACHE_ENTRIES      (8)
+#endif
+#endif
+
+/* Horizontal bands per quarter of an arc. The GPU scans the bounding box of a circle, each band
+ * is clipped to the part of the ring it crosses to skip the hole and the corners. */
+#ifndef LV_PORT_DISP_GPU_ARC_BANDS
+#define LV_PORT_DISP_GPU_ARC_BANDS              (4)
+#endif
+
 #if GDI_FB_COLOR_FORMAT != CF_NATIVE_RGB565 && GDI_FB_COLOR_FORMAT != CF_NATIVE_ARGB8888
 #error "Selected format not supported by GPU"
 #endif
@@ -64,6 +80,29 @@ typedef struct {
         int line;
 } log_error_entry;
 
+/* Jobs marked on the GPU track of the profiler */
+typedef enum {
+        GPU_OP_FILL,
+        GPU_OP_SHAPE,
+        GPU_OP_BLIT,
+        GPU_OP_BLIT_BATCH,
+        GPU_OP_BLIT_MASK,
+        GPU_OP_BLIT_SCALED,
+        GPU_OP_BOX,
+        GPU_OP_CONVERT,
+        GPU_OP_NUM
+} gpu_op_t;
+
+#if LV_PORT_DISP_GPU_SUB_BYTE_SWAP && LV_PORT_DISP_GPU_TEX_CACHE_SIZE
+typedef struct {
+        const void *src;                /* NULL: unused entry */
+        lv_coord_t w;                   /* Bytes per row */
+        lv_coord_t h;
+        d2_s32 cf;
+        uint8_t *data;
+} tex_cache_entry;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -73,9 +112,22 @@ static void lv_port_gpu_config_blit_clear(void);
 static void lv_port_gpu_blit_internal(lv_disp_drv_t *disp_drv, const lv_area_t * dst_area, const lv_color_t *src,
         const lv_area_t * src_area, d2_u32 flags);
 static void lv_port_gpu_get_recolor_consts(d2_color *cl, d2_color *ch);
+static d2_u32 lv_port_gpu_set_blit_state(lv_disp_drv_t *disp_drv, lv_opa_t opa);
 static int lv_port_gpu_handle_indexed_color(const lv_color_t **src, const d2_color **clut, d2_s32 cf);
+static void lv_port_gpu_blit_single(lv_disp_drv_t *disp_drv, lv_color_t *dst, const lv_area_t * dst_area,
+        lv_coord_t dst_pitch, const lv_color_t *src, const lv_area_t * src_area, lv_opa_t opa, uint8_t mirror);
+static d2_u32 lv_port_gpu_mirror_flags(uint8_t mirror);
+static void lv_port_gpu_shape_rect(const lv_area_t *clip_area, const lv_gpu_shape_t *shape);
+static void lv_port_gpu_shape_arc(const lv_area_t *clip_area, const lv_gpu_shape_t *shape);
+static void lv_port_gpu_shape_line(const lv_area_t *clip_area, const lv_gpu_shape_t *shape);
+static d2_point lv_port_gpu_arc_end_ofs(lv_coord_t radius, lv_coord_t width, int32_t trigo);
+static bool lv_port_gpu_shape_clip(const lv_area_t *clip_area, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2,
+        lv_coord_t y2, lv_area_t *res);
 #if LV_PORT_DISP_GPU_SUB_BYTE_SWAP
 static const lv_color_t *lv_port_gpu_fix_order(const lv_color_t *src, const lv_area_t * src_area, d2_s32 cf);
+#if LV_PORT_DISP_GPU_TEX_CACHE_SIZE
+static uint8_t *lv_port_gpu_tex_cache_get(const void *src, lv_coord_t w, lv_coord_t h, d2_s32 cf, bool *hit);
+#endif
 #endif
 static int lv_port_gpu_hw_init(void);
 static void lv_port_gpu_hw_deinit(void);
@@ -87,7 +139,7 @@ static d2_s32 lv_port_gpu_cf_lv_to_d2(lv_img_cf_t cf);
 static bool lv_port_gpu_cf_fb_valid(d2_s32 cf);
 static d2_color lv_port_gpu_color_lv_to_d2(lv_color_t color);
 static void lv_port_gpu_start_render(void);
-static void lv_port_gpu_execute_render(void);
+static void lv_port_gpu_execute_render(gpu_op_t op);
 static void lv_port_gpu_complete_render(void);
 #ifdef LOG_ERRORS
 static void lv_port_gpu_log_error(d2_s32 status, const char *func, int line);
@@ -102,6 +154,11 @@ PRIVILEGED_DATA static d2_s32 src_cf_val, dst_cf_val;
 PRIVILEGED_DATA static lv_draw_img_dsc_t img_dsc;
 #if LV_PORT_DISP_GPU_SUB_BYTE_SWAP
 PRIVILEGED_DATA static const lv_color_t *buf;
+#if LV_PORT_DISP_GPU_TEX_CACHE_SIZE
+PRIVILEGED_DATA static tex_cache_entry tex_cache[LV_PORT_DISP_GPU_TEX_CACHE_ENTRIES];
+PRIVILEGED_DATA static uint32_t tex_cache_pool[LV_PORT_DISP_GPU_TEX_CACHE_SIZE / sizeof(uint32_t)];
+PRIVILEGED_DATA static uint32_t tex_cache_used;
+#endif
 #endif
 
 INITIALISED_PRIVILEGED_DATA static bool d2_enabled = SCENARIO != ORIGINAL ? 1 : 0;
@@ -117,6 +174,15 @@ PRIVILEGED_DATA static int error_count;
 #ifdef PERFORMANCE_METRICS
 PRIVILEGED_DATA static uint8_t metrics_tag;
 #endif
+#if DLG_LVGL_USE_PROFILER
+/* The GPU track is busy from the start of a job until the jobs are completed */
+static const char *const prof_op_names[GPU_OP_NUM] = {
+        "gpu_fill", "gpu_shape", "gpu_blit", "gpu_blit_batch", "gpu_blit_mask", "gpu_blit_scaled", "gpu_box",
+        "gpu_convert",
+};
+PRIVILEGED_DATA static uint8_t prof_track, prof_busy, prof_wait, prof_ops[GPU_OP_NUM];
+PRIVILEGED_DATA static bool prof_running;
+#endif
 #if LV_PORT_DISP_GPU_SUB_BYTE_SWAP
 static const d2_color mirror_1BLUT[] =
 {
@@ -230,6 +296,15 @@ static const d2_color mirror_4BLUT[] =
 void lv_port_gpu_init(void)
 {
         lv_port_gpu_config_blit_clear();
+
+#if DLG_LVGL_USE_PROFILER
+        prof_track = lv_profiler_register_track("GPU");
+        prof_busy = lv_profiler_register("gpu");
+        prof_wait = lv_profiler_register("gpu_wait");
+        for (int i = 0; i < GPU_OP_NUM; i++) {
+                prof_ops[i] = lv_profiler_register(prof_op_names[i]);
+        }
+#endif
 }
 
 void lv_port_gpu_fill(lv_disp_drv_t *disp_drv, lv_color_t *dst, lv_coord_t dst_width,
@@ -249,7 +324,264 @@ void lv_port_gpu_fill(lv_disp_drv_t *disp_drv, lv_color_t *dst, lv_coord_t dst_w
 #ifdef PERFORMANCE_METRICS
         metrics_tag = GPU_METRICS_FILL;
 #endif
-        lv_port_gpu_execute_render();
+        lv_port_gpu_execute_render(GPU_OP_FILL);
+}
+
+bool lv_port_gpu_draw_shape(lv_disp_drv_t *disp_drv, lv_color_t *dst, lv_coord_t dst_width,
+        const lv_area_t *clip_area, const lv_gpu_shape_t *shape, lv_color_t color, lv_opa_t opa)
+{
+        (void)disp_drv;
+
+        if (!d2_enabled) {
+                return false;
+        }
+
+        /* The pieces of a shape must not overlap, except when they are opaque */
+        switch (shape->type) {
+        case LV_GPU_SHAPE_RECT:
+                /* The inner corners of thick borders are not concentric with the outer ones */
+                if (shape->width && shape->radius < shape->width) {
+                        return false;
+                }
+                break;
+        case LV_GPU_SHAPE_ARC:
+                /* The round ends are drawn over the arc */
+                if ((shape->round_start || shape->round_end) && opa < LV_OPA_MAX) {
+                        return false;
+                }
+                break;
+        case LV_GPU_SHAPE_LINE:
+                break;
+        default:
+                return false;
+        }
+
+        lv_port_gpu_start_render();
+
+        D2_EXEC(d2_framebuffer(d2_handle, d1_maptovidmem(d1_handle, dst), MAX(dst_width, 2), MAX(dst_width, 2),
+                MAX(clip_area->y2 + 1, 2), lv_port_gpu_cf_get_default()));
+
+        D2_EXEC(d2_setfillmode(d2_handle, d2_fm_color));
+        D2_EXEC(d2_setblendmode(d2_handle, d2_bm_alpha, d2_bm_one_minus_alpha));
+        D2_EXEC(d2_setalphablendmode(d2_handle, d2_bm_one, d2_bm_one_minus_alpha));
+        D2_EXEC(d2_setantialiasing(d2_handle, 1));
+        D2_EXEC(d2_setalpha(d2_handle, opa > LV_OPA_MAX ? 0xFF : opa));
+        D2_EXEC(d2_setcolor(d2_handle, 0, lv_port_gpu_color_lv_to_d2(color)));
+
+        switch (shape->type) {
+        case LV_GPU_SHAPE_RECT:
+                lv_port_gpu_shape_rect(clip_area, shape);
+                break;
+        case LV_GPU_SHAPE_ARC:
+                lv_port_gpu_shape_arc(clip_area, shape);
+                break;
+        default:
+                lv_port_gpu_shape_line(clip_area, shape);
+                break;
+        }
+
+#ifdef PERFORMANCE_METRICS
+        metrics_tag = GPU_METRICS_SHAPE;
+#endif
+        lv_port_gpu_execute_render(GPU_OP_SHAPE);
+
+        return true;
+}
+
+/*
+ * Rounded rectangle: the straight parts are boxes and each corner is a circle (a ring for a border)
+ * clipped to its square, so that no pixel is drawn twice
+ */
+static void lv_port_gpu_shape_rect(const lv_area_t *clip_area, const lv_gpu_shape_t *shape)
+{
+        const lv_area_t *a = &shape->area;
+        lv_coord_t w = lv_area_get_width(a);
+        lv_coord_t h = lv_area_get_height(a);
+        lv_coord_t r = MIN(shape->radius, MIN(w, h) / 2);
+        lv_coord_t bw = shape->width;
+        lv_area_t boxes[4], clip;
+        int box_cnt, i;
+
+        if (bw && bw * 2 >= MIN(w, h)) {
+                bw = 0;
+        }
+
+        if (bw == 0) {
+                lv_area_set(&boxes[0], a->x1 + r, a->y1, a->x2 - r, a->y1 + r - 1);
+                lv_area_set(&boxes[1], a->x1, a->y1 + r, a->x2, a->y2 - r);
+                lv_area_set(&boxes[2], a->x1 + r, a->y2 - r + 1, a->x2 - r, a->y2);
+                box_cnt = 3;
+        } else {
+                lv_area_set(&boxes[0], a->x1 + r, a->y1, a->x2 - r, a->y1 + bw - 1);
+                lv_area_set(&boxes[1], a->x1 + r, a->y2 - bw + 1, a->x2 - r, a->y2);
+                lv_area_set(&boxes[2], a->x1, a->y1 + r, a->x1 + bw - 1, a->y2 - r);
+                lv_area_set(&boxes[3], a->x2 - bw + 1, a->y1 + r, a->x2, a->y2 - r);
+                box_cnt = 4;
+        }
+
+        for (i = 0; i < box_cnt; i++) {
+                if (lv_port_gpu_shape_clip(clip_area, boxes[i].x1, boxes[i].y1, boxes[i].x2, boxes[i].y2, &clip)) {
+                        D2_EXEC(d2_cliprect(d2_handle, clip.x1, clip.y1, clip.x2, clip.y2));
+                        D2_EXEC(d2_renderbox(d2_handle, D2_FIX4(clip.x1), D2_FIX4(clip.y1),
+                                D2_FIX4(lv_area_get_width(&clip)), D2_FIX4(lv_area_get_height(&clip))));
+                }
+        }
+
+        if (r == 0) {
+                return;
+        }
+
+        /* Top left, top right, bottom left, bottom right */
+        for (i = 0; i < 4; i++) {
+                lv_coord_t x1 = (i & 1) ? a->x2 - r + 1 : a->x1;
+                lv_coord_t y1 = (i & 2) ? a->y2 - r + 1 : a->y1;
+                d2_point cx = D2_FIX4((i & 1) ? a->x2 + 1 - r : a->x1 + r);
+                d2_point cy = D2_FIX4((i & 2) ? a->y2 + 1 - r : a->y1 + r);
+
+                if (!lv_port_gpu_shape_clip(clip_area, x1, y1, x1 + r - 1, y1 + r - 1, &clip)) {
+                        continue;
+                }
+                D2_EXEC(d2_cliprect(d2_handle, clip.x1, clip.y1, clip.x2, clip.y2));
+                if (bw == 0) {
+                        D2_EXEC(d2_rendercircle(d2_handle, cx, cy, D2_FIX4(r), 0));
+                } else {
+                        /* The ring spans the radius +/- its width */
+                        D2_EXEC(d2_rendercircle(d2_handle, cx, cy, D2_FIX4(r) - D2_FIX4(bw) / 2, D2_FIX4(bw) / 2));
+                }
+        }
+}
+
+/*
+ * Arc: a ring or a wedge of the ring, the round ends are circles drawn over it. The ring is drawn
+ * band by band in the quarters the arc crosses.
+ */
+static void lv_port_gpu_shape_arc(const lv_area_t *clip_area, const lv_gpu_shape_t *shape)
+{
+        lv_coord_t x = shape->center.x, y = shape->center.y, rout = shape->radius;
+        d2_point cx = D2_FIX4(x);
+        d2_point cy = D2_FIX4(y);
+        lv_coord_t aw = MIN(shape->width, shape->radius);
+        lv_coord_t rin = rout - aw;
+        d2_width r = D2_FIX4(rout) - D2_FIX4(aw) / 2;
+        uint16_t span = shape->end_angle - shape->start_angle;
+        lv_coord_t band_h = MAX(CEILING_FUNC(rout, LV_PORT_DISP_GPU_ARC_BANDS), 1);
+        lv_area_t clip;
+        int q;
+
+        /* The wedge keeps the clockwise side of the start edge and the counter-clockwise side of the
+         * end edge, the normals are 16.16 fixed point */
+        int32_t sin_start = lv_trigo_sin(shape->start_angle);
+        int32_t cos_start = lv_trigo_sin(shape->start_angle + 90);
+        int32_t sin_end = lv_trigo_sin(shape->end_angle);
+        int32_t cos_end = lv_trigo_sin(shape->end_angle + 90);
+
+        /* Quarters clockwise from the right: bottom right, bottom left, top left, top right */
+        for (q = 0; q < 4; q++) {
+                uint16_t q_start = q * 90;
+                lv_coord_t a;
+
+                if (span < 360 && !(shape->start_angle < q_start + 90 && shape->end_angle > q_start) &&
+                                !(shape->start_angle < q_start + 450 && shape->end_angle > q_start + 360)) {
+                        continue;
+                }
+
+                /* Distance of the band from the center, with a pixel more for the anti-aliasing */
+                for (a = 0; a < rout; a += band_h) {
+                        lv_coord_t b = MIN(a + band_h, rout);
+                        lv_coord_t x_max = MIN((lv_coord_t)ceilf(sqrtf((float)(rout * rout - a * a))) + 1, rout);
+                        lv_coord_t x_min = b < rin ? MAX((lv_coord_t)sqrtf((float)(rin * rin - b * b)) - 1, 0) : 0;
+                        lv_coord_t x1 = q == 0 || q == 3 ? x + x_min : x - x_max;
+                        lv_coord_t x2 = q == 0 || q == 3 ? x + x_max - 1 : x - x_min - 1;
+                        lv_coord_t y1 = q < 2 ? y + a : y - b;
+                        lv_coord_t y2 = q < 2 ? y + b - 1 : y - a - 1;
+
+                        if (!lv_port_gpu_shape_clip(clip_area, x1, y1, x2, y2, &clip)) {
+                                continue;
+                        }
+                        D2_EXEC(d2_cliprect(d2_handle, clip.x1, clip.y1, clip.x2, clip.y2));
+                        if (span >= 360) {
+                                D2_EXEC(d2_rendercircle(d2_handle, cx, cy, r, D2_FIX4(aw) / 2));
+                        } else {
+                                D2_EXEC(d2_renderwedge(d2_handle, cx, cy, r, D2_FIX4(aw) / 2,
+                                        -(sin_start << 1), cos_start << 1, sin_end << 1, -(cos_end << 1),
+                                        span > 180 ? d2_wf_concave : 0));
+                        }
+                }
+        }
+
+        if (!shape->round_start && !shape->round_end) {
+                return;
+        }
+        D2_EXEC(d2_cliprect(d2_handle, clip_area->x1, clip_area->y1, clip_area->x2, clip_area->y2));
+        if (shape->round_start) {
+                D2_EXEC(d2_rendercircle(d2_handle, cx + lv_port_gpu_arc_end_ofs(shape->radius, aw, cos_start),
+                        cy + lv_port_gpu_arc_end_ofs(shape->radius, aw, sin_start), D2_FIX4(aw) / 2, 0));
+        }
+        if (shape->round_end) {
+                D2_EXEC(d2_rendercircle(d2_handle, cx + lv_port_gpu_arc_end_ofs(shape->radius, aw, cos_end),
+                        cy + lv_port_gpu_arc_end_ofs(shape->radius, aw, sin_end), D2_FIX4(aw) / 2, 0));
+        }
+}
+
+/*
+ * Offset of a round end of an arc from the center. As LVGL, the ends are snapped to the pixels
+ * (between two pixels for odd widths), so that they look the same as the ones drawn with masks.
+ */
+static d2_point lv_port_gpu_arc_end_ofs(lv_coord_t radius, lv_coord_t width, int32_t trigo)
+{
+        /* 1/256 pixels, rounded to the nearest pixel as LVGL does */
+        int32_t ofs = ((radius - width / 2) * trigo) >> (LV_TRIGO_SHIFT - 8);
+        int32_t px = ofs > 0 ? (ofs - 127) >> 8 : (ofs + 127) >> 8;
+
+        if (width & 1) {
+                return D2_FIX4(px) + D2_FIX4(1) / 2;
+        }
+
+        return D2_FIX4(ofs > 0 ? px + 1 : px);
+}
+
+/*
+ * Line: a quad with ends normal to the line and circles for the round ends, drawn over it as LVGL
+ * does. LVGL sets the thickness of skew lines along the minor axis, from a table of 1 / cos(angle)
+ * indexed by 1/32 steps of the slope and rounded to whole pixels, the same is done here so that
+ * both renderers draw the lines equally thick.
+ */
+static void lv_port_gpu_shape_line(const lv_area_t *clip_area, const lv_gpu_shape_t *shape)
+{
+        d2_point x1 = D2_FIX4(shape->p1.x), y1 = D2_FIX4(shape->p1.y);
+        d2_point x2 = D2_FIX4(shape->p2.x), y2 = D2_FIX4(shape->p2.y);
+        int32_t dx = shape->p2.x - shape->p1.x, dy = shape->p2.y - shape->p1.y;
+        int32_t major = MAX(LV_ABS(dx), LV_ABS(dy)), minor = MIN(LV_ABS(dx), LV_ABS(dy));
+        float slope = (float)((minor << 5) / major) / 32.0f;
+        int32_t corr = (int32_t)(128.0f * sqrtf(1.0f + slope * slope) + 0.5f);
+        int32_t thick = (shape->width * corr + 63) >> 7;
+        d2_width width = (d2_width)(D2_FIX4(thick) * major / sqrtf((float)(dx * dx + dy * dy)) + 0.5f);
+        d2_point ofs = (thick & 1) ? D2_FIX4(1) / 2 : 0;
+        d2_point cap_ofs = (shape->width & 1) ? D2_FIX4(1) / 2 : 0;
+
+        D2_EXEC(d2_cliprect(d2_handle, clip_area->x1, clip_area->y1, clip_area->x2, clip_area->y2));
+        if (LV_ABS(dx) > LV_ABS(dy)) {
+                D2_EXEC(d2_renderline(d2_handle, x1, y1 + ofs, x2, y2 + ofs, width, 0));
+        } else {
+                D2_EXEC(d2_renderline(d2_handle, x1 + ofs, y1, x2 + ofs, y2, width, 0));
+        }
+
+        if (shape->round_start) {
+                D2_EXEC(d2_rendercircle(d2_handle, x1 + cap_ofs, y1 + cap_ofs, D2_FIX4(shape->width) / 2, 0));
+        }
+        if (shape->round_end) {
+                D2_EXEC(d2_rendercircle(d2_handle, x2 + cap_ofs, y2 + cap_ofs, D2_FIX4(shape->width) / 2, 0));
+        }
+}
+
+static bool lv_port_gpu_shape_clip(const lv_area_t *clip_area, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2,
+        lv_coord_t y2, lv_area_t *res)
+{
+        lv_area_t a;
+
+        lv_area_set(&a, x1, y1, x2, y2);
+
+        return _lv_area_intersect(res, &a, clip_area);
 }
 
 static void lv_port_gpu_rotate_point(int *x, int *y, float cos_angle, float sin_angle, int pivot_x, int pivot_y)
@@ -425,32 +757,15 @@ static void lv_port_gpu_blit_internal(lv_disp_drv_t *disp_drv, const lv_area_t *
         }
 }
 
-void lv_port_gpu_blit(lv_disp_drv_t *disp_drv, lv_color_t *dst, const lv_area_t * dst_area, lv_coord_t dst_pitch,
-        const lv_color_t *src, const lv_area_t * src_area, lv_opa_t opa)
+/* Set the opacity, color key, colorization and blend mode configured by lv_port_gpu_config_blit() */
+static d2_u32 lv_port_gpu_set_blit_state(lv_disp_drv_t *disp_drv, lv_opa_t opa)
 {
         d2_u32 flags = 0;
-        const d2_color *clut = NULL;
-        int clut_len = 0;
-
-        clut_len = lv_port_gpu_handle_indexed_color(&src, &clut, src_cf_val);
-
-#if LV_PORT_DISP_GPU_SUB_BYTE_SWAP
-        src = lv_port_gpu_fix_order(src, src_area, src_cf_val);
-#endif
-
-        lv_port_gpu_start_render();
-
-        D2_EXEC(d2_framebuffer(d2_handle, d1_maptovidmem(d1_handle, dst), MAX(dst_pitch, 2),
-                MAX(dst_area->x2 + 1, 2), MAX(dst_area->y2 + 1, 2), dst_cf_val));
 
         flags |= alpha_enabled ? d2_bf_usealpha : 0;
 
         D2_EXEC(d2_setalpha(d2_handle, opa > LV_OPA_MAX ? LV_OPA_COVER : opa));
 
-        if (clut) {
-                D2_EXEC(d2_writetexclut_direct(d2_handle, clut, 0, clut_len));
-        }
-
         flags |= color_key_enabled ? d2_bf_usealpha : 0;
         D2_EXEC(d2_setcolorkey(d2_handle, color_key_enabled, lv_port_gpu_color_lv_to_d2(disp_drv->color_chroma_key)));
 
@@ -476,9 +791,98 @@ void lv_port_gpu_blit(lv_disp_drv_t *disp_drv, lv_color_t *dst, const lv_area_t
                 D2_EXEC(d2_setalphablendmode(d2_handle, d2_bm_one, d2_bm_zero));
         }
 
-        lv_port_gpu_blit_internal(disp_drv, dst_area, src, src_area, flags);
+        return flags;
+}
+
+void lv_port_gpu_blit(lv_disp_drv_t *disp_drv, lv_color_t *dst, const lv_area_t * dst_area, lv_coord_t dst_pitch,
+        const lv_color_t *src, const lv_area_t * src_area, lv_opa_t opa)
+{
+        lv_port_gpu_blit_single(disp_drv, dst, dst_area, dst_pitch, src, src_area, opa, 0);
+}
+
+static void lv_port_gpu_blit_single(lv_disp_drv_t *disp_drv, lv_color_t *dst, const lv_area_t * dst_area,
+        lv_coord_t dst_pitch, const lv_color_t *src, const lv_area_t * src_area, lv_opa_t opa, uint8_t mirror)
+{
+        d2_u32 flags = 0;
+        const d2_color *clut = NULL;
+        int clut_len = 0;
+
+        clut_len = lv_port_gpu_handle_indexed_color(&src, &clut, src_cf_val);
+
+#if LV_PORT_DISP_GPU_SUB_BYTE_SWAP
+        src = lv_port_gpu_fix_order(src, src_area, src_cf_val);
+#endif
+
+        lv_port_gpu_start_render();
+
+        D2_EXEC(d2_framebuffer(d2_handle, d1_maptovidmem(d1_handle, dst), MAX(dst_pitch, 2),
+                MAX(dst_area->x2 + 1, 2), MAX(dst_area->y2 + 1, 2), dst_cf_val));
+
+        if (clut) {
+                D2_EXEC(d2_writetexclut_direct(d2_handle, clut, 0, clut_len));
+        }
+
+        flags = lv_port_gpu_set_blit_state(disp_drv, opa);
+
+        lv_port_gpu_blit_internal(disp_drv, dst_area, src, src_area, flags | lv_port_gpu_mirror_flags(mirror));
+
+        lv_port_gpu_execute_render(GPU_OP_BLIT);
+}
+
+/* The D/AVE2D flags of the LV_GPU_BLIT_MIRROR_... flags, only applied to untransformed images */
+static d2_u32 lv_port_gpu_mirror_flags(uint8_t mirror)
+{
+        return ((mirror & LV_GPU_BLIT_MIRROR_HOR) ? d2_bf_mirroru : 0) |
+                ((mirror & LV_GPU_BLIT_MIRROR_VER) ? d2_bf_mirrorv : 0);
+}
+
+void lv_port_gpu_blit_batch(lv_disp_drv_t *disp_drv, lv_color_t *dst, lv_coord_t dst_pitch,
+        const lv_gpu_blit_t *blits, uint32_t blit_cnt, lv_opa_t opa)
+{
+        d2_u32 flags;
+        lv_coord_t dst_y2 = 0;
+        uint32_t i;
+
+        /* The CLUT is written to the GPU directly, not through the render buffer, so each palette
+         * needs its own job */
+        bool single = (src_cf_val & d2_mode_clut) != 0;
+
+#if LV_PORT_DISP_GPU_SUB_BYTE_SWAP
+        /* The temporary reordered copy of a sub-byte image is held until the job completes */
+        single = single || (0 < lv_port_gpu_cf_bpp(src_cf_val) && lv_port_gpu_cf_bpp(src_cf_val) < 8);
+#endif
+        if (single) {
+                for (i = 0; i < blit_cnt; i++) {
+                        if (i) {
+                                lv_port_gpu_wait(disp_drv);
+                        }
+                        lv_port_gpu_blit_single(disp_drv, dst, &blits[i].dest_area, dst_pitch, blits[i].src_buf,
+                                &blits[i].src_area, opa, blits[i].mirror);
+                }
+                return;
+        }
+
+        for (i = 0; i < blit_cnt; i++) {
+                dst_y2 = MAX(dst_y2, blits[i].dest_area.y2);
+        }
+
+        lv_port_gpu_start_render();
+
+        /* The frame buffer and the blend state are shared by all the images of the job */
+        D2_EXEC(d2_framebuffer(d2_handle, d1_maptovidmem(d1_handle, dst), MAX(dst_pitch, 2),
+                MAX(dst_pitch, 2), MAX(dst_y2 + 1, 2), dst_cf_val));
+
+        flags = lv_port_gpu_set_blit_state(disp_drv, opa);
 
-        lv_port_gpu_execute_render();
+        for (i = 0; i < blit_cnt; i++) {
+                lv_port_gpu_blit_internal(disp_drv, &blits[i].dest_area, blits[i].src_buf, &blits[i].src_area,
+                        flags | lv_port_gpu_mirror_flags(blits[i].mirror));
+        }
+
+#ifdef PERFORMANCE_METRICS
+        metrics_tag = GPU_METRICS_BLITBATCH;
+#endif
+        lv_port_gpu_execute_render(GPU_OP_BLIT_BATCH);
 }
 
 void lv_port_gpu_blit_with_mask(lv_disp_drv_t *disp_drv, lv_color_t *dst, const lv_area_t * dst_area, lv_coord_t dst_pitch,
@@ -561,7 +965,7 @@ void lv_port_gpu_blit_with_mask(lv_disp_drv_t *disp_drv, lv_color_t *dst, const
 
         lv_port_gpu_blit_internal(disp_drv, &buf_area, (const lv_color_t *)msk, &buf_area, flags);
 
-        lv_port_gpu_execute_render();
+        lv_port_gpu_execute_render(GPU_OP_BLIT_MASK);
         lv_port_gpu_complete_render();
         lv_port_gpu_start_render();
 
@@ -589,7 +993,7 @@ void lv_port_gpu_blit_with_mask(lv_disp_drv_t *disp_drv, lv_color_t *dst, const
         img_dsc.angle = angle;
         img_dsc.zoom = zoom;
 
-        lv_port_gpu_execute_render();
+        lv_port_gpu_execute_render(GPU_OP_BLIT_MASK);
 }
 
 bool lv_port_gpu_config_blit(lv_disp_drv_t *disp_drv, const lv_draw_img_dsc_t *draw_dsc,  lv_img_cf_t dst_cf,
@@ -662,7 +1066,40 @@ void lv_port_gpu_render_box(lv_disp_drv_t *disp_drv,  lv_color_t *dst, lv_coord_
         D2_EXEC(d2_renderline(d2_handle, x + w, y,     x + w, y + h, D2_FIX4(1), 0));
         D2_EXEC(d2_renderline(d2_handle, x,     y + h, x + w, y + h, D2_FIX4(1), 0));
 
-        lv_port_gpu_execute_render();
+        lv_port_gpu_execute_render(GPU_OP_BOX);
+}
+
+bool lv_port_gpu_blit_scaled(lv_disp_drv_t *disp_drv, lv_color_t *dst, lv_coord_t dst_pitch,
+        const lv_area_t *dst_area, const lv_color_t *src, lv_coord_t src_w, lv_coord_t src_h)
+{
+        if (!d2_enabled) {
+                return false;
+        }
+
+        lv_port_gpu_start_render();
+
+        D2_EXEC(d2_framebuffer(d2_handle, d1_maptovidmem(d1_handle, dst), MAX(dst_pitch, 2), MAX(dst_pitch, 2),
+                MAX(dst_area->y2 + 1, 2), lv_port_gpu_cf_get_default()));
+        D2_EXEC(d2_cliprect(d2_handle, dst_area->x1, dst_area->y1, dst_area->x2, dst_area->y2));
+
+        /* Plain copy, whatever the previous blits left configured */
+        D2_EXEC(d2_setalpha(d2_handle, 0xFF));
+        D2_EXEC(d2_setcolorkey(d2_handle, 0, 0));
+        D2_EXEC(d2_setblendmode(d2_handle, d2_bm_one, d2_bm_zero));
+        D2_EXEC(d2_setalphablendmode(d2_handle, d2_bm_one, d2_bm_zero));
+
+        D2_EXEC(d2_setblitsrc(d2_handle, d1_maptovidmem(d1_handle, (void *)src), src_w, src_w, src_h,
+                lv_port_gpu_cf_get_default()));
+        D2_EXEC(d2_blitcopy(d2_handle, src_w, src_h, 0, 0,
+                D2_FIX4(lv_area_get_width(dst_area)), D2_FIX4(lv_area_get_height(dst_area)),
+                D2_FIX4(dst_area->x1), D2_FIX4(dst_area->y1), d2_bf_filter));
+
+#ifdef PERFORMANCE_METRICS
+        metrics_tag = GPU_METRICS_BLITBITMAP;
+#endif
+        lv_port_gpu_execute_render(GPU_OP_BLIT_SCALED);
+
+        return true;
 }
 
 #if LV_PORT_DISP_GPU_SUB_BYTE_SWAP
@@ -671,6 +1108,7 @@ static const lv_color_t *lv_port_gpu_fix_order(const lv_color_t *src, const lv_a
         lv_coord_t w, h;
         const d2_color *clut;
         uint8_t bpp;
+        uint8_t *dst = NULL;
 
         switch (cf & ~d2_mode_clut) {
         case d2_mode_alpha1:
@@ -698,15 +1136,27 @@ static const lv_color_t *lv_port_gpu_fix_order(const lv_color_t *src, const lv_a
 
         w = CEILING_FUNC((lv_area_get_width(src_area) * bpp), 8);
         h = lv_area_get_height(src_area);
-        buf = lv_mem_buf_get(w * h);
 
-        if (buf == NULL) {
-                return src;
+#if LV_PORT_DISP_GPU_TEX_CACHE_SIZE
+        bool hit;
+
+        dst = lv_port_gpu_tex_cache_get(src, w, h, cf, &hit);
+        if (hit) {
+                return (const lv_color_t *)dst;
+        }
+#endif
+        /* Not cached: reorder into a temporary buffer, released by lv_port_gpu_wait() */
+        if (dst == NULL) {
+                buf = lv_mem_buf_get(w * h);
+                if (buf == NULL) {
+                        return src;
+                }
+                dst = (uint8_t *)buf;
         }
 
         lv_port_gpu_start_render();
 
-        D2_EXEC(d2_framebuffer(d2_handle, d1_maptovidmem(d1_handle, (void *)buf), MAX(w, 2), MAX(w, 2), MAX(h, 2), d2_mode_alpha8));
+        D2_EXEC(d2_framebuffer(d2_handle, d1_maptovidmem(d1_handle, dst), MAX(w, 2), MAX(w, 2), MAX(h, 2), d2_mode_alpha8));
         D2_EXEC(d2_cliprect(d2_handle, 0, 0, w - 1, h - 1));
 
         D2_EXEC(d2_settexclut(d2_handle, (d2_color *)clut));
@@ -716,13 +1166,78 @@ static const lv_color_t *lv_port_gpu_fix_order(const lv_color_t *src, const lv_a
         D2_EXEC(d2_setblitsrc(d2_handle, d1_maptovidmem(d1_handle, (void *)src), w, w, h, d2_mode_i8 | d2_mode_clut));
         D2_EXEC(d2_blitcopy(d2_handle, w, h, 0, 0, D2_FIX4(w), D2_FIX4(h), D2_FIX4(0), D2_FIX4(0), d2_bf_usealpha));
 
-        lv_port_gpu_execute_render();
+        lv_port_gpu_execute_render(GPU_OP_CONVERT);
         lv_port_gpu_complete_render();
 
-        return buf;
+        return (const lv_color_t *)dst;
 }
+
+#if LV_PORT_DISP_GPU_TEX_CACHE_SIZE
+/*
+ * Find the reordered copy of a texture, or take room for it (hit false). The copies are taken one
+ * after the other from the pool, which is emptied as a whole when full: the sub-byte images of a
+ * screen are few and small. fix_order() is called before the blit job is started and the callers
+ * wait for the previous job first, so no pending job reads the pool when it is emptied.
+ */
+static uint8_t *lv_port_gpu_tex_cache_get(const void *src, lv_coord_t w, lv_coord_t h, d2_s32 cf, bool *hit)
+{
+        uint32_t size = ((uint32_t)w * h + 3) & ~3;
+        tex_cache_entry *entry = NULL;
+        int i;
+
+        for (i = 0; i < LV_PORT_DISP_GPU_TEX_CACHE_ENTRIES; i++) {
+                if (tex_cache[i].src == src && tex_cache[i].w == w && tex_cache[i].h == h && tex_cache[i].cf == cf) {
+                        *hit = true;
+                        return tex_cache[i].data;
+                }
+                if (tex_cache[i].src == NULL && entry == NULL) {
+                        entry = &tex_cache[i];
+                }
+        }
+
+        *hit = false;
+        if (size > sizeof(tex_cache_pool) / 2) {
+                return NULL;
+        }
+
+        if (entry == NULL || tex_cache_used + size > sizeof(tex_cache_pool)) {
+                lv_port_gpu_invalidate_src(NULL, NULL, 0);
+                entry = &tex_cache[0];
+        }
+
+        entry->src = src;
+        entry->w = w;
+        entry->h = h;
+        entry->cf = cf;
+        entry->data = (uint8_t *)tex_cache_pool + tex_cache_used;
+        tex_cache_used += size;
+
+        return entry->data;
+}
+#endif /* LV_PORT_DISP_GPU_TEX_CACHE_SIZE */
 #endif /* LV_PORT_DISP_GPU_SUB_BYTE_SWAP */
 
+void lv_port_gpu_invalidate_src(lv_disp_drv_t *disp_drv, const void *data, uint32_t size)
+{
+#if LV_PORT_DISP_GPU_SUB_BYTE_SWAP && LV_PORT_DISP_GPU_TEX_CACHE_SIZE
+        int i;
+
+        if (data == NULL) {
+                memset(tex_cache, 0, sizeof(tex_cache));
+                tex_cache_used = 0;
+                return;
+        }
+
+        /* The pixels follow the palette of indexed images. The room is given back with the pool. */
+        for (i = 0; i < LV_PORT_DISP_GPU_TEX_CACHE_ENTRIES; i++) {
+                if ((const uint8_t *)tex_cache[i].src >= (const uint8_t *)data &&
+                                (const uint8_t *)tex_cache[i].src < (const uint8_t *)data + size) {
+                        tex_cache[i].src = NULL;
+                }
+        }
+#endif
+}
+
 void lv_port_gpu_wait(lv_disp_drv_t * disp_drv)
 {
         lv_port_gpu_complete_render();
@@ -968,9 +1483,16 @@ static void lv_port_gpu_start_render(void)
         }
 }
 
-static void lv_port_gpu_execute_render(void)
+static void lv_port_gpu_execute_render(gpu_op_t op)
 {
         if (d2_handle) {
+#if DLG_LVGL_USE_PROFILER
+                if (!prof_running) {
+                        LV_PROFILER_BEGIN_ON(prof_busy, prof_track);
+                        prof_running = true;
+                }
+                LV_PROFILER_MARK_ON(prof_ops[op], prof_track);
+#endif
                 D2_EXEC(d2_executerenderbuffer(d2_handle, renderbuffer, 0));
         }
 }
@@ -978,7 +1500,17 @@ static void lv_port_gpu_execute_render(void)
 static void lv_port_gpu_complete_render(void)
 {
         if (d2_handle) {
+#if DLG_LVGL_USE_PROFILER
+                LV_PROFILER_BEGIN(prof_wait);
                 D2_EXEC(d2_flushframe(d2_handle));
+                LV_PROFILER_END(prof_wait);
+                if (prof_running) {
+                        LV_PROFILER_END_ON(prof_busy, prof_track);
+                        prof_running = false;
+                }
+#else
+                D2_EXEC(d2_flushframe(d2_handle));
+#endif
         }
 
 #ifdef PERFORMANCE_METRICS
@@ -52,9 +52,15 @@ void lv_port_gpu_wait(lv_disp_drv_t * disp_drv);
 void lv_port_gpu_fill(lv_disp_drv_t *disp_drv, lv_color_t *dst, lv_coord_t dst_width,
         const lv_area_t *fill_area, lv_color_t color, lv_opa_t opa);
 
+bool lv_port_gpu_draw_shape(lv_disp_drv_t *disp_drv, lv_color_t *dst, lv_coord_t dst_width,
+        const lv_area_t *clip_area, const lv_gpu_shape_t *shape, lv_color_t color, lv_opa_t opa);
+
 void lv_port_gpu_blit(lv_disp_drv_t *disp_drv, lv_color_t *dst, const lv_area_t * dst_area, lv_coord_t dst_pitch,
         const lv_color_t *src_buf, const lv_area_t * src_area, lv_opa_t opa);
 
+void lv_port_gpu_blit_batch(lv_disp_drv_t *disp_drv, lv_color_t *dst, lv_coord_t dst_pitch,
+        const lv_gpu_blit_t *blits, uint32_t blit_cnt, lv_opa_t opa);
+
 bool lv_port_gpu_config_blit(lv_disp_drv_t *disp_drv, const lv_draw_img_dsc_t *draw_dsc,  lv_img_cf_t dst_cf,
         lv_img_cf_t src_cf, bool alpha_en, bool color_key_en, bool blend_en, bool colorize_en);
 
@@ -64,6 +70,15 @@ void lv_port_gpu_blit_with_mask(lv_disp_drv_t *disp_drv, lv_color_t *dst, const
 void lv_port_gpu_render_box(lv_disp_drv_t *disp_drv,  lv_color_t *dst, lv_coord_t dst_pitch,
         lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, lv_color_t color);
 
+/**
+ * Scale a whole image with filtering into an area of a frame buffer, e.g. a screen into a window
+ * @return false if the GPU is not used and nothing has been drawn
+ */
+bool lv_port_gpu_blit_scaled(lv_disp_drv_t *disp_drv, lv_color_t *dst, lv_coord_t dst_pitch,
+        const lv_area_t *dst_area, const lv_color_t *src, lv_coord_t src_w, lv_coord_t src_h);
+
+void lv_port_gpu_invalidate_src(lv_disp_drv_t *disp_drv, const void *data, uint32_t size);
+
 void lv_port_gpu_flush(void);
 /**********************
  *   STATIC FUNCTIONS
@@ -37,6 +37,12 @@
 #define LV_PORT_INDEV_TOUCH_QUEUE_DPTH          (5)
 #endif
 
+/* Pause the reading of the touchpad once the release is processed and the scrolling it threw is
+ * over, a new touch event waking the GUI thread by the callback of lv_port_indev_set_wake_cb() */
+#ifndef LV_PORT_INDEV_TOUCH_WAKE_EN
+#define LV_PORT_INDEV_TOUCH_WAKE_EN             (1)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -47,6 +53,9 @@
 #if LV_PORT_INDEV_TOUCHPAD_EN
 static void touchpad_init(void);
 static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
+#if LV_PORT_INDEV_TOUCH_WAKE_EN
+static void touchpad_read_timer_cb(lv_timer_t *timer);
+#endif /* LV_PORT_INDEV_TOUCH_WAKE_EN */
 #endif /* LV_PORT_INDEV_TOUCHPAD_EN */
 
 #if LV_PORT_INDEV_BUTTON_EN
@@ -64,9 +73,13 @@ static lv_indev_drv_t indev_touchpad_drv;
 static lv_indev_t *indev_touchpad;
 #if LV_PORT_INDEV_TOUCH_QUEUE_EN
 static OS_QUEUE touch_events;
+static gdi_touch_data_t touch_last = { 0 };     /* Still valid while no new event comes */
 #else  /* LV_PORT_INDEV_TOUCH_QUEUE_EN */
 static gdi_touch_data_t touch_state = { 0 };
 #endif /* LV_PORT_INDEV_TOUCH_QUEUE_EN */
+#if LV_PORT_INDEV_TOUCH_WAKE_EN
+static volatile lv_port_indev_wake_cb_t touch_wake_cb;
+#endif /* LV_PORT_INDEV_TOUCH_WAKE_EN */
 #endif
 #if LV_PORT_INDEV_BUTTON_EN
 static lv_indev_t *indev_button;
@@ -95,6 +108,9 @@ void lv_port_indev_init(void)
         indev_touchpad_drv.type = LV_INDEV_TYPE_POINTER;
         indev_touchpad_drv.read_cb = touchpad_read;
         indev_touchpad = lv_indev_drv_register(&indev_touchpad_drv);
+#if LV_PORT_INDEV_TOUCH_WAKE_EN
+        lv_timer_set_cb(indev_touchpad_drv.read_timer, touchpad_read_timer_cb);
+#endif /* LV_PORT_INDEV_TOUCH_WAKE_EN */
 #endif /* LV_PORT_INDEV_TOUCHPAD_EN */
 #if LV_PORT_INDEV_BUTTON_EN
         /*------------------
@@ -120,6 +136,24 @@ void lv_port_indev_init(void)
 #endif /* LV_PORT_INDEV_BUTTON_EN */
 }
 
+void lv_port_indev_set_wake_cb(lv_port_indev_wake_cb_t cb)
+{
+#if LV_PORT_INDEV_TOUCHPAD_EN && LV_PORT_INDEV_TOUCH_WAKE_EN
+        touch_wake_cb = cb;
+        lv_port_indev_resume();
+#endif
+}
+
+void lv_port_indev_resume(void)
+{
+#if LV_PORT_INDEV_TOUCHPAD_EN && LV_PORT_INDEV_TOUCH_WAKE_EN
+        if (indev_touchpad) {
+                lv_timer_resume(indev_touchpad_drv.read_timer);
+                lv_timer_ready(indev_touchpad_drv.read_timer);
+        }
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -131,14 +165,25 @@ static void touch_store_events(gdi_touch_data_t *touch_data)
 {
 #if LV_PORT_INDEV_TOUCH_QUEUE_EN
         if (OS_QUEUE_FULL == OS_QUEUE_PUT(touch_events, touch_data, OS_QUEUE_NO_WAIT)) {
-                /* Touch point is dropped, check if increased queue is required */
-                OS_ASSERT(0);
+                /* The GUI thread is busy, e.g. rendering a transition. The oldest point is dropped
+                 * instead of this one: the last state is kept once the queue is read, so a lost
+                 * release would leave the touchpad pressed. */
+                gdi_touch_data_t oldest;
+
+                OS_QUEUE_GET(touch_events, &oldest, OS_QUEUE_NO_WAIT);
+                OS_QUEUE_PUT(touch_events, touch_data, OS_QUEUE_NO_WAIT);
         }
 #else /* LV_PORT_INDEV_TOUCH_QUEUE_EN */
         OS_ENTER_CRITICAL_SECTION();
         touch_state = *touch_data;
         OS_LEAVE_CRITICAL_SECTION();
 #endif /* LV_PORT_INDEV_TOUCH_QUEUE_EN */
+#if LV_PORT_INDEV_TOUCH_WAKE_EN
+        /* After the event is stored, a read timer pausing meanwhile is resumed by this wake up */
+        if (touch_wake_cb) {
+                touch_wake_cb();
+        }
+#endif /* LV_PORT_INDEV_TOUCH_WAKE_EN */
 }
 
 /*Initialize your touchpad*/
@@ -154,13 +199,12 @@ static void touchpad_init(void)
 static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
 {
 #if LV_PORT_INDEV_TOUCH_QUEUE_EN
-        gdi_touch_data_t event;
-        if (OS_QUEUE_OK == OS_QUEUE_GET(touch_events, &event, OS_QUEUE_NO_WAIT)) {
-                data->point.x = event.x;
-                data->point.y = event.y;
-                data->state = event.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+        if (OS_QUEUE_OK == OS_QUEUE_GET(touch_events, &touch_last, OS_QUEUE_NO_WAIT)) {
                 data->continue_reading = OS_QUEUE_MESSAGES_WAITING(touch_events) ? true : false;
         }
+        data->point.x = touch_last.x;
+        data->point.y = touch_last.y;
+        data->state = touch_last.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
 #else /* LV_PORT_INDEV_TOUCH_QUEUE_EN */
         OS_ENTER_CRITICAL_SECTION();
         /*Set the last pressed coordinates*/
@@ -171,6 +215,38 @@ static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
 #endif /* LV_PORT_INDEV_TOUCH_QUEUE_EN */
 }
 
+#if LV_PORT_INDEV_TOUCH_WAKE_EN
+static bool touchpad_pending(void)
+{
+#if LV_PORT_INDEV_TOUCH_QUEUE_EN
+        return OS_QUEUE_MESSAGES_WAITING(touch_events) != 0;
+#else /* LV_PORT_INDEV_TOUCH_QUEUE_EN */
+        bool pressed;
+
+        OS_ENTER_CRITICAL_SECTION();
+        pressed = touch_state.pressed;
+        OS_LEAVE_CRITICAL_SECTION();
+
+        return pressed;
+#endif /* LV_PORT_INDEV_TOUCH_QUEUE_EN */
+}
+
+/*Read the touchpad as LVGL does, then stop reading it while nothing can change*/
+static void touchpad_read_timer_cb(lv_timer_t *timer)
+{
+        lv_indev_read_timer_cb(timer);
+
+        /* Without a callback to wake it, the thread only polls */
+        if (!touch_wake_cb) {
+                return;
+        }
+        if (indev_touchpad->proc.state == LV_INDEV_STATE_REL &&
+                        indev_touchpad->proc.types.pointer.scroll_obj == NULL && !touchpad_pending()) {
+                lv_timer_pause(timer);
+        }
+}
+#endif /* LV_PORT_INDEV_TOUCH_WAKE_EN */
+
 #endif /* LV_PORT_INDEV_TOUCHPAD_EN */
 #if LV_PORT_INDEV_BUTTON_EN
 /*------------------
@@ -34,12 +34,26 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
+/* Called from the context storing the touch events, to wake the thread running lv_task_handler() */
+typedef void (*lv_port_indev_wake_cb_t)(void);
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 void lv_port_indev_init(void);
 
+/**
+ * Set the callback waking the GUI thread when a touch event is stored while the touchpad is not
+ * read, see LV_PORT_INDEV_TOUCH_WAKE_EN
+ * @param cb    the callback, NULL if the thread polls the touchpad
+ */
+void lv_port_indev_set_wake_cb(lv_port_indev_wake_cb_t cb);
+
+/**
+ * Read the touchpad again at the next lv_task_handler(), once the thread is woken by the callback
+ */
+void lv_port_indev_resume(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -2,6 +2,7 @@
  * @file lvgl.h
  * Include all LVGL related headers
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 #ifndef LVGL_H
 #define LVGL_H
@@ -27,6 +28,7 @@ extern "C" {
 #include "src/misc/lv_math.h"
 #include "src/misc/lv_async.h"
 #include "src/misc/lv_anim_timeline.h"
+#include "src/misc/lv_profiler.h"
 
 #include "src/hal/lv_hal.h"
 
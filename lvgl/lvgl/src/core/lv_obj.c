@@ -2,6 +2,7 @@
  * @file lv_obj.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -857,6 +858,8 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
 
     lv_state_t prev_state = obj->state;
     obj->state = new_state;
+    /*The inherited properties of the children might change too*/
+    _lv_style_inc_version();
 
     _lv_style_state_cmp_t cmp_res = _lv_obj_style_state_compare(obj, prev_state, new_state);
     /*If there is no difference in styles there is nothing else to do*/
@@ -2,6 +2,7 @@
  * @file lv_obj_class.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -49,6 +50,8 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
     lv_memset_00(obj, s);
     obj->class_p = class_p;
     obj->parent = parent;
+    /*The memory might be the one of a deleted object, whose properties are still resolved*/
+    _lv_style_inc_version();
 
     /*Create a screen*/
     if(parent == NULL) {
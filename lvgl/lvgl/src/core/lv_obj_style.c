@@ -2,6 +2,7 @@
  * @file lv_obj_style.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -15,6 +16,19 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+#if DLG_LVGL_USE_STYLE_CACHE
+/*Number of resolved properties in the cache, a power of 2. They are kept in sets of 2.*/
+#ifndef DLG_LVGL_STYLE_CACHE_ENTRIES
+    #define DLG_LVGL_STYLE_CACHE_ENTRIES    512
+#endif
+
+#if DLG_LVGL_STYLE_CACHE_ENTRIES & (DLG_LVGL_STYLE_CACHE_ENTRIES - 1)
+    #error "DLG_LVGL_STYLE_CACHE_ENTRIES must be a power of 2"
+#endif
+
+#define STYLE_CACHE_SETS    (DLG_LVGL_STYLE_CACHE_ENTRIES / 2)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +49,16 @@ typedef enum {
     CACHE_NEED_CHECK = 4,
 } cache_t;
 
+#if DLG_LVGL_USE_STYLE_CACHE
+typedef struct {
+    const lv_obj_t * obj;       /*NULL: unused entry*/
+    uint16_t key;               /*The property, the part and `skip_trans`, see `style_cache_key()`*/
+    lv_state_t state;           /*State of the object when the property was resolved*/
+    uint32_t version;           /*Version of the group of the property, see `style_cache_version()`*/
+    lv_style_value_t value;
+} style_cache_entry_t;
+#endif
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -45,6 +69,12 @@ typedef enum {
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
 static bool get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
+static lv_style_value_t get_prop_resolved(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+#if DLG_LVGL_USE_STYLE_CACHE
+static inline uint16_t style_cache_key(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+static inline uint32_t style_cache_set(const lv_obj_t * obj, uint16_t key);
+static inline uint32_t style_cache_version(lv_style_prop_t prop);
+#endif
 static lv_style_value_t apply_color_filter(const lv_obj_t * obj, uint32_t part, lv_style_value_t v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
@@ -60,6 +90,13 @@ static void fade_in_anim_ready(lv_anim_t * a);
  **********************/
 static bool style_refr = true;
 
+#if DLG_LVGL_USE_STYLE_CACHE
+/*Properties resolved by `lv_obj_get_style_prop()`, valid while the version of their group is the same*/
+static style_cache_entry_t style_cache[DLG_LVGL_STYLE_CACHE_ENTRIES];
+static bool style_cache_en = true;
+static lv_obj_style_cache_stat_t style_cache_stat;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -99,6 +136,7 @@ void lv_obj_add_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t se
     lv_memset_00(&obj->styles[i], sizeof(_lv_obj_style_t));
     obj->styles[i].style = style;
     obj->styles[i].selector = selector;
+    _lv_style_inc_version();
 
     lv_obj_refresh_style(obj, selector, LV_STYLE_PROP_ANY);
 }
@@ -140,6 +178,7 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
 
         obj->style_cnt--;
         obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
+        _lv_style_inc_version();
 
         deleted = true;
         /*The style from the current `i` index is removed, so `i` points to the next style.
@@ -152,6 +191,9 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+    /*The style might have been changed in place*/
+    _lv_style_inc_version();
+
     if(!style_refr) return;
     lv_disp_t * d = lv_disp_get_next(NULL);
 
@@ -168,6 +210,8 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    _lv_style_inc_version();
+
     if(!style_refr) return;
 
     lv_obj_invalidate(obj);
@@ -207,51 +251,47 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
-    lv_style_value_t value_act;
-    bool inherit = prop & LV_STYLE_PROP_INHERIT ? true : false;
-    bool filter = prop & LV_STYLE_PROP_FILTER ? true : false;
-    if(filter) {
-        prop &= ~LV_STYLE_PROP_FILTER;
-    }
-    bool found = false;
-    while(obj) {
-        found = get_prop_core(obj, part, prop, &value_act);
-        if(found) break;
-        if(!inherit) break;
+#if DLG_LVGL_USE_STYLE_CACHE
+    if(!style_cache_en || obj == NULL) return get_prop_resolved(obj, part, prop);
 
-        /*If not found, check the `MAIN` style first*/
-        if(part != LV_PART_MAIN) {
-            part = LV_PART_MAIN;
-            continue;
-        }
+    uint16_t key = style_cache_key(obj, part, prop);
+    uint32_t version = style_cache_version(prop);
+    style_cache_entry_t * set = &style_cache[style_cache_set(obj, key) * 2];
 
-        /*Check the parent too.*/
-        obj = lv_obj_get_parent(obj);
+    if(set[0].obj == obj && set[0].key == key && set[0].state == obj->state && set[0].version == version) {
+        style_cache_stat.hit_cnt++;
+        return set[0].value;
     }
 
-    if(!found) {
-        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
-            const lv_obj_class_t * cls = obj->class_p;
-            while(cls) {
-                if(prop == LV_STYLE_WIDTH) {
-                    if(cls->width_def != 0) break;
-                }
-                else {
-                    if(cls->height_def != 0) break;
-                }
-                cls = cls->base_class;
-            }
-
-            value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
-        }
-        else {
-            value_act = lv_style_prop_get_default(prop);
-        }
+    /*The most recently used entry is kept first*/
+    if(set[1].obj == obj && set[1].key == key && set[1].state == obj->state && set[1].version == version) {
+        style_cache_entry_t tmp = set[1];
+        set[1] = set[0];
+        set[0] = tmp;
+        style_cache_stat.hit_cnt++;
+        return tmp.value;
     }
-    if(filter) value_act = apply_color_filter(obj, part, value_act);
-    return value_act;
+
+    lv_style_value_t value = get_prop_resolved(obj, part, prop);
+    style_cache_stat.miss_cnt++;
+
+    /*E.g. a color filter might change a style meanwhile*/
+    if(style_cache_version(prop) != version) return value;
+
+    set[1] = set[0];
+    set[0].obj = obj;
+    set[0].key = key;
+    set[0].state = obj->state;
+    set[0].version = version;
+    set[0].value = value;
+
+    return value;
+#else
+    return get_prop_resolved(obj, part, prop);
+#endif
 }
 
 void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_value_t value,
@@ -461,6 +501,19 @@ lv_text_align_t lv_obj_calculate_style_text_align(const struct _lv_obj_t * obj,
     return align;
 }
 
+#if DLG_LVGL_USE_STYLE_CACHE
+void lv_obj_style_cache_enable(bool en)
+{
+    style_cache_en = en;
+    _lv_style_inc_version();
+}
+
+void lv_obj_style_cache_get_stat(lv_obj_style_cache_stat_t * stat)
+{
+    *stat = style_cache_stat;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -536,6 +589,99 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
 }
 
 
+static lv_style_value_t get_prop_resolved(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    lv_style_value_t value_act;
+    bool inherit = prop & LV_STYLE_PROP_INHERIT ? true : false;
+    bool filter = prop & LV_STYLE_PROP_FILTER ? true : false;
+#if DLG_LVGL_USE_STYLE_CACHE
+    lv_style_prop_t prop_ori = prop;
+#endif
+    if(filter) {
+        prop &= ~LV_STYLE_PROP_FILTER;
+    }
+    bool found = false;
+    while(obj) {
+        found = get_prop_core(obj, part, prop, &value_act);
+        if(found) break;
+        if(!inherit) break;
+
+        /*If not found, check the `MAIN` style first*/
+        if(part != LV_PART_MAIN) {
+            part = LV_PART_MAIN;
+            continue;
+        }
+
+#if DLG_LVGL_USE_STYLE_CACHE
+        /*Take the value of the parent, cached once for all its children*/
+        if(style_cache_en && obj->parent) return lv_obj_get_style_prop(obj->parent, LV_PART_MAIN, prop_ori);
+#endif
+
+        /*Check the parent too.*/
+        obj = lv_obj_get_parent(obj);
+    }
+
+    if(!found) {
+        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
+            const lv_obj_class_t * cls = obj->class_p;
+            while(cls) {
+                if(prop == LV_STYLE_WIDTH) {
+                    if(cls->width_def != 0) break;
+                }
+                else {
+                    if(cls->height_def != 0) break;
+                }
+                cls = cls->base_class;
+            }
+
+            value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
+        }
+        else {
+            value_act = lv_style_prop_get_default(prop);
+        }
+    }
+    if(filter) value_act = apply_color_filter(obj, part, value_act);
+    return value_act;
+}
+
+#if DLG_LVGL_USE_STYLE_CACHE
+/**
+ * Key of a property in the style cache
+ * @param obj   pointer to an object
+ * @param part  the part of the object
+ * @param prop  the property, with `LV_STYLE_PROP_FILTER` if the color filter is applied
+ * @return bits 0..9: id of the property, 10: filtered, 11..14: part, 15: `skip_trans`
+ */
+static inline uint16_t style_cache_key(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    return (prop & 0x3FF) | (prop & LV_STYLE_PROP_FILTER ? 1 << 10 : 0) | ((part >> 16) & 0xF) << 11 |
+           obj->skip_trans << 15;
+}
+
+static inline uint32_t style_cache_set(const lv_obj_t * obj, uint16_t key)
+{
+    uint32_t h = ((uint32_t)(uintptr_t)obj >> 3) ^ (key * 0x9E3779B1);
+    return (h ^ (h >> 16)) & (STYLE_CACHE_SETS - 1);
+}
+
+/**
+ * Version a cached property depends on. The versions only grow, so their sum stays the same only if
+ * none of them changes: a filtered color depends on the group of the color filter too.
+ * @param prop  the property, with `LV_STYLE_PROP_FILTER` if the color filter is applied
+ * @return the version of the group of the property
+ */
+static inline uint32_t style_cache_version(lv_style_prop_t prop)
+{
+    uint8_t group = _lv_style_get_prop_group(prop);
+    uint32_t version = _lv_style_get_version(group);
+    if(prop & LV_STYLE_PROP_FILTER) {
+        uint8_t filter_group = _lv_style_get_prop_group(LV_STYLE_COLOR_FILTER_DSC);
+        if(filter_group != group) version += _lv_style_get_version(filter_group);
+    }
+    return version;
+}
+#endif
+
 static bool get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v)
 {
     uint8_t group = 1 << _lv_style_get_prop_group(prop);
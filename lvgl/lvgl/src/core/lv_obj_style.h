@@ -2,6 +2,7 @@
  * @file lv_obj_style.h
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 #ifndef LV_OBJ_STYLE_H
 #define LV_OBJ_STYLE_H
@@ -20,6 +21,9 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#ifndef DLG_LVGL_USE_STYLE_CACHE
+#define DLG_LVGL_USE_STYLE_CACHE 0
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -54,6 +58,17 @@ typedef struct {
 #endif
 } _lv_obj_style_transition_dsc_t;
 
+#if DLG_LVGL_USE_STYLE_CACHE
+/**
+ * Counters of the style cache. They are never cleared, the user can compute the change between
+ * two readings.
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Properties found in the cache*/
+    uint32_t miss_cnt;      /**< Properties resolved from the styles and added*/
+} lv_obj_style_cache_stat_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -230,6 +245,20 @@ static inline void lv_obj_set_style_size(struct _lv_obj_t * obj,  lv_coord_t val
 
 lv_text_align_t lv_obj_calculate_style_text_align(const struct _lv_obj_t * obj, lv_part_t part, const char * txt);
 
+#if DLG_LVGL_USE_STYLE_CACHE
+/**
+ * Use or bypass the cache of the properties resolved by `lv_obj_get_style_prop()`. It is used by default.
+ * @param en    true: look up the properties in the cache
+ */
+void lv_obj_style_cache_enable(bool en);
+
+/**
+ * Get the counters of the style cache
+ * @param stat  the counters are copied here
+ */
+void lv_obj_style_cache_get_stat(lv_obj_style_cache_stat_t * stat);
+#endif
+
 static inline lv_coord_t lv_obj_get_x_aligned(const struct _lv_obj_t * obj)
 {
     return lv_obj_get_style_x(obj, LV_PART_MAIN);
@@ -2,6 +2,7 @@
  * @file lv_obj_tree.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -178,6 +179,7 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     parent->spec_attr->children[lv_obj_get_child_cnt(parent) - 1] = obj;
 
     obj->parent = parent;
+    _lv_style_inc_version();
 
     if(new_base_dir != LV_BASE_DIR_RTL) {
         lv_obj_set_pos(obj, old_pos.x, old_pos.y);
@@ -16,6 +16,7 @@
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_profiler.h"
 #include "../draw/lv_draw.h"
 #include "../font/lv_font_fmt_txt.h"
 
@@ -35,13 +36,19 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static void lv_refr_join_area_px(lv_area_t * areas, uint8_t * area_joined, uint16_t area_cnt);
+static void lv_refr_join_area_cost(const lv_area_t * areas_px, const uint8_t * area_joined_px, uint16_t area_cnt_px,
+                                   uint64_t cost_px);
+static uint32_t lv_refr_get_cost(lv_area_t * area_p);
+static uint32_t lv_refr_get_flush_cnt(const lv_area_t * area_p);
+static int32_t lv_refr_get_max_row(lv_coord_t w, lv_coord_t h);
 static void lv_refr_areas(void);
 static void lv_refr_area(const lv_area_t * area_p);
 static void lv_refr_area_part(const lv_area_t * area_p);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p);
 static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p);
-static void draw_buf_flush(void);
+static void draw_buf_flush(const lv_area_t * area_p);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
 
 /**********************
@@ -183,6 +190,7 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp)
 void _lv_disp_refr_timer(lv_timer_t * tmr)
 {
     TRACE_REFR("begin");
+    LV_PROFILER_BEGIN(LV_PROFILER_REFR);
 
     uint32_t start = lv_tick_get();
     volatile uint32_t elaps = 0;
@@ -208,6 +216,7 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
         LV_LOG_WARN("there is no active screen");
+        LV_PROFILER_END(LV_PROFILER_REFR);
         TRACE_REFR("finished");
         return;
     }
@@ -219,7 +228,7 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     /*If refresh happened ...*/
     if(disp_refr->inv_p != 0) {
         if(disp_refr->driver->full_refresh) {
-            draw_buf_flush();
+            draw_buf_flush(&disp_refr->driver->draw_buf->area);
         }
 
         /*Clean up*/
@@ -234,7 +243,9 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         }
     }
 
+#if DLG_LVGL_USE_MEM_BUF_POOL == 0
     lv_mem_buf_free_all();
+#endif
     _lv_font_clean_up_fmt_txt();
 
 #if LV_DRAW_COMPLEX
@@ -314,6 +325,7 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     }
 #endif
 
+    LV_PROFILER_END(LV_PROFILER_REFR);
     TRACE_REFR("finished");
 }
 
@@ -329,40 +341,289 @@ uint32_t lv_refr_get_fps_avg(void)
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the invalidated areas: by pixel count or, if the driver has `refr_cost_cb`, by refresh cost
  */
 static void lv_refr_join_area(void)
+{
+    if(disp_refr->driver->refr_cost_cb == NULL || disp_refr->driver->full_refresh) {
+        lv_refr_join_area_px(disp_refr->inv_areas, disp_refr->inv_area_joined, disp_refr->inv_p);
+        return;
+    }
+
+    if(disp_refr->inv_p == 0) return;
+
+    lv_disp_refr_stat_t * stat = &disp_refr->refr_stat;
+    uint32_t i;
+
+    /*Join a copy of the areas by pixel count: the cost model must not do worse than it*/
+    lv_area_t areas_px[LV_INV_BUF_SIZE];
+    uint8_t area_joined_px[LV_INV_BUF_SIZE];
+    uint16_t area_cnt_px = disp_refr->inv_p;
+    uint64_t cost_px = 0;
+    lv_memcpy(areas_px, disp_refr->inv_areas, area_cnt_px * sizeof(lv_area_t));
+    lv_memcpy(area_joined_px, disp_refr->inv_area_joined, area_cnt_px);
+    lv_refr_join_area_px(areas_px, area_joined_px, area_cnt_px);
+    for(i = 0; i < area_cnt_px; i++) {
+        if(area_joined_px[i]) continue;
+        cost_px += lv_refr_get_cost(&areas_px[i]);
+#if DLG_LVGL_USE_REFR_STAT
+        /*See what the cost model saves*/
+        stat->flush_cnt_legacy += lv_refr_get_flush_cnt(&areas_px[i]);
+        stat->px_cnt_legacy += lv_area_get_size(&areas_px[i]);
+#endif
+    }
+
+    lv_refr_join_area_cost(areas_px, area_joined_px, area_cnt_px, cost_px);
+
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+        stat->flush_cnt += lv_refr_get_flush_cnt(&disp_refr->inv_areas[i]);
+        stat->px_cnt += lv_area_get_size(&disp_refr->inv_areas[i]);
+    }
+    stat->refr_cnt++;
+}
+
+/**
+ * Join the areas which has got common parts if the joined area is smaller
+ * @param areas the areas to join
+ * @param area_joined marks the areas joined into an other one
+ * @param area_cnt number of areas
+ */
+static void lv_refr_join_area_px(lv_area_t * areas, uint8_t * area_joined, uint16_t area_cnt)
 {
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
+    for(join_in = 0; join_in < area_cnt; join_in++) {
+        if(area_joined[join_in] != 0) continue;
 
         /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
+        for(join_from = 0; join_from < area_cnt; join_from++) {
             /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
+            if(area_joined[join_from] != 0 || join_in == join_from) {
                 continue;
             }
 
             /*Check if the areas are on each other*/
-            if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
+            if(_lv_area_is_on(&areas[join_in], &areas[join_from]) == false) {
                 continue;
             }
 
-            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+            _lv_area_join(&joined_area, &areas[join_in], &areas[join_from]);
 
             /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&areas[join_in]) +
+                                                 lv_area_get_size(&areas[join_from]))) {
+                lv_area_copy(&areas[join_in], &joined_area);
 
                 /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+                area_joined[join_from] = 1;
+            }
+        }
+    }
+}
+
+/**
+ * Rearrange the invalidated areas to minimize the cost reported by `refr_cost_cb`:
+ * merge any two areas if refreshing them at once is cheaper, cut the common part of
+ * overlapping areas from one of them and refresh the whole screen if that is the cheapest.
+ * @param areas_px the areas joined by pixel count, taken if the result costs more
+ * @param area_joined_px marks the areas joined into an other one by pixel count
+ * @param area_cnt_px number of areas joined by pixel count
+ * @param cost_px cost of the areas joined by pixel count
+ */
+static void lv_refr_join_area_cost(const lv_area_t * areas_px, const uint8_t * area_joined_px, uint16_t area_cnt_px,
+                                   uint64_t cost_px)
+{
+    lv_area_t * areas = disp_refr->inv_areas;
+    uint8_t * area_joined = disp_refr->inv_area_joined;
+    uint32_t cost[LV_INV_BUF_SIZE];
+    uint64_t cost_sum;
+    uint32_t i;
+    uint32_t j;
+    uint32_t c;
+    lv_area_t tmp;
+    bool joined;
+
+    /*Drop the areas inside an other one first, else merging them would look cheaper by their cost*/
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(area_joined[i] != 0) continue;
+
+        for(j = 0; j < disp_refr->inv_p; j++) {
+            if(area_joined[j] != 0 || i == j) continue;
+            if(_lv_area_is_in(&areas[j], &areas[i], 0)) area_joined[j] = 1;
+        }
+    }
+
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(area_joined[i] == 0) cost[i] = lv_refr_get_cost(&areas[i]);
+    }
+
+    /*Merge: a larger area can still be cheaper than two flushes. Repeat as the grown areas may join others*/
+    do {
+        joined = false;
+        for(i = 0; i < disp_refr->inv_p; i++) {
+            if(area_joined[i] != 0) continue;
+
+            for(j = 0; j < disp_refr->inv_p; j++) {
+                if(area_joined[j] != 0 || i == j) continue;
+
+                _lv_area_join(&tmp, &areas[i], &areas[j]);
+                c = lv_refr_get_cost(&tmp);
+                if(c < cost[i] + cost[j]) {
+                    lv_area_copy(&areas[i], &tmp);
+                    cost[i] = c;
+                    area_joined[j] = 1;
+                    joined = true;
+                }
             }
         }
+    } while(joined);
+
+    /*Split: don't refresh the common part of the remaining overlapping areas twice.
+     *Replace 'j' with the (at most 4) rectangles covering the rest of it if the extra flushes are cheaper*/
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(area_joined[i] != 0) continue;
+
+        for(j = 0; j < disp_refr->inv_p; j++) {
+            if(area_joined[j] != 0 || i == j) continue;
+            if(_lv_area_intersect(&tmp, &areas[i], &areas[j]) == false) continue;
+
+            if(_lv_area_is_in(&areas[j], &areas[i], 0)) {
+                area_joined[j] = 1;
+                continue;
+            }
+
+            /*Bands above and below the common part, then the parts left and right of it*/
+            lv_area_t parts[4];
+            uint32_t part_cost[4];
+            uint32_t part_cnt = 0;
+            uint64_t split_cost = 0;
+            uint32_t k;
+            lv_area_t * ar = &areas[j];
+            if(tmp.y1 > ar->y1) lv_area_set(&parts[part_cnt++], ar->x1, ar->y1, ar->x2, tmp.y1 - 1);
+            if(tmp.y2 < ar->y2) lv_area_set(&parts[part_cnt++], ar->x1, tmp.y2 + 1, ar->x2, ar->y2);
+            if(tmp.x1 > ar->x1) lv_area_set(&parts[part_cnt++], ar->x1, tmp.y1, tmp.x1 - 1, tmp.y2);
+            if(tmp.x2 < ar->x2) lv_area_set(&parts[part_cnt++], tmp.x2 + 1, tmp.y1, ar->x2, tmp.y2);
+
+            if(disp_refr->inv_p + part_cnt - 1 > LV_INV_BUF_SIZE) continue;
+
+            /*The rounding can give back a part of the cut*/
+            for(k = 0; k < part_cnt; k++) {
+                part_cost[k] = lv_refr_get_cost(&parts[k]);
+                split_cost += part_cost[k];
+            }
+            if(split_cost >= cost[j]) continue;
+
+            lv_area_copy(&areas[j], &parts[0]);
+            cost[j] = part_cost[0];
+            for(k = 1; k < part_cnt; k++) {
+                lv_area_copy(&areas[disp_refr->inv_p], &parts[k]);
+                area_joined[disp_refr->inv_p] = 0;
+                cost[disp_refr->inv_p] = part_cost[k];
+                disp_refr->inv_p++;
+            }
+        }
+    }
+
+    cost_sum = 0;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(area_joined[i] == 0) cost_sum += cost[i];
+    }
+
+    /*The greedy merge can still miss: never cost more than the join by pixel count*/
+    if(cost_sum > cost_px) {
+        lv_memcpy(areas, areas_px, area_cnt_px * sizeof(lv_area_t));
+        lv_memcpy(area_joined, area_joined_px, area_cnt_px);
+        disp_refr->inv_p = area_cnt_px;
+        cost_sum = cost_px;
+    }
+
+    /*Full refresh: too many or too large areas*/
+    tmp.x1 = 0;
+    tmp.y1 = 0;
+    tmp.x2 = lv_disp_get_hor_res(disp_refr) - 1;
+    tmp.y2 = lv_disp_get_ver_res(disp_refr) - 1;
+    if(disp_refr->inv_p > 1 && lv_refr_get_cost(&tmp) <= cost_sum) {
+        lv_area_copy(&areas[0], &tmp);
+        area_joined[0] = 0;
+        lv_memset(&area_joined[1], 1, disp_refr->inv_p - 1);
+        disp_refr->refr_stat.full_cnt++;
+    }
+}
+
+/**
+ * Round an area with the driver's `rounder_cb` and get the cost of refreshing it
+ * @param area_p pointer to the area, rounded in place
+ * @return the cost reported by `refr_cost_cb`
+ */
+static uint32_t lv_refr_get_cost(lv_area_t * area_p)
+{
+    if(disp_refr->driver->rounder_cb) disp_refr->driver->rounder_cb(disp_refr->driver, area_p);
+
+    return disp_refr->driver->refr_cost_cb(disp_refr->driver, area_p, lv_refr_get_flush_cnt(area_p));
+}
+
+/**
+ * Get the number of parts `lv_refr_area()` draws and flushes an area in
+ * @param area_p pointer to an area
+ * @return the number of flushes
+ */
+static uint32_t lv_refr_get_flush_cnt(const lv_area_t * area_p)
+{
+    if(disp_refr->driver->full_refresh || disp_refr->driver->direct_mode) return 1;
+
+    lv_coord_t h = lv_area_get_height(area_p);
+    int32_t max_row = lv_refr_get_max_row(lv_area_get_width(area_p), h);
+    if(max_row <= 0) return 1;
+
+    return (h + max_row - 1) / max_row;
+}
+
+/**
+ * Get the number of rows of an area which are drawn at once
+ * @param w width of the area
+ * @param h height of the area
+ * @return the number of rows, <= 0 if the rounder can't fit any rows into the draw buffer
+ */
+static int32_t lv_refr_get_max_row(lv_coord_t w, lv_coord_t h)
+{
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
+    int32_t max_row = (uint32_t)draw_buf->size / w;
+
+    /*In pipelined refresh the rounder below aligns the tiles too*/
+    if(disp_refr->driver->tile_size && draw_buf->buf2) {
+        int32_t tile_row = LV_MAX(disp_refr->driver->tile_size / w, 1);
+        if(tile_row < max_row) max_row = tile_row;
+    }
+
+    if(max_row > h) max_row = h;
+
+    /*Round down the lines of draw_buf if rounding is added*/
+    if(disp_refr->driver->rounder_cb) {
+        lv_area_t tmp;
+        tmp.x1 = 0;
+        tmp.x2 = 0;
+        tmp.y1 = 0;
+
+        lv_coord_t h_tmp = max_row;
+        do {
+            tmp.y2 = h_tmp - 1;
+            disp_refr->driver->rounder_cb(disp_refr->driver, &tmp);
+
+            /*If this height fits into `max_row` then fine*/
+            if(lv_area_get_height(&tmp) <= max_row) break;
+
+            /*Decrement the height of the area until it fits into `max_row` after rounding*/
+            h_tmp--;
+        } while(h_tmp > 0);
+
+        if(h_tmp <= 0) return 0;
+
+        max_row = tmp.y2 + 1;
     }
+
+    return max_row;
 }
 
 /**
@@ -393,7 +654,9 @@ static void lv_refr_areas(void)
 
             if(i == last_i) disp_refr->driver->draw_buf->last_area = 1;
             disp_refr->driver->draw_buf->last_part = 0;
+            LV_PROFILER_BEGIN(LV_PROFILER_REFR_AREA);
             lv_refr_area(&disp_refr->inv_areas[i]);
+            LV_PROFILER_END(LV_PROFILER_REFR_AREA);
 
             px_num += lv_area_get_size(&disp_refr->inv_areas[i]);
         }
@@ -406,8 +669,9 @@ static void lv_refr_areas(void)
  */
 static void lv_refr_area(const lv_area_t * area_p)
 {
-    /*With full refresh just redraw directly into the buffer*/
-    if(disp_refr->driver->full_refresh) {
+    /*With full refresh just redraw directly into the buffer.
+     *In direct mode the area is drawn in one part at its place in the screen sized buffer*/
+    if(disp_refr->driver->full_refresh || disp_refr->driver->direct_mode) {
         lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
         draw_buf->area.x1        = 0;
         draw_buf->area.x2        = lv_disp_get_hor_res(disp_refr) - 1;
@@ -426,37 +690,11 @@ static void lv_refr_area(const lv_area_t * area_p)
     lv_coord_t y2 = area_p->y2 >= lv_disp_get_ver_res(disp_refr) ?
                     lv_disp_get_ver_res(disp_refr) - 1 : area_p->y2;
 
-    int32_t max_row = (uint32_t)draw_buf->size / w;
-
-    if(max_row > h) max_row = h;
-
-    /*Round down the lines of draw_buf if rounding is added*/
-    if(disp_refr->driver->rounder_cb) {
-        lv_area_t tmp;
-        tmp.x1 = 0;
-        tmp.x2 = 0;
-        tmp.y1 = 0;
-
-        lv_coord_t h_tmp = max_row;
-        do {
-            tmp.y2 = h_tmp - 1;
-            disp_refr->driver->rounder_cb(disp_refr->driver, &tmp);
-
-            /*If this height fits into `max_row` then fine*/
-            if(lv_area_get_height(&tmp) <= max_row) break;
-
-            /*Decrement the height of the area until it fits into `max_row` after rounding*/
-            h_tmp--;
-        } while(h_tmp > 0);
-
-        if(h_tmp <= 0) {
-            LV_LOG_WARN("Can't set draw_buf height using the round function. (Wrong round_cb or to "
-                        "small draw_buf)");
-            return;
-        }
-        else {
-            max_row = tmp.y2 + 1;
-        }
+    int32_t max_row = lv_refr_get_max_row(w, h);
+    if(max_row <= 0) {
+        LV_LOG_WARN("Can't set draw_buf height using the round function. (Wrong round_cb or to "
+                    "small draw_buf)");
+        return;
     }
 
     /*Always use the full row*/
@@ -495,12 +733,18 @@ static void lv_refr_area_part(const lv_area_t * area_p)
 {
     lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
 
+#if DLG_LVGL_USE_MEM_BUF_POOL
+    _lv_mem_buf_frame_begin();
+#endif
+
     /* Below the `area_p` area will be redrawn into the draw buffer.
      * In single buffered mode wait here until the buffer is freed.*/
     if(draw_buf->buf1 && !draw_buf->buf2) {
+        LV_PROFILER_BEGIN(LV_PROFILER_FLUSH_WAIT);
         while(draw_buf->flushing) {
             if(disp_refr->driver->wait_cb) disp_refr->driver->wait_cb(disp_refr->driver);
         }
+        LV_PROFILER_END(LV_PROFILER_FLUSH_WAIT);
     }
 
     lv_obj_t * top_act_scr = NULL;
@@ -568,10 +812,14 @@ static void lv_refr_area_part(const lv_area_t * area_p)
     lv_refr_obj_and_children(lv_disp_get_layer_sys(disp_refr), &start_mask);
 
     /*In true double buffered mode flush only once when all areas were rendered.
-     *In normal mode flush after every area*/
+     *In normal mode flush after every area, in direct mode only the area is passed to the driver*/
     if(disp_refr->driver->full_refresh == false) {
-        draw_buf_flush();
+        draw_buf_flush(disp_refr->driver->direct_mode ? &start_mask : &draw_buf->area);
     }
+
+#if DLG_LVGL_USE_MEM_BUF_POOL
+    _lv_mem_buf_frame_end();
+#endif
 }
 
 /**
@@ -837,7 +1085,7 @@ static void draw_buf_rotate_90_sqr(bool is_270, lv_coord_t w, lv_color_t * color
 static void draw_buf_rotate(lv_area_t * area, lv_color_t * color_p)
 {
     lv_disp_drv_t * drv = disp_refr->driver;
-    if(disp_refr->driver->full_refresh && drv->sw_rotate) {
+    if((disp_refr->driver->full_refresh || disp_refr->driver->direct_mode) && drv->sw_rotate) {
         LV_LOG_ERROR("cannot rotate a full refreshed display!");
         return;
     }
@@ -923,7 +1171,7 @@ static void draw_buf_rotate(lv_area_t * area, lv_color_t * color_p)
 /**
  * Flush the content of the draw buffer
  */
-static void draw_buf_flush(void)
+static void draw_buf_flush(const lv_area_t * area_p)
 {
     lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
     lv_color_t * color_p = draw_buf->buf_act;
@@ -935,9 +1183,11 @@ static void draw_buf_flush(void)
     /* In double buffered mode wait until the other buffer is freed
      * and driver is ready to receive the new buffer */
     if(draw_buf->buf1 && draw_buf->buf2) {
+        LV_PROFILER_BEGIN(LV_PROFILER_FLUSH_WAIT);
         while(draw_buf->flushing) {
             if(disp_refr->driver->wait_cb) disp_refr->driver->wait_cb(disp_refr->driver);
         }
+        LV_PROFILER_END(LV_PROFILER_FLUSH_WAIT);
     }
 
     draw_buf->flushing = 1;
@@ -951,10 +1201,11 @@ static void draw_buf_flush(void)
             draw_buf_rotate(&draw_buf->area, draw_buf->buf_act);
         }
         else {
-            call_flush_cb(disp->driver, &draw_buf->area, color_p);
+            call_flush_cb(disp->driver, area_p, color_p);
         }
     }
-    if(draw_buf->buf1 && draw_buf->buf2) {
+    /*In direct mode the areas of a frame are drawn in the same buffer*/
+    if(draw_buf->buf1 && draw_buf->buf2 && (!disp->driver->direct_mode || draw_buf->flushing_last)) {
         if(draw_buf->buf_act == draw_buf->buf1)
             draw_buf->buf_act = draw_buf->buf2;
         else
@@ -974,5 +1225,7 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
         .y2 = area->y2 + drv->offset_y
     };
 
+    LV_PROFILER_BEGIN(LV_PROFILER_FLUSH);
     drv->flush_cb(drv, &offset_area, color_p);
+    LV_PROFILER_END(LV_PROFILER_FLUSH);
 }
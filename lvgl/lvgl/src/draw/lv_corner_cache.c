@@ -0,0 +1,196 @@
+/**
+ * @file lv_corner_cache.c
+ *
+ */
+/* Copyright (c) 2022 Dialog Semiconductor */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_corner_cache.h"
+
+#if DLG_LVGL_USE_CORNER_CACHE
+
+#include "../hal/lv_hal_disp.h"
+#include "../misc/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Size of the memory of the corners in bytes, one byte per pixel*/
+#ifndef DLG_LVGL_CORNER_CACHE_SIZE
+    #define DLG_LVGL_CORNER_CACHE_SIZE          (16 * 1024)
+#endif
+
+/*Address of the memory, e.g. in QSPI RAM. 0: use a static array*/
+#ifndef DLG_LVGL_CORNER_CACHE_ADR
+    #define DLG_LVGL_CORNER_CACHE_ADR           0
+#endif
+
+/*Maximum number of cached corners*/
+#ifndef DLG_LVGL_CORNER_CACHE_ENTRIES
+    #define DLG_LVGL_CORNER_CACHE_ENTRIES       16
+#endif
+
+#define CORNER_ALIGN                            4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_opa_t * buf;             /*NULL: unused entry*/
+    uint32_t size;              /*Bytes, aligned to CORNER_ALIGN*/
+    uint32_t last_use;          /*Value of `use_cnt` when the corner was drawn last time*/
+    lv_coord_t r;
+    lv_coord_t width;
+} lv_corner_cache_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_opa_t * alloc_buf(uint32_t size);
+static void drop_entry(lv_corner_cache_entry_t * entry);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_corner_cache_entry_t entries[DLG_LVGL_CORNER_CACHE_ENTRIES];
+static lv_corner_cache_stat_t stat;
+static uint32_t use_cnt;
+#if DLG_LVGL_CORNER_CACHE_ADR == 0
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY uint32_t pool_int[DLG_LVGL_CORNER_CACHE_SIZE / sizeof(uint32_t)];
+    #define POOL                                ((uint8_t *)pool_int)
+#else
+    #define POOL                                ((uint8_t *)DLG_LVGL_CORNER_CACHE_ADR)
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const lv_opa_t * _lv_corner_cache_find(lv_coord_t r, lv_coord_t width)
+{
+    use_cnt++;
+
+    uint32_t i;
+    for(i = 0; i < DLG_LVGL_CORNER_CACHE_ENTRIES; i++) {
+        lv_corner_cache_entry_t * entry = &entries[i];
+        if(entry->buf && entry->r == r && entry->width == width) {
+            stat.hit_cnt++;
+            entry->last_use = use_cnt;
+            return entry->buf;
+        }
+    }
+
+    return NULL;
+}
+
+const lv_opa_t * _lv_corner_cache_add(lv_coord_t r, lv_coord_t width, const lv_opa_t * opa)
+{
+    uint32_t px_cnt = (uint32_t)(r + width) * (r + width);
+    uint32_t size = (px_cnt + CORNER_ALIGN - 1) & ~(CORNER_ALIGN - 1);
+    if(px_cnt == 0 || size > DLG_LVGL_CORNER_CACHE_SIZE) return NULL;
+
+    /*A free entry, or the least recently used one*/
+    lv_corner_cache_entry_t * entry = NULL;
+    uint32_t i;
+    for(i = 0; i < DLG_LVGL_CORNER_CACHE_ENTRIES; i++) {
+        if(entries[i].buf == NULL) {
+            entry = &entries[i];
+            break;
+        }
+        if(entry == NULL || use_cnt - entries[i].last_use > use_cnt - entry->last_use) entry = &entries[i];
+    }
+    if(entry->buf) {
+        drop_entry(entry);
+        stat.evict_cnt++;
+    }
+
+    lv_opa_t * buf = alloc_buf(size);
+    if(buf == NULL) return NULL;
+
+    lv_memcpy(buf, opa, px_cnt);
+    entry->buf = buf;
+    entry->size = size;
+    entry->last_use = use_cnt;
+    entry->r = r;
+    entry->width = width;
+
+    stat.miss_cnt++;
+    stat.size += size;
+    stat.entry_cnt++;
+    return buf;
+}
+
+void lv_corner_cache_invalidate(void)
+{
+    uint32_t i;
+    for(i = 0; i < DLG_LVGL_CORNER_CACHE_ENTRIES; i++) {
+        if(entries[i].buf) drop_entry(&entries[i]);
+    }
+}
+
+void lv_corner_cache_get_stat(lv_corner_cache_stat_t * stat_p)
+{
+    lv_memcpy_small(stat_p, &stat, sizeof(stat));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Take the first gap of `size` bytes between the cached corners, dropping the least recently used
+ * ones until there is one
+ */
+static lv_opa_t * alloc_buf(uint32_t size)
+{
+    while(1) {
+        uint8_t * start = POOL;
+        uint32_t i;
+        while(1) {
+            /*The corner stored next after `start`*/
+            lv_corner_cache_entry_t * next = NULL;
+            for(i = 0; i < DLG_LVGL_CORNER_CACHE_ENTRIES; i++) {
+                if(entries[i].buf && entries[i].buf >= start && (next == NULL || entries[i].buf < next->buf)) {
+                    next = &entries[i];
+                }
+            }
+
+            uint8_t * end = next ? next->buf : POOL + DLG_LVGL_CORNER_CACHE_SIZE;
+            if((uint32_t)(end - start) >= size) return start;
+            if(next == NULL) break;
+
+            start = next->buf + next->size;
+        }
+
+        lv_corner_cache_entry_t * lru = NULL;
+        for(i = 0; i < DLG_LVGL_CORNER_CACHE_ENTRIES; i++) {
+            if(entries[i].buf == NULL) continue;
+            if(lru == NULL || use_cnt - entries[i].last_use > use_cnt - lru->last_use) lru = &entries[i];
+        }
+
+        /*Nothing left to drop*/
+        if(lru == NULL) return NULL;
+
+        drop_entry(lru);
+        stat.evict_cnt++;
+    }
+}
+
+static void drop_entry(lv_corner_cache_entry_t * entry)
+{
+    /*The GPU might still read the corner*/
+    lv_disp_t * disp = lv_disp_get_default();
+    if(disp && disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+
+    stat.size -= entry->size;
+    stat.entry_cnt--;
+    lv_memset_00(entry, sizeof(lv_corner_cache_entry_t));
+}
+
+#endif /*DLG_LVGL_USE_CORNER_CACHE*/
@@ -0,0 +1,85 @@
+/**
+ * @file lv_corner_cache.h
+ *
+ */
+/* Copyright (c) 2022 Dialog Semiconductor */
+
+#ifndef LV_CORNER_CACHE_H
+#define LV_CORNER_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../misc/lv_color.h"
+#include "../misc/lv_area.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef DLG_LVGL_USE_CORNER_CACHE
+#define DLG_LVGL_USE_CORNER_CACHE 0
+#endif
+
+#if DLG_LVGL_USE_CORNER_CACHE
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Counters of the corner cache. They are never cleared, the user can compute the change between
+ * two readings.
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Corners found in the cache*/
+    uint32_t miss_cnt;      /**< Corners computed and added*/
+    uint32_t evict_cnt;     /**< Corners dropped to make room for other ones*/
+    uint32_t size;          /**< Bytes of the cached corners*/
+    uint32_t entry_cnt;     /**< Number of cached corners*/
+} lv_corner_cache_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Look up a blurred shadow corner, `r + width` x `r + width` 8-bit opacities of the top right corner
+ * that the GPU can blit as an A8 texture.
+ * @param r the radius of the corner
+ * @param width the blur width of the shadow
+ * @return the opacities of the corner or NULL if it is not cached
+ */
+const lv_opa_t * _lv_corner_cache_find(lv_coord_t r, lv_coord_t width);
+
+/**
+ * Copy a computed corner mask into the cache. It might drop other corners: the opacities returned by
+ * the previous calls are valid only until this one, so the blits using them have to be started before.
+ * @param r the radius of the corner
+ * @param width the blur width of the shadow
+ * @param opa the opacities of the corner, `size` x `size` with `size` = `r + width`
+ * @return the cached opacities or NULL if the corner is larger than the cache
+ */
+const lv_opa_t * _lv_corner_cache_add(lv_coord_t r, lv_coord_t width, const lv_opa_t * opa);
+
+/**
+ * Drop all the cached corners
+ */
+void lv_corner_cache_invalidate(void);
+
+/**
+ * Get the counters of the corner cache
+ * @param stat the counters are copied here
+ */
+void lv_corner_cache_get_stat(lv_corner_cache_stat_t * stat);
+
+#endif /*DLG_LVGL_USE_CORNER_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_CORNER_CACHE_H*/
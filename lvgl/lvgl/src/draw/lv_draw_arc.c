@@ -2,6 +2,7 @@
  * @file lv_draw_arc.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -12,6 +13,9 @@
 #include "../misc/lv_math.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_mem.h"
+#include "../hal/lv_hal_disp.h"
+#include "../core/lv_refr.h"
+#include "../misc/lv_profiler.h"
 
 /*********************
  *      DEFINES
@@ -45,6 +49,11 @@ typedef struct {
     static void draw_quarter_2(quarter_draw_dsc_t * q);
     static void draw_quarter_3(quarter_draw_dsc_t * q);
     static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness, lv_area_t * res_area);
+#if DLG_LVGL_USE_GPU_DA1470X
+    static bool draw_arc_gpu(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, uint16_t start_angle,
+                             uint16_t end_angle, lv_coord_t width, const lv_area_t * clip_area,
+                             const lv_draw_arc_dsc_t * dsc);
+#endif
 #endif /*LV_DRAW_COMPLEX*/
 
 /**********************
@@ -78,6 +87,14 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uin
     lv_coord_t width = dsc->width;
     if(width > radius) width = radius;
 
+    LV_PROFILER_BEGIN(LV_PROFILER_DRAW_ARC);
+#if DLG_LVGL_USE_GPU_DA1470X
+    if(dsc->img_src == NULL && draw_arc_gpu(center_x, center_y, radius, start_angle, end_angle, width, clip_area, dsc)) {
+        LV_PROFILER_END(LV_PROFILER_DRAW_ARC);
+        return;
+    }
+#endif
+
     lv_draw_rect_dsc_t cir_dsc;
     lv_draw_rect_dsc_init(&cir_dsc);
     cir_dsc.blend_mode = dsc->blend_mode;
@@ -123,6 +140,7 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uin
 
         lv_draw_mask_remove_id(mask_out_id);
         if(mask_in_id != LV_MASK_ID_INV) lv_draw_mask_remove_id(mask_in_id);
+        LV_PROFILER_END(LV_PROFILER_DRAW_ARC);
         return;
     }
 
@@ -206,6 +224,7 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uin
             lv_draw_mask_free_param(&mask_end_param);
         }
     }
+    LV_PROFILER_END(LV_PROFILER_DRAW_ARC);
 #else
     LV_LOG_WARN("Can't draw arc with LV_DRAW_COMPLEX == 0");
     LV_UNUSED(center_x);
@@ -566,4 +585,58 @@ static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness
     }
 }
 
+#if DLG_LVGL_USE_GPU_DA1470X
+/**
+ * Draw an arc with the shape primitives of the GPU: a ring, or a wedge of it, and two circles
+ * for the rounded ends, instead of three masks on every line
+ * @return false if the arc has to be drawn with masks
+ */
+static bool draw_arc_gpu(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, uint16_t start_angle,
+                         uint16_t end_angle, lv_coord_t width, const lv_area_t * clip_area,
+                         const lv_draw_arc_dsc_t * dsc)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_drv_t * drv = disp->driver;
+    if(drv->gpu_draw_shape_cb == NULL || drv->set_px_cb || dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+
+    lv_area_t area_out;
+    lv_area_set(&area_out, center_x - radius, center_y - radius, center_x + radius - 1, center_y + radius - 1);
+    if(lv_draw_mask_is_any(&area_out)) return false;
+
+    lv_area_t clip;
+    if(!_lv_area_intersect(&clip, clip_area, &area_out)) return true;
+
+    lv_gpu_shape_t shape;
+    lv_memset_00(&shape, sizeof(shape));
+    shape.type = LV_GPU_SHAPE_ARC;
+    shape.round_start = dsc->rounded;
+    shape.round_end = dsc->rounded;
+    shape.width = width;
+    shape.radius = radius;
+
+    /*The GPU takes the end angle after the start angle*/
+    if(start_angle + 360 == end_angle || start_angle == end_angle + 360) {
+        shape.start_angle = 0;
+        shape.end_angle = 360;
+    }
+    else {
+        while(start_angle >= 360) start_angle -= 360;
+        while(end_angle >= 360) end_angle -= 360;
+        shape.start_angle = start_angle;
+        shape.end_angle = end_angle > start_angle ? end_angle : end_angle + 360;
+    }
+
+    /*Relative to the draw buffer*/
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
+    const lv_area_t * disp_area = &draw_buf->area;
+    shape.center.x = center_x - disp_area->x1;
+    shape.center.y = center_y - disp_area->y1;
+    lv_area_move(&clip, -disp_area->x1, -disp_area->y1);
+
+    if(drv->gpu_wait_cb) drv->gpu_wait_cb(drv);
+    return drv->gpu_draw_shape_cb(drv, draw_buf->buf_act, lv_area_get_width(disp_area), &clip, &shape,
+                                  dsc->color, dsc->opa);
+}
+#endif /*DLG_LVGL_USE_GPU_DA1470X*/
+
 #endif /*LV_DRAW_COMPLEX*/
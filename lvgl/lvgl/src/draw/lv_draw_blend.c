@@ -2,11 +2,13 @@
  * @file lv_draw_blend.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
  *********************/
 #include "lv_draw_blend.h"
+#include "lv_draw_blend_simd.h"
 #include "lv_img_decoder.h"
 #include "../misc/lv_math.h"
 #include "../hal/lv_hal_disp.h"
@@ -510,6 +512,18 @@ static void fill_blended(const lv_area_t * disp_area, lv_color_t * disp_buf,  co
     /*Create a temp. disp_buf which always point to current line to draw*/
     lv_color_t * disp_buf_tmp = disp_buf + disp_w * draw_area->y1;
 
+#if LV_BLEND_SIMD
+    /*Get the width of the `draw_area` it will be used to go to the next line of the mask*/
+    int32_t draw_area_w = lv_area_get_width(draw_area);
+    const lv_opa_t * mask_tmp = mask_res == LV_DRAW_MASK_RES_FULL_COVER ? NULL : mask;
+    int32_t y;
+
+    for(y = draw_area->y1; y <= draw_area->y2; y++) {
+        _lv_blend_simd_fill(&disp_buf_tmp[draw_area->x1], draw_area_w, color, mask_tmp, opa, mode);
+        disp_buf_tmp += disp_w;
+        if(mask_tmp) mask_tmp += draw_area_w;
+    }
+#else
     lv_color_t (*blend_fp)(lv_color_t, lv_color_t, lv_opa_t);
     switch(mode) {
         case LV_BLEND_MODE_ADDITIVE:
@@ -529,7 +543,7 @@ static void fill_blended(const lv_area_t * disp_area, lv_color_t * disp_buf,  co
     /*Simple fill (maybe with opacity), no masking*/
     if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
         lv_color_t last_dest_color = lv_color_black();
-        lv_color_t last_res_color = lv_color_mix(color, last_dest_color, opa);
+        lv_color_t last_res_color = blend_fp(color, last_dest_color, opa);
         for(y = draw_area->y1; y <= draw_area->y2; y++) {
             for(x = draw_area->x1; x <= draw_area->x2; x++) {
                 if(last_dest_color.full != disp_buf_tmp[x].full) {
@@ -574,6 +588,7 @@ static void fill_blended(const lv_area_t * disp_area, lv_color_t * disp_buf,  co
             mask_tmp += draw_area_w;
         }
     }
+#endif
 }
 #endif
 #endif // LV_USE_GPU_SDL_RENDER
@@ -768,6 +783,13 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
 
             /*Software rendering*/
 
+#if LV_BLEND_SIMD
+            for(y = 0; y < draw_area_h; y++) {
+                _lv_blend_simd_map(disp_buf_first, map_buf_first, draw_area_w, NULL, opa, LV_BLEND_MODE_NORMAL);
+                disp_buf_first += disp_w;
+                map_buf_first += map_w;
+            }
+#else
             for(y = 0; y < draw_area_h; y++) {
                 for(x = 0; x < draw_area_w; x++) {
 #if LV_COLOR_SCREEN_TRANSP
@@ -784,6 +806,7 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
                 disp_buf_first += disp_w;
                 map_buf_first += map_w;
             }
+#endif
         }
     }
     /*Masked*/
@@ -846,6 +869,14 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
         }
         /*Handle opa and mask values too*/
         else {
+#if LV_BLEND_SIMD
+            for(y = 0; y < draw_area_h; y++) {
+                _lv_blend_simd_map(disp_buf_first, map_buf_first, draw_area_w, mask, opa, LV_BLEND_MODE_NORMAL);
+                disp_buf_first += disp_w;
+                mask += draw_area_w;
+                map_buf_first += map_w;
+            }
+#else
             for(y = 0; y < draw_area_h; y++) {
                 for(x = 0; x < draw_area_w; x++) {
                     if(mask[x]) {
@@ -866,6 +897,7 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
                 mask += draw_area_w;
                 map_buf_first += map_w;
             }
+#endif
         }
     }
 }
@@ -890,6 +922,20 @@ static void map_blended(const lv_area_t * disp_area, lv_color_t * disp_buf,  con
     /*Create a temp. map_buf which always point to current line to draw*/
     const lv_color_t * map_buf_tmp = map_buf + map_w * (draw_area->y1 - (map_area->y1 - disp_area->y1));
 
+#if LV_BLEND_SIMD
+    const lv_opa_t * mask_tmp = mask_res == LV_DRAW_MASK_RES_FULL_COVER ? NULL : mask;
+    int32_t y;
+
+    /*Go to the first px of the row*/
+    map_buf_tmp += (draw_area->x1 - (map_area->x1 - disp_area->x1));
+
+    for(y = draw_area->y1; y <= draw_area->y2; y++) {
+        _lv_blend_simd_map(&disp_buf_tmp[draw_area->x1], map_buf_tmp, draw_area_w, mask_tmp, opa, mode);
+        disp_buf_tmp += disp_w;
+        map_buf_tmp += map_w;
+        if(mask_tmp) mask_tmp += draw_area_w;
+    }
+#else
     lv_color_t (*blend_fp)(lv_color_t, lv_color_t, lv_opa_t);
     switch(mode) {
         case LV_BLEND_MODE_ADDITIVE:
@@ -929,6 +975,8 @@ static void map_blended(const lv_area_t * disp_area, lv_color_t * disp_buf,  con
          *but it corresponds to zero index. So prepare `mask_tmp` accordingly.*/
         const lv_opa_t * mask_tmp = mask - draw_area->x1;
 
+        /*Go to the first px of the row and compensate the indexing from `draw_area->x1`*/
+        map_buf_tmp += (draw_area->x1 - (map_area->x1 - disp_area->x1));
         map_buf_tmp -= draw_area->x1;
         for(y = draw_area->y1; y <= draw_area->y2; y++) {
             for(x = draw_area->x1; x <= draw_area->x2; x++) {
@@ -941,6 +989,7 @@ static void map_blended(const lv_area_t * disp_area, lv_color_t * disp_buf,  con
             map_buf_tmp += map_w;
         }
     }
+#endif
 }
 
 static inline lv_color_t color_blend_true_color_additive(lv_color_t fg, lv_color_t bg, lv_opa_t opa)
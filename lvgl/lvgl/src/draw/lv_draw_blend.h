@@ -38,9 +38,9 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
 LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_area_t * map_area,
                                          const lv_color_t * map_buf,
                                          lv_opa_t * mask, lv_draw_mask_res_t mask_res, lv_opa_t opa, lv_blend_mode_t mode
-#if (DLG_LVGL_CF == 1)
+#if (DLG_LVGL_CF == 1) && LV_USE_EXTERNAL_RENDERER
                                           , uint32_t cf
-#endif /* DLG_LVGL_CF */
+#endif /* DLG_LVGL_CF && LV_USE_EXTERNAL_RENDERER */
                                           );
 
 //! @endcond
@@ -0,0 +1,388 @@
+/**
+ * @file lv_draw_blend_simd.c
+ *
+ * Vectorized row kernels of the software blending. They compute the same result as the scalar
+ * loops of `lv_draw_blend.c` (including `lv_color_mix()` rounding), only more pixels at a time:
+ * - SSE2 / NEON: 8 RGB565 or 4 (SSE2) / 8 (NEON) ARGB8888 pixels per iteration
+ * - Cortex-M33 DSP: byte-lane saturating add/subtract and a SWAR color mix, one pixel per iteration
+ */
+/* Copyright (c) 2022 Dialog Semiconductor */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_blend_simd.h"
+
+#if LV_BLEND_SIMD != LV_BLEND_SIMD_NONE
+
+#include "../misc/lv_math.h"
+
+#if LV_BLEND_SIMD == LV_BLEND_SIMD_SSE2
+    #include <string.h>
+    #include <emmintrin.h>
+#elif LV_BLEND_SIMD == LV_BLEND_SIMD_NEON
+    #include <arm_neon.h>
+#elif LV_BLEND_SIMD == LV_BLEND_SIMD_ARM_DSP
+    #include <arm_acle.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Pixels processed by one `blend_block()` call*/
+#if LV_BLEND_SIMD == LV_BLEND_SIMD_SSE2
+    #define BLOCK_PX    (LV_COLOR_DEPTH == 16 ? 8 : 4)
+#elif LV_BLEND_SIMD == LV_BLEND_SIMD_NEON
+    #define BLOCK_PX    8
+#else
+    #define BLOCK_PX    1
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static inline lv_color_t blend_px(lv_color_t fg, lv_color_t bg, lv_opa_t mask, lv_opa_t opa,
+                                  lv_blend_mode_t mode);
+#if BLOCK_PX > 1
+static inline void blend_block(lv_color_t * dest, const lv_color_t * src, bool fill, const lv_opa_t * mask,
+                               lv_opa_t opa, lv_blend_mode_t mode);
+#endif
+static inline void blend_row(lv_color_t * dest, const lv_color_t * src, bool fill, int32_t len,
+                             const lv_opa_t * mask, lv_opa_t opa, lv_blend_mode_t mode);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+LV_ATTRIBUTE_FAST_MEM void _lv_blend_simd_fill(lv_color_t * dest, int32_t len, lv_color_t color,
+                                               const lv_opa_t * mask, lv_opa_t opa, lv_blend_mode_t mode)
+{
+    blend_row(dest, &color, true, len, mask, opa, mode);
+}
+
+LV_ATTRIBUTE_FAST_MEM void _lv_blend_simd_map(lv_color_t * dest, const lv_color_t * src, int32_t len,
+                                              const lv_opa_t * mask, lv_opa_t opa, lv_blend_mode_t mode)
+{
+    blend_row(dest, src, false, len, mask, opa, mode);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*Saturating additive and subtractive color operations, the alpha of `fg` is kept*/
+static inline lv_color_t blend_op(lv_color_t fg, lv_color_t bg, lv_blend_mode_t mode)
+{
+#if LV_BLEND_SIMD == LV_BLEND_SIMD_ARM_DSP
+#if LV_COLOR_DEPTH == 16
+    /*Move the channels to the top of byte lanes so that 8-bit saturation is channel saturation*/
+    uint32_t f = ((fg.full & 0x001FU) << 3) | ((fg.full & 0x07E0U) << 5) | ((uint32_t)(fg.full & 0xF800U) << 8);
+    uint32_t b = ((bg.full & 0x001FU) << 3) | ((bg.full & 0x07E0U) << 5) | ((uint32_t)(bg.full & 0xF800U) << 8);
+    uint32_t r = mode == LV_BLEND_MODE_ADDITIVE ? __uqadd8(f, b) : __uqsub8(b, f);
+
+    fg.full = ((r >> 3) & 0x001FU) | ((r >> 5) & 0x07E0U) | ((r >> 8) & 0xF800U);
+#else
+    uint32_t r = mode == LV_BLEND_MODE_ADDITIVE ? __uqadd8(fg.full, bg.full) : __uqsub8(bg.full, fg.full);
+
+    fg.full = (r & 0x00FFFFFFU) | (fg.full & 0xFF000000U);
+#endif
+#else
+#if LV_COLOR_DEPTH == 16
+    const int32_t max_rb = 31, max_g = 63;
+#else
+    const int32_t max_rb = 255, max_g = 255;
+#endif
+    int32_t r, g, b;
+    if(mode == LV_BLEND_MODE_ADDITIVE) {
+        r = LV_MIN(LV_COLOR_GET_R(fg) + LV_COLOR_GET_R(bg), max_rb);
+        g = LV_MIN(LV_COLOR_GET_G(fg) + LV_COLOR_GET_G(bg), max_g);
+        b = LV_MIN(LV_COLOR_GET_B(fg) + LV_COLOR_GET_B(bg), max_rb);
+    }
+    else {
+        r = LV_MAX(LV_COLOR_GET_R(bg) - LV_COLOR_GET_R(fg), 0);
+        g = LV_MAX(LV_COLOR_GET_G(bg) - LV_COLOR_GET_G(fg), 0);
+        b = LV_MAX(LV_COLOR_GET_B(bg) - LV_COLOR_GET_B(fg), 0);
+    }
+    LV_COLOR_SET_R(fg, r);
+    LV_COLOR_SET_G(fg, g);
+    LV_COLOR_SET_B(fg, b);
+#endif
+    return fg;
+}
+
+static inline lv_color_t color_mix(lv_color_t fg, lv_color_t bg, lv_opa_t mix)
+{
+#if LV_BLEND_SIMD == LV_BLEND_SIMD_ARM_DSP && LV_COLOR_DEPTH == 32
+    /*lv_color_mix() with red/blue and green in 16-bit lanes, LV_UDIV255(x) == (x + 1 + (x >> 8)) >> 8*/
+    uint32_t rb = (fg.full & 0x00FF00FFU) * mix + (bg.full & 0x00FF00FFU) * (255 - mix);
+    uint32_t g = ((fg.full >> 8) & 0xFFU) * mix + ((bg.full >> 8) & 0xFFU) * (255 - mix);
+
+    rb = ((rb + 0x00010001U + ((rb >> 8) & 0x00FF00FFU)) >> 8) & 0x00FF00FFU;
+    g = (g + 1 + (g >> 8)) >> 8;
+    fg.full = 0xFF000000U | rb | (g << 8);
+    return fg;
+#else
+    return lv_color_mix(fg, bg, mix);
+#endif
+}
+
+/**
+ * Blend one pixel like the scalar blending loops do.
+ * NORMAL: skipped if the mask is 0, otherwise mixed with the scaled opacity.
+ * ADDITIVE/SUBTRACTIVE: skipped at or below LV_OPA_MIN, not mixed at LV_OPA_COVER.
+ */
+LV_ATTRIBUTE_FAST_MEM static inline lv_color_t blend_px(lv_color_t fg, lv_color_t bg, lv_opa_t mask, lv_opa_t opa,
+                                                        lv_blend_mode_t mode)
+{
+    if(mask == LV_OPA_TRANSP) return bg;
+    if(mask < LV_OPA_MAX) opa = ((uint32_t)mask * opa) >> 8;
+
+    if(mode != LV_BLEND_MODE_NORMAL) {
+        if(opa <= LV_OPA_MIN) return bg;
+        fg = blend_op(fg, bg, mode);
+        if(opa == LV_OPA_COVER) return fg;
+    }
+
+    return color_mix(fg, bg, opa);
+}
+
+#if BLOCK_PX > 1
+static inline bool block_transp(const lv_opa_t * mask)
+{
+    int32_t i;
+    for(i = 0; i < BLOCK_PX; i++) {
+        if(mask[i]) return false;
+    }
+    return true;
+}
+#endif
+
+LV_ATTRIBUTE_FAST_MEM static inline void blend_row(lv_color_t * dest, const lv_color_t * src, bool fill, int32_t len,
+                                                   const lv_opa_t * mask, lv_opa_t opa, lv_blend_mode_t mode)
+{
+    int32_t i = 0;
+
+#if BLOCK_PX > 1
+    for(; i + BLOCK_PX <= len; i += BLOCK_PX) {
+        if(mask && block_transp(&mask[i])) continue;
+        blend_block(&dest[i], fill ? src : &src[i], fill, mask ? &mask[i] : NULL, opa, mode);
+    }
+#endif
+
+    for(; i < len; i++) {
+        dest[i] = blend_px(fill ? src[0] : src[i], dest[i], mask ? mask[i] : LV_OPA_COVER, opa, mode);
+    }
+}
+
+#if LV_BLEND_SIMD == LV_BLEND_SIMD_SSE2
+
+/*Opacity of each pixel in 16-bit lanes: `opa` if the mask is >= LV_OPA_MAX, `mask * opa >> 8` otherwise*/
+static inline __m128i scale_opa(__m128i m, __m128i opa)
+{
+    __m128i full = _mm_cmpgt_epi16(m, _mm_set1_epi16(LV_OPA_MAX - 1));
+    __m128i scaled = _mm_srli_epi16(_mm_mullo_epi16(m, opa), 8);
+    return _mm_or_si128(_mm_and_si128(full, opa), _mm_andnot_si128(full, scaled));
+}
+
+static inline __m128i sel_si128(__m128i sel, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(sel, a), _mm_andnot_si128(sel, b));
+}
+
+#if LV_COLOR_DEPTH == 16
+LV_ATTRIBUTE_FAST_MEM static inline void blend_block(lv_color_t * dest, const lv_color_t * src, bool fill,
+                                                     const lv_opa_t * mask, lv_opa_t opa, lv_blend_mode_t mode)
+{
+    const __m128i c5 = _mm_set1_epi16(0x1F);
+    const __m128i c6 = _mm_set1_epi16(0x3F);
+    __m128i opa_v = _mm_set1_epi16(opa);
+    __m128i bg = _mm_loadu_si128((const __m128i *)dest);
+    __m128i fg = fill ? _mm_set1_epi16(src->full) : _mm_loadu_si128((const __m128i *)src);
+    __m128i eff = opa_v;
+
+    if(mask) eff = scale_opa(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)mask), _mm_setzero_si128()), opa_v);
+
+    __m128i fr = _mm_srli_epi16(fg, 11);
+    __m128i fgr = _mm_and_si128(_mm_srli_epi16(fg, 5), c6);
+    __m128i fb = _mm_and_si128(fg, c5);
+    __m128i br = _mm_srli_epi16(bg, 11);
+    __m128i bgr = _mm_and_si128(_mm_srli_epi16(bg, 5), c6);
+    __m128i bb = _mm_and_si128(bg, c5);
+
+    if(mode == LV_BLEND_MODE_ADDITIVE) {
+        fr = _mm_min_epi16(_mm_add_epi16(fr, br), c5);
+        fgr = _mm_min_epi16(_mm_add_epi16(fgr, bgr), c6);
+        fb = _mm_min_epi16(_mm_add_epi16(fb, bb), c5);
+    }
+    else if(mode == LV_BLEND_MODE_SUBTRACTIVE) {
+        fr = _mm_subs_epu16(br, fr);
+        fgr = _mm_subs_epu16(bgr, fgr);
+        fb = _mm_subs_epu16(bb, fb);
+    }
+
+    /*lv_color_mix() per channel: bg + ((fg - bg) * ((opa + 4) >> 3) >> 5). It is a no-op below
+     *opacity 4 and a copy at LV_OPA_COVER, so the skip rules of `blend_px()` need no extra select.*/
+    __m128i mix = _mm_srli_epi16(_mm_add_epi16(eff, _mm_set1_epi16(4)), 3);
+    fr = _mm_add_epi16(br, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fr, br), mix), 5));
+    fgr = _mm_add_epi16(bgr, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fgr, bgr), mix), 5));
+    fb = _mm_add_epi16(bb, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fb, bb), mix), 5));
+
+    __m128i res = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(fr, 11), _mm_slli_epi16(fgr, 5)), fb);
+    _mm_storeu_si128((__m128i *)dest, res);
+}
+#else
+/*Mix 2 pixels in 16-bit lanes, `e` holds the opacity of each lane*/
+static inline __m128i mix_2px(__m128i fg, __m128i bg, __m128i e)
+{
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(fg, e), _mm_mullo_epi16(bg, _mm_sub_epi16(_mm_set1_epi16(255), e)));
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_set1_epi16(1)), _mm_srli_epi16(t, 8)), 8);
+}
+
+LV_ATTRIBUTE_FAST_MEM static inline void blend_block(lv_color_t * dest, const lv_color_t * src, bool fill,
+                                                     const lv_opa_t * mask, lv_opa_t opa, lv_blend_mode_t mode)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha = _mm_set1_epi32((int32_t)0xFF000000);
+    __m128i opa_v = _mm_set1_epi16(opa);
+    __m128i bg = _mm_loadu_si128((const __m128i *)dest);
+    __m128i fg = fill ? _mm_set1_epi32((int32_t)src->full) : _mm_loadu_si128((const __m128i *)src);
+    __m128i m = _mm_set1_epi16(LV_OPA_COVER);
+    __m128i eff = opa_v;
+
+    if(mask) {
+        uint32_t m32;
+        memcpy(&m32, mask, sizeof(m32));
+        m = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int32_t)m32), zero);
+        eff = scale_opa(m, opa_v);
+    }
+
+    __m128i op = fg;
+    if(mode == LV_BLEND_MODE_ADDITIVE) op = _mm_adds_epu8(fg, bg);
+    else if(mode == LV_BLEND_MODE_SUBTRACTIVE) op = _mm_subs_epu8(bg, fg);
+    op = sel_si128(alpha, fg, op);
+
+    /*Spread the opacity of the 4 pixels to their channels*/
+    __m128i e = _mm_unpacklo_epi16(eff, eff);
+    __m128i lo = mix_2px(_mm_unpacklo_epi8(op, zero), _mm_unpacklo_epi8(bg, zero), _mm_unpacklo_epi32(e, e));
+    __m128i hi = mix_2px(_mm_unpackhi_epi8(op, zero), _mm_unpackhi_epi8(bg, zero), _mm_unpackhi_epi32(e, e));
+    __m128i res = _mm_or_si128(_mm_packus_epi16(lo, hi), alpha);
+
+    __m128i e32 = _mm_unpacklo_epi16(eff, zero);
+    __m128i keep = _mm_cmpeq_epi32(_mm_unpacklo_epi16(m, zero), zero);
+    if(mode != LV_BLEND_MODE_NORMAL) {
+        res = sel_si128(_mm_cmpeq_epi32(e32, _mm_set1_epi32(LV_OPA_COVER)), op, res);
+        keep = _mm_or_si128(keep, _mm_cmplt_epi32(e32, _mm_set1_epi32(LV_OPA_MIN + 1)));
+    }
+    _mm_storeu_si128((__m128i *)dest, sel_si128(keep, bg, res));
+}
+#endif
+
+#elif LV_BLEND_SIMD == LV_BLEND_SIMD_NEON
+
+/*Opacity of each pixel in 16-bit lanes: `opa` if the mask is >= LV_OPA_MAX, `mask * opa >> 8` otherwise*/
+static inline uint16x8_t scale_opa(uint16x8_t m, uint16x8_t opa)
+{
+    uint16x8_t scaled = vshrq_n_u16(vmulq_u16(m, opa), 8);
+    return vbslq_u16(vcgeq_u16(m, vdupq_n_u16(LV_OPA_MAX)), opa, scaled);
+}
+
+#if LV_COLOR_DEPTH == 16
+static inline uint16x8_t mix_ch(uint16x8_t fg, uint16x8_t bg, int16x8_t mix)
+{
+    int16x8_t d = vsubq_s16(vreinterpretq_s16_u16(fg), vreinterpretq_s16_u16(bg));
+    return vreinterpretq_u16_s16(vaddq_s16(vreinterpretq_s16_u16(bg), vshrq_n_s16(vmulq_s16(d, mix), 5)));
+}
+
+LV_ATTRIBUTE_FAST_MEM static inline void blend_block(lv_color_t * dest, const lv_color_t * src, bool fill,
+                                                     const lv_opa_t * mask, lv_opa_t opa, lv_blend_mode_t mode)
+{
+    const uint16x8_t c5 = vdupq_n_u16(0x1F);
+    const uint16x8_t c6 = vdupq_n_u16(0x3F);
+    uint16x8_t opa_v = vdupq_n_u16(opa);
+    uint16x8_t bg = vld1q_u16((const uint16_t *)dest);
+    uint16x8_t fg = fill ? vdupq_n_u16(src->full) : vld1q_u16((const uint16_t *)src);
+    uint16x8_t eff = mask ? scale_opa(vmovl_u8(vld1_u8(mask)), opa_v) : opa_v;
+
+    uint16x8_t fr = vshrq_n_u16(fg, 11);
+    uint16x8_t fgr = vandq_u16(vshrq_n_u16(fg, 5), c6);
+    uint16x8_t fb = vandq_u16(fg, c5);
+    uint16x8_t br = vshrq_n_u16(bg, 11);
+    uint16x8_t bgr = vandq_u16(vshrq_n_u16(bg, 5), c6);
+    uint16x8_t bb = vandq_u16(bg, c5);
+
+    if(mode == LV_BLEND_MODE_ADDITIVE) {
+        fr = vminq_u16(vaddq_u16(fr, br), c5);
+        fgr = vminq_u16(vaddq_u16(fgr, bgr), c6);
+        fb = vminq_u16(vaddq_u16(fb, bb), c5);
+    }
+    else if(mode == LV_BLEND_MODE_SUBTRACTIVE) {
+        fr = vqsubq_u16(br, fr);
+        fgr = vqsubq_u16(bgr, fgr);
+        fb = vqsubq_u16(bb, fb);
+    }
+
+    /*See the SSE2 version about the skip rules*/
+    int16x8_t mix = vreinterpretq_s16_u16(vshrq_n_u16(vaddq_u16(eff, vdupq_n_u16(4)), 3));
+    fr = mix_ch(fr, br, mix);
+    fgr = mix_ch(fgr, bgr, mix);
+    fb = mix_ch(fb, bb, mix);
+
+    vst1q_u16((uint16_t *)dest, vorrq_u16(vorrq_u16(vshlq_n_u16(fr, 11), vshlq_n_u16(fgr, 5)), fb));
+}
+#else
+static inline uint8x8_t mix_ch(uint8x8_t fg, uint8x8_t bg, uint8x8_t e)
+{
+    uint16x8_t t = vmlal_u8(vmull_u8(fg, e), bg, vmvn_u8(e));
+    return vshrn_n_u16(vaddq_u16(t, vaddq_u16(vdupq_n_u16(1), vshrq_n_u16(t, 8))), 8);
+}
+
+LV_ATTRIBUTE_FAST_MEM static inline void blend_block(lv_color_t * dest, const lv_color_t * src, bool fill,
+                                                     const lv_opa_t * mask, lv_opa_t opa, lv_blend_mode_t mode)
+{
+    uint8x8x4_t bg = vld4_u8((const uint8_t *)dest);
+    uint8x8x4_t fg;
+    uint8x8x4_t res;
+    uint8x8_t m = vdup_n_u8(LV_OPA_COVER);
+    uint8x8_t e = vdup_n_u8(opa);
+    int32_t c;
+
+    if(fill) {
+        fg.val[0] = vdup_n_u8(src->ch.blue);
+        fg.val[1] = vdup_n_u8(src->ch.green);
+        fg.val[2] = vdup_n_u8(src->ch.red);
+        fg.val[3] = vdup_n_u8(src->ch.alpha);
+    }
+    else {
+        fg = vld4_u8((const uint8_t *)src);
+    }
+
+    if(mask) {
+        m = vld1_u8(mask);
+        e = vmovn_u16(scale_opa(vmovl_u8(m), vdupq_n_u16(opa)));
+    }
+
+    uint8x8_t keep = vceq_u8(m, vdup_n_u8(0));
+    uint8x8_t cover = vceq_u8(e, vdup_n_u8(LV_OPA_COVER));
+    if(mode != LV_BLEND_MODE_NORMAL) keep = vorr_u8(keep, vcle_u8(e, vdup_n_u8(LV_OPA_MIN)));
+
+    for(c = 0; c < 3; c++) {
+        uint8x8_t op = fg.val[c];
+        if(mode == LV_BLEND_MODE_ADDITIVE) op = vqadd_u8(fg.val[c], bg.val[c]);
+        else if(mode == LV_BLEND_MODE_SUBTRACTIVE) op = vqsub_u8(bg.val[c], fg.val[c]);
+
+        uint8x8_t r = mix_ch(op, bg.val[c], e);
+        if(mode != LV_BLEND_MODE_NORMAL) r = vbsl_u8(cover, op, r);
+        res.val[c] = vbsl_u8(keep, bg.val[c], r);
+    }
+
+    uint8x8_t a = vdup_n_u8(0xFF);
+    if(mode != LV_BLEND_MODE_NORMAL) a = vbsl_u8(cover, fg.val[3], a);
+    res.val[3] = vbsl_u8(keep, bg.val[3], a);
+
+    vst4_u8((uint8_t *)dest, res);
+}
+#endif
+
+#endif /*LV_BLEND_SIMD*/
+
+#endif /*LV_BLEND_SIMD != LV_BLEND_SIMD_NONE*/
@@ -0,0 +1,80 @@
+/**
+ * @file lv_draw_blend_simd.h
+ *
+ */
+/* Copyright (c) 2022 Dialog Semiconductor */
+
+#ifndef LV_DRAW_BLEND_SIMD_H
+#define LV_DRAW_BLEND_SIMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../misc/lv_color.h"
+#include "../misc/lv_style.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef DLG_LVGL_USE_BLEND_SIMD
+#define DLG_LVGL_USE_BLEND_SIMD 0
+#endif
+
+#define LV_BLEND_SIMD_NONE      0
+#define LV_BLEND_SIMD_SSE2      1   /*x86-64 host builds*/
+#define LV_BLEND_SIMD_NEON      2   /*ARM hosts*/
+#define LV_BLEND_SIMD_ARM_DSP   3   /*Cortex-M33 with the DSP extension*/
+
+/*Kernel set, selected at compile time. Only RGB565 (not swapped) and ARGB8888 without screen
+ *transparency are vectorized, the other configurations keep the scalar loops.*/
+#if DLG_LVGL_USE_BLEND_SIMD == 0 || LV_COLOR_SCREEN_TRANSP || \
+    !((LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0) || LV_COLOR_DEPTH == 32)
+#define LV_BLEND_SIMD           LV_BLEND_SIMD_NONE
+#elif defined(__SSE2__)
+#define LV_BLEND_SIMD           LV_BLEND_SIMD_SSE2
+#elif defined(__ARM_NEON)
+#define LV_BLEND_SIMD           LV_BLEND_SIMD_NEON
+#elif defined(__ARM_FEATURE_SIMD32)
+#define LV_BLEND_SIMD           LV_BLEND_SIMD_ARM_DSP
+#else
+#define LV_BLEND_SIMD           LV_BLEND_SIMD_NONE
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_BLEND_SIMD != LV_BLEND_SIMD_NONE
+//! @cond Doxygen_Suppress
+/**
+ * Blend a color into a row of the display buffer.
+ * The result is identical to the scalar blending of `lv_draw_blend.c`.
+ * @param dest first pixel of the row
+ * @param len number of pixels
+ * @param color fill color
+ * @param mask A8 mask of the row or NULL if the row is fully covered.
+ *             Mask values >= LV_OPA_MAX use `opa`, the others are scaled by it.
+ * @param opa overall opacity
+ * @param mode LV_BLEND_MODE_NORMAL, LV_BLEND_MODE_ADDITIVE or LV_BLEND_MODE_SUBTRACTIVE
+ */
+LV_ATTRIBUTE_FAST_MEM void _lv_blend_simd_fill(lv_color_t * dest, int32_t len, lv_color_t color,
+                                               const lv_opa_t * mask, lv_opa_t opa, lv_blend_mode_t mode);
+
+/**
+ * Blend a row of pixels into a row of the display buffer.
+ * Same as `_lv_blend_simd_fill()` but the colors are taken from `src`.
+ */
+LV_ATTRIBUTE_FAST_MEM void _lv_blend_simd_map(lv_color_t * dest, const lv_color_t * src, int32_t len,
+                                              const lv_opa_t * mask, lv_opa_t opa, lv_blend_mode_t mode);
+//! @endcond
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_BLEND_SIMD_H*/
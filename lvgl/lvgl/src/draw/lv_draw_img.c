@@ -14,6 +14,7 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
+#include "../misc/lv_profiler.h"
 #if LV_USE_GPU_STM32_DMA2D
     #include "../gpu/lv_gpu_stm32_dma2d.h"
 #elif LV_USE_GPU_NXP_PXP
@@ -85,7 +86,9 @@ void lv_draw_img(const lv_area_t * coords, const lv_area_t * mask, const void *
     if(dsc->opa <= LV_OPA_MIN) return;
 
     lv_res_t res;
+    LV_PROFILER_BEGIN(LV_PROFILER_DRAW_IMG);
     res = lv_img_draw_core(coords, mask, src, dsc);
+    LV_PROFILER_END(LV_PROFILER_DRAW_IMG);
 
     if(res == LV_RES_INV) {
         LV_LOG_WARN("Image draw error");
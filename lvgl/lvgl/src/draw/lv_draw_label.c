@@ -2,6 +2,7 @@
  * @file lv_draw_label.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -12,6 +13,7 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_assert.h"
+#include "../misc/lv_profiler.h"
 
 #if LV_USE_GPU_SDL
     #include "../gpu/lv_gpu_sdl.h"
@@ -134,6 +136,7 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
     lv_area_t clipped_area;
     bool clip_ok = _lv_area_intersect(&clipped_area, coords, mask);
     if(!clip_ok) return;
+    LV_PROFILER_BEGIN(LV_PROFILER_DRAW_LABEL);
 
     lv_text_align_t align = dsc->align;
     lv_base_dir_t base_dir = dsc->bidi_dir;
@@ -201,7 +204,10 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
             hint->coord_y    = coords->y1;
         }
 
-        if(txt[line_start] == '\0') return;
+        if(txt[line_start] == '\0') {
+            LV_PROFILER_END(LV_PROFILER_DRAW_LABEL);
+            return;
+        }
     }
 
     /*Align to middle*/
@@ -247,6 +253,9 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
     draw_dsc_sel.bg_color = dsc->sel_bg_color;
 
     int32_t pos_x_start = pos.x;
+#if DLG_LVGL_USE_GPU_DA1470X
+    _lv_draw_letter_batch_begin();
+#endif
     /*Write out all lines*/
     while(txt[line_start] != '\0') {
         pos.x += x_ofs;
@@ -329,7 +338,13 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
                     sel_coords.y1 = pos.y;
                     sel_coords.x2 = pos.x + letter_w + dsc->letter_space - 1;
                     sel_coords.y2 = pos.y + line_height - 1;
+#if DLG_LVGL_USE_GPU_DA1470X
+                    _lv_draw_letter_batch_end();
                     lv_draw_rect(&sel_coords, mask, &draw_dsc_sel);
+                    _lv_draw_letter_batch_begin();
+#else
+                    lv_draw_rect(&sel_coords, mask, &draw_dsc_sel);
+#endif
                     color = dsc->sel_color;
                 }
             }
@@ -341,6 +356,14 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
             }
         }
 
+#if DLG_LVGL_USE_GPU_DA1470X
+        if(dsc->decor & (LV_TEXT_DECOR_STRIKETHROUGH | LV_TEXT_DECOR_UNDERLINE)) {
+            /*The line goes over the letters*/
+            _lv_draw_letter_batch_end();
+            _lv_draw_letter_batch_begin();
+        }
+#endif
+
         if(dsc->decor & LV_TEXT_DECOR_STRIKETHROUGH) {
             lv_point_t p1;
             lv_point_t p2;
@@ -388,9 +411,14 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
         /*Go the next line position*/
         pos.y += line_height;
 
-        if(pos.y > mask->y2) return;
+        if(pos.y > mask->y2) break;
     }
 
+#if DLG_LVGL_USE_GPU_DA1470X
+    _lv_draw_letter_batch_end();
+#endif
+
+    LV_PROFILER_END(LV_PROFILER_DRAW_LABEL);
     LV_ASSERT_MEM_INTEGRITY();
 }
 
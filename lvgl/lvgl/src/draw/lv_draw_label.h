@@ -2,6 +2,7 @@
  * @file lv_draw_label.h
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 #ifndef LV_DRAW_LABEL_H
 #define LV_DRAW_LABEL_H
@@ -87,6 +88,19 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
 LV_ATTRIBUTE_FAST_MEM void lv_draw_letter(const lv_point_t * pos_p, const lv_area_t * clip_area,
                                           const lv_font_t * font_p,
                                           uint32_t letter, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
+
+#if DLG_LVGL_USE_GPU_DA1470X
+/**
+ * Let `lv_draw_letter()` queue the letters drawn by the GPU and draw them with as few GPU jobs as possible.
+ * Nothing else can be drawn until `_lv_draw_letter_batch_end()`.
+ */
+void _lv_draw_letter_batch_begin(void);
+
+/**
+ * Draw the queued letters and stop queuing
+ */
+void _lv_draw_letter_batch_end(void);
+#endif
 //! @endcond
 /***********************
  * GLOBAL VARIABLES
@@ -2,6 +2,7 @@
  * @file lv_draw_line.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -10,7 +11,9 @@
 #include "lv_draw_mask.h"
 #include "lv_draw_blend.h"
 #include "../core/lv_refr.h"
+#include "../hal/lv_hal_disp.h"
 #include "../misc/lv_math.h"
+#include "../misc/lv_profiler.h"
 
 /*********************
  *      DEFINES
@@ -34,6 +37,10 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_hor(const lv_point_t * point1, const
 LV_ATTRIBUTE_FAST_MEM static void draw_line_ver(const lv_point_t * point1, const lv_point_t * point2,
                                                 const lv_area_t * clip,
                                                 const lv_draw_line_dsc_t * dsc);
+#if DLG_LVGL_USE_GPU_DA1470X
+static bool draw_line_gpu(const lv_point_t * point1, const lv_point_t * point2, const lv_area_t * clip,
+                          const lv_draw_line_dsc_t * dsc);
+#endif
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -79,6 +86,15 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_line(const lv_point_t * point1, const lv_poin
     is_common = _lv_area_intersect(&clip_line, &clip_line, clip);
     if(!is_common) return;
 
+    LV_PROFILER_BEGIN(LV_PROFILER_DRAW_LINE);
+#if DLG_LVGL_USE_GPU_DA1470X
+    /*Skew lines and their round ends in one go*/
+    if(point1->x != point2->x && point1->y != point2->y && draw_line_gpu(point1, point2, &clip_line, dsc)) {
+        LV_PROFILER_END(LV_PROFILER_DRAW_LINE);
+        return;
+    }
+#endif
+
     if(point1->y == point2->y) draw_line_hor(point1, point2, &clip_line, dsc);
     else if(point1->x == point2->x) draw_line_ver(point1, point2, &clip_line, dsc);
     else draw_line_skew(point1, point2, &clip_line, dsc);
@@ -110,6 +126,7 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_line(const lv_point_t * point1, const lv_poin
             lv_draw_rect(&cir_area, clip, &cir_dsc);
         }
     }
+    LV_PROFILER_END(LV_PROFILER_DRAW_LINE);
 }
 
 /**********************
@@ -493,3 +510,43 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_skew(const lv_point_t * point1, cons
 #endif /*LV_DRAW_COMPLEX*/
 }
 
+#if DLG_LVGL_USE_GPU_DA1470X
+/**
+ * Draw a skew line and its round ends with the GPU
+ * @return false if the line has to be drawn with masks
+ */
+static bool draw_line_gpu(const lv_point_t * point1, const lv_point_t * point2, const lv_area_t * clip,
+                          const lv_draw_line_dsc_t * dsc)
+{
+    /*Dashes and ends not normal to the line need masks*/
+    if((dsc->dash_width && dsc->dash_gap) || dsc->raw_end) return false;
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_drv_t * drv = disp->driver;
+    if(drv->gpu_draw_shape_cb == NULL || drv->set_px_cb || dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+    if(lv_draw_mask_is_any(clip)) return false;
+
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
+    const lv_area_t * disp_area = &draw_buf->area;
+
+    lv_gpu_shape_t shape;
+    lv_memset_00(&shape, sizeof(shape));
+    shape.type = LV_GPU_SHAPE_LINE;
+    shape.round_start = dsc->round_start;
+    shape.round_end = dsc->round_end;
+    shape.width = dsc->width;
+
+    /*Relative to the draw buffer*/
+    lv_area_t clip_rel;
+    lv_area_copy(&clip_rel, clip);
+    lv_area_move(&clip_rel, -disp_area->x1, -disp_area->y1);
+    shape.p1.x = point1->x - disp_area->x1;
+    shape.p1.y = point1->y - disp_area->y1;
+    shape.p2.x = point2->x - disp_area->x1;
+    shape.p2.y = point2->y - disp_area->y1;
+
+    if(drv->gpu_wait_cb) drv->gpu_wait_cb(drv);
+    return drv->gpu_draw_shape_cb(drv, draw_buf->buf_act, lv_area_get_width(disp_area), &clip_rel, &shape,
+                                  dsc->color, dsc->opa);
+}
+#endif /*DLG_LVGL_USE_GPU_DA1470X*/
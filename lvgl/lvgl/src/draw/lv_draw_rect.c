@@ -2,6 +2,7 @@
  * @file lv_draw_rect.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -13,6 +14,7 @@
 #include "../misc/lv_txt_ap.h"
 #include "../core/lv_refr.h"
 #include "../misc/lv_assert.h"
+#include "../misc/lv_profiler.h"
 
 /*********************
  *      DEFINES
@@ -101,6 +103,7 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_rect_dsc_init(lv_draw_rect_dsc_t * dsc)
 void lv_draw_rect(const lv_area_t * coords, const lv_area_t * clip, const lv_draw_rect_dsc_t * dsc)
 {
     if(lv_area_get_height(coords) < 1 || lv_area_get_width(coords) < 1) return;
+    LV_PROFILER_BEGIN(LV_PROFILER_DRAW_RECT);
 #if LV_DRAW_COMPLEX
     draw_shadow(coords, clip, dsc);
 #endif
@@ -112,6 +115,7 @@ void lv_draw_rect(const lv_area_t * coords, const lv_area_t * clip, const lv_dra
 
     draw_outline(coords, clip, dsc);
 
+    LV_PROFILER_END(LV_PROFILER_DRAW_RECT);
     LV_ASSERT_MEM_INTEGRITY();
 }
 
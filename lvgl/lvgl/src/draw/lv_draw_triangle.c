@@ -2,6 +2,7 @@
  * @file lv_draw_triangle.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -9,6 +10,7 @@
 #include "lv_draw_triangle.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_mem.h"
+#include "../misc/lv_profiler.h"
 
 /*********************
  *      DEFINES
@@ -106,6 +108,7 @@ void lv_draw_polygon(const lv_point_t points[], uint16_t point_cnt, const lv_are
         lv_mem_buf_release(p);
         return;
     }
+    LV_PROFILER_BEGIN(LV_PROFILER_DRAW_POLYGON);
     /*Find the lowest point*/
     lv_coord_t y_min = p[0].y;
     int16_t y_min_i = 0;
@@ -202,6 +205,7 @@ void lv_draw_polygon(const lv_point_t points[], uint16_t point_cnt, const lv_are
 
     lv_mem_buf_release(mp);
     lv_mem_buf_release(p);
+    LV_PROFILER_END(LV_PROFILER_DRAW_POLYGON);
 #else
     LV_UNUSED(points);
     LV_UNUSED(point_cnt);
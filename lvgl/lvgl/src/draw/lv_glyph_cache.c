@@ -0,0 +1,309 @@
+/**
+ * @file lv_glyph_cache.c
+ *
+ */
+/* Copyright (c) 2022 Dialog Semiconductor */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_glyph_cache.h"
+
+#if DLG_LVGL_USE_GLYPH_CACHE
+
+#include "../hal/lv_hal_disp.h"
+#include "../misc/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Size of the atlas in bytes, one byte per pixel*/
+#ifndef DLG_LVGL_GLYPH_CACHE_SIZE
+    #define DLG_LVGL_GLYPH_CACHE_SIZE           (16 * 1024)
+#endif
+
+/*Address of the atlas, e.g. in QSPI RAM. 0: use a static array*/
+#ifndef DLG_LVGL_GLYPH_CACHE_ADR
+    #define DLG_LVGL_GLYPH_CACHE_ADR            0
+#endif
+
+/*The atlas is split into pages which are filled one after the other and cleared as a whole*/
+#ifndef DLG_LVGL_GLYPH_CACHE_PAGES
+    #define DLG_LVGL_GLYPH_CACHE_PAGES          4
+#endif
+
+/*Maximum number of cached glyphs*/
+#ifndef DLG_LVGL_GLYPH_CACHE_ENTRIES
+    #define DLG_LVGL_GLYPH_CACHE_ENTRIES        128
+#endif
+
+#define GLYPH_ALIGN                             4
+#define PAGE_SIZE                               ((DLG_LVGL_GLYPH_CACHE_SIZE / DLG_LVGL_GLYPH_CACHE_PAGES) & ~(GLYPH_ALIGN - 1))
+#define NO_ENTRY                                0xFFFF
+
+#if DLG_LVGL_GLYPH_CACHE_ENTRIES >= NO_ENTRY || DLG_LVGL_GLYPH_CACHE_PAGES > 255
+    #error "Too many glyph cache entries or pages"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const lv_font_t * font;     /*NULL: unused entry*/
+    uint32_t letter;
+    uint8_t * buf;
+    uint16_t next;              /*Next entry of the hash chain or of the free list*/
+    uint8_t page;
+} lv_glyph_cache_entry_t;
+
+typedef struct {
+    uint32_t used;              /*Bytes filled from the start of the page*/
+    uint32_t last_use;          /*Value of `use_cnt` when a glyph of the page was drawn last time*/
+} lv_glyph_cache_page_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t hash(const lv_font_t * font_p, uint32_t letter);
+static uint8_t * alloc_buf(uint32_t size, uint8_t * page_id);
+static void clear_page(uint8_t page_id);
+static void decode(const uint8_t * map_p, const lv_font_glyph_dsc_t * g, uint8_t * buf);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_glyph_cache_entry_t entries[DLG_LVGL_GLYPH_CACHE_ENTRIES];
+static uint16_t buckets[DLG_LVGL_GLYPH_CACHE_ENTRIES];
+static uint16_t free_head;
+static lv_glyph_cache_page_t pages[DLG_LVGL_GLYPH_CACHE_PAGES];
+static uint8_t cur_page;
+static bool initialized;
+static lv_glyph_cache_stat_t stat;
+static uint32_t use_cnt;
+#if DLG_LVGL_GLYPH_CACHE_ADR == 0
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY uint32_t atlas_int[DLG_LVGL_GLYPH_CACHE_SIZE / sizeof(uint32_t)];
+    #define ATLAS                               ((uint8_t *)atlas_int)
+#else
+    #define ATLAS                               ((uint8_t *)DLG_LVGL_GLYPH_CACHE_ADR)
+#endif
+
+extern const uint8_t _lv_bpp1_opa_table[2];
+extern const uint8_t _lv_bpp2_opa_table[4];
+extern const uint8_t _lv_bpp4_opa_table[16];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const uint8_t * _lv_glyph_cache_find(const lv_font_t * font_p, uint32_t letter)
+{
+    if(!initialized) lv_glyph_cache_invalidate_font(NULL);
+
+    use_cnt++;
+
+    uint16_t i;
+    for(i = buckets[hash(font_p, letter)]; i != NO_ENTRY; i = entries[i].next) {
+        if(entries[i].font == font_p && entries[i].letter == letter) {
+            stat.hit_cnt++;
+            pages[entries[i].page].last_use = use_cnt;
+            return entries[i].buf;
+        }
+    }
+
+    return NULL;
+}
+
+const uint8_t * _lv_glyph_cache_add(const lv_font_t * font_p, uint32_t letter, const lv_font_glyph_dsc_t * g)
+{
+    if(!initialized) lv_glyph_cache_invalidate_font(NULL);
+
+    uint32_t size = (uint32_t)g->box_w * g->box_h;
+    if(size > PAGE_SIZE) return NULL;
+    if(g->bpp != 1 && g->bpp != 2 && g->bpp != 3 && g->bpp != 4 && g->bpp != 8) return NULL;
+
+    const uint8_t * map_p = lv_font_get_glyph_bitmap(font_p, letter);
+    if(map_p == NULL) return NULL;
+
+    uint8_t page_id;
+    uint8_t * buf = alloc_buf(size, &page_id);
+
+    /*No free entry: clear the least recently used page holding glyphs*/
+    if(free_head == NO_ENTRY) {
+        uint8_t lru = page_id;
+        uint8_t p;
+        for(p = 0; p < DLG_LVGL_GLYPH_CACHE_PAGES; p++) {
+            if(pages[p].used && use_cnt - pages[p].last_use > use_cnt - pages[lru].last_use) lru = p;
+        }
+        clear_page(lru);
+        if(lru == page_id) buf = alloc_buf(size, &page_id);
+    }
+
+    uint32_t h = hash(font_p, letter);
+    uint16_t i = free_head;
+    free_head = entries[i].next;
+
+    entries[i].font = font_p;
+    entries[i].letter = letter;
+    entries[i].buf = buf;
+    entries[i].page = page_id;
+    entries[i].next = buckets[h];
+    buckets[h] = i;
+
+    decode(map_p, g, buf);
+
+    stat.miss_cnt++;
+    stat.entry_cnt++;
+    return buf;
+}
+
+void lv_glyph_cache_invalidate_font(const lv_font_t * font_p)
+{
+    if(!initialized || font_p == NULL) {
+        /*The GPU might still read a glyph*/
+        lv_disp_t * disp = lv_disp_get_default();
+        if(initialized && disp && disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+
+        uint32_t i;
+        for(i = 0; i < DLG_LVGL_GLYPH_CACHE_ENTRIES; i++) {
+            entries[i].font = NULL;
+            entries[i].next = i + 1 < DLG_LVGL_GLYPH_CACHE_ENTRIES ? i + 1 : NO_ENTRY;
+            buckets[i] = NO_ENTRY;
+        }
+        lv_memset_00(pages, sizeof(pages));
+        free_head = 0;
+        cur_page = 0;
+        stat.size = 0;
+        stat.entry_cnt = 0;
+        initialized = true;
+        return;
+    }
+
+    /*The space of the glyphs is only given back with their page*/
+    uint8_t p;
+    for(p = 0; p < DLG_LVGL_GLYPH_CACHE_PAGES; p++) {
+        uint32_t i;
+        for(i = 0; i < DLG_LVGL_GLYPH_CACHE_ENTRIES; i++) {
+            if(entries[i].font == font_p && entries[i].page == p) {
+                clear_page(p);
+                break;
+            }
+        }
+    }
+}
+
+void lv_glyph_cache_get_stat(lv_glyph_cache_stat_t * stat_p)
+{
+    lv_memcpy_small(stat_p, &stat, sizeof(stat));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t hash(const lv_font_t * font_p, uint32_t letter)
+{
+    uint32_t h = (uint32_t)((uintptr_t)font_p >> 2) ^ (letter * 2654435761u);
+    return (h ^ (h >> 16)) % DLG_LVGL_GLYPH_CACHE_ENTRIES;
+}
+
+/**
+ * Take `size` bytes from the current page, moving to an empty or to the least recently used page
+ * when it is full
+ */
+static uint8_t * alloc_buf(uint32_t size, uint8_t * page_id)
+{
+    size = (size + GLYPH_ALIGN - 1) & ~(GLYPH_ALIGN - 1);
+
+    if(pages[cur_page].used + size > PAGE_SIZE) {
+        uint8_t next = cur_page;
+        uint8_t p;
+        for(p = 0; p < DLG_LVGL_GLYPH_CACHE_PAGES; p++) {
+            if(p == cur_page) continue;
+            if(pages[p].used == 0) {
+                next = p;
+                break;
+            }
+            if(next == cur_page || use_cnt - pages[p].last_use > use_cnt - pages[next].last_use) next = p;
+        }
+
+        if(pages[next].used) clear_page(next);
+        cur_page = next;
+    }
+
+    uint8_t * buf = ATLAS + cur_page * PAGE_SIZE + pages[cur_page].used;
+    pages[cur_page].used += size;
+    stat.size += size;
+    pages[cur_page].last_use = use_cnt;
+    *page_id = cur_page;
+    return buf;
+}
+
+/**
+ * Drop the glyphs of a page and empty it
+ */
+static void clear_page(uint8_t page_id)
+{
+    /*The GPU might still read a glyph of the page*/
+    lv_disp_t * disp = lv_disp_get_default();
+    if(disp && disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+
+    uint32_t h;
+    for(h = 0; h < DLG_LVGL_GLYPH_CACHE_ENTRIES; h++) {
+        uint16_t * link = &buckets[h];
+        while(*link != NO_ENTRY) {
+            lv_glyph_cache_entry_t * entry = &entries[*link];
+            if(entry->page != page_id) {
+                link = &entry->next;
+                continue;
+            }
+
+            uint16_t i = *link;
+            *link = entry->next;
+            entry->font = NULL;
+            entry->next = free_head;
+            free_head = i;
+
+            stat.evict_cnt++;
+            stat.entry_cnt--;
+        }
+    }
+
+    stat.size -= pages[page_id].used;
+    stat.page_evict_cnt++;
+    pages[page_id].used = 0;
+}
+
+/**
+ * Expand the 1, 2, 4 or 8 bpp pixels of a glyph to one opacity per byte
+ */
+static void decode(const uint8_t * map_p, const lv_font_glyph_dsc_t * g, uint8_t * buf)
+{
+    uint32_t px_cnt = (uint32_t)g->box_w * g->box_h;
+    uint32_t bpp = g->bpp == 3 ? 4 : g->bpp;
+
+    if(bpp == 8) {
+        lv_memcpy(buf, map_p, px_cnt);
+        return;
+    }
+
+    const uint8_t * opa_table = bpp == 1 ? _lv_bpp1_opa_table : bpp == 2 ? _lv_bpp2_opa_table : _lv_bpp4_opa_table;
+    uint32_t px_mask = (1 << bpp) - 1;
+    uint32_t shift = 8;
+    uint32_t i;
+
+    /*The rows are not byte aligned*/
+    for(i = 0; i < px_cnt; i++) {
+        shift -= bpp;
+        buf[i] = opa_table[(*map_p >> shift) & px_mask];
+        if(shift == 0) {
+            shift = 8;
+            map_p++;
+        }
+    }
+}
+
+#endif /*DLG_LVGL_USE_GLYPH_CACHE*/
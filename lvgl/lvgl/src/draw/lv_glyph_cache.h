@@ -0,0 +1,87 @@
+/**
+ * @file lv_glyph_cache.h
+ *
+ */
+/* Copyright (c) 2022 Dialog Semiconductor */
+
+#ifndef LV_GLYPH_CACHE_H
+#define LV_GLYPH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../font/lv_font.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef DLG_LVGL_USE_GLYPH_CACHE
+#define DLG_LVGL_USE_GLYPH_CACHE 0
+#endif
+
+#if DLG_LVGL_USE_GLYPH_CACHE
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Counters of the glyph cache. They are never cleared, the user can compute the change between
+ * two readings.
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Letters drawn from a cached glyph*/
+    uint32_t miss_cnt;      /**< Glyphs decoded into the atlas*/
+    uint32_t evict_cnt;     /**< Glyphs dropped with their atlas page*/
+    uint32_t page_evict_cnt;/**< Atlas pages cleared to make room for new glyphs*/
+    uint32_t size;          /**< Bytes of the cached glyphs*/
+    uint32_t entry_cnt;     /**< Number of cached glyphs*/
+} lv_glyph_cache_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Look up the glyph of a letter, as `box_w` x `box_h` 8-bit opacities.
+ * The opacities are the ones of the bpp of the font, the opacity of the text is left to the draw
+ * call, so the font and the letter are the whole key.
+ * @param font_p the font of the letter
+ * @param letter the UNICODE letter
+ * @return the pixels of the glyph or NULL if it is not cached
+ */
+const uint8_t * _lv_glyph_cache_find(const lv_font_t * font_p, uint32_t letter);
+
+/**
+ * Decode the glyph of a letter into the atlas. It might clear an atlas page: the pixels returned by the
+ * previous calls are valid only until this one, so the blits using them have to be started before.
+ * @param font_p the font of the letter
+ * @param letter the UNICODE letter, not in the cache yet
+ * @param g the glyph descriptor of the letter
+ * @return the pixels of the glyph or NULL if it can't be cached
+ */
+const uint8_t * _lv_glyph_cache_add(const lv_font_t * font_p, uint32_t letter, const lv_font_glyph_dsc_t * g);
+
+/**
+ * Drop the cached glyphs of a font. Required if a font is freed or its bitmaps changed.
+ * @param font_p the font, NULL to drop all the glyphs
+ */
+void lv_glyph_cache_invalidate_font(const lv_font_t * font_p);
+
+/**
+ * Get the counters of the glyph cache
+ * @param stat the counters are copied here
+ */
+void lv_glyph_cache_get_stat(lv_glyph_cache_stat_t * stat);
+
+#endif /*DLG_LVGL_USE_GLYPH_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_GLYPH_CACHE_H*/
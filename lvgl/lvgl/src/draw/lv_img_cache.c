@@ -2,15 +2,18 @@
  * @file lv_img_cache.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
  *********************/
 #include "../misc/lv_assert.h"
 #include "lv_img_cache.h"
+#include "lv_img_rot_cache.h"
 #include "lv_img_decoder.h"
 #include "lv_draw_img.h"
 #include "../hal/lv_hal_tick.h"
+#include "../hal/lv_hal_disp.h"
 #include "../misc/lv_gc.h"
 
 /*********************
@@ -26,6 +29,36 @@
  * "die" from very high values*/
 #define LV_IMG_CACHE_LIFE_LIMIT 1000
 
+#if DLG_LVGL_USE_IMG_CACHE
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    #error "The image cache requires LV_IMG_CACHE_DEF_SIZE entries"
+#endif
+#if DLG_LVGL_CF == 0
+    #error "The image cache converts to DLG color formats, it requires DLG_LVGL_CF"
+#endif
+
+/*Size of the memory of the converted images in bytes. 0: only keep the images opened*/
+#ifndef DLG_LVGL_IMG_CACHE_SIZE
+    #define DLG_LVGL_IMG_CACHE_SIZE             0
+#endif
+
+/*Address of the memory, e.g. in QSPI RAM. 0: use a static array*/
+#ifndef DLG_LVGL_IMG_CACHE_ADR
+    #define DLG_LVGL_IMG_CACHE_ADR              0
+#endif
+
+/*Convert the indexed images to ARGB8888 for the GPU, saving the CLUT load and the sub-byte reordering of every blit*/
+#ifndef DLG_LVGL_IMG_CACHE_CONVERT_INDEXED
+    #define DLG_LVGL_IMG_CACHE_CONVERT_INDEXED  DLG_LVGL_CF_SUB_BYTE_SWAP
+#endif
+
+#ifdef LV_ARCH_64
+    #define MEM_UNIT                            uint64_t
+#else
+    #define MEM_UNIT                            uint32_t
+#endif
+#endif /*DLG_LVGL_USE_IMG_CACHE*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -36,6 +69,16 @@
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
 #endif
+#if DLG_LVGL_USE_IMG_CACHE
+    static void drop_entry(_lv_img_cache_entry_t * entry);
+    #if DLG_LVGL_IMG_CACHE_SIZE
+        static void convert(_lv_img_cache_entry_t * entry);
+        static lv_img_cf_t get_convert_cf(const lv_img_decoder_dsc_t * dsc);
+        static void convert_line(uint8_t * dst, lv_img_cf_t dst_cf, const uint8_t * src, lv_img_cf_t src_cf,
+                                 const lv_color32_t * palette, lv_coord_t w);
+        static uint8_t * alloc_buf(const _lv_img_cache_entry_t * entry, uint32_t size);
+    #endif
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -43,6 +86,16 @@
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
 #endif
+#if DLG_LVGL_USE_IMG_CACHE
+    static lv_img_cache_stat_t stat;
+    static uint32_t use_cnt;
+    #if DLG_LVGL_IMG_CACHE_SIZE && DLG_LVGL_IMG_CACHE_ADR == 0
+        static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT pool_int[DLG_LVGL_IMG_CACHE_SIZE / sizeof(MEM_UNIT)];
+        #define POOL                            ((uint8_t *)pool_int)
+    #elif DLG_LVGL_IMG_CACHE_SIZE
+        #define POOL                            ((uint8_t *)DLG_LVGL_IMG_CACHE_ADR)
+    #endif
+#endif
 
 /**********************
  *      MACROS
@@ -72,9 +125,40 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     }
 
     _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t i;
+
+#if DLG_LVGL_USE_IMG_CACHE
+    use_cnt++;
+
+    for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src != NULL && color.full == cache[i].dec_dsc.color.full &&
+           frame_id == cache[i].dec_dsc.frame_id &&
+           lv_img_cache_match(src, cache[i].dec_dsc.src)) {
+            stat.hit_cnt++;
+            cache[i].last_use = use_cnt;
+            return &cache[i];
+        }
+    }
+
+    /*Replace an empty or the least recently used entry. `lv_img_cache_pin()` leaves at least one unpinned*/
+    cached_src = NULL;
+    for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].pinned) continue;
+        if(cache[i].dec_dsc.src == NULL) {
+            cached_src = &cache[i];
+            break;
+        }
+        if(cached_src == NULL || use_cnt - cache[i].last_use > use_cnt - cached_src->last_use) {
+            cached_src = &cache[i];
+        }
+    }
 
+    if(cached_src->dec_dsc.src) {
+        drop_entry(cached_src);
+        stat.evict_cnt++;
+    }
+#else
     /*Decrement all lifes. Make the entries older*/
-    uint16_t i;
     for(i = 0; i < entry_cnt; i++) {
         if(cache[i].life > INT32_MIN + LV_IMG_CACHE_AGING) {
             cache[i].life -= LV_IMG_CACHE_AGING;
@@ -115,6 +199,7 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     else {
         LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
     }
+#endif /*DLG_LVGL_USE_IMG_CACHE*/
 #else
     cached_src = &LV_GC_ROOT(_lv_img_cache_single);
 #endif
@@ -137,6 +222,15 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
+#if DLG_LVGL_USE_IMG_CACHE
+    cached_src->last_use = use_cnt;
+    stat.miss_cnt++;
+    stat.entry_cnt++;
+#if DLG_LVGL_IMG_CACHE_SIZE
+    convert(cached_src);
+#endif
+#endif
+
     return cached_src;
 }
 
@@ -180,15 +274,37 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
 void lv_img_cache_invalidate_src(const void * src)
 {
     LV_UNUSED(src);
+#if DLG_LVGL_USE_IMG_ROT_CACHE
+    lv_img_rot_cache_invalidate_src(src);
+#endif
+#if DLG_LVGL_USE_GPU_DA1470X
+    /*The GPU might keep converted copies of the pixels of a variable*/
+    lv_disp_t * disp = lv_disp_get_default();
+    if(disp && disp->driver->gpu_invalidate_src_cb) {
+        if(src == NULL) {
+            disp->driver->gpu_invalidate_src_cb(disp->driver, NULL, 0);
+        }
+        else if(lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE) {
+            const lv_img_dsc_t * img_dsc = src;
+            disp->driver->gpu_invalidate_src_cb(disp->driver, img_dsc->data, img_dsc->data_size);
+        }
+    }
+#endif
 #if LV_IMG_CACHE_DEF_SIZE
     _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
 
     uint16_t i;
     for(i = 0; i < entry_cnt; i++) {
         if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
+#if DLG_LVGL_USE_IMG_CACHE
+            if(cache[i].dec_dsc.src != NULL) {
+                drop_entry(&cache[i]);
+            }
+#else
             if(cache[i].dec_dsc.src != NULL) {
                 lv_img_decoder_close(&cache[i].dec_dsc);
             }
+#endif
 
             lv_memset_00(&cache[i], sizeof(_lv_img_cache_entry_t));
         }
@@ -196,6 +312,46 @@ void lv_img_cache_invalidate_src(const void * src)
 #endif
 }
 
+#if DLG_LVGL_USE_IMG_CACHE
+lv_res_t lv_img_cache_pin(const void * src)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t unpinned = 0;
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        if(!cache[i].pinned) unpinned++;
+    }
+
+    /*Leave an entry for the other images*/
+    if(unpinned < 2) {
+        LV_LOG_WARN("lv_img_cache_pin: no entry left for the other images");
+        return LV_RES_INV;
+    }
+
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(src, lv_color_black(), 0);
+    if(entry == NULL) return LV_RES_INV;
+
+    entry->pinned = true;
+    return LV_RES_OK;
+}
+
+void lv_img_cache_unpin(const void * src)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src != NULL && lv_img_cache_match(src, cache[i].dec_dsc.src)) {
+            cache[i].pinned = false;
+        }
+    }
+}
+
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat_p)
+{
+    lv_memcpy_small(stat_p, &stat, sizeof(stat));
+}
+#endif /*DLG_LVGL_USE_IMG_CACHE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -213,3 +369,208 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
     return strcmp(src1, src2) == 0;
 }
 #endif
+
+#if DLG_LVGL_USE_IMG_CACHE
+/**
+ * Close the image of an entry and give back its converted pixels
+ */
+static void drop_entry(_lv_img_cache_entry_t * entry)
+{
+    if(entry->buf) {
+        /*The GPU might still read the pixels*/
+        lv_disp_t * disp = lv_disp_get_default();
+        if(disp && disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+        stat.size -= entry->size;
+    }
+
+    lv_img_decoder_close(&entry->dec_dsc);
+    stat.entry_cnt--;
+    lv_memset_00(entry, sizeof(_lv_img_cache_entry_t));
+}
+
+#if DLG_LVGL_IMG_CACHE_SIZE
+/**
+ * Convert the pixels of a newly opened image into the cache memory if the draw path would convert
+ * them at every draw otherwise. The decoder descriptor is changed to point to the converted pixels.
+ */
+static void convert(_lv_img_cache_entry_t * entry)
+{
+    lv_img_decoder_dsc_t * dsc = &entry->dec_dsc;
+    lv_img_cf_t cf = dsc->header.cf;
+    lv_img_cf_t new_cf = get_convert_cf(dsc);
+    if(new_cf == LV_IMG_CF_UNKNOWN) return;
+
+    lv_coord_t w = dsc->header.w;
+    lv_coord_t h = dsc->header.h;
+    uint32_t px_size = lv_img_cf_get_px_size(new_cf) >> 3;
+    uint32_t size = (uint32_t)w * h * px_size;
+    if(size == 0 || size > DLG_LVGL_IMG_CACHE_SIZE / 2) return;
+
+    /*The decoder reads the lines in true color with alpha byte, except for the true color formats*/
+    uint8_t * line = NULL;
+    lv_img_cf_t line_cf = cf;
+    if(dsc->img_data == NULL) {
+        line = lv_mem_buf_get(w * LV_IMG_PX_SIZE_ALPHA_BYTE);
+        if(line == NULL) return;
+        if(cf != LV_IMG_CF_TRUE_COLOR && cf != LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) line_cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    }
+
+    uint8_t * buf = alloc_buf(entry, size);
+    if(buf == NULL) {
+        if(line) lv_mem_buf_release(line);
+        return;
+    }
+
+    const lv_color32_t * palette = NULL;
+    const uint8_t * src_p = dsc->img_data;
+    uint32_t src_stride = ((uint32_t)w * lv_img_cf_get_px_size(cf) + 7) >> 3;
+    if(line == NULL && cf >= LV_IMG_CF_INDEXED_1BIT && cf <= LV_IMG_CF_INDEXED_8BIT) {
+        palette = (const lv_color32_t *)src_p;
+        src_p += sizeof(lv_color32_t) << lv_img_cf_get_px_size(cf);
+    }
+
+    lv_coord_t y;
+    for(y = 0; y < h; y++) {
+        if(line) {
+            if(lv_img_decoder_read_line(dsc, 0, y, w, line) != LV_RES_OK) {
+                LV_LOG_WARN("Image cache: can't read a line to convert");
+                lv_mem_buf_release(line);
+                return;
+            }
+            convert_line(buf + (uint32_t)y * w * px_size, new_cf, line, line_cf, NULL, w);
+        }
+        else {
+            convert_line(buf + (uint32_t)y * w * px_size, new_cf, src_p + y * src_stride, cf, palette, w);
+        }
+    }
+
+    if(line) lv_mem_buf_release(line);
+
+    entry->buf = buf;
+    entry->size = size;
+    dsc->img_data = buf;
+    dsc->header.cf = new_cf;
+    dsc->header.rle = 0;
+    stat.size += size;
+    stat.convert_cnt++;
+}
+
+/**
+ * Get the color format an image is converted to in the cache
+ * @return the new color format or `LV_IMG_CF_UNKNOWN` to use the pixels of the decoder
+ */
+static lv_img_cf_t get_convert_cf(const lv_img_decoder_dsc_t * dsc)
+{
+    lv_img_cf_t cf = dsc->header.cf;
+    bool gpu = lv_img_cf_use_gpu(LV_IMG_CF_ARGB8888);
+
+    /*The GPU reads ARGB8888, the CPU true color with alpha byte*/
+    lv_img_cf_t alpha_cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    if(gpu && !lv_img_cf_use_gpu(LV_IMG_CF_TRUE_COLOR_ALPHA)) alpha_cf = LV_IMG_CF_ARGB8888;
+
+    /*Files, RLE images without GPU and indexed or alpha images without GPU are read line by line*/
+    if(dsc->img_data == NULL) {
+        if(cf == LV_IMG_CF_TRUE_COLOR || cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) return cf;
+        if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA || (cf >= LV_IMG_CF_INDEXED_1BIT && cf <= LV_IMG_CF_ALPHA_8BIT)) {
+            return alpha_cf;
+        }
+        return LV_IMG_CF_UNKNOWN;
+    }
+
+    /*The GPU decodes RLE itself*/
+    if(!gpu || dsc->header.rle) return LV_IMG_CF_UNKNOWN;
+
+    /*Blended by the CPU otherwise*/
+    if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA && alpha_cf == LV_IMG_CF_ARGB8888) return LV_IMG_CF_ARGB8888;
+
+#if DLG_LVGL_IMG_CACHE_CONVERT_INDEXED
+    if(cf >= LV_IMG_CF_INDEXED_1BIT && cf <= LV_IMG_CF_INDEXED_8BIT) return LV_IMG_CF_ARGB8888;
+#endif
+
+    return LV_IMG_CF_UNKNOWN;
+}
+
+/**
+ * Convert a line of true color, true color with alpha byte or indexed (MSB first) pixels
+ */
+static void convert_line(uint8_t * dst, lv_img_cf_t dst_cf, const uint8_t * src, lv_img_cf_t src_cf,
+                         const lv_color32_t * palette, lv_coord_t w)
+{
+    if(dst_cf == src_cf) {
+        lv_memcpy(dst, src, (uint32_t)w * (lv_img_cf_get_px_size(src_cf) >> 3));
+        return;
+    }
+
+    /*Only to ARGB8888*/
+    uint32_t * dst32 = (uint32_t *)dst;
+    lv_coord_t x;
+
+    if(palette) {
+        uint32_t bpp = lv_img_cf_get_px_size(src_cf);
+        uint32_t px_mask = (1 << bpp) - 1;
+        uint32_t shift = 8;
+        for(x = 0; x < w; x++) {
+            shift -= bpp;
+            dst32[x] = palette[(*src >> shift) & px_mask].full;
+            if(shift == 0) {
+                shift = 8;
+                src++;
+            }
+        }
+        return;
+    }
+
+    for(x = 0; x < w; x++) {
+        lv_color_t c;
+        lv_color32_t c32;
+        lv_memcpy_small(&c, src, sizeof(lv_color_t));
+        c32.full = lv_color_to32(c);
+        c32.ch.alpha = src[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+        dst32[x] = c32.full;
+        src += LV_IMG_PX_SIZE_ALPHA_BYTE;
+    }
+}
+
+/**
+ * Find the first gap between the converted images where `size` bytes fit, dropping the least recently
+ * used unpinned images until there is one.
+ */
+static uint8_t * alloc_buf(const _lv_img_cache_entry_t * entry, uint32_t size)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    size = (size + sizeof(MEM_UNIT) - 1) & ~(sizeof(MEM_UNIT) - 1);
+
+    while(1) {
+        uint8_t * start = POOL;
+        uint16_t i;
+        while(1) {
+            /*The converted image starting next after `start`*/
+            _lv_img_cache_entry_t * next = NULL;
+            for(i = 0; i < entry_cnt; i++) {
+                if(cache[i].buf && cache[i].buf >= start && (next == NULL || cache[i].buf < next->buf)) {
+                    next = &cache[i];
+                }
+            }
+
+            uint8_t * end = next ? next->buf : POOL + DLG_LVGL_IMG_CACHE_SIZE;
+            if((uint32_t)(end - start) >= size) return start;
+            if(next == NULL) break;
+
+            start = next->buf + ((next->size + sizeof(MEM_UNIT) - 1) & ~(sizeof(MEM_UNIT) - 1));
+        }
+
+        _lv_img_cache_entry_t * lru = NULL;
+        for(i = 0; i < entry_cnt; i++) {
+            if(cache[i].buf == NULL || cache[i].pinned || &cache[i] == entry) continue;
+            if(lru == NULL || use_cnt - cache[i].last_use > use_cnt - lru->last_use) lru = &cache[i];
+        }
+
+        /*Nothing left to drop*/
+        if(lru == NULL) return NULL;
+
+        drop_entry(lru);
+        stat.evict_cnt++;
+    }
+}
+#endif /*DLG_LVGL_IMG_CACHE_SIZE*/
+#endif /*DLG_LVGL_USE_IMG_CACHE*/
@@ -2,6 +2,7 @@
  * @file lv_img_cache.h
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 #ifndef LV_IMG_CACHE_H
 #define LV_IMG_CACHE_H
@@ -18,6 +19,9 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#ifndef DLG_LVGL_USE_IMG_CACHE
+#define DLG_LVGL_USE_IMG_CACHE 0
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -35,8 +39,30 @@ typedef struct {
      * Decrement all lifes by one every in every ::lv_img_cache_open.
      * If life == 0 the entry can be reused*/
     int32_t life;
+
+#if DLG_LVGL_USE_IMG_CACHE
+    uint8_t * buf;          /**< Converted pixels in the cache memory. NULL: the pixels of the decoder are used*/
+    uint32_t size;          /**< Bytes of `buf`*/
+    uint32_t last_use;      /**< Value of the use counter when the image was opened last time*/
+    bool pinned;            /**< Not replaced by other images*/
+#endif
 } _lv_img_cache_entry_t;
 
+#if DLG_LVGL_USE_IMG_CACHE
+/**
+ * Counters of the image cache. They are never cleared, the user can compute the change between
+ * two readings.
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Images opened from the cache*/
+    uint32_t miss_cnt;      /**< Images opened with the decoder*/
+    uint32_t evict_cnt;     /**< Images dropped to make room for other ones*/
+    uint32_t convert_cnt;   /**< Images converted into the cache memory*/
+    uint32_t size;          /**< Bytes of the converted images*/
+    uint32_t entry_cnt;     /**< Number of cached images*/
+} lv_img_cache_stat_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -67,6 +93,29 @@ void lv_img_cache_set_size(uint16_t new_slot_num);
  */
 void lv_img_cache_invalidate_src(const void * src);
 
+#if DLG_LVGL_USE_IMG_CACHE
+/**
+ * Keep an image in the cache, opening (and converting) it now if it is not cached yet.
+ * Pinned images are never replaced by other ones, at least one entry is always left for them.
+ * `lv_img_cache_invalidate_src()` still drops them.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ * @return LV_RES_OK: pinned; LV_RES_INV: the image can't be opened or no entry is left
+ */
+lv_res_t lv_img_cache_pin(const void * src);
+
+/**
+ * Let an image pinned by `lv_img_cache_pin()` be replaced again
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ */
+void lv_img_cache_unpin(const void * src);
+
+/**
+ * Get the counters of the image cache
+ * @param stat the counters are copied here
+ */
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -31,6 +31,13 @@ typedef struct {
     lv_fs_file_t f;
     lv_color_t * palette;
     lv_opa_t * opa;
+#if (DLG_LVGL_CF == 1)
+    /*Position in an RLE compressed image decoded by the CPU*/
+    const uint8_t * rle_p;      /*The next unit to read*/
+    lv_coord_t rle_y;           /*The row `rle_p` is in*/
+    uint8_t rle_cnt;            /*Units left in the current packet*/
+    bool rle_repeat;            /*The current packet repeats the unit at `rle_p`*/
+#endif /* DLG_LVGL_CF */
 } lv_img_decoder_built_in_data_t;
 
 /**********************
@@ -42,6 +49,10 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
                                                    lv_coord_t len, uint8_t * buf);
 static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
                                                      lv_coord_t len, uint8_t * buf);
+#if (DLG_LVGL_CF == 1)
+static lv_res_t lv_img_decoder_built_in_line_rle(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                                 lv_coord_t len, uint8_t * buf);
+#endif /* DLG_LVGL_CF */
 
 /**********************
  *  STATIC VARIABLES
@@ -370,6 +381,33 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
     lv_img_cf_t cf = dsc->header.cf;
 #if DLG_LVGL_CF == 1
     cf |= dsc->header.rle ? LV_IMG_CF_RLE_FLAG : 0;
+
+    /*Without a GPU to decompress them, RLE true color images are decoded line by line*/
+    if(dsc->header.rle && !lv_img_cf_use_gpu(cf)) {
+        if(dsc->src_type != LV_IMG_SRC_VARIABLE ||
+           (dsc->header.cf != LV_IMG_CF_TRUE_COLOR && dsc->header.cf != LV_IMG_CF_TRUE_COLOR_ALPHA &&
+            dsc->header.cf != LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED)) {
+            lv_img_decoder_built_in_close(decoder, dsc);
+            LV_LOG_WARN("Image decoder open: RLE is supported only for true color variables");
+            return LV_RES_INV;
+        }
+
+        if(dsc->user_data == NULL) {
+            dsc->user_data = lv_mem_alloc(sizeof(lv_img_decoder_built_in_data_t));
+            LV_ASSERT_MALLOC(dsc->user_data);
+            if(dsc->user_data == NULL) {
+                LV_LOG_ERROR("img_decoder_built_in_open: out of memory");
+                return LV_RES_INV;
+            }
+            lv_memset_00(dsc->user_data, sizeof(lv_img_decoder_built_in_data_t));
+        }
+
+        lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+        user_data->rle_p = ((lv_img_dsc_t *)dsc->src)->data;
+        user_data->rle_y = 0;
+        user_data->rle_cnt = 0;
+        return LV_RES_OK;
+    }
 #endif
     /*Process true color formats*/
     if(cf == LV_IMG_CF_TRUE_COLOR || cf == LV_IMG_CF_TRUE_COLOR_ALPHA || cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED
@@ -480,6 +518,11 @@ lv_res_t lv_img_decoder_built_in_read_line(lv_img_decoder_t * decoder, lv_img_de
         if(dsc->src_type == LV_IMG_SRC_FILE) {
             res = lv_img_decoder_built_in_line_true_color(dsc, x, y, len, buf);
         }
+#if (DLG_LVGL_CF == 1)
+        else if(dsc->header.rle) {
+            res = lv_img_decoder_built_in_line_rle(dsc, x, y, len, buf);
+        }
+#endif /* DLG_LVGL_CF */
     }
     else if(dsc->header.cf == LV_IMG_CF_ALPHA_1BIT || dsc->header.cf == LV_IMG_CF_ALPHA_2BIT ||
             dsc->header.cf == LV_IMG_CF_ALPHA_4BIT || dsc->header.cf == LV_IMG_CF_ALPHA_8BIT) {
@@ -717,3 +760,68 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
     lv_mem_buf_release(fs_buf);
     return LV_RES_OK;
 }
+
+#if (DLG_LVGL_CF == 1)
+/**
+ * Decode a line of an image compressed with the D/AVE2D RLE format. Each packet starts with a control
+ * byte: with bit 7 set the next pixel is repeated (n & 0x7F) + 1 times, otherwise the next (n + 1)
+ * pixels are stored as they are. Packets may continue on the next row.
+ * The rows are decoded in order, so reading the lines top to bottom costs one pass over the data.
+ * Reading an earlier line starts again from the first row.
+ */
+static lv_res_t lv_img_decoder_built_in_line_rle(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                                 lv_coord_t len, uint8_t * buf)
+{
+    lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+    uint8_t px_size = lv_img_cf_get_px_size(dsc->header.cf) >> 3;
+    lv_coord_t w = dsc->header.w;
+
+    if(y < user_data->rle_y) {
+        user_data->rle_p = ((lv_img_dsc_t *)dsc->src)->data;
+        user_data->rle_y = 0;
+        user_data->rle_cnt = 0;
+    }
+
+    const uint8_t * p = user_data->rle_p;
+    uint32_t cnt = user_data->rle_cnt;
+    bool repeat = user_data->rle_repeat;
+
+    for(; user_data->rle_y <= y; user_data->rle_y++) {
+        bool out = user_data->rle_y == y;
+        lv_coord_t i = 0;
+        while(i < w) {
+            if(cnt == 0) {
+                repeat = (*p & 0x80) != 0;
+                cnt = (*p & 0x7F) + 1;
+                p++;
+            }
+
+            lv_coord_t n = LV_MIN((lv_coord_t)cnt, w - i);
+            if(out) {
+                /*The part of the packet in [x, x + len)*/
+                lv_coord_t start = LV_MAX(i, x);
+                lv_coord_t end = LV_MIN(i + n, x + len);
+                if(repeat) {
+                    for(; start < end; start++) {
+                        lv_memcpy_small(&buf[(start - x) * px_size], p, px_size);
+                    }
+                }
+                else if(start < end) {
+                    lv_memcpy(&buf[(start - x) * px_size], p + (start - i) * px_size, (end - start) * px_size);
+                }
+            }
+
+            cnt -= n;
+            if(!repeat) p += n * px_size;
+            else if(cnt == 0) p += px_size;
+            i += n;
+        }
+    }
+
+    user_data->rle_p = p;
+    user_data->rle_cnt = cnt;
+    user_data->rle_repeat = repeat;
+
+    return LV_RES_OK;
+}
+#endif /* DLG_LVGL_CF */
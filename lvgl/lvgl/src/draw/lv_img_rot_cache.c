@@ -0,0 +1,296 @@
+/**
+ * @file lv_img_rot_cache.c
+ *
+ */
+/* Copyright (c) 2022 Dialog Semiconductor */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_img_rot_cache.h"
+
+#if DLG_LVGL_USE_IMG_ROT_CACHE
+
+#include "../core/lv_refr.h"
+#include "../hal/lv_hal_disp.h"
+#include "../misc/lv_mem.h"
+
+#if DLG_LVGL_CF == 0
+    #error "The rotated image cache renders ARGB8888 sprites, it requires DLG_LVGL_CF"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Size of the memory pool of the sprites in bytes*/
+#ifndef DLG_LVGL_IMG_ROT_CACHE_SIZE
+    #define DLG_LVGL_IMG_ROT_CACHE_SIZE         (96 * 1024)
+#endif
+
+/*Address of the memory pool, e.g. in QSPI RAM. 0: use a static array*/
+#ifndef DLG_LVGL_IMG_ROT_CACHE_ADR
+    #define DLG_LVGL_IMG_ROT_CACHE_ADR          0
+#endif
+
+/*Maximum number of cached sprites*/
+#ifndef DLG_LVGL_IMG_ROT_CACHE_ENTRIES
+    #define DLG_LVGL_IMG_ROT_CACHE_ENTRIES      8
+#endif
+
+/*The angles are rounded to this step (0.1 degree unit)*/
+#ifndef DLG_LVGL_IMG_ROT_CACHE_ANGLE_STEP
+    #define DLG_LVGL_IMG_ROT_CACHE_ANGLE_STEP   6
+#endif
+
+#ifdef LV_ARCH_64
+    #define MEM_UNIT                            uint64_t
+#else
+    #define MEM_UNIT                            uint32_t
+#endif
+
+#define SPRITE_PX_SIZE                          4   /*LV_IMG_CF_ARGB8888*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const void * src;
+    uint8_t * buf;          /*NULL: unused entry*/
+    uint32_t size;
+    uint32_t last_use;      /*Value of `use_cnt` when the sprite was drawn last time*/
+    lv_area_t area;         /*Relative to the untransformed image*/
+    lv_point_t pivot;
+    int16_t angle;
+    uint16_t zoom;
+    uint8_t antialias;
+} lv_img_rot_cache_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_img_rot_cache_entry_t * find_entry(const void * src, int16_t angle, const lv_draw_img_dsc_t * draw_dsc);
+static lv_img_rot_cache_entry_t * alloc_entry(uint32_t size);
+static uint8_t * alloc_buf(uint32_t size);
+static void free_entry(lv_img_rot_cache_entry_t * entry);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_img_rot_cache_entry_t entries[DLG_LVGL_IMG_ROT_CACHE_ENTRIES];
+static lv_img_rot_cache_stat_t stat;
+static uint32_t use_cnt;
+#if DLG_LVGL_IMG_ROT_CACHE_ADR == 0
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT pool_int[DLG_LVGL_IMG_ROT_CACHE_SIZE / sizeof(MEM_UNIT)];
+    #define POOL                                ((uint8_t *)pool_int)
+#else
+    #define POOL                                ((uint8_t *)DLG_LVGL_IMG_ROT_CACHE_ADR)
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const uint8_t * _lv_img_rot_cache_open(const void * src, const uint8_t * map_p, lv_img_cf_t cf,
+                                       lv_coord_t w, lv_coord_t h, const lv_draw_img_dsc_t * draw_dsc,
+                                       lv_area_t * sprite_area)
+{
+    /*The pixels of the other sources don't stay at the same place*/
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return NULL;
+
+    /*The GPU can't turn these into ARGB8888 pixels*/
+    lv_img_cf_t cf_base = cf & ~LV_IMG_CF_RLE_FLAG;
+    if(lv_img_cf_is_chroma_keyed(cf_base) ||
+       (cf_base >= LV_IMG_CF_ALPHA_1BIT && cf_base <= LV_IMG_CF_ALPHA_8BIT)) {
+        return NULL;
+    }
+
+    int32_t angle = ((draw_dsc->angle + DLG_LVGL_IMG_ROT_CACHE_ANGLE_STEP / 2) / DLG_LVGL_IMG_ROT_CACHE_ANGLE_STEP) *
+                    DLG_LVGL_IMG_ROT_CACHE_ANGLE_STEP;
+    if(angle >= 3600) angle -= 3600;
+
+    use_cnt++;
+
+    lv_img_rot_cache_entry_t * entry = find_entry(src, angle, draw_dsc);
+    if(entry) {
+        stat.hit_cnt++;
+        entry->last_use = use_cnt;
+        lv_area_copy(sprite_area, &entry->area);
+        return entry->buf;
+    }
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_drv_t * drv = disp->driver;
+    if(drv->gpu_config_blit_cb == NULL || drv->gpu_blit_cb == NULL) return NULL;
+
+    /*Same area as the one `lv_img` invalidates for this angle*/
+    lv_area_t area;
+    _lv_img_buf_get_transformed_area(&area, w, h, angle, draw_dsc->zoom, &draw_dsc->pivot);
+
+    uint32_t size = lv_area_get_size(&area) * SPRITE_PX_SIZE;
+    if(size > DLG_LVGL_IMG_ROT_CACHE_SIZE / 2) return NULL;
+
+    /*Render the sprite without blending: the opacity and the recoloring are applied when it is drawn*/
+    lv_draw_img_dsc_t dsc;
+    lv_memcpy_small(&dsc, draw_dsc, sizeof(dsc));
+    dsc.angle = angle;
+    dsc.opa = LV_OPA_COVER;
+    dsc.recolor_opa = LV_OPA_TRANSP;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    if(!drv->gpu_config_blit_cb(drv, &dsc, LV_IMG_CF_ARGB8888, cf, lv_img_cf_has_alpha(cf_base), false, false, false)) {
+        return NULL;
+    }
+
+    entry = alloc_entry(size);
+    if(entry == NULL) return NULL;
+
+    entry->src = src;
+    entry->size = size;
+    entry->last_use = use_cnt;
+    entry->angle = angle;
+    entry->zoom = draw_dsc->zoom;
+    entry->antialias = draw_dsc->antialias;
+    entry->pivot = draw_dsc->pivot;
+    lv_area_copy(&entry->area, &area);
+
+    /*The quad covers only a part of the sprite*/
+    lv_memset_00(entry->buf, size);
+
+    lv_area_t dst_area;
+    lv_area_t map_area;
+    lv_area_set(&dst_area, 0, 0, lv_area_get_width(&area) - 1, lv_area_get_height(&area) - 1);
+    lv_area_set(&map_area, 0, 0, w - 1, h - 1);
+    lv_area_move(&map_area, -area.x1, -area.y1);
+    drv->gpu_blit_cb(drv, (lv_color_t *)entry->buf, &dst_area, lv_area_get_width(&area),
+                     (const lv_color_t *)map_p, &map_area, LV_OPA_COVER);
+    if(drv->gpu_wait_cb) drv->gpu_wait_cb(drv);
+
+    stat.miss_cnt++;
+    lv_area_copy(sprite_area, &area);
+    return entry->buf;
+}
+
+void lv_img_rot_cache_invalidate_src(const void * src)
+{
+    uint32_t i;
+    bool gpu_idle = false;
+
+    for(i = 0; i < DLG_LVGL_IMG_ROT_CACHE_ENTRIES; i++) {
+        if(entries[i].buf == NULL || (src != NULL && entries[i].src != src)) continue;
+
+        /*The GPU might still read the sprite*/
+        if(!gpu_idle) {
+            lv_disp_t * disp = lv_disp_get_default();
+            if(disp && disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+            gpu_idle = true;
+        }
+        free_entry(&entries[i]);
+    }
+}
+
+void lv_img_rot_cache_get_stat(lv_img_rot_cache_stat_t * stat_p)
+{
+    lv_memcpy_small(stat_p, &stat, sizeof(stat));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_img_rot_cache_entry_t * find_entry(const void * src, int16_t angle, const lv_draw_img_dsc_t * draw_dsc)
+{
+    uint32_t i;
+    for(i = 0; i < DLG_LVGL_IMG_ROT_CACHE_ENTRIES; i++) {
+        lv_img_rot_cache_entry_t * entry = &entries[i];
+        if(entry->buf && entry->src == src && entry->angle == angle && entry->zoom == draw_dsc->zoom &&
+           entry->pivot.x == draw_dsc->pivot.x && entry->pivot.y == draw_dsc->pivot.y &&
+           entry->antialias == draw_dsc->antialias) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Allocate a sprite, dropping the least recently used ones until it fits into the pool
+ */
+static lv_img_rot_cache_entry_t * alloc_entry(uint32_t size)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    bool gpu_idle = false;
+
+    while(1) {
+        lv_img_rot_cache_entry_t * lru = NULL;
+        lv_img_rot_cache_entry_t * empty = NULL;
+        uint32_t i;
+        for(i = 0; i < DLG_LVGL_IMG_ROT_CACHE_ENTRIES; i++) {
+            if(entries[i].buf == NULL) {
+                if(empty == NULL) empty = &entries[i];
+            }
+            else if(lru == NULL || use_cnt - entries[i].last_use > use_cnt - lru->last_use) {
+                lru = &entries[i];
+            }
+        }
+
+        if(empty) {
+            empty->buf = alloc_buf(size);
+            if(empty->buf) {
+                stat.size += size;
+                stat.entry_cnt++;
+                return empty;
+            }
+        }
+
+        /*Nothing left to drop*/
+        if(lru == NULL) return NULL;
+
+        /*The sprite might be read by a pending blit*/
+        if(!gpu_idle) {
+            if(disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+            gpu_idle = true;
+        }
+
+        free_entry(lru);
+        stat.evict_cnt++;
+    }
+}
+
+/**
+ * Find the first gap of the pool between the sprites where `size` bytes fit.
+ * There are only a few sprites, a general allocator would not pay off.
+ */
+static uint8_t * alloc_buf(uint32_t size)
+{
+    uint8_t * start = POOL;
+    size = (size + sizeof(MEM_UNIT) - 1) & ~(sizeof(MEM_UNIT) - 1);
+
+    while(1) {
+        /*The sprite starting next after `start`*/
+        lv_img_rot_cache_entry_t * next = NULL;
+        uint32_t i;
+        for(i = 0; i < DLG_LVGL_IMG_ROT_CACHE_ENTRIES; i++) {
+            if(entries[i].buf && entries[i].buf >= start && (next == NULL || entries[i].buf < next->buf)) {
+                next = &entries[i];
+            }
+        }
+
+        uint8_t * end = next ? next->buf : POOL + DLG_LVGL_IMG_ROT_CACHE_SIZE;
+        if((uint32_t)(end - start) >= size) return start;
+        if(next == NULL) return NULL;
+
+        start = next->buf + ((next->size + sizeof(MEM_UNIT) - 1) & ~(sizeof(MEM_UNIT) - 1));
+    }
+}
+
+static void free_entry(lv_img_rot_cache_entry_t * entry)
+{
+    stat.size -= entry->size;
+    stat.entry_cnt--;
+    lv_memset_00(entry, sizeof(lv_img_rot_cache_entry_t));
+}
+
+#endif /*DLG_LVGL_USE_IMG_ROT_CACHE*/
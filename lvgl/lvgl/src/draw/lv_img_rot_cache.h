@@ -0,0 +1,82 @@
+/**
+ * @file lv_img_rot_cache.h
+ *
+ */
+/* Copyright (c) 2022 Dialog Semiconductor */
+
+#ifndef LV_IMG_ROT_CACHE_H
+#define LV_IMG_ROT_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_img.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef DLG_LVGL_USE_IMG_ROT_CACHE
+#define DLG_LVGL_USE_IMG_ROT_CACHE 0
+#endif
+
+#if DLG_LVGL_USE_IMG_ROT_CACHE
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Counters of the rotated image cache. They are never cleared, the user can compute the change
+ * between two readings.
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Transformed images drawn from a cached sprite*/
+    uint32_t miss_cnt;      /**< Sprites rendered*/
+    uint32_t evict_cnt;     /**< Sprites dropped to make room for new ones*/
+    uint32_t size;          /**< Bytes of the cached sprites*/
+    uint32_t entry_cnt;     /**< Number of cached sprites*/
+} lv_img_rot_cache_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the rotated and/or zoomed version of an image, rendering it with the GPU on a miss.
+ * The angle is quantized to `DLG_LVGL_IMG_ROT_CACHE_ANGLE_STEP`.
+ * @param src the source of the image, used as the key together with the transformation
+ * @param map_p the decoded pixels of the image
+ * @param cf color format of `map_p`
+ * @param w width of the image
+ * @param h height of the image
+ * @param draw_dsc the transformation (angle, zoom, pivot and anti-aliasing)
+ * @param sprite_area the area of the sprite relative to the top left corner of the untransformed image
+ * @return the `LV_IMG_CF_ARGB8888` pixels of the sprite or NULL if the image can't be cached
+ */
+const uint8_t * _lv_img_rot_cache_open(const void * src, const uint8_t * map_p, lv_img_cf_t cf,
+                                       lv_coord_t w, lv_coord_t h, const lv_draw_img_dsc_t * draw_dsc,
+                                       lv_area_t * sprite_area);
+
+/**
+ * Drop the cached sprites of an image. Required if the pixels of an image changed.
+ * @param src the source of the image, NULL to drop all the sprites
+ */
+void lv_img_rot_cache_invalidate_src(const void * src);
+
+/**
+ * Get the counters of the rotated image cache
+ * @param stat the counters are copied here
+ */
+void lv_img_rot_cache_get_stat(lv_img_rot_cache_stat_t * stat);
+
+#endif /*DLG_LVGL_USE_IMG_ROT_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMG_ROT_CACHE_H*/
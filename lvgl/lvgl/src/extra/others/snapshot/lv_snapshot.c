@@ -2,6 +2,7 @@
  * @file lv_snapshot.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -143,6 +144,7 @@ lv_res_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_img_cf_t cf, lv_img_dsc_t *
     screen->spec_attr->children = &obj;
 
     obj->parent = screen;
+    _lv_style_inc_version();
 
     disp->inv_p = 0;
 
@@ -158,6 +160,7 @@ lv_res_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_img_cf_t cf, lv_img_dsc_t *
 
     /*Restore obj original parameters and clean up*/
     obj->parent = parent_old;
+    _lv_style_inc_version();
     screen->spec_attr->child_cnt = 0;
     screen->spec_attr->children = NULL;
 
@@ -13,11 +13,13 @@
 
 #include "../../draw/lv_draw_img.h"
 #include "../../draw/lv_img_cache.h"
+#include "../../draw/lv_img_rot_cache.h"
 #include "../../hal/lv_hal_disp.h"
 #include "../../misc/lv_log.h"
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_mem.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/lv_profiler.h"
 
 #include DLG_LVGL_GPU_DA1470X_INCLUDE_PATH
 
@@ -77,7 +79,9 @@ void lv_draw_img(const lv_area_t * coords, const lv_area_t * mask, const void *
     if(dsc->opa <= LV_OPA_MIN) return;
 
     lv_res_t res;
+    LV_PROFILER_BEGIN(LV_PROFILER_DRAW_IMG);
     res = lv_img_draw_core(coords, mask, src, dsc);
+    LV_PROFILER_END(LV_PROFILER_DRAW_IMG);
 
     if(res == LV_RES_INV) {
         LV_LOG_WARN("Image draw error");
@@ -134,6 +138,28 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
             return LV_RES_OK;
         }
 
+#if DLG_LVGL_USE_IMG_ROT_CACHE
+        /*Blit the transformed image rendered earlier, clipped to the area of the exact angle*/
+        if(draw_dsc->angle || draw_dsc->zoom != LV_IMG_ZOOM_NONE) {
+            lv_area_t sprite_area;
+            const uint8_t * sprite = _lv_img_rot_cache_open(src, cdsc->dec_dsc.img_data,
+                                                            cdsc->dec_dsc.header.cf | (cdsc->dec_dsc.header.rle ? LV_IMG_CF_RLE_FLAG : 0),
+                                                            lv_area_get_width(coords), lv_area_get_height(coords),
+                                                            draw_dsc, &sprite_area);
+            if(sprite) {
+                lv_draw_img_dsc_t sprite_dsc;
+                lv_memcpy_small(&sprite_dsc, draw_dsc, sizeof(sprite_dsc));
+                sprite_dsc.angle = 0;
+                sprite_dsc.zoom = LV_IMG_ZOOM_NONE;
+                lv_area_move(&sprite_area, coords->x1, coords->y1);
+
+                lv_draw_map(&sprite_area, &mask_com, sprite, &sprite_dsc, LV_IMG_CF_ARGB8888, false, true);
+                draw_cleanup(cdsc);
+                return LV_RES_OK;
+            }
+        }
+#endif /* DLG_LVGL_USE_IMG_ROT_CACHE */
+
         lv_draw_map(coords, &mask_com, cdsc->dec_dsc.img_data, draw_dsc,
 #if (DLG_LVGL_CF == 1)
                 cdsc->dec_dsc.header.cf | (cdsc->dec_dsc.header.rle ? LV_IMG_CF_RLE_FLAG : 0),
@@ -177,9 +203,10 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
                 return LV_RES_INV;
             }
 
+            /*The decoder returns uncompressed lines*/
             lv_draw_map(&line, &mask_line, buf, draw_dsc,
 #if (DLG_LVGL_CF == 1)
-                cdsc->dec_dsc.header.cf | (cdsc->dec_dsc.header.rle ? LV_IMG_CF_RLE_FLAG : 0),
+                cdsc->dec_dsc.header.cf,
 #endif /* DLG_LVGL_CF */
                 chroma_keyed, alpha_byte);
             line.y1++;
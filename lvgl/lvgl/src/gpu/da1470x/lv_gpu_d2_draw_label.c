@@ -17,6 +17,7 @@
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_bidi.h"
 #include "../../misc/lv_assert.h"
+#include "../../draw/lv_glyph_cache.h"
 
 #include DLG_LVGL_GPU_DA1470X_INCLUDE_PATH
 
@@ -26,6 +27,11 @@
 #define LABEL_RECOLOR_PAR_LENGTH 6
 #define LV_LABEL_HINT_UPDATE_TH 1024 /*Update the "hint" if the label's y coordinates have changed more then this*/
 
+/*Max. number of letters drawn by one GPU job*/
+#ifndef DLG_LVGL_TEXT_BATCH_SIZE
+    #define DLG_LVGL_TEXT_BATCH_SIZE 32
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -36,6 +42,20 @@ enum {
 };
 typedef uint8_t cmd_state_t;
 
+#if DLG_LVGL_USE_GLYPH_CACHE
+/*Letters waiting to be drawn by the GPU. They have the same color, opacity and destination.*/
+typedef struct {
+    lv_gpu_blit_t blits[DLG_LVGL_TEXT_BATCH_SIZE];
+    uint32_t blit_cnt;
+    lv_color_t * dest_buf;
+    lv_coord_t dest_pitch;
+    lv_color_t color;
+    lv_opa_t opa;
+    lv_blend_mode_t blend_mode;
+    bool open;
+} text_batch_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -49,9 +69,20 @@ static void draw_letter_subpx(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_
                               const uint8_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
 #endif
 
+#if DLG_LVGL_USE_GLYPH_CACHE
+static bool draw_letter_cached(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g,
+                               const lv_area_t * clip_area, const lv_font_t * font_p, uint32_t letter,
+                               lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
+static bool text_batch_config(lv_disp_drv_t * drv, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
+static void text_batch_flush(void);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if DLG_LVGL_USE_GLYPH_CACHE
+static text_batch_t text_batch;
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -71,6 +102,21 @@ extern const uint8_t _lv_bpp8_opa_table[256];
  *   GLOBAL FUNCTIONS
  **********************/
 
+void _lv_draw_letter_batch_begin(void)
+{
+#if DLG_LVGL_USE_GLYPH_CACHE
+    text_batch.open = true;
+#endif
+}
+
+void _lv_draw_letter_batch_end(void)
+{
+#if DLG_LVGL_USE_GLYPH_CACHE
+    text_batch_flush();
+    text_batch.open = false;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -124,6 +170,16 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_letter(const lv_point_t * pos_p, const lv_are
         return;
     }
 
+#if DLG_LVGL_USE_GLYPH_CACHE
+    if(!font_p->subpx &&
+       draw_letter_cached(pos_x, pos_y, &g, clip_area, font_p, letter, color, opa, blend_mode)) {
+        return;
+    }
+
+    /*Drawn by the CPU, the queued letters have to be drawn before*/
+    text_batch_flush();
+#endif
+
     const uint8_t * map_p = lv_font_get_glyph_bitmap(font_p, letter);
     if(map_p == NULL) {
         LV_LOG_WARN("lv_draw_letter: character's bitmap not found");
@@ -301,6 +357,104 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_coord_t pos_x, lv_coord_
     lv_mem_buf_release(mask_buf);
 }
 
+#if DLG_LVGL_USE_GLYPH_CACHE
+/**
+ * Draw a letter from the glyph cache with a single A8 blit of the GPU, colorized with the text color.
+ * Inside `_lv_draw_letter_batch_begin/end()` the blit is only queued.
+ * @return false if the letter has to be drawn by the CPU (masks, no GPU or glyph not cacheable)
+ */
+static bool draw_letter_cached(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g,
+                               const lv_area_t * clip_area, const lv_font_t * font_p, uint32_t letter,
+                               lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_drv_t * drv = disp->driver;
+    if(drv->gpu_blit_cb == NULL || drv->gpu_config_blit_cb == NULL || drv->set_px_cb) return false;
+
+    lv_area_t letter_area;
+    lv_area_set(&letter_area, pos_x, pos_y, pos_x + g->box_w - 1, pos_y + g->box_h - 1);
+    if(lv_draw_mask_is_any(&letter_area)) return false;
+
+    const uint8_t * glyph = _lv_glyph_cache_find(font_p, letter);
+    if(glyph == NULL) {
+        /*Decoding might clear the atlas page of a queued letter*/
+        text_batch_flush();
+        glyph = _lv_glyph_cache_add(font_p, letter, g);
+        if(glyph == NULL) return false;
+    }
+
+    /*Relative to the draw buffer*/
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
+    const lv_area_t * disp_area = &draw_buf->area;
+    lv_area_t draw_area;
+    if(!_lv_area_intersect(&draw_area, clip_area, &letter_area)) return true;
+    lv_area_move(&draw_area, -disp_area->x1, -disp_area->y1);
+    lv_area_move(&letter_area, -disp_area->x1, -disp_area->y1);
+
+    if(text_batch.open && drv->gpu_blit_batch_cb) {
+        if(text_batch.blit_cnt &&
+           (text_batch.blit_cnt == DLG_LVGL_TEXT_BATCH_SIZE || text_batch.dest_buf != draw_buf->buf_act ||
+            text_batch.color.full != color.full || text_batch.opa != opa || text_batch.blend_mode != blend_mode)) {
+            text_batch_flush();
+        }
+
+        if(text_batch.blit_cnt == 0) {
+            /*Only to know if the GPU can draw it, the batch is configured again when it's started*/
+            if(!text_batch_config(drv, color, opa, blend_mode)) return false;
+
+            text_batch.dest_buf = draw_buf->buf_act;
+            text_batch.dest_pitch = lv_area_get_width(disp_area);
+            text_batch.color = color;
+            text_batch.opa = opa;
+            text_batch.blend_mode = blend_mode;
+        }
+
+        lv_gpu_blit_t * blit = &text_batch.blits[text_batch.blit_cnt++];
+        blit->src_buf = (const lv_color_t *)glyph;
+        blit->src_area = letter_area;
+        blit->dest_area = draw_area;
+        blit->mirror = 0;
+        return true;
+    }
+
+    if(!text_batch_config(drv, color, opa, blend_mode)) return false;
+
+    if(drv->gpu_wait_cb) drv->gpu_wait_cb(drv);
+    drv->gpu_blit_cb(drv, draw_buf->buf_act, &draw_area, lv_area_get_width(disp_area),
+                     (const lv_color_t *)glyph, &letter_area, opa);
+
+    return true;
+}
+
+static bool text_batch_config(lv_disp_drv_t * drv, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode)
+{
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+    dsc.recolor = color;
+    dsc.opa = opa;
+    dsc.blend_mode = blend_mode;
+
+    return drv->gpu_config_blit_cb(drv, &dsc, LV_IMG_CF_TRUE_COLOR, LV_IMG_CF_ALPHA_8BIT, true, false, true, true);
+}
+
+/**
+ * Draw the queued letters with one GPU job
+ */
+static void text_batch_flush(void)
+{
+    if(text_batch.blit_cnt == 0) return;
+
+    lv_disp_drv_t * drv = _lv_refr_get_disp_refreshing()->driver;
+    if(text_batch_config(drv, text_batch.color, text_batch.opa, text_batch.blend_mode)) {
+        if(drv->gpu_wait_cb) drv->gpu_wait_cb(drv);
+        drv->gpu_blit_batch_cb(drv, text_batch.dest_buf, text_batch.dest_pitch, text_batch.blits,
+                               text_batch.blit_cnt, text_batch.opa);
+    }
+
+    text_batch.blit_cnt = 0;
+}
+#endif
+
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g, const lv_area_t * clip_area,
                               const uint8_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode)
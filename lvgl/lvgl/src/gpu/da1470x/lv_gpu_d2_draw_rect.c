@@ -14,10 +14,12 @@
 #include "../../draw/lv_draw_rect.h"
 #include "../../draw/lv_draw_blend.h"
 #include "../../draw/lv_draw_mask.h"
+#include "../../draw/lv_corner_cache.h"
 #include "../../misc/lv_math.h"
 #include "../../misc/lv_txt_ap.h"
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_assert.h"
+#include "../../misc/lv_profiler.h"
 
 #include DLG_LVGL_GPU_DA1470X_INCLUDE_PATH
 
@@ -62,6 +64,18 @@ static void draw_border_simple(const lv_area_t * clip, const lv_area_t * outer_a
     LV_ATTRIBUTE_FAST_MEM static inline lv_color_t grad_get(const lv_draw_rect_dsc_t * dsc, lv_coord_t s, lv_coord_t i);
 #endif
 
+#if LV_DRAW_COMPLEX
+static bool draw_rect_shape_gpu(const lv_area_t * coords, const lv_area_t * clip, lv_coord_t r, lv_coord_t width,
+                                lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
+#endif
+
+#if LV_DRAW_COMPLEX && DLG_LVGL_USE_CORNER_CACHE
+static bool corners_gpu_available(lv_blend_mode_t blend_mode);
+static void draw_corners_gpu(const lv_opa_t * corner, lv_coord_t size, const lv_area_t * coords,
+                             lv_area_t draw_areas[4], const uint8_t mirror[4],
+                             lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -102,6 +116,7 @@ LV_ATTRIBUTE_FAST_MEM lv_img_cf_t _get_cf(const lv_draw_rect_dsc_t * dsc)
 void lv_draw_rect(const lv_area_t * coords, const lv_area_t * clip, const lv_draw_rect_dsc_t * dsc)
 {
     if(lv_area_get_height(coords) < 1 || lv_area_get_width(coords) < 1) return;
+    LV_PROFILER_BEGIN(LV_PROFILER_DRAW_RECT);
 #if LV_DRAW_COMPLEX
     draw_shadow(coords, clip, dsc);
 #endif
@@ -113,6 +128,7 @@ void lv_draw_rect(const lv_area_t * coords, const lv_area_t * clip, const lv_dra
 
     draw_outline(coords, clip, dsc);
 
+    LV_PROFILER_END(LV_PROFILER_DRAW_RECT);
     LV_ASSERT_MEM_INTEGRITY();
 }
 
@@ -164,6 +180,11 @@ LV_ATTRIBUTE_FAST_MEM static void draw_bg(const lv_area_t * coords, const lv_are
     int32_t short_side = LV_MIN(coords_w, coords_h);
     int32_t rout = LV_MIN(dsc->radius, short_side >> 1);
 
+    if(!mask_any && grad_dir == LV_GRAD_DIR_NONE &&
+       draw_rect_shape_gpu(&coords_bg, &draw_area, rout, 0, dsc->bg_color, opa, dsc->blend_mode)) {
+        return;
+    }
+
     /*Add a radius mask if there is radius*/
     int32_t draw_area_w = lv_area_get_width(&draw_area);
     int16_t mask_rout_id = LV_MASK_ID_INV;
@@ -496,7 +517,22 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
 
     lv_opa_t * sh_buf;
 
-#if LV_SHADOW_CACHE_SIZE
+#if DLG_LVGL_USE_CORNER_CACHE
+    /*The corner only depends on the radius and the width if the other corners are out of it*/
+    const lv_opa_t * sh_corner = NULL;
+    bool cacheable = lv_area_get_width(&core_area) >= corner_size && lv_area_get_height(&core_area) >= corner_size;
+    if(cacheable) sh_corner = _lv_corner_cache_find(r_sh, dsc->shadow_width);
+
+    /*The CPU parts mirror their copy in place*/
+    sh_buf = lv_mem_buf_get(corner_size * corner_size * sizeof(uint16_t));
+    if(sh_corner) {
+        lv_memcpy(sh_buf, sh_corner, corner_size * corner_size);
+    }
+    else {
+        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->shadow_width, r_sh);
+        if(cacheable) sh_corner = _lv_corner_cache_add(r_sh, dsc->shadow_width, sh_buf);
+    }
+#elif LV_SHADOW_CACHE_SIZE
     if(sh_cache_size == corner_size && sh_cache_r == r_sh) {
         /*Use the cache if available*/
         sh_buf = lv_mem_buf_get(corner_size * corner_size);
@@ -544,6 +580,34 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
     lv_coord_t w_half = shadow_area.x1 + lv_area_get_width(&shadow_area) / 2;
     lv_coord_t h_half = shadow_area.y1 + lv_area_get_height(&shadow_area) / 2;
 
+    bool corners_cpu = true;
+#if DLG_LVGL_USE_CORNER_CACHE
+    /*Without masks the four corners are the cached corner blitted by the GPU, mirrored*/
+    if(simple && sh_corner && corners_gpu_available(dsc->blend_mode)) {
+        static const uint8_t mirror[4] = {LV_GPU_BLIT_MIRROR_HOR, 0, LV_GPU_BLIT_MIRROR_HOR | LV_GPU_BLIT_MIRROR_VER, LV_GPU_BLIT_MIRROR_VER};
+        lv_coord_t left_x2 = LV_MIN(shadow_area.x1 + corner_size - 1, w_half - 1);
+        lv_coord_t right_x1 = LV_MAX(shadow_area.x2 - corner_size + 1, w_half);
+        lv_coord_t top_y2 = LV_MIN(shadow_area.y1 + corner_size - 1, h_half);
+        lv_coord_t bottom_y1 = LV_MAX(shadow_area.y2 - corner_size + 1, h_half + 1);
+        lv_area_t corners[4];
+        lv_area_set(&corners[0], shadow_area.x1, shadow_area.y1, left_x2, top_y2);
+        lv_area_set(&corners[1], right_x1, shadow_area.y1, shadow_area.x2, top_y2);
+        lv_area_set(&corners[2], shadow_area.x1, bottom_y1, left_x2, shadow_area.y2);
+        lv_area_set(&corners[3], right_x1, bottom_y1, shadow_area.x2, shadow_area.y2);
+
+        uint32_t i;
+        for(i = 0; i < 4; i++) {
+            if(!_lv_area_intersect(&corners[i], &corners[i], clip) || _lv_area_is_in(&corners[i], &bg_area, r_bg)) {
+                lv_area_set(&corners[i], 0, 0, -1, -1);
+            }
+        }
+
+        draw_corners_gpu(sh_corner, corner_size, &shadow_area, corners, mirror, dsc->shadow_color, dsc->shadow_opa,
+                         dsc->blend_mode);
+        corners_cpu = false;
+    }
+#endif
+
     /*Draw the corners if they are on the current clip area and not fully covered by the bg*/
 
     /*Top right corner*/
@@ -555,7 +619,8 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
     blend_area.x1 = LV_MAX(blend_area.x1, w_half);
     blend_area.y2 = LV_MIN(blend_area.y2, h_half);
 
-    if(_lv_area_intersect(&clip_area_sub, &blend_area, clip) && !_lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
+    if(corners_cpu && _lv_area_intersect(&clip_area_sub, &blend_area, clip) &&
+       !_lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
         lv_coord_t w = lv_area_get_width(&clip_area_sub);
         sh_buf_tmp = sh_buf;
         sh_buf_tmp += (clip_area_sub.y1 - shadow_area.y1) * corner_size;
@@ -592,7 +657,8 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
     blend_area.x1 = LV_MAX(blend_area.x1, w_half);
     blend_area.y1 = LV_MAX(blend_area.y1, h_half + 1);
 
-    if(_lv_area_intersect(&clip_area_sub, &blend_area, clip) && !_lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
+    if(corners_cpu && _lv_area_intersect(&clip_area_sub, &blend_area, clip) &&
+       !_lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
         lv_coord_t w = lv_area_get_width(&clip_area_sub);
         sh_buf_tmp = sh_buf;
         sh_buf_tmp += (blend_area.y2 - clip_area_sub.y2) * corner_size;
@@ -794,7 +860,8 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
     blend_area.x2 = LV_MIN(blend_area.x2, w_half - 1);
     blend_area.y2 = LV_MIN(blend_area.y2, h_half);
 
-    if(_lv_area_intersect(&clip_area_sub, &blend_area, clip) && !_lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
+    if(corners_cpu && _lv_area_intersect(&clip_area_sub, &blend_area, clip) &&
+       !_lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
         lv_coord_t w = lv_area_get_width(&clip_area_sub);
         sh_buf_tmp = sh_buf;
         sh_buf_tmp += (clip_area_sub.y1 - blend_area.y1) * corner_size;
@@ -832,7 +899,8 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
     blend_area.y1 = LV_MAX(blend_area.y1, h_half + 1);
     blend_area.x2 = LV_MIN(blend_area.x2, w_half - 1);
 
-    if(_lv_area_intersect(&clip_area_sub, &blend_area, clip) && !_lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
+    if(corners_cpu && _lv_area_intersect(&clip_area_sub, &blend_area, clip) &&
+       !_lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
         lv_coord_t w = lv_area_get_width(&clip_area_sub);
         sh_buf_tmp = sh_buf;
         sh_buf_tmp += (blend_area.y2 - clip_area_sub.y2) * corner_size;
@@ -1115,6 +1183,14 @@ void draw_border_generic(const lv_area_t * clip_area, const lv_area_t * outer_ar
 
     bool mask_any = lv_draw_mask_is_any(outer_area);
 
+    /*A border of the same width on every side is a rounded outline for the GPU*/
+    lv_coord_t bw = rout - rin;
+    if(!mask_any && inner_area->x1 - outer_area->x1 == bw && outer_area->x2 - inner_area->x2 == bw &&
+       inner_area->y1 - outer_area->y1 == bw && outer_area->y2 - inner_area->y2 == bw &&
+       draw_rect_shape_gpu(outer_area, &draw_area, rout, bw, color, opa, blend_mode)) {
+        return;
+    }
+
     /*Create a mask if there is a radius*/
     lv_opa_t * mask_buf = lv_mem_buf_get(draw_area_w);
 
@@ -1356,4 +1432,101 @@ static void draw_border_simple(const lv_area_t * clip, const lv_area_t * outer_a
 
 }
 
+#if LV_DRAW_COMPLEX
+/**
+ * Draw a rounded rectangle or a rounded border with the shape primitives of the GPU: the corners are
+ * anti-aliased circles computed by the GPU instead of masked lines
+ * @param coords the rectangle
+ * @param clip the part of the rectangle to draw
+ * @param r the clamped radius
+ * @param width the width of the border, 0 to fill the rectangle
+ * @return false if the rectangle has to be drawn with masks
+ */
+static bool draw_rect_shape_gpu(const lv_area_t * coords, const lv_area_t * clip, lv_coord_t r, lv_coord_t width,
+                                lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_drv_t * drv = disp->driver;
+    if(r <= 0 || drv->gpu_draw_shape_cb == NULL || drv->set_px_cb || blend_mode != LV_BLEND_MODE_NORMAL) return false;
+
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
+    const lv_area_t * disp_area = &draw_buf->area;
+
+    lv_gpu_shape_t shape;
+    lv_memset_00(&shape, sizeof(shape));
+    shape.type = LV_GPU_SHAPE_RECT;
+    shape.width = width;
+    shape.radius = r;
+
+    /*Relative to the draw buffer*/
+    lv_area_t clip_rel;
+    lv_area_copy(&shape.area, coords);
+    lv_area_copy(&clip_rel, clip);
+    lv_area_move(&shape.area, -disp_area->x1, -disp_area->y1);
+    lv_area_move(&clip_rel, -disp_area->x1, -disp_area->y1);
+
+    if(drv->gpu_wait_cb) drv->gpu_wait_cb(drv);
+    return drv->gpu_draw_shape_cb(drv, draw_buf->buf_act, lv_area_get_width(disp_area), &clip_rel, &shape, color, opa);
+}
+#endif /*LV_DRAW_COMPLEX*/
+
+#if LV_DRAW_COMPLEX && DLG_LVGL_USE_CORNER_CACHE
+static bool corners_gpu_available(lv_blend_mode_t blend_mode)
+{
+    lv_disp_drv_t * drv = _lv_refr_get_disp_refreshing()->driver;
+    if(drv->gpu_blit_batch_cb == NULL || drv->gpu_config_blit_cb == NULL || drv->set_px_cb) return false;
+
+    return blend_mode == LV_BLEND_MODE_NORMAL || blend_mode == LV_BLEND_MODE_ADDITIVE;
+}
+
+/**
+ * Blit a cached corner to the four corners of an area with one GPU job, colorized with `color`
+ * @param corner the opacities of the corner, `size` x `size`
+ * @param coords the area, each corner is `size` x `size` in it
+ * @param draw_areas the part of each corner to draw (top left, top right, bottom left, bottom right),
+ *                   an empty area to skip it
+ * @param mirror how `corner` is flipped for each corner
+ */
+static void draw_corners_gpu(const lv_opa_t * corner, lv_coord_t size, const lv_area_t * coords,
+                             lv_area_t draw_areas[4], const uint8_t mirror[4],
+                             lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_drv_t * drv = disp->driver;
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
+    const lv_area_t * disp_area = &draw_buf->area;
+    lv_gpu_blit_t blits[4];
+    uint32_t blit_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        if(lv_area_get_width(&draw_areas[i]) <= 0 || lv_area_get_height(&draw_areas[i]) <= 0) continue;
+
+        lv_gpu_blit_t * blit = &blits[blit_cnt++];
+        lv_coord_t x1 = (i & 1) ? coords->x2 - size + 1 : coords->x1;
+        lv_coord_t y1 = (i & 2) ? coords->y2 - size + 1 : coords->y1;
+        blit->src_buf = (const lv_color_t *)corner;
+        lv_area_set(&blit->src_area, x1, y1, x1 + size - 1, y1 + size - 1);
+        blit->dest_area = draw_areas[i];
+        blit->mirror = mirror[i];
+
+        /*Relative to the draw buffer*/
+        lv_area_move(&blit->src_area, -disp_area->x1, -disp_area->y1);
+        lv_area_move(&blit->dest_area, -disp_area->x1, -disp_area->y1);
+    }
+    if(blit_cnt == 0) return;
+
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+    dsc.recolor = color;
+    dsc.opa = opa;
+    dsc.blend_mode = blend_mode;
+
+    if(drv->gpu_wait_cb) drv->gpu_wait_cb(drv);
+    if(drv->gpu_config_blit_cb(drv, &dsc, LV_IMG_CF_TRUE_COLOR, LV_IMG_CF_ALPHA_8BIT, true, false, true, true)) {
+        drv->gpu_blit_batch_cb(drv, draw_buf->buf_act, lv_area_get_width(disp_area), blits, blit_cnt, opa);
+    }
+}
+#endif /*LV_DRAW_COMPLEX && DLG_LVGL_USE_CORNER_CACHE*/
+
 #endif /* DLG_LVGL_USE_GPU_DA1470X */
@@ -33,6 +33,10 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /*Buffer size for invalid areas*/
 #endif
 
+/*Flip the image of a batched BLIT (`lv_gpu_blit_t`) in its `src_area`*/
+#define LV_GPU_BLIT_MIRROR_HOR 0x01
+#define LV_GPU_BLIT_MIRROR_VER 0x02
+
 #ifndef LV_ATTRIBUTE_FLUSH_READY
 #define LV_ATTRIBUTE_FLUSH_READY
 #endif
@@ -72,6 +76,42 @@ typedef enum {
     LV_DISP_ROT_270
 } lv_disp_rot_t;
 
+/**
+ * An image of a batched BLIT (see `gpu_blit_batch_cb`). The areas are relative to the destination buffer.
+ */
+typedef struct {
+    const lv_color_t * src_buf;
+    lv_area_t src_area;             /**< Where the whole image would be drawn*/
+    lv_area_t dest_area;            /**< The part of `src_area` to draw*/
+    uint8_t mirror;                 /**< `LV_GPU_BLIT_MIRROR_...` flags*/
+} lv_gpu_blit_t;
+
+enum {
+    LV_GPU_SHAPE_RECT,              /**< Rectangle of `area` with `radius`, filled or a border of `width`*/
+    LV_GPU_SHAPE_ARC,               /**< Arc from `start_angle` to `end_angle` (degrees, clockwise from the right),
+                                         `width` inside the circle of `center` and `radius`*/
+    LV_GPU_SHAPE_LINE,              /**< Line of `width` from `p1` to `p2`*/
+};
+typedef uint8_t lv_gpu_shape_type_t;
+
+/**
+ * An anti-aliased shape drawn with the primitives of the GPU (see `gpu_draw_shape_cb`).
+ * The coordinates are relative to the destination buffer.
+ */
+typedef struct {
+    lv_gpu_shape_type_t type;
+    uint8_t round_start : 1;        /**< ARC, LINE: round end at `start_angle` or `p1`*/
+    uint8_t round_end : 1;          /**< ARC, LINE: round end at `end_angle` or `p2`*/
+    lv_coord_t width;               /**< RECT: 0 to fill it*/
+    lv_coord_t radius;
+    lv_area_t area;
+    lv_point_t center;
+    uint16_t start_angle;
+    uint16_t end_angle;
+    lv_point_t p1;
+    lv_point_t p2;
+} lv_gpu_shape_t;
+
 /**
  * Display Driver structure to be registered by HAL.
  * Only its pointer will be saved in `lv_disp_t` so it should be declared as
@@ -92,6 +132,9 @@ typedef struct _lv_disp_drv_t {
     lv_disp_draw_buf_t * draw_buf;
 
     uint32_t full_refresh : 1;       /**< 1: Always make the whole screen redrawn*/
+    uint32_t direct_mode : 1;        /**< 1: Draw the invalidated areas in place into screen sized buffers.
+                                       * `flush_cb` is called for every area and the buffers are swapped
+                                       * only after the last one. The driver has to keep the buffers in sync*/
     uint32_t sw_rotate : 1;          /**< 1: use software rotation (slower)*/
     uint32_t antialiasing : 1;       /**< 1: anti-aliasing is enabled on this display.*/
     uint32_t rotated : 2;            /**< 1: turn the display by 90 degree. @warning Does not update coordinates for you!*/
@@ -100,6 +143,10 @@ typedef struct _lv_disp_drv_t {
 
     uint32_t dpi : 10;              /** DPI (dot per inch) of the display. Default value is `LV_DPI_DEF`.*/
 
+    /** Pipelined refresh: with two draw buffers, draw the areas in parts (tiles) of at most this many pixels
+     * so that the flushing of a tile runs while the next one is drawn. 0: use the whole draw buffer*/
+    uint32_t tile_size;
+
     /** MANDATORY: Write the internal buffer (draw_buf) to the display. 'lv_disp_flush_ready()' has to be
      * called when finished*/
     void (*flush_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
@@ -108,6 +155,11 @@ typedef struct _lv_disp_drv_t {
      * E.g. round `y` to, 8, 16 ..) on a monochrome display*/
     void (*rounder_cb)(struct _lv_disp_drv_t * disp_drv, lv_area_t * area);
 
+    /** OPTIONAL: Return the cost (e.g. the time) of refreshing an already rounded area in `flush_cnt` flushes.
+     * If set, the invalidated areas are merged, split or promoted to a full screen refresh to minimize the
+     * total cost instead of merging overlapping areas by pixel count*/
+    uint32_t (*refr_cost_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area, uint32_t flush_cnt);
+
     /** OPTIONAL: Set a pixel in a buffer according to the special requirements of the display
      * Can be used for color format not supported in LittelvGL. E.g. 2 bit -> 4 gray scales
      * @note Much slower then drawing with supported color formats.*/
@@ -148,9 +200,23 @@ typedef struct _lv_disp_drv_t {
     void (*gpu_blit_with_mask_cb)(struct _lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area, lv_coord_t dest_pitch,
                                   const lv_color_t * src_buf, const lv_area_t * src_area, const lv_opa_t * msk, uint32_t * work_buf, lv_opa_t opa);
 
+    /** OPTIONAL: BLIT several images into the same buffer with one GPU job, all configured by the last
+     * `gpu_config_blit_cb` (GPU only)*/
+    void (*gpu_blit_batch_cb)(struct _lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, lv_coord_t dest_pitch,
+                              const lv_gpu_blit_t * blits, uint32_t blit_cnt, lv_opa_t opa);
+
+    /** OPTIONAL: Draw a rounded rectangle, a border, an arc or a line with the shape primitives of the GPU.
+     * Return false if the GPU can't draw it, then it is drawn with masks (GPU only)*/
+    bool (*gpu_draw_shape_cb)(struct _lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, lv_coord_t dest_width,
+                              const lv_area_t * clip_area, const lv_gpu_shape_t * shape, lv_color_t color, lv_opa_t opa);
+
     /** OPTIONAL: Configure BLIT operation (GPU only)*/
     bool (*gpu_config_blit_cb)(struct _lv_disp_drv_t * disp_drv, const lv_draw_img_dsc_t * draw_dsc, lv_img_cf_t dst_cf,
                                lv_img_cf_t src_cf, bool alpha_en, bool color_key_en, bool blend_en, bool colorize_en);
+
+    /** OPTIONAL: Drop what the GPU keeps of the pixels in `data`..`data + size`, e.g. converted textures,
+     * because they are changed or freed. `data` NULL: drop everything (GPU only)*/
+    void (*gpu_invalidate_src_cb)(struct _lv_disp_drv_t * disp_drv, const void * data, uint32_t size);
 #endif
     /** On CHROMA_KEYED images this color will be transparent.
      * `LV_COLOR_CHROMA_KEY` by default. (lv_conf.h)*/
@@ -162,6 +228,26 @@ typedef struct _lv_disp_drv_t {
 
 } lv_disp_drv_t;
 
+#ifndef DLG_LVGL_USE_REFR_STAT
+#define DLG_LVGL_USE_REFR_STAT 0
+#endif
+
+/**
+ * Refresh statistics of the cost based area merging (see `refr_cost_cb`), accumulated until cleared by the user.
+ * The `_legacy` counters, only with `DLG_LVGL_USE_REFR_STAT`, tell what merging the overlapping areas by pixel count
+ * would have resulted in.
+ */
+typedef struct {
+    uint32_t refr_cnt;              /**< Refresh cycles with invalidated areas*/
+    uint32_t flush_cnt;
+    uint32_t px_cnt;
+#if DLG_LVGL_USE_REFR_STAT
+    uint32_t flush_cnt_legacy;
+    uint32_t px_cnt_legacy;
+#endif
+    uint32_t full_cnt;              /**< Refresh cycles promoted to a full screen refresh*/
+} lv_disp_refr_stat_t;
+
 /**
  * Display structure.
  * @note `lv_disp_drv_t` should be the first member of the structure.
@@ -197,6 +283,8 @@ uint8_t del_prev  :
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint16_t inv_p;
 
+    lv_disp_refr_stat_t refr_stat;  /**< Statistics of the area merging. Updated only with `refr_cost_cb`*/
+
     /*Miscellaneous data*/
     uint32_t last_activity_time;        /**< Last time when there was activity on this display*/
 } lv_disp_t;
@@ -3,6 +3,7 @@
  * General and portable implementation of malloc and free.
  * The dynamic memory monitoring is also supported.
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -12,6 +13,10 @@
 #include "lv_gc.h"
 #include "lv_assert.h"
 #include <string.h>
+#if DLG_LVGL_USE_MEM_TELEMETRY
+    #include "lv_timer.h"
+    #include "../hal/lv_hal_tick.h"
+#endif
 
 #if LV_MEM_CUSTOM != 0
     #include LV_MEM_CUSTOM_INCLUDE
@@ -39,15 +44,79 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#if LV_MEM_CUSTOM && (DLG_LVGL_USE_MEM_TELEMETRY || DLG_LVGL_USE_MEM_LARGE)
+    #error "The memory telemetry and the region of the large objects require LV_MEM_CUSTOM == 0"
+#endif
+
+#if DLG_LVGL_USE_MEM_TELEMETRY && DLG_LVGL_MEM_TAG_SITES
+    #define MEM_TAG         1
+    #define MEM_TAG_SIZE    sizeof(lv_uintptr_t)
+#else
+    #define MEM_TAG         0
+    #define MEM_TAG_SIZE    0
+#endif
+
+#if DLG_LVGL_USE_MEM_LARGE
+    #define MEM_POOL_CNT    2
+#else
+    #define MEM_POOL_CNT    1
+#endif
+
+#if DLG_LVGL_USE_MEM_BUF_POOL
+/*Size of the arena the temporal buffers are taken from while an area is refreshed*/
+#ifndef DLG_LVGL_MEM_BUF_ARENA_SIZE
+    #define DLG_LVGL_MEM_BUF_ARENA_SIZE     (4 * 1024)
+#endif
+
+/*Number of size classes of the other temporal buffers, from 64 bytes doubling.
+ *The larger buffers are allocated and freed on the heap.*/
+#ifndef DLG_LVGL_MEM_BUF_CLASSES
+    #define DLG_LVGL_MEM_BUF_CLASSES        7
+#endif
+
+/*Released buffers kept per size class, the others are given back to the heap*/
+#ifndef DLG_LVGL_MEM_BUF_CLASS_KEEP
+    #define DLG_LVGL_MEM_BUF_CLASS_KEEP     4
+#endif
+
+#define BUF_CLASS_MIN_SIZE  64
+#define BUF_CLASS_ARENA     0xFE
+#define BUF_CLASS_HEAP      0xFF
+#define BUF_ARENA_NONE      UINT32_MAX
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if DLG_LVGL_USE_MEM_BUF_POOL
+/*In front of every temporal buffer, 8 bytes to keep the buffers aligned*/
+typedef struct {
+    uint32_t prev;          /*Offset of the buffer below in the arena*/
+    uint8_t cls;            /*Size class, BUF_CLASS_ARENA or BUF_CLASS_HEAP*/
+    uint8_t used;
+    uint16_t reserved;
+} buf_hdr_t;
+
+/*Released buffer of a size class*/
+typedef struct _buf_free_t {
+    struct _buf_free_t * next;
+} buf_free_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 #if LV_MEM_CUSTOM == 0
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+    static lv_tlsf_t mem_pool_of(void * block);
+    static void * mem_pool_alloc(size_t size);
+    static void mem_pool_free(void * block);
+#endif
+#if DLG_LVGL_USE_MEM_TELEMETRY
+    static void mem_track(lv_tlsf_t pool, void * block, bool add);
+    static void map_count_walker(void * ptr, size_t size, int used, void * user);
+    static void map_write_walker(void * ptr, size_t size, int used, void * user);
+    static void map_timer_cb(lv_timer_t * timer);
 #endif
 
 /**********************
@@ -56,9 +125,36 @@
 #if LV_MEM_CUSTOM == 0
     static lv_tlsf_t tlsf;
 #endif
+#if DLG_LVGL_USE_MEM_LARGE
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT large_mem[DLG_LVGL_MEM_LARGE_SIZE / sizeof(MEM_UNIT)];
+    static lv_tlsf_t tlsf_large;
+#endif
+#if DLG_LVGL_USE_MEM_TELEMETRY
+    static uint32_t mem_used;               /*Bytes of the blocks in use in the heap*/
+    static uint32_t mem_max_used;
+    static uint32_t mem_free_biggest_min = UINT32_MAX;
+    static uint64_t walk_free_sq_sum;       /*Sum of the squares of the free block sizes*/
+    static lv_timer_t * map_timer;
+    static lv_mem_write_cb_t map_write_cb;
+    static void * map_user_data;
+#endif
 
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
+#if DLG_LVGL_USE_MEM_BUF_POOL
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT buf_arena[DLG_LVGL_MEM_BUF_ARENA_SIZE / sizeof(MEM_UNIT)];
+    static uint32_t arena_top;                      /*Offset of the first free byte*/
+    static uint32_t arena_last = BUF_ARENA_NONE;    /*Offset of the topmost buffer*/
+    static uint32_t arena_live;                     /*Buffers of the arena not released yet*/
+    static bool arena_open;
+    static buf_free_t * class_free[DLG_LVGL_MEM_BUF_CLASSES];
+    static uint8_t class_free_cnt[DLG_LVGL_MEM_BUF_CLASSES];
+    static uint32_t arena_max_used;
+    static uint32_t pool_size;
+    static uint32_t pool_max_size;
+    static uint32_t heap_cnt;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -98,6 +194,16 @@ void lv_mem_init(void)
 #endif
 #endif
 
+#if DLG_LVGL_USE_MEM_LARGE
+    tlsf_large = lv_tlsf_create_with_pool((void *)large_mem, sizeof(large_mem));
+#endif
+
+#if DLG_LVGL_USE_MEM_TELEMETRY
+    mem_used = 0;
+    mem_max_used = 0;
+    mem_free_biggest_min = UINT32_MAX;
+#endif
+
 #if LV_MEM_ADD_JUNK
     LV_LOG_WARN("LV_MEM_ADD_JUNK is enabled which makes LVGL much slower");
 #endif
@@ -111,6 +217,9 @@ void lv_mem_deinit(void)
 {
 #if LV_MEM_CUSTOM == 0
     lv_tlsf_destroy(tlsf);
+#if DLG_LVGL_USE_MEM_LARGE
+    lv_tlsf_destroy(tlsf_large);
+#endif
     lv_mem_init();
 #endif
 }
@@ -129,7 +238,13 @@ void * lv_mem_alloc(size_t size)
     }
 
 #if LV_MEM_CUSTOM == 0
-    void * alloc = lv_tlsf_malloc(tlsf, size);
+    void * alloc = mem_pool_alloc(size + MEM_TAG_SIZE);
+#if MEM_TAG
+    if(alloc != NULL) {
+        *(lv_uintptr_t *)alloc = (lv_uintptr_t)__builtin_return_address(0);
+        alloc = (uint8_t *)alloc + MEM_TAG_SIZE;
+    }
+#endif
 #else
     void * alloc = LV_MEM_CUSTOM_ALLOC(size);
 #endif
@@ -162,10 +277,11 @@ void lv_mem_free(void * data)
     if(data == NULL) return;
 
 #if LV_MEM_CUSTOM == 0
+    data = (uint8_t *)data - MEM_TAG_SIZE;
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
 #  endif
-    lv_tlsf_free(tlsf, data);
+    mem_pool_free(data);
 #else
     LV_MEM_CUSTOM_FREE(data);
 #endif
@@ -190,7 +306,42 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
 #if LV_MEM_CUSTOM == 0
-    void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
+    void * new_p = NULL;
+    if(data_p == NULL) {
+        new_p = mem_pool_alloc(new_size + MEM_TAG_SIZE);
+    }
+    else {
+        void * block = (uint8_t *)data_p - MEM_TAG_SIZE;
+        lv_tlsf_t pool = mem_pool_of(block);
+
+#if DLG_LVGL_USE_MEM_LARGE
+        /*Move the blocks crossing the threshold to the other pool*/
+        if((pool == tlsf_large) != (new_size + MEM_TAG_SIZE >= DLG_LVGL_MEM_LARGE_THRESHOLD)) {
+            new_p = mem_pool_alloc(new_size + MEM_TAG_SIZE);
+            if(new_p) {
+                lv_memcpy(new_p, block, LV_MIN(lv_tlsf_block_size(block), new_size + MEM_TAG_SIZE));
+                mem_pool_free(block);
+            }
+        }
+#endif
+
+        if(new_p == NULL) {
+#if DLG_LVGL_USE_MEM_TELEMETRY
+            mem_track(pool, block, false);
+#endif
+            new_p = lv_tlsf_realloc(pool, block, new_size + MEM_TAG_SIZE);
+#if DLG_LVGL_USE_MEM_TELEMETRY
+            mem_track(pool, new_p ? new_p : block, true);
+#endif
+        }
+    }
+
+#if MEM_TAG
+    if(new_p != NULL) {
+        *(lv_uintptr_t *)new_p = (lv_uintptr_t)__builtin_return_address(0);
+        new_p = (uint8_t *)new_p + MEM_TAG_SIZE;
+    }
+#endif
 #else
     void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
 #endif
@@ -220,6 +371,12 @@ lv_res_t lv_mem_test(void)
         LV_LOG_WARN("pool failed");
         return LV_RES_INV;
     }
+#endif
+#if DLG_LVGL_USE_MEM_LARGE
+    if(lv_tlsf_check(tlsf_large) || lv_tlsf_check_pool(lv_tlsf_get_pool(tlsf_large))) {
+        LV_LOG_WARN("large objects failed");
+        return LV_RES_INV;
+    }
 #endif
     MEM_TRACE("passed");
     return LV_RES_OK;
@@ -237,6 +394,9 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 #if LV_MEM_CUSTOM == 0
     MEM_TRACE("begin");
 
+#if DLG_LVGL_USE_MEM_TELEMETRY
+    walk_free_sq_sum = 0;
+#endif
     lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
 
     mon_p->total_size = LV_MEM_SIZE;
@@ -249,10 +409,87 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
         mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
     }
 
+#if DLG_LVGL_USE_MEM_TELEMETRY
+    if(mon_p->free_size > 0) {
+        mon_p->frag_index = 100 - (uint8_t)(walk_free_sq_sum * 100 /
+                                            ((uint64_t)mon_p->free_size * mon_p->free_size));
+    }
+    mon_p->max_used = mem_max_used;
+    mon_p->free_biggest_min = mem_free_biggest_min;
+#endif
+
+#if DLG_LVGL_USE_MEM_LARGE
+    lv_mem_monitor_t large_mon;
+    lv_memset_00(&large_mon, sizeof(large_mon));
+    lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf_large), lv_mem_walker, &large_mon);
+    mon_p->large_total_size = sizeof(large_mem);
+    mon_p->large_free_size = large_mon.free_size;
+    mon_p->large_free_biggest_size = large_mon.free_biggest_size;
+#endif
+
     MEM_TRACE("finished");
 #endif
+
+#if DLG_LVGL_USE_MEM_BUF_POOL
+    mon_p->buf_arena_size = sizeof(buf_arena);
+    mon_p->buf_arena_max_used = arena_max_used;
+    mon_p->buf_pool_size = pool_size;
+    mon_p->buf_pool_max_size = pool_max_size;
+    mon_p->buf_heap_cnt = heap_cnt;
+#endif
 }
 
+#if DLG_LVGL_USE_MEM_TELEMETRY
+uint32_t lv_mem_map_dump(lv_mem_write_cb_t write_cb, void * user_data)
+{
+    lv_tlsf_t pools[MEM_POOL_CNT] = {tlsf};
+    uint32_t pool_sizes[MEM_POOL_CNT] = {LV_MEM_SIZE};
+    uint32_t block_cnt = 0;
+#if DLG_LVGL_USE_MEM_LARGE
+    pools[1] = tlsf_large;
+    pool_sizes[1] = sizeof(large_mem);
+#endif
+
+    for(uint8_t i = 0; i < MEM_POOL_CNT; i++) {
+        lv_mem_map_header_t header;
+        lv_memset_00(&header, sizeof(header));
+        lv_memcpy(header.magic, LV_MEM_MAP_MAGIC, sizeof(header.magic));
+        header.version = LV_MEM_MAP_VERSION;
+        header.pool = i;
+        header.tagged = MEM_TAG_SIZE != 0;
+        header.site_base = (lv_uintptr_t)lv_mem_alloc;
+        header.time = lv_tick_get();
+        header.pool_size = pool_sizes[i];
+        lv_tlsf_walk_pool(lv_tlsf_get_pool(pools[i]), map_count_walker, &header.block_cnt);
+        write_cb(&header, sizeof(header), user_data);
+
+        /*The offsets are taken from the control structure at the start of the pool*/
+        void * walk_data[3] = {write_cb, user_data, pools[i]};
+        lv_tlsf_walk_pool(lv_tlsf_get_pool(pools[i]), map_write_walker, walk_data);
+        block_cnt += header.block_cnt;
+    }
+
+    return block_cnt;
+}
+
+void lv_mem_map_start(lv_mem_write_cb_t write_cb, void * user_data, uint32_t period)
+{
+    map_write_cb = write_cb;
+    map_user_data = user_data;
+    if(map_timer) lv_timer_set_period(map_timer, period);
+    else map_timer = lv_timer_create(map_timer_cb, period, NULL);
+}
+
+void lv_mem_map_stop(void)
+{
+    if(map_timer) {
+        lv_timer_del(map_timer);
+        map_timer = NULL;
+    }
+}
+#endif
+
+#if DLG_LVGL_USE_MEM_BUF_POOL == 0
 
 /**
  * Get a temporal buffer with the given size.
@@ -343,6 +580,140 @@ void lv_mem_buf_free_all(void)
     }
 }
 
+#else /*DLG_LVGL_USE_MEM_BUF_POOL*/
+
+/**
+ * Get a temporal buffer with the given size.
+ * While an area is refreshed it is taken from the top of the frame arena, otherwise from the free
+ * list of its size class.
+ * @param size the required size
+ */
+void * lv_mem_buf_get(uint32_t size)
+{
+    if(size == 0) return NULL;
+
+    MEM_TRACE("begin, getting %d bytes", size);
+
+    buf_hdr_t * hdr;
+    uint32_t arena_size = sizeof(buf_hdr_t) + ((size + ALIGN_MASK) & ~ALIGN_MASK);
+    if(arena_open && arena_top + arena_size <= sizeof(buf_arena)) {
+        hdr = (buf_hdr_t *)((uint8_t *)buf_arena + arena_top);
+        hdr->prev = arena_last;
+        hdr->cls = BUF_CLASS_ARENA;
+        hdr->used = 1;
+        arena_last = arena_top;
+        arena_top += arena_size;
+        arena_live++;
+        if(arena_top > arena_max_used) arena_max_used = arena_top;
+        return hdr + 1;
+    }
+
+    /*The smallest size class the buffer fits in*/
+    uint8_t cls = 0;
+    while(cls < DLG_LVGL_MEM_BUF_CLASSES && ((uint32_t)BUF_CLASS_MIN_SIZE << cls) < size) cls++;
+
+    if(cls < DLG_LVGL_MEM_BUF_CLASSES && class_free[cls]) {
+        buf_free_t * buf = class_free[cls];
+        class_free[cls] = buf->next;
+        class_free_cnt[cls]--;
+        hdr = (buf_hdr_t *)buf - 1;
+        hdr->used = 1;
+        MEM_TRACE("returning already allocated buffer (class: %d, address: %p)", cls, buf);
+        return buf;
+    }
+
+    uint32_t alloc_size = cls < DLG_LVGL_MEM_BUF_CLASSES ? (uint32_t)BUF_CLASS_MIN_SIZE << cls : size;
+    /*if this fails you probably need to increase your LV_MEM_SIZE/heap size*/
+    hdr = lv_mem_alloc(sizeof(buf_hdr_t) + alloc_size);
+    LV_ASSERT_MSG(hdr != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
+    if(hdr == NULL) return NULL;
+
+    heap_cnt++;
+    if(cls < DLG_LVGL_MEM_BUF_CLASSES) {
+        hdr->cls = cls;
+        pool_size += alloc_size;
+        if(pool_size > pool_max_size) pool_max_size = pool_size;
+    }
+    else {
+        hdr->cls = BUF_CLASS_HEAP;
+    }
+    hdr->used = 1;
+    MEM_TRACE("allocated (class: %d, address: %p)", hdr->cls, hdr + 1);
+    return hdr + 1;
+}
+
+/**
+ * Release a memory buffer
+ * @param p buffer to release
+ */
+void lv_mem_buf_release(void * p)
+{
+    MEM_TRACE("begin (address: %p)", p);
+    if(p == NULL) return;
+
+    buf_hdr_t * hdr = (buf_hdr_t *)p - 1;
+    LV_ASSERT_MSG(hdr->used, "p is not a buffer in use");
+    hdr->used = 0;
+
+    if(hdr->cls == BUF_CLASS_ARENA) {
+        arena_live--;
+        /*The arena is a stack: drop the released buffers from its top*/
+        while(arena_last != BUF_ARENA_NONE) {
+            buf_hdr_t * last = (buf_hdr_t *)((uint8_t *)buf_arena + arena_last);
+            if(last->used) break;
+            arena_top = arena_last;
+            arena_last = last->prev;
+        }
+    }
+    else if(hdr->cls == BUF_CLASS_HEAP) {
+        lv_mem_free(hdr);
+    }
+    else if(class_free_cnt[hdr->cls] < DLG_LVGL_MEM_BUF_CLASS_KEEP) {
+        buf_free_t * buf = p;
+        buf->next = class_free[hdr->cls];
+        class_free[hdr->cls] = buf;
+        class_free_cnt[hdr->cls]++;
+    }
+    else {
+        pool_size -= (uint32_t)BUF_CLASS_MIN_SIZE << hdr->cls;
+        lv_mem_free(hdr);
+    }
+}
+
+/**
+ * Free all memory buffers
+ * Only the released buffers of the size classes are given back to the heap.
+ */
+void lv_mem_buf_free_all(void)
+{
+    for(uint8_t cls = 0; cls < DLG_LVGL_MEM_BUF_CLASSES; cls++) {
+        while(class_free[cls]) {
+            buf_free_t * buf = class_free[cls];
+            class_free[cls] = buf->next;
+            pool_size -= (uint32_t)BUF_CLASS_MIN_SIZE << cls;
+            lv_mem_free((buf_hdr_t *)buf - 1);
+        }
+        class_free_cnt[cls] = 0;
+    }
+}
+
+void _lv_mem_buf_frame_begin(void)
+{
+    arena_open = true;
+}
+
+void _lv_mem_buf_frame_end(void)
+{
+    arena_open = false;
+
+    /*A buffer still in use, e.g. until the GPU completes, is dropped from the top when released*/
+    if(arena_live == 0) {
+        arena_top = 0;
+        arena_last = BUF_ARENA_NONE;
+    }
+}
+#endif /*DLG_LVGL_USE_MEM_BUF_POOL*/
+
 #if LV_MEMCPY_MEMSET_STD == 0
 /**
  * Same as `memcpy` but optimized for 4 byte operation.
@@ -546,6 +917,111 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
         mon_p->free_size += size;
         if(size > mon_p->free_biggest_size)
             mon_p->free_biggest_size = size;
+#if DLG_LVGL_USE_MEM_TELEMETRY
+        walk_free_sq_sum += (uint64_t)size * size;
+#endif
     }
 }
+
+static lv_tlsf_t mem_pool_of(void * block)
+{
+#if DLG_LVGL_USE_MEM_LARGE
+    if((uint8_t *)block >= (uint8_t *)large_mem && (uint8_t *)block < (uint8_t *)large_mem + sizeof(large_mem)) {
+        return tlsf_large;
+    }
+#else
+    LV_UNUSED(block);
+#endif
+    return tlsf;
+}
+
+/*The large objects go to their own region, so that they cannot split the small free blocks of the heap.
+ *Each pool is the fallback of the other one.*/
+static void * mem_pool_alloc(size_t size)
+{
+    lv_tlsf_t pool = tlsf;
+#if DLG_LVGL_USE_MEM_LARGE
+    lv_tlsf_t other = tlsf_large;
+    if(size >= DLG_LVGL_MEM_LARGE_THRESHOLD) {
+        pool = tlsf_large;
+        other = tlsf;
+    }
+#endif
+
+    void * block = lv_tlsf_malloc(pool, size);
+#if DLG_LVGL_USE_MEM_LARGE
+    if(block == NULL) {
+        LV_LOG_WARN("%s full, %d bytes taken from the %s", pool == tlsf ? "heap" : "large object region", (int)size,
+                    other == tlsf ? "heap" : "large object region");
+        pool = other;
+        block = lv_tlsf_malloc(pool, size);
+    }
+#endif
+
+#if DLG_LVGL_USE_MEM_TELEMETRY
+    if(block) mem_track(pool, block, true);
+#endif
+    return block;
+}
+
+static void mem_pool_free(void * block)
+{
+    lv_tlsf_t pool = mem_pool_of(block);
+#if DLG_LVGL_USE_MEM_TELEMETRY
+    mem_track(pool, block, false);
+#endif
+    lv_tlsf_free(pool, block);
+}
+#endif
+
+#if DLG_LVGL_USE_MEM_TELEMETRY
+static void mem_track(lv_tlsf_t pool, void * block, bool add)
+{
+    /*Only the heap is tracked, the region of the large objects holds a few blocks*/
+    if(pool != tlsf) return;
+
+    uint32_t size = lv_tlsf_block_size(block);
+    if(!add) {
+        mem_used -= size;
+        return;
+    }
+
+    mem_used += size;
+    if(mem_used > mem_max_used) mem_max_used = mem_used;
+
+    /*Allocations only shrink the biggest free block*/
+    uint32_t biggest = lv_tlsf_largest_free(tlsf);
+    if(biggest < mem_free_biggest_min) mem_free_biggest_min = biggest;
+}
+
+static void map_count_walker(void * ptr, size_t size, int used, void * user)
+{
+    LV_UNUSED(ptr);
+    LV_UNUSED(size);
+    LV_UNUSED(used);
+
+    (*(uint32_t *)user)++;
+}
+
+static void map_write_walker(void * ptr, size_t size, int used, void * user)
+{
+    void ** walk_data = user;
+    lv_mem_write_cb_t write_cb = (lv_mem_write_cb_t)walk_data[0];
+    lv_mem_map_block_t block;
+
+    block.offset = (uint8_t *)ptr - (uint8_t *)walk_data[2];
+    block.size = size;
+    block.site = used ? 1 : 0;
+#if MEM_TAG
+    if(used) block.site = *(lv_uintptr_t *)ptr;
+#endif
+    write_cb(&block, sizeof(block), walk_data[1]);
+}
+
+static void map_timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+
+    lv_mem_map_dump(map_write_cb, map_user_data);
+}
 #endif
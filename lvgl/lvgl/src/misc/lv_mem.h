@@ -2,6 +2,7 @@
  * @file lv_mem.h
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 #ifndef LV_MEM_H
 #define LV_MEM_H
@@ -32,6 +33,38 @@ extern "C" {
 #define LV_MEM_BUF_MAX_NUM    32
 #endif
 
+#ifndef DLG_LVGL_USE_MEM_BUF_POOL
+#define DLG_LVGL_USE_MEM_BUF_POOL 0
+#endif
+
+#ifndef DLG_LVGL_USE_MEM_TELEMETRY
+#define DLG_LVGL_USE_MEM_TELEMETRY 0
+#endif
+
+/*Keep the return address of lv_mem_alloc() in front of every allocation (telemetry only)*/
+#ifndef DLG_LVGL_MEM_TAG_SITES
+#define DLG_LVGL_MEM_TAG_SITES 0
+#endif
+
+#ifndef DLG_LVGL_USE_MEM_LARGE
+#define DLG_LVGL_USE_MEM_LARGE 0
+#endif
+
+#if DLG_LVGL_USE_MEM_LARGE
+/*Size of the region of the large objects*/
+#ifndef DLG_LVGL_MEM_LARGE_SIZE
+#define DLG_LVGL_MEM_LARGE_SIZE (64 * 1024)
+#endif
+
+/*Allocations of this size or more are taken from the region of the large objects*/
+#ifndef DLG_LVGL_MEM_LARGE_THRESHOLD
+#define DLG_LVGL_MEM_LARGE_THRESHOLD (4 * 1024)
+#endif
+#endif
+
+#define LV_MEM_MAP_MAGIC        "LVHM"
+#define LV_MEM_MAP_VERSION      1
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -48,6 +81,22 @@ typedef struct {
     uint32_t max_used; /**< Max size of Heap memory used*/
     uint8_t used_pct; /**< Percentage used*/
     uint8_t frag_pct; /**< Amount of fragmentation*/
+#if DLG_LVGL_USE_MEM_BUF_POOL
+    uint32_t buf_arena_size;        /**< Size of the frame arena of the temporal buffers*/
+    uint32_t buf_arena_max_used;    /**< Most of the arena used during a refresh, since the start*/
+    uint32_t buf_pool_size;         /**< Heap held by the size classes of the temporal buffers*/
+    uint32_t buf_pool_max_size;     /**< Most heap held by the size classes, since the start*/
+    uint32_t buf_heap_cnt;          /**< Temporal buffers allocated from the heap, since the start*/
+#endif
+#if DLG_LVGL_USE_MEM_TELEMETRY
+    uint8_t frag_index;             /**< 0: the free memory is one block, towards 100: many blocks of similar sizes*/
+    uint32_t free_biggest_min;      /**< Smallest size of the biggest free block after an allocation, since the start*/
+#endif
+#if DLG_LVGL_USE_MEM_LARGE
+    uint32_t large_total_size;      /**< Size of the region of the large objects*/
+    uint32_t large_free_size;
+    uint32_t large_free_biggest_size;
+#endif
 } lv_mem_monitor_t;
 
 typedef struct {
@@ -58,6 +107,34 @@ typedef struct {
 
 typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_MEM_BUF_MAX_NUM];
 
+#if DLG_LVGL_USE_MEM_TELEMETRY
+/**
+ * Snapshot of a pool in a heap map, followed by `block_cnt` `lv_mem_map_block_t`
+ */
+typedef struct {
+    char magic[4];                  /**< LV_MEM_MAP_MAGIC*/
+    uint16_t version;               /**< LV_MEM_MAP_VERSION*/
+    uint8_t pool;                   /**< 0: heap, 1: region of the large objects*/
+    uint8_t tagged;                 /**< The sites of the used blocks are known*/
+    uint64_t site_base;             /**< Address of lv_mem_alloc(), to locate the sites in the executable*/
+    uint32_t time;                  /**< lv_tick_get() of the snapshot*/
+    uint32_t pool_size;
+    uint32_t block_cnt;
+    uint32_t reserved;
+} lv_mem_map_header_t;
+
+/**
+ * Block of a pool in a heap map
+ */
+typedef struct {
+    uint32_t offset;                /**< From the start of the pool*/
+    uint32_t size;                  /**< Usable bytes of the block*/
+    uint64_t site;                  /**< Return address of lv_mem_alloc(), 0 for a free block, 1 if not tagged*/
+} lv_mem_map_block_t;
+
+typedef void (*lv_mem_write_cb_t)(const void * data, uint32_t size, void * user_data);
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -126,6 +203,41 @@ void lv_mem_buf_release(void * p);
  */
 void lv_mem_buf_free_all(void);
 
+#if DLG_LVGL_USE_MEM_TELEMETRY
+/**
+ * Write a snapshot of the blocks of the heap, and of the region of the large objects
+ * @param write_cb called with the consecutive parts of the snapshot
+ * @param user_data passed to `write_cb`
+ * @return number of blocks written
+ */
+uint32_t lv_mem_map_dump(lv_mem_write_cb_t write_cb, void * user_data);
+
+/**
+ * Dump a snapshot periodically with a timer
+ * @param write_cb called with the consecutive parts of every snapshot
+ * @param user_data passed to `write_cb`
+ * @param period time between the snapshots [ms]
+ */
+void lv_mem_map_start(lv_mem_write_cb_t write_cb, void * user_data, uint32_t period);
+
+/**
+ * Stop the snapshots of `lv_mem_map_start()`
+ */
+void lv_mem_map_stop(void);
+#endif
+
+#if DLG_LVGL_USE_MEM_BUF_POOL
+/**
+ * Open the frame arena: the temporal buffers are taken from it until `_lv_mem_buf_frame_end()`
+ */
+void _lv_mem_buf_frame_begin(void);
+
+/**
+ * Close the frame arena and reset it if all its buffers were released
+ */
+void _lv_mem_buf_frame_end(void);
+#endif
+
 //! @cond Doxygen_Suppress
 
 #if LV_MEMCPY_MEMSET_STD
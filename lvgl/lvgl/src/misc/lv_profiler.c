@@ -0,0 +1,183 @@
+/**
+ * @file lv_profiler.c
+ *
+ */
+/* Copyright (c) 2022 Dialog Semiconductor */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_profiler.h"
+
+#if DLG_LVGL_USE_PROFILER
+
+#include <string.h>
+#include "lv_math.h"
+#include "../hal/lv_hal_tick.h"
+
+#ifdef DLG_LVGL_PROFILER_TIME_INCLUDE
+    #include DLG_LVGL_PROFILER_TIME_INCLUDE
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Size of the ring of events, a power of 2. The oldest events are overwritten when it is full.*/
+#ifndef DLG_LVGL_PROFILER_EVENTS
+    #define DLG_LVGL_PROFILER_EVENTS            4096
+#endif
+
+/*Maximum number of scopes and marks, including the ones of LVGL*/
+#ifndef DLG_LVGL_PROFILER_IDS
+    #define DLG_LVGL_PROFILER_IDS               64
+#endif
+
+/*Maximum number of tracks*/
+#ifndef DLG_LVGL_PROFILER_TRACKS
+    #define DLG_LVGL_PROFILER_TRACKS            8
+#endif
+
+/*Expression evaluating to the current time in ns, from any thread or interrupt*/
+#ifndef DLG_LVGL_PROFILER_TIME_EXPR
+    #define DLG_LVGL_PROFILER_TIME_EXPR         ((uint64_t)lv_tick_get() * 1000000)
+#endif
+
+#if DLG_LVGL_PROFILER_IDS > LV_PROFILER_ID_INVALID || DLG_LVGL_PROFILER_TRACKS > LV_PROFILER_TRACK_INVALID
+    #error "DLG_LVGL_PROFILER_IDS and DLG_LVGL_PROFILER_TRACKS must leave out the invalid id"
+#endif
+
+#if DLG_LVGL_PROFILER_EVENTS & (DLG_LVGL_PROFILER_EVENTS - 1)
+    #error "DLG_LVGL_PROFILER_EVENTS must be a power of 2"
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void write_name(lv_profiler_write_cb_t write_cb, void * user_data, const char * name);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static LV_ATTRIBUTE_LARGE_RAM_ARRAY lv_profiler_event_t events[DLG_LVGL_PROFILER_EVENTS];
+static uint32_t head;                   /*Number of events recorded since the start, wraps around*/
+static volatile bool enabled = true;
+
+static const char * id_names[DLG_LVGL_PROFILER_IDS] = {
+    [LV_PROFILER_REFR] = "refr",
+    [LV_PROFILER_REFR_AREA] = "refr_area",
+    [LV_PROFILER_DRAW_RECT] = "draw_rect",
+    [LV_PROFILER_DRAW_LABEL] = "draw_label",
+    [LV_PROFILER_DRAW_IMG] = "draw_img",
+    [LV_PROFILER_DRAW_LINE] = "draw_line",
+    [LV_PROFILER_DRAW_ARC] = "draw_arc",
+    [LV_PROFILER_DRAW_POLYGON] = "draw_polygon",
+    [LV_PROFILER_FLUSH] = "flush",
+    [LV_PROFILER_FLUSH_WAIT] = "flush_wait",
+};
+static uint32_t id_cnt = _LV_PROFILER_ID_LAST;
+
+static const char * track_names[DLG_LVGL_PROFILER_TRACKS] = {
+    [LV_PROFILER_TRACK_LVGL] = "lvgl",
+};
+static uint32_t track_cnt = LV_PROFILER_TRACK_LVGL + 1;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint8_t lv_profiler_register(const char * name)
+{
+    /*The modules might register from their own threads*/
+    uint32_t id = __atomic_fetch_add(&id_cnt, 1, __ATOMIC_RELAXED);
+    if(id >= DLG_LVGL_PROFILER_IDS) return LV_PROFILER_ID_INVALID;
+
+    id_names[id] = name;
+    return id;
+}
+
+uint8_t lv_profiler_register_track(const char * name)
+{
+    uint32_t track = __atomic_fetch_add(&track_cnt, 1, __ATOMIC_RELAXED);
+    if(track >= DLG_LVGL_PROFILER_TRACKS) return LV_PROFILER_TRACK_INVALID;
+
+    track_names[track] = name;
+    return track;
+}
+
+void lv_profiler_enable(bool en)
+{
+    enabled = en;
+}
+
+void lv_profiler_clear(void)
+{
+    __atomic_store_n(&head, 0, __ATOMIC_RELAXED);
+}
+
+uint32_t lv_profiler_dump(lv_profiler_write_cb_t write_cb, void * user_data)
+{
+    bool en = enabled;
+    enabled = false;
+
+    uint32_t end = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    uint32_t cnt = LV_MIN(end, DLG_LVGL_PROFILER_EVENTS);
+
+    lv_profiler_dump_header_t header;
+    memcpy(header.magic, LV_PROFILER_DUMP_MAGIC, sizeof(header.magic));
+    header.version = LV_PROFILER_DUMP_VERSION;
+    header.event_size = sizeof(lv_profiler_event_t);
+    header.event_cnt = cnt;
+    header.lost_cnt = end - cnt;
+    header.id_cnt = LV_MIN(id_cnt, DLG_LVGL_PROFILER_IDS);
+    header.track_cnt = LV_MIN(track_cnt, DLG_LVGL_PROFILER_TRACKS);
+    write_cb(&header, sizeof(header), user_data);
+
+    uint32_t i;
+    for(i = 0; i < header.id_cnt; i++) write_name(write_cb, user_data, id_names[i]);
+    for(i = 0; i < header.track_cnt; i++) write_name(write_cb, user_data, track_names[i]);
+
+    /*From the oldest event, in two parts if the ring has wrapped*/
+    uint32_t start = (end - cnt) & (DLG_LVGL_PROFILER_EVENTS - 1);
+    uint32_t part = LV_MIN(cnt, DLG_LVGL_PROFILER_EVENTS - start);
+    if(part) write_cb(&events[start], part * sizeof(lv_profiler_event_t), user_data);
+    if(cnt > part) write_cb(events, (cnt - part) * sizeof(lv_profiler_event_t), user_data);
+
+    enabled = en;
+    return cnt;
+}
+
+void _lv_profiler_record(lv_profiler_event_type_t type, uint8_t id, uint8_t track)
+{
+    if(!enabled) return;
+    if(id == LV_PROFILER_ID_INVALID || track == LV_PROFILER_TRACK_INVALID) return;
+
+    uint64_t time = DLG_LVGL_PROFILER_TIME_EXPR;
+
+    /*The slot is taken atomically, so that the other threads and the interrupts can record at the same time*/
+    uint32_t i = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED);
+    lv_profiler_event_t * event = &events[i & (DLG_LVGL_PROFILER_EVENTS - 1)];
+
+    event->time = (uint32_t)time;
+    event->time_hi = (uint8_t)(time >> 32);
+    event->type = type;
+    event->id = id;
+    event->track = track;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void write_name(lv_profiler_write_cb_t write_cb, void * user_data, const char * name)
+{
+    uint8_t len = name ? (uint8_t)LV_MIN(strlen(name), 255) : 0;
+
+    write_cb(&len, 1, user_data);
+    if(len) write_cb(name, len, user_data);
+}
+
+#endif /*DLG_LVGL_USE_PROFILER*/
@@ -0,0 +1,179 @@
+/**
+ * @file lv_profiler.h
+ *
+ */
+/* Copyright (c) 2022 Dialog Semiconductor */
+
+#ifndef LV_PROFILER_H
+#define LV_PROFILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef DLG_LVGL_USE_PROFILER
+#define DLG_LVGL_USE_PROFILER 0
+#endif
+
+/*Identifies a dump of lv_profiler_dump()*/
+#define LV_PROFILER_DUMP_MAGIC      "LVPF"
+#define LV_PROFILER_DUMP_VERSION    1
+
+/*The scopes drawn by LVGL are recorded on this track, the other ones are added by lv_profiler_register_track()*/
+#define LV_PROFILER_TRACK_LVGL      0
+
+/*Returned when the table is full, the events recorded with it are dropped*/
+#define LV_PROFILER_ID_INVALID      0xFF
+#define LV_PROFILER_TRACK_INVALID   0xFF
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*The scopes of LVGL, the other ones are added by lv_profiler_register()*/
+enum {
+    LV_PROFILER_REFR,           /**< A refresh of the display, `_lv_disp_refr_timer()`*/
+    LV_PROFILER_REFR_AREA,      /**< An invalidated area, `lv_refr_area()`*/
+    LV_PROFILER_DRAW_RECT,
+    LV_PROFILER_DRAW_LABEL,
+    LV_PROFILER_DRAW_IMG,
+    LV_PROFILER_DRAW_LINE,
+    LV_PROFILER_DRAW_ARC,
+    LV_PROFILER_DRAW_POLYGON,
+    LV_PROFILER_FLUSH,          /**< `flush_cb` of the display driver*/
+    LV_PROFILER_FLUSH_WAIT,     /**< Waiting for the draw buffer to be flushed*/
+    _LV_PROFILER_ID_LAST
+};
+
+enum {
+    LV_PROFILER_EVENT_BEGIN,    /**< A scope starts*/
+    LV_PROFILER_EVENT_END,      /**< The last scope started on the track ends*/
+    LV_PROFILER_EVENT_MARK,     /**< Something happened at this time*/
+};
+typedef uint8_t lv_profiler_event_type_t;
+
+/**
+ * An event as it is recorded and dumped. The time stamp is cut to 40 bits, it wraps every 18 minutes:
+ * the reader can unwrap it from the previous event, the events being recorded much more often.
+ */
+typedef struct {
+    uint32_t time;                      /**< Bits 0..31 of the time stamp in ns*/
+    uint8_t time_hi;                    /**< Bits 32..39 of the time stamp*/
+    lv_profiler_event_type_t type;
+    uint8_t id;                         /**< The scope or the mark*/
+    uint8_t track;                      /**< The thread or the unit the scope runs on*/
+} lv_profiler_event_t;
+
+/**
+ * Header of a dump, all the fields are little endian. It is followed by the names of the `id_cnt` ids and
+ * of the `track_cnt` tracks, each as a length byte and the characters, then by the `event_cnt` events
+ * from the oldest one.
+ */
+typedef struct {
+    char magic[4];                      /**< LV_PROFILER_DUMP_MAGIC*/
+    uint16_t version;                   /**< LV_PROFILER_DUMP_VERSION*/
+    uint16_t event_size;                /**< `sizeof(lv_profiler_event_t)`*/
+    uint32_t event_cnt;
+    uint32_t lost_cnt;                  /**< Older events overwritten in the ring*/
+    uint16_t id_cnt;
+    uint16_t track_cnt;
+} lv_profiler_dump_header_t;
+
+/**
+ * Write a part of the dump
+ * @param data the bytes to write
+ * @param size number of bytes
+ * @param user_data the parameter of `lv_profiler_dump()`
+ */
+typedef void (*lv_profiler_write_cb_t)(const void * data, uint32_t size, void * user_data);
+
+#if DLG_LVGL_USE_PROFILER
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Add a scope or a mark
+ * @param name its name in the dump, it is not copied
+ * @return the id to record it with, LV_PROFILER_ID_INVALID if there are already DLG_LVGL_PROFILER_IDS
+ */
+uint8_t lv_profiler_register(const char * name);
+
+/**
+ * Add a track, e.g. for the scopes of an interrupt or of a unit working on its own
+ * @param name its name in the dump, it is not copied
+ * @return the track to record the scopes on, LV_PROFILER_TRACK_INVALID if there are already
+ *         DLG_LVGL_PROFILER_TRACKS
+ */
+uint8_t lv_profiler_register_track(const char * name);
+
+/**
+ * Start or stop recording. It is started from the beginning.
+ * @param en true: record the events
+ */
+void lv_profiler_enable(bool en);
+
+/**
+ * Forget the recorded events
+ */
+void lv_profiler_clear(void);
+
+/**
+ * Write the recorded events, with the names of the ids and of the tracks. The recording is stopped
+ * meanwhile.
+ * @param write_cb called with the successive parts of the dump
+ * @param user_data passed to `write_cb`
+ * @return number of events written
+ */
+uint32_t lv_profiler_dump(lv_profiler_write_cb_t write_cb, void * user_data);
+
+/**
+ * Record an event. It can be called from any thread or interrupt. The events with an invalid id or track
+ * are dropped.
+ * @param type `LV_PROFILER_EVENT_BEGIN`, `LV_PROFILER_EVENT_END` or `LV_PROFILER_EVENT_MARK`
+ * @param id the scope or the mark
+ * @param track the thread or the unit
+ */
+void _lv_profiler_record(lv_profiler_event_type_t type, uint8_t id, uint8_t track);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define LV_PROFILER_REGISTER(name)          lv_profiler_register(name)
+#define LV_PROFILER_REGISTER_TRACK(name)    lv_profiler_register_track(name)
+#define LV_PROFILER_BEGIN(id)               _lv_profiler_record(LV_PROFILER_EVENT_BEGIN, id, LV_PROFILER_TRACK_LVGL)
+#define LV_PROFILER_END(id)                 _lv_profiler_record(LV_PROFILER_EVENT_END, id, LV_PROFILER_TRACK_LVGL)
+#define LV_PROFILER_BEGIN_ON(id, track)     _lv_profiler_record(LV_PROFILER_EVENT_BEGIN, id, track)
+#define LV_PROFILER_END_ON(id, track)       _lv_profiler_record(LV_PROFILER_EVENT_END, id, track)
+#define LV_PROFILER_MARK_ON(id, track)      _lv_profiler_record(LV_PROFILER_EVENT_MARK, id, track)
+
+#else
+
+#define LV_PROFILER_REGISTER(name)          ((uint8_t)LV_PROFILER_ID_INVALID)
+#define LV_PROFILER_REGISTER_TRACK(name)    ((uint8_t)LV_PROFILER_TRACK_INVALID)
+#define LV_PROFILER_BEGIN(id)
+#define LV_PROFILER_END(id)
+#define LV_PROFILER_BEGIN_ON(id, track)
+#define LV_PROFILER_END_ON(id, track)
+#define LV_PROFILER_MARK_ON(id, track)
+
+#endif /*DLG_LVGL_USE_PROFILER*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PROFILER_H*/
@@ -2,6 +2,7 @@
  * @file lv_style.c
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -20,6 +21,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void inc_version(uint8_t groups);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -28,6 +30,7 @@
 /**********************
  *  STATIC VARIABLES
  **********************/
+static uint32_t style_version[8];   /*Per group of properties*/
 
 /**********************
  *      MACROS
@@ -45,6 +48,9 @@ void lv_style_init(lv_style_t * style)
     }
 #endif
 
+    /*It might be initialized again while in use*/
+    inc_version(0xFF);
+
     lv_memset_00(style, sizeof(lv_style_t));
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
@@ -60,6 +66,8 @@ void lv_style_reset(lv_style_t * style)
         return;
     }
 
+    inc_version(style->has_group);
+
     if(style->prop_cnt > 1) lv_mem_free(style->v_p.values_and_props);
     lv_memset_00(style, sizeof(lv_style_t));
 #if LV_USE_ASSERT_STYLE
@@ -84,6 +92,8 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
         return false;
     }
 
+    style_version[_lv_style_get_prop_group(prop)]++;
+
     if(style->prop_cnt == 0)  return false;
 
     if(style->prop_cnt == 1) {
@@ -145,6 +155,8 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
         return;
     }
 
+    style_version[_lv_style_get_prop_group(prop)]++;
+
     if(style->prop_cnt > 1) {
         uint8_t * tmp = style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
@@ -289,6 +301,16 @@ bool lv_style_is_empty(const lv_style_t * style)
     return style->prop_cnt == 0 ? true : false;
 }
 
+uint32_t _lv_style_get_version(uint8_t group)
+{
+    return style_version[group];
+}
+
+void _lv_style_inc_version(void)
+{
+    inc_version(0xFF);
+}
+
 uint8_t _lv_style_get_prop_group(lv_style_prop_t prop)
 {
     uint16_t group = (prop & 0x1FF) >> 4;
@@ -298,3 +320,11 @@ uint8_t _lv_style_get_prop_group(lv_style_prop_t prop)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+static void inc_version(uint8_t groups)
+{
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        if(groups & (1 << i)) style_version[i]++;
+    }
+}
@@ -2,6 +2,7 @@
  * @file lv_style.h
  *
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 #ifndef LV_STYLE_H
 #define LV_STYLE_H
@@ -414,6 +415,21 @@ lv_style_value_t lv_style_prop_get_default(lv_style_prop_t prop);
  */
 bool lv_style_is_empty(const lv_style_t * style);
 
+/**
+ * Get the version of a group of properties. It is incremented when a property of the group is set or
+ * removed in any style and by `_lv_style_inc_version()`, so the values of the group resolved from the
+ * styles stay valid while it is the same.
+ * @param group the group of the properties, see `_lv_style_get_prop_group()`
+ * @return the version of the group
+ */
+uint32_t _lv_style_get_version(uint8_t group);
+
+/**
+ * Increment the version of all the groups, when the styles applying to an object change otherwise than
+ * by their properties (a style is added or removed, the object gets a new state or parent...)
+ */
+void _lv_style_inc_version(void);
+
 /**
  * Tell the group of a property. If the a property from a group is set in a style the (1 << group) bit of style->has_group is set.
  * It allows early skipping the style if the property is not exists in the style at all.
@@ -1,6 +1,7 @@
 /**
  * @file lv_timer.c
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 /*********************
  *      INCLUDES
@@ -16,6 +17,7 @@
  *********************/
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define HEAP_MIN_SIZE 8
 
 /**********************
  *      TYPEDEFS
@@ -25,7 +27,18 @@
  *  STATIC PROTOTYPES
  **********************/
 static bool lv_timer_exec(lv_timer_t * timer);
-static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+#if DLG_LVGL_USE_TIMER_HEAP == 0
+    static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+#endif
+#if DLG_LVGL_USE_TIMER_HEAP
+    static bool heap_reserve(void);
+    static void heap_insert(lv_timer_t * timer);
+    static void heap_remove(lv_timer_t * timer);
+    static void heap_update(lv_timer_t * timer);
+    static bool heap_less(const lv_timer_t * a, const lv_timer_t * b);
+    static void heap_sift_up(uint32_t i);
+    static void heap_sift_down(uint32_t i);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -34,6 +47,13 @@ static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
 static bool timer_deleted;
 static bool timer_created;
+#if DLG_LVGL_USE_TIMER_HEAP
+    static lv_timer_t ** heap;          /*heap[0] is the next timer to run*/
+    static uint32_t heap_cnt;
+    static uint32_t heap_size;          /*Room for every timer, so that resuming one never allocates*/
+    static uint32_t timer_cnt;
+    static uint32_t handler_cnt;
+#endif
 
 /**********************
  *      MACROS
@@ -54,6 +74,13 @@ static bool timer_created;
 void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+#if DLG_LVGL_USE_TIMER_HEAP
+    /*The heap was freed with the rest of the memory if LVGL is initialized again*/
+    heap = NULL;
+    heap_cnt = 0;
+    heap_size = 0;
+    timer_cnt = 0;
+#endif
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -94,6 +121,23 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
+#if DLG_LVGL_USE_TIMER_HEAP
+    /*Run the timers due at the start of the handler, each one once. The timers created, deleted or changed
+     *by the callbacks are already in their place in the heap.*/
+    handler_cnt++;
+    while(heap_cnt) {
+        lv_timer_t * timer = heap[0];
+        if(timer->run_cnt == handler_cnt || (int32_t)(timer->last_run + timer->period - handler_start) > 0) break;
+        lv_timer_exec(timer);
+    }
+    LV_GC_ROOT(_lv_timer_act) = NULL;
+
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    if(heap_cnt) {
+        int32_t delay = (int32_t)(heap[0]->last_run + heap[0]->period - lv_tick_get());
+        time_till_next = delay > 0 ? (uint32_t)delay : 0;
+    }
+#else
     /*Run all timer from the list*/
     lv_timer_t * next;
     do {
@@ -128,6 +172,7 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
 
         next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
     }
+#endif
 
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
@@ -178,6 +223,18 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
 
+#if DLG_LVGL_USE_TIMER_HEAP
+    if(!heap_reserve()) {
+        _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), new_timer);
+        lv_mem_free(new_timer);
+        return NULL;
+    }
+    timer_cnt++;
+    /*Due already if the period is 0, even while the handler runs*/
+    new_timer->run_cnt = handler_cnt - 1;
+    heap_insert(new_timer);
+#endif
+
     timer_created = true;
 
     return new_timer;
@@ -199,6 +256,11 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
  */
 void lv_timer_del(lv_timer_t * timer)
 {
+#if DLG_LVGL_USE_TIMER_HEAP
+    heap_remove(timer);
+    timer_cnt--;
+    if(timer == LV_GC_ROOT(_lv_timer_act)) LV_GC_ROOT(_lv_timer_act) = NULL;
+#endif
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
     timer_deleted = true;
 
@@ -212,11 +274,17 @@ void lv_timer_del(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     timer->paused = true;
+#if DLG_LVGL_USE_TIMER_HEAP
+    heap_remove(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     timer->paused = false;
+#if DLG_LVGL_USE_TIMER_HEAP
+    if(timer->heap_idx == LV_TIMER_HEAP_NONE) heap_insert(timer);
+#endif
 }
 
 /**
@@ -227,6 +295,9 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+#if DLG_LVGL_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 /**
@@ -236,6 +307,9 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+#if DLG_LVGL_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 /**
@@ -256,6 +330,9 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+#if DLG_LVGL_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 /**
@@ -296,6 +373,32 @@ lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
  * @param timer pointer to lv_timer
  * @return true: execute, false: not executed
  */
+#if DLG_LVGL_USE_TIMER_HEAP
+static bool lv_timer_exec(lv_timer_t * timer)
+{
+    /*Only the timers at the top of the heap are executed, they are due*/
+    LV_GC_ROOT(_lv_timer_act) = timer;
+
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    timer->run_cnt = handler_cnt;
+    heap_sift_down(timer->heap_idx);
+
+    TIMER_TRACE("calling timer callback: %p", timer->timer_cb);
+    if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
+    TIMER_TRACE("timer callback %p finished", timer->timer_cb);
+    LV_ASSERT_MEM_INTEGRITY();
+
+    /*The timer might be deleted by itself as well*/
+    if(LV_GC_ROOT(_lv_timer_act) == timer && timer->repeat_count == 0) {
+        TIMER_TRACE("deleting timer with %p callback because the repeat count is over", timer->timer_cb);
+        lv_timer_del(timer);
+    }
+
+    return true;
+}
+#else
 static bool lv_timer_exec(lv_timer_t * timer)
 {
     if(timer->paused) return false;
@@ -324,7 +427,9 @@ static bool lv_timer_exec(lv_timer_t * timer)
 
     return exec;
 }
+#endif
 
+#if DLG_LVGL_USE_TIMER_HEAP == 0
 /**
  * Find out how much time remains before a timer must be run.
  * @param timer pointer to lv_timer
@@ -338,3 +443,103 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
         return 0;
     return timer->period - elp;
 }
+#endif
+
+#if DLG_LVGL_USE_TIMER_HEAP
+/**
+ * Make room in the heap for one more timer
+ * @return false if the heap couldn't grow
+ */
+static bool heap_reserve(void)
+{
+    if(timer_cnt < heap_size) return true;
+
+    uint32_t new_size = heap_size ? heap_size * 2 : HEAP_MIN_SIZE;
+    lv_timer_t ** new_heap = lv_mem_realloc(heap, new_size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(new_heap);
+    if(new_heap == NULL) return false;
+
+    heap = new_heap;
+    heap_size = new_size;
+    return true;
+}
+
+static void heap_insert(lv_timer_t * timer)
+{
+    timer->heap_idx = heap_cnt;
+    heap[heap_cnt++] = timer;
+    heap_sift_up(timer->heap_idx);
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t i = timer->heap_idx;
+    if(i == LV_TIMER_HEAP_NONE) return;
+
+    timer->heap_idx = LV_TIMER_HEAP_NONE;
+    heap_cnt--;
+    if(i == heap_cnt) return;
+
+    /*The last timer fills the hole, from where it goes up or down*/
+    heap[i] = heap[heap_cnt];
+    heap[i]->heap_idx = i;
+    heap_update(heap[i]);
+}
+
+/**
+ * Restore the order of the heap after the next run of a timer changed
+ * @param timer pointer to a timer
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    if(timer->heap_idx == LV_TIMER_HEAP_NONE) return;
+
+    heap_sift_up(timer->heap_idx);
+    heap_sift_down(timer->heap_idx);
+}
+
+/**
+ * Order of the timers: the next run first, the timers not run yet by the current handler first at the same time
+ */
+static bool heap_less(const lv_timer_t * a, const lv_timer_t * b)
+{
+    int32_t diff = (int32_t)((a->last_run + a->period) - (b->last_run + b->period));
+    if(diff != 0) return diff < 0;
+
+    return (int32_t)(a->run_cnt - b->run_cnt) < 0;
+}
+
+static void heap_sift_up(uint32_t i)
+{
+    lv_timer_t * timer = heap[i];
+    while(i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if(!heap_less(timer, heap[parent])) break;
+
+        heap[i] = heap[parent];
+        heap[i]->heap_idx = i;
+        i = parent;
+    }
+
+    heap[i] = timer;
+    timer->heap_idx = i;
+}
+
+static void heap_sift_down(uint32_t i)
+{
+    lv_timer_t * timer = heap[i];
+    while(1) {
+        uint32_t child = 2 * i + 1;
+        if(child >= heap_cnt) break;
+        if(child + 1 < heap_cnt && heap_less(heap[child + 1], heap[child])) child++;
+        if(!heap_less(heap[child], timer)) break;
+
+        heap[i] = heap[child];
+        heap[i]->heap_idx = i;
+        i = child;
+    }
+
+    heap[i] = timer;
+    timer->heap_idx = i;
+}
+#endif
@@ -1,6 +1,7 @@
 /**
  * @file lv_timer.h
  */
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 
 #ifndef LV_TIMER_H
 #define LV_TIMER_H
@@ -28,6 +29,14 @@ extern "C" {
 
 #define LV_NO_TIMER_READY 0xFFFFFFFF
 
+/*Keep the running timers in a binary min-heap ordered by their next run, instead of scanning all of them.
+ *The periods have to be shorter than 2^31 ms.*/
+#ifndef DLG_LVGL_USE_TIMER_HEAP
+#define DLG_LVGL_USE_TIMER_HEAP 0
+#endif
+
+#define LV_TIMER_HEAP_NONE 0xFFFFFFFF
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -49,6 +58,10 @@ typedef struct _lv_timer_t {
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
     uint32_t paused : 1;
+#if DLG_LVGL_USE_TIMER_HEAP
+    uint32_t heap_idx; /**< Position in the heap, LV_TIMER_HEAP_NONE while paused*/
+    uint32_t run_cnt; /**< Call of `lv_timer_handler()` which ran the timer last*/
+#endif
 } lv_timer_t;
 
 /**********************
@@ -1,3 +1,4 @@
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 #include "../lv_conf_internal.h"
 #if LV_MEM_CUSTOM == 0
 
@@ -9,7 +10,12 @@
 #include "lv_assert.h"
 #define printf LV_LOG_ERROR
 
-#define TLSF_MAX_POOL_SIZE LV_MEM_SIZE
+#if DLG_LVGL_USE_MEM_LARGE && DLG_LVGL_MEM_LARGE_SIZE > LV_MEM_SIZE
+    /*The same indexes serve the region of the large objects*/
+    #define TLSF_MAX_POOL_SIZE DLG_LVGL_MEM_LARGE_SIZE
+#else
+    #define TLSF_MAX_POOL_SIZE LV_MEM_SIZE
+#endif
 
 #if !defined(_DEBUG)
     #define _DEBUG 0
@@ -906,6 +912,26 @@ void lv_tlsf_walk_pool(lv_pool_t pool, lv_tlsf_walker walker, void * user)
     }
 }
 
+size_t lv_tlsf_largest_free(lv_tlsf_t tlsf)
+{
+    control_t * control = tlsf_cast(control_t *, tlsf);
+    size_t largest = 0;
+
+    if(control->fl_bitmap) {
+        /*The largest free block is in the highest non empty list*/
+        const int fl = tlsf_fls(control->fl_bitmap);
+        const int sl = tlsf_fls(control->sl_bitmap[fl]);
+        block_header_t * block = control->blocks[fl][sl];
+
+        while(block != &control->block_null) {
+            largest = tlsf_max(largest, block_size(block));
+            block = block->next_free;
+        }
+    }
+
+    return largest;
+}
+
 size_t lv_tlsf_block_size(void * ptr)
 {
     size_t size = 0;
@@ -1,3 +1,4 @@
+/* Copyright (c) 2022 Modified by Dialog Semiconductor */
 #include "../lv_conf_internal.h"
 #if LV_MEM_CUSTOM == 0
 
@@ -79,6 +80,9 @@ size_t lv_tlsf_block_size_max(void);
 size_t lv_tlsf_pool_overhead(void);
 size_t lv_tlsf_alloc_overhead(void);
 
+/* Size of the largest free block, without walking the pool. */
+size_t lv_tlsf_largest_free(lv_tlsf_t tlsf);
+
 /* Debugging. */
 typedef void (*lv_tlsf_walker)(void * ptr, size_t size, int used, void * user);
 void lv_tlsf_walk_pool(lv_pool_t pool, lv_tlsf_walker walker, void * user);
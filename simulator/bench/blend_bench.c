@@ -0,0 +1,257 @@
+/**
+ ****************************************************************************************
+ *
+ * @file blend_bench.c
+ *
+ * @brief Micro-benchmark of the vectorized software blending
+ *
+ * Blends full-screen fills and maps through _lv_blend_fill()/_lv_blend_map() twice: with the
+ * SIMD kernels of lv_draw_blend_simd.c and with the scalar loops of lv_draw_blend.c, compiled
+ * a second time with DLG_LVGL_USE_BLEND_SIMD=0 (see CMakeLists.txt). Both results must be
+ * identical, the speedup is printed per case.
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "gdi.h"
+#include "src/draw/lv_draw_blend_simd.h"
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#define BENCH_RESX                      DEMO_RESX
+#define BENCH_RESY                      DEMO_RESY
+#define BENCH_DEFAULT_ITERATIONS        (20)
+
+/*
+ *       Types
+ *****************************************************************************************
+ */
+typedef struct {
+        const char *name;
+        bool map;
+        lv_blend_mode_t mode;
+        lv_opa_t opa;
+        bool masked;
+} blend_case_t;
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+static lv_color_t pattern[BENCH_RESX * BENCH_RESY];
+static lv_color_t map[BENCH_RESX * BENCH_RESY];
+static lv_color_t buf_simd[BENCH_RESX * BENCH_RESY];
+static lv_color_t buf_scalar[BENCH_RESX * BENCH_RESY];
+static lv_opa_t mask[BENCH_RESX * BENCH_RESY];
+
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+
+/* Only the blend paths left to the CPU that have SIMD kernels */
+static const blend_case_t cases[] = {
+        { "fill_additive",         false, LV_BLEND_MODE_ADDITIVE,    LV_OPA_COVER, false },
+        { "fill_additive_opa",     false, LV_BLEND_MODE_ADDITIVE,    LV_OPA_50,    false },
+        { "fill_additive_mask",    false, LV_BLEND_MODE_ADDITIVE,    LV_OPA_80,    true  },
+        { "fill_subtractive_opa",  false, LV_BLEND_MODE_SUBTRACTIVE, LV_OPA_50,    false },
+        { "fill_subtractive_mask", false, LV_BLEND_MODE_SUBTRACTIVE, LV_OPA_COVER, true  },
+        { "map_normal_opa",        true,  LV_BLEND_MODE_NORMAL,      LV_OPA_50,    false },
+        { "map_normal_mask_opa",   true,  LV_BLEND_MODE_NORMAL,      LV_OPA_70,    true  },
+        { "map_additive_opa",      true,  LV_BLEND_MODE_ADDITIVE,    LV_OPA_50,    false },
+        { "map_additive_mask",     true,  LV_BLEND_MODE_ADDITIVE,    LV_OPA_COVER, true  },
+        { "map_subtractive_mask",  true,  LV_BLEND_MODE_SUBTRACTIVE, LV_OPA_80,    true  },
+};
+
+/*
+ *       Scalar build of lv_draw_blend.c
+ *****************************************************************************************
+ */
+void _lv_blend_fill_scalar(const lv_area_t *clip_area, const lv_area_t *fill_area, lv_color_t color,
+        lv_opa_t *mask, lv_draw_mask_res_t mask_res, lv_opa_t opa, lv_blend_mode_t mode);
+void _lv_blend_map_scalar(const lv_area_t *clip_area, const lv_area_t *map_area, const lv_color_t *map_buf,
+        lv_opa_t *mask, lv_draw_mask_res_t mask_res, lv_opa_t opa, lv_blend_mode_t mode);
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static uint64_t now_ns(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static const char *simd_name(void)
+{
+        switch (LV_BLEND_SIMD) {
+        case LV_BLEND_SIMD_SSE2:
+                return "SSE2";
+        case LV_BLEND_SIMD_NEON:
+                return "NEON";
+        case LV_BLEND_SIMD_ARM_DSP:
+                return "ARM DSP";
+        default:
+                return "none";
+        }
+}
+
+static void data_init(void)
+{
+        for (int y = 0; y < BENCH_RESY; y++) {
+                for (int x = 0; x < BENCH_RESX; x++) {
+                        int i = y * BENCH_RESX + x;
+                        int m = (x + y / 4) % 97;
+
+                        pattern[i] = lv_color_make(x * 255 / BENCH_RESX, y * 255 / BENCH_RESY, (x ^ y) & 0xFF);
+                        map[i] = lv_color_make((x * 7) & 0xFF, 255 - y * 255 / BENCH_RESY, (x + y) & 0xFF);
+
+                        /* Transparent, anti-aliased and covered runs */
+                        mask[i] = m < 20 ? LV_OPA_TRANSP : (m > 60 ? LV_OPA_COVER : (m - 20) * 6);
+                }
+        }
+}
+
+static void display_init(void)
+{
+        static lv_disp_t *disp;
+        lv_disp_draw_buf_t *db;
+
+        lv_disp_draw_buf_init(&draw_buf, buf_simd, NULL, BENCH_RESX * BENCH_RESY);
+
+        lv_disp_drv_init(&disp_drv);
+        disp_drv.hor_res = BENCH_RESX;
+        disp_drv.ver_res = BENCH_RESY;
+        disp_drv.draw_buf = &draw_buf;
+        disp = lv_disp_drv_register(&disp_drv);
+
+        /* The blend functions draw into the buffer of the display being refreshed */
+        _lv_refr_set_disp_refreshing(disp);
+        db = lv_disp_get_draw_buf(disp);
+        lv_area_set(&db->area, 0, 0, BENCH_RESX - 1, BENCH_RESY - 1);
+}
+
+static void run(const blend_case_t *bc, lv_color_t *buf, bool scalar)
+{
+        lv_disp_draw_buf_t *db = lv_disp_get_draw_buf(_lv_refr_get_disp_refreshing());
+        lv_area_t area;
+
+        db->buf_act = buf;
+        lv_area_set(&area, 0, 0, BENCH_RESX - 1, BENCH_RESY - 1);
+
+        if (!bc->masked) {
+                if (bc->map) {
+                        (scalar ? _lv_blend_map_scalar : _lv_blend_map)(&area, &area, map, NULL,
+                                LV_DRAW_MASK_RES_FULL_COVER, bc->opa, bc->mode);
+                } else {
+                        (scalar ? _lv_blend_fill_scalar : _lv_blend_fill)(&area, &area, lv_color_make(0x40, 0x80, 0x20),
+                                NULL, LV_DRAW_MASK_RES_FULL_COVER, bc->opa, bc->mode);
+                }
+                return;
+        }
+
+        /* Masked draws are blended line by line, as the LVGL draw functions do */
+        for (int y = 0; y < BENCH_RESY; y++) {
+                lv_area_t line;
+
+                lv_area_set(&line, 0, y, BENCH_RESX - 1, y);
+                if (bc->map) {
+                        (scalar ? _lv_blend_map_scalar : _lv_blend_map)(&line, &area, map, &mask[y * BENCH_RESX],
+                                LV_DRAW_MASK_RES_CHANGED, bc->opa, bc->mode);
+                } else {
+                        (scalar ? _lv_blend_fill_scalar : _lv_blend_fill)(&line, &line, lv_color_make(0x40, 0x80, 0x20),
+                                &mask[y * BENCH_RESX], LV_DRAW_MASK_RES_CHANGED, bc->opa, bc->mode);
+                }
+        }
+}
+
+static double measure(const blend_case_t *bc, lv_color_t *buf, bool scalar, int iterations)
+{
+        uint64_t total = 0;
+
+        for (int i = 0; i < iterations; i++) {
+                uint64_t start;
+
+                memcpy(buf, pattern, sizeof(pattern));
+                start = now_ns();
+                run(bc, buf, scalar);
+                total += now_ns() - start;
+        }
+
+        return (double)total / iterations;
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+uint64_t gdi_get_sys_uptime_ticks(void)
+{
+        return now_ns() / 1000;
+}
+
+uint64_t gdi_convert_ticks_to_us(uint64_t ticks)
+{
+        return ticks;
+}
+
+uint64_t gdi_get_sys_uptime_ns(void)
+{
+        return now_ns();
+}
+
+int main(int argc, char *argv[])
+{
+        int iterations = BENCH_DEFAULT_ITERATIONS;
+        int failures = 0;
+        int opt;
+
+        while ((opt = getopt(argc, argv, "n:h")) != -1) {
+                switch (opt) {
+                case 'n':
+                        iterations = LV_MAX(1, atoi(optarg));
+                        break;
+                default:
+                        fprintf(stderr, "Usage: %s [-n iterations]\n", argv[0]);
+                        return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+                }
+        }
+
+        lv_init();
+        display_init();
+        data_init();
+
+        printf("%dx%d, %d bpp, SIMD kernels: %s\n", BENCH_RESX, BENCH_RESY, LV_COLOR_DEPTH, simd_name());
+        printf("%-24s %12s %12s %8s  %s\n", "case", "scalar Mpx/s", "simd Mpx/s", "speedup", "result");
+
+        for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+                const blend_case_t *bc = &cases[i];
+                double px = BENCH_RESX * BENCH_RESY;
+                double t_scalar, t_simd;
+                bool same;
+
+                t_scalar = measure(bc, buf_scalar, true, iterations);
+                t_simd = measure(bc, buf_simd, false, iterations);
+                same = !memcmp(buf_scalar, buf_simd, sizeof(buf_simd));
+                if (!same) {
+                        failures++;
+                }
+
+                printf("%-24s %12.1f %12.1f %7.2fx  %s\n", bc->name, px * 1e3 / t_scalar, px * 1e3 / t_simd,
+                        t_scalar / t_simd, same ? "identical" : "MISMATCH");
+        }
+
+        return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,255 @@
+/**
+ ****************************************************************************************
+ *
+ * @file bundle_test.c
+ *
+ * @brief Rejection paths of the resource bundle checks
+ *
+ * Loads the bundle packed by res_pack (see simulator/tools/res_pack.c), checks that it is
+ * accepted, then corrupts it field by field and checks that res_bundle_check() reports the
+ * expected RES_BUNDLE_ERR_... The entry fields are corrupted with the CRC of the index updated,
+ * so that the entry checks are reached. Exits with 1 if any case fails.
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "res_bundle.h"
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#ifndef BENCH_RESOURCES_PATH
+#define BENCH_RESOURCES_PATH            "WatchDemoColoredResources.bin"
+#endif
+
+#define TEST_MAX_SIZE                   (4 * 1024 * 1024)
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+static uint8_t *bundle_ref;
+static uint8_t *bundle_buf;
+static size_t bundle_size;
+static int fail_cnt;
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static size_t read_file(const char *path, uint8_t *buf, size_t size)
+{
+        FILE *f = fopen(path, "rb");
+        size_t len;
+
+        if (!f) {
+                perror(path);
+                return 0;
+        }
+        len = fread(buf, 1, size, f);
+        fclose(f);
+
+        return len;
+}
+
+/* Start a case from the valid bundle */
+static res_bundle_header_t *bundle_reset(void)
+{
+        memcpy(bundle_buf, bundle_ref, bundle_size);
+
+        return (res_bundle_header_t *)bundle_buf;
+}
+
+/* Writable entry i of the bundle under test */
+static res_bundle_entry_t *bundle_entry(res_bundle_header_t *bundle, int i)
+{
+        return (res_bundle_entry_t *)res_bundle_index(bundle) + i;
+}
+
+/* Update the CRC of the index after an entry has been changed */
+static void bundle_reseal(res_bundle_header_t *bundle)
+{
+        bundle->index_crc = res_bundle_crc32(0, res_bundle_index(bundle),
+                bundle->count * sizeof(res_bundle_entry_t));
+}
+
+/* First entry stored with the given compression */
+static int find_entry(res_bundle_comp_t comp)
+{
+        res_bundle_header_t *bundle = (res_bundle_header_t *)bundle_ref;
+
+        for (int i = 0; i < bundle->count; i++) {
+                if (bundle_entry(bundle, i)->comp == comp) {
+                        return i;
+                }
+        }
+
+        return -1;
+}
+
+static void expect(const char *name, size_t area_size, bool check_data, res_bundle_err_t expected)
+{
+        res_bundle_err_t err = res_bundle_check((const res_bundle_header_t *)bundle_buf, area_size,
+                check_data);
+
+        printf("%-32s %s (%d, expected %d)\n", name, err == expected ? "ok" : "FAIL", err, expected);
+        if (err != expected) {
+                fail_cnt++;
+        }
+}
+
+static void test_header(void)
+{
+        res_bundle_header_t *bundle;
+
+        bundle_reset();
+        expect("valid", bundle_size, true, RES_BUNDLE_OK);
+
+        bundle = bundle_reset();
+        bundle->magic ^= 1;
+        expect("magic", bundle_size, false, RES_BUNDLE_ERR_MAGIC);
+
+        bundle = bundle_reset();
+        bundle->version++;
+        expect("version", bundle_size, false, RES_BUNDLE_ERR_VERSION);
+
+        bundle_reset();
+        expect("area smaller than header", sizeof(res_bundle_header_t) - 1, false, RES_BUNDLE_ERR_SIZE);
+        expect("truncated", bundle_size - 1, false, RES_BUNDLE_ERR_SIZE);
+
+        bundle = bundle_reset();
+        bundle->size = sizeof(res_bundle_header_t) + bundle->count * sizeof(res_bundle_entry_t) - 1;
+        expect("size smaller than index", bundle_size, false, RES_BUNDLE_ERR_SIZE);
+
+        bundle = bundle_reset();
+        bundle->index_crc ^= 1;
+        expect("index CRC", bundle_size, false, RES_BUNDLE_ERR_INDEX);
+
+        bundle = bundle_reset();
+        bundle_entry(bundle, bundle->count - 1)->h++;
+        expect("index changed", bundle_size, false, RES_BUNDLE_ERR_INDEX);
+}
+
+static void test_entry(int i)
+{
+        res_bundle_header_t *bundle;
+        res_bundle_entry_t *e;
+
+        bundle = bundle_reset();
+        e = bundle_entry(bundle, i);
+        e->offset += 4;
+        bundle_reseal(bundle);
+        expect("misaligned offset", bundle_size, false, RES_BUNDLE_ERR_ENTRY);
+
+        bundle = bundle_reset();
+        e = bundle_entry(bundle, i);
+        e->offset = bundle->size + RES_BUNDLE_ALIGN;
+        bundle_reseal(bundle);
+        expect("offset past the end", bundle_size, false, RES_BUNDLE_ERR_ENTRY);
+
+        bundle = bundle_reset();
+        e = bundle_entry(bundle, i);
+        e->offset = 0;
+        bundle_reseal(bundle);
+        expect("offset in the index", bundle_size, false, RES_BUNDLE_ERR_ENTRY);
+
+        bundle = bundle_reset();
+        e = bundle_entry(bundle, i);
+        e->size = bundle->size - e->offset + 1;
+        bundle_reseal(bundle);
+        expect("data past the end", bundle_size, false, RES_BUNDLE_ERR_ENTRY);
+
+        bundle = bundle_reset();
+        e = bundle_entry(bundle, i);
+        e->w = 0;
+        bundle_reseal(bundle);
+        expect("zero width", bundle_size, false, RES_BUNDLE_ERR_ENTRY);
+
+        bundle = bundle_reset();
+        e = bundle_entry(bundle, i);
+        e->comp = RES_BUNDLE_COMP_RLE + 1;
+        bundle_reseal(bundle);
+        expect("unknown comp", bundle_size, false, RES_BUNDLE_ERR_ENTRY);
+
+        bundle = bundle_reset();
+        e = bundle_entry(bundle, i);
+        if (e->comp == RES_BUNDLE_COMP_NONE) {
+                e->stride++;
+                bundle_reseal(bundle);
+                expect("stride * h != size", bundle_size, false, RES_BUNDLE_ERR_ENTRY);
+
+                bundle = bundle_reset();
+                e = bundle_entry(bundle, i);
+                e->stride = 0;
+                bundle_reseal(bundle);
+                expect("raw without stride", bundle_size, false, RES_BUNDLE_ERR_ENTRY);
+        } else {
+                e->stride = e->w * 2;
+                bundle_reseal(bundle);
+                expect("RLE with stride", bundle_size, false, RES_BUNDLE_ERR_ENTRY);
+
+                bundle = bundle_reset();
+                e = bundle_entry(bundle, i);
+                e->size = 0;
+                bundle_reseal(bundle);
+                expect("RLE without data", bundle_size, false, RES_BUNDLE_ERR_ENTRY);
+        }
+
+        /* The pixels are only checked on request */
+        bundle = bundle_reset();
+        e = bundle_entry(bundle, i);
+        bundle_buf[e->offset + e->size / 2] ^= 0x80;
+        expect("data CRC", bundle_size, true, RES_BUNDLE_ERR_DATA);
+        expect("data CRC not checked", bundle_size, false, RES_BUNDLE_OK);
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+int main(int argc, char *argv[])
+{
+        const char *path = argc > 1 ? argv[1] : BENCH_RESOURCES_PATH;
+        int raw, rle;
+
+        bundle_ref = malloc(TEST_MAX_SIZE);
+        bundle_buf = malloc(TEST_MAX_SIZE);
+        if (!bundle_ref || !bundle_buf) {
+                return 1;
+        }
+
+        bundle_size = read_file(path, bundle_ref, TEST_MAX_SIZE);
+        if (!bundle_size || bundle_size == TEST_MAX_SIZE) {
+                fprintf(stderr, "%s: cannot load the bundle\n", path);
+                return 1;
+        }
+
+        raw = find_entry(RES_BUNDLE_COMP_NONE);
+        rle = find_entry(RES_BUNDLE_COMP_RLE);
+
+        printf("Header:\n");
+        test_header();
+        if (raw >= 0) {
+                printf("\nRaw entry %d:\n", raw);
+                test_entry(raw);
+        }
+        if (rle >= 0) {
+                printf("\nRLE entry %d:\n", rle);
+                test_entry(rle);
+        }
+
+        printf("\n%s\n", fail_cnt ? "FAILED" : "PASSED");
+
+        free(bundle_buf);
+        free(bundle_ref);
+
+        return fail_cnt ? 1 : 0;
+}
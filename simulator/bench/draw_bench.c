@@ -0,0 +1,734 @@
+/**
+ ****************************************************************************************
+ *
+ * @file draw_bench.c
+ *
+ * @brief Pixel regression and performance bench of the LVGL draw paths
+ *
+ * Renders a catalog of primitives (rounded rectangles, borders, shadows, arcs, transformed
+ * and recolored images, labels in every enabled Montserrat size) on an off-screen display,
+ * one case at a time. Each result is compared with a golden PNG rendered by the LVGL software
+ * renderer, then the case is redrawn a number of times to measure the rendering cost per
+ * pixel of the invalidated area.
+ *
+ * The file is built once per renderer (see CMakeLists.txt). With the GPU renderer the draw
+ * calls go through lv_port_gpu.c on the software D/AVE2D, and the modelled GPU time is
+ * reported next to the host time, together with the number of GPU jobs of a redraw and their
+ * time as reported to gdi_perf_render_op_time().
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <math.h>
+#include <unistd.h>
+#include <png.h>
+#include "lvgl.h"
+#include "gdi.h"
+#include "lv_port_gpu.h"
+#if LV_PORT_DISP_GPU_EN
+#include "dave_driver.h"
+#include "dave_sim.h"
+#endif
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#ifndef BENCH_RENDERER
+#define BENCH_RENDERER                  "sw"
+#endif
+
+#ifndef BENCH_GOLDEN_PATH
+#define BENCH_GOLDEN_PATH               "golden"
+#endif
+
+#define BENCH_RESX                      (200)
+#define BENCH_RESY                      (200)
+#define BENCH_DEFAULT_ITERATIONS        (20)
+#define BENCH_MAX_ITERATIONS            (1000)
+
+#define BENCH_IMG_SIZE                  (64)
+
+/*
+ * Default tolerance: max channel difference of a matching pixel (2 LSB of RGB565, which is up
+ * to 17 once the 5-bit channels are expanded to 8 bits) and the differing pixels allowed per
+ * mille of the display. The filtered edges of transformed images
+ * are interpolated differently by the two renderers and get a larger allowance.
+ * So do the circles and lines the GPU anti-aliases by their coverage instead of LVGL's masks.
+ */
+#define BENCH_TOLERANCE                 (17)
+#define BENCH_MAX_MISMATCH              (1)
+#define BENCH_MAX_MISMATCH_TRANSFORM    (16)
+#define BENCH_MAX_MISMATCH_SHAPE        (4)
+
+/* Case flags */
+#define BENCH_GOLDEN_GPU                (1 << 0)        /* Not drawn by the SW renderer, golden taken from the GPU path */
+
+/*
+ *       Types
+ *****************************************************************************************
+ */
+typedef lv_obj_t *(*bench_create_cb_t)(lv_obj_t *parent, const void *param);
+
+typedef struct {
+        const char *name;
+        bench_create_cb_t create;
+        const void *param;
+        uint8_t tolerance;              /* Max channel difference of a matching pixel */
+        uint16_t max_mismatch;          /* Allowed differing pixels, per mille */
+        uint8_t flags;
+} bench_case_t;
+
+typedef struct {
+        uint32_t pixels;
+        double host_ns_per_px;
+        double gpu_ns_per_px;
+        uint32_t gpu_jobs;
+        uint32_t gpu_job_us;
+        int max_diff;
+        double mismatch_permille;
+        const char *result;
+} bench_result_t;
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+static lv_color_t draw_buf_mem[BENCH_RESX * BENCH_RESY];
+static lv_color_t screen[BENCH_RESX * BENCH_RESY];
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+static lv_disp_t *disp;
+static bool text_batch = true;
+static bool gpu_shapes = true;
+
+/* GPU jobs reported by lv_port_gpu.c */
+static uint32_t gpu_jobs;
+static uint32_t gpu_job_us;
+
+#if LV_USE_EXTERNAL_RENDERER
+/* The GPU path takes the D/AVE2D native format */
+static uint32_t img_argb_map[BENCH_IMG_SIZE * BENCH_IMG_SIZE];
+#define BENCH_IMG_ARGB_CF               LV_IMG_CF_ARGB8888
+#else
+/* Same content in the format the software renderer decodes */
+static uint8_t img_argb_map[BENCH_IMG_SIZE * BENCH_IMG_SIZE * LV_IMG_PX_SIZE_ALPHA_BYTE];
+#define BENCH_IMG_ARGB_CF               LV_IMG_CF_TRUE_COLOR_ALPHA
+#endif
+static uint8_t img_i4_map[16 * sizeof(lv_color32_t) + BENCH_IMG_SIZE * BENCH_IMG_SIZE / 2];
+
+static lv_img_dsc_t img_argb;
+static lv_img_dsc_t img_i4;
+
+/*
+ *       Catalog
+ *****************************************************************************************
+ */
+static lv_obj_t *create_rect(lv_obj_t *parent, const void *param)
+{
+        lv_obj_t *obj = lv_obj_create(parent);
+
+        (void)param;
+
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_size(obj, 140, 100);
+        lv_obj_set_style_radius(obj, 24, 0);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_BLUE), 0);
+        lv_obj_set_style_border_width(obj, 6, 0);
+        lv_obj_set_style_border_color(obj, lv_color_white(), 0);
+        lv_obj_set_style_border_opa(obj, LV_OPA_80, 0);
+        lv_obj_center(obj);
+
+        return obj;
+}
+
+static lv_obj_t *create_rect_gradient(lv_obj_t *parent, const void *param)
+{
+        lv_obj_t *obj = create_rect(parent, param);
+
+        lv_obj_set_style_border_width(obj, 0, 0);
+        lv_obj_set_style_bg_grad_color(obj, lv_palette_main(LV_PALETTE_ORANGE), 0);
+        lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, 0);
+
+        return obj;
+}
+
+static lv_obj_t *create_rect_shadow(lv_obj_t *parent, const void *param)
+{
+        lv_obj_t *obj = create_rect(parent, param);
+
+        lv_obj_set_size(obj, 100, 70);
+        lv_obj_set_style_radius(obj, 12, 0);
+        lv_obj_set_style_border_width(obj, 0, 0);
+        lv_obj_set_style_shadow_width(obj, 24, 0);
+        lv_obj_set_style_shadow_ofs_x(obj, 6, 0);
+        lv_obj_set_style_shadow_ofs_y(obj, 8, 0);
+        lv_obj_set_style_shadow_opa(obj, LV_OPA_60, 0);
+        lv_obj_set_style_shadow_color(obj, lv_color_black(), 0);
+
+        return obj;
+}
+
+static lv_obj_t *create_arc(lv_obj_t *parent, const void *param)
+{
+        lv_obj_t *arc = lv_arc_create(parent);
+
+        (void)param;
+
+        lv_obj_remove_style_all(arc);
+        lv_obj_set_size(arc, 150, 150);
+        lv_arc_set_bg_angles(arc, 0, 360);
+        lv_arc_set_angles(arc, 30, 250);
+        lv_obj_set_style_arc_width(arc, 10, LV_PART_MAIN);
+        lv_obj_set_style_arc_color(arc, lv_palette_lighten(LV_PALETTE_GREY, 2), LV_PART_MAIN);
+        lv_obj_set_style_arc_width(arc, 16, LV_PART_INDICATOR);
+        lv_obj_set_style_arc_color(arc, lv_palette_main(LV_PALETTE_RED), LV_PART_INDICATOR);
+        lv_obj_set_style_arc_rounded(arc, true, LV_PART_INDICATOR);
+        lv_obj_center(arc);
+
+        return arc;
+}
+
+/* param: rounded ends */
+static lv_obj_t *create_line(lv_obj_t *parent, const void *param)
+{
+        static const lv_point_t points[] = { { 10, 120 }, { 50, 10 }, { 90, 100 }, { 170, 60 } };
+        lv_obj_t *line = lv_line_create(parent);
+
+        lv_line_set_points(line, points, sizeof(points) / sizeof(points[0]));
+        lv_obj_set_style_line_width(line, param ? 10 : 7, 0);
+        lv_obj_set_style_line_color(line, lv_palette_main(LV_PALETTE_GREEN), 0);
+        lv_obj_set_style_line_rounded(line, param != NULL, 0);
+        lv_obj_center(line);
+
+        return line;
+}
+
+/* param: { image, angle (0.1 deg), zoom (256 = 1x), recolor opa, opa } */
+static lv_obj_t *create_img(lv_obj_t *parent, const void *param)
+{
+        const int32_t *p = param;
+        lv_obj_t *img = lv_img_create(parent);
+
+        lv_img_set_src(img, p[0] ? &img_i4 : &img_argb);
+        lv_img_set_angle(img, p[1]);
+        lv_img_set_zoom(img, p[2]);
+        lv_img_set_antialias(img, true);
+        lv_obj_set_style_img_recolor(img, lv_palette_main(LV_PALETTE_RED), 0);
+        lv_obj_set_style_img_recolor_opa(img, p[3], 0);
+        lv_obj_set_style_img_opa(img, p[4], 0);
+        lv_obj_center(img);
+
+        return img;
+}
+
+static lv_obj_t *create_label(lv_obj_t *parent, const void *param)
+{
+        lv_obj_t *label = lv_label_create(parent);
+
+        lv_obj_set_style_text_font(label, param, 0);
+        lv_obj_set_style_text_color(label, lv_color_make(0x20, 0x20, 0x40), 0);
+        lv_label_set_text(label, "Ag 09");
+        lv_obj_center(label);
+
+        return label;
+}
+
+static const int32_t img_argb_plain[]      = { 0, 0,   256, LV_OPA_TRANSP, LV_OPA_COVER };
+static const int32_t img_argb_opa[]        = { 0, 0,   256, LV_OPA_TRANSP, LV_OPA_50 };
+static const int32_t img_argb_recolor[]    = { 0, 0,   256, LV_OPA_50,     LV_OPA_COVER };
+static const int32_t img_argb_rotated[]    = { 0, 300, 256, LV_OPA_TRANSP, LV_OPA_COVER };
+static const int32_t img_argb_zoomed[]     = { 0, 0,   384, LV_OPA_TRANSP, LV_OPA_COVER };
+static const int32_t img_i4_plain[]        = { 1, 0,   256, LV_OPA_TRANSP, LV_OPA_COVER };
+static const int32_t img_i4_rotozoomed[]   = { 1, 450, 320, LV_OPA_TRANSP, LV_OPA_COVER };
+
+#define LABEL_CASE(size) \
+        { "label_montserrat_" #size, create_label, &lv_font_montserrat_##size, BENCH_TOLERANCE, BENCH_MAX_MISMATCH, 0 }
+
+static const bench_case_t catalog[] = {
+        { "rect_radius_border", create_rect,          NULL,              BENCH_TOLERANCE, BENCH_MAX_MISMATCH,           0 },
+        { "rect_gradient",      create_rect_gradient, NULL,              BENCH_TOLERANCE, BENCH_MAX_MISMATCH,           0 },
+        { "rect_shadow",        create_rect_shadow,   NULL,              BENCH_TOLERANCE, BENCH_MAX_MISMATCH,           0 },
+        { "arc_rounded",        create_arc,           NULL,              BENCH_TOLERANCE, BENCH_MAX_MISMATCH_SHAPE,     0 },
+        { "line_skew",          create_line,          NULL,              BENCH_TOLERANCE, BENCH_MAX_MISMATCH_SHAPE,     0 },
+        { "line_rounded",       create_line,          "",                BENCH_TOLERANCE, BENCH_MAX_MISMATCH_SHAPE,     0 },
+        { "img_argb",           create_img,           img_argb_plain,    BENCH_TOLERANCE, BENCH_MAX_MISMATCH,           0 },
+        { "img_argb_opa",       create_img,           img_argb_opa,      BENCH_TOLERANCE, BENCH_MAX_MISMATCH,           0 },
+        { "img_argb_recolor",   create_img,           img_argb_recolor,  BENCH_TOLERANCE, BENCH_MAX_MISMATCH,           0 },
+        { "img_argb_rotated",   create_img,           img_argb_rotated,  BENCH_TOLERANCE, BENCH_MAX_MISMATCH_TRANSFORM, 0 },
+        { "img_argb_zoomed",    create_img,           img_argb_zoomed,   BENCH_TOLERANCE, BENCH_MAX_MISMATCH_TRANSFORM, 0 },
+        { "img_i4",             create_img,           img_i4_plain,      BENCH_TOLERANCE, BENCH_MAX_MISMATCH,           0 },
+        /* LVGL 8.1 only transforms images the decoder opens in full, indexed ones are read by line */
+        { "img_i4_rotozoomed",  create_img,           img_i4_rotozoomed, BENCH_TOLERANCE, BENCH_MAX_MISMATCH_TRANSFORM, BENCH_GOLDEN_GPU },
+#if LV_FONT_MONTSERRAT_8
+        LABEL_CASE(8),
+#endif
+#if LV_FONT_MONTSERRAT_10
+        LABEL_CASE(10),
+#endif
+#if LV_FONT_MONTSERRAT_12
+        LABEL_CASE(12),
+#endif
+#if LV_FONT_MONTSERRAT_14
+        LABEL_CASE(14),
+#endif
+#if LV_FONT_MONTSERRAT_16
+        LABEL_CASE(16),
+#endif
+#if LV_FONT_MONTSERRAT_18
+        LABEL_CASE(18),
+#endif
+#if LV_FONT_MONTSERRAT_20
+        LABEL_CASE(20),
+#endif
+#if LV_FONT_MONTSERRAT_22
+        LABEL_CASE(22),
+#endif
+#if LV_FONT_MONTSERRAT_24
+        LABEL_CASE(24),
+#endif
+#if LV_FONT_MONTSERRAT_26
+        LABEL_CASE(26),
+#endif
+#if LV_FONT_MONTSERRAT_28
+        LABEL_CASE(28),
+#endif
+#if LV_FONT_MONTSERRAT_30
+        LABEL_CASE(30),
+#endif
+#if LV_FONT_MONTSERRAT_32
+        LABEL_CASE(32),
+#endif
+#if LV_FONT_MONTSERRAT_34
+        LABEL_CASE(34),
+#endif
+#if LV_FONT_MONTSERRAT_36
+        LABEL_CASE(36),
+#endif
+#if LV_FONT_MONTSERRAT_38
+        LABEL_CASE(38),
+#endif
+#if LV_FONT_MONTSERRAT_40
+        LABEL_CASE(40),
+#endif
+#if LV_FONT_MONTSERRAT_42
+        LABEL_CASE(42),
+#endif
+#if LV_FONT_MONTSERRAT_44
+        LABEL_CASE(44),
+#endif
+#if LV_FONT_MONTSERRAT_46
+        LABEL_CASE(46),
+#endif
+#if LV_FONT_MONTSERRAT_48
+        LABEL_CASE(48),
+#endif
+};
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static uint64_t now_ns(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void images_init(void)
+{
+        lv_color32_t *palette = (lv_color32_t *)img_i4_map;
+
+        img_argb.header.w = img_i4.header.w = BENCH_IMG_SIZE;
+        img_argb.header.h = img_i4.header.h = BENCH_IMG_SIZE;
+
+        img_argb.header.cf = BENCH_IMG_ARGB_CF;
+        img_argb.data = (const uint8_t *)img_argb_map;
+        img_argb.data_size = sizeof(img_argb_map);
+
+        img_i4.header.cf = LV_IMG_CF_INDEXED_4BIT;
+        img_i4.data = img_i4_map;
+        img_i4.data_size = sizeof(img_i4_map);
+
+        /* Index 0 is transparent */
+        for (int i = 1; i < 16; i++) {
+                palette[i].full = lv_color_to32(lv_palette_main((lv_palette_t)(i - 1)));
+        }
+
+        for (int y = 0; y < BENCH_IMG_SIZE; y++) {
+                for (int x = 0; x < BENCH_IMG_SIZE; x++) {
+                        /* Disc with a soft edge over a color gradient */
+                        float dx = x - (BENCH_IMG_SIZE - 1) / 2.0f, dy = y - (BENCH_IMG_SIZE - 1) / 2.0f;
+                        float edge = (BENCH_IMG_SIZE / 2 - 2) - sqrtf(dx * dx + dy * dy);
+                        lv_opa_t a = edge <= 0 ? 0 : (edge >= 2 ? LV_OPA_COVER : (lv_opa_t)(edge * 127.5f));
+                        lv_color_t c = lv_color_make(x * 4, y * 4, 255 - x * 2);
+                        lv_color_t index;
+#if LV_USE_EXTERNAL_RENDERER
+                        lv_color32_t c32;
+
+                        c32.full = lv_color_to32(c);
+                        c32.ch.alpha = a;
+                        img_argb_map[y * BENCH_IMG_SIZE + x] = c32.full;
+#else
+                        lv_img_buf_set_px_color(&img_argb, x, y, c);
+                        lv_img_buf_set_px_alpha(&img_argb, x, y, a);
+#endif
+                        index.full = ((x / 8) + (y / 8) * 3) & 0xF;
+                        lv_img_buf_set_px_color(&img_i4, x, y, index);
+                }
+        }
+}
+
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+        int w = lv_area_get_width(area);
+
+#if LV_PORT_DISP_GPU_EN
+        lv_port_gpu_flush();
+#endif
+
+        for (int y = area->y1; y <= area->y2; y++) {
+                memcpy(&screen[y * BENCH_RESX + area->x1], &color_p[(y - area->y1) * w], w * sizeof(lv_color_t));
+        }
+
+        lv_disp_flush_ready(drv);
+}
+
+static void display_init(void)
+{
+        lv_disp_draw_buf_init(&draw_buf, draw_buf_mem, NULL, BENCH_RESX * BENCH_RESY);
+
+        lv_disp_drv_init(&disp_drv);
+        disp_drv.hor_res = BENCH_RESX;
+        disp_drv.ver_res = BENCH_RESY;
+        disp_drv.flush_cb = flush_cb;
+        disp_drv.draw_buf = &draw_buf;
+
+#if LV_PORT_DISP_GPU_EN
+        /* Same hooks as lv_port_disp.c */
+        lv_port_gpu_init();
+
+        disp_drv.gpu_fill_cb = lv_port_gpu_fill;
+        disp_drv.gpu_blit_cb = lv_port_gpu_blit;
+        disp_drv.gpu_blit_with_mask_cb = lv_port_gpu_blit_with_mask;
+        disp_drv.gpu_blit_batch_cb = text_batch ? lv_port_gpu_blit_batch : NULL;
+        disp_drv.gpu_draw_shape_cb = gpu_shapes ? lv_port_gpu_draw_shape : NULL;
+        disp_drv.gpu_config_blit_cb = lv_port_gpu_config_blit;
+        disp_drv.gpu_wait_cb = lv_port_gpu_wait;
+        disp_drv.gpu_invalidate_src_cb = lv_port_gpu_invalidate_src;
+#endif
+
+        disp = lv_disp_drv_register(&disp_drv);
+}
+
+static void screen_to_rgb(uint8_t *rgb)
+{
+        for (int i = 0; i < BENCH_RESX * BENCH_RESY; i++) {
+                lv_color32_t c;
+
+                c.full = lv_color_to32(screen[i]);
+
+                rgb[i * 3 + 0] = c.ch.red;
+                rgb[i * 3 + 1] = c.ch.green;
+                rgb[i * 3 + 2] = c.ch.blue;
+        }
+}
+
+static bool png_write(const char *path, const uint8_t *rgb)
+{
+        png_image image;
+
+        memset(&image, 0, sizeof(image));
+        image.version = PNG_IMAGE_VERSION;
+        image.width = BENCH_RESX;
+        image.height = BENCH_RESY;
+        image.format = PNG_FORMAT_RGB;
+
+        return png_image_write_to_file(&image, path, 0, rgb, 0, NULL);
+}
+
+static bool png_read(const char *path, uint8_t *rgb)
+{
+        png_image image;
+
+        memset(&image, 0, sizeof(image));
+        image.version = PNG_IMAGE_VERSION;
+
+        if (!png_image_begin_read_from_file(&image, path)) {
+                return false;
+        }
+        if (image.width != BENCH_RESX || image.height != BENCH_RESY) {
+                png_image_free(&image);
+                return false;
+        }
+        image.format = PNG_FORMAT_RGB;
+
+        return png_image_finish_read(&image, NULL, rgb, 0, NULL);
+}
+
+static void compare(const bench_case_t *bc, const uint8_t *rgb, const uint8_t *golden, bench_result_t *res)
+{
+        uint32_t mismatch = 0;
+
+        res->max_diff = 0;
+        for (int i = 0; i < BENCH_RESX * BENCH_RESY; i++) {
+                int diff = 0;
+
+                for (int ch = 0; ch < 3; ch++) {
+                        diff = LV_MAX(diff, abs(rgb[i * 3 + ch] - golden[i * 3 + ch]));
+                }
+                res->max_diff = LV_MAX(res->max_diff, diff);
+                if (diff > bc->tolerance) {
+                        mismatch++;
+                }
+        }
+
+        res->mismatch_permille = mismatch * 1000.0 / (BENCH_RESX * BENCH_RESY);
+        res->result = res->mismatch_permille <= bc->max_mismatch ? "pass" : "FAIL";
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+        uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+        return x < y ? -1 : x > y;
+}
+
+static void measure(lv_obj_t *obj, int iterations, bench_result_t *res)
+{
+        static uint64_t samples[BENCH_MAX_ITERATIONS];
+#if LV_PORT_DISP_GPU_EN
+        uint64_t cycles = 0;
+#endif
+
+        res->pixels = 0;
+
+        for (int i = 0; i < iterations; i++) {
+                uint64_t start;
+
+                lv_obj_invalidate(obj);
+                if (i == 0) {
+                        for (int a = 0; a < disp->inv_p; a++) {
+                                res->pixels += lv_area_get_size(&disp->inv_areas[a]);
+                        }
+                }
+
+#if LV_PORT_DISP_GPU_EN
+                cycles = dave_sim_get_cycles();
+#endif
+                gpu_jobs = gpu_job_us = 0;
+                start = now_ns();
+                lv_refr_now(disp);
+                samples[i] = now_ns() - start;
+#if LV_PORT_DISP_GPU_EN
+                cycles = dave_sim_get_cycles() - cycles;
+#endif
+        }
+
+        qsort(samples, iterations, sizeof(samples[0]), cmp_u64);
+        res->host_ns_per_px = res->pixels ? (double)samples[iterations / 2] / res->pixels : 0;
+
+        res->gpu_jobs = gpu_jobs;
+        res->gpu_job_us = gpu_job_us;
+
+        res->gpu_ns_per_px = 0;
+#if LV_PORT_DISP_GPU_EN
+        /* The modelled GPU time does not depend on the host, one redraw is enough */
+        if (res->pixels) {
+                res->gpu_ns_per_px = cycles * 1e9 / d1_deviceclkfreq(NULL, D1_DAVE2D) / res->pixels;
+        }
+#endif
+}
+
+static bool case_selected(const char *name, int argc, char *argv[])
+{
+        if (optind >= argc) {
+                return true;
+        }
+        for (int i = optind; i < argc; i++) {
+                if (!strncmp(name, argv[i], strlen(argv[i]))) {
+                        return true;
+                }
+        }
+        return false;
+}
+
+static void usage(const char *prog)
+{
+        fprintf(stderr,
+                "Usage: %s [-g golden_dir] [-u] [-d out_dir] [-o perf.csv] [-n iterations] [-b] [-p] [case_prefix...]\n"
+                "  -g  golden PNG directory (default: %s)\n"
+                "  -u  store the output as the new golden images instead of comparing\n"
+                "  -d  write the output of every case as PNG to this directory\n"
+                "  -o  append per-case timings to a CSV file\n"
+                "  -n  redraws per case for the timing (default: %d)\n"
+                "  -b  draw the letters of a label one GPU job each instead of batching them\n"
+                "  -p  draw rounded rectangles, arcs and lines with masks instead of the GPU shapes\n",
+                prog, BENCH_GOLDEN_PATH, BENCH_DEFAULT_ITERATIONS);
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+uint64_t gdi_get_sys_uptime_ticks(void)
+{
+        return now_ns() / 1000;
+}
+
+uint64_t gdi_convert_ticks_to_us(uint64_t ticks)
+{
+        return ticks;
+}
+
+uint64_t gdi_get_sys_uptime_ns(void)
+{
+        return now_ns();
+}
+
+#ifdef PERFORMANCE_METRICS
+void gdi_perf_render_op_time(int time_us, uint8_t tag)
+{
+        /* The GPU time per pixel comes from the cycle count of the software GPU, only the jobs are counted */
+        gpu_jobs++;
+        gpu_job_us += time_us;
+        (void)tag;
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+        static uint8_t rgb[BENCH_RESX * BENCH_RESY * 3], golden[BENCH_RESX * BENCH_RESY * 3];
+        const char *golden_dir = BENCH_GOLDEN_PATH;
+        const char *out_dir = NULL;
+        const char *csv_path = NULL;
+        bool update = false;
+        bool gpu = !!LV_PORT_DISP_GPU_EN;
+        int iterations = BENCH_DEFAULT_ITERATIONS;
+        int failures = 0;
+        FILE *csv = NULL;
+        lv_obj_t *scr;
+        int opt;
+
+        while ((opt = getopt(argc, argv, "g:ud:o:n:bph")) != -1) {
+                switch (opt) {
+                case 'g':
+                        golden_dir = optarg;
+                        break;
+                case 'u':
+                        update = true;
+                        break;
+                case 'd':
+                        out_dir = optarg;
+                        break;
+                case 'o':
+                        csv_path = optarg;
+                        break;
+                case 'n':
+                        iterations = LV_CLAMP(1, atoi(optarg), BENCH_MAX_ITERATIONS);
+                        break;
+                case 'b':
+                        text_batch = false;
+                        break;
+                case 'p':
+                        gpu_shapes = false;
+                        break;
+                default:
+                        usage(argv[0]);
+                        return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+                }
+        }
+
+        if (csv_path) {
+                csv = fopen(csv_path, "a");
+                if (!csv) {
+                        perror(csv_path);
+                        return EXIT_FAILURE;
+                }
+                if (ftell(csv) == 0) {
+                        fprintf(csv, "time,renderer,case,pixels,host_ns_per_px,gpu_ns_per_px,"
+                                "max_diff,mismatch_permille,result,gpu_jobs,gpu_job_us\n");
+                }
+        }
+
+        lv_init();
+        display_init();
+        images_init();
+
+        scr = lv_disp_get_scr_act(disp);
+        lv_obj_remove_style_all(scr);
+        lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(scr, lv_color_make(0xE8, 0xE8, 0xD8), 0);
+
+        printf("%-24s %8s %10s %10s %5s %7s %8s %10s  %s\n", "case (" BENCH_RENDERER ")", "pixels",
+                "host ns/px", "gpu ns/px", "jobs", "job us", "max diff", "mismatch", "result");
+
+        for (size_t i = 0; i < sizeof(catalog) / sizeof(catalog[0]); i++) {
+                const bench_case_t *bc = &catalog[i];
+                bench_result_t res = { 0 };
+                /* Goldens are written by the reference renderer of the case only */
+                bool reference = !!(bc->flags & BENCH_GOLDEN_GPU) == gpu;
+                char path[512];
+                lv_obj_t *obj;
+
+                if (!case_selected(bc->name, argc, argv)) {
+                        continue;
+                }
+
+                lv_obj_clean(scr);
+                obj = bc->create(scr, bc->param);
+                lv_obj_invalidate(scr);
+                lv_refr_now(disp);
+
+                screen_to_rgb(rgb);
+                snprintf(path, sizeof(path), "%s/%s.png", golden_dir, bc->name);
+
+                if (update) {
+                        res.result = !reference ? "kept" : png_write(path, rgb) ? "updated" : "FAIL";
+                } else if (png_read(path, golden)) {
+                        compare(bc, rgb, golden, &res);
+                        if (!reference && !gpu) {
+                                /* Known SW renderer gap, reported only */
+                                res.result = "n/a";
+                        }
+                } else {
+                        res.result = "no golden";
+                }
+                if (!strcmp(res.result, "FAIL") || !strcmp(res.result, "no golden")) {
+                        failures++;
+                }
+
+                if (out_dir) {
+                        snprintf(path, sizeof(path), "%s/%s.png", out_dir, bc->name);
+                        png_write(path, rgb);
+                }
+
+                measure(obj, iterations, &res);
+
+                printf("%-24s %8u %10.2f %10.2f %5u %7u %8d %9.2f%%  %s\n", bc->name, res.pixels,
+                        res.host_ns_per_px, res.gpu_ns_per_px, res.gpu_jobs, res.gpu_job_us, res.max_diff,
+                        res.mismatch_permille / 10, res.result);
+                if (csv) {
+                        fprintf(csv, "%ld,%s,%s,%u,%.3f,%.3f,%d,%.3f,%s,%u,%u\n", (long)time(NULL), BENCH_RENDERER,
+                                bc->name, res.pixels, res.host_ns_per_px, res.gpu_ns_per_px, res.max_diff,
+                                res.mismatch_permille, res.result, res.gpu_jobs, res.gpu_job_us);
+                }
+        }
+
+        if (csv) {
+                fclose(csv);
+        }
+
+        return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
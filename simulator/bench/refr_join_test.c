@@ -0,0 +1,182 @@
+/**
+ ****************************************************************************************
+ *
+ * @file refr_join_test.c
+ *
+ * @brief Cost of the invalidated areas joined by the cost model of lv_refr.c
+ *
+ * Replays the invalidated areas of the watch face tick frames, where the second hand sweeps over
+ * the hour hand, on a display set up like lv_port_disp.c: two frame buffers rendered in tiles,
+ * the areas aligned like the panel of the simulator and the cost model of the port. Checks that
+ * the modelled cost of the areas LVGL refreshes is never above the cost of the same areas joined
+ * by pixel count, both read from the refresh counters of the display. Exits with 1 if any frame
+ * costs more.
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "lvgl.h"
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#define TEST_RESX                       DEMO_RESX
+#define TEST_RESY                       DEMO_RESY
+#define TEST_TILE_SIZE                  (TEST_RESX * TEST_RESY / 3)
+
+/* Cost model of lv_port_disp.c */
+#define TEST_FLUSH_COST_NS              (100000)
+#define TEST_PX_COST_NS                 (84)
+
+#define TEST_MAX_AREAS                  (5)
+
+#if !DLG_LVGL_USE_REFR_STAT
+#error "The test reads the refresh counters of DLG_LVGL_USE_REFR_STAT"
+#endif
+
+/*
+ *       Types
+ *****************************************************************************************
+ */
+typedef struct {
+        int area_cnt;
+        lv_area_t areas[TEST_MAX_AREAS];
+} frame_t;
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+/* Invalidated areas of the tick frames, in the order of the invalidations */
+static const frame_t frames[] = {
+        { 5, { { 192, 190, 349, 201 }, { 192, 188, 349, 201 }, { 190, 52, 227, 197 }, { 162, 22, 227, 225 }, { 162, 20, 227, 225 } } },
+        { 4, { { 192, 188, 349, 201 }, { 190, 56, 241, 199 }, { 148, 8, 241, 239 }, { 146, 6, 243, 241 } } },
+        { 5, { { 192, 188, 349, 201 }, { 192, 188, 349, 203 }, { 190, 60, 255, 199 }, { 134, 0, 255, 253 }, { 132, 0, 257, 255 } } },
+        { 3, { { 192, 188, 349, 203 }, { 190, 68, 269, 199 }, { 120, 0, 269, 267 } } },
+        { 3, { { 192, 188, 349, 203 }, { 190, 74, 281, 199 }, { 108, 0, 281, 279 } } },
+        { 3, { { 192, 188, 349, 203 }, { 190, 84, 293, 199 }, { 96, 0, 293, 291 } } },
+        { 3, { { 192, 188, 349, 203 }, { 190, 94, 303, 199 }, { 86, 0, 303, 301 } } },
+        { 4, { { 192, 188, 349, 203 }, { 190, 106, 311, 199 }, { 78, 0, 311, 309 }, { 76, 0, 313, 311 } } },
+        { 4, { { 192, 188, 349, 203 }, { 190, 118, 319, 199 }, { 70, 0, 319, 317 }, { 68, 0, 321, 319 } } },
+        { 4, { { 192, 188, 349, 203 }, { 192, 188, 349, 205 }, { 190, 132, 327, 199 }, { 62, 0, 327, 325 } } },
+};
+
+static lv_color_t fb[2][TEST_RESX * TEST_RESY];
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+static lv_disp_t *disp;
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static uint64_t now_ns(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+        lv_disp_flush_ready(drv);
+}
+
+/* The partial update window of the panel starts and ends on even lines and columns */
+static void rounder_cb(lv_disp_drv_t *drv, lv_area_t *area)
+{
+        area->x1 &= ~1;
+        area->y1 &= ~1;
+        area->x2 = LV_MIN(area->x2 | 1, TEST_RESX - 1);
+        area->y2 = LV_MIN(area->y2 | 1, TEST_RESY - 1);
+}
+
+static uint32_t refr_cost_cb(lv_disp_drv_t *drv, const lv_area_t *area, uint32_t flush_cnt)
+{
+        return flush_cnt * TEST_FLUSH_COST_NS + lv_area_get_size(area) * TEST_PX_COST_NS;
+}
+
+static void display_init(void)
+{
+        lv_disp_draw_buf_init(&draw_buf, fb[0], fb[1], TEST_RESX * TEST_RESY);
+
+        lv_disp_drv_init(&disp_drv);
+        disp_drv.hor_res = TEST_RESX;
+        disp_drv.ver_res = TEST_RESY;
+        disp_drv.flush_cb = flush_cb;
+        disp_drv.draw_buf = &draw_buf;
+        disp_drv.tile_size = TEST_TILE_SIZE;
+        disp_drv.rounder_cb = rounder_cb;
+        disp_drv.refr_cost_cb = refr_cost_cb;
+
+        disp = lv_disp_drv_register(&disp_drv);
+        lv_refr_now(disp);
+}
+
+static bool test_frame(int n, const frame_t *frame)
+{
+        lv_disp_refr_stat_t *stat = &disp->refr_stat;
+        uint64_t cost, cost_px;
+
+        lv_memset_00(stat, sizeof(*stat));
+        for (int i = 0; i < frame->area_cnt; i++) {
+                _lv_inv_area(disp, &frame->areas[i]);
+        }
+        lv_refr_now(disp);
+
+        cost = (uint64_t)stat->flush_cnt * TEST_FLUSH_COST_NS + (uint64_t)stat->px_cnt * TEST_PX_COST_NS;
+        cost_px = (uint64_t)stat->flush_cnt_legacy * TEST_FLUSH_COST_NS +
+                (uint64_t)stat->px_cnt_legacy * TEST_PX_COST_NS;
+
+        printf("  frame %2d: %u flushes, %6u px, %8llu ns, by pixel count %u flushes, %6u px, %8llu ns  %s\n",
+                n, (unsigned)stat->flush_cnt, (unsigned)stat->px_cnt, (unsigned long long)cost,
+                (unsigned)stat->flush_cnt_legacy, (unsigned)stat->px_cnt_legacy,
+                (unsigned long long)cost_px, cost <= cost_px ? "ok" : "FAIL");
+
+        return cost <= cost_px;
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+uint64_t gdi_get_sys_uptime_ticks(void)
+{
+        return now_ns() / 1000;
+}
+
+uint64_t gdi_convert_ticks_to_us(uint64_t ticks)
+{
+        return ticks;
+}
+
+uint64_t gdi_get_sys_uptime_ns(void)
+{
+        return now_ns();
+}
+
+int main(int argc, char *argv[])
+{
+        int fail_cnt = 0;
+
+        lv_init();
+        display_init();
+
+        printf("Watch face tick frames:\n");
+        for (int n = 0; n < (int)(sizeof(frames) / sizeof(frames[0])); n++) {
+                fail_cnt += !test_frame(n, &frames[n]);
+        }
+
+        printf("\n%s\n", fail_cnt ? "FAILED" : "PASSED");
+
+        return fail_cnt ? 1 : 0;
+}
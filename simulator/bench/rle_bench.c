@@ -0,0 +1,332 @@
+/**
+ ****************************************************************************************
+ *
+ * @file rle_bench.c
+ *
+ * @brief Raw versus RLE compressed resources read from the QSPI flash
+ *
+ * Walks the images of the resource bundle packed by res_pack (see simulator/tools/res_pack.c),
+ * placed in the emulated QSPI flash of the software D/AVE2D together with an uncompressed copy
+ * of the RLE images. For each image it reports:
+ * - the bytes stored in flash and fetched by a full size blit
+ * - the modelled GPU time of the blit, raw and RLE (d2_mode_rle)
+ * - for the true color images, the host time of decoding all the lines with the LVGL image
+ *   decoder against copying the raw lines
+ * Both blits and both line reads must give the same pixels.
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "gdi.h"
+#include "dave_driver.h"
+#include "dave_sim.h"
+#include "res_bundle.h"
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#ifndef BENCH_RESOURCES_PATH
+#define BENCH_RESOURCES_PATH            "WatchDemoColoredResources.bin"
+#endif
+
+#define BENCH_DEFAULT_ITERATIONS        (20)
+#define BENCH_MAX_PX                    (DEMO_RESX * DEMO_RESY)
+
+/*
+ *       Types
+ *****************************************************************************************
+ */
+typedef struct {
+        uint32_t tex_bytes;
+        double gpu_us;
+} blit_result_t;
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+static d2_device *d2_handle;
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static uint64_t now_ns(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static size_t read_file(const char *path, uint8_t *buf, size_t size)
+{
+        FILE *f = fopen(path, "rb");
+        size_t len;
+
+        if (!f) {
+                perror(path);
+                return 0;
+        }
+        len = fread(buf, 1, size, f);
+        fclose(f);
+
+        return len;
+}
+
+/* Decode the RLE data of an image, as the GPU does */
+static bool rle_expand(const uint8_t *rle, size_t rle_size, uint8_t *out, size_t size, int unit)
+{
+        size_t i = 0, pos = 0;
+
+        while (i < rle_size && pos < size) {
+                uint8_t ctrl = rle[i++];
+                size_t n = (size_t)(ctrl & 0x7F) + 1;
+
+                if (pos + n * unit > size) {
+                        return false;
+                }
+                if (ctrl & 0x80) {
+                        for (; n; n--, pos += unit) {
+                                memcpy(out + pos, rle + i, unit);
+                        }
+                        i += unit;
+                } else {
+                        memcpy(out + pos, rle + i, n * unit);
+                        i += n * unit;
+                        pos += n * unit;
+                }
+        }
+
+        return i == rle_size && pos == size;
+}
+
+static d2_u32 d2_format(lv_img_cf_t cf)
+{
+        switch (cf) {
+        case LV_IMG_CF_TRUE_COLOR:
+        case LV_IMG_CF_RGB565:
+                return d2_mode_rgb565;
+        case LV_IMG_CF_ARGB8888:
+                return d2_mode_argb8888;
+        case LV_IMG_CF_RGBA8888:
+                return d2_mode_rgba8888;
+        case LV_IMG_CF_ARGB4444:
+                return d2_mode_argb4444;
+        default:
+                return 0;
+        }
+}
+
+/* Copy the image to a frame buffer of its size */
+static blit_result_t blit(const uint8_t *data, const lv_img_header_t *header, bool rle, uint8_t *fb)
+{
+        blit_result_t res;
+        uint64_t cycles = dave_sim_get_cycles();
+
+        d2_setperfcountvalue(d2_handle, 0, 0);
+        d2_framebuffer(d2_handle, fb, header->w, header->w, header->h, d2_mode_argb8888);
+        d2_cliprect(d2_handle, 0, 0, header->w - 1, header->h - 1);
+        d2_setblendmode(d2_handle, d2_bm_one, d2_bm_zero);
+        d2_setalphablendmode(d2_handle, d2_bm_one, d2_bm_zero);
+        d2_setblitsrc(d2_handle, (void *)data, header->w, header->w, header->h,
+                      d2_format(header->cf) | (rle ? d2_mode_rle : 0));
+        d2_blitcopy(d2_handle, header->w, header->h, 0, 0, D2_FIX4(header->w), D2_FIX4(header->h), 0, 0, 0);
+        d2_flushframe(d2_handle);
+
+        res.tex_bytes = d2_getperfcountvalue(d2_handle, 0) * 4;
+        res.gpu_us = (dave_sim_get_cycles() - cycles) * 1e6 / d1_deviceclkfreq(NULL, 0);
+
+        return res;
+}
+
+/* Host time to read all the lines of a true color image, raw or through the image decoder */
+static double read_lines(const uint8_t *data, const lv_img_header_t *header, bool rle, uint8_t *out,
+        int iterations, bool *ok)
+{
+        int px_size = lv_img_cf_get_px_size(header->cf) / 8;
+        size_t line_size = (size_t)header->w * px_size;
+        lv_img_dsc_t img = { .header = *header, .data = data };
+        lv_img_decoder_dsc_t dsc;
+        uint64_t total = 0;
+
+        img.header.rle = rle;
+        *ok = true;
+
+        for (int i = 0; i < iterations; i++) {
+                uint64_t start = now_ns();
+
+                if (!rle) {
+                        for (int y = 0; y < header->h; y++) {
+                                memcpy(out + y * line_size, data + y * line_size, line_size);
+                        }
+                        total += now_ns() - start;
+                        continue;
+                }
+
+                if (lv_img_decoder_open(&dsc, &img, lv_color_black(), 0) != LV_RES_OK) {
+                        *ok = false;
+                        return 0;
+                }
+                for (int y = 0; y < header->h; y++) {
+                        if (lv_img_decoder_read_line(&dsc, 0, y, header->w, out + y * line_size) != LV_RES_OK) {
+                                *ok = false;
+                        }
+                }
+                lv_img_decoder_close(&dsc);
+                total += now_ns() - start;
+        }
+
+        return (double)total / iterations;
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+uint64_t gdi_get_sys_uptime_ticks(void)
+{
+        return now_ns() / 1000;
+}
+
+uint64_t gdi_convert_ticks_to_us(uint64_t ticks)
+{
+        return ticks;
+}
+
+uint64_t gdi_get_sys_uptime_ns(void)
+{
+        return now_ns();
+}
+
+int main(int argc, char *argv[])
+{
+        const char *path = BENCH_RESOURCES_PATH;
+        int iterations = BENCH_DEFAULT_ITERATIONS;
+        const size_t flash_size = 4 * 1024 * 1024;
+        const res_bundle_header_t *bundle;
+        const res_bundle_entry_t *index;
+        uint8_t *flash, *raw, *fb_raw, *fb_rle;
+        size_t len;
+        size_t total_raw = 0, total_packed = 0;
+        double total_gpu_raw = 0, total_gpu_rle = 0;
+        res_bundle_err_t err;
+        int failures = 0;
+        int opt;
+
+        while ((opt = getopt(argc, argv, "r:n:h")) != -1) {
+                switch (opt) {
+                case 'r':
+                        path = optarg;
+                        break;
+                case 'n':
+                        iterations = LV_MAX(1, atoi(optarg));
+                        break;
+                default:
+                        fprintf(stderr, "Usage: %s [-r bundle.bin] [-n iterations]\n", argv[0]);
+                        return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+                }
+        }
+
+        /* The bundle in the first half of the flash, the uncompressed copies in the second one */
+        flash = malloc(flash_size);
+        fb_raw = malloc(BENCH_MAX_PX * 4);
+        fb_rle = malloc(BENCH_MAX_PX * 4);
+        if (!flash || !fb_raw || !fb_rle) {
+                return EXIT_FAILURE;
+        }
+        len = read_file(path, flash, flash_size / 2);
+        bundle = (const res_bundle_header_t *)flash;
+        err = res_bundle_check(bundle, len, true);
+        if (err != RES_BUNDLE_OK) {
+                fprintf(stderr, "%s: invalid bundle (error %d)\n", path, err);
+                return EXIT_FAILURE;
+        }
+        index = res_bundle_index(bundle);
+        raw = flash + flash_size / 2;
+
+        lv_init();
+        d2_handle = d2_opendevice(0);
+        d2_inithw(d2_handle, 0);
+        d2_setperfcountevent(d2_handle, 0, d2_pc_texreads);
+        dave_sim_set_flash(flash, flash_size);
+
+        printf("%-4s %9s %3s %8s %8s %6s %9s %9s %9s %9s %9s  %s\n", "#", "size", "cf", "raw B", "rle B", "ratio",
+               "fetch B", "gpu us", "gpu rle", "cpu us", "cpu rle", "result");
+
+        for (int i = 0; i < bundle->count; i++) {
+                const res_bundle_entry_t *e = &index[i];
+                lv_img_header_t header = { .cf = e->cf, .w = e->w, .h = e->h };
+                const uint8_t *data = flash + e->offset;
+                size_t px_cnt = (size_t)e->w * e->h;
+                int unit = lv_img_cf_get_px_size(e->cf) / 8;
+                size_t raw_size = px_cnt * unit;
+                bool rle = e->comp == RES_BUNDLE_COMP_RLE;
+                blit_result_t res_raw, res_rle;
+                double cpu_raw = 0, cpu_rle = 0;
+                bool ok = true;
+
+                if (!unit || px_cnt > BENCH_MAX_PX || raw_size > flash_size / 2) {
+                        fprintf(stderr, "%d: unsupported image\n", i);
+                        failures++;
+                        continue;
+                }
+                if (rle) {
+                        ok = rle_expand(data, e->size, raw, raw_size, unit);
+                } else {
+                        memcpy(raw, data, raw_size);
+                }
+
+                res_raw = blit(raw, &header, false, fb_raw);
+                res_rle = blit(data, &header, rle, fb_rle);
+                if (memcmp(fb_raw, fb_rle, px_cnt * 4)) {
+                        ok = false;
+                }
+
+                if (rle && e->cf == LV_IMG_CF_TRUE_COLOR) {
+                        bool read_ok;
+
+                        cpu_raw = read_lines(raw, &header, false, fb_raw, iterations, &read_ok);
+                        cpu_rle = read_lines(data, &header, true, fb_rle, iterations, &read_ok);
+                        if (!read_ok || memcmp(fb_raw, fb_rle, raw_size)) {
+                                ok = false;
+                        }
+                }
+                if (!ok) {
+                        failures++;
+                }
+
+                printf("%-4d %4dx%-4d %3d %8zu %8u %5.0f%% %9u %9.1f %9.1f", i, e->w, e->h, e->cf,
+                       raw_size, e->size, e->size * 100.0 / raw_size, res_rle.tex_bytes, res_raw.gpu_us,
+                       res_rle.gpu_us);
+                if (cpu_rle > 0) {
+                        printf(" %9.1f %9.1f", cpu_raw / 1000, cpu_rle / 1000);
+                } else {
+                        printf(" %9s %9s", "-", "-");
+                }
+                printf("  %s\n", ok ? "identical" : "MISMATCH");
+
+                total_raw += raw_size;
+                total_packed += e->size;
+                total_gpu_raw += res_raw.gpu_us;
+                total_gpu_rle += res_rle.gpu_us;
+        }
+
+        printf("total: %zu -> %zu bytes in flash (%.0f%%), GPU %.1f -> %.1f us for one blit of each image\n",
+               total_raw, total_packed, total_packed * 100.0 / total_raw, total_gpu_raw, total_gpu_rle);
+
+        d2_closedevice(d2_handle);
+
+        return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
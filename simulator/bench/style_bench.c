@@ -0,0 +1,320 @@
+/**
+ ****************************************************************************************
+ *
+ * @file style_bench.c
+ *
+ * @brief Benchmark of the style cache on a synthetic object tree
+ *
+ * Builds a screen of about 200 objects laid out like the menu of the demo: scrollable lists of
+ * cells holding an image and a label, styled by the default theme, shared styles and local
+ * styles. It measures, with the style cache of lv_obj_style.c bypassed and used:
+ * - the time to resolve the draw descriptors of every object, as their draw events do
+ * - the time of a redraw while a list scrolls by one pixel
+ * The descriptors resolved with and without the cache must be identical, before and after the
+ * state, a shared style, a local style and the parent of some objects change.
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "gdi.h"
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#define BENCH_RESX                      DEMO_RESX
+#define BENCH_RESY                      DEMO_RESY
+#define BENCH_DEFAULT_ITERATIONS        (200)
+
+#define BENCH_LISTS                     (3)
+#define BENCH_CELLS                     (22)
+#define BENCH_MAX_OBJS                  (256)
+
+/*
+ *       Types
+ *****************************************************************************************
+ */
+/* Descriptors of an object, as its draw events initialize them */
+typedef struct {
+        lv_draw_rect_dsc_t main;
+        lv_draw_rect_dsc_t scrollbar;
+        lv_draw_label_dsc_t label;
+        lv_draw_img_dsc_t img;
+} obj_dsc_t;
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+static lv_color_t draw_buf_mem[BENCH_RESX * BENCH_RESY / 4];
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+static lv_disp_t *disp;
+
+static lv_style_t style_list, style_cell, style_text;
+static lv_obj_t *lists[BENCH_LISTS];
+static lv_obj_t *objs[BENCH_MAX_OBJS];
+static int obj_cnt;
+
+static obj_dsc_t dsc_ref[BENCH_MAX_OBJS], dsc_cached[BENCH_MAX_OBJS];
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static uint64_t now_ns(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+        lv_disp_flush_ready(drv);
+}
+
+static void display_init(void)
+{
+        lv_disp_draw_buf_init(&draw_buf, draw_buf_mem, NULL, sizeof(draw_buf_mem) / sizeof(lv_color_t));
+
+        lv_disp_drv_init(&disp_drv);
+        disp_drv.hor_res = BENCH_RESX;
+        disp_drv.ver_res = BENCH_RESY;
+        disp_drv.flush_cb = flush_cb;
+        disp_drv.draw_buf = &draw_buf;
+
+        disp = lv_disp_drv_register(&disp_drv);
+}
+
+static void add_obj(lv_obj_t *obj)
+{
+        if (obj_cnt < BENCH_MAX_OBJS) {
+                objs[obj_cnt++] = obj;
+        }
+}
+
+/* Lists of cells with an image and a label, the text properties being inherited from the lists */
+static void tree_init(void)
+{
+        lv_obj_t *scr = lv_scr_act();
+        lv_obj_t *title;
+
+        lv_style_init(&style_list);
+        lv_style_set_bg_color(&style_list, lv_color_hex(0x101418));
+        lv_style_set_pad_row(&style_list, 4);
+        lv_style_set_layout(&style_list, LV_LAYOUT_FLEX);
+        lv_style_set_flex_flow(&style_list, LV_FLEX_FLOW_COLUMN);
+        lv_style_set_text_color(&style_list, lv_color_white());
+        lv_style_set_text_font(&style_list, &lv_font_montserrat_16);
+
+        lv_style_init(&style_cell);
+        lv_style_set_radius(&style_cell, 12);
+        lv_style_set_bg_color(&style_cell, lv_color_hex(0x2A3038));
+        lv_style_set_border_width(&style_cell, 2);
+        lv_style_set_border_color(&style_cell, lv_color_hex(0x3C7DD9));
+        lv_style_set_pad_all(&style_cell, 6);
+        lv_style_set_pad_column(&style_cell, 10);
+        lv_style_set_width(&style_cell, LV_PCT(100));
+        lv_style_set_height(&style_cell, LV_SIZE_CONTENT);
+        lv_style_set_layout(&style_cell, LV_LAYOUT_FLEX);
+        lv_style_set_flex_flow(&style_cell, LV_FLEX_FLOW_ROW);
+
+        lv_style_init(&style_text);
+        lv_style_set_text_letter_space(&style_text, 1);
+
+        add_obj(scr);
+        title = lv_label_create(scr);
+        lv_label_set_text(title, "Menu");
+        lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 8);
+        add_obj(title);
+
+        for (int l = 0; l < BENCH_LISTS; l++) {
+                lv_obj_t *list = lv_obj_create(scr);
+
+                lv_obj_add_style(list, &style_list, 0);
+                lv_obj_set_size(list, BENCH_RESX / BENCH_LISTS, BENCH_RESY - 40);
+                lv_obj_set_pos(list, l * BENCH_RESX / BENCH_LISTS, 40);
+                lists[l] = list;
+                add_obj(list);
+
+                for (int c = 0; c < BENCH_CELLS; c++) {
+                        lv_obj_t *cell = lv_obj_create(list);
+                        lv_obj_t *img, *label;
+
+                        lv_obj_add_style(cell, &style_cell, 0);
+                        lv_obj_clear_flag(cell, LV_OBJ_FLAG_SCROLLABLE);
+                        if (c % 4 == 0) {
+                                lv_obj_set_style_bg_opa(cell, LV_OPA_70, 0);
+                        }
+                        add_obj(cell);
+
+                        img = lv_img_create(cell);
+                        lv_img_set_src(img, LV_SYMBOL_SETTINGS);
+                        add_obj(img);
+
+                        label = lv_label_create(cell);
+                        lv_label_set_text_static(label, "Item");
+                        lv_obj_add_style(label, &style_text, 0);
+                        add_obj(label);
+                }
+        }
+}
+
+static void resolve(obj_dsc_t *dsc)
+{
+        for (int i = 0; i < obj_cnt; i++) {
+                lv_obj_t *obj = objs[i];
+
+                lv_draw_rect_dsc_init(&dsc[i].main);
+                lv_obj_init_draw_rect_dsc(obj, LV_PART_MAIN, &dsc[i].main);
+                lv_draw_rect_dsc_init(&dsc[i].scrollbar);
+                lv_obj_init_draw_rect_dsc(obj, LV_PART_SCROLLBAR, &dsc[i].scrollbar);
+                lv_draw_label_dsc_init(&dsc[i].label);
+                lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &dsc[i].label);
+                lv_draw_img_dsc_init(&dsc[i].img);
+                lv_obj_init_draw_img_dsc(obj, LV_PART_MAIN, &dsc[i].img);
+        }
+}
+
+/* The descriptors must not depend on the cache */
+static bool check(const char *step)
+{
+        int mismatches = 0;
+
+        lv_obj_style_cache_enable(false);
+        resolve(dsc_ref);
+        lv_obj_style_cache_enable(true);
+        /* Once to fill the cache, once from it */
+        resolve(dsc_cached);
+        resolve(dsc_cached);
+
+        for (int i = 0; i < obj_cnt; i++) {
+                if (memcmp(&dsc_ref[i], &dsc_cached[i], sizeof(obj_dsc_t))) {
+                        mismatches++;
+                }
+        }
+        printf("%-32s %s\n", step, mismatches ? "MISMATCH" : "identical");
+
+        return mismatches == 0;
+}
+
+static double measure_resolve(bool cache, int iterations)
+{
+        uint64_t start;
+
+        lv_obj_style_cache_enable(cache);
+        resolve(dsc_cached);
+
+        start = now_ns();
+        for (int i = 0; i < iterations; i++) {
+                resolve(dsc_cached);
+        }
+
+        return (double)(now_ns() - start) / iterations;
+}
+
+static double measure_scroll(bool cache, int iterations)
+{
+        uint64_t start;
+
+        lv_obj_style_cache_enable(cache);
+        lv_refr_now(disp);
+
+        start = now_ns();
+        for (int i = 0; i < iterations; i++) {
+                lv_obj_scroll_by(lists[0], 0, i & 1 ? 1 : -1, LV_ANIM_OFF);
+                lv_refr_now(disp);
+        }
+
+        return (double)(now_ns() - start) / iterations;
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+uint64_t gdi_get_sys_uptime_ticks(void)
+{
+        return now_ns() / 1000;
+}
+
+uint64_t gdi_convert_ticks_to_us(uint64_t ticks)
+{
+        return ticks;
+}
+
+uint64_t gdi_get_sys_uptime_ns(void)
+{
+        return now_ns();
+}
+
+int main(int argc, char *argv[])
+{
+        int iterations = BENCH_DEFAULT_ITERATIONS;
+        lv_obj_style_cache_stat_t stat_start, stat_end;
+        double t_off, t_on;
+        int failures = 0;
+        int opt;
+
+        while ((opt = getopt(argc, argv, "n:h")) != -1) {
+                switch (opt) {
+                case 'n':
+                        iterations = LV_MAX(1, atoi(optarg));
+                        break;
+                default:
+                        fprintf(stderr, "Usage: %s [-n iterations]\n", argv[0]);
+                        return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+                }
+        }
+
+        lv_init();
+        display_init();
+        tree_init();
+        lv_refr_now(disp);
+
+        printf("%d objects, %d cache entries\n", obj_cnt, DLG_LVGL_STYLE_CACHE_ENTRIES);
+
+        /* Pressed cells, a shared style, a local inherited property and a moved cell */
+        failures += !check("initial");
+        lv_obj_add_state(objs[4], LV_STATE_PRESSED);
+        lv_obj_add_state(lists[1], LV_STATE_FOCUSED);
+        failures += !check("new states");
+        lv_style_set_bg_color(&style_cell, lv_color_hex(0x404850));
+        lv_obj_report_style_change(&style_cell);
+        failures += !check("shared style changed");
+        lv_obj_set_style_text_color(lists[2], lv_color_hex(0xFFC000), 0);
+        failures += !check("inherited local style");
+        lv_obj_set_parent(lv_obj_get_child(lists[0], 1), lists[2]);
+        failures += !check("new parent");
+        lv_obj_clear_state(objs[4], LV_STATE_PRESSED);
+        lv_obj_clear_state(lists[1], LV_STATE_FOCUSED);
+        failures += !check("states cleared");
+
+        printf("\n%-32s %12s %12s %8s\n", "case", "no cache us", "cache us", "speedup");
+
+        t_off = measure_resolve(false, iterations);
+        lv_obj_style_cache_get_stat(&stat_start);
+        t_on = measure_resolve(true, iterations);
+        lv_obj_style_cache_get_stat(&stat_end);
+        printf("%-32s %12.2f %12.2f %7.2fx\n", "resolve draw descriptors", t_off / 1e3, t_on / 1e3, t_off / t_on);
+        printf("%-32s %12s %12u\n", "  hits", "", stat_end.hit_cnt - stat_start.hit_cnt);
+        printf("%-32s %12s %12u\n", "  misses", "", stat_end.miss_cnt - stat_start.miss_cnt);
+
+        t_off = measure_scroll(false, iterations);
+        t_on = measure_scroll(true, iterations);
+        printf("%-32s %12.2f %12.2f %7.2fx\n", "scroll redraw", t_off / 1e3, t_on / 1e3, t_off / t_on);
+
+        return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,236 @@
+/**
+ ****************************************************************************************
+ *
+ * @file timer_bench.c
+ *
+ * @brief Benchmark of the scheduling of the LVGL timers
+ *
+ * Runs 10, 100 and 1000 timers of periods from 15 ms to 1 s on a virtual clock and measures the
+ * host time spent in lv_timer_handler():
+ * - called every ms, as a polling loop would
+ * - called when the time it returned has elapsed, as a tickless loop would
+ * - while a timer is created and deleted among the other ones
+ * The bench is built once with the timers in the min-heap (da1470x_timer_bench_heap) and once
+ * with the list scan of LVGL (da1470x_timer_bench_list). Both must run every timer as many
+ * times as its period fits in the run, and lv_timer_handler() must return the time until the
+ * next timer.
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "gdi.h"
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#define BENCH_DEFAULT_DURATION_MS       (10000)
+#define BENCH_MAX_TIMERS                (1000)
+#define BENCH_CHURN_CNT                 (10000)
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+static const int timer_cnts[] = { 10, 100, 1000 };
+
+static lv_timer_t *timers[BENCH_MAX_TIMERS];
+static uint32_t run_cnt[BENCH_MAX_TIMERS];
+static uint32_t clock_ms;
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static uint64_t now_ns(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void timer_cb(lv_timer_t *timer)
+{
+        run_cnt[(intptr_t)timer->user_data]++;
+}
+
+static uint32_t period_of(int i)
+{
+        return 15 + (i * 397) % 986;
+}
+
+static void timers_create(int cnt)
+{
+        for (int i = 0; i < cnt; i++) {
+                timers[i] = lv_timer_create(timer_cb, period_of(i), (void *)(intptr_t)i);
+                run_cnt[i] = 0;
+        }
+}
+
+static void timers_delete(int cnt)
+{
+        for (int i = 0; i < cnt; i++) {
+                lv_timer_del(timers[i]);
+        }
+}
+
+/* Every timer runs once per period, the clock advancing by at most 1 ms between the calls */
+static bool timers_check(int cnt, uint32_t duration)
+{
+        for (int i = 0; i < cnt; i++) {
+                if (run_cnt[i] != duration / period_of(i)) {
+                        printf("timer %d of %u ms ran %u times instead of %u\n", i, period_of(i), run_cnt[i],
+                                duration / period_of(i));
+                        return false;
+                }
+        }
+
+        return true;
+}
+
+/* The smallest time to the next run, by scanning the timers */
+static uint32_t time_till_next(void)
+{
+        uint32_t next = LV_NO_TIMER_READY;
+
+        for (lv_timer_t *timer = lv_timer_get_next(NULL); timer; timer = lv_timer_get_next(timer)) {
+                uint32_t elapsed = clock_ms - timer->last_run;
+                uint32_t remaining = elapsed >= timer->period ? 0 : timer->period - elapsed;
+
+                if (!timer->paused && remaining < next) {
+                        next = remaining;
+                }
+        }
+
+        return next;
+}
+
+static double measure_polling(int cnt, uint32_t duration, bool *ok)
+{
+        uint32_t start = clock_ms;
+        uint64_t elapsed = 0;
+
+        timers_create(cnt);
+        while (clock_ms - start < duration) {
+                uint64_t t;
+
+                clock_ms++;
+                t = now_ns();
+                lv_timer_handler();
+                elapsed += now_ns() - t;
+        }
+        *ok &= timers_check(cnt, duration);
+        timers_delete(cnt);
+
+        return (double)elapsed / duration;
+}
+
+static double measure_tickless(int cnt, uint32_t duration, uint32_t *calls, bool *ok)
+{
+        uint32_t start = clock_ms;
+        uint64_t elapsed = 0;
+
+        *calls = 0;
+        timers_create(cnt);
+        while (clock_ms - start < duration) {
+                uint32_t sleep;
+                uint64_t t;
+
+                t = now_ns();
+                sleep = lv_timer_handler();
+                elapsed += now_ns() - t;
+                (*calls)++;
+
+                if (sleep != time_till_next()) {
+                        printf("%u ms returned instead of %u ms\n", sleep, time_till_next());
+                        *ok = false;
+                }
+                clock_ms += sleep ? sleep : 1;
+        }
+        timers_delete(cnt);
+
+        return (double)elapsed / *calls;
+}
+
+static double measure_churn(int cnt)
+{
+        uint64_t start;
+
+        timers_create(cnt);
+        start = now_ns();
+        for (int i = 0; i < BENCH_CHURN_CNT; i++) {
+                lv_timer_del(lv_timer_create(timer_cb, period_of(i), NULL));
+        }
+        start = now_ns() - start;
+        timers_delete(cnt);
+
+        return (double)start / BENCH_CHURN_CNT;
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+uint64_t gdi_get_sys_uptime_ticks(void)
+{
+        return clock_ms;
+}
+
+uint64_t gdi_convert_ticks_to_us(uint64_t ticks)
+{
+        return ticks * 1000;
+}
+
+uint64_t gdi_get_sys_uptime_ns(void)
+{
+        return (uint64_t)clock_ms * 1000000;
+}
+
+int main(int argc, char *argv[])
+{
+        uint32_t duration = BENCH_DEFAULT_DURATION_MS;
+        bool ok = true;
+        int opt;
+
+        while ((opt = getopt(argc, argv, "t:h")) != -1) {
+                switch (opt) {
+                case 't':
+                        duration = LV_MAX(1000, strtoul(optarg, NULL, 0));
+                        break;
+                default:
+                        fprintf(stderr, "Usage: %s [-t virtual ms]\n", argv[0]);
+                        return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+                }
+        }
+
+        /* Only the memory and the timers, no display nor input device adds its own timers */
+        lv_mem_init();
+        _lv_timer_core_init();
+        clock_ms = 1;
+
+        printf("%s scheduler, %u ms\n\n", BENCH_SCHED, duration);
+        printf("%8s %16s %16s %12s %16s\n", "timers", "polling ns/ms", "tickless ns/call", "calls",
+                "create+del ns");
+        for (unsigned i = 0; i < sizeof(timer_cnts) / sizeof(timer_cnts[0]); i++) {
+                int cnt = timer_cnts[i];
+                double polling, tickless, churn;
+                uint32_t calls;
+
+                polling = measure_polling(cnt, duration, &ok);
+                tickless = measure_tickless(cnt, duration, &calls, &ok);
+                churn = measure_churn(cnt);
+                printf("%8d %16.1f %16.1f %12u %16.1f\n", cnt, polling, tickless, calls, churn);
+        }
+
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,55 @@
+/**
+ ****************************************************************************************
+ *
+ * @file custom_config_sim.h
+ *
+ * @brief Custom configuration file for the host (Linux) simulator build.
+ *
+ * Copyright (C) 2021-2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+
+#ifndef CUSTOM_CONFIG_SIM_H_
+#define CUSTOM_CONFIG_SIM_H_
+
+#include <stdint.h>
+
+#define DA1469X                                 ( 0x00069000 )
+#define DA1470X                                 ( 0x00070000 )
+#define DEVICE_FAMILY                           ( DA1470X )
+#define DEVICE_FPGA                             ( 0 )
+
+/*************************************************************************************************\
+ * Memory map. Resources normally read from the QSPI flash are loaded into a host buffer.
+ */
+extern uint8_t sim_qspic_mem[];
+
+#define SIM_QSPIC_MEM_SIZE                      ( 2 * 1024 * 1024 )
+#define MEMORY_QSPIC_BASE                       ( (uintptr_t)sim_qspic_mem )
+#define MEMORY_OQSPIC_S_BASE                    ( (uintptr_t)sim_qspic_mem )
+
+/* The resource bundle fills at most the buffer, its images are checked at start-up (Resources.c) */
+#define RESOURCES_MAX_SIZE                      ( SIM_QSPIC_MEM_SIZE )
+#define RESOURCES_CHECK_DATA                    ( 1 )
+
+/*************************************************************************************************\
+ * Peripheral specific config
+ */
+#define dg_configLCDC_ADAPTER                   ( 1 )
+
+/*************************************************************************************************\
+ * Display model selection. The virtual panel models the E120A390QSR.
+ */
+#define dg_configUSE_SIM_DISPLAY                ( 1 )
+
+#define LV_CONF_INCLUDE_SIMPLE
+#define LV_LVGL_H_INCLUDE_SIMPLE
+/*************************************************************************************************\
+ * Touch controller selection. Gestures are always scripted on the host.
+ */
+#define dg_configUSE_TOUCH_SIMULATION           ( 1 )
+
+#endif /* CUSTOM_CONFIG_SIM_H_ */
@@ -0,0 +1,163 @@
+/**
+ ****************************************************************************************
+ *
+ * @file ad_lcdc.h
+ *
+ * @brief LCD controller adapter types for the host simulator
+ *
+ * Mirrors the subset of hw_lcdc.h/ad_lcdc.h types referenced by gdi.h. Layer base addresses
+ * are widened to uintptr_t so that host frame buffers can be referenced.
+ *
+ * Copyright (C) 2021-2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+
+#ifndef AD_LCDC_H_
+#define AD_LCDC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \brief Output color mode/format of the LCD controller
+ */
+typedef enum {
+        HW_LCDC_OCM_8RGB111_1 = 0x01,
+        HW_LCDC_OCM_8RGB111_2 = 0x21,
+        HW_LCDC_OCM_8RGB111_3 = 0x11,
+        HW_LCDC_OCM_RGB111    = 0x41,
+        HW_LCDC_OCM_L1        = 0x31,
+        HW_LCDC_OCM_8RGB332   = 0x02,
+        HW_LCDC_OCM_8RGB444   = 0x03,
+        HW_LCDC_OCM_8RGB565   = 0x05,
+        HW_LCDC_OCM_8RGB666   = 0x06,
+        HW_LCDC_OCM_8RGB666_P = 0x16,
+        HW_LCDC_OCM_8RGB888   = 0x07,
+        HW_LCDC_OCM_RGB222    = 0x00,
+} HW_LCDC_OUTPUT_COLOR_MODE;
+
+/**
+ * \brief Layer color format/mode
+ */
+typedef enum {
+        HW_LCDC_LCM_RGB332   = 0x04,//!< R[2-0]G[2-0]B[1-0]
+        HW_LCDC_LCM_RGB565   = 0x05,//!< R[4-0]G[5-0]B[4-0]
+        HW_LCDC_LCM_RGBA5551 = 0x01,//!< R[4-0]G[4-0]B[4-0]A0
+        HW_LCDC_LCM_RGBA4444 = 0x15,//!< R[3-0]G[3-0]B[3-0]A[3-0]
+        HW_LCDC_LCM_ARGB4444 = 0x18,//!< A[3-0]R[3-0]G[3-0]B[3-0]
+        HW_LCDC_LCM_RGB888   = 0x0b,//!< R[7-0]G[7-0]B[7-0]
+        HW_LCDC_LCM_ABGR8888 = 0x0d,//!< A[7-0]B[7-0]G[7-0]R[7-0]
+        HW_LCDC_LCM_BGRA8888 = 0x0e,//!< B[7-0]G[7-0]R[7-0]A[7-0]
+        HW_LCDC_LCM_RGBA8888 = 0x02,//!< R[7-0]G[7-0]B[7-0]A[7-0]
+        HW_LCDC_LCM_ARGB8888 = 0x06,//!< A[7-0]R[7-0]G[7-0]B[7-0]
+} HW_LCDC_LAYER_COLOR_MODE;
+
+/**
+ * \brief LCD controller layers
+ */
+typedef enum {
+        HW_LCDC_LAYER_0,  //!< Layer 0 - Background layer
+        HW_LCDC_LAYER_1,  //!< Layer 1 - Foreground layer
+        HW_LCDC_LAYER_MAX,//!< Count of available layers
+} HW_LCDC_LAYER;
+
+/**
+ * \brief Blend factors configuration (\ref HW_LCDC_BLEND_MODE)
+ */
+typedef enum {
+        HW_LCDC_BF_ZERO            = 0x0,
+        HW_LCDC_BF_ONE             = 0x1,
+        HW_LCDC_BF_SRCALPHA        = 0x2,
+        HW_LCDC_BF_GLBALPHA        = 0x3,
+        HW_LCDC_BF_SRCGBLALPHA     = 0x4,
+        HW_LCDC_BF_INVSRCALPHA     = 0x5,
+        HW_LCDC_BF_INVGBLALPHA     = 0x6,
+        HW_LCDC_BF_INVSRCGBLALPHA  = 0x7,
+        HW_LCDC_BF_DSTALPHA        = 0xA,
+        HW_LCDC_BF_INVDSTALPHA     = 0xB,
+} HW_LCDC_BLEND_FACTORS;
+
+#define HW_LCDC_BLENDMODE(src, dst)     ((HW_LCDC_BF_ ## src) | ((HW_LCDC_BF_ ## dst) << 4))
+
+/**
+ * \brief Blend modes configure how each layer is blended with the previous one(s)
+ */
+typedef enum {
+        HW_LCDC_BL_SIMPLE     = HW_LCDC_BLENDMODE(SRCALPHA    ,INVSRCALPHA),
+        HW_LCDC_BL_CLEAR      = HW_LCDC_BLENDMODE(ZERO        ,ZERO       ),
+        HW_LCDC_BL_SRC        = HW_LCDC_BLENDMODE(ONE         ,ZERO       ),
+        HW_LCDC_BL_SRC_OVER   = HW_LCDC_BLENDMODE(ONE         ,INVSRCALPHA),
+        HW_LCDC_BL_DST_OVER   = HW_LCDC_BLENDMODE(INVDSTALPHA ,ONE        ),
+        HW_LCDC_BL_SRC_IN     = HW_LCDC_BLENDMODE(DSTALPHA    ,ZERO       ),
+        HW_LCDC_BL_DST_IN     = HW_LCDC_BLENDMODE(ZERO        ,SRCALPHA   ),
+        HW_LCDC_BL_SRC_OUT    = HW_LCDC_BLENDMODE(INVDSTALPHA ,ZERO       ),
+        HW_LCDC_BL_DST_OUT    = HW_LCDC_BLENDMODE(ZERO        ,INVSRCALPHA),
+        HW_LCDC_BL_SRC_ATOP   = HW_LCDC_BLENDMODE(DSTALPHA    ,INVSRCALPHA),
+        HW_LCDC_BL_DST_ATOP   = HW_LCDC_BLENDMODE(INVDSTALPHA ,SRCALPHA   ),
+        HW_LCDC_BL_ADD        = HW_LCDC_BLENDMODE(ONE         ,ONE        ),
+        HW_LCDC_BL_XOR        = HW_LCDC_BLENDMODE(INVDSTALPHA ,INVSRCALPHA),
+} HW_LCDC_BLEND_MODE;
+
+/**
+ * \brief DMA pre-fetch level
+ */
+typedef enum {
+        HW_LCDC_FIFO_PREFETCH_LVL_DISABLED  = 0x00,
+        HW_LCDC_FIFO_PREFETCH_LVL_1         = 0x01,
+        HW_LCDC_FIFO_PREFETCH_LVL_2         = 0x02,
+        HW_LCDC_FIFO_PREFETCH_LVL_3         = 0x03,
+        HW_LCDC_FIFO_PREFETCH_LVL_4         = 0x04,
+} HW_LCDC_FIFO_PREFETCH_LVL;
+
+/**
+ * \brief Structure that holds a frame's dimensions
+ */
+typedef struct {
+        uint16_t startx;//!< Start column of the frame
+        uint16_t starty;//!< Start row of the frame
+        uint16_t endx;  //!< End column of the frame
+        uint16_t endy;  //!< End row of the frame
+} hw_lcdc_frame_t;
+
+/**
+ * \brief Structure that holds the layer parameters (input of the LCD controller)
+ */
+typedef struct {
+        uintptr_t baseaddr;                        //!< Base address where the input frame resides in memory
+        int32_t  stride;                           //!< Line to line distance in bytes of frame in memory
+        int16_t  startx;                           //!< Horizontal coordinate of the top-left corner of the layer
+        int16_t  starty;                           //!< Vertical coordinate of the top-left corner of the layer
+        uint16_t resx;                             //!< Horizontal resolution of layer in pixels
+        uint16_t resy;                             //!< Vertical resolution of layer in pixels
+        HW_LCDC_LAYER_COLOR_MODE format;           //!< Color mode format of the layer
+        HW_LCDC_BLEND_MODE blendmode;              //!< Blend mode of the layer with its underlying image
+        HW_LCDC_FIFO_PREFETCH_LVL dma_prefetch_lvl;//!< DMA pre-fetch level
+        uint8_t alpha;                             //!< Global alpha value (combined with \ref blendmode)
+} hw_lcdc_layer_t;
+
+/**
+ * \brief LCDC adapter error codes
+ */
+typedef enum AD_LCDC_ERROR {
+        AD_LCDC_ERROR_UNDERFLOW                 = -7,   //!< Underflow error during frame transfer
+        AD_LCDC_ERROR_TIMEOUT                   = -5,   //!< Event timeout error
+        AD_LCDC_ERROR_NONE                      = 0     //!< No error
+} AD_LCDC_ERROR;
+
+/**
+ * \brief LCDC handle
+ */
+typedef void *ad_lcdc_handle_t;
+
+/**
+ * \brief LCDC controller configuration, opaque to the simulator
+ */
+typedef struct {
+        const void *io;
+        const void *drv;
+} ad_lcdc_controller_conf_t;
+
+#endif /* AD_LCDC_H_ */
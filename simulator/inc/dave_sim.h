@@ -0,0 +1,38 @@
+/**
+ ****************************************************************************************
+ *
+ * @file dave_sim.h
+ *
+ * @brief Host simulator extensions of the D/AVE2D driver API
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+
+#ifndef DAVE_SIM_H_
+#define DAVE_SIM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * \brief Total D/AVE2D cycles estimated by the software GPU since start-up
+ *
+ * Unlike the d2_pc_davecycles performance counter it is not tied to a device handle, so it
+ * keeps counting while the port closes and reopens the device on every flush. Divide by
+ * d1_deviceclkfreq() to get the modelled rendering time.
+ */
+uint64_t dave_sim_get_cycles(void);
+
+/**
+ * \brief Set the memory range of the emulated QSPI flash
+ *
+ * Textures in this range are charged DAVE_SIM_FLASH_CYCLES_PER_BYTE per byte read instead of
+ * the bus throughput. By default there is no flash and all textures are in RAM.
+ */
+void dave_sim_set_flash(const void *base, size_t size);
+
+#endif /* DAVE_SIM_H_ */
@@ -0,0 +1,81 @@
+/**
+ ****************************************************************************************
+ *
+ * @file gdi_sim.h
+ *
+ * @brief Host simulator extensions of the GDI API
+ *
+ * Copyright (C) 2021-2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+
+#ifndef GDI_SIM_H_
+#define GDI_SIM_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \brief Set the stream that receives one CSV row per displayed frame
+ *
+ * Columns: frame, timestamp_us, tag, render_us, transfer_us, link_us, frame_us, pixels, gpu_us.
+ * render_us is the LVGL rendering time (excluding flush waits) reported by the port,
+ * transfer_us the host time spent composing the layers into the virtual panel and link_us
+ * the modelled time of pushing the same pixels over the panel interface. gpu_us is the
+ * D/AVE2D time of the frame as estimated by the software GPU (0 without SIM_GPU).
+ *
+ * \param [in] stream           Output stream, NULL disables the log
+ */
+void gdi_sim_set_frame_log(FILE *stream);
+
+/**
+ * \brief Set the stream that receives the periodic maps of the GUI heap
+ *
+ * The maps are the snapshots written by lv_mem_map_dump() every LV_PORT_DISP_HEAP_MAP_PERIOD ms,
+ * appended one after the other. tools/heap_view.c renders them.
+ *
+ * \param [in] stream           Output stream, NULL disables the maps
+ */
+void gdi_sim_set_heap_map(FILE *stream);
+
+/**
+ * \brief Receive the bytes of a map of the GUI heap
+ *
+ * Handed to lv_mem_map_start() by the display port when LV_PORT_DISP_HEAP_MAP_PERIOD is set, the
+ * bytes are written to the stream of gdi_sim_set_heap_map().
+ *
+ * \param [in] data             Bytes of the map
+ * \param [in] size             Number of bytes
+ * \param [in] user_data        Unused
+ */
+void gdi_sim_heap_map(const void *data, uint32_t size, void *user_data);
+
+/**
+ * \brief Enable/disable emulation of the panel interface transfer time
+ *
+ * When enabled the display task holds each frame for the modelled link time, so that frame
+ * pacing follows the target. Disable it to run the UI as fast as the host allows.
+ *
+ * \param [in] enable           True to emulate the link time (default), false otherwise
+ */
+void gdi_sim_set_link_emulation(bool enable);
+
+/**
+ * \brief Number of frames transferred to the virtual panel so far
+ */
+uint32_t gdi_sim_get_frame_count(void);
+
+/**
+ * \brief Write the current content of the virtual panel to a binary PPM (P6) file
+ *
+ * \param [in] path             Output file path
+ *
+ * \return True on success, false otherwise
+ */
+bool gdi_sim_save_screenshot(const char *path);
+
+#endif /* GDI_SIM_H_ */
@@ -0,0 +1,204 @@
+/**
+ ****************************************************************************************
+ *
+ * @file osal.h
+ *
+ * @brief OS abstraction layer API for the host simulator (POSIX threads)
+ *
+ * Provides the subset of the SDK OSAL used by GDI, the LVGL port and the demo UI so that
+ * they can be built unmodified for a Linux host. One OS tick equals one millisecond.
+ *
+ * Copyright (C) 2021-2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+
+#ifndef OSAL_H_
+#define OSAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*
+ * GENERIC HELPER MACROS
+ *****************************************************************************************
+ */
+#ifndef ARRAY_LENGTH
+#define ARRAY_LENGTH(array)             (sizeof((array)) / sizeof((array)[0]))
+#endif
+
+#ifndef MIN
+#define MIN(a, b)                       (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef MAX
+#define MAX(a, b)                       (((a) > (b)) ? (a) : (b))
+#endif
+
+/* No MPU/retention sections on the host */
+#define PRIVILEGED_DATA
+#define INITIALISED_PRIVILEGED_DATA
+#define __RETAINED
+#define __RETAINED_RW
+#define __RETAINED_CODE
+
+#define ASSERT_ERROR(a)                 assert(a)
+#define ASSERT_WARNING(a)               assert(a)
+
+/*
+ * OSAL DATA TYPE AND ENUMERATION
+ *****************************************************************************************
+ */
+typedef struct os_posix_task  *OS_TASK;
+typedef struct os_posix_event *OS_EVENT;
+typedef struct os_posix_mutex *OS_MUTEX;
+typedef struct os_posix_queue *OS_QUEUE;
+typedef int                    OS_BASE_TYPE;
+typedef uint32_t               OS_TICK_TIME;
+
+/* OS task priority values (informative only, the host scheduler is used) */
+#define OS_TASK_PRIORITY_LOWEST         (0)
+#define OS_TASK_PRIORITY_NORMAL         (1)
+#define OS_TASK_PRIORITY_HIGHEST        (7)
+
+#define OS_OK                           (1)
+#define OS_FAIL                         (0)
+
+#define OS_TASK_CREATE_SUCCESS          (OS_OK)
+#define OS_TASK_NOTIFY_SUCCESS          (OS_OK)
+#define OS_TASK_NOTIFY_FAIL             (OS_FAIL)
+#define OS_TASK_NOTIFY_NO_WAIT          (0)
+#define OS_TASK_NOTIFY_FOREVER          (UINT32_MAX)
+#define OS_TASK_NOTIFY_NONE             (0)
+#define OS_TASK_NOTIFY_ALL_BITS         (0xFFFFFFFF)
+
+#define OS_MUTEX_CREATE_SUCCESS         (OS_OK)
+#define OS_MUTEX_TAKEN                  (OS_OK)
+#define OS_MUTEX_NOT_TAKEN              (OS_FAIL)
+#define OS_MUTEX_NO_WAIT                (0)
+#define OS_MUTEX_FOREVER                (UINT32_MAX)
+
+#define OS_EVENT_CREATE_SUCCESS         (OS_OK)
+#define OS_EVENT_SIGNALED               (OS_OK)
+#define OS_EVENT_NOT_SIGNALED           (OS_FAIL)
+#define OS_EVENT_NO_WAIT                (0)
+#define OS_EVENT_FOREVER                (UINT32_MAX)
+
+#define OS_QUEUE_OK                     (OS_OK)
+#define OS_QUEUE_FULL                   (OS_FAIL)
+#define OS_QUEUE_EMPTY                  (OS_FAIL)
+#define OS_QUEUE_NO_WAIT                (0)
+#define OS_QUEUE_FOREVER                (UINT32_MAX)
+
+#define portMAX_DELAY                   (UINT32_MAX)
+
+/* Actions performed on the notification value of a task */
+typedef enum {
+        OS_NOTIFY_NO_ACTION,
+        OS_NOTIFY_SET_BITS,
+        OS_NOTIFY_INCREMENT,
+        OS_NOTIFY_VAL_WITH_OVERWRITE,
+        OS_NOTIFY_VAL_WITHOUT_OVERWRITE,
+} OS_NOTIFY_ACTION;
+
+/* Per task run-time statistics, as reported by FreeRTOS uxTaskGetSystemState() */
+typedef struct {
+        OS_TASK xHandle;
+        const char *pcTaskName;
+        uint32_t ulRunTimeCounter;      /**< CPU time consumed by the task in us */
+} TaskStatus_t;
+
+/*
+ * OSAL API
+ *****************************************************************************************
+ */
+#define OS_TASK_FUNCTION(func, arg)     void func(void *arg)
+
+#define OS_TASK_CREATE(name, task_func, arg, stack_size, priority, task) \
+        os_posix_task_create((name), (task_func), (arg), &(task))
+#define OS_TASK_DELETE(task)            os_posix_task_delete(task)
+#define OS_GET_CURRENT_TASK()           os_posix_task_current()
+
+#define OS_TASK_NOTIFY(task, value, action) \
+        os_posix_task_notify((task), (value), (action))
+#define OS_TASK_NOTIFY_FROM_ISR(task, value, action) \
+        os_posix_task_notify((task), (value), (action))
+#define OS_TASK_NOTIFY_WAIT(entry_bits, exit_bits, value, ticks_to_wait) \
+        os_posix_task_notify_wait((entry_bits), (exit_bits), (value), (ticks_to_wait))
+
+#define OS_MUTEX_CREATE(mutex)          ((mutex) = os_posix_mutex_create())
+#define OS_MUTEX_DELETE(mutex)          os_posix_mutex_delete(mutex)
+#define OS_MUTEX_GET(mutex, timeout)    os_posix_mutex_get((mutex), (timeout))
+#define OS_MUTEX_PUT(mutex)             os_posix_mutex_put(mutex)
+
+#define OS_EVENT_CREATE(event)          ((event) = os_posix_event_create())
+#define OS_EVENT_DELETE(event)          os_posix_event_delete(event)
+#define OS_EVENT_SIGNAL(event)          os_posix_event_signal(event)
+#define OS_EVENT_SIGNAL_FROM_ISR(event) os_posix_event_signal(event)
+#define OS_EVENT_WAIT(event, timeout)   os_posix_event_wait((event), (timeout))
+#define OS_EVENT_CHECK(event)           os_posix_event_wait((event), OS_EVENT_NO_WAIT)
+
+#define OS_QUEUE_CREATE(queue, item_size, max_items) \
+        ((queue) = os_posix_queue_create((item_size), (max_items)))
+#define OS_QUEUE_DELETE(queue)          os_posix_queue_delete(queue)
+#define OS_QUEUE_PUT(queue, item, timeout) \
+        os_posix_queue_put((queue), (item), (timeout))
+#define OS_QUEUE_PUT_FROM_ISR(queue, item) \
+        os_posix_queue_put((queue), (item), OS_QUEUE_NO_WAIT)
+#define OS_QUEUE_GET(queue, item, timeout) \
+        os_posix_queue_get((queue), (item), (timeout))
+#define OS_QUEUE_MESSAGES_WAITING(queue) \
+        os_posix_queue_messages_waiting(queue)
+
+#define OS_MS_2_TICKS(ms)               ((OS_TICK_TIME)(ms))
+#define OS_TICKS_2_MS(ticks)            ((uint32_t)(ticks))
+#define OS_DELAY(ticks)                 os_posix_delay_us((uint64_t)(ticks) * 1000)
+#define OS_DELAY_MS(ms)                 OS_DELAY(OS_MS_2_TICKS(ms))
+#define OS_GET_TICK_COUNT()             ((OS_TICK_TIME)(os_posix_uptime_us() / 1000))
+#define OS_GET_TICK_COUNT_FROM_ISR()    OS_GET_TICK_COUNT()
+
+#define OS_ENTER_CRITICAL_SECTION()     os_posix_enter_critical_section()
+#define OS_LEAVE_CRITICAL_SECTION()     os_posix_leave_critical_section()
+
+#define OS_MALLOC(size)                 malloc(size)
+#define OS_FREE(addr)                   free(addr)
+
+#define OS_ASSERT(cond)                 assert(cond)
+
+OS_BASE_TYPE os_posix_task_create(const char *name, void (*task_func)(void *), void *arg, OS_TASK *task);
+void os_posix_task_delete(OS_TASK task);
+OS_TASK os_posix_task_current(void);
+OS_BASE_TYPE os_posix_task_notify(OS_TASK task, uint32_t value, OS_NOTIFY_ACTION action);
+OS_BASE_TYPE os_posix_task_notify_wait(uint32_t entry_bits, uint32_t exit_bits, uint32_t *value, OS_TICK_TIME ticks);
+
+OS_MUTEX os_posix_mutex_create(void);
+void os_posix_mutex_delete(OS_MUTEX mutex);
+OS_BASE_TYPE os_posix_mutex_get(OS_MUTEX mutex, OS_TICK_TIME ticks);
+OS_BASE_TYPE os_posix_mutex_put(OS_MUTEX mutex);
+
+OS_EVENT os_posix_event_create(void);
+void os_posix_event_delete(OS_EVENT event);
+OS_BASE_TYPE os_posix_event_signal(OS_EVENT event);
+OS_BASE_TYPE os_posix_event_wait(OS_EVENT event, OS_TICK_TIME ticks);
+
+OS_QUEUE os_posix_queue_create(size_t item_size, size_t max_items);
+void os_posix_queue_delete(OS_QUEUE queue);
+OS_BASE_TYPE os_posix_queue_put(OS_QUEUE queue, const void *item, OS_TICK_TIME ticks);
+OS_BASE_TYPE os_posix_queue_get(OS_QUEUE queue, void *item, OS_TICK_TIME ticks);
+uint32_t os_posix_queue_messages_waiting(OS_QUEUE queue);
+
+void os_posix_delay_us(uint64_t us);
+uint64_t os_posix_uptime_us(void);
+uint64_t os_posix_uptime_ns(void);
+void os_posix_enter_critical_section(void);
+void os_posix_leave_critical_section(void);
+
+/* FreeRTOS run-time statistics, used by the performance metrics module */
+uint32_t uxTaskGetSystemState(TaskStatus_t *status_array, uint32_t array_size, uint32_t *total_run_time);
+
+#endif /* OSAL_H_ */
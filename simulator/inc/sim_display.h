@@ -0,0 +1,66 @@
+/**
+ ****************************************************************************************
+ *
+ * @file sim_display.h
+ *
+ * @brief Virtual LCD configuration for the host simulator
+ *
+ * Models the E120A390QSR panel of the DA14706 kit: same resolution, color mode, offset and
+ * partial update alignment rules, so that the LVGL port behaves as on target.
+ *
+ * Copyright (C) 2021-2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+
+#ifndef SIM_DISPLAY_H_
+#define SIM_DISPLAY_H_
+
+#include <stdint.h>
+
+#if dg_configUSE_SIM_DISPLAY
+
+#if dg_configLCDC_ADAPTER
+
+/*********************************************************************
+ *
+ *       Defines
+ *
+ *********************************************************************
+ */
+#define GDI_DISP_COLOR           (HW_LCDC_OCM_8RGB565)
+#define GDI_DISP_RESX            (390)
+#define GDI_DISP_RESY            (390)
+#define GDI_DISP_OFFSETX         (6)
+#define GDI_DISP_OFFSETY         (0)
+#define GDI_LCDC_CONFIG          (NULL)
+#define GDI_USE_CONTINUOUS_MODE  (0)
+
+/* Bytes per second pushed over the emulated QSPI link (48 MHz, 4 data lines) */
+#define SIM_DISPLAY_LINK_RATE    (48000000 / 2)
+
+static inline void screen_set_partial_update_area(hw_lcdc_frame_t *frame)
+{
+        /* The SC[9:0] and EC[9:0]-SC[9:0]+1 must be divisible by 2 */
+        /* The SP[9:0] and EP[9:0]-SP[9:0]+1 must be divisible by 2 */
+        if (frame->startx & 0x1) {
+                frame->startx--;
+        }
+        if (frame->starty & 0x1) {
+                frame->starty--;
+        }
+        if ((frame->endx - frame->startx + 1) & 0x1) {
+                frame->endx++;
+        }
+        if ((frame->endy - frame->starty + 1) & 0x1) {
+                frame->endy++;
+        }
+}
+
+#endif /* dg_configLCDC_ADAPTER */
+
+#endif /* dg_configUSE_SIM_DISPLAY */
+
+#endif /* SIM_DISPLAY_H_ */
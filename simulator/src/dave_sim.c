@@ -0,0 +1,1683 @@
+/**
+ ****************************************************************************************
+ *
+ * @file dave_sim.c
+ *
+ * @brief Software D/AVE2D for the host simulator
+ *
+ * Implements the part of the dave_driver.h API used by lv_port_gpu.c on the CPU, so that the
+ * GPU accelerated rendering path can run and be checked on the host. Render buffers record
+ * every primitive together with a snapshot of the context state and are rasterized when
+ * executed, in submission order.
+ *
+ * Rasterization follows the documented D/AVE2D semantics:
+ * - coordinates are 4-bit fixed point and pixel (x, y) covers [x, x + 1) x [y, y + 1), so
+ *   integer boxes are fully covered and edges at fractional positions are anti-aliased by
+ *   their area (boxes) or by the distance of the pixel center to each edge (quads, lines)
+ * - circles and wedges are anti-aliased by the distance of the pixel center to the circle. A
+ *   ring of width w > 0 covers the radii [r - w, r + w]; a wedge keeps the pixels on the
+ *   positive side of both edge normals (16.16 fixed point), or of either one with
+ *   d2_wf_concave
+ * - texture coordinates are 16.16 fixed point and are evaluated at pixel centers; with
+ *   filtering enabled texel (i, j) is centered at (i, j), otherwise it covers [i, i + 1)
+ * - sub-byte texels are packed LSB first, RLE textures use the D/AVE2D RLE unit
+ * - color = Cs * src_factor + Cd * dst_factor, alpha = As * src_factor + Ad * dst_factor,
+ *   where As is coverage x constant alpha x texture alpha
+ *
+ * The hardware is not modelled cycle by cycle. Every primitive is charged a set-up cost, one
+ * cycle per pixel of its bounding box walked by the rasterizer and, for covered pixels, the
+ * bus cycles of the frame buffer and texture accesses. Textures in the emulated QSPI flash (see
+ * dave_sim_set_flash()) are fetched at the flash throughput instead, RLE textures at their
+ * compression ratio. The estimate is reported through the
+ * d2_pc_davecycles performance counter, which the port converts to microseconds with
+ * d1_deviceclkfreq().
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dave_driver.h"
+#include "dave_sim.h"
+
+/**********************************************************************
+ *
+ *       Defines
+ *
+ **********************************************************************
+ */
+/* D/AVE2D clock, AD_LCDC_DEFAULT_CLK of the demo */
+#ifndef DAVE_SIM_CLOCK_HZ
+#define DAVE_SIM_CLOCK_HZ                       (96000000)
+#endif
+
+/* Display list fetch and register set-up of one primitive */
+#ifndef DAVE_SIM_PRIMITIVE_CYCLES
+#define DAVE_SIM_PRIMITIVE_CYCLES               (40)
+#endif
+
+/* Start of a render buffer and end of list interrupt */
+#ifndef DAVE_SIM_EXECUTE_CYCLES
+#define DAVE_SIM_EXECUTE_CYCLES                 (200)
+#endif
+
+/* Sustained bus throughput of the master interfaces (32-bit AHB, 8-beat bursts) */
+#ifndef DAVE_SIM_BUS_BYTES_PER_CYCLE
+#define DAVE_SIM_BUS_BYTES_PER_CYCLE            (4)
+#endif
+
+/* Texture fetches from the QSPI flash (quad I/O at 96 MHz, 48 MB/s, at the 96 MHz GPU clock) */
+#ifndef DAVE_SIM_FLASH_CYCLES_PER_BYTE
+#define DAVE_SIM_FLASH_CYCLES_PER_BYTE          (2)
+#endif
+
+#define DAVE_SIM_PERF_COUNTERS                  (2)
+#define DAVE_SIM_CLUT_SIZE                      (256)
+#define DAVE_SIM_FORMAT_MASK                    (0xFF & ~(d2_mode_rle | d2_mode_clut))
+
+#ifndef MIN
+#define MIN(a, b)                               (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b)                               (((a) > (b)) ? (a) : (b))
+#endif
+
+/* Rounded a * b / 255 for 8-bit values */
+#define MUL8(a, b)                              mul8((a), (b))
+
+#define A_OF(c)                                 ((uint8_t)((c) >> 24))
+#define R_OF(c)                                 ((uint8_t)((c) >> 16))
+#define G_OF(c)                                 ((uint8_t)((c) >> 8))
+#define B_OF(c)                                 ((uint8_t)(c))
+#define ARGB(a, r, g, b)                        (((uint32_t)(a) << 24) | ((uint32_t)(r) << 16) | \
+                                                 ((uint32_t)(g) << 8) | (uint32_t)(b))
+
+/**********************************************************************
+ *
+ *       Types
+ *
+ **********************************************************************
+ */
+typedef struct {
+        uint8_t *ptr;
+        d2_s32 pitch;
+        d2_u32 width;
+        d2_u32 height;
+        d2_u32 format;
+} sim_surface_t;
+
+typedef struct {
+        sim_surface_t fb;
+        d2_border clip_xmin, clip_ymin, clip_xmax, clip_ymax;
+        d2_color color[2];
+        d2_alpha alpha;
+        d2_u32 blend_src, blend_dst;
+        d2_u32 alpha_blend_src, alpha_blend_dst;
+        d2_u32 fillmode;
+        bool antialiasing;
+
+        /* Texturing */
+        sim_surface_t tex;
+        d2_u32 texmode;
+        uint8_t texop[4];               /* A, R, G, B */
+        uint8_t texop_p1[4], texop_p2[4];
+        d2_point tex_x, tex_y;
+        d2_s32 u0, v0, dxu, dyu, dxv, dyv;
+        d2_point texel_cx, texel_cy;
+        const d2_color *clut;           /* NULL: CLUT loaded with d2_writetexclut_direct() */
+        bool colorkey_enable;
+        d2_color colorkey;
+
+        sim_surface_t blit_src;
+} sim_context_t;
+
+typedef enum {
+        SIM_CMD_BOX,
+        SIM_CMD_LINE,
+        SIM_CMD_QUAD,
+        SIM_CMD_CIRCLE,
+        SIM_CMD_WEDGE,
+        SIM_CMD_BLIT,
+} SIM_CMD;
+
+typedef struct {
+        SIM_CMD type;
+        d2_s32 param[10];
+        sim_context_t ctx;
+} sim_command_t;
+
+typedef struct {
+        sim_command_t *cmd;
+        size_t count;
+        size_t size;
+        size_t step;
+} sim_renderbuffer_t;
+
+typedef struct {
+        sim_context_t ctx;
+        sim_renderbuffer_t default_buffer;
+        sim_renderbuffer_t *selected;
+        d2_color clut[DAVE_SIM_CLUT_SIZE];
+        d2_s32 error;
+
+        d2_u32 perf_event[DAVE_SIM_PERF_COUNTERS];
+        d2_slong perf_value[DAVE_SIM_PERF_COUNTERS];
+
+        /* Decoded copy of the RLE texture in use */
+        const void *rle_src;
+        size_t rle_size;
+        size_t rle_packed;              /* Bytes of the compressed texture */
+        uint8_t *rle_buf;
+} sim_device_t;
+
+/* Resources of one primitive, used by the cost model */
+typedef struct {
+        uint32_t scanned;
+        uint32_t covered;
+        uint32_t fb_read_bytes;
+        uint32_t fb_write_bytes;
+        uint32_t tex_read_bytes;
+        uint32_t tex_flash_bytes;
+} sim_stats_t;
+
+/* Per-primitive state resolved once before walking the pixels */
+typedef struct {
+        sim_device_t *dev;
+        const sim_context_t *ctx;
+        const uint8_t *tex_data;
+        const d2_color *clut;
+        int fb_bytes;
+        int tex_bpp;
+        size_t tex_packed;              /* RLE textures: compressed and decoded size */
+        size_t tex_size;
+        bool tex_flash;
+        bool textured;
+        bool read_dst;
+        sim_stats_t stats;
+} sim_raster_t;
+
+typedef struct {
+        float ax, ay;
+        float nx, ny;                   /* Inward unit normal */
+} sim_edge_t;
+
+/**********************************************************************
+ *
+ *       Static data
+ *
+ **********************************************************************
+ */
+#define ERR(x, y) y,
+static const char *const error_strings[] = {
+#include "dave_errorcodes.h"
+};
+#undef ERR
+
+/* Returned by d2_level1interface(), the level 1 driver has no state on the host */
+static int level1_device;
+
+static uint64_t total_cycles;
+
+static const uint8_t *flash_base;
+static size_t flash_size;
+
+/**********************************************************************
+ *
+ *       Static code
+ *
+ **********************************************************************
+ */
+static inline uint8_t mul8(uint32_t a, uint32_t b)
+{
+        uint32_t t = a * b + 128;
+
+        return (uint8_t)((t + (t >> 8)) >> 8);
+}
+
+static d2_s32 set_error(sim_device_t *dev, d2_s32 error)
+{
+        if (dev) {
+                dev->error = error;
+        }
+        return error;
+}
+
+static int format_bpp(d2_u32 format)
+{
+        switch (format & DAVE_SIM_FORMAT_MASK) {
+        case d2_mode_argb8888:
+        case d2_mode_rgba8888:
+        case d2_mode_rgb888:
+                return 32;
+        case d2_mode_rgb565:
+        case d2_mode_argb4444:
+        case d2_mode_argb1555:
+        case d2_mode_rgba4444:
+        case d2_mode_rgba5551:
+                return 16;
+        case d2_mode_alpha8:
+        case d2_mode_ai44:
+        case d2_mode_i8:
+                return 8;
+        case d2_mode_alpha4:
+        case d2_mode_i4:
+                return 4;
+        case d2_mode_alpha2:
+        case d2_mode_i2:
+                return 2;
+        case d2_mode_alpha1:
+        case d2_mode_i1:
+                return 1;
+        default:
+                return 0;
+        }
+}
+
+static bool format_is_fb(d2_u32 format)
+{
+        switch (format) {
+        case d2_mode_alpha8:
+        case d2_mode_rgb565:
+        case d2_mode_argb8888:
+        case d2_mode_argb4444:
+        case d2_mode_rgba8888:
+        case d2_mode_rgba4444:
+                return true;
+        default:
+                return false;
+        }
+}
+
+static uint8_t expand_bits(uint32_t v, int bits)
+{
+        switch (bits) {
+        case 1:  return v ? 0xFF : 0;
+        case 2:  return v * 0x55;
+        case 4:  return v * 0x11;
+        case 5:  return (v << 3) | (v >> 2);
+        case 6:  return (v << 2) | (v >> 4);
+        default: return v;
+        }
+}
+
+/* Convert a stored pixel to ARGB8888, indices are resolved through the CLUT */
+static uint32_t pixel_to_argb(uint32_t v, d2_u32 format, const d2_color *clut)
+{
+        switch (format & DAVE_SIM_FORMAT_MASK) {
+        case d2_mode_argb8888:
+                return v;
+        case d2_mode_rgba8888:
+                return (v >> 8) | (v << 24);
+        case d2_mode_rgb888:
+                return v | 0xFF000000;
+        case d2_mode_rgb565:
+                return ARGB(0xFF, expand_bits((v >> 11) & 0x1F, 5), expand_bits((v >> 5) & 0x3F, 6),
+                        expand_bits(v & 0x1F, 5));
+        case d2_mode_argb4444:
+                return ARGB(expand_bits((v >> 12) & 0xF, 4), expand_bits((v >> 8) & 0xF, 4),
+                        expand_bits((v >> 4) & 0xF, 4), expand_bits(v & 0xF, 4));
+        case d2_mode_rgba4444:
+                return ARGB(expand_bits(v & 0xF, 4), expand_bits((v >> 12) & 0xF, 4),
+                        expand_bits((v >> 8) & 0xF, 4), expand_bits((v >> 4) & 0xF, 4));
+        case d2_mode_argb1555:
+                return ARGB(expand_bits((v >> 15) & 0x1, 1), expand_bits((v >> 10) & 0x1F, 5),
+                        expand_bits((v >> 5) & 0x1F, 5), expand_bits(v & 0x1F, 5));
+        case d2_mode_rgba5551:
+                return ARGB(expand_bits(v & 0x1, 1), expand_bits((v >> 11) & 0x1F, 5),
+                        expand_bits((v >> 6) & 0x1F, 5), expand_bits((v >> 1) & 0x1F, 5));
+        case d2_mode_ai44:
+                return (clut[v & 0xF] & 0x00FFFFFF) | ((uint32_t)expand_bits(v >> 4, 4) << 24);
+        case d2_mode_i8:
+        case d2_mode_i4:
+        case d2_mode_i2:
+        case d2_mode_i1:
+                return clut[v];
+        case d2_mode_alpha8:
+                return ARGB(v, 0xFF, 0xFF, 0xFF);
+        case d2_mode_alpha4:
+                return ARGB(expand_bits(v, 4), 0xFF, 0xFF, 0xFF);
+        case d2_mode_alpha2:
+                return ARGB(expand_bits(v, 2), 0xFF, 0xFF, 0xFF);
+        case d2_mode_alpha1:
+                return ARGB(expand_bits(v, 1), 0xFF, 0xFF, 0xFF);
+        default:
+                return 0;
+        }
+}
+
+static uint32_t argb_to_pixel(uint32_t c, d2_u32 format)
+{
+        switch (format) {
+        case d2_mode_argb8888:
+                return c;
+        case d2_mode_rgba8888:
+                return (c << 8) | A_OF(c);
+        case d2_mode_rgb565:
+                return ((R_OF(c) >> 3) << 11) | ((G_OF(c) >> 2) << 5) | (B_OF(c) >> 3);
+        case d2_mode_argb4444:
+                return ((A_OF(c) >> 4) << 12) | ((R_OF(c) >> 4) << 8) | ((G_OF(c) >> 4) << 4) | (B_OF(c) >> 4);
+        case d2_mode_rgba4444:
+                return ((R_OF(c) >> 4) << 12) | ((G_OF(c) >> 4) << 8) | ((B_OF(c) >> 4) << 4) | (A_OF(c) >> 4);
+        case d2_mode_alpha8:
+                return A_OF(c);
+        default:
+                return 0;
+        }
+}
+
+/* Read the raw value of pixel 'index' of a buffer, sub-byte pixels are packed LSB first */
+static uint32_t read_raw(const uint8_t *data, size_t index, int bpp)
+{
+        switch (bpp) {
+        case 32: return ((const uint32_t *)data)[index];
+        case 16: return ((const uint16_t *)data)[index];
+        case 8:  return data[index];
+        default:
+        {
+                size_t bit = index * bpp;
+
+                return (data[bit >> 3] >> (bit & 7)) & ((1 << bpp) - 1);
+        }
+        }
+}
+
+static void write_raw(uint8_t *data, size_t index, int bpp, uint32_t v)
+{
+        switch (bpp) {
+        case 32: ((uint32_t *)data)[index] = v; break;
+        case 16: ((uint16_t *)data)[index] = (uint16_t)v; break;
+        case 8:  data[index] = (uint8_t)v; break;
+        default: break;
+        }
+}
+
+/*
+ * The D/AVE2D RLE unit works on pixels of at least one byte (sub-byte formats are handled a
+ * byte at a time). Each packet starts with a control byte: with bit 7 set the next unit is
+ * repeated (n & 0x7F) + 1 times, otherwise (n + 1) units are stored verbatim.
+ */
+static const uint8_t *rle_decode(sim_device_t *dev, const sim_surface_t *tex)
+{
+        int bpp = format_bpp(tex->format);
+        size_t unit = bpp < 8 ? 1 : bpp / 8;
+        size_t size = ((size_t)tex->pitch * tex->height * bpp + 7) / 8;
+        const uint8_t *src = tex->ptr;
+        size_t pos = 0;
+
+        if (dev->rle_src == tex->ptr && dev->rle_size == size) {
+                return dev->rle_buf;
+        }
+
+        free(dev->rle_buf);
+        dev->rle_buf = malloc(size);
+        if (!dev->rle_buf) {
+                dev->rle_src = NULL;
+                return NULL;
+        }
+
+        while (pos < size) {
+                uint8_t ctrl = *src++;
+                size_t n = (size_t)(ctrl & 0x7F) + 1;
+
+                if (ctrl & 0x80) {
+                        for (; n && pos < size; n--, pos += unit) {
+                                memcpy(dev->rle_buf + pos, src, MIN(unit, size - pos));
+                        }
+                        src += unit;
+                } else {
+                        size_t len = MIN(n * unit, size - pos);
+
+                        memcpy(dev->rle_buf + pos, src, len);
+                        src += n * unit;
+                        pos += len;
+                }
+        }
+
+        dev->rle_src = tex->ptr;
+        dev->rle_size = size;
+        dev->rle_packed = src - (const uint8_t *)tex->ptr;
+
+        return dev->rle_buf;
+}
+
+static int wrap_coord(int c, int size, bool wrap)
+{
+        if (wrap) {
+                c %= size;
+                return c < 0 ? c + size : c;
+        }
+        return c < 0 ? 0 : (c >= size ? size - 1 : c);
+}
+
+static uint32_t fetch_texel(const sim_raster_t *r, int x, int y)
+{
+        const sim_context_t *ctx = r->ctx;
+        uint32_t c;
+
+        x = wrap_coord(x, ctx->tex.width, ctx->texmode & d2_tm_wrapu);
+        y = wrap_coord(y, ctx->tex.height, ctx->texmode & d2_tm_wrapv);
+
+        c = pixel_to_argb(read_raw(r->tex_data, (size_t)y * ctx->tex.pitch + x, r->tex_bpp),
+                ctx->tex.format, r->clut);
+
+        if (ctx->colorkey_enable && !((c ^ ctx->colorkey) & 0x00FFFFFF)) {
+                c &= 0x00FFFFFF;
+        }
+
+        return c;
+}
+
+static uint32_t lerp_argb(uint32_t c0, uint32_t c1, uint32_t w)
+{
+        uint32_t out = 0;
+
+        for (int shift = 0; shift < 32; shift += 8) {
+                uint32_t a = (c0 >> shift) & 0xFF, b = (c1 >> shift) & 0xFF;
+
+                out |= (((a * (256 - w) + b * w) >> 8) & 0xFF) << shift;
+        }
+        return out;
+}
+
+static uint32_t sample_texture(const sim_raster_t *r, int px, int py)
+{
+        const sim_context_t *ctx = r->ctx;
+        int64_t sx = (int64_t)px * 16 + 8 - ctx->tex_x - ctx->texel_cx;
+        int64_t sy = (int64_t)py * 16 + 8 - ctx->tex_y - ctx->texel_cy;
+        int64_t u = ctx->u0 + ((ctx->dxu * sx + ctx->dyu * sy) >> 4);
+        int64_t v = ctx->v0 + ((ctx->dxv * sx + ctx->dyv * sy) >> 4);
+        int tu = (int)(u >> 16), tv = (int)(v >> 16);
+        uint32_t fu = (ctx->texmode & d2_tm_filteru) ? (uint32_t)(u >> 8) & 0xFF : 0;
+        uint32_t fv = (ctx->texmode & d2_tm_filterv) ? (uint32_t)(v >> 8) & 0xFF : 0;
+        uint32_t c0, c1;
+
+        c0 = fetch_texel(r, tu, tv);
+        if (fu) {
+                c0 = lerp_argb(c0, fetch_texel(r, tu + 1, tv), fu);
+        }
+        if (fv) {
+                c1 = fetch_texel(r, tu, tv + 1);
+                if (fu) {
+                        c1 = lerp_argb(c1, fetch_texel(r, tu + 1, tv + 1), fu);
+                }
+                c0 = lerp_argb(c0, c1, fv);
+        }
+
+        return c0;
+}
+
+static uint8_t texture_operation(uint8_t op, uint8_t t, uint8_t p1, uint8_t p2)
+{
+        switch (op) {
+        case d2_to_zero:        return 0;
+        case d2_to_one:         return 0xFF;
+        case d2_to_replace:     return p1;
+        case d2_to_copy:        return t;
+        case d2_to_invert:      return 0xFF - t;
+        case d2_to_multiply:    return MUL8(t, p1);
+        case d2_to_invmultiply: return MUL8(0xFF - t, p1);
+        case d2_to_blend:       return p2 >= p1 ? p1 + MUL8(t, p2 - p1) : p1 - MUL8(t, p1 - p2);
+        default:                return t;
+        }
+}
+
+static uint8_t blend_factor(d2_u32 mode, uint8_t alpha)
+{
+        switch (mode) {
+        case d2_bm_zero:             return 0;
+        case d2_bm_one:              return 0xFF;
+        case d2_bm_alpha:            return alpha;
+        case d2_bm_one_minus_alpha:  return 0xFF - alpha;
+        default:                     return 0;
+        }
+}
+
+static uint8_t blend_channel(uint8_t s, uint8_t fs, uint8_t d, uint8_t fd)
+{
+        uint32_t v = MUL8(s, fs) + MUL8(d, fd);
+
+        return v > 0xFF ? 0xFF : v;
+}
+
+static void shade_pixel(sim_raster_t *r, int px, int py, uint8_t coverage)
+{
+        const sim_context_t *ctx = r->ctx;
+        size_t index = (size_t)py * ctx->fb.pitch + px;
+        uint32_t src, dst = 0, out;
+        uint8_t sa, fs, fd, fsa, fda;
+
+        if (r->textured) {
+                uint32_t t = sample_texture(r, px, py);
+
+                src = ARGB(texture_operation(ctx->texop[0], A_OF(t), ctx->texop_p1[0], ctx->texop_p2[0]),
+                           texture_operation(ctx->texop[1], R_OF(t), ctx->texop_p1[1], ctx->texop_p2[1]),
+                           texture_operation(ctx->texop[2], G_OF(t), ctx->texop_p1[2], ctx->texop_p2[2]),
+                           texture_operation(ctx->texop[3], B_OF(t), ctx->texop_p1[3], ctx->texop_p2[3]));
+                r->stats.tex_read_bytes += MAX(r->tex_bpp / 8, 1) *
+                        ((ctx->texmode & d2_tm_filteru) ? 2 : 1) * ((ctx->texmode & d2_tm_filterv) ? 2 : 1);
+        } else {
+                src = ctx->color[0] | 0xFF000000;
+        }
+
+        sa = MUL8(MUL8(coverage, ctx->alpha), A_OF(src));
+
+        if (r->read_dst) {
+                dst = pixel_to_argb(read_raw(ctx->fb.ptr, index, r->fb_bytes * 8), ctx->fb.format, NULL);
+                r->stats.fb_read_bytes += r->fb_bytes;
+        }
+
+        fs = blend_factor(ctx->blend_src, sa);
+        fd = blend_factor(ctx->blend_dst, sa);
+        fsa = blend_factor(ctx->alpha_blend_src, sa);
+        fda = blend_factor(ctx->alpha_blend_dst, sa);
+
+        out = ARGB(blend_channel(sa, fsa, A_OF(dst), fda),
+                   blend_channel(R_OF(src), fs, R_OF(dst), fd),
+                   blend_channel(G_OF(src), fs, G_OF(dst), fd),
+                   blend_channel(B_OF(src), fs, B_OF(dst), fd));
+
+        write_raw(ctx->fb.ptr, index, r->fb_bytes * 8, argb_to_pixel(out, ctx->fb.format));
+        r->stats.fb_write_bytes += r->fb_bytes;
+        r->stats.covered++;
+}
+
+static bool raster_begin(sim_raster_t *r, sim_device_t *dev, const sim_context_t *ctx,
+        int *xmin, int *ymin, int *xmax, int *ymax)
+{
+        memset(r, 0, sizeof(*r));
+        r->dev = dev;
+        r->ctx = ctx;
+
+        if (!ctx->fb.ptr || !format_is_fb(ctx->fb.format)) {
+                return false;
+        }
+        r->fb_bytes = format_bpp(ctx->fb.format) / 8;
+
+        r->textured = ctx->fillmode == d2_fm_texture;
+        if (r->textured) {
+                if (!ctx->tex.ptr || !ctx->tex.width || !ctx->tex.height) {
+                        return false;
+                }
+                r->tex_bpp = format_bpp(ctx->tex.format);
+                r->tex_data = ctx->tex.ptr;
+                r->clut = ctx->clut ? ctx->clut : dev->clut;
+                r->tex_flash = flash_size && (const uint8_t *)ctx->tex.ptr >= flash_base &&
+                        (const uint8_t *)ctx->tex.ptr < flash_base + flash_size;
+                if (ctx->tex.format & d2_mode_rle) {
+                        r->tex_data = rle_decode(dev, &ctx->tex);
+                        if (!r->tex_data) {
+                                return false;
+                        }
+                        r->tex_packed = dev->rle_packed;
+                        r->tex_size = dev->rle_size;
+                }
+        }
+
+        /* The destination is fetched only when it contributes to the result */
+        r->read_dst = ctx->blend_dst != d2_bm_zero ||
+                (ctx->alpha_blend_dst != d2_bm_zero && ctx->fb.format != d2_mode_rgb565);
+
+        *xmin = MAX(*xmin, MAX(ctx->clip_xmin, 0));
+        *ymin = MAX(*ymin, MAX(ctx->clip_ymin, 0));
+        *xmax = MIN(*xmax, MIN(ctx->clip_xmax, (int)ctx->fb.width - 1));
+        *ymax = MIN(*ymax, MIN(ctx->clip_ymax, (int)ctx->fb.height - 1));
+
+        return *xmin <= *xmax && *ymin <= *ymax;
+}
+
+static int span_coverage(int p, int lo, int hi)
+{
+        int c = MIN(p * 16 + 16, hi) - MAX(p * 16, lo);
+
+        return c < 0 ? 0 : c;
+}
+
+static void raster_box(sim_raster_t *r, sim_device_t *dev, const sim_context_t *ctx,
+        int x, int y, int w, int h)
+{
+        int xmin = x >> 4, ymin = y >> 4, xmax = (x + w - 1) >> 4, ymax = (y + h - 1) >> 4;
+
+        if (w <= 0 || h <= 0 || !raster_begin(r, dev, ctx, &xmin, &ymin, &xmax, &ymax)) {
+                return;
+        }
+
+        for (int py = ymin; py <= ymax; py++) {
+                int cy = span_coverage(py, y, y + h);
+
+                for (int px = xmin; px <= xmax; px++) {
+                        int cx = span_coverage(px, x, x + w);
+                        uint8_t coverage;
+
+                        r->stats.scanned++;
+                        if (ctx->antialiasing) {
+                                coverage = (uint8_t)((cx * cy * 255 + 128) >> 8);
+                        } else {
+                                int sx = px * 16 + 8, sy = py * 16 + 8;
+
+                                coverage = (sx >= x && sx < x + w && sy >= y && sy < y + h) ? 0xFF : 0;
+                        }
+                        if (coverage) {
+                                shade_pixel(r, px, py, coverage);
+                        }
+                }
+        }
+}
+
+static void raster_polygon(sim_raster_t *r, sim_device_t *dev, const sim_context_t *ctx,
+        const float *pts, int n)
+{
+        sim_edge_t edge[4];
+        float area = 0, fxmin = pts[0], fymin = pts[1], fxmax = pts[0], fymax = pts[1];
+        int edges = 0, xmin, ymin, xmax, ymax;
+
+        for (int i = 0; i < n; i++) {
+                const float *a = &pts[i * 2], *b = &pts[((i + 1) % n) * 2];
+
+                area += a[0] * b[1] - b[0] * a[1];
+                fxmin = fminf(fxmin, a[0]); fxmax = fmaxf(fxmax, a[0]);
+                fymin = fminf(fymin, a[1]); fymax = fmaxf(fymax, a[1]);
+        }
+        if (area == 0) {
+                return;
+        }
+
+        for (int i = 0; i < n; i++) {
+                const float *a = &pts[i * 2], *b = &pts[((i + 1) % n) * 2];
+                float ex = b[0] - a[0], ey = b[1] - a[1], len = sqrtf(ex * ex + ey * ey);
+
+                if (len == 0) {
+                        continue;
+                }
+                edge[edges].ax = a[0];
+                edge[edges].ay = a[1];
+                edge[edges].nx = (area > 0 ? -ey : ey) / len;
+                edge[edges].ny = (area > 0 ? ex : -ex) / len;
+                edges++;
+        }
+
+        xmin = (int)floorf(fxmin);
+        ymin = (int)floorf(fymin);
+        xmax = (int)ceilf(fxmax) - 1;
+        ymax = (int)ceilf(fymax) - 1;
+        if (!raster_begin(r, dev, ctx, &xmin, &ymin, &xmax, &ymax)) {
+                return;
+        }
+
+        for (int py = ymin; py <= ymax; py++) {
+                for (int px = xmin; px <= xmax; px++) {
+                        float cov = 1.0f;
+
+                        r->stats.scanned++;
+                        for (int i = 0; i < edges && cov > 0; i++) {
+                                float d = (px + 0.5f - edge[i].ax) * edge[i].nx + (py + 0.5f - edge[i].ay) * edge[i].ny;
+
+                                if (ctx->antialiasing) {
+                                        cov *= d <= -0.5f ? 0.0f : (d >= 0.5f ? 1.0f : d + 0.5f);
+                                } else {
+                                        cov = d >= 0 ? 1.0f : 0.0f;
+                                }
+                        }
+                        if (cov > 0) {
+                                uint8_t coverage = (uint8_t)(cov * 255.0f + 0.5f);
+
+                                if (coverage) {
+                                        shade_pixel(r, px, py, coverage);
+                                }
+                        }
+                }
+        }
+}
+
+static void raster_quad(sim_raster_t *r, sim_device_t *dev, const sim_context_t *ctx, const d2_s32 *p)
+{
+        float pts[8];
+
+        for (int i = 0; i < 8; i++) {
+                pts[i] = p[i] / 16.0f;
+        }
+        raster_polygon(r, dev, ctx, pts, 4);
+}
+
+static float clamp_coverage(float d)
+{
+        return d <= -0.5f ? 0.0f : (d >= 0.5f ? 1.0f : d + 0.5f);
+}
+
+/*
+ * Circle of radius 'r', or ring of the radii [r - w, r + w] for w > 0; a wedge is cut out of it by
+ * two edges through the center
+ */
+static void raster_circle(sim_raster_t *r, sim_device_t *dev, const sim_context_t *ctx, const d2_s32 *p,
+        bool wedge)
+{
+        float cx = p[0] / 16.0f, cy = p[1] / 16.0f, rad = p[2] / 16.0f, w = p[3] / 16.0f;
+        float outer = w > 0 ? rad + w : rad, inner = rad - w;
+        float n[2][2] = { { 0 } };
+        bool concave = false;
+        int xmin, ymin, xmax, ymax;
+
+        if (outer <= 0) {
+                return;
+        }
+        if (wedge) {
+                for (int i = 0; i < 2; i++) {
+                        float nx = (float)p[4 + i * 2], ny = (float)p[5 + i * 2], len = sqrtf(nx * nx + ny * ny);
+
+                        if (len == 0) {
+                                return;
+                        }
+                        n[i][0] = nx / len;
+                        n[i][1] = ny / len;
+                }
+                concave = (p[8] & d2_wf_concave) != 0;
+        }
+
+        xmin = (int)floorf(cx - outer);
+        ymin = (int)floorf(cy - outer);
+        xmax = (int)ceilf(cx + outer) - 1;
+        ymax = (int)ceilf(cy + outer) - 1;
+        if (!raster_begin(r, dev, ctx, &xmin, &ymin, &xmax, &ymax)) {
+                return;
+        }
+
+        for (int py = ymin; py <= ymax; py++) {
+                for (int px = xmin; px <= xmax; px++) {
+                        float dx = px + 0.5f - cx, dy = py + 0.5f - cy, d = sqrtf(dx * dx + dy * dy);
+                        float cov = clamp_coverage(outer - d);
+
+                        r->stats.scanned++;
+                        if (w > 0) {
+                                cov = fminf(cov, clamp_coverage(d - inner));
+                        }
+                        if (wedge && cov > 0) {
+                                float c1 = clamp_coverage(dx * n[0][0] + dy * n[0][1]);
+                                float c2 = clamp_coverage(dx * n[1][0] + dy * n[1][1]);
+
+                                cov *= concave ? fmaxf(c1, c2) : c1 * c2;
+                        }
+                        if (!ctx->antialiasing) {
+                                cov = cov >= 0.5f ? 1.0f : 0.0f;
+                        }
+                        if (cov > 0) {
+                                uint8_t coverage = (uint8_t)(cov * 255.0f + 0.5f);
+
+                                if (coverage) {
+                                        shade_pixel(r, px, py, coverage);
+                                }
+                        }
+                }
+        }
+}
+
+/* Lines are rendered as a quad of the line width around the segment, with butt caps */
+static void raster_line(sim_raster_t *r, sim_device_t *dev, const sim_context_t *ctx, const d2_s32 *p)
+{
+        float x1 = p[0] / 16.0f, y1 = p[1] / 16.0f, x2 = p[2] / 16.0f, y2 = p[3] / 16.0f;
+        float dx = x2 - x1, dy = y2 - y1, len = sqrtf(dx * dx + dy * dy);
+        float nx, ny, pts[8];
+
+        if (len == 0 || p[4] <= 0) {
+                return;
+        }
+        nx = -dy / len * (p[4] / 32.0f);
+        ny = dx / len * (p[4] / 32.0f);
+
+        pts[0] = x1 + nx; pts[1] = y1 + ny;
+        pts[2] = x2 + nx; pts[3] = y2 + ny;
+        pts[4] = x2 - nx; pts[5] = y2 - ny;
+        pts[6] = x1 - nx; pts[7] = y1 - ny;
+        raster_polygon(r, dev, ctx, pts, 4);
+}
+
+/* A blit is a textured box with a mapping derived from the source and destination rectangles */
+static void raster_blit(sim_raster_t *r, sim_device_t *dev, const sim_context_t *blit_ctx, const d2_s32 *p)
+{
+        sim_context_t ctx = *blit_ctx;
+        d2_s32 srcw = p[0], srch = p[1], srcx = p[2], srcy = p[3];
+        d2_s32 dstw = p[4], dsth = p[5], dstx = p[6], dsty = p[7];
+        d2_u32 flags = p[8];
+        d2_s32 half = (flags & d2_bf_filter) ? 0x8000 : 0;
+        uint8_t cmode = d2_to_copy;
+
+        if (srcw <= 0 || srch <= 0 || dstw <= 0 || dsth <= 0) {
+                return;
+        }
+
+        ctx.fillmode = d2_fm_texture;
+        ctx.tex = ctx.blit_src;
+        ctx.texmode = flags & (d2_bf_filter | d2_bf_wrap);
+        ctx.tex_x = dstx;
+        ctx.tex_y = dsty;
+        ctx.texel_cx = ctx.texel_cy = 0;
+
+        ctx.dxu = (d2_s32)(((int64_t)srcw << 20) / dstw);
+        ctx.dyv = (d2_s32)(((int64_t)srch << 20) / dsth);
+        ctx.dyu = ctx.dxv = 0;
+        ctx.u0 = (srcx << 16) - half;
+        ctx.v0 = (srcy << 16) - half;
+        if (flags & d2_bf_mirroru) {
+                ctx.u0 = ((srcx + srcw) << 16) - 1 - half;
+                ctx.dxu = -ctx.dxu;
+        }
+        if (flags & d2_bf_mirrorv) {
+                ctx.v0 = ((srcy + srch) << 16) - 1 - half;
+                ctx.dyv = -ctx.dyv;
+        }
+
+        ctx.texop[0] = (flags & d2_bf_usealpha) ? d2_to_copy : d2_to_one;
+        if ((flags & d2_bf_invertalpha) && (flags & d2_bf_usealpha)) {
+                ctx.texop[0] = d2_to_invert;
+        }
+
+        if (flags & d2_bf_colorize2) {
+                cmode = d2_to_blend;
+        } else if (flags & d2_bf_colorize) {
+                cmode = d2_to_multiply;
+        }
+        for (int i = 1; i < 4; i++) {
+                int shift = 24 - i * 8;
+
+                ctx.texop[i] = cmode;
+                ctx.texop_p1[i] = (uint8_t)(ctx.color[0] >> shift);
+                ctx.texop_p2[i] = (uint8_t)(ctx.color[1] >> shift);
+        }
+
+        raster_box(r, dev, &ctx, dstx, dsty, dstw, dsth);
+}
+
+static uint32_t estimate_cycles(const sim_stats_t *s)
+{
+        uint32_t bytes = s->fb_read_bytes + s->fb_write_bytes + s->tex_read_bytes;
+        uint32_t bus = (bytes + DAVE_SIM_BUS_BYTES_PER_CYCLE - 1) / DAVE_SIM_BUS_BYTES_PER_CYCLE;
+
+        /* The bus is held while the flash delivers the texture */
+        bus += s->tex_flash_bytes * DAVE_SIM_FLASH_CYCLES_PER_BYTE;
+
+        /* The pixel pipeline walks the bounding box at one pixel per cycle, covered pixels
+         * stall on the bus when their memory traffic does not fit in the same cycle */
+        return DAVE_SIM_PRIMITIVE_CYCLES + (s->scanned - s->covered) + MAX(s->covered, bus);
+}
+
+static void count_perf(sim_device_t *dev, const sim_stats_t *s, uint32_t cycles)
+{
+        total_cycles += cycles;
+
+        for (int i = 0; i < DAVE_SIM_PERF_COUNTERS; i++) {
+                switch (dev->perf_event[i]) {
+                case d2_pc_davecycles:
+                case d2_pc_clkcycles:
+                        dev->perf_value[i] += cycles;
+                        break;
+                case d2_pc_fbreads:
+                        dev->perf_value[i] += s->fb_read_bytes / 4;
+                        break;
+                case d2_pc_fbwrites:
+                        dev->perf_value[i] += s->fb_write_bytes / 4;
+                        break;
+                case d2_pc_texreads:
+                        dev->perf_value[i] += (s->tex_read_bytes + s->tex_flash_bytes) / 4;
+                        break;
+                case d2_pc_invpixels:
+                        dev->perf_value[i] += s->covered;
+                        break;
+                default:
+                        break;
+                }
+        }
+}
+
+static void execute_command(sim_device_t *dev, const sim_command_t *cmd)
+{
+        sim_raster_t r;
+
+        memset(&r, 0, sizeof(r));
+
+        switch (cmd->type) {
+        case SIM_CMD_BOX:
+                raster_box(&r, dev, &cmd->ctx, cmd->param[0], cmd->param[1], cmd->param[2], cmd->param[3]);
+                break;
+        case SIM_CMD_LINE:
+                raster_line(&r, dev, &cmd->ctx, cmd->param);
+                break;
+        case SIM_CMD_QUAD:
+                raster_quad(&r, dev, &cmd->ctx, cmd->param);
+                break;
+        case SIM_CMD_CIRCLE:
+                raster_circle(&r, dev, &cmd->ctx, cmd->param, false);
+                break;
+        case SIM_CMD_WEDGE:
+                raster_circle(&r, dev, &cmd->ctx, cmd->param, true);
+                break;
+        case SIM_CMD_BLIT:
+                raster_blit(&r, dev, &cmd->ctx, cmd->param);
+                break;
+        }
+
+        /* The RLE unit fetches the compressed texture */
+        if (r.tex_size) {
+                r.stats.tex_read_bytes = (uint64_t)r.stats.tex_read_bytes * r.tex_packed / r.tex_size;
+        }
+        if (r.tex_flash) {
+                r.stats.tex_flash_bytes = r.stats.tex_read_bytes;
+                r.stats.tex_read_bytes = 0;
+        }
+
+        count_perf(dev, &r.stats, estimate_cycles(&r.stats));
+}
+
+static void execute_buffer(sim_device_t *dev, sim_renderbuffer_t *rb)
+{
+        sim_stats_t none = { 0 };
+
+        if (!rb->count) {
+                return;
+        }
+
+        count_perf(dev, &none, DAVE_SIM_EXECUTE_CYCLES);
+
+        /* Textures may have been rewritten since the previous execution */
+        dev->rle_src = NULL;
+
+        for (size_t i = 0; i < rb->count; i++) {
+                execute_command(dev, &rb->cmd[i]);
+        }
+}
+
+static d2_s32 add_command(d2_device *handle, SIM_CMD type, const d2_s32 *param, int count)
+{
+        sim_device_t *dev = handle;
+        sim_renderbuffer_t *rb;
+        sim_command_t *cmd;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        rb = dev->selected;
+        if (rb->count == rb->size) {
+                size_t size = rb->size + rb->step;
+                sim_command_t *p = realloc(rb->cmd, size * sizeof(*p));
+
+                if (!p) {
+                        return set_error(dev, D2_NOMEMORY);
+                }
+                rb->cmd = p;
+                rb->size = size;
+        }
+
+        cmd = &rb->cmd[rb->count++];
+        cmd->type = type;
+        memcpy(cmd->param, param, count * sizeof(*param));
+        cmd->ctx = dev->ctx;
+
+        return set_error(dev, D2_OK);
+}
+
+static void set_surface(sim_surface_t *s, void *ptr, d2_s32 pitch, d2_u32 width, d2_u32 height, d2_u32 format)
+{
+        s->ptr = ptr;
+        s->pitch = pitch;
+        s->width = width;
+        s->height = height;
+        s->format = format;
+}
+
+static void context_init(sim_context_t *ctx)
+{
+        memset(ctx, 0, sizeof(*ctx));
+        ctx->alpha = 0xFF;
+        ctx->blend_src = d2_bm_alpha;
+        ctx->blend_dst = d2_bm_one_minus_alpha;
+        ctx->alpha_blend_src = d2_bm_one;
+        ctx->alpha_blend_dst = d2_bm_one_minus_alpha;
+        ctx->fillmode = d2_fm_color;
+        ctx->antialiasing = true;
+        ctx->clip_xmax = ctx->clip_ymax = 0x7FFF;
+        ctx->texop[0] = ctx->texop[1] = ctx->texop[2] = ctx->texop[3] = d2_to_copy;
+        ctx->dxu = ctx->dyv = 1 << 16;
+}
+
+static void renderbuffer_init(sim_renderbuffer_t *rb, d2_u32 initialsize, d2_u32 stepsize)
+{
+        memset(rb, 0, sizeof(*rb));
+        rb->step = stepsize ? stepsize : 16;
+        rb->cmd = calloc(initialsize ? initialsize : rb->step, sizeof(*rb->cmd));
+        rb->size = rb->cmd ? (initialsize ? initialsize : rb->step) : 0;
+}
+
+/**********************************************************************
+ *
+ *       Public code
+ *
+ **********************************************************************
+ */
+uint64_t dave_sim_get_cycles(void)
+{
+        return total_cycles;
+}
+
+void dave_sim_set_flash(const void *base, size_t size)
+{
+        flash_base = base;
+        flash_size = size;
+}
+
+d2_device *d2_opendevice(d2_u32 flags)
+{
+        sim_device_t *dev = calloc(1, sizeof(*dev));
+
+        (void)flags;
+
+        if (!dev) {
+                return NULL;
+        }
+
+        context_init(&dev->ctx);
+        renderbuffer_init(&dev->default_buffer, 16, 16);
+        dev->selected = &dev->default_buffer;
+
+        return dev;
+}
+
+d2_s32 d2_closedevice(d2_device *handle)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        free(dev->default_buffer.cmd);
+        free(dev->rle_buf);
+        free(dev);
+
+        return D2_OK;
+}
+
+d2_s32 d2_geterror(const d2_device *handle)
+{
+        const sim_device_t *dev = handle;
+
+        return dev ? dev->error : D2_INVALIDDEVICE;
+}
+
+const d2_char *d2_geterrorstring(const d2_device *handle)
+{
+        d2_s32 error = d2_geterror(handle);
+
+        return error >= 0 && error < D2_ERROR_QUANTITY ? error_strings[error] : "unknown error";
+}
+
+d2_s32 d2_inithw(d2_device *handle, d2_u32 flags)
+{
+        (void)flags;
+
+        return handle ? set_error(handle, D2_OK) : D2_INVALIDDEVICE;
+}
+
+d2_s32 d2_inithwburstlengthlimit(d2_device *handle, d2_busburstlength burstlengthFBread,
+        d2_busburstlength burstlengthFBwrite, d2_busburstlength burstlengthTX, d2_busburstlength burstlengthDL)
+{
+        (void)burstlengthFBread;
+        (void)burstlengthFBwrite;
+        (void)burstlengthTX;
+        (void)burstlengthDL;
+
+        return handle ? set_error(handle, D2_OK) : D2_INVALIDDEVICE;
+}
+
+d1_device *d2_level1interface(const d2_device *handle)
+{
+        return handle ? &level1_device : NULL;
+}
+
+d2_s32 d2_setdlistblocksize(d2_device *handle, d2_u32 size)
+{
+        if (!handle) {
+                return D2_INVALIDDEVICE;
+        }
+        return set_error(handle, size ? D2_OK : D2_VALUETOOSMALL);
+}
+
+d2_s32 d2_framebuffer(d2_device *handle, void *ptr, d2_s32 pitch, d2_u32 width, d2_u32 height, d2_s32 format)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (!ptr) {
+                return set_error(dev, D2_NOVIDEOMEM);
+        }
+        if (!width || pitch < (d2_s32)width) {
+                return set_error(dev, D2_INVALIDWIDTH);
+        }
+        if (!height) {
+                return set_error(dev, D2_INVALIDHEIGHT);
+        }
+        if (!format_is_fb(format)) {
+                return set_error(dev, D2_ILLEGALMODE);
+        }
+
+        set_surface(&dev->ctx.fb, ptr, pitch, width, height, format);
+        dev->ctx.clip_xmin = dev->ctx.clip_ymin = 0;
+        dev->ctx.clip_xmax = width - 1;
+        dev->ctx.clip_ymax = height - 1;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_cliprect(d2_device *handle, d2_border xmin, d2_border ymin, d2_border xmax, d2_border ymax)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        dev->ctx.clip_xmin = xmin;
+        dev->ctx.clip_ymin = ymin;
+        dev->ctx.clip_xmax = xmax;
+        dev->ctx.clip_ymax = ymax;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_flushframe(d2_device *handle)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        /* Primitives are rendered synchronously, only the default buffer may still be pending */
+        execute_buffer(dev, &dev->default_buffer);
+        dev->default_buffer.count = 0;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_renderbuffer *d2_newrenderbuffer(d2_device *handle, d2_u32 initialsize, d2_u32 stepsize)
+{
+        sim_renderbuffer_t *rb;
+
+        if (!handle) {
+                return NULL;
+        }
+
+        rb = malloc(sizeof(*rb));
+        if (rb) {
+                renderbuffer_init(rb, initialsize, stepsize);
+        }
+        set_error(handle, rb ? D2_OK : D2_NOMEMORY);
+
+        return rb;
+}
+
+d2_s32 d2_freerenderbuffer(d2_device *handle, d2_renderbuffer *buffer)
+{
+        sim_device_t *dev = handle;
+        sim_renderbuffer_t *rb = buffer;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (!rb || rb == &dev->default_buffer) {
+                return set_error(dev, D2_INVALIDBUFFER);
+        }
+
+        if (dev->selected == rb) {
+                dev->selected = &dev->default_buffer;
+        }
+        free(rb->cmd);
+        free(rb);
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_selectrenderbuffer(d2_device *handle, d2_renderbuffer *buffer)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        dev->selected = buffer ? buffer : &dev->default_buffer;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_executerenderbuffer(d2_device *handle, d2_renderbuffer *buffer, d2_u32 flags)
+{
+        sim_device_t *dev = handle;
+        sim_renderbuffer_t *rb = buffer;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (!rb) {
+                return set_error(dev, D2_INVALIDBUFFER);
+        }
+
+        execute_buffer(dev, rb);
+        if (!(flags & d2_ef_execute_multiple)) {
+                rb->count = 0;
+        }
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_setcolor(d2_device *handle, d2_s32 index, d2_color color)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (index < 0 || index > 1) {
+                return set_error(dev, D2_INVALIDINDEX);
+        }
+
+        dev->ctx.color[index] = color;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_color d2_getcolor(d2_device *handle, d2_s32 index)
+{
+        sim_device_t *dev = handle;
+
+        return (dev && index >= 0 && index <= 1) ? dev->ctx.color[index] : 0;
+}
+
+d2_s32 d2_setalpha(d2_device *handle, d2_alpha alpha)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        dev->ctx.alpha = alpha;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_setblendmode(d2_device *handle, d2_u32 srcfactor, d2_u32 dstfactor)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (srcfactor > d2_bm_one_minus_alpha || dstfactor > d2_bm_one_minus_alpha) {
+                return set_error(dev, D2_INVALIDENUM);
+        }
+
+        dev->ctx.blend_src = srcfactor;
+        dev->ctx.blend_dst = dstfactor;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_setalphablendmode(d2_device *handle, d2_u32 srcfactor, d2_u32 dstfactor)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (srcfactor > d2_bm_one_minus_alpha || dstfactor > d2_bm_one_minus_alpha) {
+                return set_error(dev, D2_INVALIDENUM);
+        }
+
+        dev->ctx.alpha_blend_src = srcfactor;
+        dev->ctx.alpha_blend_dst = dstfactor;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_setantialiasing(d2_device *handle, d2_s32 enable)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        dev->ctx.antialiasing = enable != 0;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_setfillmode(d2_device *handle, d2_u32 mode)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (mode > d2_fm_texture) {
+                return set_error(dev, D2_INVALIDENUM);
+        }
+        if (mode != d2_fm_color && mode != d2_fm_texture) {
+                /* Two color and pattern fills are not used by the port */
+                return set_error(dev, D2_ILLEGALMODE);
+        }
+
+        dev->ctx.fillmode = mode;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_u8 d2_getfillmode(d2_device *handle)
+{
+        sim_device_t *dev = handle;
+
+        return dev ? (d2_u8)dev->ctx.fillmode : 0;
+}
+
+d2_s32 d2_settexture(d2_device *handle, void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (!ptr) {
+                return set_error(dev, D2_NULLPOINTER);
+        }
+        if (width <= 0 || pitch < width) {
+                return set_error(dev, D2_INVALIDWIDTH);
+        }
+        if (height <= 0) {
+                return set_error(dev, D2_INVALIDHEIGHT);
+        }
+        if (!format_bpp(format)) {
+                return set_error(dev, D2_ILLEGALMODE);
+        }
+
+        set_surface(&dev->ctx.tex, ptr, pitch, width, height, format);
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_settexturemode(d2_device *handle, d2_u32 mode)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        dev->ctx.texmode = mode;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_settextureoperation(d2_device *handle, d2_u8 amode, d2_u8 rmode, d2_u8 gmode, d2_u8 bmode)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (amode > d2_to_blend || rmode > d2_to_blend || gmode > d2_to_blend || bmode > d2_to_blend) {
+                return set_error(dev, D2_INVALIDENUM);
+        }
+
+        dev->ctx.texop[0] = amode;
+        dev->ctx.texop[1] = rmode;
+        dev->ctx.texop[2] = gmode;
+        dev->ctx.texop[3] = bmode;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_settexopparam(d2_device *handle, d2_u32 index, d2_u32 p1, d2_u32 p2)
+{
+        sim_device_t *dev = handle;
+        static const d2_u32 channel[4] = { d2_cc_alpha, d2_cc_red, d2_cc_green, d2_cc_blue };
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (!index || (index & ~d2_cc_all)) {
+                return set_error(dev, D2_INVALIDINDEX);
+        }
+
+        for (int i = 0; i < 4; i++) {
+                if (index & channel[i]) {
+                        dev->ctx.texop_p1[i] = (uint8_t)p1;
+                        dev->ctx.texop_p2[i] = (uint8_t)p2;
+                }
+        }
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_settexturemapping(d2_device *handle, d2_point x, d2_point y, d2_s32 u0, d2_s32 v0,
+        d2_s32 dxu, d2_s32 dyu, d2_s32 dxv, d2_s32 dyv)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        dev->ctx.tex_x = x;
+        dev->ctx.tex_y = y;
+        dev->ctx.u0 = u0;
+        dev->ctx.v0 = v0;
+        dev->ctx.dxu = dxu;
+        dev->ctx.dyu = dyu;
+        dev->ctx.dxv = dxv;
+        dev->ctx.dyv = dyv;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_settexelcenter(d2_device *handle, d2_point x, d2_point y)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        dev->ctx.texel_cx = x;
+        dev->ctx.texel_cy = y;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_settexclut(d2_device *handle, d2_color *clut)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        dev->ctx.clut = clut;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_writetexclut_direct(d2_device *handle, const d2_color *clut_part, d2_u32 start_index, d2_u32 length)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (!clut_part) {
+                return set_error(dev, D2_NULLPOINTER);
+        }
+        if (start_index + length > DAVE_SIM_CLUT_SIZE) {
+                return set_error(dev, D2_INVALIDINDEX);
+        }
+
+        /* Written to the CLUT RAM immediately, not through the display list */
+        memcpy(&dev->clut[start_index], clut_part, length * sizeof(*clut_part));
+        dev->ctx.clut = NULL;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_setcolorkey(d2_device *handle, d2_s32 enable, d2_color color_key)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+
+        dev->ctx.colorkey_enable = enable != 0;
+        dev->ctx.colorkey = color_key;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_setblitsrc(d2_device *handle, void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (!ptr) {
+                return set_error(dev, D2_NULLPOINTER);
+        }
+        if (width <= 0 || pitch < width) {
+                return set_error(dev, D2_INVALIDWIDTH);
+        }
+        if (height <= 0) {
+                return set_error(dev, D2_INVALIDHEIGHT);
+        }
+        if (!format_bpp(format)) {
+                return set_error(dev, D2_ILLEGALMODE);
+        }
+
+        set_surface(&dev->ctx.blit_src, ptr, pitch, width, height, format);
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_renderbox(d2_device *handle, d2_point x1, d2_point y1, d2_width w, d2_width h)
+{
+        const d2_s32 param[] = { x1, y1, w, h };
+
+        return add_command(handle, SIM_CMD_BOX, param, 4);
+}
+
+d2_s32 d2_renderline(d2_device *handle, d2_point x1, d2_point y1, d2_point x2, d2_point y2, d2_width w, d2_u32 flags)
+{
+        const d2_s32 param[] = { x1, y1, x2, y2, w, flags };
+
+        return add_command(handle, SIM_CMD_LINE, param, 6);
+}
+
+d2_s32 d2_renderquad(d2_device *handle, d2_point x1, d2_point y1, d2_point x2, d2_point y2, d2_point x3,
+        d2_point y3, d2_point x4, d2_point y4, d2_u32 flags)
+{
+        const d2_s32 param[] = { x1, y1, x2, y2, x3, y3, x4, y4, flags };
+
+        return add_command(handle, SIM_CMD_QUAD, param, 9);
+}
+
+d2_s32 d2_rendercircle(d2_device *handle, d2_point x, d2_point y, d2_width r, d2_width w)
+{
+        const d2_s32 param[] = { x, y, r, w };
+
+        return add_command(handle, SIM_CMD_CIRCLE, param, 4);
+}
+
+d2_s32 d2_renderwedge(d2_device *handle, d2_point x, d2_point y, d2_width r, d2_width w, d2_s32 nx1, d2_s32 ny1,
+        d2_s32 nx2, d2_s32 ny2, d2_u32 flags)
+{
+        const d2_s32 param[] = { x, y, r, w, nx1, ny1, nx2, ny2, flags };
+
+        return add_command(handle, SIM_CMD_WEDGE, param, 9);
+}
+
+d2_s32 d2_blitcopy(d2_device *handle, d2_s32 srcwidth, d2_s32 srcheight, d2_blitpos srcx, d2_blitpos srcy,
+        d2_width dstwidth, d2_width dstheight, d2_point dstx, d2_point dsty, d2_u32 flags)
+{
+        const d2_s32 param[] = { srcwidth, srcheight, srcx, srcy, dstwidth, dstheight, dstx, dsty, flags };
+        sim_device_t *dev = handle;
+
+        if (dev && !dev->ctx.blit_src.ptr) {
+                return set_error(dev, D2_NULLPOINTER);
+        }
+
+        return add_command(handle, SIM_CMD_BLIT, param, 9);
+}
+
+d2_s32 d2_setperfcountevent(d2_device *handle, d2_u32 counter, d2_u32 event)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (counter >= DAVE_SIM_PERF_COUNTERS) {
+                return set_error(dev, D2_INVALIDINDEX);
+        }
+
+        dev->perf_event[counter] = event;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_s32 d2_setperfcountvalue(d2_device *handle, d2_u32 counter, d2_slong value)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev) {
+                return D2_INVALIDDEVICE;
+        }
+        if (counter >= DAVE_SIM_PERF_COUNTERS) {
+                return set_error(dev, D2_INVALIDINDEX);
+        }
+
+        dev->perf_value[counter] = value;
+
+        return set_error(dev, D2_OK);
+}
+
+d2_slong d2_getperfcountvalue(d2_device *handle, d2_u32 counter)
+{
+        sim_device_t *dev = handle;
+
+        if (!dev || counter >= DAVE_SIM_PERF_COUNTERS) {
+                return 0;
+        }
+
+        return dev->perf_value[counter];
+}
+
+void *d1_maptovidmem(d1_device *handle, void *ptr)
+{
+        /* The GPU shares the host address space */
+        (void)handle;
+
+        return ptr;
+}
+
+unsigned long d1_deviceclkfreq(d1_device *handle, int deviceid)
+{
+        (void)handle;
+        (void)deviceid;
+
+        return DAVE_SIM_CLOCK_HZ;
+}
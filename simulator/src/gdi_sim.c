@@ -0,0 +1,955 @@
+/**
+ * \addtogroup UI
+ * \{
+ * \addtogroup GDI
+ * \{
+ */
+/**
+ ****************************************************************************************
+ *
+ * @file gdi_sim.c
+ *
+ * @brief Basic graphic functions implementation for the host simulator
+ *
+ * Implements the GDI API on top of in-memory frame buffers. A "GDI_task" thread plays the
+ * role of the LCD controller: on every display update it composes the enabled layers of the
+ * partial update area into a virtual panel, optionally holding the frame for the time the
+ * transfer would take over the panel interface, and then completes the request exactly like
+ * the target implementation does. The panel emits a tearing effect (TE) pulse every
+ * GDI_TE_PERIOD_US and the first area of a frame is held until the next one, as the LCDC does
+ * when the TE input is enabled.
+ *
+ * Copyright (C) 2020-2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+
+#if dg_configLCDC_ADAPTER
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gdi.h"
+#include "gdi_sim.h"
+#include "osal.h"
+
+#include "touch_simulation.h"
+#ifdef PERFORMANCE_METRICS
+#include "metrics.h"
+#endif
+
+/**********************************************************************
+ *
+ *       Defines
+ *
+ **********************************************************************
+ */
+/* Notification bit-masks */
+#define DEV_DRAW_ASYNC_EVT                      (1 << 0)
+#define DEV_TOUCH_EVT                           (1 << 2)
+
+#ifndef GDI_CONSOLE_LOG
+#define GDI_CONSOLE_LOG                         (0)
+#endif
+
+#ifndef GDI_DISP_OFFSETX
+#define GDI_DISP_OFFSETX                        (0)
+#endif
+
+#ifndef GDI_DISP_OFFSETY
+#define GDI_DISP_OFFSETY                        (0)
+#endif
+
+#ifndef SIM_DISPLAY_LINK_RATE
+#define SIM_DISPLAY_LINK_RATE                   (24000000)
+#endif
+
+/* The virtual panel always stores RGB565 pixels */
+#define PANEL_COLOR_BYTES                       (2)
+
+/**********************************************************************
+ *
+ *       Static data
+ *
+ **********************************************************************
+ */
+PRIVILEGED_DATA static uint8_t frame_buffer[GDI_FB_RESX * GDI_FB_RESY * GDI_COLOR_BYTES * GDI_SINGLE_FB_NUM * HW_LCDC_LAYER_MAX];
+PRIVILEGED_DATA static uint32_t gui_heap_area[GDI_GUI_HEAP_SIZE / sizeof(uint32_t)];
+
+PRIVILEGED_DATA static gdi_t *gdi;
+PRIVILEGED_DATA static OS_TASK task_h;
+
+/* Layer settings latched by the virtual LCD controller */
+PRIVILEGED_DATA static hw_lcdc_layer_t active_layer[HW_LCDC_LAYER_MAX];
+PRIVILEGED_DATA static bool active_layer_enable[HW_LCDC_LAYER_MAX];
+PRIVILEGED_DATA static uint16_t panel[GDI_DISP_RESX * GDI_DISP_RESY];
+
+PRIVILEGED_DATA static FILE *frame_log;
+PRIVILEGED_DATA static FILE *heap_map;
+INITIALISED_PRIVILEGED_DATA static bool link_emulation = true;
+PRIVILEGED_DATA static uint32_t frame_count;
+PRIVILEGED_DATA static int frame_link_duration_us;
+PRIVILEGED_DATA static int frame_gpu_duration_us;
+
+PRIVILEGED_DATA static uint64_t frame_render_op_start, frame_render_op_end, frame_render_start, frame_render_end, frame_transfer_start, frame_transfer_end;
+PRIVILEGED_DATA static int frame_render_op_duration_us, frame_render_duration_us, frame_transfer_duration_us, frame_total_duration_us;
+PRIVILEGED_DATA static int frame_overlap_duration_us;
+PRIVILEGED_DATA static int frame_flushes_saved, frame_pixels_saved;
+PRIVILEGED_DATA static int frame_buf_allocs, frame_gui_heap_used, frame_gui_heap_frag, frame_gui_heap_biggest;
+PRIVILEGED_DATA static int frame_fb_sync_bytes;
+PRIVILEGED_DATA static int frame_te_periods, frame_te_drops;
+PRIVILEGED_DATA static bool transfer_last, frame_started;
+PRIVILEGED_DATA static int pixel_count, render_count;
+
+#ifdef PERFORMANCE_METRICS
+extern volatile uint8_t current_tag;
+#endif
+
+/**********************************************************************
+ *
+ *       Static code
+ *
+ **********************************************************************
+ */
+static void console_log(void)
+{
+        uint8_t tag = 0;
+
+        if (!transfer_last) {
+                return;
+        }
+
+#ifdef PERFORMANCE_METRICS
+        METRICS metrics;
+
+        metrics = get_metrics_data();
+
+        metrics.fps = frame_total_duration_us ? 10000000UL / frame_total_duration_us : 0;
+        metrics.frame_time = frame_total_duration_us;
+        metrics.frame_rendering_time = frame_render_duration_us;
+        metrics.display_transfer_time = frame_transfer_duration_us;
+        metrics.overlap_time = frame_overlap_duration_us;
+        metrics.pixel_count = pixel_count;
+        metrics.flushes_saved = frame_flushes_saved;
+        metrics.pixels_saved = frame_pixels_saved;
+        metrics.buf_heap_allocs = frame_buf_allocs;
+        metrics.gui_heap_used = frame_gui_heap_used;
+        metrics.gui_heap_frag = frame_gui_heap_frag;
+        metrics.gui_heap_biggest = frame_gui_heap_biggest;
+        metrics.fb_sync_bytes = frame_fb_sync_bytes;
+        metrics.te_periods = frame_te_periods;
+        metrics.te_drops = frame_te_drops;
+        metrics_add(&metrics);
+
+        tag = current_tag;
+#endif
+
+        if (frame_log) {
+                fprintf(frame_log, "%u,%llu,%u,%d,%d,%d,%d,%d,%d,%d,%d,%d\n", frame_count,
+                        (unsigned long long)frame_transfer_end, tag, frame_render_duration_us,
+                        frame_transfer_duration_us, frame_link_duration_us,
+                        frame_total_duration_us, pixel_count, frame_gpu_duration_us,
+                        frame_overlap_duration_us, frame_flushes_saved, frame_pixels_saved);
+        }
+
+        /* Clear variables */
+        frame_render_duration_us = frame_transfer_duration_us = frame_total_duration_us = 0;
+        frame_link_duration_us = frame_gpu_duration_us = frame_overlap_duration_us = 0;
+        frame_flushes_saved = frame_pixels_saved = 0;
+        frame_buf_allocs = frame_gui_heap_used = frame_gui_heap_frag = frame_gui_heap_biggest = 0;
+        frame_fb_sync_bytes = 0;
+        frame_te_periods = frame_te_drops = 0;
+        pixel_count = 0;
+}
+
+static inline uint16_t rgb888_to_rgb565(uint8_t r, uint8_t g, uint8_t b)
+{
+        return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+/* Fetch a layer pixel as RGB565 plus its alpha value */
+static uint16_t layer_fetch(const hw_lcdc_layer_t *layer, int x, int y, uint8_t *alpha)
+{
+        const uint8_t *line = (const uint8_t *)layer->baseaddr + y * layer->stride;
+        uint32_t c;
+        uint8_t r, g, b;
+
+        *alpha = 0xFF;
+
+        switch (layer->format) {
+        case HW_LCDC_LCM_RGB332:
+                c = line[x];
+                r = (c & 0xE0) | ((c & 0xE0) >> 3) | ((c & 0xE0) >> 6);
+                g = ((c & 0x1C) << 3) | (c & 0x1C) | ((c & 0x1C) >> 3);
+                b = ((c & 0x03) << 6) | ((c & 0x03) << 4) | ((c & 0x03) << 2) | (c & 0x03);
+                return rgb888_to_rgb565(r, g, b);
+        case HW_LCDC_LCM_RGB565:
+                return ((const uint16_t *)line)[x];
+        case HW_LCDC_LCM_ARGB8888:
+                c = ((const uint32_t *)line)[x];
+                *alpha = c >> 24;
+                return rgb888_to_rgb565(c >> 16, c >> 8, c);
+        case HW_LCDC_LCM_RGBA8888:
+                c = ((const uint32_t *)line)[x];
+                *alpha = c;
+                return rgb888_to_rgb565(c >> 24, c >> 16, c >> 8);
+        default:
+                OS_ASSERT(0);
+                return 0;
+        }
+}
+
+static inline uint16_t rgb565_mix(uint16_t fg, uint16_t bg, uint8_t mix)
+{
+        uint32_t r = (((fg >> 11) & 0x1F) * mix + ((bg >> 11) & 0x1F) * (255 - mix)) / 255;
+        uint32_t g = (((fg >> 5) & 0x3F) * mix + ((bg >> 5) & 0x3F) * (255 - mix)) / 255;
+        uint32_t b = ((fg & 0x1F) * mix + (bg & 0x1F) * (255 - mix)) / 255;
+
+        return (r << 11) | (g << 5) | b;
+}
+
+/* Compose the enabled layers of the given frame into the virtual panel, as the LCDC does */
+static void dev_compose(const hw_lcdc_frame_t *frame)
+{
+        for (int y = frame->starty; y <= frame->endy && y < GDI_DISP_RESY; y++) {
+                uint16_t *dst = &panel[y * GDI_DISP_RESX];
+
+                for (int x = frame->startx; x <= frame->endx && x < GDI_DISP_RESX; x++) {
+                        dst[x] = 0;
+                }
+
+                for (HW_LCDC_LAYER layer_no = 0; layer_no < HW_LCDC_LAYER_MAX; layer_no++) {
+                        const hw_lcdc_layer_t *layer = &active_layer[layer_no];
+                        int ly = y - layer->starty;
+                        int x0, x1;
+
+                        if (!active_layer_enable[layer_no] || !layer->baseaddr
+                                || ly < 0 || ly >= layer->resy) {
+                                continue;
+                        }
+
+                        x0 = MAX((int)frame->startx, layer->startx);
+                        x1 = MIN((int)MIN(frame->endx, GDI_DISP_RESX - 1), layer->startx + layer->resx - 1);
+                        if (x0 > x1) {
+                                continue;
+                        }
+
+                        if (layer->format == HW_LCDC_LCM_RGB565 && layer->blendmode == HW_LCDC_BL_SRC) {
+                                memcpy(&dst[x0], (const uint8_t *)layer->baseaddr + ly * layer->stride
+                                        + (x0 - layer->startx) * sizeof(uint16_t), (x1 - x0 + 1) * sizeof(uint16_t));
+                                continue;
+                        }
+
+                        for (int x = x0; x <= x1; x++) {
+                                uint8_t alpha;
+                                uint16_t c = layer_fetch(layer, x - layer->startx, ly, &alpha);
+
+                                if (layer->blendmode == HW_LCDC_BL_SRC) {
+                                        dst[x] = c;
+                                } else {
+                                        dst[x] = rgb565_mix(c, dst[x], (alpha * layer->alpha) / 255);
+                                }
+                        }
+                }
+        }
+}
+
+static void dev_latch_layers(void)
+{
+        for (HW_LCDC_LAYER layer_no = 0; layer_no < HW_LCDC_LAYER_MAX; layer_no++) {
+                if (gdi->layer[layer_no].layer_dirty) {
+                        gdi->layer[layer_no].layer_dirty = false;
+                        active_layer[layer_no] = gdi->layer[layer_no].layer;
+                        active_layer_enable[layer_no] = gdi->layer[layer_no].layer_enable;
+                }
+        }
+}
+
+static void dev_draw(gdi_t *gdi)
+{
+        hw_lcdc_frame_t frame = gdi->frame;
+        uint64_t start;
+        int host_us, link_us;
+
+        dev_latch_layers();
+
+        /* The other areas of the frame follow the first one right away */
+        if (link_emulation && !frame_started) {
+                os_posix_delay_us(gdi_get_te_time() + GDI_TE_PERIOD_US - gdi_get_sys_uptime_ticks());
+        }
+        frame_started = !transfer_last;
+
+        gdi_perf_transfer_start();
+        start = gdi_get_sys_uptime_ticks();
+
+        dev_compose(&frame);
+
+        host_us = gdi_convert_ticks_to_us(gdi_get_sys_uptime_ticks() - start);
+        link_us = (int)(((uint64_t)(frame.endx - frame.startx + 1)
+                * (frame.endy - frame.starty + 1) * PANEL_COLOR_BYTES * 1000000ULL) / SIM_DISPLAY_LINK_RATE);
+        frame_link_duration_us += link_us;
+
+        if (link_emulation && link_us > host_us) {
+                os_posix_delay_us(link_us - host_us);
+        }
+
+        /* The areas of a frame are transferred one after the other */
+        if (transfer_last) {
+                frame_count++;
+        }
+        gdi_perf_transfer_end();
+}
+
+static void dev_draw_async_signal(void)
+{
+        OS_EVENT_SIGNAL(gdi->draw_smphr);
+
+        if (gdi->draw_cb) {
+                draw_callback cb = gdi->draw_cb;
+                gdi->draw_cb = NULL;
+
+                cb(gdi->underflow, gdi->user_data);
+        }
+}
+
+static void dev_draw_async_evt(void)
+{
+        dev_draw(gdi);
+        dev_draw_async_signal();
+}
+
+static void dev_draw_async(draw_callback cb, void *user_data)
+{
+        OS_EVENT_WAIT(gdi->draw_smphr, OS_EVENT_FOREVER);
+
+        gdi->draw_cb = cb;
+        gdi->user_data = user_data;
+
+        OS_TASK_NOTIFY(task_h, DEV_DRAW_ASYNC_EVT, OS_NOTIFY_SET_BITS);
+}
+
+static uint32_t calc_stride(gdi_color_fmt_t format, gdi_coord_t width)
+{
+        switch (format) {
+        case GDI_FORMAT_RGB332:
+                return width;
+        case GDI_FORMAT_RGB565:
+        case GDI_FORMAT_RGBA5551:
+        case GDI_FORMAT_RGBA4444:
+        case GDI_FORMAT_ARGB4444:
+                return width * 2;
+        case GDI_FORMAT_RGB888:
+                return width * 3;
+        default:
+                return width * 4;
+        }
+}
+
+#if GDI_TOUCH_ENABLE
+static void dev_notify_touch(void)
+{
+        /* Make sure that GDI is already up and running */
+        if (task_h) {
+                OS_TASK_NOTIFY(task_h, DEV_TOUCH_EVT, OS_NOTIFY_SET_BITS);
+        }
+}
+
+static void dev_read_data_touch(void)
+{
+        gdi_touch_data_t touch_data = { 0 };
+
+#ifdef GDI_TOUCH_READ_EVENT
+        GDI_TOUCH_READ_EVENT(gdi->touch_h, &touch_data);
+#endif
+
+        /* Push touch events into the graphics buffers */
+        if (gdi->store_touch_cb) {
+                gdi->store_touch_cb(&touch_data);
+        } else {
+                /* Set a callback to store the touch events */
+                OS_ASSERT(0);
+        }
+}
+#endif /* GDI_TOUCH_ENABLE */
+
+static OS_TASK_FUNCTION(gdi_task, pvParameters)
+{
+        for (;;) {
+                OS_BASE_TYPE ret;
+                uint32_t notif;
+
+                ret = OS_TASK_NOTIFY_WAIT(0, OS_TASK_NOTIFY_ALL_BITS, &notif, OS_TASK_NOTIFY_FOREVER);
+                OS_ASSERT(ret == OS_TASK_NOTIFY_SUCCESS);
+
+                if (notif & DEV_DRAW_ASYNC_EVT) {
+                        dev_draw_async_evt();
+                }
+
+#if GDI_TOUCH_ENABLE
+                if (notif & DEV_TOUCH_EVT) {
+                        /* Read touch events */
+                        dev_read_data_touch();
+                }
+#endif /* GDI_TOUCH_ENABLE */
+        }
+}
+
+/**********************************************************************
+ *
+ *       Public code
+ *
+ **********************************************************************
+ */
+uint64_t gdi_get_sys_uptime_ticks(void)
+{
+        /* One simulator tick is one microsecond */
+        return os_posix_uptime_us();
+}
+
+uint64_t gdi_convert_ticks_to_us(uint64_t ticks)
+{
+        return ticks;
+}
+
+uint64_t gdi_get_sys_uptime_ns(void)
+{
+        return os_posix_uptime_ns();
+}
+
+uint64_t gdi_get_te_time(void)
+{
+        uint64_t now = gdi_get_sys_uptime_ticks();
+
+        /* The virtual panel runs freely since the start up */
+        return now - now % GDI_TE_PERIOD_US;
+}
+
+void gdi_perf_render_op_start(uint8_t tag)
+{
+#ifdef PERFORMANCE_METRICS
+        if (!frame_render_op_start) {
+                metrics_set_gpu_tag(tag);
+                frame_render_op_start = gdi_get_sys_uptime_ticks();
+        }
+#endif
+}
+
+void gdi_perf_render_op_end(void)
+{
+#ifdef PERFORMANCE_METRICS
+        if (frame_render_op_start) {
+                frame_render_op_end = gdi_get_sys_uptime_ticks();
+                frame_render_op_duration_us = gdi_convert_ticks_to_us(frame_render_op_end - frame_render_op_start);
+
+                metrics_gpu_add(frame_render_op_duration_us);
+                frame_render_op_start = frame_render_op_end = 0;
+        }
+#endif
+}
+
+void gdi_perf_render_op_time(int time_us, uint8_t tag)
+{
+#ifdef PERFORMANCE_METRICS
+        frame_render_op_duration_us = time_us;
+        frame_gpu_duration_us += time_us;
+
+        metrics_set_gpu_tag(tag);
+        metrics_gpu_add(frame_render_op_duration_us);
+#endif
+}
+
+void gdi_perf_render_start(void)
+{
+        if (render_count == 0) {
+                frame_render_start = gdi_get_sys_uptime_ticks();
+        }
+        render_count++;
+}
+
+void gdi_perf_render_end(void)
+{
+        render_count--;
+        if (render_count == 0) {
+                frame_render_end = gdi_get_sys_uptime_ticks();
+
+                frame_render_duration_us = gdi_convert_ticks_to_us(frame_render_end - frame_render_start);
+                frame_render_start = frame_render_end = 0;
+        }
+}
+
+void gdi_perf_render_time(int time_us)
+{
+        frame_render_duration_us = time_us;
+}
+
+void gdi_perf_overlap_time(int time_us)
+{
+        frame_overlap_duration_us = time_us;
+}
+
+void gdi_perf_refr_saved(int flushes, int pixels)
+{
+        frame_flushes_saved = flushes;
+        frame_pixels_saved = pixels;
+}
+
+void gdi_perf_cache(uint8_t cache, int hits, int misses, int evicts)
+{
+#ifdef PERFORMANCE_METRICS
+        metrics_cache_add(cache, hits, misses, evicts);
+#endif
+}
+
+void gdi_perf_gui_heap(int buf_allocs, int used, int frag_pct, int biggest)
+{
+        frame_buf_allocs = buf_allocs;
+        frame_gui_heap_used = used;
+        frame_gui_heap_frag = frag_pct;
+        frame_gui_heap_biggest = biggest;
+}
+
+void gdi_sim_heap_map(const void *data, uint32_t size, void *user_data)
+{
+        if (heap_map) {
+                fwrite(data, 1, size, heap_map);
+        }
+}
+
+void gdi_perf_fb_sync(int bytes)
+{
+        frame_fb_sync_bytes = bytes;
+}
+
+void gdi_perf_frame_pace(int periods, int drops)
+{
+        frame_te_periods = periods;
+        frame_te_drops = drops;
+}
+
+void gdi_perf_transfer_start(void)
+{
+        /* A frame may be transferred in several areas */
+        pixel_count += (gdi->frame.endx - gdi->frame.startx + 1) * (gdi->frame.endy - gdi->frame.starty + 1);
+        frame_transfer_start = gdi_get_sys_uptime_ticks();
+}
+
+void gdi_perf_transfer_end(void)
+{
+        uint64_t now = gdi_get_sys_uptime_ticks();
+
+        if (transfer_last) {
+                frame_total_duration_us = gdi_convert_ticks_to_us(now - frame_transfer_end);
+                frame_transfer_end = now;
+        }
+
+        frame_transfer_duration_us += gdi_convert_ticks_to_us(now - frame_transfer_start);
+
+        console_log();
+}
+
+void gdi_perf_transfer_time(int time_us)
+{
+        uint64_t now = gdi_get_sys_uptime_ticks();
+
+        frame_total_duration_us = gdi_convert_ticks_to_us(now - frame_transfer_end);
+
+        frame_transfer_end = now;
+
+        frame_transfer_duration_us = time_us;
+
+        console_log();
+}
+
+void gdi_perf_transfer_last(bool last)
+{
+        transfer_last = last;
+}
+
+HW_LCDC_LAYER_COLOR_MODE gdi_to_layer_color_format(gdi_color_fmt_t format)
+{
+        switch (format) {
+        case GDI_FORMAT_RGB332:   return HW_LCDC_LCM_RGB332;
+        case GDI_FORMAT_RGB565:   return HW_LCDC_LCM_RGB565;
+        case GDI_FORMAT_RGBA5551: return HW_LCDC_LCM_RGBA5551;
+        case GDI_FORMAT_RGB888:   return HW_LCDC_LCM_RGB888;
+        case GDI_FORMAT_RGBA4444: return HW_LCDC_LCM_RGBA4444;
+        case GDI_FORMAT_ARGB4444: return HW_LCDC_LCM_ARGB4444;
+        case GDI_FORMAT_ARGB8888: return HW_LCDC_LCM_ARGB8888;
+        case GDI_FORMAT_RGBA8888: return HW_LCDC_LCM_RGBA8888;
+        case GDI_FORMAT_ABGR8888: return HW_LCDC_LCM_ABGR8888;
+        case GDI_FORMAT_BGRA8888: return HW_LCDC_LCM_BGRA8888;
+        default:                  ASSERT_ERROR(0);
+        }
+        // Should never get here...
+        return 0;
+}
+
+gdi_color_fmt_t gdi_from_layer_color_format(HW_LCDC_LAYER_COLOR_MODE format)
+{
+        switch (format) {
+        case HW_LCDC_LCM_RGB332:   return GDI_FORMAT_RGB332;
+        case HW_LCDC_LCM_RGB565:   return GDI_FORMAT_RGB565;
+        case HW_LCDC_LCM_RGBA5551: return GDI_FORMAT_RGBA5551;
+        case HW_LCDC_LCM_RGB888:   return GDI_FORMAT_RGB888;
+        case HW_LCDC_LCM_RGBA4444: return GDI_FORMAT_RGBA4444;
+        case HW_LCDC_LCM_ARGB4444: return GDI_FORMAT_ARGB4444;
+        case HW_LCDC_LCM_ARGB8888: return GDI_FORMAT_ARGB8888;
+        case HW_LCDC_LCM_RGBA8888: return GDI_FORMAT_RGBA8888;
+        case HW_LCDC_LCM_ABGR8888: return GDI_FORMAT_ABGR8888;
+        case HW_LCDC_LCM_BGRA8888: return GDI_FORMAT_BGRA8888;
+        default:                  ASSERT_ERROR(0);
+        }
+        // Should never get here...
+        return 0;
+}
+
+void gdi_set_layer_src(HW_LCDC_LAYER layer_no, void *address, gdi_coord_t resx, gdi_coord_t resy, gdi_color_fmt_t format)
+{
+        gdi->layer[layer_no].layer.baseaddr = (uintptr_t)address;
+        gdi->layer[layer_no].layer.format = gdi_to_layer_color_format(format);
+        gdi->layer[layer_no].layer.resx = resx;
+        gdi->layer[layer_no].layer.resy = resy;
+        gdi->layer[layer_no].layer.stride = calc_stride(format, resx);
+        gdi->layer[layer_no].layer_dirty = true;
+}
+
+void gdi_set_layer_start(HW_LCDC_LAYER layer_no, int startx, int starty)
+{
+        gdi->layer[layer_no].layer.startx = startx;
+        gdi->layer[layer_no].layer.starty = starty;
+        gdi->layer[layer_no].layer_dirty = true;
+}
+
+void gdi_set_layer_blending(HW_LCDC_LAYER layer_no, HW_LCDC_BLEND_MODE blendmode, uint8_t alpha)
+{
+        gdi->layer[layer_no].layer.blendmode = blendmode;
+        gdi->layer[layer_no].layer.alpha = alpha;
+        gdi->layer[layer_no].layer_dirty = true;
+}
+
+void gdi_set_layer_dirty(HW_LCDC_LAYER layer_no, bool dirty)
+{
+        gdi->layer[layer_no].layer_dirty = dirty;
+}
+
+void gdi_set_layer_enable(HW_LCDC_LAYER layer_no, bool enable)
+{
+        if (gdi->layer[layer_no].layer_enable != enable) {
+                gdi->layer[layer_no].layer_enable = enable;
+                gdi->layer[layer_no].layer_dirty = true;
+        }
+}
+
+bool gdi_get_layer_enable(HW_LCDC_LAYER layer_no)
+{
+        return gdi->layer[layer_no].layer_enable;
+}
+
+uint32_t * gdi_set_palette_lut(uint32_t *palette_lut)
+{
+        return NULL;
+}
+
+int gdi_get_palette_lut(int index, uint32_t *color, int color_num)
+{
+        return 0;
+}
+
+size_t gdi_setup_layer(HW_LCDC_LAYER layer_no, void *address, gdi_coord_t resx, gdi_coord_t resy, gdi_color_fmt_t format, int buffers)
+{
+        size_t i = 0;
+
+        buffers = MIN(GDI_SINGLE_FB_NUM, buffers);
+
+        gdi->layer[layer_no].single_buff_sz = calc_stride(format, resx) * resy;
+        gdi->layer[layer_no].bufs_num = buffers;
+        gdi->layer[layer_no].active_buf = 0;
+        gdi->layer[layer_no].buffer[i] = (uint8_t *)address;
+        for (i = 1; i < buffers; i++) {
+                gdi->layer[layer_no].buffer[i] = gdi->layer[layer_no].buffer[i - 1] + gdi->layer[layer_no].single_buff_sz;
+        }
+
+        gdi->layer[layer_no].layer.dma_prefetch_lvl = HW_LCDC_FIFO_PREFETCH_LVL_DISABLED;
+        gdi_set_layer_src(layer_no, gdi->layer[layer_no].buffer[0], resx, resy, format);
+        gdi_set_layer_start(layer_no, 0, 0);
+        gdi_set_layer_blending(layer_no, HW_LCDC_BL_SRC, 0xFF);
+
+        gdi_set_layer_dirty(layer_no, true); //! Mark layer as 'dirty' so that setting can be applied
+
+        return gdi->layer[layer_no].single_buff_sz * gdi->layer[layer_no].bufs_num;
+}
+
+gdi_t *gdi_init(void)
+{
+        gdi_color_fmt_t format = GDI_FORMAT_ARGB8888;
+        uint8_t *address = frame_buffer;
+
+        if (gdi) {
+                return gdi;
+        }
+
+        gdi = OS_MALLOC(sizeof(gdi_t));
+        OS_ASSERT(gdi != NULL);
+        memset(gdi, 0, sizeof(gdi_t));
+
+        for (HW_LCDC_LAYER layer_no = 0; layer_no < HW_LCDC_LAYER_MAX; layer_no++) {
+                gdi->layer[layer_no].buffer = OS_MALLOC(sizeof(uint8_t *) * GDI_SINGLE_FB_NUM);
+                OS_ASSERT(gdi->layer[layer_no].buffer != NULL);
+                memset(gdi->layer[layer_no].buffer, 0, sizeof(uint8_t *) * GDI_SINGLE_FB_NUM);
+        }
+
+        gdi->width = GDI_DISP_RESX;
+        gdi->height = GDI_DISP_RESY;
+        gdi->screen_offsetx = GDI_DISP_OFFSETX;
+        gdi->screen_offsety = GDI_DISP_OFFSETY;
+        gdi->screen_set_partial_update_area = screen_set_partial_update_area;
+        gdi->display_powered = true;
+        gdi->display_enabled = true;
+        gdi->frame.endx = GDI_DISP_RESX - 1;
+        gdi->frame.endy = GDI_DISP_RESY - 1;
+
+#if GDI_FB_COLOR_FORMAT == CF_NATIVE_RGB332
+        format = GDI_FORMAT_RGB332;
+#elif GDI_FB_COLOR_FORMAT == CF_NATIVE_RGB565
+        format = GDI_FORMAT_RGB565;
+#elif GDI_FB_COLOR_FORMAT == CF_NATIVE_RGBA8888
+        format = GDI_FORMAT_RGBA8888;
+#elif GDI_FB_COLOR_FORMAT == CF_NATIVE_ARGB8888
+        format = GDI_FORMAT_ARGB8888;
+#endif
+
+        OS_EVENT_CREATE(gdi->draw_event);
+        OS_EVENT_CREATE(gdi->dma_event);
+
+        /* Binary semaphore, initially available */
+        OS_EVENT_CREATE(gdi->draw_smphr);
+        OS_EVENT_SIGNAL(gdi->draw_smphr);
+
+        for (HW_LCDC_LAYER layer_no = HW_LCDC_LAYER_0; layer_no < HW_LCDC_LAYER_MAX; layer_no++) {
+                address += gdi_setup_layer(layer_no, address, GDI_FB_RESX, GDI_FB_RESY, format, GDI_SINGLE_FB_NUM);
+        }
+
+        OS_BASE_TYPE res = OS_TASK_CREATE( "GDI_task",  /* The text name assigned to the task, for
+                                                           debug only; not used by the kernel. */
+                        gdi_task,                       /* The function that implements the task. */
+                        NULL,                           /* The parameter passed to the task. */
+                        2048,                           /* The number of bytes to allocate to the
+                                                           stack of the task. */
+                        OS_TASK_PRIORITY_NORMAL + 1,    /* The priority assigned to the task. */
+                        task_h );                       /* The task handle */
+        OS_ASSERT(res == OS_TASK_CREATE_SUCCESS);
+
+        return gdi;
+}
+
+void gdi_set_callback_store_touch(store_touch_callback cb)
+{
+        if (cb) {
+                gdi->store_touch_cb = cb;
+        }
+}
+
+void gdi_touch_event(void)
+{
+#if GDI_TOUCH_ENABLE
+        dev_notify_touch();
+#endif
+}
+
+void gdi_display_power_on(void)
+{
+        gdi->display_powered = true;
+}
+
+void gdi_display_power_off(void)
+{
+        gdi->display_powered = false;
+}
+
+bool gdi_display_is_powered(void)
+{
+        return gdi->display_powered;
+}
+
+void gdi_display_enable(void)
+{
+        gdi->display_enabled = true;
+}
+
+void gdi_display_disable(void)
+{
+        gdi->display_enabled = false;
+}
+
+bool gdi_display_is_enabled(void)
+{
+        return gdi->display_enabled;
+}
+
+void gdi_display_update(void)
+{
+        dev_draw(gdi);
+}
+
+void gdi_display_update_async(draw_callback cb, void *user_data)
+{
+        dev_draw_async(cb, user_data);
+}
+
+bool gdi_set_color_mode(HW_LCDC_OUTPUT_COLOR_MODE mode)
+{
+        return false;
+}
+
+gdi_t * gdi_get_gdi_structure(void)
+{
+        return gdi;
+}
+
+void gdi_round_partial_update_area(gdi_coord_t *x0, gdi_coord_t *y0, gdi_coord_t *x1, gdi_coord_t *y1)
+{
+        hw_lcdc_frame_t frame;
+
+        frame.startx = MAX(*x0, 0);
+        frame.starty = MAX(*y0, 0);
+        frame.endx = MIN(*x1, gdi->width - 1);
+        frame.endy = MIN(*y1, gdi->height - 1);
+
+        if (gdi->screen_set_partial_update_area) {
+                gdi->screen_set_partial_update_area(&frame);
+        }
+
+        *x0 = frame.startx;
+        *y0 = frame.starty;
+        *x1 = frame.endx;
+        *y1 = frame.endy;
+}
+
+void gdi_set_partial_update_area(gdi_coord_t x0, gdi_coord_t y0, gdi_coord_t x1, gdi_coord_t y1)
+{
+        hw_lcdc_frame_t frame;
+
+        if (x0 > x1 || y0 > y1) {
+                return;
+        }
+
+        frame.startx = x0;
+        frame.starty = y0;
+        frame.endx = x1;
+        frame.endy = y1;
+
+        gdi_round_partial_update_area(&frame.startx, &frame.starty, &frame.endx, &frame.endy);
+
+        if (!memcmp(&gdi->frame, &frame, sizeof(frame))) {
+                return;
+        }
+        memcpy(&gdi->frame, &frame, sizeof(frame));
+}
+
+void gdi_display_clear(void)
+{
+        memset(panel, 0, sizeof(panel));
+}
+
+uint8_t gdi_set_next_frame_buffer(HW_LCDC_LAYER layer_no)
+{
+        if (++gdi->layer[layer_no].active_buf >= gdi->layer[layer_no].bufs_num) {
+                gdi->layer[layer_no].active_buf = 0;
+        }
+        return gdi->layer[layer_no].active_buf;
+}
+
+uint8_t gdi_get_current_frame_buffer(HW_LCDC_LAYER layer_no)
+{
+        return gdi->layer[layer_no].active_buf;
+}
+
+void gdi_set_frame_buffer(HW_LCDC_LAYER layer_no, uint8_t frame)
+{
+        gdi->layer[layer_no].active_buf = frame >= gdi->layer[layer_no].bufs_num ? 0 : frame;
+        gdi->layer[layer_no].layer.baseaddr = (uintptr_t)gdi->layer[layer_no].buffer[gdi->layer[layer_no].active_buf];
+        gdi->layer[layer_no].layer_dirty = true;
+}
+
+void gdi_memcpy(void *dst, const void *src, size_t length)
+{
+        memcpy(dst, src, length);
+}
+
+void gdi_memcpy_2d(void *dst, const void *src, size_t length, int dst_step, int src_step, size_t reps)
+{
+        for (size_t i = 0; i < reps; i++) {
+                memcpy((uint8_t *)dst + i * dst_step, (const uint8_t *)src + i * src_step, length);
+        }
+}
+
+void gdi_buffer_memcpy(HW_LCDC_LAYER dst_layer, uint8_t dst, HW_LCDC_LAYER src_layer, uint8_t src)
+{
+        memcpy(gdi->layer[dst_layer].buffer[dst], gdi->layer[src_layer].buffer[src],
+                MIN(gdi->layer[dst_layer].single_buff_sz, gdi->layer[src_layer].single_buff_sz));
+}
+
+void *gdi_get_frame_buffer_addr(HW_LCDC_LAYER layer_no)
+{
+        void *addr = gdi->layer[layer_no].buffer[0];
+        return addr;
+}
+
+void *gdi_get_gui_heap_addr(void)
+{
+        return (void *)(gui_heap_area);
+}
+
+void gdi_sim_set_frame_log(FILE *stream)
+{
+        frame_log = stream;
+        if (frame_log) {
+                fprintf(frame_log, "frame,timestamp_us,tag,render_us,transfer_us,link_us,frame_us,pixels,gpu_us,overlap_us,flushes_saved,px_saved\n");
+        }
+}
+
+void gdi_sim_set_heap_map(FILE *stream)
+{
+        heap_map = stream;
+}
+
+void gdi_sim_set_link_emulation(bool enable)
+{
+        link_emulation = enable;
+}
+
+uint32_t gdi_sim_get_frame_count(void)
+{
+        return frame_count;
+}
+
+bool gdi_sim_save_screenshot(const char *path)
+{
+        FILE *f = fopen(path, "wb");
+
+        if (!f) {
+                return false;
+        }
+
+        fprintf(f, "P6\n%d %d\n255\n", GDI_DISP_RESX, GDI_DISP_RESY);
+        for (int i = 0; i < GDI_DISP_RESX * GDI_DISP_RESY; i++) {
+                uint16_t c = panel[i];
+                uint8_t rgb[3] = {
+                        ((c >> 11) & 0x1F) * 255 / 0x1F,
+                        ((c >> 5) & 0x3F) * 255 / 0x3F,
+                        (c & 0x1F) * 255 / 0x1F,
+                };
+                fwrite(rgb, sizeof(rgb), 1, f);
+        }
+
+        return fclose(f) == 0;
+}
+
+#endif /* dg_configLCDC_ADAPTER */
+
+/**
+ * \}
+ * \}
+ */
@@ -0,0 +1,210 @@
+/**
+ ****************************************************************************************
+ *
+ * @file main.c
+ *
+ * @brief Host simulator entry point
+ *
+ * Loads the demo resources into the emulated QSPI flash, starts the GUI and the UI simulation
+ * tasks and lets the scripted gestures run headless for the requested time.
+ *
+ * Copyright (C) 2021-2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include "osal.h"
+#include "gdi_sim.h"
+#if DLG_LVGL_USE_GPU_DA1470X
+#include "dave_sim.h"
+#endif
+#if DLG_LVGL_USE_PROFILER
+#include "lvgl.h"
+#endif
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#ifndef SIM_RESOURCES_PATH
+#define SIM_RESOURCES_PATH              "WatchDemoColoredResources.bin"
+#endif
+
+#define SIM_DEFAULT_DURATION_S          (60)
+
+void MainTask(void);
+extern void UISimulationTask(void);
+
+/*
+ *       Public data
+ *****************************************************************************************
+ */
+uint8_t sim_qspic_mem[SIM_QSPIC_MEM_SIZE];
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static void usage(const char *prog)
+{
+        fprintf(stderr,
+                "Usage: %s [-r bundle.bin] [-t seconds] [-o frames.csv] [-s screenshot.ppm] [-p profile.bin] [-m heap.bin] [-f]\n"
+                "  -r  resource bundle loaded at the QSPI flash base (default: %s)\n"
+                "  -t  simulation time in seconds (default: %d)\n"
+                "  -o  write per-frame timings as CSV\n"
+                "  -s  save the final panel content as PPM\n"
+#if DLG_LVGL_USE_PROFILER
+                "  -p  dump the events of the profiler, see tools/trace_conv.c\n"
+#endif
+                "  -m  append a map of the GUI heap every second, see tools/heap_view.c\n"
+                "  -f  do not emulate the display link time nor wait for the TE pulses (run as fast as possible)\n",
+                prog, SIM_RESOURCES_PATH, SIM_DEFAULT_DURATION_S);
+}
+
+static bool load_resources(const char *path)
+{
+        FILE *f = fopen(path, "rb");
+        size_t len;
+
+        if (!f) {
+                perror(path);
+                return false;
+        }
+
+        len = fread(sim_qspic_mem, 1, sizeof(sim_qspic_mem), f);
+        fclose(f);
+
+        printf("Loaded %zu bytes of resources from %s\r\n", len, path);
+
+#if DLG_LVGL_USE_GPU_DA1470X
+        /* The GPU fetches the images from the flash */
+        dave_sim_set_flash(sim_qspic_mem, len);
+#endif
+
+        return len > 0;
+}
+
+#if DLG_LVGL_USE_PROFILER
+static void profile_write(const void *data, uint32_t size, void *user_data)
+{
+        fwrite(data, 1, size, (FILE *)user_data);
+}
+
+static bool save_profile(const char *path)
+{
+        FILE *f = fopen(path, "wb");
+        uint32_t cnt;
+
+        if (!f) {
+                return false;
+        }
+        cnt = lv_profiler_dump(profile_write, f);
+        printf("Dumped %u profiler events to %s\r\n", (unsigned)cnt, path);
+
+        return fclose(f) == 0;
+}
+#endif
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+int main(int argc, char *argv[])
+{
+        const char *resources = SIM_RESOURCES_PATH;
+        const char *csv_path = NULL;
+        const char *ppm_path = NULL;
+        const char *profile_path = NULL;
+        const char *heap_path = NULL;
+        FILE *csv = NULL;
+        FILE *heap = NULL;
+        unsigned duration = SIM_DEFAULT_DURATION_S;
+        int opt;
+
+        while ((opt = getopt(argc, argv, "r:t:o:s:p:m:fh")) != -1) {
+                switch (opt) {
+                case 'r':
+                        resources = optarg;
+                        break;
+                case 't':
+                        duration = strtoul(optarg, NULL, 0);
+                        break;
+                case 'o':
+                        csv_path = optarg;
+                        break;
+                case 's':
+                        ppm_path = optarg;
+                        break;
+                case 'p':
+                        profile_path = optarg;
+                        break;
+                case 'm':
+                        heap_path = optarg;
+                        break;
+                case 'f':
+                        gdi_sim_set_link_emulation(false);
+                        break;
+                default:
+                        usage(argv[0]);
+                        return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+                }
+        }
+
+        if (!load_resources(resources)) {
+                return EXIT_FAILURE;
+        }
+
+        if (csv_path) {
+                csv = fopen(csv_path, "w");
+                if (!csv) {
+                        perror(csv_path);
+                        return EXIT_FAILURE;
+                }
+                gdi_sim_set_frame_log(csv);
+        }
+
+        if (heap_path) {
+                heap = fopen(heap_path, "wb");
+                if (!heap) {
+                        perror(heap_path);
+                        return EXIT_FAILURE;
+                }
+                gdi_sim_set_heap_map(heap);
+        }
+
+        MainTask();
+
+        UISimulationTask();
+
+        OS_DELAY(OS_MS_2_TICKS(duration * 1000));
+
+        if (csv) {
+                /* The display task may still be logging, leave the stream open */
+                fflush(csv);
+        }
+        if (heap) {
+                fflush(heap);
+        }
+        if (ppm_path && !gdi_sim_save_screenshot(ppm_path)) {
+                perror(ppm_path);
+        }
+#if DLG_LVGL_USE_PROFILER
+        if (profile_path && !save_profile(profile_path)) {
+                perror(profile_path);
+        }
+#else
+        if (profile_path) {
+                fprintf(stderr, "%s: the profiler is not built in (SIM_PROFILER)\n", profile_path);
+        }
+#endif
+        printf("%u frames in %u s\r\n", gdi_sim_get_frame_count(), duration);
+        fflush(stdout);
+
+        /* Tasks never return; terminate the process while they are blocked */
+        _exit(EXIT_SUCCESS);
+}
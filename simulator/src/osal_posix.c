@@ -0,0 +1,507 @@
+/**
+ ****************************************************************************************
+ *
+ * @file osal_posix.c
+ *
+ * @brief OS abstraction layer implementation for the host simulator (POSIX threads)
+ *
+ * Copyright (C) 2021-2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+#include "osal.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define OS_POSIX_MAX_TASKS              (16)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+struct os_posix_task {
+        pthread_t thread;
+        const char *name;
+        void (*func)(void *);
+        void *arg;
+        pthread_mutex_t lock;
+        pthread_cond_t cond;
+        uint32_t notif_value;
+        bool notif_pending;
+};
+
+struct os_posix_event {
+        pthread_mutex_t lock;
+        pthread_cond_t cond;
+        bool signaled;
+};
+
+struct os_posix_mutex {
+        pthread_mutex_t lock;
+};
+
+struct os_posix_queue {
+        pthread_mutex_t lock;
+        pthread_cond_t cond;
+        size_t item_size;
+        size_t max_items;
+        size_t head;
+        size_t count;
+        uint8_t *items;
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static pthread_mutex_t critical_section = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static pthread_mutex_t tasks_lock = PTHREAD_MUTEX_INITIALIZER;
+static OS_TASK tasks[OS_POSIX_MAX_TASKS];
+static uint32_t tasks_num;
+static __thread OS_TASK current_task;
+static struct timespec start_time;
+static pthread_once_t start_time_once = PTHREAD_ONCE_INIT;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void start_time_init(void)
+{
+        clock_gettime(CLOCK_MONOTONIC, &start_time);
+}
+
+/* Convert a timeout in OS ticks to an absolute CLOCK_MONOTONIC deadline */
+static void deadline_from_ticks(struct timespec *ts, OS_TICK_TIME ticks)
+{
+        clock_gettime(CLOCK_MONOTONIC, ts);
+        ts->tv_sec += ticks / 1000;
+        ts->tv_nsec += (long)(ticks % 1000) * 1000000L;
+        if (ts->tv_nsec >= 1000000000L) {
+                ts->tv_sec++;
+                ts->tv_nsec -= 1000000000L;
+        }
+}
+
+static void cond_init_monotonic(pthread_cond_t *cond)
+{
+        pthread_condattr_t attr;
+
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(cond, &attr);
+        pthread_condattr_destroy(&attr);
+}
+
+/*
+ * Block on a condition variable until pred() holds or the timeout expires. The caller holds
+ * the lock. Returns true if the predicate is satisfied.
+ */
+static bool cond_wait_ticks(pthread_cond_t *cond, pthread_mutex_t *lock, OS_TICK_TIME ticks,
+        bool (*pred)(void *), void *ctx)
+{
+        struct timespec deadline;
+
+        if (pred(ctx)) {
+                return true;
+        }
+        if (ticks == 0) {
+                return false;
+        }
+        if (ticks == UINT32_MAX) {
+                while (!pred(ctx)) {
+                        pthread_cond_wait(cond, lock);
+                }
+                return true;
+        }
+
+        deadline_from_ticks(&deadline, ticks);
+        while (!pred(ctx)) {
+                if (pthread_cond_timedwait(cond, lock, &deadline) == ETIMEDOUT) {
+                        return pred(ctx);
+                }
+        }
+        return true;
+}
+
+static void *task_entry(void *arg)
+{
+        OS_TASK task = arg;
+
+        current_task = task;
+        task->func(task->arg);
+
+        return NULL;
+}
+
+static bool task_notif_pending(void *ctx)
+{
+        return ((OS_TASK)ctx)->notif_pending;
+}
+
+static bool event_signaled(void *ctx)
+{
+        return ((OS_EVENT)ctx)->signaled;
+}
+
+static bool queue_not_empty(void *ctx)
+{
+        return ((OS_QUEUE)ctx)->count > 0;
+}
+
+static bool queue_not_full(void *ctx)
+{
+        return ((OS_QUEUE)ctx)->count < ((OS_QUEUE)ctx)->max_items;
+}
+
+static uint64_t task_cpu_time_us(OS_TASK task)
+{
+        clockid_t cid;
+        struct timespec ts;
+
+        if (pthread_getcpuclockid(task->thread, &cid) || clock_gettime(cid, &ts)) {
+                return 0;
+        }
+        return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+OS_BASE_TYPE os_posix_task_create(const char *name, void (*task_func)(void *), void *arg, OS_TASK *task)
+{
+        OS_TASK t = calloc(1, sizeof(*t));
+
+        pthread_once(&start_time_once, start_time_init);
+
+        if (!t) {
+                *task = NULL;
+                return OS_FAIL;
+        }
+
+        t->name = name;
+        t->func = task_func;
+        t->arg = arg;
+        pthread_mutex_init(&t->lock, NULL);
+        cond_init_monotonic(&t->cond);
+
+        /* Publish the handle before the task runs, tasks commonly notify each other at start-up */
+        *task = t;
+
+        pthread_mutex_lock(&tasks_lock);
+        OS_ASSERT(tasks_num < OS_POSIX_MAX_TASKS);
+        tasks[tasks_num++] = t;
+        pthread_mutex_unlock(&tasks_lock);
+
+        if (pthread_create(&t->thread, NULL, task_entry, t)) {
+                *task = NULL;
+                return OS_FAIL;
+        }
+        pthread_setname_np(t->thread, name);
+
+        return OS_TASK_CREATE_SUCCESS;
+}
+
+void os_posix_task_delete(OS_TASK task)
+{
+        if (task == NULL) {
+                task = current_task;
+        }
+
+        /* Drop the task from the system state; the handle itself stays valid for late notifiers */
+        pthread_mutex_lock(&tasks_lock);
+        for (uint32_t i = 0; i < tasks_num; i++) {
+                if (tasks[i] == task) {
+                        tasks[i] = tasks[--tasks_num];
+                        break;
+                }
+        }
+        pthread_mutex_unlock(&tasks_lock);
+
+        pthread_detach(task->thread);
+        if (task == current_task) {
+                pthread_exit(NULL);
+        }
+        pthread_cancel(task->thread);
+}
+
+OS_TASK os_posix_task_current(void)
+{
+        return current_task;
+}
+
+OS_BASE_TYPE os_posix_task_notify(OS_TASK task, uint32_t value, OS_NOTIFY_ACTION action)
+{
+        OS_BASE_TYPE ret = OS_TASK_NOTIFY_SUCCESS;
+
+        pthread_mutex_lock(&task->lock);
+        switch (action) {
+        case OS_NOTIFY_SET_BITS:
+                task->notif_value |= value;
+                break;
+        case OS_NOTIFY_INCREMENT:
+                task->notif_value++;
+                break;
+        case OS_NOTIFY_VAL_WITH_OVERWRITE:
+                task->notif_value = value;
+                break;
+        case OS_NOTIFY_VAL_WITHOUT_OVERWRITE:
+                if (task->notif_pending) {
+                        ret = OS_TASK_NOTIFY_FAIL;
+                } else {
+                        task->notif_value = value;
+                }
+                break;
+        default:
+                break;
+        }
+        task->notif_pending = true;
+        pthread_cond_signal(&task->cond);
+        pthread_mutex_unlock(&task->lock);
+
+        return ret;
+}
+
+OS_BASE_TYPE os_posix_task_notify_wait(uint32_t entry_bits, uint32_t exit_bits, uint32_t *value, OS_TICK_TIME ticks)
+{
+        OS_TASK task = current_task;
+        bool notified;
+
+        OS_ASSERT(task);
+
+        pthread_mutex_lock(&task->lock);
+        if (!task->notif_pending) {
+                task->notif_value &= ~entry_bits;
+        }
+        notified = cond_wait_ticks(&task->cond, &task->lock, ticks, task_notif_pending, task);
+        if (value) {
+                *value = notified ? task->notif_value : 0;
+        }
+        if (notified) {
+                task->notif_value &= ~exit_bits;
+                task->notif_pending = false;
+        }
+        pthread_mutex_unlock(&task->lock);
+
+        return notified ? OS_TASK_NOTIFY_SUCCESS : OS_TASK_NOTIFY_FAIL;
+}
+
+OS_MUTEX os_posix_mutex_create(void)
+{
+        OS_MUTEX mutex = calloc(1, sizeof(*mutex));
+        pthread_mutexattr_t attr;
+
+        OS_ASSERT(mutex);
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+        pthread_mutex_init(&mutex->lock, &attr);
+        pthread_mutexattr_destroy(&attr);
+
+        return mutex;
+}
+
+void os_posix_mutex_delete(OS_MUTEX mutex)
+{
+        pthread_mutex_destroy(&mutex->lock);
+        free(mutex);
+}
+
+OS_BASE_TYPE os_posix_mutex_get(OS_MUTEX mutex, OS_TICK_TIME ticks)
+{
+        struct timespec deadline;
+
+        if (ticks == UINT32_MAX) {
+                return pthread_mutex_lock(&mutex->lock) ? OS_MUTEX_NOT_TAKEN : OS_MUTEX_TAKEN;
+        }
+        if (ticks == 0) {
+                return pthread_mutex_trylock(&mutex->lock) ? OS_MUTEX_NOT_TAKEN : OS_MUTEX_TAKEN;
+        }
+
+        /* pthread_mutex_timedlock() measures the deadline against CLOCK_REALTIME */
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += ticks / 1000;
+        deadline.tv_nsec += (long)(ticks % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000L;
+        }
+        return pthread_mutex_timedlock(&mutex->lock, &deadline) ? OS_MUTEX_NOT_TAKEN : OS_MUTEX_TAKEN;
+}
+
+OS_BASE_TYPE os_posix_mutex_put(OS_MUTEX mutex)
+{
+        return pthread_mutex_unlock(&mutex->lock) ? OS_FAIL : OS_OK;
+}
+
+OS_EVENT os_posix_event_create(void)
+{
+        OS_EVENT event = calloc(1, sizeof(*event));
+
+        OS_ASSERT(event);
+        pthread_mutex_init(&event->lock, NULL);
+        cond_init_monotonic(&event->cond);
+
+        return event;
+}
+
+void os_posix_event_delete(OS_EVENT event)
+{
+        pthread_cond_destroy(&event->cond);
+        pthread_mutex_destroy(&event->lock);
+        free(event);
+}
+
+OS_BASE_TYPE os_posix_event_signal(OS_EVENT event)
+{
+        pthread_mutex_lock(&event->lock);
+        event->signaled = true;
+        pthread_cond_signal(&event->cond);
+        pthread_mutex_unlock(&event->lock);
+
+        return OS_OK;
+}
+
+OS_BASE_TYPE os_posix_event_wait(OS_EVENT event, OS_TICK_TIME ticks)
+{
+        bool signaled;
+
+        pthread_mutex_lock(&event->lock);
+        signaled = cond_wait_ticks(&event->cond, &event->lock, ticks, event_signaled, event);
+        event->signaled = false;
+        pthread_mutex_unlock(&event->lock);
+
+        return signaled ? OS_EVENT_SIGNALED : OS_EVENT_NOT_SIGNALED;
+}
+
+OS_QUEUE os_posix_queue_create(size_t item_size, size_t max_items)
+{
+        OS_QUEUE queue = calloc(1, sizeof(*queue));
+
+        OS_ASSERT(queue);
+        queue->items = calloc(max_items, item_size);
+        OS_ASSERT(queue->items);
+        queue->item_size = item_size;
+        queue->max_items = max_items;
+        pthread_mutex_init(&queue->lock, NULL);
+        cond_init_monotonic(&queue->cond);
+
+        return queue;
+}
+
+void os_posix_queue_delete(OS_QUEUE queue)
+{
+        pthread_cond_destroy(&queue->cond);
+        pthread_mutex_destroy(&queue->lock);
+        free(queue->items);
+        free(queue);
+}
+
+OS_BASE_TYPE os_posix_queue_put(OS_QUEUE queue, const void *item, OS_TICK_TIME ticks)
+{
+        size_t tail;
+
+        pthread_mutex_lock(&queue->lock);
+        if (!cond_wait_ticks(&queue->cond, &queue->lock, ticks, queue_not_full, queue)) {
+                pthread_mutex_unlock(&queue->lock);
+                return OS_QUEUE_FULL;
+        }
+        tail = (queue->head + queue->count) % queue->max_items;
+        memcpy(queue->items + tail * queue->item_size, item, queue->item_size);
+        queue->count++;
+        pthread_cond_broadcast(&queue->cond);
+        pthread_mutex_unlock(&queue->lock);
+
+        return OS_QUEUE_OK;
+}
+
+OS_BASE_TYPE os_posix_queue_get(OS_QUEUE queue, void *item, OS_TICK_TIME ticks)
+{
+        pthread_mutex_lock(&queue->lock);
+        if (!cond_wait_ticks(&queue->cond, &queue->lock, ticks, queue_not_empty, queue)) {
+                pthread_mutex_unlock(&queue->lock);
+                return OS_QUEUE_EMPTY;
+        }
+        memcpy(item, queue->items + queue->head * queue->item_size, queue->item_size);
+        queue->head = (queue->head + 1) % queue->max_items;
+        queue->count--;
+        pthread_cond_broadcast(&queue->cond);
+        pthread_mutex_unlock(&queue->lock);
+
+        return OS_QUEUE_OK;
+}
+
+uint32_t os_posix_queue_messages_waiting(OS_QUEUE queue)
+{
+        uint32_t count;
+
+        pthread_mutex_lock(&queue->lock);
+        count = queue->count;
+        pthread_mutex_unlock(&queue->lock);
+
+        return count;
+}
+
+void os_posix_delay_us(uint64_t us)
+{
+        struct timespec ts = {
+                .tv_sec = us / 1000000ULL,
+                .tv_nsec = (long)(us % 1000000ULL) * 1000L,
+        };
+
+        while (nanosleep(&ts, &ts) && errno == EINTR) {
+        }
+}
+
+uint64_t os_posix_uptime_us(void)
+{
+        struct timespec now;
+
+        pthread_once(&start_time_once, start_time_init);
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        return (uint64_t)(now.tv_sec - start_time.tv_sec) * 1000000ULL
+                + (now.tv_nsec - start_time.tv_nsec) / 1000;
+}
+
+uint64_t os_posix_uptime_ns(void)
+{
+        struct timespec now;
+
+        pthread_once(&start_time_once, start_time_init);
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        return (uint64_t)(now.tv_sec - start_time.tv_sec) * 1000000000ULL + now.tv_nsec - start_time.tv_nsec;
+}
+
+void os_posix_enter_critical_section(void)
+{
+        pthread_mutex_lock(&critical_section);
+}
+
+void os_posix_leave_critical_section(void)
+{
+        pthread_mutex_unlock(&critical_section);
+}
+
+uint32_t uxTaskGetSystemState(TaskStatus_t *status_array, uint32_t array_size, uint32_t *total_run_time)
+{
+        uint32_t i;
+
+        pthread_mutex_lock(&tasks_lock);
+        for (i = 0; i < tasks_num && i < array_size; i++) {
+                status_array[i].xHandle = tasks[i];
+                status_array[i].pcTaskName = tasks[i]->name;
+                status_array[i].ulRunTimeCounter = (uint32_t)task_cpu_time_us(tasks[i]);
+        }
+        pthread_mutex_unlock(&tasks_lock);
+
+        if (total_run_time) {
+                *total_run_time = (uint32_t)os_posix_uptime_us();
+        }
+
+        return i;
+}
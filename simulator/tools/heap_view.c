@@ -0,0 +1,299 @@
+/**
+ ****************************************************************************************
+ *
+ * @file heap_view.c
+ *
+ * @brief Host viewer of the maps of the GUI heap
+ *
+ * Reads the snapshots of lv_mem_map_dump() (simulator option -m, or the bytes written by the
+ * target) and draws them as a PPM image: one band per snapshot and pool, time going down, the
+ * offsets of the pool from left to right. The free blocks are black, the used blocks have a color
+ * of their allocation site, gray if the blocks are not tagged.
+ *
+ * The state of every snapshot is printed on the console, then the blocks in use at the last
+ * snapshot per allocation site. The sites are given from lv_mem_alloc(), to be added to its
+ * address in the executable (nm) and resolved with addr2line.
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#define VIEW_WIDTH                      (512)
+#define VIEW_BAND_ROWS                  (4)
+#define VIEW_MAX_SITES                  (1024)
+
+/*
+ *       Types
+ *****************************************************************************************
+ */
+typedef struct {
+        lv_mem_map_header_t header;
+        const lv_mem_map_block_t *blocks;
+} view_snapshot_t;
+
+typedef struct {
+        uint64_t site;
+        uint32_t cnt;
+        uint32_t size;
+} view_site_t;
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+static view_site_t sites[VIEW_MAX_SITES];
+static int site_cnt;
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static void usage(const char *prog)
+{
+        fprintf(stderr,
+                "Usage: %s heap.bin heap.ppm\n"
+                "  Draw the maps of the GUI heap and list the blocks in use per allocation site\n",
+                prog);
+}
+
+static uint8_t *read_file(const char *path, size_t *size)
+{
+        FILE *f = fopen(path, "rb");
+        uint8_t *data;
+        long len;
+
+        if (!f) {
+                return NULL;
+        }
+        fseek(f, 0, SEEK_END);
+        len = ftell(f);
+        fseek(f, 0, SEEK_SET);
+
+        data = malloc(len > 0 ? len : 1);
+        if (data && fread(data, 1, len, f) != (size_t)len) {
+                free(data);
+                data = NULL;
+        }
+        fclose(f);
+        *size = len;
+
+        return data;
+}
+
+static void site_color(uint64_t site, uint8_t rgb[3])
+{
+        uint32_t h = (uint32_t)(site ^ (site >> 32)) * 2654435761u;
+
+        /* Away from black, which are the free blocks */
+        rgb[0] = 64 + ((h >> 8) & 0xBF);
+        rgb[1] = 64 + ((h >> 16) & 0xBF);
+        rgb[2] = 64 + ((h >> 24) & 0xBF);
+}
+
+static void site_add(uint64_t site, uint32_t size)
+{
+        int i;
+
+        for (i = 0; i < site_cnt; i++) {
+                if (sites[i].site == site) {
+                        break;
+                }
+        }
+        if (i == site_cnt) {
+                if (site_cnt == VIEW_MAX_SITES) {
+                        return;
+                }
+                sites[site_cnt++].site = site;
+        }
+        sites[i].cnt++;
+        sites[i].size += size;
+}
+
+static int site_cmp(const void *a, const void *b)
+{
+        const view_site_t *sa = a, *sb = b;
+
+        return sa->size < sb->size ? 1 : sa->size > sb->size ? -1 : 0;
+}
+
+static void print_snapshot(const view_snapshot_t *snap)
+{
+        uint64_t free_size = 0, free_sq_sum = 0;
+        uint32_t used = 0, free_cnt = 0, biggest = 0;
+
+        for (uint32_t i = 0; i < snap->header.block_cnt; i++) {
+                const lv_mem_map_block_t *block = &snap->blocks[i];
+
+                if (block->site) {
+                        used += block->size;
+                        continue;
+                }
+                free_cnt++;
+                free_size += block->size;
+                free_sq_sum += (uint64_t)block->size * block->size;
+                if (block->size > biggest) {
+                        biggest = block->size;
+                }
+        }
+
+        /* Same index as lv_mem_monitor() */
+        printf("%10u %-6s %8u %8u %8u %12u %6d\n", snap->header.time, snap->header.pool ? "large" : "heap",
+                snap->header.pool_size, used, free_cnt, biggest,
+                free_size ? 100 - (int)(free_sq_sum * 100 / (free_size * free_size)) : 0);
+}
+
+static void draw_snapshot(uint8_t *rows, const view_snapshot_t *snap)
+{
+        /* Each column shows the block at its first byte */
+        for (int x = 0; x < VIEW_WIDTH; x++) {
+                uint64_t offset = (uint64_t)x * snap->header.pool_size / VIEW_WIDTH;
+                uint8_t rgb[3] = { 0, 0, 0 };
+
+                for (uint32_t i = 0; i < snap->header.block_cnt; i++) {
+                        const lv_mem_map_block_t *block = &snap->blocks[i];
+
+                        if (offset >= block->offset && offset < (uint64_t)block->offset + block->size) {
+                                if (block->site == 1 || (block->site && !snap->header.tagged)) {
+                                        rgb[0] = rgb[1] = rgb[2] = 160;
+                                } else if (block->site) {
+                                        site_color(block->site, rgb);
+                                }
+                                break;
+                        }
+                }
+                /* The last row separates the bands */
+                for (int y = 0; y < VIEW_BAND_ROWS - 1; y++) {
+                        memcpy(&rows[(y * VIEW_WIDTH + x) * 3], rgb, 3);
+                }
+        }
+        memset(&rows[(VIEW_BAND_ROWS - 1) * VIEW_WIDTH * 3], 48, VIEW_WIDTH * 3);
+}
+
+static bool write_ppm(const char *path, const view_snapshot_t *snaps, uint32_t cnt)
+{
+        FILE *f = fopen(path, "wb");
+        uint8_t rows[VIEW_BAND_ROWS * VIEW_WIDTH * 3];
+
+        if (!f) {
+                return false;
+        }
+
+        fprintf(f, "P6\n%d %u\n255\n", VIEW_WIDTH, cnt * VIEW_BAND_ROWS);
+        for (uint32_t i = 0; i < cnt; i++) {
+                draw_snapshot(rows, &snaps[i]);
+                fwrite(rows, 1, sizeof(rows), f);
+        }
+
+        return fclose(f) == 0;
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+int main(int argc, char *argv[])
+{
+        view_snapshot_t *snaps = NULL;
+        uint32_t snap_cnt = 0, snap_size = 0;
+        const uint8_t *p, *end;
+        uint32_t last_time;
+        uint8_t *data;
+        size_t size;
+
+        if (argc != 3) {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+
+        data = read_file(argv[1], &size);
+        if (!data) {
+                perror(argv[1]);
+                return EXIT_FAILURE;
+        }
+        p = data;
+        end = data + size;
+
+        /* The maps are little endian, as the host. A snapshot cut by the end of the file is dropped. */
+        while ((size_t)(end - p) >= sizeof(lv_mem_map_header_t)) {
+                view_snapshot_t snap;
+
+                memcpy(&snap.header, p, sizeof(snap.header));
+                if (memcmp(snap.header.magic, LV_MEM_MAP_MAGIC, sizeof(snap.header.magic)) ||
+                                snap.header.version != LV_MEM_MAP_VERSION) {
+                        fprintf(stderr, "%s: not a heap map, or of another version\n", argv[1]);
+                        return EXIT_FAILURE;
+                }
+                p += sizeof(snap.header);
+                if ((size_t)(end - p) < (size_t)snap.header.block_cnt * sizeof(lv_mem_map_block_t)) {
+                        break;
+                }
+                snap.blocks = (const lv_mem_map_block_t *)p;
+                p += snap.header.block_cnt * sizeof(lv_mem_map_block_t);
+
+                if (snap_cnt == snap_size) {
+                        snap_size = snap_size ? snap_size * 2 : 64;
+                        snaps = realloc(snaps, snap_size * sizeof(view_snapshot_t));
+                        if (!snaps) {
+                                return EXIT_FAILURE;
+                        }
+                }
+                snaps[snap_cnt++] = snap;
+        }
+        if (snap_cnt == 0) {
+                fprintf(stderr, "%s: no snapshot\n", argv[1]);
+                return EXIT_FAILURE;
+        }
+
+        printf("%10s %-6s %8s %8s %8s %12s %6s\n", "Time ms", "Pool", "Size", "Used", "Free blk",
+                "Largest free", "Frag");
+        for (uint32_t i = 0; i < snap_cnt; i++) {
+                print_snapshot(&snaps[i]);
+        }
+
+        if (!write_ppm(argv[2], snaps, snap_cnt)) {
+                perror(argv[2]);
+                return EXIT_FAILURE;
+        }
+        printf("%u snapshots written to %s\n", snap_cnt, argv[2]);
+
+        /* The snapshots of all the pools taken at the last time */
+        last_time = snaps[snap_cnt - 1].header.time;
+        for (uint32_t i = snap_cnt; i-- > 0 && snaps[i].header.time == last_time;) {
+                if (!snaps[i].header.tagged) {
+                        continue;
+                }
+                for (uint32_t b = 0; b < snaps[i].header.block_cnt; b++) {
+                        if (snaps[i].blocks[b].site) {
+                                site_add(snaps[i].blocks[b].site, snaps[i].blocks[b].size);
+                        }
+                }
+        }
+        if (site_cnt) {
+                qsort(sites, site_cnt, sizeof(view_site_t), site_cmp);
+                printf("\n%-24s %8s %10s\n", "Site - lv_mem_alloc", "Blocks", "Bytes");
+                for (int i = 0; i < site_cnt; i++) {
+                        int64_t rel = (int64_t)(sites[i].site - snaps[snap_cnt - 1].header.site_base);
+
+                        printf("%c0x%-21llx %8u %10u\n", rel < 0 ? '-' : '+',
+                                (unsigned long long)(rel < 0 ? -rel : rel), sites[i].cnt, sites[i].size);
+                }
+        }
+
+        free(snaps);
+        free(data);
+
+        return EXIT_SUCCESS;
+}
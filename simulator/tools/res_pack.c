@@ -0,0 +1,541 @@
+/**
+ ****************************************************************************************
+ *
+ * @file res_pack.c
+ *
+ * @brief Host packer of the demo resource bundle
+ *
+ * Reads the PNGs listed in a manifest, converts them to the color format given there and writes
+ * them to a resource bundle (see ui/demo/resources/res_bundle.h), together with the header of
+ * the image IDs included by Resources.c. The images marked "rle" in the manifest are compressed
+ * with the D/AVE2D RLE format, the others are stored as they are.
+ *
+ * The 1, 2 and 4 bpp images are stored in the bit order of the D/AVE2D, first pixel in the low
+ * bits, so that the GPU reads them in place. With -l they are stored in the LVGL order instead,
+ * for the builds with DLG_LVGL_CF_SUB_BYTE_SWAP, where the GPU port reorders them at draw time.
+ *
+ * The RLE packets never cross a row, which keeps the line by line decoding of the CPU simple.
+ * Every packed image is decoded again and compared with the input, and the written bundle goes
+ * through the checks of the firmware.
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <png.h>
+#include "lvgl.h"
+#include "res_bundle.h"
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#define PACK_MAX_IMAGES                 (64)
+#define PACK_MAX_NAME                   (32)
+#define PACK_MAX_PATH                   (256)
+#define PACK_RLE_MAX_RUN                (128)
+
+/*
+ *       Types
+ *****************************************************************************************
+ */
+typedef struct {
+        char name[PACK_MAX_NAME];
+        char path[PACK_MAX_PATH];
+        lv_img_cf_t cf;
+        int bpp;
+        int px_size;                    /* Bytes, the RLE unit. 0: sub-byte pixels */
+        bool rle;
+        res_bundle_entry_t entry;
+        uint8_t *data;                  /* As stored in the bundle */
+} pack_entry_t;
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+static pack_entry_t entries[PACK_MAX_IMAGES];
+static int entry_cnt;
+static bool msb_first;
+
+/* Color formats without palette. The sub-byte ones are only stored raw. */
+static const struct {
+        const char *name;
+        lv_img_cf_t cf;
+        int bpp;
+} formats[] = {
+        { "TRUE_COLOR",       LV_IMG_CF_TRUE_COLOR,       LV_COLOR_SIZE },
+        { "TRUE_COLOR_ALPHA", LV_IMG_CF_TRUE_COLOR_ALPHA, LV_IMG_PX_SIZE_ALPHA_BYTE * 8 },
+        { "ALPHA_1BIT",       LV_IMG_CF_ALPHA_1BIT,       1 },
+        { "ALPHA_2BIT",       LV_IMG_CF_ALPHA_2BIT,       2 },
+        { "ALPHA_4BIT",       LV_IMG_CF_ALPHA_4BIT,       4 },
+        { "ALPHA_8BIT",       LV_IMG_CF_ALPHA_8BIT,       8 },
+        { "ARGB8888",         LV_IMG_CF_ARGB8888,         32 },
+        { "RGB565",           LV_IMG_CF_RGB565,           16 },
+};
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static void usage(const char *prog)
+{
+        fprintf(stderr,
+                "Usage: %s -m manifest.txt -o bundle.bin -H ids.h [-l]\n"
+                "  -m  one line per image, in ID order: <ID> <PNG> <color format> raw|rle\n"
+                "      the PNG paths are relative to the manifest\n"
+                "  -o  resource bundle to write\n"
+                "  -H  header of the image IDs to write\n"
+                "  -l  store the 1, 2 and 4 bpp pixels in the LVGL bit order (DLG_LVGL_CF_SUB_BYTE_SWAP)\n",
+                prog);
+}
+
+static const char *base_name(const char *path)
+{
+        const char *p = strrchr(path, '/');
+
+        return p ? p + 1 : path;
+}
+
+static bool read_manifest(const char *path)
+{
+        FILE *f = fopen(path, "r");
+        int dir_len = (int)(base_name(path) - path);
+        char line[256];
+
+        if (!f) {
+                perror(path);
+                return false;
+        }
+
+        while (fgets(line, sizeof(line), f)) {
+                pack_entry_t *e = &entries[entry_cnt];
+                char name[PACK_MAX_NAME];
+                char png[128];
+                char format[20];
+                char mode[8];
+                char *comment = strchr(line, '#');
+                size_t i;
+
+                if (comment) {
+                        *comment = '\0';
+                }
+                if (sscanf(line, "%31s %127s %19s %7s", name, png, format, mode) != 4) {
+                        continue;
+                }
+                for (i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+                        if (!strcmp(format, formats[i].name)) {
+                                break;
+                        }
+                }
+                if (entry_cnt == PACK_MAX_IMAGES || i == sizeof(formats) / sizeof(formats[0]) ||
+                                (strcmp(mode, "raw") && strcmp(mode, "rle")) ||
+                                (formats[i].bpp < 8 && strcmp(mode, "raw"))) {
+                        fprintf(stderr, "%s: bad entry %s %s %s %s\n", path, name, png, format, mode);
+                        fclose(f);
+                        return false;
+                }
+                strcpy(e->name, name);
+                snprintf(e->path, sizeof(e->path), "%.*s%s", dir_len, path, png);
+                e->cf = formats[i].cf;
+                e->bpp = formats[i].bpp;
+                e->px_size = formats[i].bpp / 8;
+                e->rle = !strcmp(mode, "rle");
+                entry_cnt++;
+        }
+
+        fclose(f);
+
+        return true;
+}
+
+/* 8-bit RGBA pixels of a PNG, whatever its format */
+static uint8_t *load_png(const char *path, int *w, int *h)
+{
+        png_image image;
+        uint8_t *rgba;
+
+        memset(&image, 0, sizeof(image));
+        image.version = PNG_IMAGE_VERSION;
+        if (!png_image_begin_read_from_file(&image, path)) {
+                fprintf(stderr, "%s: %s\n", path, image.message);
+                return NULL;
+        }
+        image.format = PNG_FORMAT_RGBA;
+
+        rgba = malloc(PNG_IMAGE_SIZE(image));
+        if (!rgba || !png_image_finish_read(&image, NULL, rgba, 0, NULL)) {
+                fprintf(stderr, "%s: %s\n", path, image.message);
+                free(rgba);
+                png_image_free(&image);
+                return NULL;
+        }
+        *w = image.width;
+        *h = image.height;
+
+        return rgba;
+}
+
+/* Convert a pixel to the color format of the entry, little endian */
+static void convert_px(const pack_entry_t *e, const uint8_t *rgba, uint8_t *px)
+{
+        uint8_t r = rgba[0], g = rgba[1], b = rgba[2], a = rgba[3];
+        lv_color_t c;
+        uint16_t c16;
+
+        switch (e->cf) {
+        case LV_IMG_CF_TRUE_COLOR:
+                /* No alpha channel, blend with black */
+                c = lv_color_make((r * a + 127) / 255, (g * a + 127) / 255, (b * a + 127) / 255);
+                memcpy(px, &c, sizeof(c));
+                break;
+        case LV_IMG_CF_TRUE_COLOR_ALPHA:
+                c = lv_color_make(r, g, b);
+                memcpy(px, &c, sizeof(c));
+                px[sizeof(c)] = a;
+                break;
+        case LV_IMG_CF_ALPHA_8BIT:
+                px[0] = a;
+                break;
+        case LV_IMG_CF_ARGB8888:
+                /* The transparent pixels are all the same, which helps the RLE */
+                px[0] = a ? b : 0;
+                px[1] = a ? g : 0;
+                px[2] = a ? r : 0;
+                px[3] = a;
+                break;
+        case LV_IMG_CF_RGB565:
+                c16 = (r >> 3) << 11 | (g >> 2) << 5 | b >> 3;
+                px[0] = c16 & 0xFF;
+                px[1] = c16 >> 8;
+                break;
+        default:
+                break;
+        }
+}
+
+/* Store the opacity of pixel x of a row of sub-byte pixels */
+static void pack_sub_byte(const pack_entry_t *e, uint8_t *row, int x, uint8_t a)
+{
+        int px_per_byte = 8 / e->bpp;
+        int shift = (x % px_per_byte) * e->bpp;
+
+        if (msb_first) {
+                shift = 8 - e->bpp - shift;
+        }
+        row[x / px_per_byte] |= (a >> (8 - e->bpp)) << shift;
+}
+
+/* Longest run of identical units starting at x, at most PACK_RLE_MAX_RUN */
+static int run_length(const uint8_t *row, int x, int w, int unit)
+{
+        int n = 1;
+
+        while (x + n < w && n < PACK_RLE_MAX_RUN && !memcmp(row + x * unit, row + (x + n) * unit, unit)) {
+                n++;
+        }
+
+        return n;
+}
+
+/* Encode the rows of an image, returns the size of the compressed data */
+static size_t rle_encode(const uint8_t *src, int w, int h, int unit, uint8_t *dst)
+{
+        size_t size = 0;
+
+        for (int y = 0; y < h; y++) {
+                const uint8_t *row = src + (size_t)y * w * unit;
+                int x = 0;
+
+                while (x < w) {
+                        int n = run_length(row, x, w, unit);
+
+                        if (n > 1) {
+                                dst[size++] = 0x80 | (n - 1);
+                                memcpy(dst + size, row + x * unit, unit);
+                                size += unit;
+                                x += n;
+                                continue;
+                        }
+
+                        /* Literal pixels up to the next run */
+                        n = 1;
+                        while (x + n < w && n < PACK_RLE_MAX_RUN && run_length(row, x + n, w, unit) == 1) {
+                                n++;
+                        }
+                        dst[size++] = n - 1;
+                        memcpy(dst + size, row + x * unit, (size_t)n * unit);
+                        size += (size_t)n * unit;
+                        x += n;
+                }
+        }
+
+        return size;
+}
+
+static bool rle_check(const uint8_t *rle, size_t rle_size, const uint8_t *raw, size_t raw_size, int unit)
+{
+        uint8_t *out = malloc(raw_size);
+        size_t pos = 0;
+        size_t i = 0;
+        bool ok;
+
+        if (!out) {
+                return false;
+        }
+
+        while (i < rle_size && pos < raw_size) {
+                uint8_t ctrl = rle[i++];
+                size_t n = (size_t)(ctrl & 0x7F) + 1;
+
+                if (pos + n * unit > raw_size) {
+                        break;
+                }
+                if (ctrl & 0x80) {
+                        for (; n; n--, pos += unit) {
+                                memcpy(out + pos, rle + i, unit);
+                        }
+                        i += unit;
+                } else {
+                        memcpy(out + pos, rle + i, n * unit);
+                        i += n * unit;
+                        pos += n * unit;
+                }
+        }
+
+        ok = i == rle_size && pos == raw_size && !memcmp(out, raw, raw_size);
+        free(out);
+
+        return ok;
+}
+
+/* Load, convert and compress an image */
+static bool pack_image(pack_entry_t *e)
+{
+        int w, h;
+        uint8_t *rgba = load_png(e->path, &w, &h);
+        uint8_t *raw;
+        size_t stride, raw_size;
+
+        if (!rgba) {
+                return false;
+        }
+        stride = ((size_t)w * e->bpp + 7) / 8;
+        if (w > UINT16_MAX || h > UINT16_MAX || stride > UINT16_MAX) {
+                fprintf(stderr, "%s: %d x %d is too large\n", e->path, w, h);
+                free(rgba);
+                return false;
+        }
+
+        raw_size = stride * h;
+        raw = calloc(1, raw_size);
+        if (!raw) {
+                free(rgba);
+                return false;
+        }
+        for (size_t i = 0; i < (size_t)w * h; i++) {
+                if (e->px_size) {
+                        convert_px(e, rgba + i * 4, raw + i * e->px_size);
+                } else {
+                        /* The rows start on a byte */
+                        pack_sub_byte(e, raw + i / w * stride, i % w, rgba[i * 4 + 3]);
+                }
+        }
+        free(rgba);
+
+        e->entry.w = w;
+        e->entry.h = h;
+        e->entry.cf = e->cf;
+
+        if (!e->rle) {
+                e->entry.comp = RES_BUNDLE_COMP_NONE;
+                e->entry.stride = stride;
+                e->entry.size = raw_size;
+                e->data = raw;
+                return true;
+        }
+
+        /* Worst case: a control byte per PACK_RLE_MAX_RUN pixels, at least one per row */
+        e->data = malloc(raw_size + ((size_t)w / PACK_RLE_MAX_RUN + 1) * h);
+        if (!e->data) {
+                free(raw);
+                return false;
+        }
+        e->entry.comp = RES_BUNDLE_COMP_RLE;
+        e->entry.stride = 0;
+        e->entry.size = rle_encode(raw, w, h, e->px_size, e->data);
+        if (!rle_check(e->data, e->entry.size, raw, raw_size, e->px_size)) {
+                fprintf(stderr, "%s: RLE check failed\n", e->name);
+                free(raw);
+                return false;
+        }
+        free(raw);
+
+        return true;
+}
+
+/* The bundle in memory, with the header, the index and the aligned pixels */
+static uint8_t *build_bundle(size_t *size)
+{
+        res_bundle_header_t header = {
+                .magic = RES_BUNDLE_MAGIC,
+                .version = RES_BUNDLE_VERSION,
+                .count = entry_cnt,
+                .flags = msb_first ? RES_BUNDLE_FLAG_MSB_FIRST : 0,
+        };
+        res_bundle_entry_t index[PACK_MAX_IMAGES];
+        size_t pos = sizeof(header) + entry_cnt * sizeof(res_bundle_entry_t);
+        uint8_t *bundle;
+
+        for (int i = 0; i < entry_cnt; i++) {
+                pos = (pos + RES_BUNDLE_ALIGN - 1) & ~(size_t)(RES_BUNDLE_ALIGN - 1);
+                entries[i].entry.offset = pos;
+                entries[i].entry.crc = res_bundle_crc32(0, entries[i].data, entries[i].entry.size);
+                index[i] = entries[i].entry;
+                pos += entries[i].entry.size;
+
+                /* The names with their terminator, a change of ID changes the CRC */
+                header.ids_crc = res_bundle_crc32(header.ids_crc, entries[i].name, strlen(entries[i].name) + 1);
+        }
+        header.size = pos;
+        header.index_crc = res_bundle_crc32(0, index, entry_cnt * sizeof(res_bundle_entry_t));
+
+        bundle = calloc(1, pos);
+        if (!bundle) {
+                return NULL;
+        }
+        memcpy(bundle, &header, sizeof(header));
+        memcpy(bundle + sizeof(header), index, entry_cnt * sizeof(res_bundle_entry_t));
+        for (int i = 0; i < entry_cnt; i++) {
+                memcpy(bundle + index[i].offset, entries[i].data, index[i].size);
+        }
+        *size = pos;
+
+        return bundle;
+}
+
+static bool write_ids(const char *path, const char *bundle_path, const char *manifest_path, uint32_t ids_crc)
+{
+        FILE *f = fopen(path, "w");
+        char guard[PACK_MAX_PATH];
+        const char *name = base_name(path);
+        size_t i;
+
+        if (!f) {
+                perror(path);
+                return false;
+        }
+
+        for (i = 0; name[i] && i < sizeof(guard) - 3; i++) {
+                guard[i] = isalnum((unsigned char)name[i]) ? toupper((unsigned char)name[i]) : '_';
+        }
+        strcpy(guard + i, "__");
+
+        fprintf(f, "/* Image IDs of %s\n * Generated by res_pack from %s, do not edit. */\n",
+                base_name(bundle_path), base_name(manifest_path));
+        fprintf(f, "#ifndef %s\n#define %s\n\n", guard, guard);
+        fprintf(f, "typedef enum {\n");
+        for (int j = 0; j < entry_cnt; j++) {
+                fprintf(f, "        RES_ID_%s,\n", entries[j].name);
+        }
+        fprintf(f, "        RES_ID_COUNT\n} res_id_t;\n\n");
+        fprintf(f, "/* CRC32 of the IDs, checked against the bundle */\n");
+        fprintf(f, "#define %-31s (0x%08X)\n\n", "RES_BUNDLE_IDS_CRC", ids_crc);
+        fprintf(f, "#endif /* %s */\n", guard);
+
+        return fclose(f) == 0;
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+int main(int argc, char *argv[])
+{
+        const char *manifest_path = NULL, *out_path = NULL, *ids_path = NULL;
+        size_t size, raw_total = 0;
+        res_bundle_err_t err;
+        uint8_t *bundle;
+        FILE *out;
+        int opt;
+
+        while ((opt = getopt(argc, argv, "m:o:H:lh")) != -1) {
+                switch (opt) {
+                case 'm':
+                        manifest_path = optarg;
+                        break;
+                case 'o':
+                        out_path = optarg;
+                        break;
+                case 'H':
+                        ids_path = optarg;
+                        break;
+                case 'l':
+                        msb_first = true;
+                        break;
+                default:
+                        usage(argv[0]);
+                        return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+                }
+        }
+        if (!manifest_path || !out_path || !ids_path) {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+
+        if (!read_manifest(manifest_path)) {
+                return EXIT_FAILURE;
+        }
+
+        for (int i = 0; i < entry_cnt; i++) {
+                pack_entry_t *e = &entries[i];
+                size_t raw_size;
+
+                if (!pack_image(e)) {
+                        return EXIT_FAILURE;
+                }
+                raw_size = ((size_t)e->entry.w * e->bpp + 7) / 8 * e->entry.h;
+                raw_total += raw_size;
+                printf("%-16s %3d x %-3d cf %2d %7zu -> %7u bytes (%3zu%%)\n", e->name, e->entry.w, e->entry.h,
+                       e->cf, raw_size, e->entry.size, e->entry.size * 100 / raw_size);
+        }
+
+        bundle = build_bundle(&size);
+        if (!bundle) {
+                return EXIT_FAILURE;
+        }
+
+        /* Same checks as Resources.c at start-up */
+        err = res_bundle_check((const res_bundle_header_t *)bundle, size, true);
+        if (err != RES_BUNDLE_OK) {
+                fprintf(stderr, "%s: check failed (%d)\n", out_path, err);
+                return EXIT_FAILURE;
+        }
+
+        out = fopen(out_path, "wb");
+        if (!out || fwrite(bundle, 1, size, out) != size || fclose(out)) {
+                perror(out_path);
+                return EXIT_FAILURE;
+        }
+        if (!write_ids(ids_path, out_path, manifest_path,
+                       ((const res_bundle_header_t *)bundle)->ids_crc)) {
+                return EXIT_FAILURE;
+        }
+
+        printf("%d images, %zu -> %zu bytes\n", entry_cnt, raw_total, size);
+
+        for (int i = 0; i < entry_cnt; i++) {
+                free(entries[i].data);
+        }
+        free(bundle);
+
+        return EXIT_SUCCESS;
+}
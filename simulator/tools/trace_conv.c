@@ -0,0 +1,313 @@
+/**
+ ****************************************************************************************
+ *
+ * @file trace_conv.c
+ *
+ * @brief Host converter of the profiler dumps
+ *
+ * Reads a dump of lv_profiler_dump() (simulator option -p, or the bytes written by the target)
+ * and writes it as a Chrome trace JSON, which chrome://tracing and ui.perfetto.dev open. Each track
+ * of the profiler becomes a thread, the scopes become slices and the marks instant events. The time
+ * stamps are unwrapped from one event to the next and shown from the first event.
+ *
+ * The duration of the scopes is summed up on the console with its percentiles. The scopes cut by
+ * the ring, which lost their beginning, are left out.
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#define CONV_MAX_NAMES                  (256)
+#define CONV_MAX_DEPTH                  (64)
+#define CONV_TIME_BITS                  (40)
+#define CONV_TIME_MASK                  ((1ULL << CONV_TIME_BITS) - 1)
+
+/*
+ *       Types
+ *****************************************************************************************
+ */
+typedef struct {
+        uint64_t time;                  /* ns, unwrapped */
+        uint32_t index;                 /* In the dump, keeps the order of equal times */
+        lv_profiler_event_type_t type;
+        uint8_t id;
+        uint8_t track;
+} conv_event_t;
+
+typedef struct {
+        uint64_t *durations;
+        uint32_t cnt, size;
+} conv_stat_t;
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+static char id_names[CONV_MAX_NAMES][256];
+static char track_names[CONV_MAX_NAMES][256];
+static conv_stat_t stats[CONV_MAX_NAMES];
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static void usage(const char *prog)
+{
+        fprintf(stderr,
+                "Usage: %s profile.bin trace.json\n"
+                "  Convert a dump of the event profiler to a Chrome trace / Perfetto JSON\n",
+                prog);
+}
+
+static uint8_t *read_file(const char *path, size_t *size)
+{
+        FILE *f = fopen(path, "rb");
+        uint8_t *data;
+        long len;
+
+        if (!f) {
+                return NULL;
+        }
+        fseek(f, 0, SEEK_END);
+        len = ftell(f);
+        fseek(f, 0, SEEK_SET);
+
+        data = malloc(len > 0 ? len : 1);
+        if (data && fread(data, 1, len, f) != (size_t)len) {
+                free(data);
+                data = NULL;
+        }
+        fclose(f);
+        *size = len;
+
+        return data;
+}
+
+/* The names follow the header, as a length byte and the characters */
+static const uint8_t *read_names(const uint8_t *p, const uint8_t *end, char names[][256], int cnt)
+{
+        for (int i = 0; i < cnt; i++) {
+                if (p >= end || p + 1 + p[0] > end) {
+                        return NULL;
+                }
+                memcpy(names[i], p + 1, p[0]);
+                names[i][p[0]] = '\0';
+                p += 1 + p[0];
+        }
+
+        return p;
+}
+
+static int event_cmp(const void *a, const void *b)
+{
+        const conv_event_t *ea = a, *eb = b;
+
+        if (ea->time != eb->time) {
+                return ea->time < eb->time ? -1 : 1;
+        }
+
+        return ea->index < eb->index ? -1 : ea->index > eb->index;
+}
+
+static int duration_cmp(const void *a, const void *b)
+{
+        uint64_t da = *(const uint64_t *)a, db = *(const uint64_t *)b;
+
+        return da < db ? -1 : da > db;
+}
+
+static void stat_add(conv_stat_t *stat, uint64_t duration)
+{
+        if (stat->cnt == stat->size) {
+                stat->size = stat->size ? stat->size * 2 : 256;
+                stat->durations = realloc(stat->durations, stat->size * sizeof(uint64_t));
+        }
+        stat->durations[stat->cnt++] = duration;
+}
+
+static void print_stats(int id_cnt)
+{
+        printf("%-40s %8s %12s %10s %10s %10s\n", "Scope", "Count", "Total ms", "p50 us", "p95 us", "p99 us");
+        for (int id = 0; id < id_cnt; id++) {
+                conv_stat_t *stat = &stats[id];
+                uint64_t total = 0;
+
+                if (stat->cnt == 0) {
+                        continue;
+                }
+                qsort(stat->durations, stat->cnt, sizeof(uint64_t), duration_cmp);
+                for (uint32_t i = 0; i < stat->cnt; i++) {
+                        total += stat->durations[i];
+                }
+                printf("%-40s %8u %12.3f %10.3f %10.3f %10.3f\n", id_names[id], stat->cnt, total / 1e6,
+                        stat->durations[(stat->cnt - 1) * 50 / 100] / 1e3,
+                        stat->durations[(stat->cnt - 1) * 95 / 100] / 1e3,
+                        stat->durations[(stat->cnt - 1) * 99 / 100] / 1e3);
+        }
+}
+
+/* Strings are written as they are, the names of the profiler have no quote nor backslash */
+static bool write_json(const char *path, const conv_event_t *events, uint32_t cnt, int track_cnt)
+{
+        FILE *f = fopen(path, "w");
+        uint8_t stack[CONV_MAX_NAMES][CONV_MAX_DEPTH];
+        uint64_t begin[CONV_MAX_NAMES][CONV_MAX_DEPTH];
+        int depth[CONV_MAX_NAMES] = { 0 };
+        uint64_t start = cnt ? events[0].time : 0;
+        uint64_t last = cnt ? events[cnt - 1].time : 0;
+
+        if (!f) {
+                return false;
+        }
+
+        fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+        for (int t = 0; t < track_cnt; t++) {
+                fprintf(f, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}},\n",
+                        t, track_names[t]);
+                fprintf(f, "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"sort_index\":%d}},\n",
+                        t, t);
+        }
+
+        for (uint32_t i = 0; i < cnt; i++) {
+                const conv_event_t *e = &events[i];
+                double ts = (e->time - start) / 1e3;
+                int t = e->track;
+
+                switch (e->type) {
+                case LV_PROFILER_EVENT_BEGIN:
+                        if (depth[t] < CONV_MAX_DEPTH) {
+                                stack[t][depth[t]] = e->id;
+                                begin[t][depth[t]] = e->time;
+                        }
+                        depth[t]++;
+                        fprintf(f, "{\"name\":\"%s\",\"ph\":\"B\",\"pid\":1,\"tid\":%d,\"ts\":%.3f},\n",
+                                id_names[e->id], t, ts);
+                        break;
+                case LV_PROFILER_EVENT_END:
+                        /* The beginning was overwritten in the ring */
+                        if (depth[t] == 0) {
+                                break;
+                        }
+                        depth[t]--;
+                        if (depth[t] < CONV_MAX_DEPTH) {
+                                stat_add(&stats[stack[t][depth[t]]], e->time - begin[t][depth[t]]);
+                        }
+                        fprintf(f, "{\"ph\":\"E\",\"pid\":1,\"tid\":%d,\"ts\":%.3f},\n", t, ts);
+                        break;
+                default:
+                        fprintf(f, "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.3f},\n",
+                                id_names[e->id], t, ts);
+                        break;
+                }
+        }
+
+        /* Close the scopes still running at the dump */
+        for (int t = 0; t < track_cnt; t++) {
+                while (depth[t]-- > 0) {
+                        fprintf(f, "{\"ph\":\"E\",\"pid\":1,\"tid\":%d,\"ts\":%.3f},\n", t, (last - start) / 1e3);
+                }
+        }
+        fprintf(f, "{\"name\":\"end\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f}\n]}\n",
+                (last - start) / 1e3);
+
+        return fclose(f) == 0;
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+int main(int argc, char *argv[])
+{
+        lv_profiler_dump_header_t header;
+        const lv_profiler_event_t *raw;
+        conv_event_t *events;
+        const uint8_t *p, *end;
+        uint8_t *data;
+        size_t size;
+        uint64_t prev = 0;
+
+        if (argc != 3) {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+
+        data = read_file(argv[1], &size);
+        if (!data) {
+                perror(argv[1]);
+                return EXIT_FAILURE;
+        }
+        end = data + size;
+
+        /* The dump is little endian, as the host */
+        if (size < sizeof(header)) {
+                fprintf(stderr, "%s: truncated\n", argv[1]);
+                return EXIT_FAILURE;
+        }
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.magic, LV_PROFILER_DUMP_MAGIC, sizeof(header.magic)) ||
+                        header.version != LV_PROFILER_DUMP_VERSION ||
+                        header.event_size != sizeof(lv_profiler_event_t) ||
+                        header.id_cnt > CONV_MAX_NAMES || header.track_cnt > CONV_MAX_NAMES) {
+                fprintf(stderr, "%s: not a dump of the profiler, or of another version\n", argv[1]);
+                return EXIT_FAILURE;
+        }
+
+        p = read_names(data + sizeof(header), end, id_names, header.id_cnt);
+        if (p) {
+                p = read_names(p, end, track_names, header.track_cnt);
+        }
+        if (!p || (size_t)(end - p) < (size_t)header.event_cnt * sizeof(lv_profiler_event_t)) {
+                fprintf(stderr, "%s: truncated\n", argv[1]);
+                return EXIT_FAILURE;
+        }
+        raw = (const lv_profiler_event_t *)p;
+
+        events = malloc((header.event_cnt ? header.event_cnt : 1) * sizeof(conv_event_t));
+        if (!events) {
+                return EXIT_FAILURE;
+        }
+        for (uint32_t i = 0; i < header.event_cnt; i++) {
+                uint64_t time = ((uint64_t)raw[i].time_hi << 32) | raw[i].time;
+                /* Signed distance to the previous event within the 40 bits */
+                int64_t delta = (int64_t)(((time - prev) & CONV_TIME_MASK) << (64 - CONV_TIME_BITS))
+                        >> (64 - CONV_TIME_BITS);
+
+                prev = i ? prev + delta : time;
+                events[i].time = prev;
+                events[i].index = i;
+                events[i].type = raw[i].type;
+                events[i].id = raw[i].id < header.id_cnt ? raw[i].id : 0;
+                events[i].track = raw[i].track < header.track_cnt ? raw[i].track : 0;
+        }
+
+        /* The threads and the interrupts record concurrently, the ring is only almost in order */
+        qsort(events, header.event_cnt, sizeof(conv_event_t), event_cmp);
+
+        if (!write_json(argv[2], events, header.event_cnt, header.track_cnt)) {
+                perror(argv[2]);
+                return EXIT_FAILURE;
+        }
+
+        printf("%u events (%u lost) over %.3f ms written to %s\n", header.event_cnt, header.lost_cnt,
+                header.event_cnt ? (events[header.event_cnt - 1].time - events[0].time) / 1e6 : 0.0, argv[2]);
+        print_stats(header.id_cnt);
+
+        free(events);
+        free(data);
+
+        return EXIT_SUCCESS;
+}
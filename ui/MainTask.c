@@ -19,13 +19,18 @@
 #include "lv_port_disp.h"
 #include "lv_port_indev.h"
 #include "init_screens.h"
+#include "Resources.h"
 #include "screens/compass_screen.h"
+#ifdef PERFORMANCE_METRICS
+#include "metrics.h"
+#endif
 
 /*
  *       Defines
  *****************************************************************************************
  */
 #define MAGNETIC_DATA_EVT       (1 << 3)
+#define TOUCH_EVT               (1 << 4)
 
 /*
  *       Static
@@ -40,12 +45,22 @@ static int16_t mag_data;
  *****************************************************************************************
  */
 
+/* Called by the touch driver, the reading of the touchpad being paused while it is not touched */
+static void touch_wake(void)
+{
+        OS_TASK_NOTIFY(gui_task_h, TOUCH_EVT, OS_NOTIFY_SET_BITS);
+}
+
 /**
  * @brief  Start task
  * @param  pvParameters: pointer that is passed to the thread function as start argument.
  */
 static OS_TASK_FUNCTION(GUIThread, pvParameters)
 {
+#ifdef PERFORMANCE_METRICS
+        uint64_t wake_time;
+#endif
+
         /* Initialize GUI */
         lv_init();
 
@@ -54,19 +69,39 @@ static OS_TASK_FUNCTION(GUIThread, pvParameters)
 
         /* Initialize input driver */
         lv_port_indev_init();
+        lv_port_indev_set_wake_cb(touch_wake);
+
+        /* Map the images of the resource bundle */
+        resources_init();
 
         create_basic_screens();
 
+#ifdef PERFORMANCE_METRICS
+        wake_time = gdi_get_sys_uptime_ticks();
+#endif
         while (1) {
                 uint32_t notif, sleep_time;
 
                 sleep_time = lv_task_handler();
 
+                /* The refresh timer only runs after an invalidation and the touchpad is read after a
+                 * touch event, without a timer due the thread sleeps until it is notified */
                 if (LV_NO_TIMER_READY == sleep_time) {
-                        sleep_time = OS_TASK_NOTIFY_NO_WAIT;
+                        sleep_time = OS_TASK_NOTIFY_FOREVER;
+                } else {
+                        sleep_time = OS_MS_2_TICKS(sleep_time);
                 }
 
-                OS_TASK_NOTIFY_WAIT(0, OS_TASK_NOTIFY_ALL_BITS, &notif, OS_MS_2_TICKS(sleep_time));
+#ifdef PERFORMANCE_METRICS
+                metrics_gui_wakeup(gdi_convert_ticks_to_us(gdi_get_sys_uptime_ticks() - wake_time));
+#endif
+                OS_TASK_NOTIFY_WAIT(0, OS_TASK_NOTIFY_ALL_BITS, &notif, sleep_time);
+#ifdef PERFORMANCE_METRICS
+                wake_time = gdi_get_sys_uptime_ticks();
+#endif
+                if ((notif & TOUCH_EVT)) {
+                        lv_port_indev_resume();
+                }
                 if ((notif & MAGNETIC_DATA_EVT)){
                         int16_t mag_data_loc;
                         OS_ENTER_CRITICAL_SECTION();
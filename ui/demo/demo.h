@@ -26,10 +26,20 @@
 
 #define TWO_LAYERS_HORIZONTAL_SLIDING   (1)
 
-#if !COMPASS_ROTATION_USES_CANVAS
+#define SCREEN_TRANSITION_TIME          (300)
+
+#ifndef DEMO_GUI_HEAP_SIZE
 #define DEMO_GUI_HEAP_SIZE              (15 * 1024)
+#endif
+
+/* The buffer of the compass canvas (about 300 KB) is allocated from a region of its own. TLSF
+ * rounds the requests up by 1/32 of their size class to find a free block, hence the margin. */
+#ifndef DEMO_GUI_LARGE_HEAP_SIZE
+#if COMPASS_ROTATION_USES_CANVAS
+#define DEMO_GUI_LARGE_HEAP_SIZE        (320 * 1024)
 #else
-#define DEMO_GUI_HEAP_SIZE              (320 * 1024)
+#define DEMO_GUI_LARGE_HEAP_SIZE        (0)
+#endif
 #endif
 
 #ifndef PERFORMANCE_METRICS
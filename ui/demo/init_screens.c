@@ -91,22 +91,12 @@ static void lv_propagate_to_children(lv_obj_t *parent, lv_event_code_t code)
 
 static void scroll_event_cb(lv_event_t *e)
 {
-        static lv_coord_t prev_sx = 0;
         static int completed_scroll_cnt = 0;
-        lv_coord_t scroll_dx, sx;
         lv_event_code_t code = lv_event_get_code(e);
 
-#if TWO_LAYERS_HORIZONTAL_SLIDING
-        static int position = 0;
-        int posXLayer0 = 0, posXLayer1 = DEMO_RESX;
-        static lv_dir_t dir = LV_DIR_NONE;
-#endif
-
         if (code == LV_EVENT_SCROLL_BEGIN || code == LV_EVENT_SCROLL
                 || code == LV_EVENT_SCROLL_END) {
                 lv_obj_t *obj = lv_event_get_target(e);
-                sx = lv_obj_get_scroll_x(obj);
-                scroll_dx = prev_sx - sx;
 
                 if (code == LV_EVENT_SCROLL_BEGIN) {
                         if (completed_scroll_cnt == 0) {
@@ -118,46 +108,22 @@ static void scroll_event_cb(lv_event_t *e)
 #endif
 
 #if TWO_LAYERS_HORIZONTAL_SLIDING
-                                /* Change Rect values of all related windows to draw the second FB */
+                                /* Slide the pages with the LCDC layers instead of rendering each step */
                                 if (lv_obj_get_scroll_right(obj) == DEMO_RESX) { //watch -> menu
-                                        dir = LV_DIR_RIGHT;
+                                        lv_port_disp_trans_scroll(obj, LV_PORT_DISP_TRANS_SLIDE, LV_DIR_RIGHT);
                                 }
                                 else if (lv_obj_get_scroll_left(obj) == DEMO_RESX) { //menu -> watch
-                                        dir = LV_DIR_LEFT;
+                                        lv_port_disp_trans_scroll(obj, LV_PORT_DISP_TRANS_SLIDE, LV_DIR_LEFT);
                                 }
-
-                                lv_port_disp_slide_init(obj, dir);
 #endif
                         }
                         completed_scroll_cnt++;
                 }
 
-#if TWO_LAYERS_HORIZONTAL_SLIDING
-                if (code == LV_EVENT_SCROLL) {
-                        /* 2 Layers sliding */
-                        position += scroll_dx;
-
-                        if (dir == LV_DIR_RIGHT) {
-                                posXLayer0 = DEMO_RESX + position;
-                        }
-                        else if (dir == LV_DIR_LEFT) {
-                                posXLayer0 = position - DEMO_RESX;
-                        }
-                        posXLayer1 = position;
-
-                        lv_port_disp_slide(posXLayer0, posXLayer1);
-                }
-#endif
-
                 if (code == LV_EVENT_SCROLL_END) {
                         if (completed_scroll_cnt == 1) {
 #if TWO_LAYERS_HORIZONTAL_SLIDING
-                                /* Reset layer positions */
-                                position = 0;
-                                posXLayer0 = 0;
-                                posXLayer1 = 0;
-
-                                lv_port_disp_slide_end();
+                                lv_port_disp_trans_end();
 #endif
                                 lv_propagate_to_children(obj, code);
 
@@ -169,6 +135,5 @@ static void scroll_event_cb(lv_event_t *e)
                         }
                         completed_scroll_cnt--;
                 }
-                prev_sx = sx;
         }
 }
@@ -5,6 +5,8 @@
  *
  * @brief Performance Metrics module
  *
+ * The frames are summed up per scenario as they come, so nothing is printed while measuring.
+ *
  * Copyright (C) 2021-2022 Dialog Semiconductor.
  * This computer program includes Confidential, Proprietary Information
  * of Dialog Semiconductor. All Rights Reserved.
@@ -14,21 +16,64 @@
 #include "metrics.h"
 #include <string.h>
 #include "osal.h"
+#include "lvgl.h"
+#include "gdi.h"
 
-#define METRICS_MAX               (1000)
 #define METRICS_TAG_MAX           (10)
 #define MAX_OS_TASK_NUM           (10)
 #define GUI_THREAD_NAME           ("GUI thread")
 
+/* Times of which the percentiles are printed */
+enum {
+        HIST_FRAME,
+        HIST_RENDER,
+        HIST_TRANSFER,
+        HIST_NUM
+};
+
+typedef struct {
+        METRICS sum;                            /* gpu_data only of the frames using the operation */
+        int frame_count;
+        int rendering_count;                    /* Frames rendered, not only transferred */
+        int pixel_rate_total;
+        int fb_sync_bytes_max;
+        int gui_heap_used_max;
+        int gui_heap_frag_max;
+        int gui_heap_biggest_min;               /* 0 until the first frame reports it */
+        int te_hist[METRICS_TE_HIST_LEN];
+        int gpu_count[GPU_METRICS_MAX_TAG];
+        uint32_t wakeups;                       /* Returns of the GUI thread from its wait */
+        uint64_t active_us;                     /* Time of the GUI thread between its waits */
+        uint64_t duration_us;
+        uint16_t hist[HIST_NUM][METRICS_HIST_LEN];
+} metrics_scenario_t;
+
+/* Caches of gdi_perf_cache(), and whether they count their evictions */
+static const struct {
+        const char *name;
+        bool evicts;
+} cache_names[METRICS_CACHE_MAX] = {
+        [METRICS_CACHE_ROT]     = { "Rotation", false },
+        [METRICS_CACHE_GLYPH]   = { "Glyph", true },
+        [METRICS_CACHE_IMG]     = { "Image", true },
+        [METRICS_CACHE_CORNER]  = { "Corner", true },
+        [METRICS_CACHE_STYLE]   = { "Style", false },
+};
+
 static struct {
-        METRICS data[METRICS_MAX];
-        uint16_t data_count;
+        METRICS current;                        /* GPU times and cache counts of the frame in progress */
+        metrics_scenario_t scenario[METRICS_TAG_MAX];
         const char *tag_names[METRICS_TAG_MAX];
         uint32_t cpu_usage[METRICS_TAG_MAX];
+#if DLG_LVGL_USE_PROFILER
+        uint8_t prof_track;                     /* The scenarios are scopes of the profiler */
+        uint8_t prof_ids[METRICS_TAG_MAX];
+#endif
 } metrics;
 static TaskStatus_t task_status_array[MAX_OS_TASK_NUM];
 static uint32_t gui_runtime_start, gui_runtime_end;
 static uint32_t total_runtime_start, total_runtime_end;
+static uint64_t tag_start_us;
 volatile uint8_t current_tag;
 volatile uint8_t gpu_current_tag;
 
@@ -51,12 +96,82 @@ static uint32_t calculate_cpu_usage(uint32_t task_start, uint32_t task_end, uint
         return ((task_end - task_start) * 100UL) / (runtime_end - runtime_start);
 }
 
+static int hist_bucket(int time_us)
+{
+        uint32_t v = MIN((uint32_t)MAX(time_us, 0), (1UL << METRICS_HIST_MAX_BITS) - 1);
+        int shift;
+
+        if (v < (1UL << METRICS_HIST_SUB_BITS)) {
+                return v;
+        }
+        shift = 31 - __builtin_clz(v) - METRICS_HIST_SUB_BITS;
+
+        return (shift << METRICS_HIST_SUB_BITS) + (v >> shift);
+}
+
+/* Middle of the times counted in a bucket */
+static int hist_value(int bucket)
+{
+        int shift = (bucket >> METRICS_HIST_SUB_BITS) - 1;
+        int mantissa = (bucket & ((1 << METRICS_HIST_SUB_BITS) - 1)) + (1 << METRICS_HIST_SUB_BITS);
+
+        if (shift <= 0) {
+                return bucket;
+        }
+
+        return (mantissa << shift) + (1 << (shift - 1));
+}
+
+static void hist_add(uint16_t *hist, int time_us)
+{
+        int bucket = hist_bucket(time_us);
+
+        if (hist[bucket] < UINT16_MAX) {
+                hist[bucket]++;
+        }
+}
+
+static int hist_percentile(const uint16_t *hist, int percent)
+{
+        uint32_t count = 0, rank = 0;
+        int i;
+
+        for (i = 0; i < METRICS_HIST_LEN; i++) {
+                count += hist[i];
+        }
+        if (count == 0) {
+                return 0;
+        }
+
+        /* The first time with at least percent % of the frames not longer */
+        count = (count * percent + 99) / 100;
+        for (i = 0; i < METRICS_HIST_LEN; i++) {
+                rank += hist[i];
+                if (rank >= count) {
+                        break;
+                }
+        }
+
+        return hist_value(i);
+}
+
+static void print_percentiles(const char *name, const uint16_t *hist)
+{
+        int p50 = hist_percentile(hist, 50);
+        int p95 = hist_percentile(hist, 95);
+        int p99 = hist_percentile(hist, 99);
+
+        printf("%-9s p50: %3d.%.2d ms, p95: %3d.%.2d ms, p99: %3d.%.2d ms\r\n", name,
+                p50 / 1000, (p50 / 10) % 100, p95 / 1000, (p95 / 10) % 100, p99 / 1000, (p99 / 10) % 100);
+}
+
 void metrics_init(void)
 {
-        metrics.data_count = 0;
-        memset(metrics.tag_names, 0, METRICS_TAG_MAX * sizeof(char*));
-        memset(metrics.data, 0, METRICS_MAX * sizeof(METRICS));
-        memset(metrics.cpu_usage, 0, METRICS_TAG_MAX * sizeof(uint32_t));
+        memset(&metrics, 0, sizeof(metrics));
+
+#if DLG_LVGL_USE_PROFILER
+        metrics.prof_track = lv_profiler_register_track("Scenario");
+#endif
 
         metrics_register_tag(METRICS_TAG_TICK_ROTATION, "Watch face tick rotation");
         metrics_register_tag(METRICS_TAG_SLIDING_WATCH_FACE_TO_MENU, "Sliding from watch face to menu screen");
@@ -65,28 +180,85 @@ void metrics_init(void)
         metrics_register_tag(METRICS_TAG_COMPASS_ROTATION, "Compass rotation");
 }
 
-void metrics_reinit(void)
+void metrics_add(METRICS *metric)
 {
-        metrics_set_tag(METRICS_TAG_NO_LOGGING);
-        metrics_print();
-        metrics_init();
-        metrics_set_tag(current_tag);
+        metrics_scenario_t *scenario = &metrics.scenario[current_tag];
+        METRICS *sum = &scenario->sum;
+
+        memset(&metrics.current, 0, sizeof(metrics.current));
+        if (!current_tag) {
+                return;
+        }
+
+        scenario->frame_count++;
+        if (metric->frame_rendering_time) {
+                scenario->rendering_count++;
+        }
+        sum->fps += metric->fps;
+        sum->frame_rendering_time += metric->frame_rendering_time;
+        sum->display_transfer_time += metric->display_transfer_time;
+        sum->overlap_time += metric->overlap_time;
+        sum->flushes_saved += metric->flushes_saved;
+        sum->pixels_saved += metric->pixels_saved;
+        for (uint8_t cache = 0; cache < METRICS_CACHE_MAX; cache++) {
+                sum->cache[cache].hits += metric->cache[cache].hits;
+                sum->cache[cache].misses += metric->cache[cache].misses;
+                sum->cache[cache].evicts += metric->cache[cache].evicts;
+        }
+        sum->buf_heap_allocs += metric->buf_heap_allocs;
+        if (metric->gui_heap_used > scenario->gui_heap_used_max) {
+                scenario->gui_heap_used_max = metric->gui_heap_used;
+        }
+        if (metric->gui_heap_frag > scenario->gui_heap_frag_max) {
+                scenario->gui_heap_frag_max = metric->gui_heap_frag;
+        }
+        if (metric->gui_heap_biggest && (!scenario->gui_heap_biggest_min ||
+                        metric->gui_heap_biggest < scenario->gui_heap_biggest_min)) {
+                scenario->gui_heap_biggest_min = metric->gui_heap_biggest;
+        }
+        sum->fb_sync_bytes += metric->fb_sync_bytes;
+        if (metric->fb_sync_bytes > scenario->fb_sync_bytes_max) {
+                scenario->fb_sync_bytes_max = metric->fb_sync_bytes;
+        }
+        if (metric->te_periods) {
+                scenario->te_hist[MIN(metric->te_periods, METRICS_TE_HIST_LEN) - 1]++;
+                sum->te_drops += metric->te_drops;
+        }
+        if (metric->display_transfer_time) {
+                scenario->pixel_rate_total += (metric->pixel_count * 1000) / metric->display_transfer_time;
+        }
+        for (uint8_t gpu_tag = 0; gpu_tag < GPU_METRICS_MAX_TAG; gpu_tag++) {
+                if (metric->gpu_data[gpu_tag]) {
+                        sum->gpu_data[gpu_tag] += metric->gpu_data[gpu_tag];
+                        scenario->gpu_count[gpu_tag]++;
+                }
+        }
+
+        if (metric->frame_time) {
+                hist_add(scenario->hist[HIST_FRAME], metric->frame_time);
+        }
+        if (metric->frame_rendering_time) {
+                hist_add(scenario->hist[HIST_RENDER], metric->frame_rendering_time);
+        }
+        if (metric->display_transfer_time) {
+                hist_add(scenario->hist[HIST_TRANSFER], metric->display_transfer_time);
+        }
 }
 
-void metrics_add(METRICS *metric)
+void metrics_gui_wakeup(uint32_t active_us)
 {
-        if (current_tag) {
-                memcpy(&metrics.data[metrics.data_count], metric, sizeof(METRICS));
-                metrics.data[metrics.data_count].tag = current_tag;
-                metrics.data_count++;
-                if (metrics.data_count == METRICS_MAX) {
-                        metrics_reinit();
-                }
+        uint8_t tag = current_tag;
+
+        if (tag) {
+                metrics.scenario[tag].wakeups++;
+                metrics.scenario[tag].active_us += active_us;
         }
 }
 
 void metrics_set_tag(uint8_t tag)
 {
+        uint64_t now_us = gdi_convert_ticks_to_us(gdi_get_sys_uptime_ticks());
+
         if ((current_tag != METRICS_TAG_NO_LOGGING) && (tag == METRICS_TAG_NO_LOGGING)) {
                 get_GUI_thread_CPU_time(&gui_runtime_end, &total_runtime_end);
                 metrics.cpu_usage[current_tag] = calculate_cpu_usage(gui_runtime_start,
@@ -96,18 +268,33 @@ void metrics_set_tag(uint8_t tag)
         } else if (tag != METRICS_TAG_NO_LOGGING) {
                 get_GUI_thread_CPU_time(&gui_runtime_start, &total_runtime_start);
         }
+
+        /* The wakeups of the GUI thread are counted per minute of the scenario */
+        if (current_tag != METRICS_TAG_NO_LOGGING) {
+                metrics.scenario[current_tag].duration_us += now_us - tag_start_us;
+        }
+        tag_start_us = now_us;
+
+#if DLG_LVGL_USE_PROFILER
+        if (current_tag != METRICS_TAG_NO_LOGGING) {
+                LV_PROFILER_END_ON(metrics.prof_ids[current_tag], metrics.prof_track);
+        }
+        if (tag != METRICS_TAG_NO_LOGGING) {
+                LV_PROFILER_BEGIN_ON(metrics.prof_ids[tag], metrics.prof_track);
+        }
+#endif
         current_tag = tag;
 }
 
 METRICS get_metrics_data()
 {
-        return metrics.data[metrics.data_count];
+        return metrics.current;
 }
 
 void metrics_gpu_add(int gpu_rendering_time)
 {
         if (current_tag && gpu_current_tag) {
-                metrics.data[metrics.data_count].gpu_data[gpu_current_tag-1] += gpu_rendering_time;
+                metrics.current.gpu_data[gpu_current_tag-1] += gpu_rendering_time;
         }
 }
 
@@ -116,73 +303,126 @@ void metrics_set_gpu_tag(uint8_t tag)
         gpu_current_tag = tag;
 }
 
+void metrics_cache_add(uint8_t cache, int hits, int misses, int evicts)
+{
+        if (cache < METRICS_CACHE_MAX) {
+                metrics.current.cache[cache].hits += hits;
+                metrics.current.cache[cache].misses += misses;
+                metrics.current.cache[cache].evicts += evicts;
+        }
+}
+
 void metrics_register_tag(uint8_t tag, const char *tag_name)
 {
         if (tag < METRICS_TAG_MAX) {
                 metrics.tag_names[tag] = tag_name;
+#if DLG_LVGL_USE_PROFILER
+                metrics.prof_ids[tag] = lv_profiler_register(tag_name);
+#endif
         }
 }
 
 void metrics_print(void)
 {
-        uint16_t i;
-        uint8_t tag = 0;
-        int fps_total[4];
-        int rendering_count = 0;
-        int pixel_rate_total = 0;
-
-        int gpu_total_values_per_tag[GPU_METRICS_MAX_TAG];
-        int gpu_valid_values_per_tag[GPU_METRICS_MAX_TAG];
-        int gpu_avg_values_per_tag[GPU_METRICS_MAX_TAG];
+        uint8_t tag;
 
         printf("\r\nPerformance metrics:\r\n");
-        for (i = 0; i < metrics.data_count; i++) {
-                if (metrics.data[i].tag != tag) {
-                        tag = metrics.data[i].tag;
-                        printf("\r\n%s, CPU: %ld%%\r\n", metrics.tag_names[tag], metrics.cpu_usage[tag]);
-                        memset(fps_total, 0, 4 * sizeof(int));
-                        rendering_count = 0;
-                        pixel_rate_total = 0;
-
-                        memset(gpu_total_values_per_tag, 0, sizeof(gpu_total_values_per_tag));
-                        memset(gpu_valid_values_per_tag, 0, sizeof(gpu_valid_values_per_tag));
-                        memset(gpu_avg_values_per_tag, 0, sizeof(gpu_avg_values_per_tag));
-                }
+        for (tag = 1; tag < METRICS_TAG_MAX; tag++) {
+                metrics_scenario_t *scenario = &metrics.scenario[tag];
+                METRICS *sum = &scenario->sum;
+                int gpu_avg_values_per_tag[GPU_METRICS_MAX_TAG] = { 0 };
+                int frame_count = scenario->frame_count;
+                int rendering_count = scenario->rendering_count;
 
-                fps_total[0] += metrics.data[i].fps;
-                if (metrics.data[i].frame_rendering_time) {
-                        rendering_count++;
+                if (frame_count == 0 && scenario->wakeups == 0) {
+                        continue;
                 }
-                fps_total[1] += metrics.data[i].frame_rendering_time;
-                fps_total[2] += metrics.data[i].display_transfer_time;
-                fps_total[3]++; //counts the number of samples per metric tag
-                pixel_rate_total += (metrics.data[i].pixel_count * 1000) / metrics.data[i].display_transfer_time;
 
+                printf("\r\n%s, CPU: %lu%%\r\n", metrics.tag_names[tag],
+                        (unsigned long)metrics.cpu_usage[tag]);
+                if (scenario->duration_us) {
+                        uint32_t active_us_per_s = scenario->active_us * 1000000 / scenario->duration_us;
 
-                for (uint8_t gpu_tag = 1; gpu_tag < GPU_METRICS_MAX_TAG + 1; gpu_tag++) {
-                        if (metrics.data[i].gpu_data[gpu_tag - 1]) {
-                                gpu_total_values_per_tag[gpu_tag - 1] += metrics.data[i].gpu_data[gpu_tag - 1];
-                                gpu_valid_values_per_tag[gpu_tag - 1]++;
+                        printf("GUI thread: %lu wakeups per minute, %lu.%.2lu ms active per second\r\n",
+                                (unsigned long)(scenario->wakeups * 60000000ULL / scenario->duration_us),
+                                (unsigned long)(active_us_per_s / 1000),
+                                (unsigned long)((active_us_per_s / 10) % 100));
+                }
+                if (frame_count == 0) {
+                        continue;
+                }
+
+                for (uint8_t gpu_tag = 0; gpu_tag < GPU_METRICS_MAX_TAG; gpu_tag++) {
+                        if (scenario->gpu_count[gpu_tag]) {
+                                gpu_avg_values_per_tag[gpu_tag] = sum->gpu_data[gpu_tag] / scenario->gpu_count[gpu_tag];
                         }
                 }
 
-                if (metrics.data[i+1].tag != tag) {
-                        for (uint8_t gpu_tag = 1; gpu_tag < GPU_METRICS_MAX_TAG + 1; gpu_tag++) {
-                                gpu_avg_values_per_tag[gpu_tag - 1] = gpu_total_values_per_tag[gpu_tag - 1] / gpu_valid_values_per_tag[gpu_tag - 1];
+                printf("Average GPU: Fill: %10d.%.2d ms,\r\n"
+                       "             BlitBitmap: %4d.%.2d ms,\r\n"
+                       "             RotateImage: %3d.%.2d ms,\r\n"
+                       "             BlitBatch: %5d.%.2d ms,\r\n"
+                       "             Shape: %9d.%.2d ms,\r\n",
+                        (gpu_avg_values_per_tag[0]) / 1000, ((gpu_avg_values_per_tag[0]) / 10) % 100,
+                        (gpu_avg_values_per_tag[1]) / 1000, ((gpu_avg_values_per_tag[1]) / 10) % 100,
+                        (gpu_avg_values_per_tag[2]) / 1000, ((gpu_avg_values_per_tag[2]) / 10) % 100,
+                        (gpu_avg_values_per_tag[3]) / 1000, ((gpu_avg_values_per_tag[3]) / 10) % 100,
+                        (gpu_avg_values_per_tag[4]) / 1000, ((gpu_avg_values_per_tag[4]) / 10) % 100);
+
+                printf("Area merging saved: %d flushes, %d pixels in %d frames\r\n",
+                        sum->flushes_saved, sum->pixels_saved, frame_count);
+                for (uint8_t cache = 0; cache < METRICS_CACHE_MAX; cache++) {
+                        const metrics_cache_t *stat = &sum->cache[cache];
+
+                        if (!(stat->hits + stat->misses)) {
+                                continue;
+                        }
+                        printf("%s cache: %d hits, %d misses (%d%% hit rate)", cache_names[cache].name,
+                                stat->hits, stat->misses,
+                                (int)((int64_t)stat->hits * 100 / (stat->hits + stat->misses)));
+                        if (cache_names[cache].evicts) {
+                                printf(", %d evicted", stat->evicts);
                         }
+                        printf("\r\n");
+                }
+                if (scenario->gui_heap_used_max) {
+                        printf("GUI heap: %d bytes used at most, %d%% fragmented at most, %d bytes free in one "
+                                "block at least, %d buffers allocated\r\n", scenario->gui_heap_used_max,
+                                scenario->gui_heap_frag_max, scenario->gui_heap_biggest_min, sum->buf_heap_allocs);
+                }
+
+                /* Avoid dividing by zero when no frame was rendered (e.g. only partial transfers) */
+                if (rendering_count == 0) {
+                        rendering_count = 1;
+                }
+
+                /* Direct mode: copies keeping the back frame buffer in sync with the front one */
+                if (sum->fb_sync_bytes) {
+                        printf("Frame buffer sync: %d bytes per frame (max %d), render: %d.%.2d ms per frame\r\n",
+                                sum->fb_sync_bytes / frame_count, scenario->fb_sync_bytes_max,
+                                (sum->frame_rendering_time / rendering_count) / 1000,
+                                ((sum->frame_rendering_time / rendering_count) / 10) % 100);
+                }
 
-                        printf("Average GPU: Fill: %10d.%.2d ms,\r\n"
-                               "             BlitBitmap: %4d.%.2d ms,\r\n"
-                               "             RotateImage: %3d.%.2d ms,\r\n",
-                                (gpu_avg_values_per_tag[0]) / 1000, ((gpu_avg_values_per_tag[0]) / 10) % 100,
-                                (gpu_avg_values_per_tag[1]) / 1000, ((gpu_avg_values_per_tag[1]) / 10) % 100,
-                                (gpu_avg_values_per_tag[2]) / 1000, ((gpu_avg_values_per_tag[2]) / 10) % 100);
-
-                        printf("Average FPS: %3d.%d (frame: %3d.%.2d ms, transfer: %3d.%.2d ms), Pixel Rate = %3d.%.2d kP/sec\r\n\r\n",
-                                (fps_total[0] / fps_total[3]) / 10, (fps_total[0] / fps_total[3]) % 10,
-                                (fps_total[1] / rendering_count) / 1000, ((fps_total[1] / rendering_count) / 10) % 100,
-                                (fps_total[2] / fps_total[3]) / 1000, ((fps_total[2] / fps_total[3]) / 10) % 100,
-                                (pixel_rate_total / fps_total[3]) / 1000, ((pixel_rate_total / fps_total[3]) / 10) % 100);
+                /* Frame pacing: frames of the animations by TE periods since the previous one */
+                if (scenario->te_hist[0] + scenario->te_hist[1] + scenario->te_hist[2] + scenario->te_hist[3]) {
+                        printf("Frame time: %d x 1, %d x 2, %d x 3, %d x 4+ TE periods, %d periods dropped\r\n",
+                                scenario->te_hist[0], scenario->te_hist[1], scenario->te_hist[2],
+                                scenario->te_hist[3], sum->te_drops);
                 }
+
+                print_percentiles("Frame:", scenario->hist[HIST_FRAME]);
+                print_percentiles("Render:", scenario->hist[HIST_RENDER]);
+                print_percentiles("Transfer:", scenario->hist[HIST_TRANSFER]);
+
+                printf("Average FPS: %3d.%d (frame: %3d.%.2d ms, transfer: %3d.%.2d ms, overlap: %3d.%.2d ms), Pixel Rate = %3d.%.2d kP/sec\r\n\r\n",
+                        (sum->fps / frame_count) / 10, (sum->fps / frame_count) % 10,
+                        (sum->frame_rendering_time / rendering_count) / 1000,
+                        ((sum->frame_rendering_time / rendering_count) / 10) % 100,
+                        (sum->display_transfer_time / frame_count) / 1000,
+                        ((sum->display_transfer_time / frame_count) / 10) % 100,
+                        (sum->overlap_time / frame_count) / 1000, ((sum->overlap_time / frame_count) / 10) % 100,
+                        (scenario->pixel_rate_total / frame_count) / 1000,
+                        ((scenario->pixel_rate_total / frame_count) / 10) % 100);
         }
 }
@@ -27,23 +27,63 @@
 #define GPU_METRICS_FILL                (1)
 #define GPU_METRICS_BLITBITMAP          (2)
 #define GPU_METRICS_ROTATEIMAGE         (3)
-#define GPU_METRICS_MAX_TAG             (3)
+#define GPU_METRICS_BLITBATCH           (4)
+#define GPU_METRICS_SHAPE               (5)
+#define GPU_METRICS_MAX_TAG             (5)
+
+/* Caches of the renderer reported with gdi_perf_cache() */
+#define METRICS_CACHE_ROT               (0)
+#define METRICS_CACHE_GLYPH             (1)
+#define METRICS_CACHE_IMG               (2)
+#define METRICS_CACHE_CORNER            (3)
+#define METRICS_CACHE_STYLE             (4)
+#define METRICS_CACHE_MAX               (5)
+
+/* Frame times counted in TE periods, the last bucket counting the longer ones too */
+#define METRICS_TE_HIST_LEN             (4)
+
+/* Histograms of the frame, rendering and transfer times, for their percentiles: the times in us are
+ * counted in 2^METRICS_HIST_SUB_BITS buckets per power of two up to 2^METRICS_HIST_MAX_BITS, so that a
+ * percentile is known within 1/2^METRICS_HIST_SUB_BITS of its value */
+#define METRICS_HIST_SUB_BITS           (4)
+#define METRICS_HIST_MAX_BITS           (20)
+#define METRICS_HIST_LEN                ((METRICS_HIST_MAX_BITS - METRICS_HIST_SUB_BITS + 1) << METRICS_HIST_SUB_BITS)
+
+typedef struct {
+        int hits;
+        int misses;
+        int evicts;
+} metrics_cache_t;
 
 typedef struct {
         uint8_t tag;
         int fps;
+        int frame_time;
         int frame_rendering_time;
         int display_transfer_time;
+        int overlap_time;
         int pixel_count;
+        int flushes_saved;
+        int pixels_saved;
+        metrics_cache_t cache[METRICS_CACHE_MAX];
+        int buf_heap_allocs;
+        int gui_heap_used;
+        int gui_heap_frag;
+        int gui_heap_biggest;
+        int fb_sync_bytes;
+        int te_periods;
+        int te_drops;
         int gpu_data[GPU_METRICS_MAX_TAG];
 } METRICS;
 
 void metrics_init(void);
 void metrics_add(METRICS *metric);
 void metrics_set_tag(uint8_t tag);
+void metrics_gui_wakeup(uint32_t active_us);
 METRICS get_metrics_data();
 void metrics_gpu_add(int gpu_rendering_time);
 void metrics_set_gpu_tag(uint8_t tag);
+void metrics_cache_add(uint8_t cache, int hits, int misses, int evicts);
 void metrics_register_tag(uint8_t tag, const char *tag_name);
 void metrics_print(void);
 
@@ -20,24 +20,24 @@
  *
  **********************************************************************
  */
+#include <stdbool.h>
 #include "lvgl.h"
+#include "WatchDemoColoredResources.h"
 
 /*
- * Generated bitmaps used by all modules
-*/
-extern const lv_img_dsc_t clock_bg;
-extern const lv_img_dsc_t stamens;
-extern const lv_img_dsc_t tick_hour;
-extern const lv_img_dsc_t tick_minute;
-extern const lv_img_dsc_t tick_second;
-extern const lv_img_dsc_t timer;
-extern const lv_img_dsc_t running;
-extern const lv_img_dsc_t compass_menu_icon;
-extern const lv_img_dsc_t dummy;
-extern const lv_img_dsc_t reset_timer;
-extern const lv_img_dsc_t compass;
-extern const lv_img_dsc_t compass_earth;
-extern const lv_img_dsc_t compass_index;
+ * Descriptors of the images of the resource bundle, by ID. Filled by resources_init(), the pixels
+ * are read in place from the flash.
+ */
+extern lv_img_dsc_t resources_img[RES_ID_COUNT];
 
-#endif  /* RESOURCES_H__ */
+#define RES_IMG(id)                     ((const lv_img_dsc_t *)&resources_img[(id)])
 
+/**
+ * Check the resource bundle and fill the image descriptors. The images stay empty if the bundle
+ * is missing, corrupted or was packed for other image IDs.
+ *
+ * @return true if the bundle is valid
+ */
+bool resources_init(void);
+
+#endif  /* RESOURCES_H__ */
@@ -0,0 +1,30 @@
+/* Image IDs of WatchDemoColoredResources.bin
+ * Generated by res_pack from WatchDemoColoredResources.txt, do not edit. */
+#ifndef WATCHDEMOCOLOREDRESOURCES_H__
+#define WATCHDEMOCOLOREDRESOURCES_H__
+
+typedef enum {
+        RES_ID_CLOCK_BG,
+        RES_ID_STAMENS,
+        RES_ID_HOUR,
+        RES_ID_MINUTE,
+        RES_ID_SECOND,
+        RES_ID_TIMER,
+        RES_ID_RESET_TIMER,
+        RES_ID_ACTIVITY,
+        RES_ID_TRACK,
+        RES_ID_COMPASS_MENU,
+        RES_ID_COMPASS,
+        RES_ID_COMPASS_EARTH,
+        RES_ID_COMPASS_INDEX,
+        RES_ID_HEART_RATE,
+        RES_ID_MESSAGES,
+        RES_ID_SLEEP_MONITOR,
+        RES_ID_WEATHER,
+        RES_ID_COUNT
+} res_id_t;
+
+/* CRC32 of the IDs, checked against the bundle */
+#define RES_BUNDLE_IDS_CRC              (0xDC827096)
+
+#endif /* WATCHDEMOCOLOREDRESOURCES_H__ */
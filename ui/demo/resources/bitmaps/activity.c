@@ -1,250 +0,0 @@
-/**
- ****************************************************************************************
- *
- * @file activity.c
- *
- * @brief Activity icon source file
- *
- * Copyright (C) 2021-2022 Dialog Semiconductor.
- * This computer program includes Confidential, Proprietary Information
- * of Dialog Semiconductor. All Rights Reserved.
- *
- ****************************************************************************************
- */
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_ACTIVITY
-#define LV_ATTRIBUTE_IMG_ACTIVITY
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ACTIVITY uint8_t activity_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5f, 0xff, 0x7f, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9b, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x13, 0xff, 0x33, 0xff, 0x33, 0xff, 0x57, 0xff, 0x5b, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x37, 0xff, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x33, 0xff, 0x33, 0xff, 0x2e, 0xff, 0x32, 0xff, 0x37, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x57, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x32, 0xff, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x32, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xba, 0xff, 0x54, 0xff, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xba, 0xff, 0x74, 0xff, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x12, 0xff, 0x96, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xba, 0xff, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0x33, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x2e, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x2f, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2e, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x5b, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x2f, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x5b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x33, 0xff, 0x2e, 0xff, 0x2f, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x32, 0xff, 0x32, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x5b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x37, 0xff, 0x57, 0xff, 0x33, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x0a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2e, 0xff, 0x57, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x0e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x5b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0x97, 0xff, 0x0a, 0xff, 0x2a, 0xff, 0x2e, 0xff, 0x2f, 0xff, 0x57, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x76, 0xff, 0x52, 0xff, 0x0e, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x0e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x5b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x72, 0xff, 0x0e, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x0e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x5b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0x0e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x0a, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x57, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x2e, 0xff, 0x0e, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x0a, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x57, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x37, 0xff, 0x36, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x2e, 0xff, 0x0e, 0xff, 0x2e, 0xff, 0x29, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x0a, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x57, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb4, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x09, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x0a, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x57, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0x94, 0xff, 0x94, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0x0a, 0xff, 0x2e, 0xff, 0x29, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x0a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x57, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xde, 0xff, 0xd9, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xba, 0xff, 0xd9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x0a, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x0a, 0xff, 0x0a, 0xff, 0x0a, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0x0a, 0xff, 0x09, 0xff, 0x09, 0xff, 0x37, 0xff, 0x37, 0xff, 0x73, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0x7b, 0xff, 0x57, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x57, 0xff, 0x9b, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x96, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x57, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x32, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x57, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3c, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdb, 0x4e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0x9b, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x3e, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x4e, 0xff, 0x9b, 0x46, 0xff, 0xdb, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x3e, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x46, 0xff, 0x7a, 0x3e, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x7a, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x3a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x7a, 0x3e, 0xff, 0x9a, 0x3e, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x35, 0xff, 0x19, 0x3e, 0xff, 0xf8, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x3a, 0x36, 0xff, 0x3a, 0x36, 0xff, 0x3a, 0x2e, 0xff, 0x39, 0x2e, 0xff, 0x5a, 0x2e, 0xff, 0x9b, 0x56, 0xff, 0xdb, 0x6e, 0xff, 0x7a, 0x36, 0xff, 0x7a, 0x36, 0xff, 0x7a, 0x3e, 0xff, 0x7a, 0x3e, 0xff, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x36, 0xff, 0x19, 0x2e, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x4e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x36, 0xff, 0x39, 0x3e, 0xff, 0x9b, 0x66, 0xff, 0xfc, 0x8e, 0xff, 0x5d, 0xaf, 0xff, 0x9e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x5e, 0xff, 0xff, 0x1d, 0xc7, 0xff, 0xdc, 0x8e, 0xff, 0x7a, 0x4e, 0xff, 0x5a, 0x2e, 0xff, 0x5a, 0x36, 0xff, 0x7a, 0x3e, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x36, 0xff, 0x19, 0x2e, 0xff, 0x5a, 0x46, 0xff, 0x1c, 0x97, 0xff, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x66, 0xff, 0x19, 0x36, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x35, 0xff, 0xfc, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0x3c, 0xef, 0xff, 0x3e, 0xef, 0xff, 0x5e, 0xf7, 0xff, 0x5e, 0xff, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xa6, 0xff, 0x9b, 0x66, 0xff, 0x5a, 0x2e, 0xff, 0x39, 0x2e, 0xff, 0x19, 0x26, 0xff, 0x7a, 0x4e, 0xff, 0x1d, 0x9f, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x5e, 0xff, 0xf9, 0x35, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0x97, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x2d, 0xff, 0xdb, 0x86, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xc6, 0xff, 0x9a, 0x7d, 0xff, 0x19, 0x5d, 0xff, 0xbc, 0x5e, 0xff, 0xdc, 0x76, 0xff, 0xbc, 0xff, 0xff, 0xbd, 0xff, 0xff, 0x99, 0xff, 0xff, 0x76, 0xff, 0xff, 0x77, 0xff, 0xff, 0x59, 0xff, 0xff, 0x3b, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x3e, 0xef, 0xff, 0x5f, 0xff, 0xff, 0x5e, 0xf7, 0xff, 0xfc, 0xbe, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xf7, 0xff, 0x04, 0xd7, 0xff, 0x70, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x5e, 0xff, 0xf8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x2d, 0xff, 0xbb, 0x86, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x96, 0xff, 0xb6, 0x13, 0xff, 0xd6, 0x23, 0xff, 0x17, 0x24, 0xff, 0x79, 0x45, 0xff, 0x9c, 0x56, 0xff, 0x1d, 0x87, 0xff, 0x58, 0x8e, 0xff, 0x16, 0x9e, 0xff, 0x96, 0xce, 0xff, 0x97, 0xff, 0xff, 0x56, 0xff, 0xff, 0x56, 0xff, 0xff, 0x35, 0xf7, 0xff, 0xad, 0xce, 0xff, 0x1a, 0xe7, 0xff, 0x5f, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xf7, 0xff, 0x27, 0xdf, 0xff, 0xc0, 0xce, 0xff, 0xc0, 0xce, 0xff, 0xc0, 0xce, 0xff, 0x93, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x5e, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x2d, 0xff, 0xbb, 0x86, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x9f, 0xff, 0x5b, 0x4e, 0xff, 0xf8, 0x3c, 0xff, 0xd6, 0x23, 0xff, 0xb6, 0x23, 0xff, 0xd6, 0x23, 0xff, 0x98, 0x34, 0xff, 0x76, 0x24, 0xff, 0x95, 0x14, 0xff, 0x75, 0x0c, 0xff, 0xf5, 0x3c, 0xff, 0x76, 0xff, 0xff, 0x57, 0xff, 0xff, 0xcd, 0xe6, 0xff, 0x20, 0xb6, 0xff, 0x20, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0xe0, 0xce, 0xff, 0xc0, 0xce, 0xff, 0xe0, 0xce, 0xff, 0xe0, 0xce, 0xff, 0xe0, 0xce, 0xff, 0xc0, 0xc6, 0xff, 0x72, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x5e, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x2d, 0xff, 0xbb, 0x86, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xb7, 0xff, 0xbb, 0x86, 0xff, 0x9b, 0x5e, 0xff, 0x9b, 0x56, 0xff, 0xba, 0x4d, 0xff, 0x77, 0x34, 0xff, 0xf7, 0x23, 0xff, 0x34, 0x23, 0xff, 0xb3, 0x23, 0xff, 0xb5, 0x24, 0xff, 0x34, 0x04, 0xff, 0x36, 0xff, 0xff, 0x57, 0xff, 0xff, 0xce, 0xe6, 0xff, 0x20, 0xb6, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0xe0, 0xd6, 0xff, 0xe0, 0xce, 0xff, 0xc0, 0xce, 0xff, 0xc0, 0xce, 0xff, 0xc0, 0xc6, 0xff, 0x0a, 0xdf, 0xff, 0xb7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x39, 0x5e, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x97, 0x2d, 0xff, 0x97, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0x97, 0x2d, 0xff, 0x9b, 0x86, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xbc, 0xff, 0xff, 0x1b, 0xb7, 0xff, 0x5b, 0x4e, 0xff, 0xdc, 0x66, 0xff, 0xb8, 0x34, 0xff, 0x33, 0x23, 0xff, 0xb1, 0x1a, 0xff, 0x54, 0x24, 0xff, 0x74, 0x1c, 0xff, 0x76, 0xff, 0xff, 0x36, 0xff, 0xff, 0x37, 0xff, 0xff, 0x00, 0xae, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0xe0, 0xce, 0xff, 0xc0, 0xc6, 0xff, 0xa0, 0xc6, 0xff, 0xc1, 0xce, 0xff, 0x55, 0xef, 0xff, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0x5e, 0xff, 0xb7, 0x2d, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x97, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x2d, 0xff, 0x9b, 0x86, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xff, 0x38, 0xef, 0xff, 0xbd, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xdb, 0x9e, 0xff, 0x5b, 0x56, 0xff, 0xda, 0x4d, 0xff, 0x13, 0x1b, 0xff, 0xb1, 0x1a, 0xff, 0x93, 0x13, 0xff, 0x54, 0x65, 0xff, 0x55, 0xff, 0xff, 0x35, 0xff, 0xff, 0x36, 0xff, 0xff, 0x14, 0xff, 0xff, 0x8a, 0xde, 0xff, 0xab, 0xde, 0xff, 0x2e, 0xe7, 0xff, 0x51, 0xef, 0xff, 0x79, 0xf7, 0xff, 0x9f, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x5e, 0xff, 0x97, 0x2d, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x57, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x97, 0x35, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x9b, 0x86, 0xff, 0xff, 0xff, 0xff, 0xee, 0x9d, 0xff, 0x81, 0x4c, 0xff, 0x05, 0x6d, 0xff, 0xbd, 0xff, 0xff, 0x7b, 0xef, 0xff, 0x3b, 0x46, 0xff, 0xba, 0x4d, 0xff, 0xf2, 0x1a, 0xff, 0xb1, 0x1a, 0xff, 0x92, 0x13, 0xff, 0x54, 0x75, 0xff, 0x95, 0xff, 0xff, 0x35, 0xff, 0xff, 0x35, 0xff, 0xff, 0x35, 0xff, 0xff, 0x56, 0xff, 0xff, 0x36, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x9c, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x7e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x19, 0x56, 0xff, 0x97, 0x2d, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x25, 0xff, 0x7a, 0x86, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xa6, 0xff, 0xa3, 0x5c, 0xff, 0x81, 0x4c, 0xff, 0x9c, 0xff, 0xff, 0x5b, 0xef, 0xff, 0x3b, 0x46, 0xff, 0x18, 0x3d, 0xff, 0xf2, 0x1a, 0xff, 0xb0, 0x1a, 0xff, 0x31, 0x1b, 0xff, 0x33, 0x14, 0xff, 0x54, 0x7d, 0xff, 0x94, 0xde, 0xff, 0x94, 0xde, 0xff, 0x34, 0xc6, 0xff, 0xf4, 0xad, 0xff, 0x55, 0xff, 0xff, 0x9c, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x7a, 0x76, 0xff, 0x1d, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x55, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x56, 0x25, 0xff, 0x7a, 0x86, 0xff, 0xff, 0xff, 0xff, 0xce, 0x95, 0xff, 0x41, 0x4c, 0xff, 0xf6, 0xde, 0xff, 0xbc, 0xff, 0xff, 0x3b, 0xdf, 0xff, 0x5b, 0x46, 0xff, 0xf6, 0x2b, 0xff, 0xf2, 0x1a, 0xff, 0x90, 0x1a, 0xff, 0x90, 0x1a, 0xff, 0x11, 0x1b, 0xff, 0xf3, 0x13, 0xff, 0xf3, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xb2, 0x0b, 0xff, 0x53, 0x34, 0xff, 0xdc, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x7b, 0xf7, 0xff, 0xda, 0x2d, 0xff, 0x3d, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x55, 0xff, 0x76, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x25, 0xff, 0x7a, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x18, 0xdf, 0xff, 0x9c, 0xff, 0xff, 0x1c, 0xc7, 0xff, 0x7b, 0xff, 0xff, 0xba, 0x9e, 0xff, 0xfa, 0x45, 0xff, 0x34, 0x1b, 0xff, 0xf2, 0x1a, 0xff, 0x8f, 0x1a, 0xff, 0x90, 0x1a, 0xff, 0x90, 0x1a, 0xff, 0x6f, 0x1a, 0xff, 0x11, 0x1b, 0xff, 0xf2, 0x1b, 0xff, 0xf2, 0x1b, 0xff, 0xd2, 0x1b, 0xff, 0xf2, 0x1b, 0xff, 0x5b, 0x4e, 0xff, 0x3b, 0xd7, 0xff, 0xbb, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x3a, 0x66, 0xff, 0xd9, 0x3d, 0xff, 0x3d, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x55, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x36, 0x2d, 0xff, 0x35, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x16, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x36, 0x25, 0xff, 0x5a, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0x5b, 0xf7, 0xff, 0xb9, 0x2d, 0xff, 0xda, 0x3d, 0xff, 0x5a, 0x4e, 0xff, 0x18, 0x3d, 0xff, 0x54, 0x23, 0xff, 0xd1, 0x1a, 0xff, 0x6f, 0x1a, 0xff, 0x8f, 0x1a, 0xff, 0x8f, 0x1a, 0xff, 0x8f, 0x1a, 0xff, 0x6f, 0x1a, 0xff, 0x6f, 0x1a, 0xff, 0xd2, 0x1b, 0xff, 0xd2, 0x1b, 0xff, 0xf2, 0x23, 0xff, 0x5b, 0x4e, 0xff, 0xfa, 0x3d, 0xff, 0x5a, 0x56, 0xff, 0x5a, 0x4e, 0xff, 0x3a, 0x4e, 0xff, 0x1a, 0x46, 0xff, 0x5d, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x55, 0xff, 0x36, 0x25, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x16, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf5, 0x24, 0xff, 0xf6, 0x2c, 0xff, 0x15, 0x25, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x16, 0x25, 0xff, 0x5a, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xbf, 0xff, 0x19, 0x4e, 0xff, 0xfa, 0x45, 0xff, 0x5a, 0x4e, 0xff, 0x56, 0x34, 0xff, 0xf3, 0x1a, 0xff, 0x55, 0x23, 0xff, 0xb1, 0x1a, 0xff, 0x4e, 0x1a, 0xff, 0x6f, 0x1a, 0xff, 0x6f, 0x1a, 0xff, 0x6f, 0x1a, 0xff, 0x6f, 0x1a, 0xff, 0x6f, 0x1a, 0xff, 0x4f, 0x1a, 0xff, 0x91, 0x1b, 0xff, 0xf2, 0x23, 0xff, 0x7b, 0x56, 0xff, 0x79, 0x45, 0xff, 0x54, 0x23, 0xff, 0x95, 0x23, 0xff, 0x74, 0x23, 0xff, 0x34, 0x13, 0xff, 0x1b, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x55, 0xff, 0x36, 0x25, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x25, 0xff, 0x5a, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x86, 0xff, 0x38, 0x35, 0xff, 0x58, 0x3d, 0xff, 0xf5, 0x2b, 0xff, 0xd3, 0x1a, 0xff, 0xf3, 0x1a, 0xff, 0xf3, 0x1a, 0xff, 0x90, 0x12, 0xff, 0x4e, 0x0a, 0xff, 0x8f, 0x12, 0xff, 0x4e, 0x1a, 0xff, 0x4e, 0x1a, 0xff, 0x4e, 0x1a, 0xff, 0x6e, 0x1a, 0xff, 0x4e, 0x1a, 0xff, 0x2e, 0x1a, 0xff, 0xef, 0x1a, 0xff, 0x99, 0x45, 0xff, 0xd3, 0x1a, 0xff, 0x34, 0x23, 0xff, 0x14, 0x23, 0xff, 0x34, 0x23, 0xff, 0xb3, 0x12, 0xff, 0xfb, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x55, 0xff, 0x15, 0x25, 0xff, 0x36, 0x2d, 0xff, 0x16, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf4, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x1c, 0xff, 0x39, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x74, 0xff, 0x31, 0x0a, 0xff, 0x92, 0x1a, 0xff, 0xd3, 0x1a, 0xff, 0x74, 0x23, 0xff, 0x38, 0x3d, 0xff, 0x1a, 0x3e, 0xff, 0xf4, 0x44, 0xff, 0xd1, 0x74, 0xff, 0x11, 0x34, 0xff, 0x71, 0x0b, 0xff, 0x50, 0x1b, 0xff, 0x4e, 0x1a, 0xff, 0x4e, 0x1a, 0xff, 0x4e, 0x1a, 0xff, 0x4e, 0x12, 0xff, 0x0d, 0x12, 0xff, 0xf3, 0x1a, 0xff, 0x34, 0x23, 0xff, 0x13, 0x23, 0xff, 0x13, 0x23, 0xff, 0x13, 0x23, 0xff, 0xb3, 0x12, 0xff, 0xfb, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x55, 0xff, 0x15, 0x25, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x1c, 0xff, 0x39, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x86, 0xff, 0xf9, 0x35, 0xff, 0x1a, 0x46, 0xff, 0x1a, 0x4e, 0xff, 0x1a, 0x46, 0xff, 0xb9, 0x2d, 0xff, 0xbb, 0xa6, 0xff, 0x55, 0xff, 0xff, 0x11, 0xff, 0xff, 0x72, 0xff, 0xff, 0x50, 0x5c, 0xff, 0x50, 0x13, 0xff, 0x70, 0x1b, 0xff, 0x2d, 0x12, 0xff, 0x2d, 0x12, 0xff, 0x2d, 0x12, 0xff, 0x2d, 0x12, 0xff, 0x13, 0x23, 0xff, 0x13, 0x23, 0xff, 0x13, 0x23, 0xff, 0xf3, 0x22, 0xff, 0xf3, 0x22, 0xff, 0x92, 0x12, 0xff, 0xfa, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x97, 0x4d, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd4, 0x1c, 0xff, 0x39, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xe7, 0xff, 0x19, 0x6e, 0xff, 0x79, 0x2d, 0xff, 0x99, 0x2d, 0xff, 0x79, 0x25, 0xff, 0xba, 0xa6, 0xff, 0x9b, 0xff, 0xff, 0x15, 0xff, 0xff, 0xd1, 0xfe, 0xff, 0xf1, 0xfe, 0xff, 0x31, 0xd6, 0xff, 0xcf, 0x02, 0xff, 0x50, 0x1b, 0xff, 0x0f, 0x1b, 0xff, 0x0d, 0x12, 0xff, 0x2d, 0x12, 0xff, 0x0c, 0x12, 0xff, 0xf3, 0x22, 0xff, 0xf3, 0x22, 0xff, 0xf3, 0x22, 0xff, 0xf3, 0x1a, 0xff, 0xf3, 0x1a, 0xff, 0x72, 0x0a, 0xff, 0xda, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x97, 0x4d, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd4, 0x1c, 0xff, 0x19, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xfa, 0xd6, 0xff, 0x3a, 0xe7, 0xff, 0x9b, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x16, 0xff, 0xff, 0xd1, 0xfe, 0xff, 0xd1, 0xfe, 0xff, 0x31, 0xff, 0xff, 0x4f, 0x23, 0xff, 0x0f, 0x13, 0xff, 0x4f, 0x1b, 0xff, 0x6d, 0x12, 0xff, 0x0c, 0x12, 0xff, 0xec, 0x11, 0xff, 0xd3, 0x1a, 0xff, 0xd3, 0x1a, 0xff, 0xd2, 0x1a, 0xff, 0xd2, 0x1a, 0xff, 0xd2, 0x1a, 0xff, 0x71, 0x0a, 0xff, 0xda, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x77, 0x4d, 0xff, 0xd4, 0x1c, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x1c, 0xff, 0x19, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xdf, 0xff, 0xcf, 0xde, 0xff, 0x59, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xf1, 0xde, 0xff, 0xa8, 0xce, 0xff, 0xe5, 0xbd, 0xff, 0x0a, 0xd6, 0xff, 0xf2, 0xfe, 0xff, 0xd1, 0xfe, 0xff, 0xf1, 0xfe, 0xff, 0x0f, 0x1b, 0xff, 0xef, 0x12, 0xff, 0x0f, 0x1b, 0xff, 0xec, 0x11, 0xff, 0xeb, 0x11, 0xff, 0xd2, 0x1a, 0xff, 0xd2, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0x51, 0x0a, 0xff, 0xda, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x77, 0x4d, 0xff, 0xb4, 0x1c, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x1c, 0xff, 0x19, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xce, 0xff, 0x00, 0xa6, 0xff, 0x00, 0xa6, 0xff, 0x20, 0xa6, 0xff, 0x20, 0xa6, 0xff, 0x20, 0xae, 0xff, 0x40, 0xae, 0xff, 0x60, 0x95, 0xff, 0xe0, 0x84, 0xff, 0x62, 0xa5, 0xff, 0xf2, 0xfe, 0xff, 0xd0, 0xfe, 0xff, 0x30, 0xff, 0xff, 0xee, 0x12, 0xff, 0xee, 0x12, 0xff, 0x8d, 0x12, 0xff, 0xab, 0x11, 0xff, 0xb2, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0x92, 0x1a, 0xff, 0x92, 0x1a, 0xff, 0x31, 0x0a, 0xff, 0xda, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x56, 0x4d, 0xff, 0xb4, 0x1c, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x1c, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x93, 0x14, 0xff, 0xf9, 0x75, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xce, 0xff, 0x00, 0xa6, 0xff, 0x00, 0xae, 0xff, 0x00, 0xa6, 0xff, 0x00, 0xa6, 0xff, 0x00, 0xa6, 0xff, 0x20, 0xae, 0xff, 0x81, 0x9d, 0xff, 0xc0, 0x84, 0xff, 0xc0, 0x7c, 0xff, 0x2a, 0xe6, 0xff, 0xd0, 0xfe, 0xff, 0xf0, 0xfe, 0xff, 0xcf, 0xcd, 0xff, 0x6e, 0x02, 0xff, 0xee, 0x12, 0xff, 0x2c, 0x12, 0xff, 0x71, 0x1a, 0xff, 0x92, 0x1a, 0xff, 0x92, 0x1a, 0xff, 0x92, 0x1a, 0xff, 0x71, 0x1a, 0xff, 0xd0, 0x01, 0xff, 0x99, 0x9d, 0xff, 0xff, 0xff, 0xff, 0x56, 0x4d, 0xff, 0x94, 0x1c, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x24, 0xff, 0x73, 0x14, 0xff, 0xf8, 0x75, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xce, 0xff, 0x65, 0xb6, 0xff, 0xcc, 0xce, 0xff, 0x32, 0xdf, 0xff, 0x98, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xf7, 0xff, 0x59, 0xce, 0xff, 0xcf, 0xad, 0xff, 0xca, 0xbd, 0xff, 0xcf, 0xfe, 0xff, 0xae, 0xfe, 0xff, 0x2f, 0xff, 0xff, 0x4d, 0x02, 0xff, 0xad, 0x12, 0xff, 0xad, 0x12, 0xff, 0xb2, 0x1a, 0xff, 0x71, 0x1a, 0xff, 0x10, 0x0a, 0xff, 0xd0, 0x01, 0xff, 0x10, 0x0a, 0xff, 0x76, 0x6c, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0x56, 0x4d, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x24, 0xff, 0x94, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x14, 0xff, 0xf8, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xe7, 0xff, 0x7a, 0xb6, 0xff, 0x9b, 0xd6, 0xff, 0xbd, 0xe6, 0xff, 0x9d, 0xd6, 0xff, 0x7c, 0xce, 0xff, 0x78, 0xde, 0xff, 0xb4, 0xf6, 0xff, 0x8d, 0x0a, 0xff, 0x0b, 0x02, 0xff, 0xea, 0x01, 0xff, 0x98, 0x25, 0xff, 0xd7, 0x24, 0xff, 0x16, 0x6c, 0xff, 0xbc, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x3c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x14, 0xff, 0xf9, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xcf, 0xff, 0x7a, 0x9e, 0xff, 0xd8, 0x75, 0xff, 0x36, 0x4d, 0xff, 0x93, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x0c, 0xff, 0xf5, 0x3c, 0xff, 0x97, 0x7d, 0xff, 0x3a, 0xbe, 0xff, 0x9c, 0xe6, 0xff, 0x9c, 0xd6, 0xff, 0xfc, 0xee, 0xff, 0x3a, 0xc6, 0xff, 0x94, 0x7c, 0xff, 0x7e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0x5a, 0x96, 0xff, 0xf5, 0x3c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x14, 0xff, 0x52, 0x0c, 0xff, 0x32, 0x0c, 0xff, 0x52, 0x0c, 0xff, 0x53, 0x14, 0xff, 0x73, 0x14, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x14, 0xff, 0x53, 0x0c, 0xff, 0x94, 0x1c, 0xff, 0x36, 0x5d, 0xff, 0xd8, 0x9d, 0xff, 0x9b, 0xde, 0xff, 0xdc, 0xee, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xef, 0xff, 0x39, 0x8e, 0xff, 0x94, 0x2c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x14, 0xff, 0x53, 0x0c, 0xff, 0x52, 0x0c, 0xff, 0xf5, 0x44, 0xff, 0x93, 0x24, 0xff, 0x53, 0x1c, 0xff, 0x32, 0x14, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x14, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0x12, 0x14, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x52, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x52, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x32, 0x14, 0xff, 0x32, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0xf2, 0x13, 0xff, 0x12, 0x14, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x12, 0x14, 0xff, 0x32, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x46, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3c, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x46, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x7a, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x5a, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x7a, 0xff, 0x3e, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x46, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x46, 0x7a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x19, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x3a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x3e, 0x7a, 0xff, 0x3e, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xd8, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf8, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x36, 0x3a, 0xff, 0x36, 0x3a, 0xff, 0x2e, 0x3a, 0xff, 0x2e, 0x39, 0xff, 0x2e, 0x5a, 0xff, 0x56, 0x9b, 0xff, 0x6e, 0xdb, 0xff, 0x36, 0x7a, 0xff, 0x36, 0x7a, 0xff, 0x3e, 0x7a, 0xff, 0x3e, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x3e, 0x5a, 0xff, 0x36, 0x39, 0xff, 0x2e, 0x19, 0xff, 0x46, 0x5a, 0xff, 0x4e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x36, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x66, 0x9b, 0xff, 0x8e, 0xfc, 0xff, 0xaf, 0x5d, 0xff, 0xd7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x5e, 0xff, 0xc7, 0x1d, 0xff, 0x8e, 0xdc, 0xff, 0x4e, 0x7a, 0xff, 0x2e, 0x5a, 0xff, 0x36, 0x5a, 0xff, 0x3e, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x3e, 0x5a, 0xff, 0x36, 0x39, 0xff, 0x2e, 0x19, 0xff, 0x46, 0x5a, 0xff, 0x97, 0x1c, 0xff, 0xe7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x66, 0x9a, 0xff, 0x36, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x35, 0xf9, 0xff, 0x8e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3e, 0xff, 0xf7, 0x5e, 0xff, 0xff, 0x5e, 0xff, 0xe7, 0x3d, 0xff, 0xa6, 0xfc, 0xff, 0x66, 0x9b, 0xff, 0x2e, 0x5a, 0xff, 0x2e, 0x39, 0xff, 0x26, 0x19, 0xff, 0x4e, 0x7a, 0xff, 0x9f, 0x1d, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x7a, 0xff, 0x35, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0x97, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x2d, 0xf8, 0xff, 0x86, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xfd, 0xff, 0x7d, 0x9a, 0xff, 0x5d, 0x19, 0xff, 0x5e, 0xbc, 0xff, 0x76, 0xdc, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xbd, 0xff, 0xff, 0x99, 0xff, 0xff, 0x76, 0xff, 0xff, 0x77, 0xff, 0xff, 0x59, 0xff, 0xef, 0x3b, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3e, 0xff, 0xff, 0x5f, 0xff, 0xf7, 0x5e, 0xff, 0xbe, 0xfc, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xb4, 0xff, 0xd7, 0x04, 0xff, 0xef, 0x70, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x5a, 0xff, 0x35, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x97, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x2d, 0xd8, 0xff, 0x86, 0xbb, 0xff, 0xff, 0xff, 0xff, 0x96, 0xdc, 0xff, 0x13, 0xb6, 0xff, 0x23, 0xd6, 0xff, 0x24, 0x17, 0xff, 0x45, 0x79, 0xff, 0x56, 0x9c, 0xff, 0x87, 0x1d, 0xff, 0x8e, 0x58, 0xff, 0x9e, 0x16, 0xff, 0xce, 0x96, 0xff, 0xff, 0x97, 0xff, 0xff, 0x56, 0xff, 0xff, 0x56, 0xff, 0xf7, 0x35, 0xff, 0xce, 0xad, 0xff, 0xe7, 0x1a, 0xff, 0xf7, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xb4, 0xff, 0xdf, 0x27, 0xff, 0xce, 0xc0, 0xff, 0xce, 0xc0, 0xff, 0xce, 0xc0, 0xff, 0xef, 0x93, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x5a, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x2d, 0xd8, 0xff, 0x86, 0xbb, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x1d, 0xff, 0x4e, 0x5b, 0xff, 0x3c, 0xf8, 0xff, 0x23, 0xd6, 0xff, 0x23, 0xb6, 0xff, 0x23, 0xd6, 0xff, 0x34, 0x98, 0xff, 0x24, 0x76, 0xff, 0x14, 0x95, 0xff, 0x0c, 0x75, 0xff, 0x3c, 0xf5, 0xff, 0xff, 0x76, 0xff, 0xff, 0x57, 0xff, 0xe6, 0xcd, 0xff, 0xb6, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x40, 0xff, 0xce, 0xe0, 0xff, 0xce, 0xc0, 0xff, 0xce, 0xe0, 0xff, 0xce, 0xe0, 0xff, 0xce, 0xe0, 0xff, 0xc6, 0xc0, 0xff, 0xef, 0x72, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x5a, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x2d, 0xb8, 0xff, 0x86, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x3d, 0xff, 0x86, 0xbb, 0xff, 0x5e, 0x9b, 0xff, 0x56, 0x9b, 0xff, 0x4d, 0xba, 0xff, 0x34, 0x77, 0xff, 0x23, 0xf7, 0xff, 0x23, 0x34, 0xff, 0x23, 0xb3, 0xff, 0x24, 0xb5, 0xff, 0x04, 0x34, 0xff, 0xff, 0x36, 0xff, 0xff, 0x57, 0xff, 0xe6, 0xce, 0xff, 0xb6, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xd6, 0xe0, 0xff, 0xce, 0xe0, 0xff, 0xce, 0xc0, 0xff, 0xce, 0xc0, 0xff, 0xc6, 0xc0, 0xff, 0xdf, 0x0a, 0xff, 0xf7, 0xb7, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x39, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x97, 0xff, 0x35, 0x97, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x2d, 0x97, 0xff, 0x86, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xbc, 0xff, 0xb7, 0x1b, 0xff, 0x4e, 0x5b, 0xff, 0x66, 0xdc, 0xff, 0x34, 0xb8, 0xff, 0x23, 0x33, 0xff, 0x1a, 0xb1, 0xff, 0x24, 0x54, 0xff, 0x1c, 0x74, 0xff, 0xff, 0x76, 0xff, 0xff, 0x36, 0xff, 0xff, 0x37, 0xff, 0xae, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xce, 0xe0, 0xff, 0xc6, 0xc0, 0xff, 0xc6, 0xa0, 0xff, 0xce, 0xc1, 0xff, 0xef, 0x55, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x39, 0xff, 0x2d, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x97, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x2d, 0x97, 0xff, 0x86, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xef, 0x38, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xbc, 0xff, 0x9e, 0xdb, 0xff, 0x56, 0x5b, 0xff, 0x4d, 0xda, 0xff, 0x1b, 0x13, 0xff, 0x1a, 0xb1, 0xff, 0x13, 0x93, 0xff, 0x65, 0x54, 0xff, 0xff, 0x55, 0xff, 0xff, 0x35, 0xff, 0xff, 0x36, 0xff, 0xff, 0x14, 0xff, 0xde, 0x8a, 0xff, 0xde, 0xab, 0xff, 0xe7, 0x2e, 0xff, 0xef, 0x51, 0xff, 0xf7, 0x79, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x19, 0xff, 0x2d, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x57, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x35, 0x97, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x2d, 0x77, 0xff, 0x86, 0x9b, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xee, 0xff, 0x4c, 0x81, 0xff, 0x6d, 0x05, 0xff, 0xff, 0xbd, 0xff, 0xef, 0x7b, 0xff, 0x46, 0x3b, 0xff, 0x4d, 0xba, 0xff, 0x1a, 0xf2, 0xff, 0x1a, 0xb1, 0xff, 0x13, 0x92, 0xff, 0x75, 0x54, 0xff, 0xff, 0x95, 0xff, 0xff, 0x35, 0xff, 0xff, 0x35, 0xff, 0xff, 0x35, 0xff, 0xff, 0x56, 0xff, 0xff, 0x36, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x9c, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x9b, 0xff, 0xd7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x56, 0x19, 0xff, 0x2d, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x25, 0x77, 0xff, 0x86, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x0f, 0xff, 0x5c, 0xa3, 0xff, 0x4c, 0x81, 0xff, 0xff, 0x9c, 0xff, 0xef, 0x5b, 0xff, 0x46, 0x3b, 0xff, 0x3d, 0x18, 0xff, 0x1a, 0xf2, 0xff, 0x1a, 0xb0, 0xff, 0x1b, 0x31, 0xff, 0x14, 0x33, 0xff, 0x7d, 0x54, 0xff, 0xde, 0x94, 0xff, 0xde, 0x94, 0xff, 0xc6, 0x34, 0xff, 0xad, 0xf4, 0xff, 0xff, 0x55, 0xff, 0xff, 0x9c, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x9b, 0xff, 0x76, 0x7a, 0xff, 0xaf, 0x1d, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf9, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x25, 0x56, 0xff, 0x86, 0x7a, 0xff, 0xff, 0xff, 0xff, 0x95, 0xce, 0xff, 0x4c, 0x41, 0xff, 0xde, 0xf6, 0xff, 0xff, 0xbc, 0xff, 0xdf, 0x3b, 0xff, 0x46, 0x5b, 0xff, 0x2b, 0xf6, 0xff, 0x1a, 0xf2, 0xff, 0x1a, 0x90, 0xff, 0x1a, 0x90, 0xff, 0x1b, 0x11, 0xff, 0x13, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xb2, 0xff, 0x34, 0x53, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x9b, 0xff, 0xf7, 0x7b, 0xff, 0x2d, 0xda, 0xff, 0xb7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf8, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x25, 0x56, 0xff, 0x7e, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x18, 0xff, 0xff, 0x9c, 0xff, 0xc7, 0x1c, 0xff, 0xff, 0x7b, 0xff, 0x9e, 0xba, 0xff, 0x45, 0xfa, 0xff, 0x1b, 0x34, 0xff, 0x1a, 0xf2, 0xff, 0x1a, 0x8f, 0xff, 0x1a, 0x90, 0xff, 0x1a, 0x90, 0xff, 0x1a, 0x6f, 0xff, 0x1b, 0x11, 0xff, 0x1b, 0xf2, 0xff, 0x1b, 0xf2, 0xff, 0x1b, 0xd2, 0xff, 0x1b, 0xf2, 0xff, 0x4e, 0x5b, 0xff, 0xd7, 0x3b, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xbb, 0xff, 0x66, 0x3a, 0xff, 0x3d, 0xd9, 0xff, 0xb7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf8, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x36, 0xff, 0x2d, 0x35, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x16, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x25, 0x36, 0xff, 0x7e, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xf7, 0x5b, 0xff, 0x2d, 0xb9, 0xff, 0x3d, 0xda, 0xff, 0x4e, 0x5a, 0xff, 0x3d, 0x18, 0xff, 0x23, 0x54, 0xff, 0x1a, 0xd1, 0xff, 0x1a, 0x6f, 0xff, 0x1a, 0x8f, 0xff, 0x1a, 0x8f, 0xff, 0x1a, 0x8f, 0xff, 0x1a, 0x6f, 0xff, 0x1a, 0x6f, 0xff, 0x1b, 0xd2, 0xff, 0x1b, 0xd2, 0xff, 0x23, 0xf2, 0xff, 0x4e, 0x5b, 0xff, 0x3d, 0xfa, 0xff, 0x56, 0x5a, 0xff, 0x4e, 0x5a, 0xff, 0x4e, 0x3a, 0xff, 0x46, 0x1a, 0xff, 0xb7, 0x5d, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd8, 0xff, 0x25, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x16, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xf5, 0xff, 0x2c, 0xf6, 0xff, 0x25, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x25, 0x16, 0xff, 0x7e, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x3c, 0xff, 0x4e, 0x19, 0xff, 0x45, 0xfa, 0xff, 0x4e, 0x5a, 0xff, 0x34, 0x56, 0xff, 0x1a, 0xf3, 0xff, 0x23, 0x55, 0xff, 0x1a, 0xb1, 0xff, 0x1a, 0x4e, 0xff, 0x1a, 0x6f, 0xff, 0x1a, 0x6f, 0xff, 0x1a, 0x6f, 0xff, 0x1a, 0x6f, 0xff, 0x1a, 0x6f, 0xff, 0x1a, 0x4f, 0xff, 0x1b, 0x91, 0xff, 0x23, 0xf2, 0xff, 0x56, 0x7b, 0xff, 0x45, 0x79, 0xff, 0x23, 0x54, 0xff, 0x23, 0x95, 0xff, 0x23, 0x74, 0xff, 0x13, 0x34, 0xff, 0xa6, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd8, 0xff, 0x25, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x25, 0x15, 0xff, 0x7e, 0x5a, 0xff, 0xff, 0xff, 0xff, 0x86, 0x9c, 0xff, 0x35, 0x38, 0xff, 0x3d, 0x58, 0xff, 0x2b, 0xf5, 0xff, 0x1a, 0xd3, 0xff, 0x1a, 0xf3, 0xff, 0x1a, 0xf3, 0xff, 0x12, 0x90, 0xff, 0x0a, 0x4e, 0xff, 0x12, 0x8f, 0xff, 0x1a, 0x4e, 0xff, 0x1a, 0x4e, 0xff, 0x1a, 0x4e, 0xff, 0x1a, 0x6e, 0xff, 0x1a, 0x4e, 0xff, 0x1a, 0x2e, 0xff, 0x1a, 0xef, 0xff, 0x45, 0x99, 0xff, 0x1a, 0xd3, 0xff, 0x23, 0x34, 0xff, 0x23, 0x14, 0xff, 0x23, 0x34, 0xff, 0x12, 0xb3, 0xff, 0xa5, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x55, 0xb8, 0xff, 0x25, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x16, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf4, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x1c, 0xf5, 0xff, 0x7e, 0x39, 0xff, 0xff, 0xff, 0xff, 0x74, 0xd8, 0xff, 0x0a, 0x31, 0xff, 0x1a, 0x92, 0xff, 0x1a, 0xd3, 0xff, 0x23, 0x74, 0xff, 0x3d, 0x38, 0xff, 0x3e, 0x1a, 0xff, 0x44, 0xf4, 0xff, 0x74, 0xd1, 0xff, 0x34, 0x11, 0xff, 0x0b, 0x71, 0xff, 0x1b, 0x50, 0xff, 0x1a, 0x4e, 0xff, 0x1a, 0x4e, 0xff, 0x1a, 0x4e, 0xff, 0x12, 0x4e, 0xff, 0x12, 0x0d, 0xff, 0x1a, 0xf3, 0xff, 0x23, 0x34, 0xff, 0x23, 0x13, 0xff, 0x23, 0x13, 0xff, 0x23, 0x13, 0xff, 0x12, 0xb3, 0xff, 0xa5, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x55, 0xb7, 0xff, 0x25, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xf5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x15, 0xff, 0x1c, 0xf5, 0xff, 0x7e, 0x39, 0xff, 0xff, 0xff, 0xff, 0x86, 0xbc, 0xff, 0x35, 0xf9, 0xff, 0x46, 0x1a, 0xff, 0x4e, 0x1a, 0xff, 0x46, 0x1a, 0xff, 0x2d, 0xb9, 0xff, 0xa6, 0xbb, 0xff, 0xff, 0x55, 0xff, 0xff, 0x11, 0xff, 0xff, 0x72, 0xff, 0x5c, 0x50, 0xff, 0x13, 0x50, 0xff, 0x1b, 0x70, 0xff, 0x12, 0x2d, 0xff, 0x12, 0x2d, 0xff, 0x12, 0x2d, 0xff, 0x12, 0x2d, 0xff, 0x23, 0x13, 0xff, 0x23, 0x13, 0xff, 0x23, 0x13, 0xff, 0x22, 0xf3, 0xff, 0x22, 0xf3, 0xff, 0x12, 0x92, 0xff, 0xa5, 0xfa, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x97, 0xff, 0x24, 0xf5, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x1c, 0xd4, 0xff, 0x7e, 0x39, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5c, 0xff, 0x6e, 0x19, 0xff, 0x2d, 0x79, 0xff, 0x2d, 0x99, 0xff, 0x25, 0x79, 0xff, 0xa6, 0xba, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x15, 0xff, 0xfe, 0xd1, 0xff, 0xfe, 0xf1, 0xff, 0xd6, 0x31, 0xff, 0x02, 0xcf, 0xff, 0x1b, 0x50, 0xff, 0x1b, 0x0f, 0xff, 0x12, 0x0d, 0xff, 0x12, 0x2d, 0xff, 0x12, 0x0c, 0xff, 0x22, 0xf3, 0xff, 0x22, 0xf3, 0xff, 0x22, 0xf3, 0xff, 0x1a, 0xf3, 0xff, 0x1a, 0xf3, 0xff, 0x0a, 0x72, 0xff, 0xa5, 0xda, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x97, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x1c, 0xd4, 0xff, 0x7e, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x7b, 0xff, 0xd6, 0xfa, 0xff, 0xe7, 0x3a, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x16, 0xff, 0xfe, 0xd1, 0xff, 0xfe, 0xd1, 0xff, 0xff, 0x31, 0xff, 0x23, 0x4f, 0xff, 0x13, 0x0f, 0xff, 0x1b, 0x4f, 0xff, 0x12, 0x6d, 0xff, 0x12, 0x0c, 0xff, 0x11, 0xec, 0xff, 0x1a, 0xd3, 0xff, 0x1a, 0xd3, 0xff, 0x1a, 0xd2, 0xff, 0x1a, 0xd2, 0xff, 0x1a, 0xd2, 0xff, 0x0a, 0x71, 0xff, 0xa5, 0xda, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x77, 0xff, 0x1c, 0xd4, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x1c, 0xb4, 0xff, 0x7e, 0x19, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xde, 0xcf, 0xff, 0xff, 0x59, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x7c, 0xff, 0xde, 0xf1, 0xff, 0xce, 0xa8, 0xff, 0xbd, 0xe5, 0xff, 0xd6, 0x0a, 0xff, 0xfe, 0xf2, 0xff, 0xfe, 0xd1, 0xff, 0xfe, 0xf1, 0xff, 0x1b, 0x0f, 0xff, 0x12, 0xef, 0xff, 0x1b, 0x0f, 0xff, 0x11, 0xec, 0xff, 0x11, 0xeb, 0xff, 0x1a, 0xd2, 0xff, 0x1a, 0xd2, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0xb2, 0xff, 0x0a, 0x51, 0xff, 0xa5, 0xda, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x77, 0xff, 0x1c, 0xb4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x1c, 0x94, 0xff, 0x7e, 0x19, 0xff, 0xff, 0xff, 0xff, 0xce, 0xcb, 0xff, 0xa6, 0x00, 0xff, 0xa6, 0x00, 0xff, 0xa6, 0x20, 0xff, 0xa6, 0x20, 0xff, 0xae, 0x20, 0xff, 0xae, 0x40, 0xff, 0x95, 0x60, 0xff, 0x84, 0xe0, 0xff, 0xa5, 0x62, 0xff, 0xfe, 0xf2, 0xff, 0xfe, 0xd0, 0xff, 0xff, 0x30, 0xff, 0x12, 0xee, 0xff, 0x12, 0xee, 0xff, 0x12, 0x8d, 0xff, 0x11, 0xab, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0x92, 0xff, 0x1a, 0x92, 0xff, 0x0a, 0x31, 0xff, 0xa5, 0xda, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x56, 0xff, 0x1c, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x14, 0x93, 0xff, 0x75, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xce, 0xcc, 0xff, 0xa6, 0x00, 0xff, 0xae, 0x00, 0xff, 0xa6, 0x00, 0xff, 0xa6, 0x00, 0xff, 0xa6, 0x00, 0xff, 0xae, 0x20, 0xff, 0x9d, 0x81, 0xff, 0x84, 0xc0, 0xff, 0x7c, 0xc0, 0xff, 0xe6, 0x2a, 0xff, 0xfe, 0xd0, 0xff, 0xfe, 0xf0, 0xff, 0xcd, 0xcf, 0xff, 0x02, 0x6e, 0xff, 0x12, 0xee, 0xff, 0x12, 0x2c, 0xff, 0x1a, 0x71, 0xff, 0x1a, 0x92, 0xff, 0x1a, 0x92, 0xff, 0x1a, 0x92, 0xff, 0x1a, 0x71, 0xff, 0x01, 0xd0, 0xff, 0x9d, 0x99, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x56, 0xff, 0x1c, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x24, 0x94, 0xff, 0x14, 0x73, 0xff, 0x75, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xce, 0xcc, 0xff, 0xb6, 0x65, 0xff, 0xce, 0xcc, 0xff, 0xdf, 0x32, 0xff, 0xef, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xce, 0x59, 0xff, 0xad, 0xcf, 0xff, 0xbd, 0xca, 0xff, 0xfe, 0xcf, 0xff, 0xfe, 0xae, 0xff, 0xff, 0x2f, 0xff, 0x02, 0x4d, 0xff, 0x12, 0xad, 0xff, 0x12, 0xad, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0x71, 0xff, 0x0a, 0x10, 0xff, 0x01, 0xd0, 0xff, 0x0a, 0x10, 0xff, 0x6c, 0x76, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x56, 0xff, 0x1c, 0x93, 0xff, 0x24, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x14, 0x73, 0xff, 0x75, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9e, 0xff, 0xb6, 0x7a, 0xff, 0xd6, 0x9b, 0xff, 0xe6, 0xbd, 0xff, 0xd6, 0x9d, 0xff, 0xce, 0x7c, 0xff, 0xde, 0x78, 0xff, 0xf6, 0xb4, 0xff, 0x0a, 0x8d, 0xff, 0x02, 0x0b, 0xff, 0x01, 0xea, 0xff, 0x25, 0x98, 0xff, 0x24, 0xd7, 0xff, 0x6c, 0x16, 0xff, 0xce, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xf5, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x14, 0x53, 0xff, 0x7d, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x3d, 0xff, 0x9e, 0x7a, 0xff, 0x75, 0xd8, 0xff, 0x4d, 0x36, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x0c, 0x73, 0xff, 0x3c, 0xf5, 0xff, 0x7d, 0x97, 0xff, 0xbe, 0x3a, 0xff, 0xe6, 0x9c, 0xff, 0xd6, 0x9c, 0xff, 0xee, 0xfc, 0xff, 0xc6, 0x3a, 0xff, 0x7c, 0x94, 0xff, 0xd7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0x96, 0x5a, 0xff, 0x3c, 0xf5, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x14, 0x53, 0xff, 0x0c, 0x52, 0xff, 0x0c, 0x32, 0xff, 0x0c, 0x52, 0xff, 0x14, 0x53, 0xff, 0x14, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x14, 0x73, 0xff, 0x0c, 0x53, 0xff, 0x1c, 0x94, 0xff, 0x5d, 0x36, 0xff, 0x9d, 0xd8, 0xff, 0xde, 0x9b, 0xff, 0xee, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbe, 0xff, 0x8e, 0x39, 0xff, 0x2c, 0x94, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x73, 0xff, 0x14, 0x73, 0xff, 0x0c, 0x53, 0xff, 0x0c, 0x52, 0xff, 0x44, 0xf5, 0xff, 0x24, 0x93, 0xff, 0x1c, 0x53, 0xff, 0x14, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x14, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x52, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x52, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x13, 0xf2, 0xff, 0x14, 0x12, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xd1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x14, 0x12, 0xff, 0x14, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x46, 0xff, 0xe2, 0xdb, 0x47, 0xff, 0xe1, 0xdc, 0x47, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe0, 0xdb, 0x46, 0xff, 0xe0, 0xdd, 0x46, 0xff, 0xe0, 0xdb, 0x46, 0xff, 0xe0, 0xdb, 0x46, 0xff, 0xe0, 0xdd, 0x46, 0xff, 0xe0, 0xdd, 0x46, 0xff, 0xe0, 0xdc, 0x45, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xdc, 0xda, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xda, 0x46, 0xff, 0xe0, 0xdb, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe0, 0xdc, 0x47, 0xff, 0xe2, 0xdf, 0x47, 0xff, 0xe1, 0xdc, 0x46, 0xff, 0xe2, 0xe0, 0x47, 0xff, 0xe2, 0xe1, 0x47, 0xff, 0xe2, 0xe1, 0x47, 0xff, 0xe2, 0xe1, 0x47, 0xff, 0xe4, 0xe1, 0x48, 0xff, 0xe3, 0xe1, 0x47, 0xff, 0xe6, 0xe3, 0x4a, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe3, 0xe3, 0x47, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xdc, 0xd8, 0x45, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd4, 0x42, 0xff, 0xd9, 0xd5, 0x43, 0xff, 0xdb, 0xd6, 0x44, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe2, 0xde, 0x47, 0xff, 0xe3, 0xdf, 0x48, 0xff, 0xe3, 0xe0, 0x49, 0xff, 0xe4, 0xe0, 0x49, 0xff, 0xe4, 0xe1, 0x4a, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe5, 0xe1, 0x4a, 0xff, 0xe4, 0xe1, 0x4a, 0xff, 0xe4, 0xe1, 0x49, 0xff, 0xe3, 0xe0, 0x49, 0xff, 0xe2, 0xdf, 0x48, 0xff, 0xe1, 0xde, 0x48, 0xff, 0xe0, 0xdd, 0x47, 0xff, 0xe0, 0xdb, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xd6, 0xd2, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xce, 0x39, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd7, 0xd3, 0x42, 0xff, 0xd9, 0xd7, 0x43, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xde, 0xda, 0x45, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xde, 0x48, 0xff, 0xe2, 0xde, 0x48, 0xff, 0xe2, 0xdf, 0x48, 0xff, 0xe3, 0xdf, 0x48, 0xff, 0xe3, 0xdf, 0x49, 0xff, 0xe3, 0xdf, 0x49, 0xff, 0xe3, 0xdf, 0x48, 0xff, 0xe2, 0xdf, 0x48, 0xff, 0xe2, 0xde, 0x48, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe0, 0xdd, 0x47, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xda, 0x46, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd8, 0xd7, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xc9, 0x3c, 0xff, 0xd8, 0xd4, 0x42, 0xff, 0xd8, 0xd4, 0x42, 0xff, 0xd8, 0xd4, 0x42, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xde, 0xda, 0x45, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xe0, 0xdc, 0x47, 0xff, 0xe0, 0xdc, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe0, 0xdc, 0x47, 0xff, 0xe0, 0xdc, 0x47, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xde, 0xda, 0x45, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xdc, 0xd7, 0x44, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xd9, 0xd5, 0x43, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd5, 0xd0, 0x41, 0xff, 0xd4, 0xd0, 0x40, 0xff, 0xd3, 0xcf, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcb, 0x3f, 0xff, 0xd0, 0xcc, 0x3c, 0xff, 0xd4, 0xd0, 0x41, 0xff, 0xd6, 0xd0, 0x40, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xdb, 0xd6, 0x44, 0xff, 0xdc, 0xd7, 0x44, 0xff, 0xdd, 0xd8, 0x45, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xde, 0xda, 0x45, 0xff, 0xde, 0xda, 0x46, 0xff, 0xde, 0xda, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdf, 0xda, 0x46, 0xff, 0xde, 0xda, 0x45, 0xff, 0xde, 0xda, 0x45, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xdd, 0xd8, 0x44, 0xff, 0xdc, 0xd7, 0x44, 0xff, 0xdb, 0xd6, 0x44, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd7, 0xd1, 0x41, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xd0, 0x40, 0xff, 0xd4, 0xd0, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xc8, 0x3b, 0xff, 0xcf, 0xc8, 0x3c, 0xff, 0xcf, 0xcb, 0x3d, 0xff, 0xd2, 0xcd, 0x3e, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd8, 0xd4, 0x42, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xdb, 0xd7, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdd, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdd, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd7, 0x44, 0xff, 0xdb, 0xd7, 0x44, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd2, 0xcd, 0x3e, 0xff, 0xd3, 0xd0, 0x3e, 0xff, 0xd5, 0xd0, 0x3f, 0xff, 0xd5, 0xd0, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0x3c, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd2, 0xcd, 0x3e, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd4, 0xcf, 0x40, 0xff, 0xd6, 0xd0, 0x40, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xd9, 0xd5, 0x43, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xd9, 0xd5, 0x42, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xc9, 0xc3, 0x38, 0xff, 0xcb, 0xc6, 0x3a, 0xff, 0xce, 0xce, 0x3d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xc1, 0x37, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xcd, 0xc6, 0x3b, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd5, 0xcf, 0x40, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd4, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd6, 0xd1, 0x40, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd1, 0xcc, 0x3e, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xce, 0xc8, 0x3b, 0xff, 0xcc, 0xc6, 0x3b, 0xff, 0xc6, 0xc0, 0x37, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc6, 0xc0, 0x37, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xbb, 0x34, 0xff, 0xc4, 0xbe, 0x36, 0xff, 0xc7, 0xc1, 0x37, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xcc, 0xc6, 0x3b, 0xff, 0xcd, 0xc7, 0x3b, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xce, 0x3c, 0xff, 0xd4, 0xcf, 0x3a, 0xff, 0xd6, 0xd0, 0x3f, 0xff, 0xd6, 0xd1, 0x40, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd6, 0xd1, 0x40, 0xff, 0xd6, 0xd0, 0x40, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd5, 0xcf, 0x40, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xce, 0xc8, 0x3a, 0xff, 0xcd, 0xc7, 0x39, 0xff, 0xcc, 0xc6, 0x3a, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xc7, 0xc3, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc7, 0xc2, 0x37, 0xff, 0xc6, 0xbe, 0x37, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xb9, 0x33, 0xff, 0xc5, 0xc1, 0x36, 0xff, 0xc4, 0xbe, 0x36, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc9, 0xc3, 0x39, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcc, 0xc6, 0x39, 0xff, 0xcc, 0xc6, 0x36, 0xff, 0xcd, 0xc6, 0x32, 0xff, 0xcd, 0xc6, 0x2f, 0xff, 0xcd, 0xc6, 0x2c, 0xff, 0xcc, 0xc6, 0x28, 0xff, 0xcd, 0xc7, 0x29, 0xff, 0xd7, 0xd2, 0x50, 0xff, 0xdb, 0xd7, 0x68, 0xff, 0xd1, 0xcc, 0x2f, 0xff, 0xd2, 0xcc, 0x2f, 0xff, 0xd3, 0xcd, 0x36, 0xff, 0xd4, 0xce, 0x3c, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd1, 0xcc, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xcf, 0xc9, 0x39, 0xff, 0xcc, 0xc6, 0x31, 0xff, 0xc8, 0xc1, 0x26, 0xff, 0xcd, 0xc7, 0x3e, 0xff, 0xcf, 0xc9, 0x47, 0xff, 0xca, 0xc3, 0x38, 0xff, 0xc9, 0xc2, 0x39, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc7, 0xbf, 0x37, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc6, 0xc0, 0x37, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xb9, 0x33, 0xff, 0xc4, 0xbe, 0x36, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc7, 0xbf, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc9, 0xc2, 0x38, 0xff, 0xc7, 0xc0, 0x2e, 0xff, 0xca, 0xc4, 0x37, 0xff, 0xd6, 0xd0, 0x5f, 0xff, 0xe0, 0xdc, 0x85, 0xff, 0xea, 0xe7, 0xaa, 0xff, 0xf3, 0xf2, 0xd0, 0xff, 0xfd, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf5, 0xff, 0xff, 0xed, 0xe8, 0xf5, 0xff, 0xe5, 0xe1, 0xc1, 0xff, 0xdd, 0xd8, 0x85, 0xff, 0xd3, 0xce, 0x45, 0xff, 0xcf, 0xc9, 0x29, 0xff, 0xd0, 0xca, 0x32, 0xff, 0xd1, 0xcb, 0x38, 0xff, 0xd1, 0xcc, 0x3d, 0xff, 0xd1, 0xcb, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xcf, 0xc9, 0x39, 0xff, 0xcc, 0xc6, 0x31, 0xff, 0xc9, 0xc2, 0x25, 0xff, 0xcf, 0xc9, 0x3f, 0xff, 0xe3, 0xdf, 0x90, 0xff, 0xf7, 0xf6, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xcf, 0x60, 0xff, 0xc7, 0xc0, 0x32, 0xff, 0xc8, 0xc0, 0x38, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc5, 0xbe, 0x37, 0xff, 0xc6, 0xc0, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xb2, 0x2f, 0xff, 0xbc, 0xb3, 0x2f, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xc2, 0xbb, 0x35, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc5, 0xbd, 0x36, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc5, 0xbd, 0x2d, 0xff, 0xdf, 0xdb, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xf8, 0xfc, 0xfe, 0xff, 0xe0, 0xef, 0xf6, 0xff, 0xe2, 0xe5, 0xe7, 0xff, 0xf1, 0xe6, 0xe6, 0xff, 0xef, 0xe7, 0xee, 0xff, 0xef, 0xe9, 0xf8, 0xff, 0xe9, 0xe5, 0xe0, 0xff, 0xdf, 0xdb, 0xa1, 0xff, 0xd6, 0xd0, 0x64, 0xff, 0xcd, 0xc7, 0x2c, 0xff, 0xcc, 0xc6, 0x2c, 0xff, 0xc8, 0xc2, 0x24, 0xff, 0xd2, 0xcc, 0x4a, 0xff, 0xe5, 0xe2, 0x99, 0xff, 0xfc, 0xfa, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xcc, 0x5b, 0xff, 0xc5, 0xbe, 0x31, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc5, 0xbd, 0x36, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x34, 0xff, 0xbf, 0xb7, 0x2f, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xb7, 0x2f, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbf, 0xb7, 0x33, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc4, 0xbd, 0x36, 0xff, 0xc3, 0xbb, 0x2c, 0xff, 0xdc, 0xd7, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xdb, 0xc4, 0xff, 0xd3, 0xb1, 0x79, 0xff, 0xca, 0xa1, 0x56, 0xff, 0xde, 0xd4, 0x5c, 0xff, 0xdd, 0xd9, 0x71, 0xff, 0xe2, 0xf4, 0xff, 0xff, 0xe6, 0xf6, 0xff, 0xff, 0xc6, 0xef, 0xff, 0xff, 0xb1, 0xec, 0xff, 0xff, 0xb8, 0xeb, 0xff, 0xff, 0xc9, 0xe7, 0xf6, 0xff, 0xdb, 0xe6, 0xeb, 0xff, 0xec, 0xe5, 0xe4, 0xff, 0xf3, 0xe6, 0xea, 0xff, 0xf9, 0xe9, 0xf5, 0xff, 0xf0, 0xe7, 0xf4, 0xff, 0xe2, 0xde, 0xba, 0xff, 0xfe, 0xfc, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xf3, 0xed, 0xff, 0x22, 0xe1, 0xd4, 0xff, 0x83, 0xee, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xca, 0x5a, 0xff, 0xc3, 0xbc, 0x30, 0xff, 0xc4, 0xbd, 0x36, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbe, 0xb8, 0x32, 0xff, 0xbb, 0xb3, 0x2f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xb1, 0x2f, 0xff, 0xc1, 0xb7, 0x2f, 0xff, 0xbc, 0xb4, 0x31, 0xff, 0xbe, 0xb5, 0x32, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc1, 0xb9, 0x2b, 0xff, 0xdb, 0xd6, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xd9, 0x8e, 0xff, 0xb0, 0x73, 0x10, 0xff, 0xb4, 0x79, 0x1d, 0xff, 0xb7, 0x7f, 0x23, 0xff, 0xcc, 0xad, 0x3f, 0xff, 0xdd, 0xd0, 0x4f, 0xff, 0xe5, 0xe2, 0x84, 0xff, 0xc2, 0xc9, 0x8b, 0xff, 0xae, 0xc0, 0x99, 0xff, 0xb3, 0xd2, 0xc7, 0xff, 0xb5, 0xef, 0xff, 0xff, 0xb2, 0xe7, 0xff, 0xff, 0xb3, 0xe8, 0xff, 0xff, 0xab, 0xe3, 0xf4, 0xff, 0x6a, 0xd4, 0xcb, 0xff, 0xce, 0xe0, 0xde, 0xff, 0xff, 0xea, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xf3, 0xed, 0xff, 0x35, 0xe4, 0xd8, 0xff, 0x00, 0xd9, 0xc7, 0xff, 0x00, 0xda, 0xc8, 0xff, 0x00, 0xd8, 0xc6, 0xff, 0x95, 0xf0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xc9, 0x59, 0xff, 0xc2, 0xba, 0x2f, 0xff, 0xc2, 0xbb, 0x35, 0xff, 0xc1, 0xba, 0x34, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbe, 0xb5, 0x31, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xbb, 0xb1, 0x2f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xb1, 0x2f, 0xff, 0xb9, 0xb1, 0x2f, 0xff, 0xbb, 0xb2, 0x2f, 0xff, 0xbc, 0xb3, 0x30, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbf, 0xb6, 0x32, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xc1, 0xb9, 0x34, 0xff, 0xbf, 0xb7, 0x2a, 0xff, 0xda, 0xd5, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe0, 0x95, 0xff, 0xd7, 0xca, 0x4b, 0xff, 0xc3, 0x9c, 0x37, 0xff, 0xb3, 0x79, 0x22, 0xff, 0xb3, 0x76, 0x20, 0xff, 0xb3, 0x77, 0x1f, 0xff, 0xc2, 0x92, 0x2e, 0xff, 0xb0, 0x8e, 0x22, 0xff, 0xa7, 0x92, 0x12, 0xff, 0xa8, 0x8b, 0x08, 0xff, 0xaa, 0x9c, 0x36, 0xff, 0xb4, 0xee, 0xff, 0xff, 0xbc, 0xe7, 0xff, 0xff, 0x67, 0xd9, 0xe3, 0xff, 0x00, 0xc4, 0xb3, 0xff, 0x00, 0xc4, 0xb6, 0xff, 0x00, 0xc8, 0xbb, 0xff, 0x00, 0xdc, 0xca, 0xff, 0x00, 0xd9, 0xc8, 0xff, 0x00, 0xdb, 0xca, 0xff, 0x00, 0xdb, 0xcb, 0xff, 0x00, 0xdb, 0xca, 0xff, 0x00, 0xd7, 0xc3, 0xff, 0x90, 0xee, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xc7, 0x58, 0xff, 0xc0, 0xb8, 0x2e, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbc, 0xb3, 0x30, 0xff, 0xbb, 0xb2, 0x2f, 0xff, 0xb7, 0xaf, 0x2d, 0xff, 0xb6, 0xad, 0x2d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xb4, 0x2f, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xba, 0xb2, 0x2f, 0xff, 0xbc, 0xb3, 0x30, 0xff, 0xbd, 0xb4, 0x31, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbd, 0xb5, 0x29, 0xff, 0xd9, 0xd3, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xe3, 0xae, 0xff, 0xd8, 0xd4, 0x7f, 0xff, 0xda, 0xd0, 0x5a, 0xff, 0xdb, 0xcf, 0x4f, 0xff, 0xce, 0xb6, 0x4a, 0xff, 0xbc, 0x8e, 0x30, 0xff, 0xb6, 0x7c, 0x23, 0xff, 0x9d, 0x64, 0x1e, 0xff, 0x99, 0x75, 0x1d, 0xff, 0xa7, 0x95, 0x21, 0xff, 0xa4, 0x84, 0x00, 0xff, 0xb0, 0xe6, 0xff, 0xff, 0xb8, 0xe7, 0xff, 0xff, 0x6d, 0xd9, 0xe3, 0xff, 0x00, 0xc3, 0xb2, 0xff, 0x00, 0xc4, 0xb7, 0xff, 0x00, 0xc5, 0xb8, 0xff, 0x00, 0xdd, 0xcd, 0xff, 0x00, 0xdb, 0xca, 0xff, 0x00, 0xda, 0xca, 0xff, 0x00, 0xda, 0xc8, 0xff, 0x00, 0xd7, 0xc2, 0xff, 0x51, 0xe0, 0xda, 0xff, 0xb6, 0xf3, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xc5, 0x57, 0xff, 0xbe, 0xb6, 0x2d, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbd, 0xb4, 0x31, 0xff, 0xbb, 0xb3, 0x30, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb6, 0xad, 0x2c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb9, 0xb0, 0x2c, 0xff, 0xb7, 0xb1, 0x2d, 0xff, 0xb6, 0xad, 0x2c, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xbb, 0xb2, 0x30, 0xff, 0xbc, 0xb4, 0x31, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbb, 0xb2, 0x27, 0xff, 0xd7, 0xd2, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf7, 0xff, 0xff, 0xe0, 0xf3, 0xff, 0xff, 0xe0, 0xf5, 0xff, 0xff, 0xdb, 0xdf, 0xaf, 0xff, 0xd7, 0xc8, 0x45, 0xff, 0xdd, 0xd8, 0x5e, 0xff, 0xc1, 0x95, 0x34, 0xff, 0x9b, 0x66, 0x1d, 0xff, 0x8a, 0x54, 0x19, 0xff, 0xa0, 0x88, 0x1d, 0xff, 0xa2, 0x8b, 0x19, 0xff, 0xaf, 0xee, 0xff, 0xff, 0xaf, 0xe4, 0xff, 0xff, 0xb5, 0xe5, 0xff, 0xff, 0x00, 0xbf, 0xac, 0xff, 0x00, 0xc0, 0xaf, 0xff, 0x00, 0xc2, 0xb1, 0xff, 0x00, 0xdb, 0xc8, 0xff, 0x00, 0xd7, 0xc4, 0xff, 0x00, 0xd6, 0xc2, 0xff, 0x08, 0xd9, 0xc9, 0xff, 0xa7, 0xea, 0xec, 0xff, 0xf5, 0xf1, 0xfd, 0xff, 0xf8, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xc3, 0x56, 0xff, 0xbc, 0xb4, 0x2c, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xbb, 0xb2, 0x30, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb6, 0xad, 0x2c, 0xff, 0xb0, 0xa5, 0x29, 0xff, 0xb0, 0xa5, 0x28, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb6, 0xb0, 0x2c, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb6, 0xac, 0x2c, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb9, 0xb0, 0x2f, 0xff, 0xba, 0xb2, 0x2f, 0xff, 0xbb, 0xb3, 0x30, 0xff, 0xb9, 0xb0, 0x26, 0xff, 0xd6, 0xd1, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xf3, 0xf8, 0xff, 0xc4, 0xe4, 0xe5, 0xff, 0xeb, 0xf5, 0xff, 0xff, 0xdf, 0xf4, 0xff, 0xff, 0xd9, 0xd7, 0x96, 0xff, 0xd7, 0xc9, 0x4d, 0xff, 0xd0, 0xb9, 0x4a, 0xff, 0x96, 0x60, 0x1a, 0xff, 0x88, 0x56, 0x19, 0xff, 0x95, 0x71, 0x14, 0xff, 0xa3, 0xa8, 0x64, 0xff, 0xab, 0xea, 0xff, 0xff, 0xaa, 0xe3, 0xff, 0xff, 0xaf, 0xe4, 0xff, 0xff, 0x9f, 0xe0, 0xf9, 0xff, 0x52, 0xd1, 0xd7, 0xff, 0x58, 0xd3, 0xd9, 0xff, 0x72, 0xe6, 0xe1, 0xff, 0x89, 0xe7, 0xe5, 0xff, 0xc5, 0xed, 0xf2, 0xff, 0xf8, 0xf2, 0xfe, 0xff, 0xe6, 0xf0, 0xf9, 0xff, 0xda, 0xee, 0xf8, 0xff, 0xf0, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xc2, 0x55, 0xff, 0xba, 0xb1, 0x2a, 0xff, 0xbb, 0xb3, 0x30, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb0, 0xa6, 0x29, 0xff, 0xb5, 0xa8, 0x2c, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb6, 0xaf, 0x2e, 0xff, 0xb0, 0xa7, 0x29, 0xff, 0xb3, 0xa9, 0x2a, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb6, 0xad, 0x2d, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb9, 0xb1, 0x2f, 0xff, 0xb7, 0xae, 0x25, 0xff, 0xd5, 0xcf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xbe, 0x96, 0xff, 0x09, 0x91, 0x4c, 0xff, 0x28, 0xa0, 0x66, 0xff, 0xe9, 0xf5, 0xff, 0xff, 0xdc, 0xeb, 0xe6, 0xff, 0xd5, 0xc6, 0x43, 0xff, 0xcf, 0xb6, 0x48, 0xff, 0x93, 0x5d, 0x19, 0xff, 0x85, 0x54, 0x19, 0xff, 0x92, 0x6f, 0x13, 0xff, 0xa1, 0xa9, 0x6d, 0xff, 0xa9, 0xf0, 0xff, 0xff, 0xa8, 0xe5, 0xff, 0xff, 0xa7, 0xe5, 0xff, 0xff, 0xab, 0xe6, 0xff, 0xff, 0xb0, 0xe8, 0xff, 0xff, 0xb4, 0xe5, 0xff, 0xff, 0xf0, 0xf2, 0xfa, 0xff, 0xe7, 0xf0, 0xfa, 0xff, 0xe1, 0xef, 0xf9, 0xff, 0xdc, 0xee, 0xf8, 0xff, 0xdc, 0xef, 0xf8, 0xff, 0xd9, 0xef, 0xfd, 0xff, 0xee, 0xee, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xc0, 0x54, 0xff, 0xb8, 0xaf, 0x29, 0xff, 0xb9, 0xb0, 0x2f, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb6, 0xad, 0x2c, 0xff, 0xb5, 0xab, 0x2c, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb2, 0xa9, 0x2a, 0xff, 0xb0, 0xa6, 0x29, 0xff, 0xb4, 0xa7, 0x2b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb4, 0xaa, 0x2a, 0xff, 0xaf, 0xa8, 0x28, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb3, 0xaa, 0x2b, 0xff, 0xb5, 0xab, 0x2b, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb7, 0xad, 0x2d, 0xff, 0xb8, 0xaf, 0x2d, 0xff, 0xb5, 0xac, 0x24, 0xff, 0xd3, 0xce, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xc1, 0x9e, 0xff, 0x1c, 0x96, 0x5a, 0xff, 0x09, 0x8f, 0x49, 0xff, 0xdf, 0xf0, 0xff, 0xff, 0xdc, 0xea, 0xe8, 0xff, 0xd5, 0xc5, 0x41, 0xff, 0xc4, 0xa2, 0x3c, 0xff, 0x91, 0x5c, 0x19, 0xff, 0x82, 0x53, 0x18, 0xff, 0x8b, 0x64, 0x1a, 0xff, 0x9a, 0x83, 0x0e, 0xff, 0x9e, 0xaa, 0x7a, 0xff, 0xa2, 0xd0, 0xd7, 0xff, 0xa2, 0xd2, 0xdc, 0xff, 0xa0, 0xc5, 0xbd, 0xff, 0x9e, 0xbd, 0xaa, 0xff, 0xa8, 0xea, 0xff, 0xff, 0xe2, 0xf1, 0xfa, 0xff, 0xdb, 0xef, 0xf8, 0xff, 0xdb, 0xef, 0xf8, 0xff, 0xdb, 0xee, 0xf8, 0xff, 0xdb, 0xf2, 0xff, 0xff, 0xd2, 0xcb, 0x73, 0xff, 0xec, 0xe2, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xbe, 0x53, 0xff, 0xb6, 0xad, 0x28, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb6, 0xad, 0x2d, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb3, 0xa9, 0x2b, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb0, 0xa5, 0x28, 0xff, 0xb0, 0xa6, 0x29, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb3, 0xa9, 0x2b, 0xff, 0xad, 0xa4, 0x27, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xb0, 0xa6, 0x29, 0xff, 0xb1, 0xa8, 0x29, 0xff, 0xb3, 0xa9, 0x2a, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb5, 0xab, 0x2c, 0xff, 0xb6, 0xac, 0x2c, 0xff, 0xb3, 0xa9, 0x22, 0xff, 0xd3, 0xcd, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xba, 0x93, 0xff, 0x06, 0x89, 0x45, 0xff, 0xb0, 0xdb, 0xda, 0xff, 0xe3, 0xf4, 0xff, 0xff, 0xd8, 0xe5, 0xd6, 0xff, 0xd6, 0xc8, 0x43, 0xff, 0xb2, 0x7d, 0x28, 0xff, 0x8e, 0x5d, 0x1b, 0xff, 0x7f, 0x52, 0x18, 0xff, 0x80, 0x50, 0x18, 0xff, 0x87, 0x60, 0x19, 0xff, 0x95, 0x7d, 0x12, 0xff, 0x95, 0x7b, 0x09, 0xff, 0x94, 0x77, 0x08, 0xff, 0x93, 0x77, 0x0a, 0xff, 0x92, 0x74, 0x05, 0xff, 0x98, 0x89, 0x2e, 0xff, 0xe2, 0xf7, 0xff, 0xff, 0xdb, 0xf0, 0xff, 0xff, 0xda, 0xed, 0xf7, 0xff, 0xda, 0xef, 0xfb, 0xff, 0xd9, 0xec, 0xf1, 0xff, 0xcd, 0xb7, 0x27, 0xff, 0xeb, 0xe5, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xbc, 0x52, 0xff, 0xb4, 0xab, 0x27, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb5, 0xab, 0x2b, 0xff, 0xb3, 0xaa, 0x2b, 0xff, 0xb3, 0xa9, 0x2a, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb0, 0xa6, 0x29, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xb0, 0xa3, 0x27, 0xff, 0xb0, 0xa6, 0x29, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb0, 0xa6, 0x28, 0xff, 0xb0, 0xa4, 0x28, 0xff, 0xad, 0xa3, 0x27, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb3, 0xa9, 0x2a, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb1, 0xa7, 0x21, 0xff, 0xd2, 0xcc, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xe2, 0xdb, 0xff, 0xdd, 0xf1, 0xff, 0xff, 0xde, 0xdf, 0xbd, 0xff, 0xd9, 0xee, 0xfc, 0xff, 0xd4, 0xd5, 0x95, 0xff, 0xd0, 0xbe, 0x42, 0xff, 0xa4, 0x65, 0x1c, 0xff, 0x8d, 0x5c, 0x1b, 0xff, 0x7b, 0x50, 0x17, 0xff, 0x7e, 0x52, 0x18, 0xff, 0x7d, 0x50, 0x17, 0xff, 0x7c, 0x4d, 0x17, 0xff, 0x85, 0x61, 0x19, 0xff, 0x92, 0x7e, 0x1c, 0xff, 0x92, 0x7d, 0x1c, 0xff, 0x8f, 0x7a, 0x1b, 0xff, 0x94, 0x7d, 0x18, 0xff, 0xd8, 0xc7, 0x49, 0xff, 0xd7, 0xe4, 0xd0, 0xff, 0xda, 0xf5, 0xff, 0xff, 0xda, 0xf4, 0xff, 0xff, 0xd1, 0xc6, 0x63, 0xff, 0xcc, 0xb9, 0x36, 0xff, 0xeb, 0xe4, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xbb, 0x51, 0xff, 0xb2, 0xa9, 0x25, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb3, 0xa9, 0x2a, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xad, 0xa3, 0x27, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb0, 0xa4, 0x28, 0xff, 0xab, 0xa3, 0x25, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xae, 0xa2, 0x26, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xaf, 0xa5, 0x1f, 0xff, 0xd0, 0xca, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xf8, 0xff, 0xff, 0xd7, 0xea, 0xf3, 0xff, 0xcc, 0xb6, 0x29, 0xff, 0xce, 0xba, 0x36, 0xff, 0xd4, 0xc7, 0x45, 0xff, 0xbf, 0xa0, 0x3a, 0xff, 0xa4, 0x67, 0x1d, 0xff, 0x8a, 0x59, 0x1a, 0xff, 0x78, 0x4e, 0x16, 0xff, 0x7a, 0x4f, 0x17, 0xff, 0x7b, 0x4f, 0x17, 0xff, 0x7a, 0x4f, 0x17, 0xff, 0x79, 0x4d, 0x16, 0xff, 0x79, 0x4c, 0x16, 0xff, 0x8d, 0x77, 0x1b, 0xff, 0x8d, 0x79, 0x1b, 0xff, 0x91, 0x7c, 0x1e, 0xff, 0xd7, 0xc7, 0x4c, 0xff, 0xd1, 0xbe, 0x39, 0xff, 0xd4, 0xc8, 0x4d, 0xff, 0xd4, 0xc7, 0x4b, 0xff, 0xd3, 0xc5, 0x45, 0xff, 0xd0, 0xc2, 0x3e, 0xff, 0xec, 0xe7, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xb9, 0x50, 0xff, 0xb0, 0xa6, 0x24, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xae, 0xa3, 0x27, 0xff, 0xad, 0xa2, 0x26, 0xff, 0xab, 0xa1, 0x25, 0xff, 0xaa, 0xa0, 0x25, 0xff, 0xa9, 0x9d, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa6, 0x9b, 0x22, 0xff, 0xaf, 0x9e, 0x25, 0xff, 0xaa, 0x9f, 0x24, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xad, 0xa3, 0x27, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xad, 0xa2, 0x1e, 0xff, 0xcf, 0xc9, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xe3, 0xbc, 0xff, 0xcc, 0xbf, 0x4c, 0xff, 0xcf, 0xbe, 0x44, 0xff, 0xd3, 0xc8, 0x4b, 0xff, 0xb2, 0x89, 0x2f, 0xff, 0x9c, 0x5d, 0x1a, 0xff, 0xa5, 0x6a, 0x1f, 0xff, 0x86, 0x56, 0x1a, 0xff, 0x74, 0x4a, 0x15, 0xff, 0x76, 0x4c, 0x16, 0xff, 0x77, 0x4c, 0x16, 0xff, 0x77, 0x4d, 0x16, 0xff, 0x77, 0x4d, 0x16, 0xff, 0x76, 0x4c, 0x16, 0xff, 0x75, 0x4a, 0x16, 0xff, 0x88, 0x72, 0x19, 0xff, 0x90, 0x7d, 0x1e, 0xff, 0xda, 0xcc, 0x4f, 0xff, 0xc6, 0xad, 0x40, 0xff, 0xa2, 0x69, 0x1e, 0xff, 0xa6, 0x6f, 0x21, 0xff, 0xa4, 0x6e, 0x23, 0xff, 0x9d, 0x63, 0x14, 0xff, 0xd9, 0xc2, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb7, 0x4f, 0xff, 0xae, 0xa4, 0x23, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xad, 0xa3, 0x27, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xaa, 0x9f, 0x24, 0xff, 0xaa, 0x9e, 0x24, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa6, 0x9b, 0x22, 0xff, 0xa7, 0x9c, 0x22, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xab, 0xa1, 0x25, 0xff, 0xac, 0xa2, 0x26, 0xff, 0xad, 0xa3, 0x27, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xab, 0xa0, 0x1d, 0xff, 0xcd, 0xc7, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd2, 0x84, 0xff, 0xbf, 0xa5, 0x2f, 0xff, 0xc2, 0xa9, 0x3c, 0xff, 0xaa, 0x7c, 0x28, 0xff, 0x98, 0x58, 0x18, 0xff, 0x9a, 0x5c, 0x1a, 0xff, 0x9c, 0x5c, 0x1a, 0xff, 0x82, 0x52, 0x14, 0xff, 0x73, 0x49, 0x0b, 0xff, 0x77, 0x50, 0x11, 0xff, 0x73, 0x4a, 0x15, 0xff, 0x71, 0x47, 0x15, 0xff, 0x73, 0x4a, 0x15, 0xff, 0x73, 0x4b, 0x16, 0xff, 0x73, 0x4a, 0x15, 0xff, 0x70, 0x46, 0x15, 0xff, 0x7b, 0x5c, 0x18, 0xff, 0xc9, 0xaf, 0x41, 0xff, 0x99, 0x58, 0x19, 0xff, 0x9e, 0x63, 0x1f, 0xff, 0x9e, 0x62, 0x1f, 0xff, 0x9d, 0x63, 0x1d, 0xff, 0x95, 0x56, 0x0e, 0xff, 0xd5, 0xbd, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xb5, 0x4e, 0xff, 0xac, 0xa2, 0x21, 0xff, 0xae, 0xa3, 0x27, 0xff, 0xad, 0xa2, 0x26, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xaa, 0x9f, 0x24, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9d, 0x24, 0xff, 0xa4, 0x9b, 0x21, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa6, 0x9b, 0x22, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xa9, 0x9e, 0x1b, 0xff, 0xcc, 0xc6, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x99, 0x71, 0xff, 0x8b, 0x46, 0x09, 0xff, 0x92, 0x4f, 0x15, 0xff, 0x97, 0x5a, 0x1a, 0xff, 0xa1, 0x6c, 0x21, 0xff, 0xc1, 0xa5, 0x3b, 0xff, 0xd4, 0xc0, 0x3a, 0xff, 0xa3, 0x9b, 0x3d, 0xff, 0x87, 0x98, 0x6f, 0xff, 0x87, 0x7f, 0x34, 0xff, 0x85, 0x6d, 0x0b, 0xff, 0x80, 0x68, 0x18, 0xff, 0x6f, 0x47, 0x15, 0xff, 0x6f, 0x47, 0x15, 0xff, 0x70, 0x48, 0x15, 0xff, 0x6f, 0x48, 0x14, 0xff, 0x68, 0x42, 0x13, 0xff, 0x9b, 0x5c, 0x1b, 0xff, 0x9f, 0x64, 0x1f, 0xff, 0x9c, 0x62, 0x1e, 0xff, 0x9c, 0x61, 0x1e, 0xff, 0x9b, 0x61, 0x1e, 0xff, 0x95, 0x55, 0x0e, 0xff, 0xd5, 0xbd, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xb3, 0x4d, 0xff, 0xaa, 0x9f, 0x20, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa5, 0x99, 0x21, 0xff, 0xa0, 0x95, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa6, 0x9b, 0x22, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xa7, 0x9b, 0x1a, 0xff, 0xcb, 0xc5, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xd5, 0x81, 0xff, 0xcc, 0xbb, 0x33, 0xff, 0xcf, 0xc1, 0x44, 0xff, 0xcf, 0xc1, 0x45, 0xff, 0xcf, 0xbf, 0x44, 0xff, 0xcb, 0xb4, 0x2c, 0xff, 0xd5, 0xd5, 0x9f, 0xff, 0xa9, 0xea, 0xff, 0xff, 0x8c, 0xe1, 0xff, 0xff, 0x91, 0xee, 0xff, 0xff, 0x84, 0x88, 0x55, 0xff, 0x80, 0x68, 0x0f, 0xff, 0x80, 0x6c, 0x18, 0xff, 0x6b, 0x44, 0x14, 0xff, 0x6c, 0x45, 0x14, 0xff, 0x6c, 0x46, 0x14, 0xff, 0x67, 0x43, 0x13, 0xff, 0x9c, 0x61, 0x1e, 0xff, 0x9b, 0x60, 0x1e, 0xff, 0x9b, 0x60, 0x1e, 0xff, 0x99, 0x5e, 0x1d, 0xff, 0x98, 0x5d, 0x1d, 0xff, 0x91, 0x52, 0x0d, 0xff, 0xd4, 0xbc, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xb1, 0x4b, 0xff, 0xa8, 0x9d, 0x1e, 0xff, 0xaa, 0x9f, 0x24, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa3, 0x97, 0x20, 0xff, 0xa0, 0x95, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa0, 0x93, 0x1e, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa2, 0x97, 0x20, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa5, 0x9a, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa4, 0x99, 0x19, 0xff, 0xca, 0xc3, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xea, 0xdf, 0xff, 0xc8, 0xc0, 0x6a, 0xff, 0xc7, 0xae, 0x27, 0xff, 0xc7, 0xb0, 0x2c, 0xff, 0xc7, 0xac, 0x1f, 0xff, 0xce, 0xd3, 0xa2, 0xff, 0xd9, 0xf2, 0xff, 0xff, 0xa5, 0xdf, 0xfb, 0xff, 0x88, 0xd8, 0xff, 0xff, 0x8c, 0xdd, 0xff, 0xff, 0x89, 0xc3, 0xd3, 0xff, 0x7a, 0x5a, 0x00, 0xff, 0x7d, 0x69, 0x18, 0xff, 0x79, 0x61, 0x17, 0xff, 0x66, 0x3f, 0x13, 0xff, 0x68, 0x43, 0x14, 0xff, 0x63, 0x40, 0x13, 0xff, 0x98, 0x5e, 0x1d, 0xff, 0x98, 0x5d, 0x1d, 0xff, 0x98, 0x5c, 0x1d, 0xff, 0x97, 0x5b, 0x1b, 0xff, 0x97, 0x5b, 0x1c, 0xff, 0x8e, 0x4e, 0x0c, 0xff, 0xd3, 0xb9, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xaf, 0x4a, 0xff, 0xa6, 0x9b, 0x1d, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa2, 0x97, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa1, 0x95, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa0, 0x93, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa1, 0x94, 0x1e, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa2, 0x97, 0x20, 0xff, 0xa4, 0x98, 0x20, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa2, 0x97, 0x17, 0xff, 0xc9, 0xc2, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xf4, 0xff, 0xff, 0xda, 0xef, 0xff, 0xff, 0xd5, 0xee, 0xff, 0xff, 0xcf, 0xde, 0xcd, 0xff, 0xd2, 0xe4, 0xe4, 0xff, 0xdc, 0xf0, 0xff, 0xff, 0xe8, 0xee, 0xfa, 0xff, 0xb1, 0xe1, 0xff, 0xff, 0x8b, 0xd9, 0xff, 0xff, 0x89, 0xd8, 0xff, 0xff, 0x8a, 0xe5, 0xff, 0xff, 0x79, 0x68, 0x1e, 0xff, 0x78, 0x5f, 0x0d, 0xff, 0x7b, 0x68, 0x17, 0xff, 0x6b, 0x4c, 0x14, 0xff, 0x64, 0x3f, 0x12, 0xff, 0x5f, 0x3e, 0x11, 0xff, 0x96, 0x5a, 0x1b, 0xff, 0x96, 0x59, 0x1b, 0xff, 0x94, 0x58, 0x1b, 0xff, 0x94, 0x58, 0x1c, 0xff, 0x93, 0x57, 0x1a, 0xff, 0x8c, 0x4b, 0x0a, 0xff, 0xd1, 0xb9, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xae, 0x4a, 0xff, 0xa4, 0x98, 0x1c, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa2, 0x97, 0x20, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa7, 0x97, 0x23, 0xff, 0xa0, 0x95, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa0, 0x93, 0x1e, 0xff, 0x9e, 0x92, 0x1e, 0xff, 0x9f, 0x8f, 0x1d, 0xff, 0xa0, 0x93, 0x1e, 0xff, 0xa1, 0x95, 0x1e, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa2, 0x97, 0x20, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa0, 0x94, 0x16, 0xff, 0xc7, 0xc0, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xe1, 0xd5, 0xff, 0x77, 0xda, 0xd7, 0xff, 0xcb, 0xe9, 0xf5, 0xff, 0xec, 0xf0, 0xff, 0xff, 0xdd, 0xed, 0xfe, 0xff, 0x86, 0xde, 0xdc, 0xff, 0x43, 0xd5, 0xc6, 0xff, 0x25, 0xbe, 0xb5, 0xff, 0x4d, 0xc1, 0xd0, 0xff, 0x94, 0xdc, 0xff, 0xff, 0x86, 0xd9, 0xff, 0xff, 0x86, 0xdd, 0xff, 0xff, 0x76, 0x62, 0x19, 0xff, 0x75, 0x5c, 0x0d, 0xff, 0x77, 0x62, 0x16, 0xff, 0x5f, 0x3c, 0x12, 0xff, 0x5b, 0x3c, 0x11, 0xff, 0x93, 0x57, 0x1a, 0xff, 0x94, 0x57, 0x1b, 0xff, 0x92, 0x55, 0x1a, 0xff, 0x91, 0x55, 0x1a, 0xff, 0x92, 0x55, 0x1a, 0xff, 0x89, 0x48, 0x0a, 0xff, 0xd1, 0xb7, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xab, 0x48, 0xff, 0xa2, 0x96, 0x1a, 0xff, 0xa4, 0x98, 0x21, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa2, 0x96, 0x20, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa0, 0x95, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0xa0, 0x96, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x9d, 0x8f, 0x1c, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0x9e, 0x92, 0x15, 0xff, 0xc6, 0xbf, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xda, 0xc9, 0xff, 0x00, 0xc0, 0xa1, 0xff, 0x00, 0xc2, 0xa3, 0xff, 0x00, 0xc3, 0xa4, 0xff, 0x00, 0xc3, 0xa4, 0xff, 0x00, 0xc4, 0xa7, 0xff, 0x00, 0xc8, 0xab, 0xff, 0x00, 0xae, 0x94, 0xff, 0x00, 0x9d, 0x81, 0xff, 0x13, 0xab, 0x9f, 0xff, 0x91, 0xdb, 0xff, 0xff, 0x83, 0xd8, 0xff, 0xff, 0x84, 0xe3, 0xff, 0xff, 0x72, 0x5b, 0x11, 0xff, 0x72, 0x5d, 0x11, 0xff, 0x6b, 0x52, 0x14, 0xff, 0x55, 0x35, 0x10, 0xff, 0x91, 0x54, 0x1a, 0xff, 0x91, 0x54, 0x1a, 0xff, 0x8f, 0x53, 0x19, 0xff, 0x8e, 0x52, 0x1a, 0xff, 0x8e, 0x51, 0x19, 0xff, 0x86, 0x45, 0x09, 0xff, 0xd0, 0xb7, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xaa, 0x47, 0xff, 0xa0, 0x94, 0x19, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0x9e, 0x91, 0x1d, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0xa0, 0x95, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x18, 0xff, 0x98, 0x8f, 0x1c, 0xff, 0x9c, 0x90, 0x1b, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0x9c, 0x8f, 0x13, 0xff, 0xc5, 0xbd, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xd9, 0xc8, 0xff, 0x00, 0xbf, 0xa2, 0xff, 0x00, 0xc2, 0xa5, 0xff, 0x00, 0xc1, 0xa3, 0xff, 0x00, 0xc0, 0xa2, 0xff, 0x00, 0xbf, 0xa1, 0xff, 0x00, 0xc4, 0xa7, 0xff, 0x06, 0xb1, 0x99, 0xff, 0x00, 0x9a, 0x82, 0xff, 0x00, 0x98, 0x7a, 0xff, 0x54, 0xc5, 0xdd, 0xff, 0x84, 0xd7, 0xff, 0xff, 0x80, 0xdb, 0xff, 0xff, 0x7b, 0xb7, 0xc8, 0xff, 0x6d, 0x4e, 0x00, 0xff, 0x70, 0x5d, 0x14, 0xff, 0x5d, 0x46, 0x12, 0xff, 0x8c, 0x4e, 0x18, 0xff, 0x8d, 0x50, 0x19, 0xff, 0x8d, 0x50, 0x19, 0xff, 0x8d, 0x50, 0x19, 0xff, 0x8b, 0x4d, 0x17, 0xff, 0x7d, 0x39, 0x00, 0xff, 0xcb, 0xaf, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xa8, 0x46, 0xff, 0x9e, 0x91, 0x18, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9e, 0x91, 0x1d, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9a, 0x8c, 0x1a, 0xff, 0x9a, 0x8c, 0x1a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x88, 0x18, 0xff, 0x98, 0x8a, 0x18, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8e, 0x1a, 0xff, 0x9c, 0x8f, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9a, 0x8d, 0x12, 0xff, 0xc3, 0xbc, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0xda, 0xc9, 0xff, 0x25, 0xcc, 0xb4, 0xff, 0x63, 0xda, 0xca, 0xff, 0x94, 0xe6, 0xda, 0xff, 0xc4, 0xf1, 0xeb, 0xff, 0xf7, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf3, 0xff, 0xcc, 0xc9, 0xc6, 0xff, 0x7b, 0xb8, 0xab, 0xff, 0x53, 0xb8, 0xb8, 0xff, 0x7a, 0xd7, 0xff, 0xff, 0x74, 0xd5, 0xff, 0xff, 0x7a, 0xe5, 0xff, 0xff, 0x67, 0x48, 0x00, 0xff, 0x6a, 0x55, 0x13, 0xff, 0x67, 0x56, 0x13, 0xff, 0x8e, 0x53, 0x1a, 0xff, 0x8b, 0x4e, 0x16, 0xff, 0x84, 0x42, 0x0c, 0xff, 0x7d, 0x3a, 0x00, 0xff, 0x82, 0x41, 0x09, 0xff, 0xb3, 0x8d, 0x6c, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xa7, 0x47, 0xff, 0x9c, 0x8f, 0x16, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9c, 0x90, 0x1c, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8c, 0x1a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x88, 0x18, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8f, 0x1b, 0xff, 0x9c, 0x8f, 0x1c, 0xff, 0x98, 0x8b, 0x11, 0xff, 0xc3, 0xbb, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf1, 0xdf, 0xff, 0xd4, 0xce, 0xad, 0xff, 0xda, 0xcf, 0xd4, 0xff, 0xe5, 0xd4, 0xde, 0xff, 0xe6, 0xd1, 0xd4, 0xff, 0xdf, 0xcd, 0xc8, 0xff, 0xc0, 0xce, 0xd6, 0xff, 0xa0, 0xd5, 0xf2, 0xff, 0x6b, 0x4f, 0x0a, 0xff, 0x59, 0x42, 0x00, 0xff, 0x54, 0x3e, 0x01, 0xff, 0xc1, 0xb0, 0x24, 0xff, 0xb5, 0x98, 0x23, 0xff, 0xad, 0x82, 0x66, 0xff, 0xe4, 0xd6, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x9d, 0x35, 0xff, 0x9b, 0x8e, 0x17, 0xff, 0x9c, 0x8f, 0x1c, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9a, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x18, 0xff, 0x99, 0x8b, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x96, 0x88, 0x10, 0xff, 0xc5, 0xbe, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe4, 0xc9, 0xff, 0xd4, 0xce, 0x9c, 0xff, 0xc1, 0xba, 0x70, 0xff, 0xaf, 0xa5, 0x45, 0xff, 0x9c, 0x90, 0x19, 0xff, 0x96, 0x8a, 0x18, 0xff, 0x97, 0x89, 0x19, 0xff, 0x99, 0x8d, 0x17, 0xff, 0x99, 0x8d, 0x0b, 0xff, 0xa8, 0x9d, 0x3b, 0xff, 0xbc, 0xb1, 0x7a, 0xff, 0xcf, 0xc5, 0xb7, 0xff, 0xde, 0xd2, 0xdd, 0xff, 0xde, 0xcf, 0xd2, 0xff, 0xe3, 0xdc, 0xe5, 0xff, 0xd0, 0xc6, 0xc2, 0xff, 0xa0, 0x92, 0x77, 0xff, 0xf2, 0xee, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf9, 0xf3, 0xff, 0xce, 0xc8, 0x8f, 0xff, 0xa8, 0x9d, 0x36, 0xff, 0x96, 0x8a, 0x18, 0xff, 0x97, 0x8b, 0x18, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8c, 0x18, 0xff, 0x9a, 0x8c, 0x1a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x18, 0xff, 0x93, 0x86, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x95, 0x87, 0x0f, 0xff, 0x90, 0x88, 0x0c, 0xff, 0x92, 0x84, 0x07, 0xff, 0x94, 0x87, 0x0b, 0xff, 0x97, 0x89, 0x10, 0xff, 0x99, 0x8c, 0x14, 0xff, 0x9b, 0x8e, 0x19, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9c, 0x90, 0x1b, 0xff, 0x9c, 0x8f, 0x17, 0xff, 0x9a, 0x8d, 0x11, 0xff, 0x97, 0x8a, 0x09, 0xff, 0x9d, 0x90, 0x19, 0xff, 0xb1, 0xa5, 0x59, 0xff, 0xc4, 0xba, 0x97, 0xff, 0xd8, 0xcf, 0xd5, 0xff, 0xe2, 0xda, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf3, 0xe6, 0xff, 0xcb, 0xc4, 0x88, 0xff, 0x9e, 0x8f, 0x26, 0xff, 0x96, 0x8a, 0x18, 0xff, 0x95, 0x88, 0x18, 0xff, 0x98, 0x8b, 0x15, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x8b, 0x1a, 0xff, 0x99, 0x8c, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9a, 0x8c, 0x1a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x80, 0x14, 0xff, 0x94, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x88, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x96, 0x89, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9b, 0x8d, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8f, 0x1b, 0xff, 0x9b, 0x8e, 0x19, 0xff, 0x99, 0x8c, 0x13, 0xff, 0x97, 0x8a, 0x0c, 0xff, 0x94, 0x87, 0x06, 0xff, 0xa8, 0x9d, 0x42, 0xff, 0x97, 0x8f, 0x23, 0xff, 0x95, 0x8a, 0x18, 0xff, 0x94, 0x86, 0x0d, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x96, 0x8a, 0x19, 0xff, 0x97, 0x8c, 0x1a, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x88, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x92, 0x84, 0x16, 0xff, 0x92, 0x85, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x83, 0x15, 0xff, 0x8f, 0x80, 0x14, 0xff, 0x8f, 0x83, 0x16, 0xff, 0x94, 0x86, 0x16, 0xff, 0x94, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x88, 0x17, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8b, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x19, 0xff, 0x97, 0x89, 0x14, 0xff, 0x97, 0x89, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x8b, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x89, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x95, 0x88, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x7c, 0x14, 0xff, 0x8f, 0x7f, 0x14, 0xff, 0x92, 0x83, 0x15, 0xff, 0x92, 0x84, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x8a, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x8a, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x95, 0x88, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x94, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x91, 0x83, 0x15, 0xff, 0x92, 0x83, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x7b, 0x11, 0xff, 0x8f, 0x80, 0x14, 0xff, 0x8f, 0x82, 0x14, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x84, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x94, 0x86, 0x16, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x92, 0x84, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x90, 0x82, 0x14, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x84, 0x16, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x7c, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x91, 0x83, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x92, 0x83, 0x15, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x84, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x83, 0x15, 0xff, 0x92, 0x83, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x90, 0x82, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x8f, 0x81, 0x14, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x91, 0x83, 0x14, 0xff, 0x92, 0x84, 0x16, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x7c, 0x11, 0xff, 0x8b, 0x7b, 0x12, 0xff, 0x8d, 0x7e, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x90, 0x82, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x8f, 0x80, 0x14, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7e, 0x12, 0xff, 0x8d, 0x80, 0x12, 0xff, 0x8b, 0x7b, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x7a, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x14, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8e, 0x80, 0x13, 0xff, 0x8e, 0x80, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8d, 0x7e, 0x13, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8f, 0x7d, 0x12, 0xff, 0x8b, 0x7b, 0x12, 0xff, 0x8a, 0x7a, 0x11, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x7c, 0x11, 0xff, 0x8f, 0x7e, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7c, 0x11, 0xff, 0x8b, 0x7c, 0x11, 0xff, 0x8c, 0x7c, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7c, 0x12, 0xff, 0x8b, 0x7c, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8f, 0x80, 0x11, 0xff, 0x8f, 0x83, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x7b, 0x10, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8e, 0x7e, 0x11, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7b, 0x10, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x7c, 0x11, 0xff, 0x8a, 0x7b, 0x10, 0xff, 0x8d, 0x7c, 0x10, 0xff, 0x89, 0x79, 0x0f, 0xff, 0x88, 0x7b, 0x10, 0xff, 0x89, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x79, 0x10, 0xff, 0x89, 0x79, 0x10, 0xff, 0x89, 0x79, 0x10, 0xff, 0x89, 0x79, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x88, 0x78, 0x10, 0xff, 0x89, 0x79, 0x10, 0xff, 0x8a, 0x7b, 0x10, 0xff, 0x8a, 0x7b, 0x10, 0xff, 0x8b, 0x7b, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x7c, 0x10, 0xff, 0x8a, 0x7b, 0x10, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x10, 0xff, 0x8a, 0x7b, 0x10, 0xff, 0x8a, 0x7a, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x10, 0xff, 0x8b, 0x7b, 0x10, 0xff, 0x8a, 0x7b, 0x10, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t activity = {
-  .header.always_zero = 0,
-  .header.w = 50,
-  .header.h = 50,
-  .data_size = 2500 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = activity_map,
-};
-
@@ -1,250 +0,0 @@
-/**
- ****************************************************************************************
- *
- * @file compass_menu_icon.c
- *
- * @brief Compass menu icon source file
- *
- * Copyright (C) 2021-2022 Dialog Semiconductor.
- * This computer program includes Confidential, Proprietary Information
- * of Dialog Semiconductor. All Rights Reserved.
- *
- ****************************************************************************************
- */
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_COMPASS_MENU_ICON
-#define LV_ATTRIBUTE_IMG_COMPASS_MENU_ICON
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_COMPASS_MENU_ICON uint8_t compass_menu_icon_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x56, 0xff, 0x56, 0xff, 0x57, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x52, 0xff, 0x2e, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x52, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x32, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x32, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x09, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb7, 0xff, 0x72, 0xff, 0x09, 0xff, 0x09, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x57, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x36, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x32, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x36, 0xff, 0x25, 0xff, 0x29, 0xff, 0x05, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x13, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x05, 0xff, 0x29, 0xff, 0x29, 0xff, 0x32, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x25, 0xff, 0x29, 0xff, 0x05, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x33, 0xff, 0x77, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x05, 0xff, 0x29, 0xff, 0x25, 0xff, 0x37, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x29, 0xff, 0x29, 0xff, 0x05, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x77, 0xff, 0x33, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x05, 0xff, 0x29, 0xff, 0x29, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x2e, 0xff, 0x29, 0xff, 0x09, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x33, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x05, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x25, 0xff, 0x29, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x9b, 0xff, 0x77, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0xff, 0x29, 0xff, 0x25, 0xff, 0x37, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x32, 0xff, 0x29, 0xff, 0x05, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x05, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x5b, 0xff, 0x29, 0xff, 0x29, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x29, 0xff, 0x25, 0xff, 0x5b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x25, 0xff, 0x05, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x05, 0xff, 0x25, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x25, 0xff, 0x05, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x0e, 0xff, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x97, 0xff, 0xdb, 0xff, 0x53, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x05, 0xff, 0x25, 0xff, 0x32, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x25, 0xff, 0x05, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x97, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x64, 0xff, 0x04, 0xff, 0x05, 0xff, 0xa8, 0xff, 0xec, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x2f, 0xff, 0xdb, 0xff, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x25, 0xff, 0x2e, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x2e, 0xff, 0x25, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x53, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x05, 0xff, 0xec, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x77, 0xff, 0x0e, 0xff, 0x97, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x25, 0xff, 0x2e, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x2e, 0xff, 0x25, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x53, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x0a, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x04, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0xff, 0x2e, 0xff, 0x53, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x25, 0xff, 0x2e, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x2e, 0xff, 0x25, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0x2a, 0xff, 0x29, 0xff, 0x24, 0xff, 0x24, 0xff, 0x44, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0x77, 0xff, 0x0a, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x25, 0xff, 0x2e, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x25, 0xff, 0x05, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x97, 0xff, 0x0a, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x0a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x0a, 0xff, 0x09, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xbb, 0xff, 0x0a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x05, 0xff, 0x25, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x25, 0xff, 0x05, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x2a, 0xff, 0x0a, 0xff, 0x05, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x05, 0xff, 0x25, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0xff, 0x0a, 0xff, 0x05, 0xff, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x2e, 0xff, 0x25, 0xff, 0x04, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x05, 0xff, 0x09, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x04, 0xff, 0x25, 0xff, 0x29, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x04, 0xff, 0x05, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0x0a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0xff, 0x05, 0xff, 0x04, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x36, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x29, 0xff, 0x25, 0xff, 0x04, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xff, 0x04, 0xff, 0x25, 0xff, 0x29, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x04, 0xff, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x05, 0xff, 0x04, 0xff, 0x36, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x32, 0xff, 0x04, 0xff, 0x05, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x05, 0xff, 0x04, 0xff, 0x2e, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x37, 0xff, 0x2d, 0xff, 0x04, 0xff, 0x05, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0x73, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x05, 0xff, 0x04, 0xff, 0x29, 0xff, 0x37, 0xff, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x37, 0xff, 0x2d, 0xff, 0x04, 0xff, 0x05, 0xff, 0x00, 0xff, 0x25, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x29, 0xff, 0x00, 0xff, 0x05, 0xff, 0x04, 0xff, 0x29, 0xff, 0x37, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x37, 0xff, 0x2e, 0xff, 0x04, 0xff, 0x05, 0xff, 0x05, 0xff, 0x00, 0xff, 0x05, 0xff, 0x92, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x25, 0xff, 0x00, 0xff, 0x05, 0xff, 0x05, 0xff, 0x04, 0xff, 0x2e, 0xff, 0x37, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x37, 0xff, 0x32, 0xff, 0x29, 0xff, 0x00, 0xff, 0x04, 0xff, 0x05, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xff, 0x05, 0xff, 0x04, 0xff, 0x04, 0xff, 0x09, 0xff, 0x32, 0xff, 0x37, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x37, 0xff, 0x32, 0xff, 0x29, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x29, 0xff, 0x32, 0xff, 0x37, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x37, 0xff, 0x32, 0xff, 0x2e, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x32, 0xff, 0x37, 0xff, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0x3d, 0x4f, 0xff, 0x3c, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x5d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0x1c, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0xdb, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x4e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x3e, 0xff, 0x59, 0x3e, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x46, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3d, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x3a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdc, 0x46, 0xff, 0x1d, 0x4f, 0xff, 0xdb, 0x46, 0xff, 0x97, 0x3d, 0xff, 0xf5, 0x3c, 0xff, 0x93, 0x34, 0xff, 0x93, 0x34, 0xff, 0xf5, 0x3c, 0xff, 0x97, 0x3d, 0xff, 0xbb, 0x46, 0xff, 0x3d, 0x4f, 0xff, 0xdc, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x3a, 0x3e, 0xff, 0x59, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3e, 0xff, 0xd8, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0xdc, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x93, 0x34, 0xff, 0xac, 0x22, 0xff, 0xc9, 0x21, 0xff, 0x0a, 0x22, 0xff, 0x0a, 0x22, 0xff, 0x2a, 0x22, 0xff, 0x2a, 0x22, 0xff, 0x0a, 0x22, 0xff, 0x0a, 0x22, 0xff, 0xc9, 0x21, 0xff, 0x8c, 0x22, 0xff, 0x52, 0x34, 0xff, 0x9b, 0x46, 0xff, 0xdc, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xd8, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x9b, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xf1, 0x33, 0xff, 0xc9, 0x21, 0xff, 0x0a, 0x22, 0xff, 0x2a, 0x22, 0xff, 0x2a, 0x1a, 0xff, 0xea, 0x11, 0xff, 0xe9, 0x11, 0xff, 0xc9, 0x11, 0xff, 0xc9, 0x11, 0xff, 0xc9, 0x11, 0xff, 0xea, 0x11, 0xff, 0x0a, 0x1a, 0xff, 0x2a, 0x22, 0xff, 0x0a, 0x22, 0xff, 0xc9, 0x21, 0xff, 0xb0, 0x2b, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x9b, 0x46, 0xff, 0xb7, 0x3d, 0xff, 0x0a, 0x22, 0xff, 0xe9, 0x21, 0xff, 0x2a, 0x22, 0xff, 0xc9, 0x11, 0xff, 0xa8, 0x09, 0xff, 0xb0, 0x5b, 0xff, 0x76, 0x9d, 0xff, 0x9a, 0xce, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x97, 0xa5, 0xff, 0xf1, 0x63, 0xff, 0xc9, 0x11, 0xff, 0xc9, 0x11, 0xff, 0x2a, 0x22, 0xff, 0x0a, 0x22, 0xff, 0xc9, 0x21, 0xff, 0x76, 0x3d, 0xff, 0xbb, 0x46, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x3d, 0xff, 0xd9, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x9b, 0x3e, 0xff, 0xd4, 0x34, 0xff, 0x88, 0x19, 0xff, 0x2a, 0x22, 0xff, 0xe9, 0x11, 0xff, 0xc9, 0x11, 0xff, 0x76, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xd7, 0xff, 0xdb, 0x7d, 0xff, 0x9f, 0xe7, 0xff, 0xbd, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xad, 0xff, 0x0a, 0x1a, 0xff, 0xc9, 0x11, 0xff, 0x2a, 0x22, 0xff, 0x88, 0x19, 0xff, 0x52, 0x34, 0xff, 0xbb, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x3d, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x7a, 0x3e, 0xff, 0xb4, 0x34, 0xff, 0x88, 0x19, 0xff, 0x0a, 0x22, 0xff, 0x67, 0x09, 0xff, 0xf0, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xb6, 0xff, 0xb6, 0x03, 0xff, 0xbd, 0xb6, 0xff, 0x9b, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x74, 0xff, 0x67, 0x01, 0xff, 0x0a, 0x22, 0xff, 0x88, 0x19, 0xff, 0x32, 0x2c, 0xff, 0x7a, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x3d, 0xff, 0xb7, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0x39, 0x3e, 0xff, 0x56, 0x35, 0xff, 0x67, 0x19, 0xff, 0x0a, 0x22, 0xff, 0x47, 0x01, 0xff, 0x76, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xb6, 0xff, 0x17, 0x1c, 0xff, 0x5a, 0x65, 0xff, 0xdb, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xbe, 0xff, 0x47, 0x01, 0xff, 0x0a, 0x22, 0xff, 0x67, 0x19, 0xff, 0x15, 0x35, 0xff, 0x39, 0x3e, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x3d, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x35, 0xff, 0x5a, 0x3e, 0xff, 0xc8, 0x19, 0xff, 0xe9, 0x19, 0xff, 0x47, 0x01, 0xff, 0x76, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xae, 0xff, 0x5a, 0x6d, 0xff, 0xf7, 0x1b, 0xff, 0xdb, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xbe, 0xff, 0x26, 0x01, 0xff, 0xe9, 0x19, 0xff, 0x88, 0x19, 0xff, 0x19, 0x3e, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0xb8, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x3d, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0x39, 0x3e, 0xff, 0x6f, 0x2b, 0xff, 0xa8, 0x19, 0xff, 0x88, 0x11, 0xff, 0xd0, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xa6, 0xff, 0x3c, 0xa6, 0xff, 0xf7, 0x23, 0xff, 0xbb, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x7c, 0xff, 0x87, 0x09, 0xff, 0xa8, 0x19, 0xff, 0x0d, 0x23, 0xff, 0x3a, 0x3e, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xd8, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0x67, 0x19, 0xff, 0xc8, 0x19, 0xff, 0x87, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x9e, 0xff, 0xdb, 0x8d, 0xff, 0x39, 0x65, 0xff, 0x5a, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xfe, 0xff, 0xc0, 0xfa, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x19, 0xff, 0xc8, 0x19, 0xff, 0x47, 0x19, 0xff, 0x77, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x97, 0x35, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x77, 0x2d, 0xff, 0x97, 0x35, 0xff, 0x76, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xf8, 0x35, 0xff, 0xb0, 0x23, 0xff, 0x87, 0x19, 0xff, 0x67, 0x09, 0xff, 0x76, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xe6, 0xfb, 0xff, 0xe0, 0xfa, 0xff, 0x6f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xbe, 0xff, 0x46, 0x09, 0xff, 0x88, 0x19, 0xff, 0x4e, 0x23, 0xff, 0xf8, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x77, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0x19, 0x36, 0xff, 0xe9, 0x19, 0xff, 0xa8, 0x19, 0xff, 0x26, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xfd, 0xff, 0xe0, 0xfa, 0xff, 0x43, 0xfb, 0xff, 0x22, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x11, 0xff, 0xa8, 0x19, 0xff, 0x87, 0x19, 0xff, 0x19, 0x36, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x77, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x26, 0x19, 0xff, 0x67, 0x11, 0xff, 0x6e, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xff, 0x01, 0xfb, 0xff, 0x22, 0xfb, 0xff, 0x64, 0xfb, 0xff, 0xe1, 0xfa, 0xff, 0x97, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x6b, 0xff, 0x67, 0x11, 0xff, 0x46, 0x19, 0xff, 0x15, 0x2d, 0xff, 0x97, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x97, 0x2d, 0xff, 0x73, 0x2c, 0xff, 0x46, 0x19, 0xff, 0x46, 0x09, 0xff, 0x56, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x9d, 0xff, 0x34, 0x13, 0xff, 0xb3, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xc5, 0xfb, 0xff, 0x21, 0xfb, 0xff, 0x64, 0xfb, 0xff, 0x44, 0xfb, 0xff, 0x23, 0xfb, 0xff, 0xc7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x59, 0x7d, 0xff, 0x7c, 0xb6, 0xff, 0x16, 0x3c, 0xff, 0xbf, 0xef, 0xff, 0x95, 0x2b, 0xff, 0xff, 0xff, 0xff, 0x18, 0xbe, 0xff, 0x26, 0x09, 0xff, 0x67, 0x19, 0xff, 0x11, 0x2c, 0xff, 0x97, 0x35, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x56, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x97, 0x2d, 0xff, 0xb0, 0x23, 0xff, 0x46, 0x19, 0xff, 0x05, 0x01, 0xff, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x79, 0x85, 0xff, 0xba, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xcf, 0xff, 0x63, 0x61, 0xff, 0xa3, 0x08, 0xff, 0xa4, 0x00, 0xff, 0x44, 0xa2, 0xff, 0x64, 0xfb, 0xff, 0xa0, 0xfa, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x9d, 0xff, 0xda, 0x95, 0xff, 0x54, 0x1b, 0xff, 0x7c, 0xb6, 0xff, 0xf6, 0x3b, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0xff, 0x05, 0x01, 0xff, 0x67, 0x19, 0xff, 0x4e, 0x23, 0xff, 0x97, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x25, 0xff, 0x36, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x16, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x6f, 0x23, 0xff, 0x46, 0x19, 0xff, 0xe5, 0x00, 0xff, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x8d, 0xff, 0x57, 0x54, 0xff, 0x9c, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x22, 0xff, 0xa2, 0x10, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xa4, 0x00, 0xff, 0xe2, 0xfa, 0xff, 0xed, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xbe, 0xff, 0xf8, 0x6c, 0xff, 0xf3, 0x12, 0xff, 0x59, 0x7d, 0xff, 0xb8, 0x64, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe5, 0x00, 0xff, 0x66, 0x19, 0xff, 0x0d, 0x23, 0xff, 0x97, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x16, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x2c, 0xff, 0x15, 0x25, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x25, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x6f, 0x23, 0xff, 0x46, 0x11, 0xff, 0xe5, 0x00, 0xff, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x79, 0x8d, 0xff, 0xf6, 0x43, 0xff, 0x1b, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x9d, 0xff, 0x0e, 0x02, 0xff, 0xc2, 0x20, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xa3, 0x00, 0xff, 0x81, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xdf, 0xff, 0xb5, 0x33, 0xff, 0x34, 0x23, 0xff, 0xf6, 0x43, 0xff, 0x59, 0x85, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xc4, 0x00, 0xff, 0x46, 0x19, 0xff, 0x0d, 0x23, 0xff, 0x77, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x6f, 0x23, 0xff, 0x26, 0x11, 0xff, 0xe5, 0x00, 0xff, 0xdb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x59, 0x85, 0xff, 0xba, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x01, 0xff, 0x6f, 0x12, 0xff, 0xa9, 0x19, 0xff, 0xc2, 0x20, 0xff, 0xa2, 0x18, 0xff, 0xe2, 0x48, 0xff, 0x55, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x02, 0xff, 0xb7, 0x64, 0xff, 0x72, 0x02, 0xff, 0x3b, 0xae, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xff, 0xc4, 0x00, 0xff, 0x46, 0x11, 0xff, 0x0d, 0x23, 0xff, 0x77, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x11, 0x24, 0xff, 0x25, 0x11, 0xff, 0xe5, 0x00, 0xff, 0x76, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x59, 0x8d, 0xff, 0x31, 0x02, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0x64, 0xff, 0xed, 0x09, 0xff, 0x4e, 0x1a, 0xff, 0x6f, 0x12, 0xff, 0xed, 0x09, 0xff, 0xac, 0x01, 0xff, 0xda, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x02, 0xff, 0xda, 0x9d, 0xff, 0x11, 0x02, 0xff, 0xdd, 0xce, 0xff, 0xff, 0xff, 0xff, 0x18, 0xbe, 0xff, 0xe5, 0x00, 0xff, 0x25, 0x11, 0xff, 0xb0, 0x23, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xb4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x25, 0xff, 0xd4, 0x24, 0xff, 0xe5, 0x10, 0xff, 0x25, 0x09, 0xff, 0x6e, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xe7, 0xff, 0x6b, 0x01, 0xff, 0x2d, 0x12, 0xff, 0x0d, 0x12, 0xff, 0x6b, 0x01, 0xff, 0x34, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x7c, 0xff, 0x05, 0x09, 0xff, 0x05, 0x11, 0xff, 0x73, 0x24, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x94, 0x1c, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x77, 0x2d, 0xff, 0x46, 0x11, 0xff, 0x46, 0x11, 0xff, 0xe5, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x2a, 0xff, 0xec, 0x09, 0xff, 0x8b, 0x01, 0xff, 0xaf, 0x2a, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x11, 0xff, 0x26, 0x11, 0xff, 0x05, 0x11, 0xff, 0x77, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x93, 0x1c, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0x36, 0x25, 0xff, 0xcc, 0x1a, 0xff, 0x05, 0x11, 0xff, 0xc4, 0x00, 0xff, 0xb7, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xad, 0xff, 0x09, 0x01, 0xff, 0xab, 0x01, 0xff, 0xf9, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xc6, 0xff, 0xa4, 0x00, 0xff, 0x25, 0x11, 0xff, 0x8b, 0x1a, 0xff, 0x36, 0x25, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xc4, 0x10, 0xff, 0x25, 0x11, 0xff, 0x46, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x00, 0xff, 0x54, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x10, 0x02, 0xff, 0xf0, 0x01, 0xff, 0xdd, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x21, 0xff, 0x25, 0x11, 0xff, 0xc4, 0x10, 0xff, 0x73, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x16, 0x25, 0xff, 0x2a, 0x1a, 0xff, 0x05, 0x11, 0xff, 0xc4, 0x00, 0xff, 0x31, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0x95, 0xff, 0x5e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xc6, 0xff, 0x33, 0x33, 0xff, 0x7e, 0xef, 0xff, 0x7c, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x94, 0xff, 0xa3, 0x00, 0xff, 0x05, 0x11, 0xff, 0xc8, 0x11, 0xff, 0x36, 0x25, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xc4, 0x10, 0xff, 0x25, 0x11, 0xff, 0x42, 0x00, 0xff, 0x39, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x02, 0xff, 0x39, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0x42, 0x00, 0xff, 0x25, 0x11, 0xff, 0xa3, 0x10, 0xff, 0xb4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xb0, 0x1b, 0xff, 0xa3, 0x10, 0xff, 0x25, 0x11, 0xff, 0x42, 0x00, 0xff, 0x39, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x01, 0xff, 0xdd, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0x63, 0x00, 0xff, 0x05, 0x11, 0xff, 0xa3, 0x10, 0xff, 0x4e, 0x1b, 0xff, 0xf5, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0xf5, 0x24, 0xff, 0xac, 0x1a, 0xff, 0xa3, 0x10, 0xff, 0x05, 0x11, 0xff, 0x42, 0x00, 0xff, 0x51, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xb6, 0xff, 0x53, 0x43, 0xff, 0x76, 0x6c, 0xff, 0x38, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x94, 0xff, 0x42, 0x00, 0xff, 0x05, 0x11, 0xff, 0xc4, 0x10, 0xff, 0x6a, 0x12, 0xff, 0x15, 0x25, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0xf5, 0x24, 0xff, 0xac, 0x1a, 0xff, 0x83, 0x10, 0xff, 0x05, 0x11, 0xff, 0x83, 0x00, 0xff, 0x46, 0x19, 0xff, 0x39, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x43, 0xff, 0x13, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xce, 0xff, 0x87, 0x21, 0xff, 0x63, 0x00, 0xff, 0x05, 0x11, 0xff, 0xa3, 0x10, 0xff, 0x4a, 0x12, 0xff, 0xf5, 0x24, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0xf5, 0x1c, 0xff, 0x6f, 0x1b, 0xff, 0xa3, 0x10, 0xff, 0xe4, 0x10, 0xff, 0xe4, 0x08, 0xff, 0x62, 0x00, 0xff, 0xe4, 0x08, 0xff, 0xf0, 0x73, 0xff, 0xf8, 0xbd, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x18, 0xc6, 0xff, 0x31, 0x7c, 0xff, 0x25, 0x11, 0xff, 0x42, 0x00, 0xff, 0xe4, 0x08, 0xff, 0xe4, 0x10, 0xff, 0x83, 0x10, 0xff, 0x2e, 0x1b, 0xff, 0xf5, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0xb4, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0xc8, 0x11, 0xff, 0x83, 0x08, 0xff, 0xc4, 0x10, 0xff, 0xe4, 0x08, 0xff, 0xa3, 0x00, 0xff, 0x62, 0x00, 0xff, 0x42, 0x00, 0xff, 0x42, 0x00, 0xff, 0x42, 0x00, 0xff, 0x42, 0x00, 0xff, 0x62, 0x00, 0xff, 0xa3, 0x00, 0xff, 0xe4, 0x08, 0xff, 0xc4, 0x10, 0xff, 0x83, 0x10, 0xff, 0x87, 0x11, 0xff, 0x53, 0x1c, 0xff, 0xb4, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x52, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0xd5, 0x1c, 0xff, 0x11, 0x1c, 0xff, 0x29, 0x12, 0xff, 0xa3, 0x10, 0xff, 0xa3, 0x08, 0xff, 0xa3, 0x10, 0xff, 0xc4, 0x10, 0xff, 0xc4, 0x10, 0xff, 0xc4, 0x10, 0xff, 0xc4, 0x10, 0xff, 0xa3, 0x10, 0xff, 0xa3, 0x08, 0xff, 0xa3, 0x08, 0xff, 0x09, 0x12, 0xff, 0xd1, 0x1b, 0xff, 0xd5, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x32, 0x14, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0xd5, 0x1c, 0xff, 0xd0, 0x1b, 0xff, 0xed, 0x12, 0xff, 0x6a, 0x12, 0xff, 0x29, 0x12, 0xff, 0x09, 0x12, 0xff, 0x4a, 0x12, 0xff, 0xed, 0x12, 0xff, 0xb0, 0x1b, 0xff, 0xb4, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x32, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x52, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x52, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x32, 0x14, 0xff, 0x32, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x1c, 0xff, 0x32, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x32, 0x14, 0xff, 0xf2, 0x13, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0xf2, 0x13, 0xff, 0x12, 0x14, 0xff, 0x32, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x12, 0x14, 0xff, 0xf1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0x12, 0x14, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x3c, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x1c, 0xff, 0x4e, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3c, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x5d, 0xff, 0x4f, 0x1d, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x4f, 0x1c, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x4e, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x4e, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x5a, 0xff, 0x3e, 0x59, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x46, 0xfc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xf8, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x3a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdc, 0xff, 0x4f, 0x1d, 0xff, 0x46, 0xdb, 0xff, 0x3d, 0x97, 0xff, 0x3c, 0xf5, 0xff, 0x34, 0x93, 0xff, 0x34, 0x93, 0xff, 0x3c, 0xf5, 0xff, 0x3d, 0x97, 0xff, 0x46, 0xbb, 0xff, 0x4f, 0x3d, 0xff, 0x46, 0xdc, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x3a, 0xff, 0x3e, 0x59, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x19, 0xff, 0x3d, 0xd8, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0xdc, 0xff, 0x46, 0x9b, 0xff, 0x34, 0x93, 0xff, 0x22, 0xac, 0xff, 0x21, 0xc9, 0xff, 0x22, 0x0a, 0xff, 0x22, 0x0a, 0xff, 0x22, 0x2a, 0xff, 0x22, 0x2a, 0xff, 0x22, 0x0a, 0xff, 0x22, 0x0a, 0xff, 0x21, 0xc9, 0xff, 0x22, 0x8c, 0xff, 0x34, 0x52, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xdc, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x35, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xdb, 0xff, 0x33, 0xf1, 0xff, 0x21, 0xc9, 0xff, 0x22, 0x0a, 0xff, 0x22, 0x2a, 0xff, 0x1a, 0x2a, 0xff, 0x11, 0xea, 0xff, 0x11, 0xe9, 0xff, 0x11, 0xc9, 0xff, 0x11, 0xc9, 0xff, 0x11, 0xc9, 0xff, 0x11, 0xea, 0xff, 0x1a, 0x0a, 0xff, 0x22, 0x2a, 0xff, 0x22, 0x0a, 0xff, 0x21, 0xc9, 0xff, 0x2b, 0xb0, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x46, 0x9b, 0xff, 0x3d, 0xb7, 0xff, 0x22, 0x0a, 0xff, 0x21, 0xe9, 0xff, 0x22, 0x2a, 0xff, 0x11, 0xc9, 0xff, 0x09, 0xa8, 0xff, 0x5b, 0xb0, 0xff, 0x9d, 0x76, 0xff, 0xce, 0x9a, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0xbb, 0xff, 0xa5, 0x97, 0xff, 0x63, 0xf1, 0xff, 0x11, 0xc9, 0xff, 0x11, 0xc9, 0xff, 0x22, 0x2a, 0xff, 0x22, 0x0a, 0xff, 0x21, 0xc9, 0xff, 0x3d, 0x76, 0xff, 0x46, 0xbb, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xf9, 0xff, 0x3d, 0xd9, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x9b, 0xff, 0x34, 0xd4, 0xff, 0x19, 0x88, 0xff, 0x22, 0x2a, 0xff, 0x11, 0xe9, 0xff, 0x11, 0xc9, 0xff, 0x9d, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x5f, 0xff, 0x7d, 0xdb, 0xff, 0xe7, 0x9f, 0xff, 0xae, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xb7, 0xff, 0x1a, 0x0a, 0xff, 0x11, 0xc9, 0xff, 0x22, 0x2a, 0xff, 0x19, 0x88, 0xff, 0x34, 0x52, 0xff, 0x3e, 0xbb, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xf9, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x7a, 0xff, 0x34, 0xb4, 0xff, 0x19, 0x88, 0xff, 0x22, 0x0a, 0xff, 0x09, 0x67, 0xff, 0x63, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xbd, 0xff, 0x03, 0xb6, 0xff, 0xb6, 0xbd, 0xff, 0x75, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x32, 0xff, 0x01, 0x67, 0xff, 0x22, 0x0a, 0xff, 0x19, 0x88, 0xff, 0x2c, 0x32, 0xff, 0x3e, 0x7a, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xf9, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3e, 0x39, 0xff, 0x35, 0x56, 0xff, 0x19, 0x67, 0xff, 0x22, 0x0a, 0xff, 0x01, 0x47, 0xff, 0xa5, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xbd, 0xff, 0x1c, 0x17, 0xff, 0x65, 0x5a, 0xff, 0x85, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x19, 0xff, 0x01, 0x47, 0xff, 0x22, 0x0a, 0xff, 0x19, 0x67, 0xff, 0x35, 0x15, 0xff, 0x3e, 0x39, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xf9, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xf8, 0xff, 0x3e, 0x5a, 0xff, 0x19, 0xc8, 0xff, 0x19, 0xe9, 0xff, 0x01, 0x47, 0xff, 0xa5, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x7c, 0xff, 0x6d, 0x5a, 0xff, 0x1b, 0xf7, 0xff, 0x85, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x19, 0xff, 0x01, 0x26, 0xff, 0x19, 0xe9, 0xff, 0x19, 0x88, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x35, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xd8, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x3e, 0x39, 0xff, 0x2b, 0x6f, 0xff, 0x19, 0xa8, 0xff, 0x11, 0x88, 0xff, 0x63, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x5c, 0xff, 0xa6, 0x3c, 0xff, 0x23, 0xf7, 0xff, 0x85, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x72, 0xff, 0x09, 0x87, 0xff, 0x19, 0xa8, 0xff, 0x23, 0x0d, 0xff, 0x3e, 0x3a, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x19, 0x67, 0xff, 0x19, 0xc8, 0xff, 0x11, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x3b, 0xff, 0x8d, 0xdb, 0xff, 0x65, 0x39, 0xff, 0x75, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x76, 0xff, 0xfa, 0xc0, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xe9, 0xff, 0x19, 0xc8, 0xff, 0x19, 0x47, 0xff, 0x35, 0x77, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x56, 0xff, 0x35, 0x97, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x77, 0xff, 0x35, 0x97, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xf8, 0xff, 0x23, 0xb0, 0xff, 0x19, 0x87, 0xff, 0x09, 0x67, 0xff, 0xa5, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xfb, 0xe6, 0xff, 0xfa, 0xe0, 0xff, 0xfd, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x19, 0xff, 0x09, 0x46, 0xff, 0x19, 0x88, 0xff, 0x23, 0x4e, 0xff, 0x35, 0xf8, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x77, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x36, 0x19, 0xff, 0x19, 0xe9, 0xff, 0x19, 0xa8, 0xff, 0x01, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0d, 0xff, 0xfa, 0xe0, 0xff, 0xfb, 0x43, 0xff, 0xfb, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x67, 0xff, 0x19, 0xa8, 0xff, 0x19, 0x87, 0xff, 0x36, 0x19, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x77, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x19, 0x26, 0xff, 0x11, 0x67, 0xff, 0x5b, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x14, 0xff, 0xfb, 0x01, 0xff, 0xfb, 0x22, 0xff, 0xfb, 0x64, 0xff, 0xfa, 0xe1, 0xff, 0xfe, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b, 0xf0, 0xff, 0x11, 0x67, 0xff, 0x19, 0x46, 0xff, 0x2d, 0x15, 0xff, 0x35, 0x97, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x97, 0xff, 0x2c, 0x73, 0xff, 0x19, 0x46, 0xff, 0x09, 0x46, 0xff, 0xa5, 0x56, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xdb, 0xff, 0x13, 0x34, 0xff, 0x02, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xfb, 0xc5, 0xff, 0xfb, 0x21, 0xff, 0xfb, 0x64, 0xff, 0xfb, 0x44, 0xff, 0xfb, 0x23, 0xff, 0xfb, 0xc7, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x59, 0xff, 0xb6, 0x7c, 0xff, 0x3c, 0x16, 0xff, 0xef, 0xbf, 0xff, 0x2b, 0x95, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x18, 0xff, 0x09, 0x26, 0xff, 0x19, 0x67, 0xff, 0x2c, 0x11, 0xff, 0x35, 0x97, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x56, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x97, 0xff, 0x23, 0xb0, 0xff, 0x19, 0x46, 0xff, 0x01, 0x05, 0xff, 0xd6, 0xbb, 0xff, 0xff, 0xff, 0xff, 0x85, 0x79, 0xff, 0x95, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x1e, 0xff, 0x61, 0x63, 0xff, 0x08, 0xa3, 0xff, 0x00, 0xa4, 0xff, 0xa2, 0x44, 0xff, 0xfb, 0x64, 0xff, 0xfa, 0xa0, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xda, 0xff, 0x95, 0xda, 0xff, 0x1b, 0x54, 0xff, 0xb6, 0x7c, 0xff, 0x3b, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3d, 0xff, 0x01, 0x05, 0xff, 0x19, 0x67, 0xff, 0x23, 0x4e, 0xff, 0x2d, 0x97, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x15, 0xff, 0x25, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x16, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x77, 0xff, 0x23, 0x6f, 0xff, 0x19, 0x46, 0xff, 0x00, 0xe5, 0xff, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x9a, 0xff, 0x54, 0x57, 0xff, 0xbe, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xd1, 0xff, 0x10, 0xa2, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x00, 0xa4, 0xff, 0xfa, 0xe2, 0xff, 0xfc, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x9c, 0xff, 0x6c, 0xf8, 0xff, 0x12, 0xf3, 0xff, 0x7d, 0x59, 0xff, 0x64, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0xe5, 0xff, 0x19, 0x66, 0xff, 0x23, 0x0d, 0xff, 0x2d, 0x97, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x16, 0xff, 0x2d, 0x15, 0xff, 0x2c, 0xf5, 0xff, 0x25, 0x15, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x25, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x77, 0xff, 0x23, 0x6f, 0xff, 0x11, 0x46, 0xff, 0x00, 0xe5, 0xff, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x79, 0xff, 0x43, 0xf6, 0xff, 0xae, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xb9, 0xff, 0x02, 0x0e, 0xff, 0x20, 0xc2, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x00, 0xa3, 0xff, 0xf2, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x3e, 0xff, 0x33, 0xb5, 0xff, 0x23, 0x34, 0xff, 0x43, 0xf6, 0xff, 0x85, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0xc4, 0xff, 0x19, 0x46, 0xff, 0x23, 0x0d, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x56, 0xff, 0x23, 0x6f, 0xff, 0x11, 0x26, 0xff, 0x00, 0xe5, 0xff, 0xd6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x85, 0x59, 0xff, 0x9d, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xcd, 0xff, 0x12, 0x6f, 0xff, 0x19, 0xa9, 0xff, 0x20, 0xc2, 0xff, 0x18, 0xa2, 0xff, 0x48, 0xe2, 0xff, 0xfe, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x92, 0xff, 0x64, 0xb7, 0xff, 0x02, 0x72, 0xff, 0xae, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xff, 0x00, 0xc4, 0xff, 0x11, 0x46, 0xff, 0x23, 0x0d, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x24, 0x11, 0xff, 0x11, 0x25, 0xff, 0x00, 0xe5, 0xff, 0xa5, 0x76, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x59, 0xff, 0x02, 0x31, 0xff, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x14, 0xff, 0x09, 0xed, 0xff, 0x1a, 0x4e, 0xff, 0x12, 0x6f, 0xff, 0x09, 0xed, 0xff, 0x01, 0xac, 0xff, 0x9d, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x11, 0xff, 0x9d, 0xda, 0xff, 0x02, 0x11, 0xff, 0xce, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x18, 0xff, 0x00, 0xe5, 0xff, 0x11, 0x25, 0xff, 0x23, 0xb0, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xb4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x25, 0x15, 0xff, 0x24, 0xd4, 0xff, 0x10, 0xe5, 0xff, 0x09, 0x25, 0xff, 0x5b, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5e, 0xff, 0x01, 0x6b, 0xff, 0x12, 0x2d, 0xff, 0x12, 0x0d, 0xff, 0x01, 0x6b, 0xff, 0x64, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x31, 0xff, 0x09, 0x05, 0xff, 0x11, 0x05, 0xff, 0x24, 0x73, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1c, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x77, 0xff, 0x11, 0x46, 0xff, 0x11, 0x46, 0xff, 0x00, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xae, 0xff, 0x09, 0xec, 0xff, 0x01, 0x8b, 0xff, 0x2a, 0xaf, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x46, 0xff, 0x11, 0x26, 0xff, 0x11, 0x05, 0xff, 0x2d, 0x77, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1c, 0x93, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd5, 0xff, 0x25, 0x36, 0xff, 0x1a, 0xcc, 0xff, 0x11, 0x05, 0xff, 0x00, 0xc4, 0xff, 0xb5, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xd9, 0xff, 0x01, 0x09, 0xff, 0x01, 0xab, 0xff, 0xb5, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x59, 0xff, 0x00, 0xa4, 0xff, 0x11, 0x25, 0xff, 0x1a, 0x8b, 0xff, 0x25, 0x36, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xb4, 0xff, 0x10, 0xc4, 0xff, 0x11, 0x25, 0xff, 0x11, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xc8, 0xff, 0x74, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x02, 0x10, 0xff, 0x01, 0xf0, 0xff, 0xce, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xc8, 0xff, 0x11, 0x25, 0xff, 0x10, 0xc4, 0xff, 0x24, 0x73, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x25, 0x16, 0xff, 0x1a, 0x2a, 0xff, 0x11, 0x05, 0xff, 0x00, 0xc4, 0xff, 0x7c, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x37, 0xff, 0xef, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x9c, 0xff, 0x33, 0x33, 0xff, 0xef, 0x7e, 0xff, 0xbe, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xd4, 0xff, 0x00, 0xa3, 0xff, 0x11, 0x05, 0xff, 0x11, 0xc8, 0xff, 0x25, 0x36, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd5, 0xff, 0x10, 0xc4, 0xff, 0x11, 0x25, 0xff, 0x00, 0x42, 0xff, 0xc6, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x10, 0xff, 0x8d, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xff, 0x00, 0x42, 0xff, 0x11, 0x25, 0xff, 0x10, 0xa3, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x93, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0xd5, 0xff, 0x1b, 0xb0, 0xff, 0x10, 0xa3, 0xff, 0x11, 0x25, 0xff, 0x00, 0x42, 0xff, 0xc6, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xaf, 0xff, 0xce, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xff, 0x00, 0x63, 0xff, 0x11, 0x05, 0xff, 0x10, 0xa3, 0xff, 0x1b, 0x4e, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x24, 0x73, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x24, 0xf5, 0xff, 0x1a, 0xac, 0xff, 0x10, 0xa3, 0xff, 0x11, 0x05, 0xff, 0x00, 0x42, 0xff, 0x84, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x3b, 0xff, 0x43, 0x53, 0xff, 0x6c, 0x76, 0xff, 0x8d, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xf4, 0xff, 0x00, 0x42, 0xff, 0x11, 0x05, 0xff, 0x10, 0xc4, 0xff, 0x12, 0x6a, 0xff, 0x25, 0x15, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x24, 0xf5, 0xff, 0x1a, 0xac, 0xff, 0x10, 0x83, 0xff, 0x11, 0x05, 0xff, 0x00, 0x83, 0xff, 0x19, 0x46, 0xff, 0xc6, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0x74, 0xff, 0x33, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x9a, 0xff, 0x21, 0x87, 0xff, 0x00, 0x63, 0xff, 0x11, 0x05, 0xff, 0x10, 0xa3, 0xff, 0x12, 0x4a, 0xff, 0x24, 0xf5, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0xf5, 0xff, 0x1b, 0x6f, 0xff, 0x10, 0xa3, 0xff, 0x10, 0xe4, 0xff, 0x08, 0xe4, 0xff, 0x00, 0x62, 0xff, 0x08, 0xe4, 0xff, 0x73, 0xf0, 0xff, 0xbd, 0xf8, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x18, 0xff, 0x7c, 0x31, 0xff, 0x11, 0x25, 0xff, 0x00, 0x42, 0xff, 0x08, 0xe4, 0xff, 0x10, 0xe4, 0xff, 0x10, 0x83, 0xff, 0x1b, 0x2e, 0xff, 0x1c, 0xf5, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0xb4, 0xff, 0x1c, 0x73, 0xff, 0x11, 0xc8, 0xff, 0x08, 0x83, 0xff, 0x10, 0xc4, 0xff, 0x08, 0xe4, 0xff, 0x00, 0xa3, 0xff, 0x00, 0x62, 0xff, 0x00, 0x42, 0xff, 0x00, 0x42, 0xff, 0x00, 0x42, 0xff, 0x00, 0x42, 0xff, 0x00, 0x62, 0xff, 0x00, 0xa3, 0xff, 0x08, 0xe4, 0xff, 0x10, 0xc4, 0xff, 0x10, 0x83, 0xff, 0x11, 0x87, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0xb4, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x52, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0xd5, 0xff, 0x1c, 0x11, 0xff, 0x12, 0x29, 0xff, 0x10, 0xa3, 0xff, 0x08, 0xa3, 0xff, 0x10, 0xa3, 0xff, 0x10, 0xc4, 0xff, 0x10, 0xc4, 0xff, 0x10, 0xc4, 0xff, 0x10, 0xc4, 0xff, 0x10, 0xa3, 0xff, 0x08, 0xa3, 0xff, 0x08, 0xa3, 0xff, 0x12, 0x09, 0xff, 0x1b, 0xd1, 0xff, 0x1c, 0xd5, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x14, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0xd5, 0xff, 0x1b, 0xd0, 0xff, 0x12, 0xed, 0xff, 0x12, 0x6a, 0xff, 0x12, 0x29, 0xff, 0x12, 0x09, 0xff, 0x12, 0x4a, 0xff, 0x12, 0xed, 0xff, 0x1b, 0xb0, 0xff, 0x1c, 0xb4, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x14, 0x32, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x52, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x52, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x52, 0xff, 0x14, 0x32, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x14, 0x32, 0xff, 0x13, 0xf2, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x13, 0xf2, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x14, 0x12, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x14, 0x12, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe4, 0x48, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe6, 0xe4, 0x4b, 0xff, 0xe8, 0xe5, 0x4b, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe7, 0xe3, 0x4a, 0xff, 0xe5, 0xe3, 0x4b, 0xff, 0xe6, 0xe2, 0x4b, 0xff, 0xe7, 0xe4, 0x4c, 0xff, 0xe2, 0xe1, 0x49, 0xff, 0xe1, 0xdd, 0x48, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xe6, 0xe3, 0x4a, 0xff, 0xe4, 0xe4, 0x4a, 0xff, 0xe5, 0xe4, 0x49, 0xff, 0xe6, 0xe3, 0x4a, 0xff, 0xe6, 0xe3, 0x4b, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe7, 0xe4, 0x4c, 0xff, 0xe7, 0xe4, 0x4c, 0xff, 0xe7, 0xe3, 0x4b, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe6, 0xe3, 0x4b, 0xff, 0xe6, 0xe3, 0x4b, 0xff, 0xea, 0xe7, 0x4c, 0xff, 0xe8, 0xe2, 0x4a, 0xff, 0xe1, 0xdd, 0x48, 0xff, 0xe1, 0xdd, 0x49, 0xff, 0xdd, 0xd8, 0x45, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xe3, 0xdf, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe3, 0xdf, 0x48, 0xff, 0xe3, 0xdf, 0x48, 0xff, 0xe3, 0xe0, 0x49, 0xff, 0xe4, 0xe1, 0x49, 0xff, 0xe5, 0xe1, 0x4a, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe5, 0xe1, 0x4a, 0xff, 0xe4, 0xe1, 0x49, 0xff, 0xe3, 0xe0, 0x49, 0xff, 0xe3, 0xdf, 0x48, 0xff, 0xe2, 0xde, 0x48, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe3, 0xdf, 0x47, 0xff, 0xdc, 0xd8, 0x45, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdd, 0xd8, 0x45, 0xff, 0xde, 0xd9, 0x45, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe2, 0xde, 0x48, 0xff, 0xe2, 0xde, 0x48, 0xff, 0xe3, 0xdf, 0x48, 0xff, 0xe3, 0xdf, 0x49, 0xff, 0xe3, 0xe0, 0x49, 0xff, 0xe3, 0xe0, 0x49, 0xff, 0xe3, 0xdf, 0x49, 0xff, 0xe3, 0xdf, 0x48, 0xff, 0xe2, 0xdf, 0x48, 0xff, 0xe2, 0xde, 0x48, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe0, 0xdc, 0x47, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xde, 0xda, 0x45, 0xff, 0xdd, 0xd8, 0x45, 0xff, 0xda, 0xd8, 0x43, 0xff, 0xdc, 0xd6, 0x44, 0xff, 0xdc, 0xd7, 0x45, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xcf, 0x3f, 0xff, 0xd4, 0xcf, 0x40, 0xff, 0xdb, 0xd4, 0x44, 0xff, 0xd8, 0xd4, 0x42, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xdb, 0xd6, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xde, 0xda, 0x45, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe0, 0xdc, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe0, 0xdd, 0x47, 0xff, 0xe0, 0xdc, 0x47, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xde, 0xda, 0x45, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdb, 0xd7, 0x44, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xd7, 0xd4, 0x42, 0xff, 0xd7, 0xd4, 0x43, 0xff, 0xd4, 0xd0, 0x40, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xcf, 0x3f, 0xff, 0xd4, 0xcf, 0x41, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xdb, 0xd7, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xde, 0xda, 0x45, 0xff, 0xde, 0xda, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xde, 0xda, 0x46, 0xff, 0xde, 0xda, 0x45, 0xff, 0xde, 0xd9, 0x45, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdb, 0xd7, 0x44, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd4, 0xd0, 0x3f, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xcf, 0x3f, 0xff, 0xd5, 0xcf, 0x3f, 0xff, 0xd1, 0xcb, 0x3e, 0xff, 0xd2, 0xcd, 0x3e, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd8, 0xd4, 0x42, 0xff, 0xd9, 0xd5, 0x43, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xdc, 0xd7, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdd, 0xd8, 0x45, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xdd, 0xd8, 0x45, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd7, 0x44, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xd9, 0xd5, 0x43, 0xff, 0xd8, 0xd4, 0x42, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd1, 0xcd, 0x3e, 0xff, 0xd6, 0xd0, 0x3f, 0xff, 0xd3, 0xcf, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xc7, 0x3c, 0xff, 0xcc, 0xc7, 0x3b, 0xff, 0xd2, 0xcb, 0x3e, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd6, 0xd0, 0x40, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xdb, 0xd7, 0x43, 0xff, 0xdf, 0xda, 0x44, 0xff, 0xe1, 0xdd, 0x45, 0xff, 0xe2, 0xde, 0x45, 0xff, 0xe2, 0xde, 0x45, 0xff, 0xe1, 0xdd, 0x45, 0xff, 0xdf, 0xdb, 0x44, 0xff, 0xdc, 0xd7, 0x43, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd7, 0xd3, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd6, 0xd0, 0x40, 0xff, 0xd4, 0xcf, 0x40, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd2, 0xcd, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcc, 0xc6, 0x3b, 0xff, 0xca, 0xc5, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xbb, 0x36, 0xff, 0xca, 0xc3, 0x3a, 0xff, 0xcc, 0xc5, 0x3b, 0xff, 0xcd, 0xc6, 0x3b, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xd0, 0xcb, 0x3d, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd5, 0xcf, 0x40, 0xff, 0xd6, 0xd0, 0x40, 0xff, 0xd8, 0xd3, 0x41, 0xff, 0xde, 0xda, 0x43, 0xff, 0xe6, 0xe2, 0x45, 0xff, 0xdb, 0xd7, 0x43, 0xff, 0xba, 0xb2, 0x3b, 0xff, 0xa6, 0x9d, 0x36, 0xff, 0x9b, 0x91, 0x33, 0xff, 0x9b, 0x91, 0x33, 0xff, 0xa6, 0x9c, 0x36, 0xff, 0xb9, 0xb2, 0x3a, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xe6, 0xe3, 0x45, 0xff, 0xdf, 0xda, 0x43, 0xff, 0xd8, 0xd3, 0x41, 0xff, 0xd6, 0xd0, 0x40, 0xff, 0xd5, 0xcf, 0x40, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcd, 0xc6, 0x3b, 0xff, 0xcc, 0xc7, 0x3a, 0xff, 0xca, 0xc4, 0x3a, 0xff, 0xc6, 0xc1, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xbf, 0x38, 0xff, 0xc4, 0xba, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xca, 0xc4, 0x3a, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xcc, 0xc6, 0x3b, 0xff, 0xce, 0xc7, 0x3b, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xde, 0xd9, 0x41, 0xff, 0xd8, 0xd2, 0x40, 0xff, 0x99, 0x8f, 0x32, 0xff, 0x61, 0x53, 0x24, 0xff, 0x49, 0x39, 0x1f, 0xff, 0x4f, 0x40, 0x20, 0xff, 0x51, 0x42, 0x21, 0xff, 0x52, 0x43, 0x21, 0xff, 0x52, 0x43, 0x21, 0xff, 0x51, 0x42, 0x21, 0xff, 0x4f, 0x40, 0x20, 0xff, 0x4a, 0x3a, 0x1f, 0xff, 0x5e, 0x50, 0x23, 0xff, 0x94, 0x8a, 0x31, 0xff, 0xd5, 0xcf, 0x40, 0xff, 0xdf, 0xda, 0x42, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xce, 0xc7, 0x3b, 0xff, 0xcc, 0xc6, 0x3b, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xc6, 0xc1, 0x38, 0xff, 0xc6, 0xc2, 0x37, 0xff, 0xc1, 0xba, 0x34, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xc0, 0x38, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc9, 0xc3, 0x39, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcd, 0xc7, 0x3b, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xd5, 0xcf, 0x3e, 0xff, 0xdc, 0xd7, 0x40, 0xff, 0x88, 0x7d, 0x2d, 0xff, 0x47, 0x38, 0x1e, 0xff, 0x4f, 0x40, 0x1f, 0xff, 0x54, 0x46, 0x20, 0xff, 0x52, 0x43, 0x1a, 0xff, 0x4d, 0x3e, 0x13, 0xff, 0x4a, 0x3b, 0x0f, 0xff, 0x48, 0x38, 0x0d, 0xff, 0x48, 0x38, 0x0d, 0xff, 0x4a, 0x3a, 0x0f, 0xff, 0x4d, 0x3e, 0x13, 0xff, 0x51, 0x42, 0x19, 0xff, 0x54, 0x46, 0x20, 0xff, 0x4f, 0x41, 0x20, 0xff, 0x46, 0x37, 0x1e, 0xff, 0x80, 0x75, 0x2b, 0xff, 0xda, 0xd4, 0x3f, 0xff, 0xd6, 0xd0, 0x3e, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcd, 0xc7, 0x3b, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xc9, 0xc3, 0x39, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc4, 0xbd, 0x35, 0xff, 0xc1, 0xba, 0x34, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xc0, 0x38, 0xff, 0xc8, 0xbd, 0x38, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc9, 0xc2, 0x38, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xcc, 0xc6, 0x3b, 0xff, 0xd7, 0xd1, 0x3d, 0xff, 0xbc, 0xb5, 0x38, 0xff, 0x4d, 0x3f, 0x1f, 0xff, 0x4c, 0x3e, 0x1f, 0xff, 0x53, 0x45, 0x1e, 0xff, 0x49, 0x3a, 0x11, 0xff, 0x44, 0x34, 0x0a, 0xff, 0x80, 0x76, 0x59, 0xff, 0xb4, 0xad, 0x9c, 0xff, 0xd4, 0xd2, 0xca, 0xff, 0xeb, 0xed, 0xef, 0xff, 0xea, 0xea, 0xe7, 0xff, 0xd6, 0xd4, 0xcf, 0xff, 0xb6, 0xb0, 0x9f, 0xff, 0x86, 0x7c, 0x60, 0xff, 0x46, 0x37, 0x0d, 0xff, 0x48, 0x39, 0x10, 0xff, 0x52, 0x44, 0x1e, 0xff, 0x4d, 0x3f, 0x1f, 0xff, 0x48, 0x3a, 0x1e, 0xff, 0xb3, 0xac, 0x36, 0xff, 0xd9, 0xd3, 0x3e, 0xff, 0xcc, 0xc6, 0x3a, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xc9, 0xc2, 0x39, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc7, 0xbf, 0x37, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xbd, 0xb8, 0x33, 0xff, 0xc2, 0xba, 0x34, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xbc, 0x38, 0xff, 0xc5, 0xba, 0x35, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc5, 0xbd, 0x36, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc9, 0xc3, 0x39, 0xff, 0xd7, 0xd1, 0x3c, 0xff, 0xa0, 0x97, 0x30, 0xff, 0x3f, 0x31, 0x1b, 0xff, 0x50, 0x43, 0x1f, 0xff, 0x49, 0x3b, 0x13, 0xff, 0x48, 0x3a, 0x12, 0xff, 0xb3, 0xad, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe9, 0xd1, 0xff, 0xdb, 0xb8, 0x76, 0xff, 0xfa, 0xf2, 0xe3, 0xff, 0xeb, 0xd5, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xb5, 0xa7, 0xff, 0x4e, 0x40, 0x19, 0xff, 0x48, 0x39, 0x12, 0xff, 0x51, 0x43, 0x1f, 0xff, 0x3f, 0x31, 0x1c, 0xff, 0x94, 0x8a, 0x2e, 0xff, 0xd9, 0xd3, 0x3c, 0xff, 0xc9, 0xc3, 0x39, 0xff, 0xc8, 0xc2, 0x38, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc5, 0xbd, 0x36, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc2, 0xbb, 0x34, 0xff, 0xc1, 0xb7, 0x33, 0xff, 0xbd, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x34, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0x37, 0xff, 0xbe, 0xb6, 0x2f, 0xff, 0xbf, 0xb7, 0x33, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc4, 0xbd, 0x36, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc7, 0xbf, 0x37, 0xff, 0xd2, 0xcb, 0x3a, 0xff, 0x9d, 0x94, 0x2f, 0xff, 0x3d, 0x2f, 0x1b, 0xff, 0x4f, 0x42, 0x1e, 0xff, 0x3c, 0x2e, 0x06, 0xff, 0x84, 0x7c, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xd3, 0xae, 0xff, 0xb4, 0x75, 0x00, 0xff, 0xe7, 0xd3, 0xad, 0xff, 0xd5, 0xb2, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x85, 0x6e, 0xff, 0x3a, 0x2c, 0x03, 0xff, 0x4f, 0x42, 0x1e, 0xff, 0x3e, 0x31, 0x1b, 0xff, 0x90, 0x86, 0x2c, 0xff, 0xd4, 0xcd, 0x3a, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc6, 0xbe, 0x36, 0xff, 0xc4, 0xbd, 0x36, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xbe, 0xb5, 0x31, 0xff, 0xbd, 0xb5, 0x32, 0xff, 0xbf, 0xb6, 0x31, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbe, 0x37, 0xff, 0xbb, 0xb5, 0x2f, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xbe, 0xb5, 0x31, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xc1, 0xba, 0x34, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xca, 0xc3, 0x37, 0xff, 0xb0, 0xa8, 0x32, 0xff, 0x3a, 0x2d, 0x1a, 0xff, 0x4d, 0x40, 0x1d, 0xff, 0x36, 0x28, 0x00, 0xff, 0xb2, 0xad, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xd3, 0xaf, 0xff, 0xb9, 0x80, 0x1a, 0xff, 0xcf, 0xa8, 0x62, 0xff, 0xd7, 0xb7, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xc1, 0xb5, 0xff, 0x35, 0x27, 0x00, 0xff, 0x4d, 0x40, 0x1d, 0xff, 0x3a, 0x2d, 0x1a, 0xff, 0xa8, 0x9f, 0x30, 0xff, 0xcc, 0xc4, 0x37, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbf, 0xb6, 0x32, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xbc, 0xb2, 0x2f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xbe, 0x38, 0xff, 0xbc, 0xb3, 0x2f, 0xff, 0xbb, 0xb2, 0x2f, 0xff, 0xbc, 0xb3, 0x30, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbf, 0xb6, 0x32, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xc3, 0xbb, 0x34, 0xff, 0xce, 0xc7, 0x37, 0xff, 0x43, 0x37, 0x1b, 0xff, 0x48, 0x3d, 0x1c, 0xff, 0x37, 0x29, 0x03, 0xff, 0xb3, 0xae, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xcd, 0xa8, 0xff, 0xcf, 0xaa, 0x69, 0xff, 0xb5, 0x7b, 0x15, 0xff, 0xd8, 0xb9, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xc2, 0xb7, 0xff, 0x34, 0x26, 0x00, 0xff, 0x49, 0x3e, 0x1c, 0xff, 0x3d, 0x31, 0x1a, 0xff, 0xc8, 0xc1, 0x36, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc1, 0xb9, 0x34, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xbf, 0xb6, 0x32, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xb9, 0xb0, 0x2f, 0xff, 0xb6, 0xae, 0x2d, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xb9, 0x35, 0xff, 0xb7, 0xaf, 0x2d, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xba, 0xb2, 0x2f, 0xff, 0xbc, 0xb3, 0x30, 0xff, 0xbd, 0xb4, 0x31, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xcb, 0xc3, 0x35, 0xff, 0x77, 0x6d, 0x25, 0xff, 0x40, 0x34, 0x1a, 0xff, 0x3f, 0x32, 0x10, 0xff, 0x7f, 0x77, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc9, 0xa2, 0xff, 0xde, 0xc6, 0x9d, 0xff, 0xb6, 0x7e, 0x20, 0xff, 0xd5, 0xb6, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x8e, 0x7a, 0xff, 0x3c, 0x2f, 0x0c, 0xff, 0x42, 0x36, 0x1a, 0xff, 0x6a, 0x60, 0x22, 0xff, 0xcd, 0xc5, 0x36, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbd, 0xb4, 0x31, 0xff, 0xbc, 0xb3, 0x30, 0xff, 0xba, 0xb2, 0x2f, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xb9, 0xb0, 0x2f, 0xff, 0xbf, 0xb7, 0x31, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xbc, 0xb0, 0x2f, 0xff, 0xb8, 0xb0, 0x2e, 0xff, 0xb6, 0xad, 0x2c, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb8, 0xb0, 0x2e, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xbb, 0xb2, 0x30, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xbf, 0xb6, 0x31, 0xff, 0xc0, 0xb8, 0x32, 0xff, 0x36, 0x2b, 0x18, 0xff, 0x44, 0x39, 0x19, 0xff, 0x3b, 0x2f, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xc3, 0x99, 0xff, 0xd5, 0xb7, 0x86, 0xff, 0xca, 0xa3, 0x64, 0xff, 0xcd, 0xa9, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xce, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0xe9, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x3b, 0x1b, 0xff, 0x43, 0x38, 0x17, 0xff, 0x35, 0x2a, 0x17, 0xff, 0xb6, 0xae, 0x30, 0xff, 0xc0, 0xb8, 0x32, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xbb, 0xb2, 0x30, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb5, 0xab, 0x2b, 0xff, 0xb4, 0xaa, 0x2c, 0xff, 0xb7, 0xaf, 0x2f, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb5, 0xac, 0x2c, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb9, 0xb0, 0x2f, 0xff, 0xba, 0xb2, 0x2f, 0xff, 0xc3, 0xbb, 0x31, 0xff, 0x7e, 0x74, 0x24, 0xff, 0x3c, 0x31, 0x19, 0xff, 0x37, 0x2b, 0x0a, 0xff, 0xb0, 0xab, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf8, 0xf5, 0xff, 0xfa, 0xf7, 0xf3, 0xff, 0xfc, 0xfa, 0xf7, 0xff, 0xfc, 0xf7, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xf1, 0xff, 0xff, 0x34, 0x7e, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x7c, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xc1, 0xb8, 0xff, 0x34, 0x28, 0x06, 0xff, 0x3d, 0x32, 0x19, 0xff, 0x73, 0x68, 0x22, 0xff, 0xc4, 0xbc, 0x32, 0xff, 0xba, 0xb2, 0x2f, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb6, 0xac, 0x2c, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb1, 0xa8, 0x2b, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb5, 0xab, 0x2c, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb2, 0xa9, 0x2a, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb6, 0xad, 0x2d, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xc8, 0xbf, 0x31, 0xff, 0x47, 0x3c, 0x1a, 0xff, 0x3f, 0x34, 0x18, 0xff, 0x2f, 0x24, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x69, 0x9f, 0xff, 0xff, 0x03, 0x5e, 0xff, 0xff, 0x18, 0x6a, 0xff, 0xff, 0x12, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0x2e, 0x0e, 0xff, 0x3f, 0x35, 0x17, 0xff, 0x3a, 0x30, 0x18, 0xff, 0xc9, 0xc0, 0x31, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb6, 0xad, 0x2d, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb4, 0xac, 0x2b, 0xff, 0xb1, 0xa9, 0x2b, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb5, 0xac, 0x2c, 0xff, 0xb0, 0xa7, 0x28, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb3, 0xaa, 0x2b, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb8, 0xaf, 0x2d, 0xff, 0xb8, 0xae, 0x2d, 0xff, 0x30, 0x25, 0x16, 0xff, 0x39, 0x2e, 0x10, 0xff, 0x73, 0x6c, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xc2, 0xff, 0xff, 0x0c, 0x61, 0xff, 0xff, 0x13, 0x65, 0xff, 0xff, 0x1f, 0x6d, 0xff, 0xff, 0x08, 0x5d, 0xff, 0xff, 0xb9, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x7d, 0x6a, 0xff, 0x37, 0x2d, 0x0e, 0xff, 0x32, 0x28, 0x16, 0xff, 0xaa, 0xa1, 0x2b, 0xff, 0xba, 0xb0, 0x2d, 0xff, 0xb6, 0xac, 0x2c, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb3, 0xaa, 0x2b, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb1, 0xa8, 0x29, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb1, 0xa8, 0x2a, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb1, 0xa8, 0x2a, 0xff, 0xae, 0xa3, 0x27, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xb0, 0xa6, 0x29, 0xff, 0xb1, 0xa8, 0x29, 0xff, 0xb3, 0xa9, 0x2a, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb9, 0xb0, 0x2c, 0xff, 0x96, 0x8c, 0x27, 0xff, 0x33, 0x2a, 0x16, 0xff, 0x31, 0x27, 0x08, 0xff, 0xae, 0xaa, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xba, 0x96, 0xff, 0xa0, 0x63, 0x10, 0xff, 0x98, 0x55, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xec, 0xff, 0xff, 0x28, 0x77, 0xff, 0xff, 0x0a, 0x63, 0xff, 0xff, 0x1d, 0x6e, 0xff, 0xff, 0x1f, 0x6a, 0xff, 0xff, 0x18, 0x66, 0xff, 0xff, 0x36, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xa9, 0x79, 0xff, 0xe1, 0xcd, 0xb3, 0xff, 0xb3, 0x81, 0x3c, 0xff, 0xf7, 0xf3, 0xec, 0xff, 0xa8, 0x70, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xbf, 0xb5, 0xff, 0x30, 0x25, 0x06, 0xff, 0x35, 0x2b, 0x16, 0xff, 0x8a, 0x81, 0x25, 0xff, 0xbb, 0xb1, 0x2d, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb3, 0xa9, 0x2a, 0xff, 0xb2, 0xa8, 0x29, 0xff, 0xb0, 0xa6, 0x29, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb1, 0xa8, 0x2a, 0xff, 0xac, 0xa2, 0x26, 0xff, 0xad, 0xa3, 0x27, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xba, 0xb0, 0x2b, 0xff, 0x7d, 0x73, 0x22, 0xff, 0x34, 0x2a, 0x16, 0xff, 0x2b, 0x21, 0x03, 0xff, 0xd6, 0xd4, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xac, 0x82, 0xff, 0xd1, 0xb5, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xe2, 0xcc, 0xff, 0x17, 0x2c, 0x62, 0xff, 0x19, 0x13, 0x08, 0xff, 0x21, 0x16, 0x00, 0xff, 0x1f, 0x49, 0x9e, 0xff, 0x1e, 0x6c, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0xed, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xb9, 0x95, 0xff, 0xd3, 0xb7, 0x92, 0xff, 0xa3, 0x69, 0x1b, 0xff, 0xe0, 0xcc, 0xb3, 0xff, 0xaf, 0x7d, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xe4, 0xe1, 0xff, 0x2a, 0x1f, 0x01, 0xff, 0x35, 0x2c, 0x16, 0xff, 0x71, 0x68, 0x20, 0xff, 0xbb, 0xb1, 0x2c, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xa7, 0xa2, 0x26, 0xff, 0xa9, 0xa0, 0x24, 0xff, 0xae, 0xa5, 0x27, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0xa1, 0x25, 0xff, 0xaa, 0xa0, 0x25, 0xff, 0xab, 0xa1, 0x26, 0xff, 0xad, 0xa2, 0x26, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xb8, 0xae, 0x2a, 0xff, 0x76, 0x6d, 0x20, 0xff, 0x33, 0x29, 0x15, 0xff, 0x28, 0x1e, 0x00, 0xff, 0xe4, 0xe3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xaf, 0x88, 0xff, 0xb5, 0x87, 0x4d, 0xff, 0xe2, 0xd0, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x59, 0x1e, 0xff, 0x14, 0x14, 0x14, 0xff, 0x20, 0x1f, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x21, 0x14, 0x00, 0xff, 0x10, 0x5c, 0xfe, 0xff, 0x6c, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xcf, 0xb8, 0xff, 0xc3, 0x9d, 0x6c, 0xff, 0x9c, 0x5d, 0x0e, 0xff, 0xc9, 0xa7, 0x7c, 0xff, 0xbe, 0x95, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0xf8, 0xff, 0x26, 0x1c, 0x00, 0xff, 0x34, 0x2b, 0x16, 0xff, 0x6a, 0x61, 0x1e, 0xff, 0xb9, 0xb0, 0x2b, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xad, 0xa2, 0x26, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xaa, 0x9e, 0x25, 0xff, 0xa9, 0xa0, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0xa0, 0x25, 0xff, 0xa8, 0x9d, 0x24, 0xff, 0xaa, 0x9f, 0x24, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xad, 0xa3, 0x26, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xb6, 0xac, 0x29, 0xff, 0x75, 0x6b, 0x1f, 0xff, 0x31, 0x28, 0x14, 0xff, 0x26, 0x1c, 0x00, 0xff, 0xe4, 0xe2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xae, 0x8a, 0xff, 0xad, 0x7b, 0x3f, 0xff, 0xd9, 0xc1, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xb3, 0x9b, 0xff, 0x6f, 0x40, 0x01, 0xff, 0x11, 0x17, 0x21, 0xff, 0x1f, 0x1f, 0x20, 0xff, 0x1f, 0x1f, 0x20, 0xff, 0x1c, 0x13, 0x00, 0xff, 0x0a, 0x51, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xe5, 0xd9, 0xff, 0xa9, 0x74, 0x32, 0xff, 0xa0, 0x66, 0x1e, 0xff, 0xad, 0x7b, 0x3e, 0xff, 0xca, 0xaa, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf7, 0xff, 0x24, 0x1a, 0x00, 0xff, 0x32, 0x29, 0x15, 0xff, 0x68, 0x5f, 0x1d, 0xff, 0xb8, 0xad, 0x29, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xad, 0xa3, 0x27, 0xff, 0xac, 0xa2, 0x26, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xaa, 0x9e, 0x24, 0xff, 0xa6, 0x9c, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa9, 0x9d, 0x23, 0xff, 0xa8, 0x9b, 0x22, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xb4, 0xa9, 0x28, 0xff, 0x75, 0x6b, 0x1e, 0xff, 0x2f, 0x26, 0x14, 0xff, 0x25, 0x1b, 0x00, 0xff, 0xda, 0xd9, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xa7, 0x81, 0xff, 0xd1, 0xb5, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x39, 0x00, 0xff, 0x78, 0x4d, 0x13, 0xff, 0x49, 0x34, 0x1a, 0xff, 0x10, 0x17, 0x20, 0xff, 0x12, 0x15, 0x17, 0xff, 0x0d, 0x1b, 0x47, 0xff, 0xa5, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x4f, 0x00, 0xff, 0xbc, 0x94, 0x64, 0xff, 0x90, 0x4d, 0x00, 0xff, 0xda, 0xc4, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xec, 0xe9, 0xff, 0x23, 0x1a, 0x00, 0xff, 0x30, 0x27, 0x14, 0xff, 0x6a, 0x60, 0x1d, 0xff, 0xb5, 0xab, 0x28, 0xff, 0xac, 0xa2, 0x26, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa9, 0x9d, 0x24, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xa5, 0x9c, 0x23, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x9e, 0x24, 0xff, 0xa8, 0x9a, 0x22, 0xff, 0xa7, 0x9d, 0x22, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xb0, 0xa5, 0x26, 0xff, 0x89, 0x7f, 0x21, 0xff, 0x2b, 0x23, 0x13, 0xff, 0x27, 0x1e, 0x04, 0xff, 0xaf, 0xab, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xaa, 0x88, 0xff, 0x8a, 0x46, 0x00, 0xff, 0x84, 0x3b, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x82, 0x5f, 0xff, 0x68, 0x3e, 0x08, 0xff, 0x70, 0x48, 0x15, 0xff, 0x76, 0x4c, 0x14, 0xff, 0x65, 0x3d, 0x08, 0xff, 0x5e, 0x36, 0x01, 0xff, 0xcf, 0xb9, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x40, 0x00, 0xff, 0xd3, 0xb9, 0x9b, 0xff, 0x86, 0x3f, 0x00, 0xff, 0xe5, 0xd7, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xbf, 0xb7, 0xff, 0x26, 0x1c, 0x01, 0xff, 0x2c, 0x24, 0x13, 0xff, 0x7e, 0x75, 0x1f, 0xff, 0xb1, 0xa6, 0x26, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa6, 0x9d, 0x23, 0xff, 0xa5, 0x98, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9f, 0x94, 0x1e, 0xff, 0xa7, 0x99, 0x20, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa4, 0x9a, 0x21, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xab, 0xa0, 0x24, 0xff, 0xa3, 0x98, 0x23, 0xff, 0x25, 0x1d, 0x11, 0xff, 0x2b, 0x23, 0x0a, 0xff, 0x73, 0x6d, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xe9, 0xe3, 0xff, 0x57, 0x2c, 0x00, 0xff, 0x6c, 0x46, 0x14, 0xff, 0x68, 0x41, 0x0e, 0xff, 0x59, 0x2d, 0x00, 0xff, 0xa0, 0x86, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0x84, 0x75, 0xff, 0x29, 0x21, 0x08, 0xff, 0x27, 0x1f, 0x12, 0xff, 0x96, 0x8b, 0x22, 0xff, 0xac, 0xa2, 0x24, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa0, 0x95, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9d, 0x91, 0x1c, 0xff, 0xa2, 0x95, 0x1f, 0xff, 0xa1, 0x96, 0x20, 0xff, 0xa2, 0x96, 0x20, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa5, 0x9a, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xb7, 0xac, 0x25, 0xff, 0x2f, 0x28, 0x13, 0xff, 0x2f, 0x27, 0x11, 0xff, 0x25, 0x1b, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x53, 0x27, 0xff, 0x62, 0x3c, 0x0b, 0xff, 0x59, 0x30, 0x00, 0xff, 0x77, 0x55, 0x2a, 0xff, 0xf0, 0xed, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x2a, 0x13, 0xff, 0x2f, 0x26, 0x10, 0xff, 0x27, 0x1f, 0x12, 0xff, 0xb7, 0xac, 0x25, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa5, 0x9a, 0x22, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa2, 0x97, 0x20, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa0, 0x93, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9c, 0x8f, 0x1b, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa0, 0x95, 0x1e, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa2, 0x97, 0x20, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xae, 0xa3, 0x23, 0xff, 0x62, 0x59, 0x1a, 0xff, 0x2a, 0x22, 0x12, 0xff, 0x20, 0x17, 0x00, 0xff, 0xb7, 0xb4, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xb8, 0xa7, 0xff, 0x4b, 0x21, 0x00, 0xff, 0x5b, 0x35, 0x04, 0xff, 0xca, 0xbe, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xc8, 0xc2, 0xff, 0x1d, 0x14, 0x00, 0xff, 0x2b, 0x23, 0x12, 0xff, 0x58, 0x4f, 0x18, 0xff, 0xaf, 0xa4, 0x23, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa4, 0x98, 0x20, 0xff, 0xa2, 0x97, 0x20, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa1, 0x94, 0x1e, 0xff, 0xa1, 0x93, 0x1e, 0xff, 0xa0, 0x93, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x96, 0x1f, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0xa1, 0x95, 0x1e, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa2, 0x97, 0x20, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa6, 0x9a, 0x21, 0xff, 0xa2, 0x96, 0x21, 0xff, 0x1e, 0x17, 0x10, 0xff, 0x2c, 0x24, 0x0e, 0xff, 0x30, 0x28, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0x18, 0x00, 0xff, 0x9e, 0x89, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0x84, 0x40, 0x00, 0xff, 0x83, 0x3e, 0x00, 0xff, 0xe6, 0xd9, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x38, 0x24, 0xff, 0x2a, 0x23, 0x0d, 0xff, 0x20, 0x18, 0x10, 0xff, 0x97, 0x8c, 0x1f, 0xff, 0xa7, 0x9b, 0x21, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa2, 0x97, 0x20, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa1, 0x95, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0xa2, 0x93, 0x1e, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x8c, 0x1b, 0xff, 0x9b, 0x8e, 0x1a, 0xff, 0x9e, 0x91, 0x1d, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xaf, 0xa2, 0x21, 0xff, 0x4f, 0x46, 0x16, 0xff, 0x28, 0x20, 0x11, 0xff, 0x1f, 0x17, 0x00, 0xff, 0x89, 0x85, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xa6, 0x93, 0xff, 0xed, 0xea, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xd0, 0xc0, 0xff, 0x9c, 0x65, 0x32, 0xff, 0xf3, 0xec, 0xe5, 0xff, 0xde, 0xcc, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x9a, 0x90, 0xff, 0x1c, 0x13, 0x00, 0xff, 0x29, 0x22, 0x11, 0xff, 0x42, 0x3a, 0x14, 0xff, 0xb1, 0xa5, 0x22, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9e, 0x91, 0x1d, 0xff, 0x9e, 0x93, 0x1e, 0xff, 0x9d, 0x92, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9e, 0x91, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa6, 0x9a, 0x20, 0xff, 0x1f, 0x18, 0x0f, 0xff, 0x2b, 0x24, 0x11, 0xff, 0x11, 0x08, 0x00, 0xff, 0xc6, 0xc4, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x40, 0x04, 0xff, 0xc5, 0xa5, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xd8, 0xd5, 0xff, 0x10, 0x07, 0x00, 0xff, 0x2b, 0x24, 0x10, 0xff, 0x1c, 0x15, 0x0f, 0xff, 0x9e, 0x93, 0x1f, 0xff, 0xa3, 0x97, 0x1f, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9e, 0x91, 0x1d, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9d, 0x91, 0x1d, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x18, 0xff, 0x9a, 0x8c, 0x1a, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9c, 0x90, 0x1c, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0xa6, 0x9a, 0x1f, 0xff, 0x80, 0x75, 0x1a, 0xff, 0x1a, 0x14, 0x0e, 0xff, 0x2a, 0x23, 0x10, 0xff, 0x12, 0x0a, 0x00, 0xff, 0xc8, 0xc6, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x36, 0x00, 0xff, 0xe5, 0xd8, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xd8, 0xd5, 0xff, 0x16, 0x0e, 0x00, 0xff, 0x29, 0x22, 0x0f, 0xff, 0x1c, 0x15, 0x0f, 0xff, 0x72, 0x68, 0x18, 0xff, 0xa8, 0x9c, 0x1f, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9c, 0x90, 0x1a, 0xff, 0x9c, 0x8e, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x18, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0xab, 0x9e, 0x1e, 0xff, 0x5f, 0x56, 0x16, 0xff, 0x1b, 0x15, 0x0e, 0xff, 0x29, 0x22, 0x0f, 0xff, 0x0f, 0x07, 0x00, 0xff, 0x8c, 0x88, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xc3, 0xb1, 0xff, 0x9c, 0x68, 0x3e, 0xff, 0xb4, 0x8d, 0x6c, 0xff, 0xc3, 0xa3, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x9c, 0x94, 0xff, 0x0f, 0x07, 0x00, 0xff, 0x28, 0x21, 0x0e, 0xff, 0x1d, 0x17, 0x0e, 0xff, 0x53, 0x4b, 0x14, 0xff, 0xac, 0x9f, 0x1e, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9c, 0x8f, 0x1c, 0xff, 0x9b, 0x8f, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8b, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x88, 0x18, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8b, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8f, 0x1b, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0xab, 0x9e, 0x1e, 0xff, 0x5d, 0x54, 0x15, 0xff, 0x18, 0x12, 0x0d, 0xff, 0x27, 0x20, 0x0f, 0xff, 0x18, 0x10, 0x00, 0xff, 0x2f, 0x29, 0x17, 0xff, 0xc8, 0xc6, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x6d, 0x44, 0xff, 0x97, 0x60, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xcf, 0xcb, 0xff, 0x38, 0x32, 0x21, 0xff, 0x15, 0x0e, 0x00, 0xff, 0x27, 0x20, 0x0f, 0xff, 0x1a, 0x13, 0x0e, 0xff, 0x52, 0x4a, 0x14, 0xff, 0xab, 0x9e, 0x1e, 0xff, 0x9c, 0x90, 0x1b, 0xff, 0x9b, 0x8f, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x99, 0x88, 0x19, 0xff, 0x98, 0x88, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x18, 0xff, 0x95, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8e, 0x1b, 0xff, 0xa8, 0x9b, 0x1c, 0xff, 0x76, 0x6b, 0x17, 0xff, 0x18, 0x13, 0x0d, 0xff, 0x22, 0x1b, 0x0e, 0xff, 0x23, 0x1c, 0x0a, 0xff, 0x12, 0x0b, 0x00, 0xff, 0x22, 0x1c, 0x09, 0xff, 0x81, 0x7d, 0x72, 0xff, 0xbf, 0xbd, 0xb8, 0xff, 0xed, 0xed, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf0, 0xff, 0xc4, 0xc2, 0xbd, 0xff, 0x86, 0x83, 0x78, 0xff, 0x29, 0x23, 0x11, 0xff, 0x11, 0x0a, 0x00, 0xff, 0x22, 0x1b, 0x09, 0xff, 0x22, 0x1c, 0x0e, 0xff, 0x17, 0x11, 0x0d, 0xff, 0x6e, 0x64, 0x16, 0xff, 0xa9, 0x9c, 0x1c, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x98, 0x88, 0x18, 0xff, 0x98, 0x88, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x88, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0xa1, 0x93, 0x1b, 0xff, 0x9b, 0x8e, 0x1a, 0xff, 0x3f, 0x37, 0x11, 0xff, 0x15, 0x10, 0x0c, 0xff, 0x20, 0x1a, 0x0e, 0xff, 0x22, 0x1b, 0x0b, 0xff, 0x1a, 0x13, 0x02, 0xff, 0x14, 0x0d, 0x00, 0xff, 0x10, 0x09, 0x00, 0xff, 0x0e, 0x07, 0x00, 0xff, 0x0e, 0x07, 0x00, 0xff, 0x10, 0x08, 0x00, 0xff, 0x14, 0x0d, 0x00, 0xff, 0x1a, 0x13, 0x01, 0xff, 0x21, 0x1b, 0x0a, 0xff, 0x20, 0x1a, 0x0e, 0xff, 0x16, 0x11, 0x0d, 0xff, 0x38, 0x31, 0x10, 0xff, 0x97, 0x8a, 0x1a, 0xff, 0xa2, 0x94, 0x1b, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x95, 0x88, 0x18, 0xff, 0x95, 0x87, 0x17, 0xff, 0x98, 0x88, 0x18, 0xff, 0x98, 0x88, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x87, 0x17, 0xff, 0x94, 0x87, 0x17, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x94, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x88, 0x17, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x9a, 0x8c, 0x19, 0xff, 0xa5, 0x97, 0x1b, 0xff, 0x8b, 0x7f, 0x18, 0xff, 0x4c, 0x44, 0x12, 0xff, 0x1a, 0x15, 0x0d, 0xff, 0x18, 0x13, 0x0c, 0xff, 0x1c, 0x16, 0x0d, 0xff, 0x1d, 0x18, 0x0d, 0xff, 0x1e, 0x19, 0x0d, 0xff, 0x1e, 0x19, 0x0d, 0xff, 0x1e, 0x18, 0x0d, 0xff, 0x1c, 0x16, 0x0d, 0xff, 0x18, 0x13, 0x0c, 0xff, 0x18, 0x13, 0x0c, 0xff, 0x48, 0x40, 0x11, 0xff, 0x87, 0x7a, 0x17, 0xff, 0xa6, 0x98, 0x1b, 0xff, 0x9a, 0x8d, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x89, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x95, 0x88, 0x18, 0xff, 0x95, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x98, 0x88, 0x18, 0xff, 0x98, 0x88, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x87, 0x17, 0xff, 0x91, 0x85, 0x13, 0xff, 0x91, 0x83, 0x15, 0xff, 0x92, 0x84, 0x15, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x99, 0x8b, 0x18, 0xff, 0xa0, 0x92, 0x19, 0xff, 0xa5, 0x97, 0x1a, 0xff, 0x83, 0x77, 0x17, 0xff, 0x68, 0x5e, 0x14, 0xff, 0x54, 0x4b, 0x12, 0xff, 0x4c, 0x44, 0x11, 0xff, 0x4b, 0x42, 0x11, 0xff, 0x53, 0x4a, 0x12, 0xff, 0x66, 0x5c, 0x14, 0xff, 0x81, 0x75, 0x16, 0xff, 0xa4, 0x96, 0x1a, 0xff, 0xa0, 0x92, 0x19, 0xff, 0x9a, 0x8c, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x95, 0x88, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x92, 0x84, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x93, 0x84, 0x15, 0xff, 0x99, 0x8a, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x87, 0x17, 0xff, 0x92, 0x84, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x84, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x94, 0x86, 0x16, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x98, 0x8a, 0x17, 0xff, 0x9b, 0x8d, 0x18, 0xff, 0x9d, 0x8f, 0x18, 0xff, 0x9e, 0x90, 0x18, 0xff, 0x9e, 0x90, 0x18, 0xff, 0x9d, 0x8f, 0x18, 0xff, 0x9b, 0x8d, 0x18, 0xff, 0x98, 0x8a, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x94, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x92, 0x83, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x90, 0x82, 0x14, 0xff, 0x93, 0x83, 0x14, 0xff, 0x93, 0x85, 0x16, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x87, 0x17, 0xff, 0x93, 0x85, 0x14, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x92, 0x83, 0x15, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x84, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x83, 0x15, 0xff, 0x92, 0x83, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x90, 0x82, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x8f, 0x81, 0x14, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x94, 0x84, 0x15, 0xff, 0x93, 0x84, 0x16, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x87, 0x17, 0xff, 0x93, 0x85, 0x14, 0xff, 0x8d, 0x7e, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x14, 0xff, 0x8f, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x90, 0x82, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x8f, 0x81, 0x14, 0xff, 0x8f, 0x81, 0x14, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8e, 0x80, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8d, 0x7e, 0x13, 0xff, 0x8f, 0x82, 0x13, 0xff, 0x90, 0x84, 0x16, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x81, 0x14, 0xff, 0x8d, 0x80, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8e, 0x80, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8d, 0x7e, 0x13, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x87, 0x17, 0xff, 0x8c, 0x7e, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7c, 0x11, 0xff, 0x8b, 0x7c, 0x11, 0xff, 0x8c, 0x7c, 0x11, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8d, 0x7d, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7c, 0x11, 0xff, 0x8b, 0x7c, 0x11, 0xff, 0x8b, 0x7c, 0x11, 0xff, 0x8c, 0x7c, 0x11, 0xff, 0x8c, 0x7e, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x7c, 0x11, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8f, 0x7f, 0x11, 0xff, 0x8a, 0x7b, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8f, 0x7f, 0x11, 0xff, 0x8c, 0x7e, 0x12, 0xff, 0x8c, 0x7e, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x10, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x10, 0xff, 0x88, 0x79, 0x10, 0xff, 0x88, 0x79, 0x10, 0xff, 0x89, 0x79, 0x10, 0xff, 0x89, 0x79, 0x10, 0xff, 0x88, 0x79, 0x10, 0xff, 0x88, 0x79, 0x10, 0xff, 0x88, 0x78, 0x10, 0xff, 0x88, 0x78, 0x10, 0xff, 0x88, 0x78, 0x10, 0xff, 0x89, 0x79, 0x10, 0xff, 0x88, 0x78, 0x10, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x7c, 0x12, 0xff, 0x8c, 0x7c, 0x11, 0xff, 0x8c, 0x7c, 0x12, 0xff, 0x88, 0x78, 0x10, 0xff, 0x88, 0x79, 0x10, 0xff, 0x88, 0x78, 0x10, 0xff, 0x89, 0x78, 0x10, 0xff, 0x8b, 0x7b, 0x0f, 0xff, 0x8c, 0x7c, 0x10, 0xff, 0x8b, 0x7b, 0x12, 0xff, 0x8c, 0x7c, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t compass_menu_icon = {
-  .header.always_zero = 0,
-  .header.w = 50,
-  .header.h = 50,
-  .data_size = 2500 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = compass_menu_icon_map,
-};
-
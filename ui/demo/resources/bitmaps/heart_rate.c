@@ -1,250 +0,0 @@
-/**
- ****************************************************************************************
- *
- * @file heart_rate.c
- *
- * @brief Heart rate source file
- *
- * Copyright (C) 2021-2022 Dialog Semiconductor.
- * This computer program includes Confidential, Proprietary Information
- * of Dialog Semiconductor. All Rights Reserved.
- *
- ****************************************************************************************
- */
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_HEART_RATE
-#define LV_ATTRIBUTE_IMG_HEART_RATE
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_HEART_RATE uint8_t heart_rate_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xd6, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xd6, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xd2, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xd2, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xd6, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xcd, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xcd, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xe9, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xf1, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xe9, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xd1, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0xf6, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xf1, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe9, 0xff, 0xe8, 0xff, 0xd2, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf1, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xd2, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0xb6, 0xff, 0xd2, 0xff, 0xd2, 0xff, 0xd2, 0xff, 0xd2, 0xff, 0xe4, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xe9, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xcd, 0xff, 0xd2, 0xff, 0xd2, 0xff, 0xd2, 0xff, 0xb7, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xcd, 0xff, 0xe4, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xe4, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0xb7, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0xbb, 0xff, 0xe4, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0xd2, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0xb7, 0xff, 0xe4, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0xcd, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0xb6, 0xff, 0xe4, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0xcd, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0xb7, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xcd, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xb2, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xb7, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0xcd, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xc9, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x97, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xb2, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xe7, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0xbf, 0xe7, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xe7, 0xff, 0x9e, 0xe7, 0xff, 0x9e, 0xe7, 0xff, 0x9e, 0xe7, 0xff, 0x9e, 0xe7, 0xff, 0x9e, 0xe7, 0xff, 0x9e, 0xe7, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9f, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xcf, 0xff, 0x5e, 0xd7, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xd7, 0xff, 0x5e, 0xcf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xcf, 0xff, 0x9e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xdf, 0xff, 0x9e, 0xd7, 0xff, 0x5e, 0xcf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xc7, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x5e, 0xd7, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xc7, 0xff, 0x5d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x5e, 0xd7, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x5e, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x5d, 0xc7, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xd7, 0xff, 0x5e, 0xd7, 0xff, 0x5e, 0xd7, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x5e, 0xc7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x5d, 0xc7, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xc7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xb6, 0xff, 0x3d, 0xb7, 0xff, 0x1c, 0xb7, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xcf, 0xff, 0x5d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1c, 0xb7, 0xff, 0x1d, 0xb7, 0xff, 0xdc, 0xb6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xb6, 0xff, 0xdc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0x1c, 0xb7, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xb7, 0xff, 0x1c, 0xb7, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xa6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0x1c, 0xb7, 0xff, 0x1d, 0xb7, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xb7, 0xff, 0x1c, 0xb7, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfd, 0xbe, 0xff, 0xfc, 0xb6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0x1c, 0xb7, 0xff, 0x1c, 0xb7, 0xff, 0x1d, 0xb7, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xc7, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xb7, 0xff, 0x1c, 0xb7, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0x1c, 0xb7, 0xff, 0x1c, 0xb7, 0xff, 0x1d, 0xb7, 0xff, 0x1d, 0xbf, 0xff, 0x5e, 0xb7, 0xff, 0x9f, 0xb7, 0xff, 0x9f, 0xb7, 0xff, 0x9f, 0xb7, 0xff, 0x7f, 0xbf, 0xff, 0x5e, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x5e, 0xbf, 0xff, 0x7f, 0xbf, 0xff, 0x9f, 0xb7, 0xff, 0x9f, 0xb7, 0xff, 0x9f, 0xb7, 0xff, 0x7e, 0xb7, 0xff, 0x3d, 0xbf, 0xff, 0x1d, 0xb7, 0xff, 0x1c, 0xb7, 0xff, 0x1c, 0xb7, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0x3d, 0xb7, 0xff, 0x5e, 0xb7, 0xff, 0xf1, 0xcc, 0xff, 0x48, 0xe3, 0xff, 0xa5, 0xea, 0xff, 0xc5, 0xea, 0xff, 0xaa, 0xdb, 0xff, 0x95, 0xcd, 0xff, 0xbf, 0xb7, 0xff, 0x3d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x1d, 0xbf, 0xff, 0x3d, 0xbf, 0xff, 0x9f, 0xb7, 0xff, 0x58, 0xc6, 0xff, 0x0c, 0xdc, 0xff, 0xe6, 0xe2, 0xff, 0x84, 0xea, 0xff, 0x07, 0xe3, 0xff, 0x4e, 0xd4, 0xff, 0xdc, 0xb6, 0xff, 0x5e, 0xb7, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xb6, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x9e, 0xff, 0xbc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xb6, 0xff, 0x5e, 0xaf, 0xff, 0x38, 0xbe, 0xff, 0x02, 0xea, 0xff, 0x01, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x01, 0xea, 0xff, 0x64, 0xea, 0xff, 0xdb, 0xbe, 0xff, 0x5e, 0xb7, 0xff, 0x1d, 0xb7, 0xff, 0x7e, 0xb7, 0xff, 0x69, 0xdb, 0xff, 0xc0, 0xf1, 0xff, 0x22, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x22, 0xea, 0xff, 0xa0, 0xf1, 0xff, 0xd1, 0xcc, 0xff, 0x9f, 0xaf, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xfc, 0xae, 0xff, 0x1d, 0xaf, 0xff, 0x59, 0xb6, 0xff, 0xa0, 0xf1, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x63, 0xea, 0xff, 0x64, 0xea, 0xff, 0x63, 0xea, 0xff, 0x63, 0xea, 0xff, 0x43, 0xea, 0xff, 0xe1, 0xe9, 0xff, 0xdb, 0xbe, 0xff, 0x9f, 0xaf, 0xff, 0xa5, 0xe2, 0xff, 0x22, 0xea, 0xff, 0x63, 0xea, 0xff, 0x63, 0xea, 0xff, 0x64, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0xa0, 0xe9, 0xff, 0x6f, 0xcc, 0xff, 0x5e, 0xaf, 0xff, 0xfc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xbc, 0xa6, 0xff, 0xbb, 0x9e, 0xff, 0xdc, 0xa6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9b, 0x9e, 0xff, 0xbc, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0xa6, 0xff, 0xbc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xae, 0xff, 0x7f, 0xa7, 0xff, 0x23, 0xea, 0xff, 0x23, 0xea, 0xff, 0x43, 0xe2, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x23, 0xea, 0xff, 0xa5, 0xe2, 0xff, 0x6f, 0xd4, 0xff, 0x02, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x80, 0xe9, 0xff, 0x9a, 0xae, 0xff, 0xfc, 0xa6, 0xff, 0xdc, 0xae, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xbc, 0xa6, 0xff, 0xbb, 0xa6, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xdc, 0xa6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0x1d, 0xa7, 0xff, 0x54, 0xbd, 0xff, 0xa1, 0xe9, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x43, 0xe2, 0xff, 0x43, 0xe2, 0xff, 0x43, 0xe2, 0xff, 0x43, 0xe2, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xe2, 0xff, 0x23, 0xea, 0xff, 0x02, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xea, 0xff, 0x43, 0xe2, 0xff, 0x43, 0xe2, 0xff, 0x43, 0xe2, 0xff, 0x43, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0xe2, 0xe9, 0xff, 0x8a, 0xd3, 0xff, 0x3e, 0xa7, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0xbc, 0xa6, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xdb, 0x9e, 0xff, 0xdc, 0xae, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9b, 0x8e, 0xff, 0x9b, 0x8e, 0xff, 0x9b, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0xa6, 0xff, 0xbc, 0xa6, 0xff, 0xdc, 0xa6, 0xff, 0x3e, 0x9f, 0xff, 0x4a, 0xd3, 0xff, 0xe2, 0xe1, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x84, 0xea, 0xff, 0x23, 0xe2, 0xff, 0x43, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0xa1, 0xe9, 0xff, 0x5e, 0x9f, 0xff, 0xdc, 0xa6, 0xff, 0xbc, 0xa6, 0xff, 0xbc, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7b, 0x8e, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbc, 0xa6, 0xff, 0x3e, 0x9f, 0xff, 0x44, 0xe2, 0xff, 0xe3, 0xe1, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0xe2, 0xe1, 0xff, 0x6b, 0xfc, 0xff, 0x44, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x60, 0xe9, 0xff, 0x9b, 0xa6, 0xff, 0xdc, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0xbb, 0x9e, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7b, 0x8e, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0x3e, 0x97, 0xff, 0x45, 0xda, 0xff, 0xe2, 0xe1, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0xc5, 0xea, 0xff, 0x6b, 0xfc, 0xff, 0x88, 0xfb, 0xff, 0xe2, 0xe1, 0xff, 0x03, 0xe2, 0xff, 0x23, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0xe3, 0xe1, 0xff, 0xe3, 0xe1, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x03, 0xe2, 0xff, 0x60, 0xe9, 0xff, 0xbb, 0x9e, 0xff, 0xbc, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0xbb, 0x9e, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0xbb, 0x9e, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x9e, 0xff, 0xdd, 0x96, 0xff, 0xfd, 0x8e, 0xff, 0x5f, 0x8f, 0xff, 0x8c, 0xc3, 0xff, 0x81, 0xe1, 0xff, 0xc2, 0xd9, 0xff, 0xc2, 0xd9, 0xff, 0xc2, 0xd9, 0xff, 0xc2, 0xe1, 0xff, 0xc2, 0xe1, 0xff, 0xe2, 0xe1, 0xff, 0x03, 0xe2, 0xff, 0xc2, 0xe1, 0xff, 0xc9, 0xfb, 0xff, 0x07, 0xf3, 0xff, 0x4b, 0xfc, 0xff, 0x23, 0xe2, 0xff, 0xc6, 0xf2, 0xff, 0xe2, 0xe1, 0xff, 0x03, 0xe2, 0xff, 0xe2, 0xe1, 0xff, 0xc2, 0xe1, 0xff, 0x03, 0xe2, 0xff, 0x48, 0xfb, 0xff, 0xa5, 0xea, 0xff, 0xe2, 0xe1, 0xff, 0xe3, 0xe1, 0xff, 0xe3, 0xe1, 0xff, 0xe3, 0xe1, 0xff, 0xbf, 0x8f, 0xff, 0x3e, 0x97, 0xff, 0xfd, 0x96, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x7b, 0x8e, 0xff, 0x9b, 0x96, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x9b, 0x8e, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0xdc, 0x8e, 0xff, 0xaf, 0xdc, 0xff, 0xca, 0xfb, 0xff, 0x0b, 0xfc, 0xff, 0xea, 0xfb, 0xff, 0x88, 0xfb, 0xff, 0xa9, 0xfb, 0xff, 0xa9, 0xfb, 0xff, 0xa9, 0xfb, 0xff, 0xa9, 0xfb, 0xff, 0xc9, 0xfb, 0xff, 0x48, 0xfb, 0xff, 0xa2, 0xd9, 0xff, 0x44, 0xe2, 0xff, 0x2b, 0xfc, 0xff, 0xa2, 0xd9, 0xff, 0x27, 0xf3, 0xff, 0x88, 0xfb, 0xff, 0x2a, 0xfc, 0xff, 0xa5, 0xea, 0xff, 0xa2, 0xd9, 0xff, 0xa9, 0xfb, 0xff, 0xc9, 0xfb, 0xff, 0xca, 0xfb, 0xff, 0xc9, 0xfb, 0xff, 0x0a, 0xfc, 0xff, 0xe3, 0xe1, 0xff, 0xe3, 0xe1, 0xff, 0xe3, 0xe1, 0xff, 0x04, 0xda, 0xff, 0x65, 0xda, 0xff, 0x04, 0xda, 0xff, 0x70, 0xbc, 0xff, 0xdc, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x9b, 0x96, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7a, 0x86, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x96, 0xff, 0xfd, 0x8e, 0xff, 0x29, 0xd3, 0xff, 0xa1, 0xf1, 0xff, 0xe2, 0xf1, 0xff, 0xe3, 0xf1, 0xff, 0x03, 0xea, 0xff, 0x64, 0xea, 0xff, 0x65, 0xea, 0xff, 0x65, 0xea, 0xff, 0x65, 0xea, 0xff, 0x64, 0xea, 0xff, 0x0a, 0xfc, 0xff, 0x03, 0xe2, 0xff, 0x47, 0xfb, 0xff, 0x27, 0xf3, 0xff, 0xc2, 0xd9, 0xff, 0xe3, 0xe1, 0xff, 0x0a, 0xfc, 0xff, 0x68, 0xfb, 0xff, 0xea, 0xfb, 0xff, 0xa5, 0xea, 0xff, 0xc9, 0xfb, 0xff, 0x44, 0xea, 0xff, 0xe7, 0xf2, 0xff, 0xea, 0xfb, 0xff, 0xa9, 0xfb, 0xff, 0xc2, 0xd9, 0xff, 0xc3, 0xe1, 0xff, 0xa2, 0xe1, 0xff, 0x81, 0xe1, 0xff, 0x60, 0xe1, 0xff, 0x00, 0xe9, 0xff, 0xed, 0xbb, 0xff, 0xdd, 0x8e, 0xff, 0x9b, 0x96, 0xff, 0x9b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7a, 0x8e, 0xff, 0x7a, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0xbc, 0x8e, 0xff, 0xd2, 0xac, 0xff, 0x0e, 0xb4, 0xff, 0x2f, 0xb4, 0xff, 0x4f, 0xb4, 0xff, 0xad, 0xbb, 0xff, 0x40, 0xe1, 0xff, 0xc2, 0xd9, 0xff, 0xc2, 0xd9, 0xff, 0xc2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xc6, 0xf2, 0xff, 0x68, 0xfb, 0xff, 0xea, 0xfb, 0xff, 0xe3, 0xe1, 0xff, 0xc3, 0xe1, 0xff, 0xc2, 0xd9, 0xff, 0xe6, 0xf2, 0xff, 0xa2, 0xd9, 0xff, 0x48, 0xfb, 0xff, 0xea, 0xfb, 0xff, 0x64, 0xea, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0x03, 0xe2, 0xff, 0xc2, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0x82, 0xe1, 0xff, 0xc8, 0xca, 0xff, 0x70, 0xb4, 0xff, 0x2f, 0xb4, 0xff, 0x0e, 0xbc, 0xff, 0x55, 0xa5, 0xff, 0xbc, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7a, 0x86, 0xff, 0x9b, 0x86, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x3a, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7b, 0x86, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0xbc, 0x8e, 0xff, 0xdc, 0x8e, 0xff, 0xdc, 0x8e, 0xff, 0xdc, 0x8e, 0xff, 0x5f, 0x87, 0xff, 0xa8, 0xca, 0xff, 0x81, 0xe1, 0xff, 0xc3, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa9, 0xfb, 0xff, 0x27, 0xfb, 0xff, 0xa2, 0xd9, 0xff, 0xc3, 0xe1, 0xff, 0xc3, 0xe1, 0xff, 0xa2, 0xd9, 0xff, 0xc2, 0xd9, 0xff, 0xe3, 0xe1, 0xff, 0x89, 0xfb, 0xff, 0x82, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xc2, 0xd9, 0xff, 0xc2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0x40, 0xe1, 0xff, 0xfd, 0x8e, 0xff, 0xdd, 0x8e, 0xff, 0xdc, 0x8e, 0xff, 0xdc, 0x8e, 0xff, 0xbc, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7b, 0x8e, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x3a, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x9b, 0x8e, 0xff, 0xbc, 0x8e, 0xff, 0x61, 0xe1, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa6, 0xf2, 0xff, 0x24, 0xea, 0xff, 0xa2, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xc2, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xc3, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0x00, 0xe9, 0xff, 0x96, 0xa5, 0xff, 0xbc, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x7b, 0x8e, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x3a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0xbc, 0x8e, 0xff, 0xf8, 0x95, 0xff, 0x00, 0xe1, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0x00, 0xe1, 0xff, 0x2f, 0xb4, 0xff, 0xfd, 0x86, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x7e, 0xff, 0x7b, 0x8e, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x3a, 0x7e, 0xff, 0x5a, 0x76, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0xdc, 0x86, 0xff, 0x34, 0xa5, 0xff, 0xe0, 0xe0, 0xff, 0x82, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0xa2, 0xd9, 0xff, 0x20, 0xe1, 0xff, 0x4b, 0xc3, 0xff, 0x1e, 0x87, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0x7a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x7b, 0x86, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x8e, 0xff, 0xdd, 0x86, 0xff, 0xd2, 0xa4, 0xff, 0xe0, 0xe0, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x00, 0xe1, 0xff, 0xe9, 0xc2, 0xff, 0x1e, 0x7f, 0xff, 0x7b, 0x8e, 0xff, 0x7b, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x7b, 0x86, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0x7a, 0x86, 0xff, 0xdd, 0x7e, 0xff, 0x34, 0x9d, 0xff, 0xc0, 0xe0, 0xff, 0x62, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd9, 0xff, 0xe0, 0xe0, 0xff, 0x4b, 0xbb, 0xff, 0x1e, 0x7f, 0xff, 0x7a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x7a, 0x86, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0xbc, 0x7e, 0xff, 0xb7, 0x95, 0xff, 0xe0, 0xe0, 0xff, 0x41, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0xc0, 0xe0, 0xff, 0x0f, 0xac, 0xff, 0xfe, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x6e, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x9b, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0xa3, 0xd1, 0xff, 0x00, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0x62, 0xd9, 0xff, 0x41, 0xd9, 0xff, 0xe0, 0xe0, 0xff, 0x35, 0x95, 0xff, 0xdd, 0x7e, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x86, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x6e, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x7b, 0x7e, 0xff, 0xfd, 0x76, 0xff, 0x2b, 0xb3, 0xff, 0xa0, 0xe0, 0xff, 0x41, 0xd9, 0xff, 0x42, 0xd9, 0xff, 0xe0, 0xe0, 0xff, 0xc4, 0xc9, 0xff, 0x5a, 0x7e, 0xff, 0x9c, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x1a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0xdd, 0x76, 0xff, 0x76, 0x8d, 0xff, 0x62, 0xd1, 0xff, 0xc0, 0xe0, 0xff, 0x30, 0xa4, 0xff, 0xfd, 0x76, 0xff, 0x5a, 0x7e, 0xff, 0x5a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x19, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x7b, 0x76, 0xff, 0xbc, 0x76, 0xff, 0x5a, 0x7e, 0xff, 0x9b, 0x76, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x7e, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x65, 0xff, 0x5a, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x1a, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x66, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x3a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x3a, 0x76, 0xff, 0x19, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x65, 0xff, 0xf9, 0x6d, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x1a, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x76, 0xff, 0x19, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x6d, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x6d, 0xff, 0x19, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x6d, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0x19, 0x6e, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x6d, 0xff, 0x19, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x6d, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0x19, 0x66, 0xff, 0xf9, 0x6d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x65, 0xff, 0x19, 0x66, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xd9, 0x5d, 0xff, 0xf9, 0x5d, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xd9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xd9, 0x65, 0xff, 0xd9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xd9, 0x65, 0xff, 0xd9, 0x65, 0xff, 0xd9, 0x65, 0xff, 0xf9, 0x65, 0xff, 0xd8, 0x65, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xe7, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x7e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xe7, 0xbf, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xe7, 0x9e, 0xff, 0xe7, 0x9e, 0xff, 0xe7, 0x9e, 0xff, 0xe7, 0x9e, 0xff, 0xe7, 0x9e, 0xff, 0xe7, 0x9e, 0xff, 0xe7, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9f, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x7e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5d, 0xff, 0xd7, 0x5e, 0xff, 0xdf, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xd7, 0x9e, 0xff, 0xcf, 0x5e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5d, 0xff, 0xd7, 0x9e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xd7, 0x9e, 0xff, 0xcf, 0x5e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xd7, 0x5e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3d, 0xff, 0xc7, 0x5d, 0xff, 0xc7, 0x3d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x1d, 0xff, 0xbf, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xd7, 0x5e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x5e, 0xff, 0xc7, 0x3d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x1d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xd7, 0x5e, 0xff, 0xd7, 0x5e, 0xff, 0xd7, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xc7, 0x5e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xc7, 0x5d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0xb7, 0x3d, 0xff, 0xb7, 0x1c, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xcf, 0x5d, 0xff, 0xc7, 0x5d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xb7, 0x1c, 0xff, 0xb7, 0x1d, 0xff, 0xb6, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0xb6, 0xdc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb7, 0x1c, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xb7, 0x1d, 0xff, 0xb7, 0x1c, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xdc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb7, 0x1c, 0xff, 0xb7, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xb7, 0x1d, 0xff, 0xb7, 0x1c, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xbe, 0xfd, 0xff, 0xb6, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xdb, 0xff, 0xa6, 0xdc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb7, 0x1c, 0xff, 0xb7, 0x1c, 0xff, 0xb7, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xc7, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xb7, 0x1d, 0xff, 0xb7, 0x1c, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb7, 0x1c, 0xff, 0xb7, 0x1c, 0xff, 0xb7, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xb7, 0x5e, 0xff, 0xb7, 0x9f, 0xff, 0xb7, 0x9f, 0xff, 0xb7, 0x9f, 0xff, 0xbf, 0x7f, 0xff, 0xbf, 0x5e, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x5e, 0xff, 0xbf, 0x7f, 0xff, 0xb7, 0x9f, 0xff, 0xb7, 0x9f, 0xff, 0xb7, 0x9f, 0xff, 0xb7, 0x7e, 0xff, 0xbf, 0x3d, 0xff, 0xb7, 0x1d, 0xff, 0xb7, 0x1c, 0xff, 0xb7, 0x1c, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb7, 0x3d, 0xff, 0xb7, 0x5e, 0xff, 0xcc, 0xf1, 0xff, 0xe3, 0x48, 0xff, 0xea, 0xa5, 0xff, 0xea, 0xc5, 0xff, 0xdb, 0xaa, 0xff, 0xcd, 0x95, 0xff, 0xb7, 0xbf, 0xff, 0xbf, 0x3d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x1d, 0xff, 0xbf, 0x3d, 0xff, 0xb7, 0x9f, 0xff, 0xc6, 0x58, 0xff, 0xdc, 0x0c, 0xff, 0xe2, 0xe6, 0xff, 0xea, 0x84, 0xff, 0xe3, 0x07, 0xff, 0xd4, 0x4e, 0xff, 0xb6, 0xdc, 0xff, 0xb7, 0x5e, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xbb, 0xff, 0xa6, 0xbc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xb6, 0xfc, 0xff, 0xaf, 0x5e, 0xff, 0xbe, 0x38, 0xff, 0xea, 0x02, 0xff, 0xea, 0x01, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x01, 0xff, 0xea, 0x64, 0xff, 0xbe, 0xdb, 0xff, 0xb7, 0x5e, 0xff, 0xb7, 0x1d, 0xff, 0xb7, 0x7e, 0xff, 0xdb, 0x69, 0xff, 0xf1, 0xc0, 0xff, 0xea, 0x22, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x22, 0xff, 0xf1, 0xa0, 0xff, 0xcc, 0xd1, 0xff, 0xaf, 0x9f, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9b, 0xff, 0x9e, 0xbb, 0xff, 0xa6, 0xbc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xfc, 0xff, 0xaf, 0x1d, 0xff, 0xb6, 0x59, 0xff, 0xf1, 0xa0, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x63, 0xff, 0xea, 0x64, 0xff, 0xea, 0x63, 0xff, 0xea, 0x63, 0xff, 0xea, 0x43, 0xff, 0xe9, 0xe1, 0xff, 0xbe, 0xdb, 0xff, 0xaf, 0x9f, 0xff, 0xe2, 0xa5, 0xff, 0xea, 0x22, 0xff, 0xea, 0x63, 0xff, 0xea, 0x63, 0xff, 0xea, 0x64, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xe9, 0xa0, 0xff, 0xcc, 0x6f, 0xff, 0xaf, 0x5e, 0xff, 0xae, 0xfc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xbc, 0xff, 0x9e, 0xbb, 0xff, 0xa6, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9e, 0x9b, 0xff, 0x9e, 0xbc, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0xa6, 0xbb, 0xff, 0xa6, 0xbc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xae, 0xdc, 0xff, 0xa7, 0x7f, 0xff, 0xea, 0x23, 0xff, 0xea, 0x23, 0xff, 0xe2, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x23, 0xff, 0xe2, 0xa5, 0xff, 0xd4, 0x6f, 0xff, 0xea, 0x02, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xe2, 0x43, 0xff, 0xe2, 0x23, 0xff, 0xe9, 0x80, 0xff, 0xae, 0x9a, 0xff, 0xa6, 0xfc, 0xff, 0xae, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xbc, 0xff, 0xa6, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0xa6, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0xa6, 0xbc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa7, 0x1d, 0xff, 0xbd, 0x54, 0xff, 0xe9, 0xa1, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x43, 0xff, 0xe2, 0x43, 0xff, 0xe2, 0x43, 0xff, 0xe2, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xe2, 0x43, 0xff, 0xea, 0x23, 0xff, 0xea, 0x02, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xea, 0x43, 0xff, 0xe2, 0x43, 0xff, 0xe2, 0x43, 0xff, 0xe2, 0x43, 0xff, 0xe2, 0x43, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe9, 0xe2, 0xff, 0xd3, 0x8a, 0xff, 0xa7, 0x3e, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xbc, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xdb, 0xff, 0xae, 0xdc, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8e, 0x9b, 0xff, 0x8e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0xa6, 0xbb, 0xff, 0xa6, 0xbc, 0xff, 0xa6, 0xdc, 0xff, 0x9f, 0x3e, 0xff, 0xd3, 0x4a, 0xff, 0xe1, 0xe2, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xea, 0x84, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x43, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x03, 0xff, 0xe9, 0xa1, 0xff, 0x9f, 0x5e, 0xff, 0xa6, 0xdc, 0xff, 0xa6, 0xbc, 0xff, 0x9e, 0xbc, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8e, 0x7b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0xa6, 0xbc, 0xff, 0x9f, 0x3e, 0xff, 0xe2, 0x44, 0xff, 0xe1, 0xe3, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe1, 0xe2, 0xff, 0xfc, 0x6b, 0xff, 0xe2, 0x44, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe9, 0x60, 0xff, 0xa6, 0x9b, 0xff, 0x9e, 0xdc, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x9e, 0xbb, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8e, 0x7b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x97, 0x3e, 0xff, 0xda, 0x45, 0xff, 0xe1, 0xe2, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xea, 0xc5, 0xff, 0xfc, 0x6b, 0xff, 0xfb, 0x88, 0xff, 0xe1, 0xe2, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x23, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe1, 0xe3, 0xff, 0xe1, 0xe3, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe2, 0x03, 0xff, 0xe9, 0x60, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbc, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x9e, 0xbb, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x9e, 0xbb, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x96, 0xdd, 0xff, 0x8e, 0xfd, 0xff, 0x8f, 0x5f, 0xff, 0xc3, 0x8c, 0xff, 0xe1, 0x81, 0xff, 0xd9, 0xc2, 0xff, 0xd9, 0xc2, 0xff, 0xd9, 0xc2, 0xff, 0xe1, 0xc2, 0xff, 0xe1, 0xc2, 0xff, 0xe1, 0xe2, 0xff, 0xe2, 0x03, 0xff, 0xe1, 0xc2, 0xff, 0xfb, 0xc9, 0xff, 0xf3, 0x07, 0xff, 0xfc, 0x4b, 0xff, 0xe2, 0x23, 0xff, 0xf2, 0xc6, 0xff, 0xe1, 0xe2, 0xff, 0xe2, 0x03, 0xff, 0xe1, 0xe2, 0xff, 0xe1, 0xc2, 0xff, 0xe2, 0x03, 0xff, 0xfb, 0x48, 0xff, 0xea, 0xa5, 0xff, 0xe1, 0xe2, 0xff, 0xe1, 0xe3, 0xff, 0xe1, 0xe3, 0xff, 0xe1, 0xe3, 0xff, 0x8f, 0xbf, 0xff, 0x97, 0x3e, 0xff, 0x96, 0xfd, 0xff, 0x9e, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x8e, 0x7b, 0xff, 0x96, 0x9b, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x8e, 0xdc, 0xff, 0xdc, 0xaf, 0xff, 0xfb, 0xca, 0xff, 0xfc, 0x0b, 0xff, 0xfb, 0xea, 0xff, 0xfb, 0x88, 0xff, 0xfb, 0xa9, 0xff, 0xfb, 0xa9, 0xff, 0xfb, 0xa9, 0xff, 0xfb, 0xa9, 0xff, 0xfb, 0xc9, 0xff, 0xfb, 0x48, 0xff, 0xd9, 0xa2, 0xff, 0xe2, 0x44, 0xff, 0xfc, 0x2b, 0xff, 0xd9, 0xa2, 0xff, 0xf3, 0x27, 0xff, 0xfb, 0x88, 0xff, 0xfc, 0x2a, 0xff, 0xea, 0xa5, 0xff, 0xd9, 0xa2, 0xff, 0xfb, 0xa9, 0xff, 0xfb, 0xc9, 0xff, 0xfb, 0xca, 0xff, 0xfb, 0xc9, 0xff, 0xfc, 0x0a, 0xff, 0xe1, 0xe3, 0xff, 0xe1, 0xe3, 0xff, 0xe1, 0xe3, 0xff, 0xda, 0x04, 0xff, 0xda, 0x65, 0xff, 0xda, 0x04, 0xff, 0xbc, 0x70, 0xff, 0x96, 0xdc, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x8e, 0x9b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x96, 0x9b, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x86, 0x7a, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x96, 0x9b, 0xff, 0x96, 0x9b, 0xff, 0x8e, 0xfd, 0xff, 0xd3, 0x29, 0xff, 0xf1, 0xa1, 0xff, 0xf1, 0xe2, 0xff, 0xf1, 0xe3, 0xff, 0xea, 0x03, 0xff, 0xea, 0x64, 0xff, 0xea, 0x65, 0xff, 0xea, 0x65, 0xff, 0xea, 0x65, 0xff, 0xea, 0x64, 0xff, 0xfc, 0x0a, 0xff, 0xe2, 0x03, 0xff, 0xfb, 0x47, 0xff, 0xf3, 0x27, 0xff, 0xd9, 0xc2, 0xff, 0xe1, 0xe3, 0xff, 0xfc, 0x0a, 0xff, 0xfb, 0x68, 0xff, 0xfb, 0xea, 0xff, 0xea, 0xa5, 0xff, 0xfb, 0xc9, 0xff, 0xea, 0x44, 0xff, 0xf2, 0xe7, 0xff, 0xfb, 0xea, 0xff, 0xfb, 0xa9, 0xff, 0xd9, 0xc2, 0xff, 0xe1, 0xc3, 0xff, 0xe1, 0xa2, 0xff, 0xe1, 0x81, 0xff, 0xe1, 0x60, 0xff, 0xe9, 0x00, 0xff, 0xbb, 0xed, 0xff, 0x8e, 0xdd, 0xff, 0x96, 0x9b, 0xff, 0x8e, 0x9b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8e, 0x7a, 0xff, 0x8e, 0x7a, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0xbc, 0xff, 0xac, 0xd2, 0xff, 0xb4, 0x0e, 0xff, 0xb4, 0x2f, 0xff, 0xb4, 0x4f, 0xff, 0xbb, 0xad, 0xff, 0xe1, 0x40, 0xff, 0xd9, 0xc2, 0xff, 0xd9, 0xc2, 0xff, 0xd9, 0xc2, 0xff, 0xd9, 0xa2, 0xff, 0xf2, 0xc6, 0xff, 0xfb, 0x68, 0xff, 0xfb, 0xea, 0xff, 0xe1, 0xe3, 0xff, 0xe1, 0xc3, 0xff, 0xd9, 0xc2, 0xff, 0xf2, 0xe6, 0xff, 0xd9, 0xa2, 0xff, 0xfb, 0x48, 0xff, 0xfb, 0xea, 0xff, 0xea, 0x64, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xe2, 0x03, 0xff, 0xd9, 0xc2, 0xff, 0xd9, 0xc3, 0xff, 0xe1, 0x82, 0xff, 0xca, 0xc8, 0xff, 0xb4, 0x70, 0xff, 0xb4, 0x2f, 0xff, 0xbc, 0x0e, 0xff, 0xa5, 0x55, 0xff, 0x8e, 0xbc, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x9b, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7e, 0x3a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0xbc, 0xff, 0x8e, 0xdc, 0xff, 0x8e, 0xdc, 0xff, 0x8e, 0xdc, 0xff, 0x87, 0x5f, 0xff, 0xca, 0xa8, 0xff, 0xe1, 0x81, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xa2, 0xff, 0xfb, 0xa9, 0xff, 0xfb, 0x27, 0xff, 0xd9, 0xa2, 0xff, 0xe1, 0xc3, 0xff, 0xe1, 0xc3, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xc2, 0xff, 0xe1, 0xe3, 0xff, 0xfb, 0x89, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xc2, 0xff, 0xd9, 0xc2, 0xff, 0xd9, 0xa2, 0xff, 0xe1, 0x40, 0xff, 0x8e, 0xfd, 0xff, 0x8e, 0xdd, 0xff, 0x8e, 0xdc, 0xff, 0x8e, 0xdc, 0xff, 0x8e, 0xbc, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x86, 0x7b, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x7a, 0xff, 0x8e, 0x7b, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7e, 0x3a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x7a, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x9b, 0xff, 0x8e, 0xbc, 0xff, 0xe1, 0x61, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xa2, 0xff, 0xf2, 0xa6, 0xff, 0xea, 0x24, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xc2, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xc3, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xe9, 0x00, 0xff, 0xa5, 0x96, 0xff, 0x8e, 0xbc, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x8e, 0x7b, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7e, 0x3a, 0xff, 0x7e, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x7a, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0xbc, 0xff, 0x95, 0xf8, 0xff, 0xe1, 0x00, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xe1, 0x00, 0xff, 0xb4, 0x2f, 0xff, 0x86, 0xfd, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x8e, 0x7b, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7e, 0x3a, 0xff, 0x76, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x7a, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x86, 0xdc, 0xff, 0xa5, 0x34, 0xff, 0xe0, 0xe0, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xd9, 0xa2, 0xff, 0xe1, 0x20, 0xff, 0xc3, 0x4b, 0xff, 0x87, 0x1e, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x86, 0x7b, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x7a, 0xff, 0x8e, 0x7b, 0xff, 0x8e, 0x7b, 0xff, 0x86, 0xdd, 0xff, 0xa4, 0xd2, 0xff, 0xe0, 0xe0, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xe1, 0x00, 0xff, 0xc2, 0xe9, 0xff, 0x7f, 0x1e, 0xff, 0x8e, 0x7b, 0xff, 0x86, 0x7b, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x86, 0x7b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x7a, 0xff, 0x7e, 0xdd, 0xff, 0x9d, 0x34, 0xff, 0xe0, 0xc0, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xd9, 0x82, 0xff, 0xe0, 0xe0, 0xff, 0xbb, 0x4b, 0xff, 0x7f, 0x1e, 0xff, 0x86, 0x7a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x5a, 0xff, 0x86, 0x7a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x7e, 0xbc, 0xff, 0x95, 0xb7, 0xff, 0xe0, 0xe0, 0xff, 0xd9, 0x41, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x62, 0xff, 0xe0, 0xc0, 0xff, 0xac, 0x0f, 0xff, 0x7e, 0xfe, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x19, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x7e, 0x9b, 0xff, 0x86, 0x5a, 0xff, 0xd1, 0xa3, 0xff, 0xd9, 0x00, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x62, 0xff, 0xd9, 0x41, 0xff, 0xe0, 0xe0, 0xff, 0x95, 0x35, 0xff, 0x7e, 0xdd, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x86, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x19, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x7b, 0xff, 0x76, 0xfd, 0xff, 0xb3, 0x2b, 0xff, 0xe0, 0xa0, 0xff, 0xd9, 0x41, 0xff, 0xd9, 0x42, 0xff, 0xe0, 0xe0, 0xff, 0xc9, 0xc4, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x9c, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x76, 0xdd, 0xff, 0x8d, 0x76, 0xff, 0xd1, 0x62, 0xff, 0xe0, 0xc0, 0xff, 0xa4, 0x30, 0xff, 0x76, 0xfd, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x5a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x19, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x1a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x76, 0x7b, 0xff, 0x76, 0xbc, 0xff, 0x7e, 0x5a, 0xff, 0x76, 0x9b, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x7e, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf9, 0xff, 0x6e, 0x5a, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x76, 0x1a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x76, 0x3a, 0xff, 0x76, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x1a, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x76, 0x19, 0xff, 0x76, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6d, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x76, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6e, 0x19, 0xff, 0x6d, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x76, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x6d, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x66, 0x19, 0xff, 0x6d, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf9, 0xff, 0x66, 0x19, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xf9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xd9, 0xff, 0x5d, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xd9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xd9, 0xff, 0x65, 0xd9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xd9, 0xff, 0x65, 0xd9, 0xff, 0x65, 0xd9, 0xff, 0x65, 0xf9, 0xff, 0x65, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xdc, 0xff, 0xf2, 0xf0, 0xdb, 0xff, 0xf3, 0xf0, 0xdb, 0xff, 0xf2, 0xf1, 0xdc, 0xff, 0xf2, 0xf0, 0xdb, 0xff, 0xf3, 0xf0, 0xdb, 0xff, 0xf3, 0xf0, 0xdb, 0xff, 0xf4, 0xf2, 0xde, 0xff, 0xf3, 0xef, 0xdb, 0xff, 0xf2, 0xef, 0xd8, 0xff, 0xf1, 0xef, 0xd8, 0xff, 0xf1, 0xef, 0xd8, 0xff, 0xf1, 0xef, 0xd8, 0xff, 0xf0, 0xee, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xee, 0xd6, 0xff, 0xf0, 0xee, 0xd7, 0xff, 0xf0, 0xee, 0xd7, 0xff, 0xf6, 0xf3, 0xde, 0xff, 0xf4, 0xf2, 0xdc, 0xff, 0xf3, 0xf0, 0xdc, 0xff, 0xf3, 0xf1, 0xdd, 0xff, 0xf3, 0xf1, 0xdd, 0xff, 0xf4, 0xf1, 0xde, 0xff, 0xf4, 0xf1, 0xde, 0xff, 0xf4, 0xf1, 0xde, 0xff, 0xf4, 0xf1, 0xde, 0xff, 0xf3, 0xf1, 0xdd, 0xff, 0xf3, 0xef, 0xda, 0xff, 0xf3, 0xef, 0xdb, 0xff, 0xf5, 0xf0, 0xd9, 0xff, 0xf1, 0xef, 0xd9, 0xff, 0xf0, 0xef, 0xd8, 0xff, 0xf0, 0xef, 0xd8, 0xff, 0xf0, 0xee, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xea, 0xcc, 0xff, 0xf0, 0xea, 0xd0, 0xff, 0xf0, 0xee, 0xd6, 0xff, 0xf1, 0xee, 0xd4, 0xff, 0xf1, 0xee, 0xd5, 0xff, 0xf1, 0xee, 0xd7, 0xff, 0xf2, 0xef, 0xd8, 0xff, 0xf2, 0xef, 0xd9, 0xff, 0xf2, 0xf0, 0xda, 0xff, 0xf2, 0xf0, 0xdb, 0xff, 0xf3, 0xf0, 0xdb, 0xff, 0xf3, 0xf0, 0xdb, 0xff, 0xf3, 0xf0, 0xdb, 0xff, 0xf3, 0xf0, 0xdb, 0xff, 0xf2, 0xf0, 0xda, 0xff, 0xf2, 0xf0, 0xda, 0xff, 0xf2, 0xef, 0xd9, 0xff, 0xf1, 0xef, 0xd8, 0xff, 0xf1, 0xee, 0xd7, 0xff, 0xf1, 0xee, 0xd5, 0xff, 0xf2, 0xef, 0xd8, 0xff, 0xf1, 0xef, 0xd8, 0xff, 0xef, 0xef, 0xd2, 0xff, 0xee, 0xea, 0xcc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xea, 0xcb, 0xff, 0xef, 0xef, 0xcf, 0xff, 0xee, 0xeb, 0xce, 0xff, 0xf0, 0xeb, 0xd0, 0xff, 0xef, 0xec, 0xd1, 0xff, 0xf0, 0xed, 0xd3, 0xff, 0xf1, 0xed, 0xd4, 0xff, 0xf1, 0xee, 0xd5, 0xff, 0xf1, 0xee, 0xd6, 0xff, 0xf1, 0xef, 0xd7, 0xff, 0xf2, 0xef, 0xd8, 0xff, 0xf2, 0xef, 0xd8, 0xff, 0xf2, 0xef, 0xd8, 0xff, 0xf2, 0xef, 0xd8, 0xff, 0xf2, 0xef, 0xd8, 0xff, 0xf2, 0xef, 0xd8, 0xff, 0xf1, 0xef, 0xd7, 0xff, 0xf1, 0xee, 0xd6, 0xff, 0xf1, 0xee, 0xd5, 0xff, 0xf0, 0xed, 0xd4, 0xff, 0xf0, 0xed, 0xd3, 0xff, 0xef, 0xec, 0xd1, 0xff, 0xef, 0xeb, 0xcf, 0xff, 0xf0, 0xec, 0xd8, 0xff, 0xef, 0xef, 0xd3, 0xff, 0xed, 0xe9, 0xcc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xe6, 0xc4, 0xff, 0xeb, 0xe7, 0xc5, 0xff, 0xec, 0xea, 0xc9, 0xff, 0xed, 0xe9, 0xcb, 0xff, 0xed, 0xea, 0xcc, 0xff, 0xee, 0xea, 0xcd, 0xff, 0xee, 0xeb, 0xcf, 0xff, 0xef, 0xec, 0xd0, 0xff, 0xef, 0xec, 0xd2, 0xff, 0xf0, 0xed, 0xd3, 0xff, 0xf0, 0xed, 0xd4, 0xff, 0xf0, 0xed, 0xd4, 0xff, 0xf1, 0xee, 0xd5, 0xff, 0xf1, 0xee, 0xd5, 0xff, 0xf1, 0xee, 0xd5, 0xff, 0xf1, 0xee, 0xd5, 0xff, 0xf1, 0xee, 0xd5, 0xff, 0xf1, 0xee, 0xd5, 0xff, 0xf1, 0xed, 0xd4, 0xff, 0xf0, 0xed, 0xd3, 0xff, 0xf0, 0xed, 0xd2, 0xff, 0xef, 0xec, 0xd1, 0xff, 0xef, 0xec, 0xd0, 0xff, 0xee, 0xeb, 0xce, 0xff, 0xee, 0xea, 0xcd, 0xff, 0xed, 0xea, 0xcb, 0xff, 0xed, 0xe9, 0xc9, 0xff, 0xed, 0xe9, 0xc9, 0xff, 0xe8, 0xe3, 0xc0, 0xff, 0xe8, 0xe3, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xe6, 0xc4, 0xff, 0xea, 0xe7, 0xc4, 0xff, 0xeb, 0xe6, 0xc4, 0xff, 0xeb, 0xe7, 0xc6, 0xff, 0xec, 0xe8, 0xc7, 0xff, 0xec, 0xe9, 0xc9, 0xff, 0xed, 0xe9, 0xcb, 0xff, 0xee, 0xea, 0xcc, 0xff, 0xee, 0xeb, 0xce, 0xff, 0xef, 0xeb, 0xcf, 0xff, 0xef, 0xec, 0xd0, 0xff, 0xef, 0xec, 0xd1, 0xff, 0xef, 0xec, 0xd1, 0xff, 0xf0, 0xed, 0xd2, 0xff, 0xf0, 0xed, 0xd2, 0xff, 0xf0, 0xed, 0xd3, 0xff, 0xf0, 0xed, 0xd3, 0xff, 0xf0, 0xed, 0xd2, 0xff, 0xf0, 0xed, 0xd2, 0xff, 0xef, 0xec, 0xd1, 0xff, 0xef, 0xec, 0xd1, 0xff, 0xef, 0xec, 0xd0, 0xff, 0xee, 0xeb, 0xcf, 0xff, 0xee, 0xeb, 0xcd, 0xff, 0xed, 0xea, 0xcc, 0xff, 0xed, 0xe9, 0xca, 0xff, 0xec, 0xe9, 0xc9, 0xff, 0xec, 0xe8, 0xc7, 0xff, 0xeb, 0xe7, 0xc5, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xe8, 0xe4, 0xc0, 0xff, 0xe9, 0xe4, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe0, 0xb5, 0xff, 0xe8, 0xe4, 0xb9, 0xff, 0xe9, 0xe4, 0xc0, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xeb, 0xe7, 0xc5, 0xff, 0xec, 0xe8, 0xc7, 0xff, 0xec, 0xe8, 0xc8, 0xff, 0xec, 0xe9, 0xca, 0xff, 0xed, 0xea, 0xcb, 0xff, 0xee, 0xea, 0xcc, 0xff, 0xee, 0xea, 0xcd, 0xff, 0xee, 0xeb, 0xce, 0xff, 0xee, 0xeb, 0xcf, 0xff, 0xef, 0xeb, 0xcf, 0xff, 0xef, 0xeb, 0xd0, 0xff, 0xef, 0xec, 0xcf, 0xff, 0xef, 0xec, 0xd0, 0xff, 0xef, 0xeb, 0xd0, 0xff, 0xef, 0xeb, 0xcf, 0xff, 0xee, 0xeb, 0xcf, 0xff, 0xee, 0xeb, 0xce, 0xff, 0xee, 0xea, 0xcd, 0xff, 0xed, 0xea, 0xcc, 0xff, 0xed, 0xe9, 0xcb, 0xff, 0xed, 0xe9, 0xc9, 0xff, 0xec, 0xe8, 0xc8, 0xff, 0xeb, 0xe8, 0xc6, 0xff, 0xeb, 0xe7, 0xc5, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xea, 0xe5, 0xc1, 0xff, 0xe9, 0xe4, 0xbf, 0xff, 0xed, 0xe8, 0xc1, 0xff, 0xe9, 0xe3, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe0, 0xb6, 0xff, 0xe7, 0xe3, 0xba, 0xff, 0xe8, 0xe3, 0xbb, 0xff, 0xe8, 0xe4, 0xbd, 0xff, 0xe9, 0xe4, 0xbf, 0xff, 0xea, 0xe5, 0xc1, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xea, 0xe7, 0xc4, 0xff, 0xeb, 0xe7, 0xc6, 0xff, 0xec, 0xe8, 0xc7, 0xff, 0xec, 0xe8, 0xc8, 0xff, 0xed, 0xe9, 0xc9, 0xff, 0xed, 0xe9, 0xca, 0xff, 0xed, 0xea, 0xcb, 0xff, 0xed, 0xea, 0xcc, 0xff, 0xed, 0xea, 0xcc, 0xff, 0xee, 0xea, 0xcc, 0xff, 0xee, 0xea, 0xcd, 0xff, 0xee, 0xea, 0xcd, 0xff, 0xee, 0xea, 0xcd, 0xff, 0xed, 0xea, 0xcc, 0xff, 0xed, 0xea, 0xcc, 0xff, 0xed, 0xe9, 0xcb, 0xff, 0xed, 0xe9, 0xca, 0xff, 0xec, 0xe9, 0xc9, 0xff, 0xec, 0xe8, 0xc8, 0xff, 0xeb, 0xe8, 0xc7, 0xff, 0xeb, 0xe7, 0xc6, 0xff, 0xeb, 0xe6, 0xc4, 0xff, 0xea, 0xe6, 0xc2, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xe9, 0xe4, 0xbf, 0xff, 0xe8, 0xe4, 0xbd, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xea, 0xe5, 0xbc, 0xff, 0xee, 0xe8, 0xc2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe1, 0xb7, 0xff, 0xe6, 0xe1, 0xb6, 0xff, 0xe6, 0xe1, 0xb7, 0xff, 0xe6, 0xe2, 0xb9, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe8, 0xe3, 0xbd, 0xff, 0xe8, 0xe4, 0xbf, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xea, 0xe5, 0xc2, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xeb, 0xe7, 0xc4, 0xff, 0xeb, 0xe7, 0xc6, 0xff, 0xeb, 0xe8, 0xc7, 0xff, 0xec, 0xe8, 0xc7, 0xff, 0xec, 0xe8, 0xc8, 0xff, 0xec, 0xe9, 0xc9, 0xff, 0xec, 0xe9, 0xc9, 0xff, 0xed, 0xe9, 0xca, 0xff, 0xed, 0xe9, 0xca, 0xff, 0xed, 0xe9, 0xca, 0xff, 0xed, 0xe9, 0xc9, 0xff, 0xec, 0xe9, 0xc9, 0xff, 0xec, 0xe9, 0xc9, 0xff, 0xec, 0xe8, 0xc8, 0xff, 0xec, 0xe8, 0xc7, 0xff, 0xeb, 0xe8, 0xc6, 0xff, 0xeb, 0xe7, 0xc5, 0xff, 0xeb, 0xe7, 0xc4, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xe9, 0xe4, 0xbe, 0xff, 0xe8, 0xe3, 0xbc, 0xff, 0xe7, 0xe2, 0xbb, 0xff, 0xe7, 0xe2, 0xb9, 0xff, 0xe6, 0xe1, 0xb7, 0xff, 0xe8, 0xe4, 0xbc, 0xff, 0xe8, 0xe4, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xde, 0xb0, 0xff, 0xe7, 0xe3, 0xb1, 0xff, 0xe4, 0xdf, 0xb3, 0xff, 0xe5, 0xe0, 0xb5, 0xff, 0xe6, 0xe1, 0xb7, 0xff, 0xe7, 0xe2, 0xb9, 0xff, 0xe7, 0xe2, 0xba, 0xff, 0xe8, 0xe3, 0xbc, 0xff, 0xe8, 0xe4, 0xbe, 0xff, 0xe9, 0xe4, 0xbf, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xea, 0xe5, 0xc2, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xea, 0xe6, 0xc4, 0xff, 0xeb, 0xe7, 0xc5, 0xff, 0xeb, 0xe7, 0xc5, 0xff, 0xeb, 0xe7, 0xc6, 0xff, 0xeb, 0xe8, 0xc6, 0xff, 0xec, 0xe8, 0xc7, 0xff, 0xec, 0xe8, 0xc7, 0xff, 0xec, 0xe8, 0xc7, 0xff, 0xec, 0xe8, 0xc7, 0xff, 0xeb, 0xe8, 0xc6, 0xff, 0xeb, 0xe7, 0xc6, 0xff, 0xeb, 0xe7, 0xc5, 0xff, 0xeb, 0xe7, 0xc4, 0xff, 0xea, 0xe6, 0xc4, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xea, 0xe5, 0xc1, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xe9, 0xe4, 0xbf, 0xff, 0xe8, 0xe4, 0xbd, 0xff, 0xe7, 0xe3, 0xbc, 0xff, 0xe7, 0xe2, 0xba, 0xff, 0xe6, 0xe1, 0xb8, 0xff, 0xe6, 0xe1, 0xb7, 0xff, 0xe5, 0xe0, 0xb5, 0xff, 0xe4, 0xdf, 0xb3, 0xff, 0xe5, 0xdf, 0xb2, 0xff, 0xdf, 0xd8, 0xb4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xdd, 0xae, 0xff, 0xe1, 0xda, 0xb0, 0xff, 0xe3, 0xdd, 0xaf, 0xff, 0xe3, 0xde, 0xb1, 0xff, 0xe4, 0xdf, 0xb3, 0xff, 0xe5, 0xe0, 0xb5, 0xff, 0xe5, 0xe1, 0xb6, 0xff, 0xe6, 0xe1, 0xb8, 0xff, 0xe7, 0xe2, 0xba, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe8, 0xe3, 0xbc, 0xff, 0xe8, 0xe4, 0xbe, 0xff, 0xe9, 0xe4, 0xbf, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xea, 0xe6, 0xc2, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xea, 0xe6, 0xc4, 0xff, 0xeb, 0xe6, 0xc4, 0xff, 0xeb, 0xe6, 0xc4, 0xff, 0xea, 0xe6, 0xc4, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xea, 0xe6, 0xc3, 0xff, 0xea, 0xe6, 0xc2, 0xff, 0xea, 0xe6, 0xc2, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xe9, 0xe4, 0xbf, 0xff, 0xe8, 0xe4, 0xbd, 0xff, 0xe8, 0xe3, 0xbc, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe7, 0xe2, 0xb9, 0xff, 0xe6, 0xe1, 0xb8, 0xff, 0xe6, 0xe0, 0xb6, 0xff, 0xe5, 0xe0, 0xb4, 0xff, 0xe4, 0xdf, 0xb2, 0xff, 0xe3, 0xde, 0xb0, 0xff, 0xe4, 0xde, 0xb1, 0xff, 0xe3, 0xdd, 0xb1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xd8, 0xa4, 0xff, 0xe2, 0xdc, 0xad, 0xff, 0xe2, 0xdc, 0xad, 0xff, 0xe3, 0xdd, 0xaf, 0xff, 0xe4, 0xde, 0xb1, 0xff, 0xe4, 0xdf, 0xb2, 0xff, 0xe5, 0xe0, 0xb4, 0xff, 0xe5, 0xe0, 0xb6, 0xff, 0xe6, 0xe1, 0xb7, 0xff, 0xe6, 0xe2, 0xb9, 0xff, 0xe7, 0xe2, 0xba, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe8, 0xe3, 0xbc, 0xff, 0xe8, 0xe4, 0xbd, 0xff, 0xe8, 0xe4, 0xbe, 0xff, 0xe9, 0xe4, 0xbf, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xe9, 0xe5, 0xc1, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xe9, 0xe5, 0xc0, 0xff, 0xe9, 0xe4, 0xbf, 0xff, 0xe8, 0xe4, 0xbe, 0xff, 0xe8, 0xe4, 0xbd, 0xff, 0xe8, 0xe3, 0xbc, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe7, 0xe2, 0xb9, 0xff, 0xe6, 0xe1, 0xb8, 0xff, 0xe6, 0xe1, 0xb7, 0xff, 0xe5, 0xe0, 0xb5, 0xff, 0xe5, 0xdf, 0xb4, 0xff, 0xe4, 0xdf, 0xb2, 0xff, 0xe3, 0xde, 0xb0, 0xff, 0xe3, 0xdd, 0xae, 0xff, 0xe2, 0xdd, 0xaf, 0xff, 0xe7, 0xdc, 0xb6, 0xff, 0xe2, 0xde, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xd8, 0xa1, 0xff, 0xe1, 0xd8, 0xa4, 0xff, 0xe0, 0xdb, 0xa8, 0xff, 0xe1, 0xdc, 0xab, 0xff, 0xe2, 0xdc, 0xac, 0xff, 0xe3, 0xdd, 0xae, 0xff, 0xe3, 0xde, 0xb0, 0xff, 0xe4, 0xdf, 0xb2, 0xff, 0xe4, 0xdf, 0xb3, 0xff, 0xe5, 0xe0, 0xb4, 0xff, 0xe5, 0xe0, 0xb6, 0xff, 0xe6, 0xe1, 0xb7, 0xff, 0xe6, 0xe1, 0xb8, 0xff, 0xe7, 0xe2, 0xb9, 0xff, 0xe7, 0xe2, 0xba, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe8, 0xe3, 0xbc, 0xff, 0xe8, 0xe3, 0xbd, 0xff, 0xe8, 0xe4, 0xbd, 0xff, 0xe8, 0xe4, 0xbe, 0xff, 0xe8, 0xe4, 0xbe, 0xff, 0xe8, 0xe4, 0xbe, 0xff, 0xe8, 0xe4, 0xbe, 0xff, 0xe8, 0xe4, 0xbe, 0xff, 0xe8, 0xe4, 0xbe, 0xff, 0xe8, 0xe4, 0xbd, 0xff, 0xe8, 0xe3, 0xbd, 0xff, 0xe8, 0xe3, 0xbc, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe7, 0xe2, 0xba, 0xff, 0xe7, 0xe2, 0xb9, 0xff, 0xe6, 0xe1, 0xb8, 0xff, 0xe6, 0xe1, 0xb7, 0xff, 0xe5, 0xe0, 0xb6, 0xff, 0xe5, 0xe0, 0xb4, 0xff, 0xe4, 0xdf, 0xb3, 0xff, 0xe4, 0xde, 0xb1, 0xff, 0xe3, 0xde, 0xaf, 0xff, 0xe3, 0xdd, 0xae, 0xff, 0xe2, 0xdc, 0xac, 0xff, 0xe1, 0xdb, 0xaa, 0xff, 0xe1, 0xdb, 0xad, 0xff, 0xe3, 0xdd, 0xb0, 0xff, 0xe2, 0xdd, 0xaf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xd9, 0xa4, 0xff, 0xdf, 0xd8, 0xa4, 0xff, 0xe0, 0xda, 0xa6, 0xff, 0xe1, 0xdb, 0xa8, 0xff, 0xe1, 0xdb, 0xaa, 0xff, 0xe2, 0xdc, 0xac, 0xff, 0xe2, 0xdd, 0xae, 0xff, 0xe3, 0xdd, 0xaf, 0xff, 0xe4, 0xde, 0xb0, 0xff, 0xe4, 0xdf, 0xb2, 0xff, 0xe4, 0xdf, 0xb3, 0xff, 0xe5, 0xe0, 0xb4, 0xff, 0xe7, 0xe1, 0xb5, 0xff, 0xf1, 0xe9, 0xb4, 0xff, 0xf9, 0xef, 0xb3, 0xff, 0xfc, 0xf1, 0xb3, 0xff, 0xfc, 0xf1, 0xb4, 0xff, 0xf8, 0xee, 0xb6, 0xff, 0xf0, 0xe9, 0xb8, 0xff, 0xe8, 0xe3, 0xbb, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe7, 0xe3, 0xbb, 0xff, 0xe7, 0xe2, 0xbb, 0xff, 0xed, 0xe7, 0xb9, 0xff, 0xf6, 0xed, 0xb6, 0xff, 0xfb, 0xf1, 0xb4, 0xff, 0xfc, 0xf2, 0xb3, 0xff, 0xfa, 0xef, 0xb3, 0xff, 0xf3, 0xeb, 0xb3, 0xff, 0xe9, 0xe3, 0xb5, 0xff, 0xe5, 0xe0, 0xb4, 0xff, 0xe4, 0xdf, 0xb3, 0xff, 0xe4, 0xdf, 0xb2, 0xff, 0xe3, 0xde, 0xb0, 0xff, 0xe3, 0xdd, 0xaf, 0xff, 0xe2, 0xdd, 0xad, 0xff, 0xe1, 0xdc, 0xab, 0xff, 0xe1, 0xdb, 0xaa, 0xff, 0xe0, 0xda, 0xa8, 0xff, 0xdf, 0xda, 0xa6, 0xff, 0xdf, 0xd9, 0xa4, 0xff, 0xe0, 0xd8, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xd8, 0xa2, 0xff, 0xe0, 0xd9, 0xa4, 0xff, 0xdf, 0xd8, 0xa2, 0xff, 0xdf, 0xd9, 0xa4, 0xff, 0xdf, 0xda, 0xa6, 0xff, 0xe0, 0xda, 0xa7, 0xff, 0xe1, 0xdb, 0xaa, 0xff, 0xe2, 0xdc, 0xab, 0xff, 0xe2, 0xdc, 0xac, 0xff, 0xe3, 0xdd, 0xae, 0xff, 0xe3, 0xde, 0xaf, 0xff, 0xe4, 0xde, 0xb1, 0xff, 0xec, 0xe5, 0xb0, 0xff, 0xf3, 0xea, 0xaf, 0xff, 0x8c, 0x9e, 0xcb, 0xff, 0x42, 0x68, 0xdf, 0xff, 0x25, 0x54, 0xe5, 0xff, 0x2a, 0x57, 0xe5, 0xff, 0x51, 0x74, 0xdc, 0xff, 0xa5, 0xb2, 0xc7, 0xff, 0xff, 0xf4, 0xb1, 0xff, 0xeb, 0xe5, 0xb7, 0xff, 0xe6, 0xe1, 0xb8, 0xff, 0xe6, 0xe1, 0xb8, 0xff, 0xe8, 0xe3, 0xb8, 0xff, 0xfe, 0xf2, 0xb2, 0xff, 0xc3, 0xc7, 0xc0, 0xff, 0x62, 0x81, 0xd7, 0xff, 0x33, 0x5e, 0xe2, 0xff, 0x1e, 0x4f, 0xe7, 0xff, 0x37, 0x60, 0xe1, 0xff, 0x6e, 0x89, 0xd2, 0xff, 0xde, 0xda, 0xb4, 0xff, 0xf3, 0xea, 0xad, 0xff, 0xe3, 0xde, 0xb0, 0xff, 0xe3, 0xdd, 0xaf, 0xff, 0xe3, 0xdd, 0xae, 0xff, 0xe2, 0xdc, 0xac, 0xff, 0xe1, 0xdc, 0xab, 0xff, 0xe1, 0xdb, 0xa9, 0xff, 0xe0, 0xda, 0xa7, 0xff, 0xe0, 0xd9, 0xa5, 0xff, 0xdf, 0xd9, 0xa4, 0xff, 0xde, 0xd8, 0xa2, 0xff, 0xe0, 0xd9, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xd6, 0x9a, 0xff, 0xdd, 0xd6, 0x9e, 0xff, 0xdd, 0xd7, 0xa0, 0xff, 0xde, 0xd8, 0xa2, 0xff, 0xdf, 0xd9, 0xa3, 0xff, 0xe0, 0xd9, 0xa5, 0xff, 0xe0, 0xda, 0xa7, 0xff, 0xe0, 0xdb, 0xa8, 0xff, 0xe1, 0xdb, 0xaa, 0xff, 0xe2, 0xdc, 0xab, 0xff, 0xe2, 0xdc, 0xad, 0xff, 0xef, 0xe7, 0xaa, 0xff, 0xbf, 0xc3, 0xb9, 0xff, 0x0e, 0x40, 0xea, 0xff, 0x0c, 0x3f, 0xea, 0xff, 0x16, 0x47, 0xe8, 0xff, 0x19, 0x4a, 0xe8, 0xff, 0x19, 0x4a, 0xe8, 0xff, 0x15, 0x47, 0xe9, 0xff, 0x0a, 0x3f, 0xec, 0xff, 0x1f, 0x4e, 0xe7, 0xff, 0xd9, 0xd7, 0xb8, 0xff, 0xef, 0xe7, 0xb3, 0xff, 0xe8, 0xe2, 0xb4, 0xff, 0xf4, 0xeb, 0xb1, 0xff, 0x4a, 0x6e, 0xdc, 0xff, 0x03, 0x3a, 0xee, 0xff, 0x14, 0x46, 0xea, 0xff, 0x18, 0x49, 0xe8, 0xff, 0x1a, 0x4a, 0xe7, 0xff, 0x17, 0x48, 0xe8, 0xff, 0x11, 0x43, 0xe9, 0xff, 0x00, 0x35, 0xed, 0xff, 0x87, 0x99, 0xc8, 0xff, 0xfb, 0xef, 0xa7, 0xff, 0xe2, 0xdc, 0xac, 0xff, 0xe1, 0xdc, 0xab, 0xff, 0xe1, 0xdb, 0xaa, 0xff, 0xe1, 0xdb, 0xa8, 0xff, 0xe0, 0xda, 0xa7, 0xff, 0xdf, 0xd9, 0xa5, 0xff, 0xdf, 0xd8, 0xa3, 0xff, 0xde, 0xd8, 0xa1, 0xff, 0xdd, 0xd8, 0xa1, 0xff, 0xde, 0xd8, 0xa3, 0xff, 0xe0, 0xd9, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xd2, 0x96, 0xff, 0xdc, 0xd5, 0x9c, 0xff, 0xdd, 0xd6, 0x9d, 0xff, 0xde, 0xd7, 0x9f, 0xff, 0xde, 0xd8, 0xa1, 0xff, 0xde, 0xd8, 0xa3, 0xff, 0xdf, 0xd9, 0xa4, 0xff, 0xe0, 0xda, 0xa6, 0xff, 0xe0, 0xda, 0xa7, 0xff, 0xe1, 0xdb, 0xa9, 0xff, 0xe8, 0xe0, 0xa8, 0xff, 0xc8, 0xc9, 0xb3, 0xff, 0x00, 0x33, 0xed, 0xff, 0x19, 0x47, 0xe6, 0xff, 0x1c, 0x4a, 0xe5, 0xff, 0x1c, 0x4a, 0xe6, 0xff, 0x1c, 0x4b, 0xe6, 0xff, 0x1d, 0x4b, 0xe6, 0xff, 0x1c, 0x4b, 0xe6, 0xff, 0x1c, 0x4b, 0xe6, 0xff, 0x17, 0x48, 0xe8, 0xff, 0x05, 0x3b, 0xec, 0xff, 0xdb, 0xd8, 0xb5, 0xff, 0xfe, 0xf2, 0xab, 0xff, 0x27, 0x53, 0xe4, 0xff, 0x10, 0x43, 0xea, 0xff, 0x1c, 0x4b, 0xe6, 0xff, 0x1c, 0x4b, 0xe6, 0xff, 0x1d, 0x4b, 0xe6, 0xff, 0x1c, 0x4a, 0xe6, 0xff, 0x1c, 0x4a, 0xe6, 0xff, 0x1c, 0x49, 0xe5, 0xff, 0x1b, 0x49, 0xe5, 0xff, 0x02, 0x35, 0xec, 0xff, 0x79, 0x8e, 0xc9, 0xff, 0xf2, 0xe8, 0xa5, 0xff, 0xe1, 0xdb, 0xa9, 0xff, 0xe0, 0xda, 0xa7, 0xff, 0xdf, 0xd9, 0xa6, 0xff, 0xdf, 0xd9, 0xa4, 0xff, 0xdf, 0xd8, 0xa2, 0xff, 0xde, 0xd7, 0xa1, 0xff, 0xdd, 0xd7, 0x9f, 0xff, 0xdd, 0xd6, 0x9d, 0xff, 0xdc, 0xd5, 0x9b, 0xff, 0xe0, 0xd8, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xda, 0xd2, 0x96, 0xff, 0xde, 0xd5, 0x97, 0xff, 0xdc, 0xd4, 0x99, 0xff, 0xdc, 0xd5, 0x9b, 0xff, 0xdc, 0xd6, 0x9d, 0xff, 0xdd, 0xd6, 0x9f, 0xff, 0xde, 0xd7, 0xa0, 0xff, 0xde, 0xd8, 0xa2, 0xff, 0xdf, 0xd8, 0xa3, 0xff, 0xdf, 0xd9, 0xa5, 0xff, 0xe0, 0xda, 0xa6, 0xff, 0xf8, 0xec, 0xa0, 0xff, 0x17, 0x43, 0xe5, 0xff, 0x16, 0x44, 0xe5, 0xff, 0x1b, 0x47, 0xe4, 0xff, 0x1b, 0x48, 0xe5, 0xff, 0x1c, 0x48, 0xe5, 0xff, 0x1b, 0x49, 0xe5, 0xff, 0x1c, 0x49, 0xe5, 0xff, 0x1c, 0x49, 0xe5, 0xff, 0x1c, 0x4a, 0xe6, 0xff, 0x1c, 0x4a, 0xe5, 0xff, 0x17, 0x46, 0xe7, 0xff, 0x2b, 0x55, 0xe2, 0xff, 0x76, 0x8d, 0xcd, 0xff, 0x0e, 0x3f, 0xe9, 0xff, 0x1c, 0x4a, 0xe5, 0xff, 0x1c, 0x4a, 0xe6, 0xff, 0x1c, 0x49, 0xe5, 0xff, 0x1c, 0x49, 0xe5, 0xff, 0x1b, 0x49, 0xe5, 0xff, 0x1c, 0x48, 0xe5, 0xff, 0x1b, 0x48, 0xe5, 0xff, 0x1b, 0x47, 0xe4, 0xff, 0x1a, 0x46, 0xe4, 0xff, 0x00, 0x30, 0xec, 0xff, 0xd2, 0xcf, 0xac, 0xff, 0xe4, 0xdd, 0xa4, 0xff, 0xdf, 0xd9, 0xa5, 0xff, 0xdf, 0xd8, 0xa3, 0xff, 0xde, 0xd8, 0xa2, 0xff, 0xde, 0xd7, 0xa0, 0xff, 0xdd, 0xd6, 0x9e, 0xff, 0xdc, 0xd6, 0x9d, 0xff, 0xdc, 0xd5, 0x9b, 0xff, 0xdb, 0xd4, 0x99, 0xff, 0xe3, 0xd9, 0xa2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xda, 0xd1, 0x93, 0xff, 0xd9, 0xd1, 0x93, 0xff, 0xdb, 0xd3, 0x97, 0xff, 0xdb, 0xd4, 0x99, 0xff, 0xdc, 0xd5, 0x9a, 0xff, 0xdc, 0xd5, 0x9c, 0xff, 0xdd, 0xd6, 0x9e, 0xff, 0xde, 0xd7, 0x9f, 0xff, 0xde, 0xd7, 0xa1, 0xff, 0xdf, 0xd8, 0xa2, 0xff, 0xe8, 0xdf, 0xa1, 0xff, 0x9e, 0xa8, 0xb9, 0xff, 0x06, 0x36, 0xe8, 0xff, 0x1a, 0x45, 0xe3, 0xff, 0x1a, 0x46, 0xe3, 0xff, 0x1b, 0x46, 0xe4, 0xff, 0x1a, 0x47, 0xe4, 0xff, 0x1b, 0x47, 0xe4, 0xff, 0x1b, 0x47, 0xe4, 0xff, 0x1b, 0x48, 0xe4, 0xff, 0x1b, 0x48, 0xe5, 0xff, 0x1b, 0x48, 0xe5, 0xff, 0x1a, 0x47, 0xe4, 0xff, 0x18, 0x46, 0xe6, 0xff, 0x12, 0x41, 0xe7, 0xff, 0x1b, 0x48, 0xe5, 0xff, 0x1b, 0x48, 0xe5, 0xff, 0x1b, 0x48, 0xe5, 0xff, 0x1b, 0x48, 0xe4, 0xff, 0x1b, 0x47, 0xe4, 0xff, 0x1b, 0x47, 0xe4, 0xff, 0x1a, 0x47, 0xe4, 0xff, 0x1b, 0x46, 0xe3, 0xff, 0x1a, 0x45, 0xe3, 0xff, 0x1a, 0x45, 0xe3, 0xff, 0x10, 0x3d, 0xe5, 0xff, 0x54, 0x70, 0xd0, 0xff, 0xef, 0xe5, 0x9e, 0xff, 0xde, 0xd8, 0xa2, 0xff, 0xde, 0xd7, 0xa1, 0xff, 0xdd, 0xd7, 0x9f, 0xff, 0xdd, 0xd6, 0x9d, 0xff, 0xdc, 0xd5, 0x9c, 0xff, 0xdc, 0xd5, 0x9a, 0xff, 0xdb, 0xd4, 0x98, 0xff, 0xda, 0xd3, 0x97, 0xff, 0xdc, 0xd7, 0x98, 0xff, 0xdf, 0xd8, 0xa5, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd9, 0xd0, 0x8a, 0xff, 0xd7, 0xcf, 0x8c, 0xff, 0xda, 0xd2, 0x95, 0xff, 0xda, 0xd3, 0x96, 0xff, 0xdb, 0xd4, 0x98, 0xff, 0xdb, 0xd4, 0x99, 0xff, 0xdc, 0xd5, 0x9b, 0xff, 0xdc, 0xd6, 0x9d, 0xff, 0xdd, 0xd6, 0x9e, 0xff, 0xde, 0xd7, 0xa0, 0xff, 0xef, 0xe4, 0x9b, 0xff, 0x4d, 0x69, 0xd0, 0xff, 0x11, 0x3c, 0xe4, 0xff, 0x1a, 0x43, 0xe2, 0xff, 0x19, 0x44, 0xe2, 0xff, 0x1a, 0x44, 0xe3, 0xff, 0x1a, 0x45, 0xe3, 0xff, 0x1a, 0x45, 0xe3, 0xff, 0x1a, 0x46, 0xe3, 0xff, 0x1b, 0x46, 0xe4, 0xff, 0x1b, 0x46, 0xe4, 0xff, 0x19, 0x45, 0xe3, 0xff, 0x24, 0x51, 0xe8, 0xff, 0x18, 0x44, 0xe3, 0xff, 0x1a, 0x47, 0xe4, 0xff, 0x1a, 0x46, 0xe4, 0xff, 0x1a, 0x46, 0xe4, 0xff, 0x1b, 0x46, 0xe4, 0xff, 0x1b, 0x46, 0xe4, 0xff, 0x1a, 0x45, 0xe3, 0xff, 0x1a, 0x45, 0xe3, 0xff, 0x1a, 0x45, 0xe3, 0xff, 0x19, 0x44, 0xe3, 0xff, 0x1a, 0x44, 0xe2, 0xff, 0x19, 0x43, 0xe2, 0xff, 0x18, 0x41, 0xe2, 0xff, 0x09, 0x35, 0xe7, 0xff, 0xf4, 0xe8, 0x99, 0xff, 0xde, 0xd7, 0x9f, 0xff, 0xdd, 0xd6, 0x9e, 0xff, 0xdd, 0xd6, 0x9c, 0xff, 0xdc, 0xd5, 0x9b, 0xff, 0xdb, 0xd4, 0x99, 0xff, 0xdb, 0xd4, 0x98, 0xff, 0xda, 0xd3, 0x96, 0xff, 0xda, 0xd2, 0x94, 0xff, 0xd9, 0xd1, 0x92, 0xff, 0xd9, 0xd1, 0x94, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd5, 0xcc, 0x88, 0xff, 0xd9, 0xd0, 0x90, 0xff, 0xd9, 0xd1, 0x92, 0xff, 0xd9, 0xd2, 0x94, 0xff, 0xda, 0xd3, 0x95, 0xff, 0xdb, 0xd3, 0x97, 0xff, 0xdb, 0xd4, 0x98, 0xff, 0xdc, 0xd5, 0x9a, 0xff, 0xdc, 0xd5, 0x9c, 0xff, 0xdd, 0xd6, 0x9d, 0xff, 0xf2, 0xe6, 0x97, 0xff, 0x22, 0x48, 0xdd, 0xff, 0x15, 0x3e, 0xe2, 0xff, 0x18, 0x42, 0xe1, 0xff, 0x19, 0x42, 0xe1, 0xff, 0x19, 0x43, 0xe2, 0xff, 0x19, 0x43, 0xe2, 0xff, 0x1a, 0x44, 0xe2, 0xff, 0x19, 0x44, 0xe2, 0xff, 0x19, 0x44, 0xe3, 0xff, 0x19, 0x44, 0xe3, 0xff, 0x14, 0x3e, 0xe0, 0xff, 0x5b, 0x8e, 0xff, 0xff, 0x1d, 0x48, 0xe4, 0xff, 0x19, 0x43, 0xe2, 0xff, 0x1a, 0x45, 0xe3, 0xff, 0x1a, 0x44, 0xe3, 0xff, 0x1a, 0x44, 0xe3, 0xff, 0x19, 0x44, 0xe3, 0xff, 0x19, 0x44, 0xe2, 0xff, 0x1a, 0x43, 0xe2, 0xff, 0x19, 0x43, 0xe2, 0xff, 0x19, 0x43, 0xe2, 0xff, 0x19, 0x42, 0xe1, 0xff, 0x18, 0x41, 0xe1, 0xff, 0x19, 0x41, 0xe1, 0xff, 0x01, 0x2e, 0xe8, 0xff, 0xd6, 0xd1, 0xa0, 0xff, 0xdf, 0xd8, 0x9c, 0xff, 0xdc, 0xd5, 0x9b, 0xff, 0xdc, 0xd4, 0x9a, 0xff, 0xdb, 0xd4, 0x98, 0xff, 0xda, 0xd3, 0x97, 0xff, 0xda, 0xd2, 0x95, 0xff, 0xda, 0xd2, 0x94, 0xff, 0xd9, 0xd1, 0x92, 0xff, 0xd9, 0xd0, 0x90, 0xff, 0xdb, 0xd3, 0x96, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd5, 0xcd, 0x87, 0xff, 0xd7, 0xcf, 0x8e, 0xff, 0xd7, 0xcf, 0x8d, 0xff, 0xd9, 0xd0, 0x90, 0xff, 0xd9, 0xd1, 0x93, 0xff, 0xda, 0xd2, 0x95, 0xff, 0xda, 0xd3, 0x96, 0xff, 0xdb, 0xd3, 0x98, 0xff, 0xdb, 0xd4, 0x99, 0xff, 0xdc, 0xd5, 0x9a, 0xff, 0xf0, 0xe5, 0x94, 0xff, 0x26, 0x49, 0xdb, 0xff, 0x13, 0x3c, 0xe1, 0xff, 0x18, 0x40, 0xe0, 0xff, 0x18, 0x40, 0xe0, 0xff, 0x19, 0x41, 0xe1, 0xff, 0x18, 0x41, 0xe1, 0xff, 0x18, 0x42, 0xe1, 0xff, 0x19, 0x42, 0xe1, 0xff, 0x19, 0x42, 0xe2, 0xff, 0x17, 0x40, 0xe0, 0xff, 0x2b, 0x57, 0xeb, 0xff, 0x59, 0x8b, 0xff, 0xff, 0x40, 0x6f, 0xf6, 0xff, 0x13, 0x3c, 0xdf, 0xff, 0x17, 0x40, 0xe0, 0xff, 0x19, 0x43, 0xe2, 0xff, 0x19, 0x42, 0xe2, 0xff, 0x19, 0x42, 0xe2, 0xff, 0x19, 0x42, 0xe1, 0xff, 0x17, 0x41, 0xe1, 0xff, 0x15, 0x3d, 0xdf, 0xff, 0x16, 0x3e, 0xdf, 0xff, 0x18, 0x40, 0xe0, 0xff, 0x18, 0x40, 0xe0, 0xff, 0x17, 0x3f, 0xe0, 0xff, 0x00, 0x2c, 0xe8, 0xff, 0xdc, 0xd5, 0x9b, 0xff, 0xde, 0xd6, 0x99, 0xff, 0xdb, 0xd4, 0x99, 0xff, 0xdb, 0xd3, 0x97, 0xff, 0xda, 0xd3, 0x96, 0xff, 0xda, 0xd2, 0x94, 0xff, 0xd9, 0xd1, 0x93, 0xff, 0xd9, 0xd1, 0x91, 0xff, 0xd8, 0xd0, 0x8f, 0xff, 0xd7, 0xcf, 0x8d, 0xff, 0xd9, 0xd3, 0x95, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd5, 0xcc, 0x87, 0xff, 0xd7, 0xce, 0x8a, 0xff, 0xd7, 0xcf, 0x8d, 0xff, 0xd8, 0xd0, 0x8f, 0xff, 0xd9, 0xd0, 0x90, 0xff, 0xd9, 0xd1, 0x92, 0xff, 0xda, 0xd2, 0x93, 0xff, 0xda, 0xd2, 0x95, 0xff, 0xe5, 0xda, 0x8f, 0xff, 0xea, 0xde, 0x8c, 0xff, 0xfa, 0xea, 0x88, 0xff, 0x5e, 0x72, 0xc0, 0xff, 0x09, 0x31, 0xdf, 0xff, 0x12, 0x38, 0xdc, 0xff, 0x12, 0x39, 0xdc, 0xff, 0x12, 0x39, 0xdc, 0xff, 0x13, 0x3a, 0xdd, 0xff, 0x13, 0x3a, 0xdd, 0xff, 0x14, 0x3b, 0xde, 0xff, 0x18, 0x40, 0xe1, 0xff, 0x12, 0x39, 0xdd, 0xff, 0x4b, 0x7a, 0xfe, 0xff, 0x35, 0x61, 0xf1, 0xff, 0x58, 0x89, 0xff, 0xff, 0x1a, 0x43, 0xe1, 0xff, 0x2f, 0x5a, 0xed, 0xff, 0x14, 0x3c, 0xde, 0xff, 0x18, 0x40, 0xe1, 0xff, 0x14, 0x3b, 0xde, 0xff, 0x12, 0x39, 0xdd, 0xff, 0x1a, 0x42, 0xe1, 0xff, 0x3e, 0x6a, 0xf7, 0xff, 0x2b, 0x55, 0xeb, 0xff, 0x14, 0x3b, 0xde, 0xff, 0x17, 0x3e, 0xdf, 0xff, 0x15, 0x3b, 0xe0, 0xff, 0x15, 0x3c, 0xdf, 0xff, 0xff, 0xf5, 0x89, 0xff, 0xef, 0xe3, 0x90, 0xff, 0xe5, 0xdb, 0x92, 0xff, 0xda, 0xd2, 0x95, 0xff, 0xd9, 0xd2, 0x93, 0xff, 0xd9, 0xd1, 0x92, 0xff, 0xd8, 0xd0, 0x90, 0xff, 0xd8, 0xd0, 0x8e, 0xff, 0xd7, 0xcf, 0x8d, 0xff, 0xd7, 0xce, 0x8b, 0xff, 0xd9, 0xd1, 0x94, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd5, 0xcc, 0x87, 0xff, 0xd6, 0xcd, 0x87, 0xff, 0xd6, 0xce, 0x8b, 0xff, 0xd7, 0xcf, 0x8c, 0xff, 0xd7, 0xcf, 0x8e, 0xff, 0xd8, 0xd0, 0x8f, 0xff, 0xd8, 0xd1, 0x91, 0xff, 0xe3, 0xd8, 0x8b, 0xff, 0x7b, 0x94, 0xdb, 0xff, 0x51, 0x79, 0xfb, 0xff, 0x59, 0x7f, 0xf7, 0xff, 0x54, 0x7c, 0xf9, 0xff, 0x44, 0x70, 0xff, 0xff, 0x47, 0x73, 0xfe, 0xff, 0x48, 0x74, 0xfe, 0xff, 0x48, 0x75, 0xfe, 0xff, 0x49, 0x76, 0xfe, 0xff, 0x4a, 0x77, 0xff, 0xff, 0x3e, 0x6a, 0xf7, 0xff, 0x10, 0x36, 0xdb, 0xff, 0x1f, 0x48, 0xe4, 0xff, 0x56, 0x86, 0xff, 0xff, 0x0f, 0x36, 0xdb, 0xff, 0x3a, 0x66, 0xf4, 0xff, 0x44, 0x71, 0xfa, 0xff, 0x54, 0x83, 0xff, 0xff, 0x2a, 0x55, 0xeb, 0xff, 0x0f, 0x35, 0xda, 0xff, 0x46, 0x73, 0xfc, 0xff, 0x49, 0x77, 0xfe, 0xff, 0x4d, 0x7a, 0xff, 0xff, 0x4c, 0x79, 0xff, 0xff, 0x53, 0x80, 0xff, 0xff, 0x18, 0x3e, 0xdf, 0xff, 0x16, 0x3b, 0xde, 0xff, 0x16, 0x3b, 0xde, 0xff, 0x1d, 0x40, 0xdb, 0xff, 0x2c, 0x4b, 0xd5, 0xff, 0x1e, 0x40, 0xd9, 0xff, 0x7e, 0x8b, 0xb5, 0xff, 0xe3, 0xd9, 0x8e, 0xff, 0xd9, 0xd0, 0x90, 0xff, 0xd8, 0xd0, 0x8f, 0xff, 0xd8, 0xcf, 0x8d, 0xff, 0xd7, 0xcf, 0x8c, 0xff, 0xd7, 0xce, 0x8a, 0xff, 0xd6, 0xcd, 0x89, 0xff, 0xda, 0xd1, 0x93, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd4, 0xcb, 0x7e, 0xff, 0xd5, 0xcc, 0x86, 0xff, 0xd6, 0xcd, 0x88, 0xff, 0xd6, 0xce, 0x8a, 0xff, 0xd7, 0xce, 0x8b, 0xff, 0xd7, 0xcf, 0x8d, 0xff, 0xd8, 0xcf, 0x8e, 0xff, 0xe8, 0xdc, 0x88, 0xff, 0x4a, 0x64, 0xd3, 0xff, 0x0b, 0x35, 0xf0, 0xff, 0x13, 0x3b, 0xed, 0xff, 0x15, 0x3e, 0xed, 0xff, 0x1a, 0x42, 0xeb, 0xff, 0x24, 0x4b, 0xe8, 0xff, 0x25, 0x4c, 0xe8, 0xff, 0x25, 0x4c, 0xe8, 0xff, 0x26, 0x4d, 0xe8, 0xff, 0x24, 0x4b, 0xe7, 0xff, 0x52, 0x7f, 0xff, 0xff, 0x1b, 0x41, 0xe1, 0xff, 0x3c, 0x67, 0xf6, 0xff, 0x38, 0x63, 0xf4, 0xff, 0x12, 0x38, 0xdc, 0xff, 0x15, 0x3b, 0xde, 0xff, 0x52, 0x7f, 0xff, 0xff, 0x41, 0x6d, 0xfa, 0xff, 0x4e, 0x7b, 0xff, 0xff, 0x2c, 0x55, 0xec, 0xff, 0x4b, 0x78, 0xff, 0xff, 0x21, 0x48, 0xe5, 0xff, 0x35, 0x5e, 0xf2, 0xff, 0x4e, 0x7b, 0xff, 0xff, 0x49, 0x75, 0xff, 0xff, 0x13, 0x37, 0xdc, 0xff, 0x15, 0x3a, 0xdd, 0xff, 0x10, 0x35, 0xdf, 0xff, 0x08, 0x2f, 0xe1, 0xff, 0x04, 0x2b, 0xe2, 0xff, 0x00, 0x21, 0xe6, 0xff, 0x6b, 0x7b, 0xba, 0xff, 0xe5, 0xda, 0x8a, 0xff, 0xd7, 0xcf, 0x8e, 0xff, 0xd7, 0xcf, 0x8c, 0xff, 0xd7, 0xce, 0x8b, 0xff, 0xd6, 0xcd, 0x89, 0xff, 0xd5, 0xcd, 0x88, 0xff, 0xd5, 0xcc, 0x86, 0xff, 0xd7, 0xce, 0x8a, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd4, 0xcc, 0x86, 0xff, 0xd4, 0xcc, 0x86, 0xff, 0xd5, 0xcc, 0x86, 0xff, 0xd5, 0xcd, 0x87, 0xff, 0xd6, 0xcd, 0x89, 0xff, 0xd6, 0xce, 0x8a, 0xff, 0xd7, 0xce, 0x8b, 0xff, 0xdf, 0xd5, 0x8a, 0xff, 0x92, 0x98, 0xa7, 0xff, 0x74, 0x81, 0xb3, 0xff, 0x78, 0x84, 0xb3, 0xff, 0x7b, 0x87, 0xb2, 0xff, 0x65, 0x75, 0xbb, 0xff, 0x02, 0x29, 0xe2, 0xff, 0x14, 0x37, 0xdb, 0xff, 0x13, 0x37, 0xdb, 0xff, 0x13, 0x38, 0xdc, 0xff, 0x10, 0x34, 0xda, 0xff, 0x30, 0x58, 0xf0, 0xff, 0x43, 0x6d, 0xfc, 0xff, 0x4e, 0x7b, 0xff, 0xff, 0x19, 0x3e, 0xe0, 0xff, 0x15, 0x3a, 0xdd, 0xff, 0x13, 0x37, 0xdb, 0xff, 0x34, 0x5d, 0xf2, 0xff, 0x10, 0x34, 0xda, 0xff, 0x3d, 0x67, 0xf8, 0xff, 0x50, 0x7d, 0xff, 0xff, 0x24, 0x4b, 0xe8, 0xff, 0x12, 0x36, 0xdb, 0xff, 0x11, 0x35, 0xda, 0xff, 0x1c, 0x41, 0xe2, 0xff, 0x13, 0x37, 0xdb, 0xff, 0x15, 0x38, 0xdc, 0xff, 0x0d, 0x32, 0xe0, 0xff, 0x3f, 0x59, 0xcc, 0xff, 0x81, 0x8c, 0xb2, 0xff, 0x7a, 0x86, 0xb4, 0xff, 0x74, 0x81, 0xb5, 0xff, 0xa7, 0xa9, 0xa1, 0xff, 0xdd, 0xd4, 0x8a, 0xff, 0xd7, 0xce, 0x8b, 0xff, 0xd6, 0xce, 0x8a, 0xff, 0xd6, 0xcd, 0x88, 0xff, 0xd5, 0xcc, 0x87, 0xff, 0xd5, 0xcc, 0x85, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd7, 0xcf, 0x84, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd0, 0xc6, 0x78, 0xff, 0xd4, 0xc9, 0x81, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd5, 0xcb, 0x84, 0xff, 0xd5, 0xcc, 0x86, 0xff, 0xd6, 0xcd, 0x87, 0xff, 0xd6, 0xcd, 0x89, 0xff, 0xd6, 0xce, 0x8a, 0xff, 0xdf, 0xd5, 0x88, 0xff, 0xe3, 0xd8, 0x88, 0xff, 0xe3, 0xd8, 0x89, 0xff, 0xe4, 0xd9, 0x8a, 0xff, 0xf7, 0xe8, 0x84, 0xff, 0x3d, 0x56, 0xcc, 0xff, 0x0b, 0x30, 0xdf, 0xff, 0x15, 0x38, 0xdc, 0xff, 0x15, 0x38, 0xdc, 0xff, 0x15, 0x38, 0xdc, 0xff, 0x12, 0x35, 0xda, 0xff, 0x4b, 0x76, 0xff, 0xff, 0x3c, 0x64, 0xf9, 0xff, 0x10, 0x33, 0xd9, 0xff, 0x16, 0x39, 0xdd, 0xff, 0x16, 0x3a, 0xdd, 0xff, 0x13, 0x36, 0xdb, 0xff, 0x14, 0x38, 0xdc, 0xff, 0x17, 0x3b, 0xde, 0xff, 0x45, 0x70, 0xff, 0xff, 0x0f, 0x32, 0xd8, 0xff, 0x15, 0x39, 0xdc, 0xff, 0x15, 0x38, 0xdc, 0xff, 0x14, 0x37, 0xdb, 0xff, 0x14, 0x37, 0xdc, 0xff, 0x12, 0x35, 0xdc, 0xff, 0x03, 0x29, 0xe2, 0xff, 0xea, 0xde, 0x88, 0xff, 0xe5, 0xda, 0x89, 0xff, 0xe3, 0xd8, 0x89, 0xff, 0xe3, 0xd8, 0x88, 0xff, 0xdd, 0xd3, 0x89, 0xff, 0xd6, 0xce, 0x8a, 0xff, 0xd6, 0xcd, 0x88, 0xff, 0xd5, 0xcd, 0x87, 0xff, 0xd5, 0xcc, 0x86, 0xff, 0xd5, 0xcb, 0x84, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd4, 0xcc, 0x83, 0xff, 0xd5, 0xcc, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd1, 0xc6, 0x79, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd4, 0xca, 0x82, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd4, 0xcb, 0x84, 0xff, 0xd5, 0xcc, 0x86, 0xff, 0xd5, 0xcd, 0x87, 0xff, 0xd6, 0xcd, 0x88, 0xff, 0xd6, 0xce, 0x89, 0xff, 0xd7, 0xce, 0x8b, 0xff, 0xd7, 0xce, 0x8b, 0xff, 0xda, 0xd1, 0x8b, 0xff, 0xe1, 0xd6, 0x8a, 0xff, 0x09, 0x2d, 0xdf, 0xff, 0x11, 0x33, 0xdc, 0xff, 0x14, 0x36, 0xdb, 0xff, 0x15, 0x37, 0xdb, 0xff, 0x11, 0x33, 0xd9, 0xff, 0x2f, 0x55, 0xf0, 0xff, 0x22, 0x46, 0xe6, 0xff, 0x13, 0x36, 0xdb, 0xff, 0x15, 0x38, 0xdc, 0xff, 0x15, 0x38, 0xdc, 0xff, 0x15, 0x38, 0xdc, 0xff, 0x15, 0x38, 0xdc, 0xff, 0x13, 0x36, 0xdb, 0xff, 0x13, 0x36, 0xdb, 0xff, 0x14, 0x37, 0xdb, 0xff, 0x15, 0x37, 0xdb, 0xff, 0x15, 0x37, 0xdb, 0xff, 0x14, 0x36, 0xdb, 0xff, 0x14, 0x36, 0xdb, 0xff, 0x00, 0x1f, 0xe6, 0xff, 0xb0, 0xb0, 0x9d, 0xff, 0xe0, 0xd6, 0x89, 0xff, 0xd7, 0xce, 0x8b, 0xff, 0xd6, 0xce, 0x8a, 0xff, 0xd6, 0xcd, 0x89, 0xff, 0xd6, 0xcd, 0x88, 0xff, 0xd5, 0xcc, 0x87, 0xff, 0xd5, 0xcc, 0x86, 0xff, 0xd4, 0xcb, 0x84, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd3, 0xca, 0x81, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd5, 0xcb, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd0, 0xc5, 0x78, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd4, 0xca, 0x82, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd5, 0xcb, 0x85, 0xff, 0xd5, 0xcc, 0x86, 0xff, 0xd5, 0xcc, 0x87, 0xff, 0xd6, 0xcd, 0x88, 0xff, 0xd6, 0xcd, 0x89, 0xff, 0xd6, 0xce, 0x8a, 0xff, 0xdf, 0xd4, 0x87, 0xff, 0xc1, 0xbd, 0x94, 0xff, 0x00, 0x1f, 0xe4, 0xff, 0x12, 0x34, 0xdb, 0xff, 0x13, 0x35, 0xda, 0xff, 0x13, 0x35, 0xda, 0xff, 0x14, 0x35, 0xdb, 0xff, 0x13, 0x34, 0xda, 0xff, 0x14, 0x36, 0xdb, 0xff, 0x14, 0x36, 0xdb, 0xff, 0x14, 0x36, 0xdb, 0xff, 0x14, 0x36, 0xdb, 0xff, 0x14, 0x36, 0xdb, 0xff, 0x14, 0x36, 0xdb, 0xff, 0x14, 0x35, 0xdb, 0xff, 0x14, 0x35, 0xdb, 0xff, 0x14, 0x35, 0xda, 0xff, 0x13, 0x35, 0xda, 0xff, 0x14, 0x34, 0xda, 0xff, 0x00, 0x22, 0xe3, 0xff, 0x79, 0x84, 0xb1, 0xff, 0xea, 0xdd, 0x83, 0xff, 0xd6, 0xcd, 0x89, 0xff, 0xd6, 0xcd, 0x89, 0xff, 0xd6, 0xcd, 0x87, 0xff, 0xd5, 0xcc, 0x87, 0xff, 0xd5, 0xcc, 0x85, 0xff, 0xd4, 0xcb, 0x84, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd3, 0xca, 0x82, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd7, 0xce, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd0, 0xc5, 0x79, 0xff, 0xd0, 0xc7, 0x74, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd4, 0xca, 0x82, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd4, 0xcb, 0x84, 0xff, 0xd5, 0xcc, 0x85, 0xff, 0xd5, 0xcc, 0x86, 0xff, 0xd5, 0xcc, 0x87, 0xff, 0xd6, 0xcd, 0x88, 0xff, 0xe4, 0xd8, 0x83, 0xff, 0xa3, 0xa5, 0x9e, 0xff, 0x00, 0x1e, 0xe4, 0xff, 0x12, 0x32, 0xda, 0xff, 0x13, 0x33, 0xd9, 0xff, 0x13, 0x33, 0xd9, 0xff, 0x13, 0x34, 0xda, 0xff, 0x13, 0x34, 0xda, 0xff, 0x13, 0x34, 0xda, 0xff, 0x13, 0x34, 0xda, 0xff, 0x13, 0x34, 0xda, 0xff, 0x13, 0x34, 0xda, 0xff, 0x13, 0x34, 0xda, 0xff, 0x13, 0x34, 0xda, 0xff, 0x13, 0x33, 0xda, 0xff, 0x13, 0x33, 0xd9, 0xff, 0x13, 0x33, 0xd9, 0xff, 0x00, 0x24, 0xe1, 0xff, 0x58, 0x69, 0xbd, 0xff, 0xef, 0xe1, 0x7e, 0xff, 0xd5, 0xcd, 0x87, 0xff, 0xd5, 0xcc, 0x87, 0xff, 0xd5, 0xcc, 0x86, 0xff, 0xd5, 0xcc, 0x85, 0xff, 0xd4, 0xcb, 0x84, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd4, 0xca, 0x81, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd2, 0xc8, 0x7a, 0xff, 0xd5, 0xcc, 0x84, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd0, 0xc5, 0x79, 0xff, 0xd0, 0xc5, 0x76, 0xff, 0xd1, 0xc6, 0x79, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd3, 0xca, 0x81, 0xff, 0xd4, 0xca, 0x82, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd4, 0xcb, 0x84, 0xff, 0xd5, 0xcb, 0x85, 0xff, 0xd5, 0xcc, 0x85, 0xff, 0xe7, 0xda, 0x7f, 0xff, 0x93, 0x97, 0xa2, 0xff, 0x00, 0x1c, 0xe4, 0xff, 0x12, 0x31, 0xd9, 0xff, 0x13, 0x32, 0xd9, 0xff, 0x13, 0x32, 0xd9, 0xff, 0x13, 0x32, 0xd9, 0xff, 0x12, 0x32, 0xd9, 0xff, 0x12, 0x32, 0xd9, 0xff, 0x12, 0x32, 0xd9, 0xff, 0x12, 0x32, 0xd9, 0xff, 0x13, 0x32, 0xd9, 0xff, 0x13, 0x32, 0xd9, 0xff, 0x13, 0x32, 0xd9, 0xff, 0x12, 0x31, 0xd8, 0xff, 0x00, 0x22, 0xe0, 0xff, 0x4c, 0x5e, 0xc0, 0xff, 0xf0, 0xe1, 0x7b, 0xff, 0xd5, 0xcc, 0x85, 0xff, 0xd5, 0xcb, 0x84, 0xff, 0xd4, 0xcb, 0x84, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xd4, 0xca, 0x82, 0xff, 0xd3, 0xca, 0x81, 0xff, 0xd3, 0xc9, 0x80, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd2, 0xc8, 0x7d, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd0, 0xc7, 0x78, 0xff, 0xd5, 0xcc, 0x84, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xcb, 0x76, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd1, 0xc6, 0x79, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd2, 0xc8, 0x7d, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd3, 0xca, 0x81, 0xff, 0xd3, 0xca, 0x82, 0xff, 0xd4, 0xcb, 0x82, 0xff, 0xd4, 0xcb, 0x83, 0xff, 0xe6, 0xd9, 0x7c, 0xff, 0xa2, 0xa3, 0x9a, 0xff, 0x00, 0x18, 0xe4, 0xff, 0x0f, 0x2e, 0xd8, 0xff, 0x12, 0x30, 0xd8, 0xff, 0x12, 0x30, 0xd8, 0xff, 0x12, 0x30, 0xd8, 0xff, 0x12, 0x30, 0xd8, 0xff, 0x12, 0x30, 0xd8, 0xff, 0x12, 0x30, 0xd8, 0xff, 0x12, 0x30, 0xd8, 0xff, 0x12, 0x30, 0xd8, 0xff, 0x11, 0x30, 0xd8, 0xff, 0x00, 0x1d, 0xe1, 0xff, 0x57, 0x67, 0xba, 0xff, 0xef, 0xe0, 0x78, 0xff, 0xd4, 0xcb, 0x82, 0xff, 0xd4, 0xca, 0x82, 0xff, 0xd4, 0xca, 0x82, 0xff, 0xd3, 0xca, 0x81, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd2, 0xc8, 0x7d, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xcf, 0xc6, 0x77, 0xff, 0xcf, 0xc8, 0x7b, 0xff, 0xd2, 0xcb, 0x83, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xc5, 0x75, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc5, 0x75, 0xff, 0xcf, 0xc5, 0x76, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd1, 0xc7, 0x79, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd2, 0xc8, 0x7b, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd2, 0xc8, 0x7d, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd3, 0xc9, 0x80, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xe2, 0xd6, 0x7b, 0xff, 0xb8, 0xb4, 0x8e, 0xff, 0x00, 0x1e, 0xdf, 0xff, 0x0b, 0x29, 0xd9, 0xff, 0x11, 0x2e, 0xd7, 0xff, 0x11, 0x2e, 0xd7, 0xff, 0x11, 0x2e, 0xd7, 0xff, 0x11, 0x2e, 0xd7, 0xff, 0x11, 0x2e, 0xd7, 0xff, 0x11, 0x2e, 0xd7, 0xff, 0x0f, 0x2d, 0xd7, 0xff, 0x00, 0x17, 0xe3, 0xff, 0x78, 0x80, 0xa9, 0xff, 0xed, 0xde, 0x76, 0xff, 0xd3, 0xca, 0x80, 0xff, 0xd3, 0xc9, 0x80, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0xd2, 0xc9, 0x7f, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd2, 0xc8, 0x7d, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd1, 0xc7, 0x79, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xcf, 0xc5, 0x76, 0xff, 0xcf, 0xc4, 0x73, 0xff, 0xcf, 0xc4, 0x73, 0xff, 0xcf, 0xc4, 0x73, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xc0, 0x6a, 0xff, 0xcf, 0xc6, 0x6f, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xcf, 0xc5, 0x74, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc6, 0x79, 0xff, 0xd1, 0xc7, 0x79, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd2, 0xc8, 0x7d, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xdc, 0xd1, 0x7a, 0xff, 0xd3, 0xc9, 0x7f, 0xff, 0x19, 0x33, 0xd2, 0xff, 0x02, 0x21, 0xdc, 0xff, 0x10, 0x2c, 0xd6, 0xff, 0x11, 0x2c, 0xd6, 0xff, 0x11, 0x2c, 0xd6, 0xff, 0x10, 0x2c, 0xd6, 0xff, 0x0a, 0x27, 0xd9, 0xff, 0x00, 0x1b, 0xdf, 0xff, 0xa5, 0xa4, 0x93, 0xff, 0xe6, 0xd9, 0x76, 0xff, 0xd2, 0xc9, 0x7e, 0xff, 0xd2, 0xc8, 0x7d, 0xff, 0xd2, 0xc8, 0x7d, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd2, 0xc8, 0x7c, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd1, 0xc7, 0x79, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xd0, 0xc6, 0x76, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xcf, 0xc5, 0x74, 0xff, 0xcf, 0xc4, 0x73, 0xff, 0xcf, 0xc3, 0x73, 0xff, 0xcf, 0xc4, 0x74, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xc0, 0x6b, 0xff, 0xcd, 0xc3, 0x6f, 0xff, 0xce, 0xc3, 0x70, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xcf, 0xc5, 0x74, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xcf, 0xc5, 0x76, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd1, 0xc7, 0x79, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd1, 0xc8, 0x7b, 0xff, 0xd6, 0xcb, 0x7a, 0xff, 0xea, 0xdb, 0x71, 0xff, 0x57, 0x64, 0xb4, 0xff, 0x00, 0x15, 0xe1, 0xff, 0x0b, 0x27, 0xd7, 0xff, 0x0e, 0x29, 0xd6, 0xff, 0x00, 0x1b, 0xde, 0xff, 0x23, 0x3a, 0xcc, 0xff, 0xd3, 0xc9, 0x7c, 0xff, 0xdd, 0xd1, 0x77, 0xff, 0xd1, 0xc8, 0x7b, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd1, 0xc7, 0x7b, 0xff, 0xd1, 0xc7, 0x7a, 0xff, 0xd1, 0xc7, 0x79, 0xff, 0xd1, 0xc6, 0x79, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xd0, 0xc6, 0x76, 0xff, 0xcf, 0xc5, 0x76, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xcf, 0xc4, 0x74, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xce, 0xc4, 0x71, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc4, 0x71, 0xff, 0xcf, 0xc4, 0x73, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xc0, 0x6a, 0xff, 0xca, 0xc0, 0x6a, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcd, 0xc2, 0x6f, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xcf, 0xc4, 0x74, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xd0, 0xc5, 0x76, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc6, 0x79, 0xff, 0xd1, 0xc7, 0x79, 0xff, 0xd2, 0xc7, 0x79, 0xff, 0xe6, 0xd8, 0x70, 0xff, 0xb1, 0xac, 0x89, 0xff, 0x12, 0x2c, 0xd2, 0xff, 0x00, 0x17, 0xde, 0xff, 0x80, 0x85, 0x9f, 0xff, 0xeb, 0xdc, 0x6e, 0xff, 0xd4, 0xca, 0x77, 0xff, 0xd1, 0xc7, 0x79, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc6, 0x78, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xd0, 0xc6, 0x77, 0xff, 0xd0, 0xc5, 0x76, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xcf, 0xc5, 0x74, 0xff, 0xcf, 0xc4, 0x74, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc2, 0x6f, 0xff, 0xcc, 0xc2, 0x6e, 0xff, 0xcf, 0xc3, 0x70, 0xff, 0xcd, 0xc2, 0x71, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xc0, 0x6a, 0xff, 0xcc, 0xc1, 0x6b, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcd, 0xc3, 0x6f, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xcf, 0xc4, 0x73, 0xff, 0xcf, 0xc4, 0x74, 0xff, 0xcf, 0xc5, 0x74, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xcf, 0xc5, 0x76, 0xff, 0xd0, 0xc5, 0x76, 0xff, 0xd0, 0xc5, 0x76, 0xff, 0xd0, 0xc6, 0x76, 0xff, 0xd7, 0xcb, 0x73, 0xff, 0xe1, 0xd3, 0x6f, 0xff, 0xd3, 0xc8, 0x76, 0xff, 0xdc, 0xd0, 0x71, 0xff, 0xd0, 0xc6, 0x76, 0xff, 0xd0, 0xc5, 0x76, 0xff, 0xcf, 0xc5, 0x76, 0xff, 0xcf, 0xc5, 0x76, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xcf, 0xc5, 0x75, 0xff, 0xcf, 0xc5, 0x74, 0xff, 0xcf, 0xc4, 0x74, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc3, 0x6f, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc1, 0x6d, 0xff, 0xcc, 0xc2, 0x70, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xbc, 0x60, 0xff, 0xcf, 0xc7, 0x67, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcd, 0xc2, 0x6f, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xce, 0xc4, 0x71, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xcf, 0xc4, 0x73, 0xff, 0xcf, 0xc4, 0x74, 0xff, 0xcf, 0xc4, 0x74, 0xff, 0xcf, 0xc5, 0x73, 0xff, 0xd0, 0xc6, 0x73, 0xff, 0xcf, 0xc4, 0x74, 0xff, 0xcf, 0xc4, 0x73, 0xff, 0xcf, 0xc4, 0x73, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xce, 0xc4, 0x73, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc4, 0x72, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc2, 0x6f, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6a, 0xff, 0xcb, 0xc1, 0x6c, 0xff, 0xcd, 0xc2, 0x71, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xc1, 0x62, 0xff, 0xcc, 0xc0, 0x67, 0xff, 0xca, 0xc0, 0x68, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xcb, 0xc0, 0x6a, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcc, 0xc1, 0x6b, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcd, 0xc2, 0x6f, 0xff, 0xcd, 0xc3, 0x6f, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xce, 0xc3, 0x71, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc3, 0x70, 0xff, 0xcd, 0xc3, 0x6f, 0xff, 0xcd, 0xc3, 0x6f, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6a, 0xff, 0xcb, 0xc0, 0x6a, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xcb, 0xbf, 0x69, 0xff, 0xce, 0xc4, 0x71, 0xff, 0xcc, 0xc2, 0x70, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xbc, 0x60, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xca, 0xbf, 0x66, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xc0, 0x68, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xcb, 0xc0, 0x6a, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcc, 0xc1, 0x6b, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcd, 0xc2, 0x6e, 0xff, 0xcc, 0xc2, 0x6e, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc2, 0x6d, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc1, 0x6c, 0xff, 0xcc, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcb, 0xc0, 0x6a, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xcb, 0xc0, 0x68, 0xff, 0xca, 0xbf, 0x68, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xbf, 0x66, 0xff, 0xcb, 0xbf, 0x6d, 0xff, 0xcc, 0xc2, 0x70, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xbc, 0x60, 0xff, 0xc9, 0xbe, 0x63, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xca, 0xbf, 0x66, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xbf, 0x68, 0xff, 0xcb, 0xc0, 0x68, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xcb, 0xc0, 0x6a, 0xff, 0xcb, 0xc0, 0x6a, 0xff, 0xcb, 0xc1, 0x6a, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6b, 0xff, 0xcb, 0xc1, 0x6a, 0xff, 0xcb, 0xc0, 0x6a, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xcb, 0xc0, 0x69, 0xff, 0xca, 0xc0, 0x68, 0xff, 0xca, 0xc0, 0x68, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xbf, 0x66, 0xff, 0xca, 0xbf, 0x65, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x66, 0xff, 0xcc, 0xc2, 0x70, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc9, 0xbe, 0x63, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbf, 0x65, 0xff, 0xca, 0xbf, 0x66, 0xff, 0xca, 0xbf, 0x66, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xc0, 0x67, 0xff, 0xca, 0xbf, 0x68, 0xff, 0xca, 0xc0, 0x68, 0xff, 0xca, 0xc0, 0x68, 0xff, 0xca, 0xc0, 0x68, 0xff, 0xca, 0xc0, 0x68, 0xff, 0xca, 0xbf, 0x68, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xbf, 0x67, 0xff, 0xca, 0xbf, 0x66, 0xff, 0xca, 0xbf, 0x66, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x63, 0xff, 0xc9, 0xbd, 0x63, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc9, 0xbe, 0x68, 0xff, 0xcc, 0xc2, 0x70, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xbc, 0x60, 0xff, 0xc8, 0xbc, 0x60, 0xff, 0xc8, 0xbc, 0x60, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc9, 0xbe, 0x63, 0xff, 0xc9, 0xbe, 0x63, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x65, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x64, 0xff, 0xc9, 0xbe, 0x63, 0xff, 0xc9, 0xbe, 0x63, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbc, 0x60, 0xff, 0xcb, 0xc0, 0x61, 0xff, 0xca, 0xbc, 0x66, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xbc, 0x60, 0xff, 0xcc, 0xc2, 0x60, 0xff, 0xc7, 0xbb, 0x5e, 0xff, 0xc7, 0xbc, 0x5e, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x60, 0xff, 0xc8, 0xbc, 0x60, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x61, 0xff, 0xc8, 0xbd, 0x60, 0xff, 0xc8, 0xbc, 0x60, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5e, 0xff, 0xc8, 0xbc, 0x62, 0xff, 0xc9, 0xbe, 0x63, 0xff, 0xc8, 0xbc, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbc, 0x60, 0xff, 0xc7, 0xbd, 0x5d, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xbb, 0x5d, 0xff, 0xc7, 0xbb, 0x5d, 0xff, 0xc7, 0xbb, 0x5e, 0xff, 0xc7, 0xbc, 0x5e, 0xff, 0xc7, 0xbc, 0x5e, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5e, 0xff, 0xc7, 0xbc, 0x5e, 0xff, 0xc7, 0xbc, 0x5e, 0xff, 0xc7, 0xbb, 0x5e, 0xff, 0xc7, 0xbb, 0x5d, 0xff, 0xc6, 0xbb, 0x5d, 0xff, 0xc7, 0xbb, 0x5c, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x61, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc5, 0xbc, 0x5c, 0xff, 0xc6, 0xba, 0x5b, 0xff, 0xc6, 0xba, 0x5b, 0xff, 0xc6, 0xba, 0x5b, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xbb, 0x5c, 0xff, 0xc6, 0xba, 0x5b, 0xff, 0xc6, 0xba, 0x5b, 0xff, 0xc6, 0xba, 0x5b, 0xff, 0xc5, 0xba, 0x5a, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x63, 0xff, 0xc8, 0xbd, 0x62, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbc, 0x5f, 0xff, 0xc7, 0xbb, 0x60, 0xff, 0xc6, 0xbc, 0x5f, 0xff, 0xc7, 0xbc, 0x5b, 0xff, 0xc5, 0xbc, 0x5c, 0xff, 0xc5, 0xb9, 0x59, 0xff, 0xc5, 0xb9, 0x59, 0xff, 0xc5, 0xba, 0x59, 0xff, 0xc5, 0xba, 0x59, 0xff, 0xc5, 0xba, 0x59, 0xff, 0xc5, 0xba, 0x59, 0xff, 0xc5, 0xba, 0x59, 0xff, 0xc5, 0xba, 0x59, 0xff, 0xc5, 0xb9, 0x59, 0xff, 0xc5, 0xb9, 0x59, 0xff, 0xc5, 0xb9, 0x59, 0xff, 0xc8, 0xbd, 0x5c, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0xc7, 0xbb, 0x60, 0xff, 0xc7, 0xbc, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbb, 0x5e, 0xff, 0xc7, 0xbc, 0x5e, 0xff, 0xc7, 0xba, 0x5d, 0xff, 0xc6, 0xbb, 0x5d, 0xff, 0xc7, 0xbb, 0x5e, 0xff, 0xc7, 0xbb, 0x5e, 0xff, 0xc7, 0xba, 0x5e, 0xff, 0xc7, 0xba, 0x5e, 0xff, 0xc6, 0xbb, 0x5e, 0xff, 0xc7, 0xba, 0x5d, 0xff, 0xc7, 0xba, 0x5d, 0xff, 0xc6, 0xba, 0x5d, 0xff, 0xc7, 0xbb, 0x5e, 0xff, 0xc4, 0xb8, 0x5d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t heart_rate = {
-  .header.always_zero = 0,
-  .header.w = 50,
-  .header.h = 50,
-  .data_size = 2500 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = heart_rate_map,
-};
-
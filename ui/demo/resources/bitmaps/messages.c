@@ -1,250 +0,0 @@
-/**
- ****************************************************************************************
- *
- * @file messages.c
- *
- * @brief Messages source file
- *
- * Copyright (C) 2021-2022 Dialog Semiconductor.
- * This computer program includes Confidential, Proprietary Information
- * of Dialog Semiconductor. All Rights Reserved.
- *
- ****************************************************************************************
- */
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_MESSAGES
-#define LV_ATTRIBUTE_IMG_MESSAGES
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_MESSAGES uint8_t messages_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb4, 0xff, 0xb8, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xb8, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xb8, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xb8, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xb8, 0xff, 0xb4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xd8, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb8, 0xff, 0xb4, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xd8, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xd4, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xd8, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0x94, 0xff, 0xd4, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xd8, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0x94, 0xff, 0xd4, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xd8, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0xd4, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb4, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xd4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xb4, 0xff, 0xd4, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0x94, 0xff, 0xb4, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x94, 0xff, 0x94, 0xff, 0x74, 0xff, 0xb4, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0x70, 0xff, 0xb4, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xb4, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x8d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x2d, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xec, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xec, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfe, 0xff, 0xa9, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcc, 0xfe, 0xff, 0xcc, 0xfe, 0xff, 0xcc, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xcc, 0xfe, 0xff, 0xcc, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xab, 0xfe, 0xff, 0x65, 0xde, 0xff, 0x42, 0xc6, 0xff, 0x41, 0xc6, 0xff, 0x41, 0xc6, 0xff, 0x41, 0xc6, 0xff, 0x61, 0xc6, 0xff, 0x61, 0xc6, 0xff, 0x61, 0xce, 0xff, 0x61, 0xce, 0xff, 0x61, 0xce, 0xff, 0x61, 0xce, 0xff, 0x61, 0xce, 0xff, 0x61, 0xce, 0xff, 0x61, 0xce, 0xff, 0x61, 0xce, 0xff, 0x61, 0xce, 0xff, 0x61, 0xce, 0xff, 0x61, 0xc6, 0xff, 0x61, 0xc6, 0xff, 0x61, 0xc6, 0xff, 0x41, 0xc6, 0xff, 0x41, 0xc6, 0xff, 0x41, 0xc6, 0xff, 0x64, 0xd6, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfe, 0xff, 0xa9, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xb6, 0xff, 0x00, 0xae, 0xff, 0x88, 0xf6, 0xff, 0x8a, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x01, 0xbe, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0xe0, 0xad, 0xff, 0x8a, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x67, 0xf6, 0xff, 0xe0, 0xad, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0xe0, 0xad, 0xff, 0x25, 0xde, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x69, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x25, 0xde, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xad, 0xff, 0x03, 0xce, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x68, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x25, 0xde, 0xff, 0xc0, 0xa5, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0x03, 0xc6, 0xff, 0x69, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x05, 0xde, 0xff, 0xc0, 0xa5, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xa5, 0xff, 0xe3, 0xc5, 0xff, 0x49, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x05, 0xde, 0xff, 0xa0, 0xa5, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xa0, 0xa5, 0xff, 0x80, 0xa5, 0xff, 0xa0, 0xa5, 0xff, 0xc0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xa0, 0xa5, 0xff, 0xac, 0xd6, 0xff, 0x9b, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xf1, 0xde, 0xff, 0xc0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xa0, 0xa5, 0xff, 0x80, 0xa5, 0xff, 0xa0, 0xa5, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xa0, 0xa5, 0xff, 0xe2, 0xc5, 0xff, 0x49, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 
-  0x46, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0xe4, 0xd5, 0xff, 0x80, 0x9d, 0xff, 0xa0, 0xa5, 0xff, 0xa0, 0xa5, 0xff, 0xa0, 0xa5, 0xff, 0x57, 0xef, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xf7, 0xff, 0xc1, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xa0, 0xa5, 0xff, 0xf1, 0xde, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0xff, 0xa0, 0xa5, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xa0, 0xa5, 0xff, 0x36, 0xef, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xe2, 0xad, 0xff, 0xa0, 0xa5, 0xff, 0xa0, 0xa5, 0xff, 0xa0, 0xa5, 0xff, 0xc2, 0xc5, 0xff, 0x49, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 
-  0x46, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0xe4, 0xd5, 0xff, 0x80, 0x9d, 0xff, 0xa0, 0xa5, 0xff, 0x60, 0x9d, 0xff, 0x35, 0xef, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0xff, 0x80, 0xa5, 0xff, 0xa0, 0xad, 0xff, 0xa0, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xbe, 0xff, 0xa0, 0xa5, 0xff, 0x80, 0xa5, 0xff, 0xf2, 0xde, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xff, 0xff, 0x60, 0x9d, 0xff, 0xa0, 0xa5, 0xff, 0x80, 0x9d, 0xff, 0xc2, 0xbd, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe6, 0xfd, 0xff, 
-  0x46, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0xe4, 0xd5, 0xff, 0x60, 0x9d, 0xff, 0x80, 0xa5, 0xff, 0x40, 0x9d, 0xff, 0xbc, 0xff, 0xff, 0xde, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x9d, 0xff, 0xa0, 0xa5, 0xff, 0xe4, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xce, 0xff, 0x80, 0xa5, 0xff, 0x60, 0x9d, 0xff, 0x9a, 0xf7, 0xff, 0xde, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x9d, 0xff, 0x80, 0xa5, 0xff, 0x80, 0x9d, 0xff, 0xa2, 0xbd, 0xff, 0x28, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 
-  0x46, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0xc4, 0xd5, 0xff, 0x60, 0x95, 0xff, 0x80, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x13, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xf7, 0xff, 0x60, 0x9d, 0xff, 0x80, 0xa5, 0xff, 0x80, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xb6, 0xff, 0x80, 0xa5, 0xff, 0x60, 0x9d, 0xff, 0xd0, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0x40, 0x95, 0xff, 0x80, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0xa2, 0xbd, 0xff, 0x28, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 
-  0x26, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xc4, 0xd5, 0xff, 0x40, 0x95, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x40, 0x95, 0xff, 0x14, 0xe7, 0xff, 0xdd, 0xff, 0xff, 0x36, 0xef, 0xff, 0x60, 0x9d, 0xff, 0x80, 0xa5, 0xff, 0x80, 0xa5, 0xff, 0x60, 0x9d, 0xff, 0x8e, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xef, 0xff, 0x40, 0x95, 0xff, 0x80, 0xa5, 0xff, 0x80, 0xa5, 0xff, 0x40, 0x9d, 0xff, 0xd1, 0xde, 0xff, 0xdd, 0xff, 0xff, 0x57, 0xef, 0xff, 0x80, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x95, 0xff, 0x82, 0xbd, 0xff, 0x08, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 
-  0x46, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0xa4, 0xd5, 0xff, 0x40, 0x95, 0xff, 0x40, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x40, 0x95, 0xff, 0x20, 0x95, 0xff, 0x40, 0x95, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x80, 0x9d, 0xff, 0x40, 0x95, 0xff, 0x28, 0xbe, 0xff, 0x57, 0xef, 0xff, 0x58, 0xf7, 0xff, 0x8d, 0xce, 0xff, 0x40, 0x95, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x40, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x40, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x95, 0xff, 0x82, 0xbd, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 
-  0x00, 0x00, 0x00, 0xa6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xa4, 0xd5, 0xff, 0x20, 0x8d, 0xff, 0x40, 0x95, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x40, 0x95, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x62, 0xb5, 0xff, 0x07, 0xfe, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 
-  0x00, 0x00, 0x00, 0xa6, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0x84, 0xcd, 0xff, 0x20, 0x8d, 0xff, 0x20, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x9d, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x8d, 0xff, 0x62, 0xb5, 0xff, 0xe7, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa5, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0x84, 0xd5, 0xff, 0x00, 0x8d, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x40, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x00, 0x8d, 0xff, 0x42, 0xb5, 0xff, 0xe7, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xa5, 0xed, 0xff, 0xe0, 0x84, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x00, 0x95, 0xff, 0x00, 0x85, 0xff, 0x83, 0xcd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0x21, 0x9d, 0xff, 0x00, 0x85, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x95, 0xff, 0x00, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x20, 0x95, 0xff, 0x00, 0x95, 0xff, 0x00, 0x95, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0xe0, 0x84, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe0, 0x8c, 0xff, 0xe0, 0x7c, 0xff, 0xe0, 0x84, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0xe0, 0x84, 0xff, 0xe0, 0x84, 0xff, 0xe0, 0x7c, 0xff, 0xa5, 0xf5, 0xff, 0xc6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0x63, 0xd5, 0xff, 0x21, 0xa5, 0xff, 0x01, 0xa5, 0xff, 0x21, 0xa5, 0xff, 0x21, 0xa5, 0xff, 0x01, 0x9d, 0xff, 0xe0, 0x8c, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0x00, 0x8d, 0xff, 0xe0, 0x84, 0xff, 0x00, 0x95, 0xff, 0x21, 0xa5, 0xff, 0x21, 0xa5, 0xff, 0x21, 0xa5, 0xff, 0x21, 0xa5, 0xff, 0x21, 0xa5, 0xff, 0x21, 0xa5, 0xff, 0x21, 0xa5, 0xff, 0x01, 0xa5, 0xff, 0x01, 0xa5, 0xff, 0x43, 0xc5, 0xff, 0xc6, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0x00, 0x95, 0xff, 0xe0, 0x84, 0xff, 0xe0, 0x8c, 0xff, 0xe0, 0x8c, 0xff, 0xe0, 0x84, 0xff, 0xc0, 0x7c, 0xff, 0x00, 0x95, 0xff, 0x84, 0xdd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x64, 0xdd, 0xff, 0xc0, 0x7c, 0xff, 0xc0, 0x84, 0xff, 0xc0, 0x84, 0xff, 0xc0, 0x74, 0xff, 0xe1, 0x94, 0xff, 0x84, 0xe5, 0xff, 0xc6, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xc0, 0x8c, 0xff, 0xa0, 0x7c, 0xff, 0xa0, 0x74, 0xff, 0xe1, 0x9c, 0xff, 0x84, 0xed, 0xff, 0xc6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x43, 0xd5, 0xff, 0x80, 0x64, 0xff, 0xe1, 0x9c, 0xff, 0x84, 0xf5, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x83, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xe2, 0xac, 0xff, 0x64, 0xf5, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x83, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x6e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x6d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x8d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x2d, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xfe, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xfe, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x2c, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xfe, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xca, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xaa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xaa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xa9, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x69, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x89, 0xff, 0xfe, 0xa9, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcc, 0xff, 0xfe, 0xcc, 0xff, 0xfe, 0xcc, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xcc, 0xff, 0xfe, 0xcc, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x69, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x89, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xab, 0xff, 0xde, 0x65, 0xff, 0xc6, 0x42, 0xff, 0xc6, 0x41, 0xff, 0xc6, 0x41, 0xff, 0xc6, 0x41, 0xff, 0xc6, 0x61, 0xff, 0xc6, 0x61, 0xff, 0xce, 0x61, 0xff, 0xce, 0x61, 0xff, 0xce, 0x61, 0xff, 0xce, 0x61, 0xff, 0xce, 0x61, 0xff, 0xce, 0x61, 0xff, 0xce, 0x61, 0xff, 0xce, 0x61, 0xff, 0xce, 0x61, 0xff, 0xce, 0x61, 0xff, 0xc6, 0x61, 0xff, 0xc6, 0x61, 0xff, 0xc6, 0x61, 0xff, 0xc6, 0x41, 0xff, 0xc6, 0x41, 0xff, 0xc6, 0x41, 0xff, 0xd6, 0x64, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x69, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x89, 0xff, 0xfe, 0xa9, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xb6, 0x20, 0xff, 0xae, 0x00, 0xff, 0xf6, 0x88, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x28, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x89, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x8a, 0xff, 0xbe, 0x01, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xbe, 0x00, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xad, 0xe0, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x27, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xf6, 0x67, 0xff, 0xad, 0xe0, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xad, 0xe0, 0xff, 0xde, 0x25, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x69, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xde, 0x25, 0xff, 0xad, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xce, 0x03, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x68, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x69, 0xff, 0xde, 0x25, 0xff, 0xa5, 0xc0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xc0, 0xff, 0xc6, 0x03, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x49, 0xff, 0xde, 0x05, 0xff, 0xa5, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xa5, 0xc0, 0xff, 0xc5, 0xe3, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x49, 0xff, 0xde, 0x05, 0xff, 0xa5, 0xa0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xa5, 0xa0, 0xff, 0xa5, 0x80, 0xff, 0xa5, 0xa0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xa5, 0xa0, 0xff, 0xd6, 0xac, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xbc, 0xff, 0xde, 0xf1, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xc0, 0xff, 0xa5, 0xa0, 0xff, 0xa5, 0x80, 0xff, 0xa5, 0xa0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xa5, 0xa0, 0xff, 0xc5, 0xe2, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe6, 0xff, 
-  0xfe, 0x46, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xd5, 0xe4, 0xff, 0x9d, 0x80, 0xff, 0xa5, 0xa0, 0xff, 0xa5, 0xa0, 0xff, 0xa5, 0xa0, 0xff, 0xef, 0x57, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9a, 0xff, 0xad, 0xc1, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xa5, 0xa0, 0xff, 0xde, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0xa5, 0xa0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xa5, 0xa0, 0xff, 0xef, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xad, 0xe2, 0xff, 0xa5, 0xa0, 0xff, 0xa5, 0xa0, 0xff, 0xa5, 0xa0, 0xff, 0xc5, 0xc2, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 
-  0xfe, 0x46, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xd5, 0xe4, 0xff, 0x9d, 0x80, 0xff, 0xa5, 0xa0, 0xff, 0x9d, 0x60, 0xff, 0xef, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0xa5, 0x80, 0xff, 0xad, 0xa0, 0xff, 0xa5, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x26, 0xff, 0xa5, 0xa0, 0xff, 0xa5, 0x80, 0xff, 0xde, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xff, 0x9d, 0x60, 0xff, 0xa5, 0xa0, 0xff, 0x9d, 0x80, 0xff, 0xbd, 0xc2, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe6, 0xff, 
-  0xfe, 0x46, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x28, 0xff, 0xd5, 0xe4, 0xff, 0x9d, 0x60, 0xff, 0xa5, 0x80, 0xff, 0x9d, 0x40, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xde, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x60, 0xff, 0xa5, 0xa0, 0xff, 0xb5, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xce, 0x8c, 0xff, 0xa5, 0x80, 0xff, 0x9d, 0x60, 0xff, 0xf7, 0x9a, 0xff, 0xff, 0xde, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x60, 0xff, 0xa5, 0x80, 0xff, 0x9d, 0x80, 0xff, 0xbd, 0xa2, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 
-  0xfe, 0x46, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x28, 0xff, 0xd5, 0xc4, 0xff, 0x95, 0x60, 0xff, 0x9d, 0x80, 0xff, 0x9d, 0x40, 0xff, 0xe7, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x58, 0xff, 0x9d, 0x60, 0xff, 0xa5, 0x80, 0xff, 0x9d, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x05, 0xff, 0xa5, 0x80, 0xff, 0x9d, 0x60, 0xff, 0xd6, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0x95, 0x40, 0xff, 0x9d, 0x80, 0xff, 0x9d, 0x60, 0xff, 0xbd, 0xa2, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 
-  0xfe, 0x26, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xd5, 0xc4, 0xff, 0x95, 0x40, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x95, 0x40, 0xff, 0xe7, 0x14, 0xff, 0xff, 0xdd, 0xff, 0xef, 0x36, 0xff, 0x9d, 0x60, 0xff, 0xa5, 0x80, 0xff, 0xa5, 0x80, 0xff, 0x9d, 0x60, 0xff, 0xd6, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xef, 0x57, 0xff, 0x95, 0x40, 0xff, 0xa5, 0x80, 0xff, 0xa5, 0x80, 0xff, 0x9d, 0x40, 0xff, 0xde, 0xd1, 0xff, 0xff, 0xdd, 0xff, 0xef, 0x57, 0xff, 0x9d, 0x80, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x95, 0x60, 0xff, 0xbd, 0x82, 0xff, 0xfe, 0x08, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe7, 0xff, 
-  0xfe, 0x46, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfe, 0x07, 0xff, 0xd5, 0xa4, 0xff, 0x95, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x95, 0x40, 0xff, 0x95, 0x20, 0xff, 0x95, 0x40, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x80, 0xff, 0x95, 0x40, 0xff, 0xbe, 0x28, 0xff, 0xef, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xce, 0x8d, 0xff, 0x95, 0x40, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x95, 0x40, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x40, 0xff, 0x95, 0x40, 0xff, 0xbd, 0x82, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 
-  0x00, 0x00, 0x00, 0xfd, 0xa6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe7, 0xff, 0xd5, 0xa4, 0xff, 0x8d, 0x20, 0xff, 0x95, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x40, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x40, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0xb5, 0x62, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 
-  0x00, 0x00, 0x00, 0xfd, 0xa6, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe7, 0xff, 0xcd, 0x84, 0xff, 0x8d, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x9d, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x20, 0xff, 0x8d, 0x20, 0xff, 0xb5, 0x62, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0xa5, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe6, 0xff, 0xd5, 0x84, 0xff, 0x8d, 0x00, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x40, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x8d, 0x00, 0xff, 0xb5, 0x42, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0xa6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xed, 0xa5, 0xff, 0x84, 0xe0, 0xff, 0x8d, 0x00, 0xff, 0x95, 0x00, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x00, 0xff, 0x85, 0x00, 0xff, 0xcd, 0x83, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xa5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xa6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe6, 0xff, 0x9d, 0x21, 0xff, 0x85, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x95, 0x00, 0xff, 0x95, 0x00, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x20, 0xff, 0x95, 0x00, 0xff, 0x95, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x84, 0xe0, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0xc6, 0xff, 0x8c, 0xe0, 0xff, 0x7c, 0xe0, 0xff, 0x84, 0xe0, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x84, 0xe0, 0xff, 0x84, 0xe0, 0xff, 0x7c, 0xe0, 0xff, 0xf5, 0xa5, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x84, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xc6, 0xff, 0xd5, 0x63, 0xff, 0xa5, 0x21, 0xff, 0xa5, 0x01, 0xff, 0xa5, 0x21, 0xff, 0xa5, 0x21, 0xff, 0x9d, 0x01, 0xff, 0x8c, 0xe0, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x8d, 0x00, 0xff, 0x84, 0xe0, 0xff, 0x95, 0x00, 0xff, 0xa5, 0x21, 0xff, 0xa5, 0x21, 0xff, 0xa5, 0x21, 0xff, 0xa5, 0x21, 0xff, 0xa5, 0x21, 0xff, 0xa5, 0x21, 0xff, 0xa5, 0x21, 0xff, 0xa5, 0x01, 0xff, 0xa5, 0x01, 0xff, 0xc5, 0x43, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x85, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe7, 0xff, 0x95, 0x00, 0xff, 0x84, 0xe0, 0xff, 0x8c, 0xe0, 0xff, 0x8c, 0xe0, 0xff, 0x84, 0xe0, 0xff, 0x7c, 0xc0, 0xff, 0x95, 0x00, 0xff, 0xdd, 0x84, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xdd, 0x64, 0xff, 0x7c, 0xc0, 0xff, 0x84, 0xc0, 0xff, 0x84, 0xc0, 0xff, 0x74, 0xc0, 0xff, 0x94, 0xe1, 0xff, 0xe5, 0x84, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xa6, 0xff, 0x8c, 0xc0, 0xff, 0x7c, 0xa0, 0xff, 0x74, 0xa0, 0xff, 0x9c, 0xe1, 0xff, 0xed, 0x84, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xd5, 0x43, 0xff, 0x64, 0x80, 0xff, 0x9c, 0xe1, 0xff, 0xf5, 0x84, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x83, 0xff, 0xfd, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x85, 0xff, 0xac, 0xe2, 0xff, 0xf5, 0x64, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x83, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x43, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xee, 0xfc, 0xff, 0x6d, 0xee, 0xfd, 0xff, 0x6e, 0xee, 0xfd, 0xff, 0x6d, 0xee, 0xfd, 0xff, 0x6e, 0xef, 0xfe, 0xff, 0x6e, 0xef, 0xfe, 0xff, 0x6d, 0xee, 0xfd, 0xff, 0x6e, 0xee, 0xfd, 0xff, 0x63, 0xe1, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xe8, 0xfd, 0xff, 0x6a, 0xea, 0xfe, 0xff, 0x6a, 0xea, 0xfd, 0xff, 0x6e, 0xef, 0xfd, 0xff, 0x6d, 0xef, 0xfd, 0xff, 0x6f, 0xef, 0xff, 0xff, 0x6f, 0xef, 0xff, 0xff, 0x6d, 0xef, 0xff, 0xff, 0x6e, 0xf1, 0xfe, 0xff, 0x6e, 0xef, 0xfe, 0xff, 0x6f, 0xef, 0xff, 0xff, 0x6e, 0xee, 0xfe, 0xff, 0x68, 0xe8, 0xfd, 0xff, 0x6a, 0xea, 0xfe, 0xff, 0x6d, 0xed, 0xfd, 0xff, 0x6b, 0xeb, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xe8, 0xfd, 0xff, 0x6a, 0xea, 0xfe, 0xff, 0x69, 0xea, 0xfd, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6b, 0xef, 0xff, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6b, 0xeb, 0xfe, 0xff, 0x6b, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xed, 0xfe, 0xff, 0x6c, 0xed, 0xfe, 0xff, 0x6c, 0xed, 0xfe, 0xff, 0x6d, 0xed, 0xfe, 0xff, 0x6e, 0xef, 0xfe, 0xff, 0x6b, 0xec, 0xfe, 0xff, 0x6b, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6b, 0xee, 0xff, 0xff, 0x65, 0xe5, 0xfd, 0xff, 0x5e, 0xe0, 0xfc, 0xff, 0x5d, 0xe0, 0xfc, 0xff, 0x5e, 0xde, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xea, 0xfe, 0xff, 0x6a, 0xea, 0xfe, 0xff, 0x69, 0xeb, 0xff, 0xff, 0x66, 0xe8, 0xfd, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x67, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x69, 0xea, 0xfe, 0xff, 0x69, 0xea, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6c, 0xee, 0xfe, 0xff, 0x69, 0xea, 0xfe, 0xff, 0x69, 0xea, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x67, 0xe9, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x66, 0xea, 0xff, 0xff, 0x61, 0xe1, 0xfd, 0xff, 0x5e, 0xe0, 0xfc, 0xff, 0x5c, 0xdb, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xe4, 0xfc, 0xff, 0x6a, 0xeb, 0xfd, 0xff, 0x69, 0xea, 0xfd, 0xff, 0x61, 0xe4, 0xfd, 0xff, 0x62, 0xe5, 0xfd, 0xff, 0x63, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x67, 0xe8, 0xfe, 0xff, 0x67, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x68, 0xea, 0xfe, 0xff, 0x68, 0xea, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x67, 0xe9, 0xfe, 0xff, 0x67, 0xe9, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x63, 0xe5, 0xfd, 0xff, 0x61, 0xe4, 0xfd, 0xff, 0x61, 0xe6, 0xff, 0xff, 0x5d, 0xe0, 0xfc, 0xff, 0x5d, 0xde, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xe1, 0xfc, 0xff, 0x60, 0xe2, 0xfc, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x60, 0xe2, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe7, 0xfd, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x64, 0xe7, 0xfd, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x60, 0xe2, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x5e, 0xe0, 0xfd, 0xff, 0x58, 0xd9, 0xfc, 0xff, 0x56, 0xd8, 0xfc, 0xff, 0x54, 0xd7, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xe4, 0xfd, 0xff, 0x62, 0xe2, 0xfc, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfd, 0xff, 0x64, 0xe7, 0xfd, 0xff, 0x64, 0xe6, 0xfd, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x61, 0xe4, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x57, 0xd9, 0xfc, 0xff, 0x56, 0xd8, 0xfd, 0xff, 0x56, 0xd8, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe1, 0xfc, 0xff, 0x60, 0xe2, 0xfc, 0xff, 0x60, 0xe1, 0xfc, 0xff, 0x62, 0xe5, 0xfd, 0xff, 0x59, 0xdd, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5d, 0xdf, 0xfd, 0xff, 0x5e, 0xe0, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x61, 0xe4, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x62, 0xe5, 0xfc, 0xff, 0x62, 0xe5, 0xfc, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x62, 0xe5, 0xfc, 0xff, 0x62, 0xe5, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x61, 0xe4, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x58, 0xdc, 0xfd, 0xff, 0x57, 0xd9, 0xfd, 0xff, 0x56, 0xd8, 0xfc, 0xff, 0x54, 0xd6, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe1, 0xfc, 0xff, 0x5c, 0xdc, 0xfe, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5e, 0xe0, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x60, 0xe2, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x60, 0xe2, 0xfd, 0xff, 0x60, 0xe2, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x59, 0xdd, 0xfd, 0xff, 0x58, 0xdc, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x56, 0xd9, 0xfd, 0xff, 0x50, 0xd6, 0xfd, 0xff, 0x4f, 0xd2, 0xfc, 0xff, 0x4f, 0xd3, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xd3, 0xfc, 0xff, 0x59, 0xda, 0xff, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x57, 0xdb, 0xfd, 0xff, 0x58, 0xdc, 0xfd, 0xff, 0x59, 0xdd, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x51, 0xd6, 0xfd, 0xff, 0x4f, 0xd3, 0xfc, 0xff, 0x4f, 0xd2, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xd0, 0xfc, 0xff, 0x4b, 0xd1, 0xfc, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x59, 0xdd, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5d, 0xdf, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x57, 0xdb, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x50, 0xd5, 0xfd, 0xff, 0x4f, 0xd4, 0xff, 0xff, 0x4d, 0xd2, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xd1, 0xfc, 0xff, 0x4a, 0xd0, 0xfc, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5a, 0xde, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x57, 0xdb, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x55, 0xd8, 0xfd, 0xff, 0x54, 0xd7, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x4c, 0xd0, 0xfc, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x49, 0xce, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xd0, 0xfc, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x57, 0xdb, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x58, 0xdc, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x58, 0xdc, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x57, 0xdb, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x55, 0xd8, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x48, 0xcc, 0xfb, 0xff, 0x48, 0xcc, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xd0, 0xfc, 0xff, 0x4b, 0xd4, 0xff, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x4b, 0xcf, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x4e, 0xd3, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x52, 0xd5, 0xfd, 0xff, 0x57, 0xd7, 0xff, 0xff, 0x5b, 0xd8, 0xff, 0xff, 0x5c, 0xd9, 0xff, 0xff, 0x5d, 0xda, 0xff, 0xff, 0x5e, 0xda, 0xff, 0xff, 0x5e, 0xda, 0xff, 0xff, 0x5f, 0xdb, 0xff, 0xff, 0x5f, 0xdb, 0xff, 0xff, 0x60, 0xdc, 0xff, 0xff, 0x60, 0xdc, 0xff, 0xff, 0x60, 0xdc, 0xff, 0xff, 0x60, 0xdc, 0xff, 0xff, 0x60, 0xdc, 0xff, 0xff, 0x60, 0xdc, 0xff, 0xff, 0x60, 0xdc, 0xff, 0xff, 0x60, 0xdc, 0xff, 0xff, 0x5f, 0xdb, 0xff, 0xff, 0x5f, 0xdb, 0xff, 0xff, 0x5e, 0xdb, 0xff, 0xff, 0x5e, 0xda, 0xff, 0xff, 0x5d, 0xda, 0xff, 0xff, 0x5c, 0xd9, 0xff, 0xff, 0x5b, 0xd8, 0xff, 0xff, 0x58, 0xd7, 0xff, 0xff, 0x53, 0xd6, 0xfe, 0xff, 0x50, 0xd5, 0xfd, 0xff, 0x4f, 0xd4, 0xfd, 0xff, 0x4e, 0xd3, 0xfd, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x49, 0xd0, 0xfe, 0xff, 0x48, 0xcc, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xd2, 0xfe, 0xff, 0x47, 0xcc, 0xfc, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4d, 0xd1, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x50, 0xd3, 0xfe, 0xff, 0x57, 0xd5, 0xff, 0xff, 0x28, 0xcd, 0xdb, 0xff, 0x0d, 0xc9, 0xc4, 0xff, 0x07, 0xc9, 0xc1, 0xff, 0x08, 0xca, 0xc2, 0xff, 0x08, 0xca, 0xc3, 0xff, 0x08, 0xcb, 0xc4, 0xff, 0x08, 0xcc, 0xc4, 0xff, 0x08, 0xcc, 0xc5, 0xff, 0x08, 0xcd, 0xc5, 0xff, 0x08, 0xcd, 0xc6, 0xff, 0x08, 0xcd, 0xc6, 0xff, 0x08, 0xcd, 0xc6, 0xff, 0x08, 0xcd, 0xc6, 0xff, 0x08, 0xcd, 0xc6, 0xff, 0x08, 0xcd, 0xc6, 0xff, 0x08, 0xcd, 0xc5, 0xff, 0x08, 0xcc, 0xc5, 0xff, 0x08, 0xcc, 0xc4, 0xff, 0x08, 0xcb, 0xc4, 0xff, 0x08, 0xcb, 0xc3, 0xff, 0x08, 0xca, 0xc2, 0xff, 0x07, 0xc9, 0xc1, 0xff, 0x0a, 0xc9, 0xc2, 0xff, 0x20, 0xcc, 0xd4, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x53, 0xd4, 0xff, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4d, 0xd1, 0xfd, 0xff, 0x4c, 0xd0, 0xfd, 0xff, 0x4b, 0xcf, 0xfd, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x47, 0xcc, 0xfb, 0xff, 0x48, 0xc8, 0xfb, 0xff, 0x48, 0xcc, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xd0, 0xfc, 0xff, 0x48, 0xd3, 0xff, 0xff, 0x46, 0xcb, 0xfc, 0xff, 0x46, 0xcc, 0xfa, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4d, 0xd1, 0xfe, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x00, 0xc2, 0xb3, 0xff, 0x00, 0xc2, 0xb1, 0xff, 0x00, 0xc4, 0xb5, 0xff, 0x00, 0xc5, 0xb7, 0xff, 0x00, 0xc6, 0xb8, 0xff, 0x00, 0xc7, 0xb9, 0xff, 0x00, 0xc7, 0xb9, 0xff, 0x00, 0xc8, 0xba, 0xff, 0x00, 0xc8, 0xbb, 0xff, 0x00, 0xc9, 0xbb, 0xff, 0x00, 0xc9, 0xbb, 0xff, 0x00, 0xc9, 0xbc, 0xff, 0x00, 0xc9, 0xbc, 0xff, 0x00, 0xc9, 0xbc, 0xff, 0x00, 0xc9, 0xbc, 0xff, 0x00, 0xc9, 0xbb, 0xff, 0x00, 0xc9, 0xbb, 0xff, 0x00, 0xc8, 0xbb, 0xff, 0x00, 0xc8, 0xba, 0xff, 0x00, 0xc7, 0xb9, 0xff, 0x00, 0xc7, 0xb9, 0xff, 0x00, 0xc6, 0xb8, 0xff, 0x00, 0xc5, 0xb7, 0xff, 0x00, 0xc4, 0xb6, 0xff, 0x00, 0xc3, 0xb2, 0xff, 0x00, 0xc1, 0xac, 0xff, 0x41, 0xcf, 0xf1, 0xff, 0x4f, 0xd2, 0xff, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x47, 0xcc, 0xfc, 0xff, 0x46, 0xcb, 0xfc, 0xff, 0x45, 0xc8, 0xff, 0xff, 0x3e, 0xc4, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xcf, 0xfc, 0xff, 0x46, 0xcc, 0xfb, 0xff, 0x46, 0xc9, 0xfb, 0xff, 0x46, 0xcc, 0xfb, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x47, 0xcd, 0xfb, 0xff, 0x48, 0xce, 0xfb, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x53, 0xd1, 0xff, 0xff, 0x06, 0xc1, 0xb8, 0xff, 0x00, 0xc0, 0xaf, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc2, 0xb5, 0xff, 0x00, 0xc3, 0xb6, 0xff, 0x00, 0xc4, 0xb7, 0xff, 0x00, 0xc5, 0xb7, 0xff, 0x00, 0xc5, 0xb8, 0xff, 0x00, 0xc6, 0xb9, 0xff, 0x00, 0xc6, 0xb9, 0xff, 0x00, 0xc7, 0xba, 0xff, 0x00, 0xc7, 0xba, 0xff, 0x00, 0xc7, 0xba, 0xff, 0x00, 0xc7, 0xba, 0xff, 0x00, 0xc7, 0xba, 0xff, 0x00, 0xc7, 0xba, 0xff, 0x00, 0xc7, 0xba, 0xff, 0x00, 0xc7, 0xba, 0xff, 0x00, 0xc6, 0xb9, 0xff, 0x00, 0xc6, 0xb9, 0xff, 0x00, 0xc6, 0xb8, 0xff, 0x00, 0xc5, 0xb8, 0xff, 0x00, 0xc4, 0xb7, 0xff, 0x00, 0xc4, 0xb6, 0xff, 0x00, 0xc3, 0xb5, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xbe, 0xaa, 0xff, 0x4f, 0xd0, 0xff, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x47, 0xcd, 0xfb, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x39, 0xc3, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x46, 0xcb, 0xfb, 0xff, 0x46, 0xcc, 0xfb, 0xff, 0x46, 0xcc, 0xfa, 0xff, 0x46, 0xcb, 0xfa, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x45, 0xca, 0xfc, 0xff, 0x46, 0xcb, 0xfc, 0xff, 0x47, 0xcc, 0xfb, 0xff, 0x4a, 0xcd, 0xfe, 0xff, 0x3c, 0xcb, 0xee, 0xff, 0x00, 0xbc, 0xa6, 0xff, 0x00, 0xbf, 0xb0, 0xff, 0x00, 0xc0, 0xb1, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xc1, 0xb3, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc3, 0xb5, 0xff, 0x00, 0xc3, 0xb6, 0xff, 0x00, 0xc4, 0xb6, 0xff, 0x00, 0xc4, 0xb7, 0xff, 0x00, 0xc5, 0xb7, 0xff, 0x00, 0xc5, 0xb7, 0xff, 0x00, 0xc5, 0xb8, 0xff, 0x00, 0xc5, 0xb8, 0xff, 0x00, 0xc5, 0xb8, 0xff, 0x00, 0xc5, 0xb8, 0xff, 0x00, 0xc5, 0xb7, 0xff, 0x00, 0xc5, 0xb7, 0xff, 0x00, 0xc4, 0xb7, 0xff, 0x00, 0xc4, 0xb6, 0xff, 0x00, 0xc3, 0xb6, 0xff, 0x00, 0xc3, 0xb5, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc1, 0xb3, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xc0, 0xb1, 0xff, 0x00, 0xbf, 0xb0, 0xff, 0x00, 0xbd, 0xa9, 0xff, 0x27, 0xc6, 0xd8, 0xff, 0x4c, 0xce, 0xff, 0xff, 0x47, 0xcc, 0xfb, 0xff, 0x46, 0xcb, 0xfc, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x42, 0xc9, 0xfc, 0xff, 0x41, 0xc8, 0xfc, 0xff, 0x38, 0xc1, 0xfc, 0xff, 0x38, 0xbf, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x46, 0xcb, 0xfb, 0xff, 0x45, 0xc9, 0xfa, 0xff, 0x42, 0xc8, 0xfb, 0xff, 0x41, 0xc8, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x4a, 0xcd, 0xff, 0xff, 0x29, 0xc5, 0xdb, 0xff, 0x00, 0xbb, 0xa7, 0xff, 0x00, 0xbd, 0xae, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbe, 0xb0, 0xff, 0x00, 0xbf, 0xb1, 0xff, 0x00, 0xc0, 0xb1, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xc1, 0xb3, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc3, 0xb5, 0xff, 0x00, 0xc3, 0xb5, 0xff, 0x00, 0xc3, 0xb5, 0xff, 0x00, 0xc3, 0xb5, 0xff, 0x00, 0xc3, 0xb5, 0xff, 0x00, 0xc3, 0xb5, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc1, 0xb3, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xc0, 0xb2, 0xff, 0x00, 0xbf, 0xb1, 0xff, 0x00, 0xbf, 0xb0, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbd, 0xae, 0xff, 0x00, 0xbb, 0xa9, 0xff, 0x17, 0xc1, 0xc5, 0xff, 0x4c, 0xcd, 0xff, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x40, 0xc6, 0xfc, 0xff, 0x3a, 0xc2, 0xfe, 0xff, 0x38, 0xbf, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x44, 0xcb, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x41, 0xc8, 0xfc, 0xff, 0x42, 0xc9, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x48, 0xcb, 0xff, 0xff, 0x27, 0xc3, 0xd7, 0xff, 0x00, 0xb9, 0xa4, 0xff, 0x00, 0xbb, 0xab, 0xff, 0x00, 0xbc, 0xac, 0xff, 0x00, 0xbc, 0xad, 0xff, 0x00, 0xbd, 0xae, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbe, 0xb0, 0xff, 0x00, 0xbf, 0xb0, 0xff, 0x00, 0xbf, 0xb1, 0xff, 0x00, 0xc0, 0xb1, 0xff, 0x00, 0xc0, 0xb2, 0xff, 0x00, 0xc0, 0xb2, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xc0, 0xb2, 0xff, 0x00, 0xc0, 0xb2, 0xff, 0x00, 0xc0, 0xb1, 0xff, 0x00, 0xc0, 0xb1, 0xff, 0x00, 0xbf, 0xb0, 0xff, 0x00, 0xbf, 0xb0, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbd, 0xae, 0xff, 0x00, 0xbd, 0xae, 0xff, 0x00, 0xbc, 0xad, 0xff, 0x00, 0xbb, 0xac, 0xff, 0x00, 0xb9, 0xa7, 0xff, 0x15, 0xbf, 0xc3, 0xff, 0x4a, 0xcc, 0xff, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3a, 0xc1, 0xfb, 0xff, 0x38, 0xc1, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x42, 0xc9, 0xfc, 0xff, 0x43, 0xc8, 0xfc, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x40, 0xc6, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x47, 0xca, 0xff, 0xff, 0x26, 0xc1, 0xd6, 0xff, 0x00, 0xb7, 0xa2, 0xff, 0x00, 0xb9, 0xa9, 0xff, 0x00, 0xb9, 0xaa, 0xff, 0x00, 0xba, 0xab, 0xff, 0x00, 0xbb, 0xab, 0xff, 0x00, 0xbc, 0xac, 0xff, 0x00, 0xbc, 0xad, 0xff, 0x00, 0xbd, 0xae, 0xff, 0x00, 0xbd, 0xae, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbb, 0xab, 0xff, 0x00, 0xb9, 0xa8, 0xff, 0x00, 0xb8, 0xa7, 0xff, 0x00, 0xba, 0xaa, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbd, 0xae, 0xff, 0x00, 0xbd, 0xae, 0xff, 0x00, 0xbc, 0xad, 0xff, 0x00, 0xbc, 0xac, 0xff, 0x00, 0xbb, 0xac, 0xff, 0x00, 0xba, 0xab, 0xff, 0x00, 0xba, 0xaa, 0xff, 0x00, 0xb9, 0xa9, 0xff, 0x00, 0xb7, 0xa4, 0xff, 0x15, 0xbd, 0xc1, 0xff, 0x49, 0xca, 0xff, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x39, 0xc0, 0xfb, 0xff, 0x38, 0xbe, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x42, 0xc8, 0xfc, 0xff, 0x41, 0xc8, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x45, 0xc8, 0xff, 0xff, 0x25, 0xbf, 0xd5, 0xff, 0x00, 0xb4, 0x9f, 0xff, 0x00, 0xb7, 0xa6, 0xff, 0x00, 0xb7, 0xa7, 0xff, 0x00, 0xb7, 0xa7, 0xff, 0x00, 0xb3, 0xa1, 0xff, 0x00, 0xb2, 0x9f, 0xff, 0x00, 0xb4, 0xa2, 0xff, 0x00, 0xb9, 0xaa, 0xff, 0x00, 0xbb, 0xac, 0xff, 0x00, 0xbb, 0xac, 0xff, 0x00, 0xbc, 0xac, 0xff, 0x00, 0xb5, 0xa4, 0xff, 0x64, 0xd5, 0xcf, 0xff, 0xd8, 0xf2, 0xf7, 0xff, 0xe1, 0xf4, 0xfa, 0xff, 0x88, 0xde, 0xdc, 0xff, 0x00, 0xb7, 0xa5, 0xff, 0x00, 0xbb, 0xac, 0xff, 0x00, 0xbc, 0xac, 0xff, 0x00, 0xbb, 0xac, 0xff, 0x00, 0xba, 0xab, 0xff, 0x00, 0xb5, 0xa3, 0xff, 0x00, 0xb2, 0xa0, 0xff, 0x00, 0xb3, 0xa0, 0xff, 0x00, 0xb7, 0xa6, 0xff, 0x00, 0xb8, 0xa7, 0xff, 0x00, 0xb7, 0xa6, 0xff, 0x00, 0xb5, 0xa2, 0xff, 0x14, 0xbb, 0xbf, 0xff, 0x47, 0xc9, 0xff, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3b, 0xc3, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x37, 0xbe, 0xfc, 0xff, 0x34, 0xbc, 0xfc, 0xff, 
-  0x34, 0xc7, 0xff, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3b, 0xc5, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x3b, 0xc3, 0xfc, 0xff, 0x3c, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x43, 0xc7, 0xff, 0xff, 0x24, 0xbe, 0xd4, 0xff, 0x00, 0xb2, 0x9c, 0xff, 0x00, 0xb5, 0xa4, 0xff, 0x00, 0xb5, 0xa4, 0xff, 0x00, 0xb3, 0xa1, 0xff, 0xbc, 0xea, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xef, 0xf3, 0xff, 0x05, 0xba, 0xaa, 0xff, 0x00, 0xb8, 0xa7, 0xff, 0x00, 0xb9, 0xa9, 0xff, 0x00, 0xb5, 0xa3, 0xff, 0x8b, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf9, 0xff, 0xff, 0xf4, 0xf9, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xd2, 0xf0, 0xf5, 0xff, 0x00, 0xb3, 0xa0, 0xff, 0x00, 0xb9, 0xa9, 0xff, 0x00, 0xb9, 0xa8, 0xff, 0x00, 0xb4, 0xa2, 0xff, 0xad, 0xe6, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xdc, 0xf3, 0xf8, 0xff, 0x10, 0xbb, 0xac, 0xff, 0x00, 0xb4, 0xa3, 0xff, 0x00, 0xb5, 0xa4, 0xff, 0x00, 0xb3, 0x9f, 0xff, 0x14, 0xb9, 0xbe, 0xff, 0x45, 0xc8, 0xff, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3a, 0xc1, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x38, 0xbf, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 
-  0x34, 0xc7, 0xfe, 0xff, 0x36, 0xbf, 0xfb, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x3a, 0xc1, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x41, 0xc6, 0xff, 0xff, 0x23, 0xbc, 0xd3, 0xff, 0x00, 0xb0, 0x9a, 0xff, 0x00, 0xb3, 0xa1, 0xff, 0x00, 0xae, 0x9b, 0xff, 0xac, 0xe5, 0xe6, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xef, 0xf8, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xd3, 0xf0, 0xf5, 0xff, 0x00, 0xb1, 0x9e, 0xff, 0x00, 0xb6, 0xa6, 0xff, 0x00, 0xb5, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf8, 0xff, 0xff, 0xed, 0xf8, 0xff, 0xff, 0xed, 0xf8, 0xff, 0xff, 0xed, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xc5, 0xbb, 0xff, 0x00, 0xb5, 0xa4, 0xff, 0x00, 0xb2, 0xa0, 0xff, 0x8f, 0xdd, 0xdb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xef, 0xf8, 0xff, 0xff, 0xf8, 0xfa, 0xff, 0xff, 0xee, 0xf8, 0xff, 0xff, 0x00, 0xac, 0x98, 0xff, 0x00, 0xb3, 0xa1, 0xff, 0x00, 0xb1, 0x9c, 0xff, 0x13, 0xb7, 0xbc, 0xff, 0x43, 0xc6, 0xff, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x38, 0xbf, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x34, 0xbc, 0xfc, 0xff, 
-  0x34, 0xc7, 0xfe, 0xff, 0x36, 0xbd, 0xfb, 0xff, 0x35, 0xbe, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3f, 0xc4, 0xff, 0xff, 0x22, 0xbb, 0xd2, 0xff, 0x00, 0xae, 0x97, 0xff, 0x00, 0xb0, 0x9f, 0xff, 0x00, 0xaa, 0x96, 0xff, 0xe3, 0xf5, 0xfb, 0xff, 0xf2, 0xf9, 0xff, 0xff, 0xec, 0xf8, 0xff, 0xff, 0xee, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xad, 0x99, 0xff, 0x00, 0xb3, 0xa2, 0xff, 0x21, 0xbe, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xf8, 0xff, 0xff, 0xed, 0xf8, 0xff, 0xff, 0xed, 0xf8, 0xff, 0xff, 0xed, 0xf8, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x63, 0xd1, 0xca, 0xff, 0x00, 0xb2, 0x9f, 0xff, 0x00, 0xae, 0x9b, 0xff, 0xce, 0xef, 0xf2, 0xff, 0xf4, 0xfa, 0xff, 0xff, 0xec, 0xf8, 0xff, 0xff, 0xed, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xae, 0x9b, 0xff, 0x00, 0xb0, 0x9e, 0xff, 0x00, 0xaf, 0x9a, 0xff, 0x12, 0xb6, 0xba, 0xff, 0x41, 0xc5, 0xff, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x36, 0xbf, 0xfc, 0xff, 0x35, 0xbe, 0xfc, 0xff, 0x36, 0xc1, 0xfd, 0xff, 0x35, 0xbd, 0xfc, 0xff, 
-  0x34, 0xc7, 0xfe, 0xff, 0x36, 0xc0, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x35, 0xbe, 0xfc, 0xff, 0x36, 0xbf, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x3d, 0xc3, 0xff, 0xff, 0x21, 0xb9, 0xd1, 0xff, 0x00, 0xac, 0x94, 0xff, 0x00, 0xaf, 0x9c, 0xff, 0x00, 0xaa, 0x96, 0xff, 0x9c, 0xdf, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf9, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xc0, 0xea, 0xed, 0xff, 0x00, 0xac, 0x98, 0xff, 0x00, 0xb2, 0xa1, 0xff, 0x00, 0xaf, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xf8, 0xff, 0xff, 0xec, 0xf8, 0xff, 0xff, 0xec, 0xf8, 0xff, 0xff, 0xec, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0xc0, 0xb3, 0xff, 0x00, 0xb1, 0x9f, 0xff, 0x00, 0xae, 0x9b, 0xff, 0x80, 0xd8, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf9, 0xff, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0xe0, 0xf4, 0xfa, 0xff, 0x00, 0xa8, 0x93, 0xff, 0x00, 0xaf, 0x9c, 0xff, 0x00, 0xad, 0x97, 0xff, 0x12, 0xb3, 0xb9, 0xff, 0x3f, 0xc4, 0xff, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x39, 0xc0, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x34, 0xbc, 0xfc, 0xff, 0x34, 0xbe, 0xfd, 0xff, 0x34, 0xbd, 0xfb, 0xff, 
-  0x34, 0xc6, 0xff, 0xff, 0x36, 0xc0, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x34, 0xbc, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x3b, 0xc1, 0xff, 0xff, 0x20, 0xb7, 0xd0, 0xff, 0x00, 0xaa, 0x92, 0xff, 0x00, 0xac, 0x99, 0xff, 0x00, 0xad, 0x9a, 0xff, 0x00, 0xa9, 0x94, 0xff, 0x9d, 0xdf, 0xde, 0xff, 0xe8, 0xf7, 0xfd, 0xff, 0xb0, 0xe5, 0xe6, 0xff, 0x00, 0xae, 0x9b, 0xff, 0x00, 0xaf, 0x9d, 0xff, 0x00, 0xb1, 0x9f, 0xff, 0x00, 0xac, 0x98, 0xff, 0x71, 0xd2, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf9, 0xff, 0xff, 0xf4, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xb9, 0xe7, 0xea, 0xff, 0x00, 0xa9, 0x94, 0xff, 0x00, 0xb0, 0x9e, 0xff, 0x00, 0xb0, 0x9e, 0xff, 0x00, 0xaa, 0x95, 0xff, 0x8c, 0xda, 0xd7, 0xff, 0xea, 0xf7, 0xfe, 0xff, 0xbc, 0xe9, 0xeb, 0xff, 0x02, 0xaf, 0x9c, 0xff, 0x00, 0xac, 0x99, 0xff, 0x00, 0xad, 0x9a, 0xff, 0x00, 0xab, 0x94, 0xff, 0x11, 0xb2, 0xb7, 0xff, 0x3d, 0xc2, 0xff, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x30, 0xb9, 0xfb, 0xff, 0x35, 0xbd, 0xfb, 0xff, 
-  0x33, 0xc7, 0xff, 0xff, 0x35, 0xbe, 0xfc, 0xff, 0x36, 0xbd, 0xfb, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x3a, 0xc0, 0xff, 0xff, 0x1f, 0xb5, 0xcf, 0xff, 0x00, 0xa8, 0x8f, 0xff, 0x00, 0xaa, 0x97, 0xff, 0x00, 0xab, 0x98, 0xff, 0x00, 0xab, 0x98, 0xff, 0x00, 0xa7, 0x92, 0xff, 0x00, 0xa5, 0x8f, 0xff, 0x00, 0xa7, 0x93, 0xff, 0x00, 0xad, 0x9a, 0xff, 0x00, 0xae, 0x9c, 0xff, 0x00, 0xae, 0x9c, 0xff, 0x00, 0xaf, 0x9c, 0xff, 0x00, 0xa8, 0x93, 0xff, 0x43, 0xc3, 0xb9, 0xff, 0xb8, 0xe7, 0xe9, 0xff, 0xc1, 0xea, 0xed, 0xff, 0x6a, 0xcf, 0xc9, 0xff, 0x00, 0xa7, 0x92, 0xff, 0x00, 0xae, 0x9c, 0xff, 0x00, 0xae, 0x9c, 0xff, 0x00, 0xae, 0x9b, 0xff, 0x00, 0xad, 0x9b, 0xff, 0x00, 0xa9, 0x94, 0xff, 0x00, 0xa5, 0x8f, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xaa, 0x97, 0xff, 0x00, 0xab, 0x98, 0xff, 0x00, 0xaa, 0x97, 0xff, 0x00, 0xa9, 0x92, 0xff, 0x11, 0xb0, 0xb5, 0xff, 0x3b, 0xc1, 0xff, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x30, 0xba, 0xfc, 0xff, 0x30, 0xb8, 0xfc, 0xff, 0x30, 0xb8, 0xfc, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x2d, 0xb6, 0xfb, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x30, 0xba, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x38, 0xbe, 0xff, 0xff, 0x1e, 0xb4, 0xcd, 0xff, 0x00, 0xa6, 0x8c, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa9, 0x95, 0xff, 0x00, 0xaa, 0x96, 0xff, 0x00, 0xaa, 0x97, 0xff, 0x00, 0xab, 0x97, 0xff, 0x00, 0xab, 0x98, 0xff, 0x00, 0xab, 0x98, 0xff, 0x00, 0xac, 0x99, 0xff, 0x00, 0xac, 0x99, 0xff, 0x00, 0xac, 0x99, 0xff, 0x00, 0xad, 0x9a, 0xff, 0x00, 0xaa, 0x96, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xa9, 0x94, 0xff, 0x00, 0xac, 0x99, 0xff, 0x00, 0xac, 0x99, 0xff, 0x00, 0xac, 0x99, 0xff, 0x00, 0xac, 0x99, 0xff, 0x00, 0xac, 0x98, 0xff, 0x00, 0xab, 0x98, 0xff, 0x00, 0xab, 0x97, 0xff, 0x00, 0xaa, 0x97, 0xff, 0x00, 0xaa, 0x96, 0xff, 0x00, 0xa9, 0x95, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa7, 0x8f, 0xff, 0x11, 0xae, 0xb3, 0xff, 0x39, 0xbf, 0xff, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x30, 0xb8, 0xfc, 0xff, 0x30, 0xb9, 0xfb, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x2d, 0xb6, 0xfc, 0xff, 0x2d, 0xb6, 0xfa, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x36, 0xbd, 0xff, 0xff, 0x1d, 0xb2, 0xcc, 0xff, 0x00, 0xa4, 0x89, 0xff, 0x00, 0xa6, 0x92, 0xff, 0x00, 0xa7, 0x92, 0xff, 0x00, 0xa7, 0x93, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x95, 0xff, 0x00, 0xa9, 0x95, 0xff, 0x00, 0xa9, 0x95, 0xff, 0x00, 0xaa, 0x96, 0xff, 0x00, 0xaa, 0x96, 0xff, 0x00, 0xaa, 0x97, 0xff, 0x00, 0xaa, 0x97, 0xff, 0x00, 0xaa, 0x97, 0xff, 0x00, 0xab, 0x97, 0xff, 0x00, 0xab, 0x97, 0xff, 0x00, 0xab, 0x97, 0xff, 0x00, 0xaa, 0x97, 0xff, 0x00, 0xaa, 0x97, 0xff, 0x00, 0xaa, 0x96, 0xff, 0x00, 0xaa, 0x96, 0xff, 0x00, 0xa9, 0x96, 0xff, 0x00, 0xa9, 0x95, 0xff, 0x00, 0xa9, 0x95, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x93, 0xff, 0x00, 0xa7, 0x92, 0xff, 0x00, 0xa6, 0x92, 0xff, 0x00, 0xa5, 0x8c, 0xff, 0x10, 0xac, 0xb1, 0xff, 0x37, 0xbe, 0xff, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x30, 0xb9, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2c, 0xb6, 0xfb, 0xff, 0x2d, 0xb7, 0xfb, 0xff, 0x2c, 0xb5, 0xf9, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x30, 0xba, 0xfc, 0xff, 0x34, 0xbb, 0xff, 0xff, 0x1d, 0xb1, 0xce, 0xff, 0x00, 0xa2, 0x86, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa5, 0x90, 0xff, 0x00, 0xa5, 0x91, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xa6, 0x92, 0xff, 0x00, 0xa7, 0x92, 0xff, 0x00, 0xa7, 0x93, 0xff, 0x00, 0xa7, 0x93, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x94, 0xff, 0x00, 0xa8, 0x93, 0xff, 0x00, 0xa7, 0x93, 0xff, 0x00, 0xa7, 0x92, 0xff, 0x00, 0xa6, 0x92, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xa5, 0x91, 0xff, 0x00, 0xa5, 0x90, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa2, 0x89, 0xff, 0x10, 0xaa, 0xb0, 0xff, 0x35, 0xbc, 0xff, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2b, 0xb6, 0xfb, 0xff, 0x2b, 0xb5, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2d, 0xb6, 0xfb, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2b, 0xb6, 0xfa, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x31, 0xba, 0xff, 0xff, 0x29, 0xb5, 0xeb, 0xff, 0x00, 0x9e, 0x7d, 0xff, 0x00, 0xa2, 0x8c, 0xff, 0x00, 0xa2, 0x8d, 0xff, 0x00, 0xa3, 0x8e, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa5, 0x90, 0xff, 0x00, 0xa5, 0x90, 0xff, 0x00, 0xa5, 0x91, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xa6, 0x92, 0xff, 0x00, 0xa6, 0x92, 0xff, 0x00, 0xa6, 0x92, 0xff, 0x00, 0xa6, 0x92, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xa6, 0x91, 0xff, 0x00, 0xa5, 0x91, 0xff, 0x00, 0xa5, 0x90, 0xff, 0x00, 0xa5, 0x90, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa3, 0x8e, 0xff, 0x00, 0xa3, 0x8d, 0xff, 0x00, 0xa2, 0x8d, 0xff, 0x00, 0x9f, 0x82, 0xff, 0x1c, 0xaf, 0xcb, 0xff, 0x32, 0xba, 0xff, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2b, 0xb6, 0xfb, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x27, 0xb1, 0xfb, 0xff, 0x2b, 0xb5, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xb6, 0xfb, 0xff, 0x2a, 0xb4, 0xfb, 0xff, 0x2c, 0xb4, 0xfc, 0xff, 0x2a, 0xb5, 0xfa, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2e, 0xb7, 0xfc, 0xff, 0x34, 0xbb, 0xff, 0xff, 0x06, 0xa3, 0x98, 0xff, 0x00, 0x9f, 0x84, 0xff, 0x00, 0xa0, 0x8a, 0xff, 0x00, 0xa1, 0x8b, 0xff, 0x00, 0xa1, 0x8c, 0xff, 0x00, 0xa2, 0x8d, 0xff, 0x00, 0xa2, 0x8d, 0xff, 0x00, 0xa3, 0x8e, 0xff, 0x00, 0xa3, 0x8e, 0xff, 0x00, 0xa3, 0x8e, 0xff, 0x00, 0xa4, 0x8e, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa4, 0x8f, 0xff, 0x00, 0xa4, 0x8e, 0xff, 0x00, 0xa4, 0x8e, 0xff, 0x00, 0xa3, 0x8e, 0xff, 0x00, 0xa3, 0x8e, 0xff, 0x00, 0xa2, 0x8d, 0xff, 0x00, 0xa2, 0x8d, 0xff, 0x00, 0xa2, 0x8c, 0xff, 0x00, 0xa1, 0x8b, 0xff, 0x00, 0xa0, 0x8b, 0xff, 0x00, 0x9f, 0x87, 0xff, 0x00, 0x9d, 0x80, 0xff, 0x32, 0xba, 0xff, 0xff, 0x2e, 0xb7, 0xfc, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2b, 0xb6, 0xfb, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x26, 0xb2, 0xfa, 0xff, 0x23, 0xb0, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xb6, 0xfc, 0xff, 0x29, 0xb4, 0xfb, 0xff, 0x29, 0xb4, 0xfc, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x2a, 0xb5, 0xfa, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2d, 0xb6, 0xfd, 0xff, 0x2f, 0xb8, 0xff, 0xff, 0x01, 0x9e, 0x8b, 0xff, 0x00, 0x9c, 0x7c, 0xff, 0x00, 0x9e, 0x84, 0xff, 0x00, 0x9f, 0x85, 0xff, 0x00, 0x9f, 0x86, 0xff, 0x00, 0x9f, 0x87, 0xff, 0x00, 0xa0, 0x89, 0xff, 0x00, 0xa1, 0x8b, 0xff, 0x00, 0xa1, 0x8c, 0xff, 0x00, 0xa1, 0x8c, 0xff, 0x00, 0xa1, 0x8c, 0xff, 0x00, 0xa2, 0x8c, 0xff, 0x00, 0xa2, 0x8c, 0xff, 0x00, 0xa2, 0x8c, 0xff, 0x00, 0xa1, 0x8a, 0xff, 0x00, 0xa1, 0x88, 0xff, 0x00, 0xa1, 0x88, 0xff, 0x00, 0xa0, 0x88, 0xff, 0x00, 0xa0, 0x88, 0xff, 0x00, 0xa0, 0x87, 0xff, 0x00, 0xa0, 0x87, 0xff, 0x00, 0x9f, 0x86, 0xff, 0x00, 0x9f, 0x86, 0xff, 0x00, 0x9e, 0x84, 0xff, 0x00, 0x9c, 0x7f, 0xff, 0x00, 0x9b, 0x7c, 0xff, 0x29, 0xb4, 0xef, 0xff, 0x2e, 0xb7, 0xff, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2a, 0xb5, 0xfa, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x26, 0xb0, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb0, 0xfb, 0xff, 0x2c, 0xb5, 0xfc, 0xff, 0x2c, 0xb6, 0xfc, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x28, 0xb2, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x29, 0xb4, 0xfb, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x2a, 0xb5, 0xfa, 0xff, 0x2c, 0xb6, 0xfc, 0xff, 0x31, 0xb9, 0xff, 0xff, 0x1b, 0xac, 0xcd, 0xff, 0x0a, 0xa3, 0xa1, 0xff, 0x08, 0xa2, 0x9d, 0xff, 0x08, 0xa3, 0x9e, 0xff, 0x09, 0xa3, 0xa0, 0xff, 0x05, 0xa2, 0x96, 0xff, 0x00, 0x9e, 0x87, 0xff, 0x00, 0x9f, 0x89, 0xff, 0x00, 0x9f, 0x89, 0xff, 0x00, 0x9f, 0x89, 0xff, 0x00, 0x9f, 0x89, 0xff, 0x00, 0x9f, 0x86, 0xff, 0x00, 0x9d, 0x7d, 0xff, 0x03, 0xa1, 0x91, 0xff, 0x09, 0xa5, 0xa1, 0xff, 0x09, 0xa4, 0x9f, 0xff, 0x09, 0xa4, 0x9f, 0xff, 0x09, 0xa4, 0x9f, 0xff, 0x09, 0xa4, 0x9f, 0xff, 0x09, 0xa3, 0x9e, 0xff, 0x08, 0xa3, 0x9e, 0xff, 0x08, 0xa2, 0x9d, 0xff, 0x09, 0xa2, 0x9e, 0xff, 0x16, 0xa9, 0xc0, 0xff, 0x2e, 0xb7, 0xff, 0xff, 0x2d, 0xb6, 0xff, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x29, 0xb4, 0xfb, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb0, 0xfa, 0xff, 0x26, 0xb0, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xb0, 0xfb, 0xff, 0x2a, 0xb4, 0xfc, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x2a, 0xb4, 0xfb, 0xff, 0x2d, 0xb6, 0xff, 0xff, 0x2f, 0xb7, 0xff, 0xff, 0x2f, 0xb8, 0xff, 0xff, 0x30, 0xb8, 0xff, 0xff, 0x36, 0xbc, 0xff, 0xff, 0x04, 0x9f, 0x90, 0xff, 0x00, 0x9c, 0x83, 0xff, 0x00, 0x9d, 0x86, 0xff, 0x00, 0x9d, 0x86, 0xff, 0x00, 0x9c, 0x83, 0xff, 0x00, 0x9a, 0x79, 0xff, 0x04, 0xa0, 0x92, 0xff, 0x21, 0xb0, 0xdc, 0xff, 0x34, 0xba, 0xff, 0xff, 0x32, 0xb9, 0xff, 0xff, 0x31, 0xb9, 0xff, 0xff, 0x31, 0xb9, 0xff, 0xff, 0x31, 0xb9, 0xff, 0xff, 0x31, 0xb8, 0xff, 0xff, 0x30, 0xb8, 0xff, 0xff, 0x30, 0xb8, 0xff, 0xff, 0x30, 0xb8, 0xff, 0xff, 0x2f, 0xb7, 0xff, 0xff, 0x2d, 0xb6, 0xff, 0xff, 0x2a, 0xb4, 0xfc, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x26, 0xb0, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xaf, 0xfc, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x2c, 0xb5, 0xff, 0xff, 0x1d, 0xac, 0xd5, 0xff, 0x00, 0x98, 0x77, 0xff, 0x00, 0x9a, 0x83, 0xff, 0x00, 0x9a, 0x7f, 0xff, 0x00, 0x97, 0x74, 0xff, 0x05, 0x9e, 0x94, 0xff, 0x22, 0xb0, 0xe1, 0xff, 0x31, 0xb9, 0xff, 0xff, 0x2d, 0xb6, 0xff, 0xff, 0x2b, 0xb5, 0xfb, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2a, 0xb5, 0xfa, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x26, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xac, 0xfa, 0xff, 0x22, 0xaf, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x2d, 0xb6, 0xff, 0xff, 0x02, 0x99, 0x87, 0xff, 0x00, 0x96, 0x78, 0xff, 0x00, 0x95, 0x70, 0xff, 0x07, 0x9d, 0x96, 0xff, 0x23, 0xaf, 0xe8, 0xff, 0x2e, 0xb7, 0xff, 0xff, 0x2b, 0xb5, 0xff, 0xff, 0x29, 0xb4, 0xfb, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x29, 0xb4, 0xfb, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x28, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x26, 0xb0, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xaf, 0xfb, 0xff, 0x21, 0xae, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x27, 0xb2, 0xff, 0xff, 0x1a, 0xa8, 0xd3, 0xff, 0x00, 0x8f, 0x5f, 0xff, 0x09, 0x9c, 0x9b, 0xff, 0x23, 0xaf, 0xee, 0xff, 0x2c, 0xb5, 0xff, 0xff, 0x28, 0xb3, 0xfe, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x18, 0xb0, 0xff, 0xff, 0x26, 0xb0, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xac, 0xfa, 0xff, 0x21, 0xac, 0xfa, 0xff, 0x1f, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x26, 0xb1, 0xff, 0xff, 0x0d, 0x9d, 0xa9, 0xff, 0x21, 0xad, 0xf0, 0xff, 0x29, 0xb3, 0xff, 0xff, 0x26, 0xb1, 0xfe, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb1, 0xfb, 0xff, 0x25, 0xb1, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x1a, 0xaf, 0xff, 0xff, 0x17, 0xac, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xab, 0xfa, 0xff, 0x1f, 0xac, 0xfb, 0xff, 0x1e, 0xab, 0xfa, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x24, 0xb0, 0xff, 0xff, 0x23, 0xaf, 0xfd, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1e, 0xab, 0xfb, 0xff, 0x17, 0xac, 0xfd, 0xff, 0x17, 0xac, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xac, 0xfa, 0xff, 0x1d, 0xad, 0xfb, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1e, 0xab, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1a, 0xaa, 0xfb, 0xff, 0x17, 0xac, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xac, 0xfa, 0xff, 0x1f, 0xac, 0xfa, 0xff, 0x1c, 0xa8, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1d, 0xa9, 0xf9, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xab, 0xfa, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x1f, 0xac, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1e, 0xab, 0xfb, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xa9, 0xfa, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x19, 0xaa, 0xfd, 0xff, 0x17, 0xac, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xa8, 0xf9, 0xff, 0x1f, 0xad, 0xfb, 0xff, 0x1a, 0xa8, 0xfa, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1c, 0xa8, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1d, 0xa9, 0xf9, 0xff, 0x1d, 0xa9, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x17, 0xac, 0xff, 0xff, 0x17, 0xab, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa6, 0xfb, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x19, 0xa7, 0xfc, 0xff, 0x19, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1c, 0xa8, 0xf9, 0xff, 0x1c, 0xa8, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa8, 0xf9, 0xff, 0x1c, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x19, 0xa7, 0xfa, 0xff, 0x19, 0xa7, 0xfa, 0xff, 0x17, 0xac, 0xff, 0xff, 0x17, 0xab, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfb, 0xff, 0x19, 0xad, 0xff, 0xff, 0x18, 0xa6, 0xfb, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x19, 0xa7, 0xfa, 0xff, 0x19, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x19, 0xa7, 0xfa, 0xff, 0x19, 0xa7, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x17, 0xa8, 0xfa, 0xff, 0x17, 0xaa, 0xff, 0xff, 0x17, 0xac, 0xff, 0xff, 0x17, 0xac, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa5, 0xfb, 0xff, 0x18, 0xa7, 0xfa, 0xff, 0x18, 0xa6, 0xfb, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x17, 0xa9, 0xfd, 0xff, 0x17, 0xac, 0xff, 0xff, 0x17, 0xac, 0xff, 0xff, 0x17, 0xac, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfb, 0xff, 0x18, 0xa7, 0xfc, 0xff, 0x17, 0xa7, 0xfe, 0xff, 0x16, 0xa3, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa3, 0xfa, 0xff, 0x16, 0xa6, 0xfd, 0xff, 0x16, 0xab, 0xff, 0xff, 0x17, 0xae, 0xff, 0xff, 0x17, 0xac, 0xff, 0xff, 0x17, 0xab, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x17, 0xaa, 0xff, 0xff, 0x17, 0xa8, 0xff, 0xff, 0x17, 0xab, 0xff, 0xff, 0x15, 0xab, 0xff, 0xff, 0x17, 0xaa, 0xff, 0xff, 0x17, 0xaa, 0xff, 0xff, 0x17, 0xaa, 0xff, 0xff, 0x17, 0xab, 0xff, 0xff, 0x17, 0xac, 0xfe, 0xff, 0x17, 0xaa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xaa, 0xfe, 0xff, 0x17, 0xaa, 0xfe, 0xff, 0x17, 0xaa, 0xfe, 0xff, 0x17, 0xac, 0xff, 0xff, 0x17, 0xac, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t messages = {
-  .header.always_zero = 0,
-  .header.w = 50,
-  .header.h = 50,
-  .data_size = 2500 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = messages_map,
-};
-
@@ -1,250 +0,0 @@
-/**
- ****************************************************************************************
- *
- * @file reset_timer.c
- *
- * @brief Reset timer icon source file
- *
- * Copyright (C) 2021-2022 Dialog Semiconductor.
- * This computer program includes Confidential, Proprietary Information
- * of Dialog Semiconductor. All Rights Reserved.
- *
- ****************************************************************************************
- */
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_RESET_TIMER
-#define LV_ATTRIBUTE_IMG_RESET_TIMER
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_RESET_TIMER uint8_t reset_timer_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xd8, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb4, 0xff, 0xb8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x71, 0xff, 0x0a, 0xff, 0x91, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb4, 0xff, 0xb8, 0xff, 0xb4, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xd5, 0xff, 0x0a, 0xff, 0x0a, 0xff, 0x0a, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x94, 0xff, 0xb4, 0xff, 0x94, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb5, 0xff, 0x0a, 0xff, 0x0a, 0xff, 0x0a, 0xff, 0xd5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xd8, 0xff, 0xb8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x91, 0xff, 0x0a, 0xff, 0x09, 0xff, 0x0a, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x4d, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x29, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x2d, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb1, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0xb1, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb5, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x91, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb1, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x2d, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb1, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x2d, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x4d, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x4d, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb1, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x29, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x71, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb1, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x91, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x4d, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0xb1, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0xf4, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb1, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0xd5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb1, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0x6d, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb1, 0xff, 0x05, 0xff, 0x09, 0xff, 0x05, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0x09, 0xff, 0x6d, 0xff, 0x91, 0xff, 0xb1, 0xff, 0xb1, 0xff, 0x91, 0xff, 0x4d, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0x6d, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xb1, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x91, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0xb1, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0x09, 0xff, 0x49, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0x29, 0xff, 0x05, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0x05, 0xff, 0x4d, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0x6d, 0xff, 0x29, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0x91, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x8d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xab, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0x0c, 0xff, 0xff, 0x0d, 0xff, 0xff, 0x0d, 0xff, 0xff, 0xea, 0xfe, 0xff, 0xe8, 0xee, 0xff, 0xe7, 0xee, 0xff, 0xe7, 0xee, 0xff, 0xe8, 0xf6, 0xff, 0xea, 0xfe, 0xff, 0x0d, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xc7, 0xee, 0xff, 0xa2, 0xd6, 0xff, 0x80, 0xc6, 0xff, 0x80, 0xc6, 0xff, 0x80, 0xc6, 0xff, 0x80, 0xc6, 0xff, 0x80, 0xc6, 0xff, 0x80, 0xc6, 0xff, 0x80, 0xc6, 0xff, 0x80, 0xc6, 0xff, 0xa3, 0xde, 0xff, 0xc9, 0xf6, 0xff, 0xec, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xca, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xec, 0xfe, 0xff, 0xa7, 0xee, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x80, 0xc6, 0xff, 0x80, 0xc6, 0xff, 0x80, 0xce, 0xff, 0x80, 0xce, 0xff, 0x80, 0xce, 0xff, 0x80, 0xce, 0xff, 0x80, 0xce, 0xff, 0x80, 0xce, 0xff, 0x80, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x81, 0xce, 0xff, 0xc9, 0xf6, 0xff, 0xec, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcc, 0xfe, 0xff, 0xa6, 0xee, 0xff, 0x20, 0xb6, 0xff, 0x42, 0xce, 0xff, 0xab, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0x62, 0xce, 0xff, 0x40, 0xbe, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xbe, 0xff, 0x60, 0xbe, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x60, 0xc6, 0xff, 0x40, 0xbe, 0xff, 0x84, 0xde, 0xff, 0xcd, 0xfe, 0xff, 0x86, 0xe6, 0xff, 0x20, 0xb6, 0xff, 0x40, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0xab, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xab, 0xfe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xc6, 0xff, 0x40, 0xc6, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x62, 0xce, 0xff, 0xa6, 0xe6, 0xff, 0xa8, 0xf6, 0xff, 0xc9, 0xfe, 0xff, 0xc9, 0xfe, 0xff, 0xa8, 0xf6, 0xff, 0x85, 0xe6, 0xff, 0x61, 0xce, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x40, 0xc6, 0xff, 0x40, 0xc6, 0xff, 0x40, 0xbe, 0xff, 0x41, 0xc6, 0xff, 0x20, 0xb6, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xb6, 0xff, 0xab, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xab, 0xfe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x40, 0xbe, 0xff, 0x20, 0xb6, 0xff, 0x63, 0xd6, 0xff, 0xaa, 0xfe, 0xff, 0xcc, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0xcc, 0xfe, 0xff, 0xa9, 0xfe, 0xff, 0x41, 0xc6, 0xff, 0x20, 0xb6, 0xff, 0x40, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0xab, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0xab, 0xfe, 0xff, 0x22, 0xc6, 0xff, 0x00, 0xb6, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xb6, 0xff, 0x87, 0xee, 0xff, 0xcb, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xcb, 0xfe, 0xff, 0x66, 0xe6, 0xff, 0x20, 0xb6, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x20, 0xbe, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x8a, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x88, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x46, 0xee, 0xff, 0xe0, 0xad, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xae, 0xff, 0x88, 0xf6, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xaa, 0xfe, 0xff, 0xab, 0xfe, 0xff, 0x67, 0xee, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0xe0, 0xb5, 0xff, 0x8a, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x6a, 0xfe, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x88, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0x00, 0xb6, 0xff, 0xe0, 0xad, 0xff, 0x67, 0xee, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xab, 0xfe, 0xff, 0x66, 0xe6, 0xff, 0x00, 0xae, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xad, 0xff, 0x6a, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x88, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x26, 0xe6, 0xff, 0xc0, 0xa5, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0x02, 0xc6, 0xff, 0x8a, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0x46, 0xe6, 0xff, 0xe0, 0xad, 0xff, 0x00, 0xb6, 0xff, 0x00, 0xb6, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xb5, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0x6a, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x48, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0xe2, 0xbd, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xa5, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x89, 0xfe, 0xff, 0x8a, 0xfe, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xe0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xa5, 0xff, 0xa0, 0xa5, 0xff, 0x69, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x00, 0x00, 0x00, 
-  0x88, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x49, 0xfe, 0xff, 0xa0, 0x9d, 0xff, 0xc0, 0xad, 0xff, 0xc0, 0xad, 0xff, 0xe1, 0xbd, 0xff, 0x6a, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x46, 0xee, 0xff, 0x02, 0xc6, 0xff, 0x02, 0xc6, 0xff, 0x02, 0xc6, 0xff, 0xe2, 0xc5, 0xff, 0xe2, 0xc5, 0xff, 0xe2, 0xc5, 0xff, 0xe2, 0xc5, 0xff, 0xe2, 0xbd, 0xff, 0x05, 0xe6, 0xff, 0x49, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x00, 0x00, 0x00, 
-  0x88, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x27, 0xf6, 0xff, 0x80, 0x9d, 0xff, 0xa0, 0xa5, 0xff, 0xa0, 0xa5, 0xff, 0x04, 0xd6, 0xff, 0x69, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0x69, 0xfe, 0xff, 0xa9, 0xfe, 0xff, 0xa8, 0xfe, 0xff, 0x88, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 
-  0x07, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x05, 0xe6, 0xff, 0x80, 0x9d, 0xff, 0xa0, 0xa5, 0xff, 0x80, 0x9d, 0xff, 0x26, 0xee, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x88, 0xfe, 0xff, 0xeb, 0x5b, 0xff, 0x6d, 0x02, 0xff, 0x2b, 0x74, 0xff, 0x87, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 
-  0x06, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0xe5, 0xdd, 0xff, 0x60, 0x9d, 0xff, 0x80, 0xa5, 0xff, 0x80, 0x9d, 0xff, 0x27, 0xf6, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x68, 0xfe, 0xff, 0x49, 0xc5, 0xff, 0x0d, 0x02, 0xff, 0x8d, 0x02, 0xff, 0xed, 0x01, 0xff, 0xa8, 0xdd, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 
-  0xe6, 0xfd, 0xff, 0x06, 0xfe, 0xff, 0xe6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0xe5, 0xe5, 0xff, 0x60, 0x8d, 0xff, 0x60, 0x9d, 0xff, 0x60, 0x95, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x48, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x67, 0xfe, 0xff, 0xc9, 0xa4, 0xff, 0x4d, 0x02, 0xff, 0x6c, 0x02, 0xff, 0x0d, 0x02, 0xff, 0x68, 0xd5, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 
-  0x06, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0xc4, 0xcd, 0xff, 0x81, 0xb5, 0xff, 0xe6, 0xed, 0xff, 0x28, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x67, 0xfe, 0xff, 0x6a, 0x84, 0xff, 0x2c, 0x02, 0xff, 0x6c, 0x02, 0xff, 0xec, 0x01, 0xff, 0xc7, 0xed, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 
-  0xe6, 0xfd, 0xff, 0x06, 0xfe, 0xff, 0xc6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x67, 0xfe, 0xff, 0x87, 0xfe, 0xff, 0x87, 0xfe, 0xff, 0x87, 0xfe, 0xff, 0x87, 0xfe, 0xff, 0x87, 0xfe, 0xff, 0x87, 0xfe, 0xff, 0x87, 0xfe, 0xff, 0x87, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x28, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x67, 0xfe, 0xff, 0x4b, 0x43, 0xff, 0x2c, 0x02, 0xff, 0x4c, 0x02, 0xff, 0xcc, 0x01, 0xff, 0x66, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 
-  0xe6, 0xfd, 0xff, 0x06, 0xfe, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0x8b, 0x12, 0xff, 0x4b, 0x02, 0xff, 0x4b, 0x02, 0xff, 0x4b, 0x02, 0xff, 0x6b, 0x02, 0xff, 0x6c, 0x02, 0xff, 0x6c, 0x02, 0xff, 0x6c, 0x02, 0xff, 0x8c, 0x0a, 0xff, 0xc8, 0xed, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x67, 0xfe, 0xff, 0x0c, 0x02, 0xff, 0x4b, 0x02, 0xff, 0x2b, 0x02, 0xff, 0xaa, 0x22, 0xff, 0x46, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0x06, 0xfe, 0xff, 0x88, 0xa4, 0xff, 0xcb, 0x01, 0xff, 0x2b, 0x02, 0xff, 0x2b, 0x02, 0xff, 0x2b, 0x02, 0xff, 0x2b, 0x02, 0xff, 0x2b, 0x02, 0xff, 0x4b, 0x02, 0xff, 0x4b, 0x02, 0xff, 0xcc, 0x01, 0xff, 0x69, 0x94, 0xff, 0x27, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x27, 0xfe, 0xff, 0x88, 0x9c, 0xff, 0xeb, 0x01, 0xff, 0x2b, 0x02, 0xff, 0xeb, 0x01, 0xff, 0x09, 0x84, 0xff, 0x26, 0xfe, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0x06, 0xfe, 0xff, 0x68, 0xa4, 0xff, 0xcb, 0x01, 0xff, 0x2a, 0x02, 0xff, 0x2b, 0x02, 0xff, 0x2b, 0x02, 0xff, 0x2b, 0x02, 0xff, 0x2b, 0x02, 0xff, 0x2b, 0x02, 0xff, 0x0b, 0x02, 0xff, 0xaa, 0x22, 0xff, 0x46, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0x66, 0xfe, 0xff, 0x0b, 0x02, 0xff, 0x0b, 0x02, 0xff, 0x2b, 0x02, 0xff, 0xab, 0x01, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0x06, 0xfe, 0xff, 0x67, 0xa4, 0xff, 0xaa, 0x01, 0xff, 0x0a, 0x02, 0xff, 0x0a, 0x02, 0xff, 0x0a, 0x02, 0xff, 0x0a, 0x02, 0xff, 0x2a, 0x02, 0xff, 0xeb, 0x01, 0xff, 0xaa, 0x22, 0xff, 0x66, 0xfe, 0xff, 0xe6, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe7, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0x66, 0xfe, 0xff, 0x29, 0x4b, 0xff, 0xeb, 0x01, 0xff, 0x0a, 0x02, 0xff, 0xea, 0x01, 0xff, 0x29, 0x4b, 0xff, 0x26, 0xfe, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe5, 0xfd, 0xff, 0x67, 0xa4, 0xff, 0xaa, 0x01, 0xff, 0xea, 0x01, 0xff, 0x0a, 0x02, 0xff, 0x0a, 0x02, 0xff, 0x0a, 0x02, 0xff, 0xea, 0x01, 0xff, 0x8a, 0x22, 0xff, 0xa5, 0xfe, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0x66, 0xfe, 0xff, 0xc8, 0x73, 0xff, 0xaa, 0x01, 0xff, 0x0a, 0x02, 0xff, 0xea, 0x01, 0xff, 0x8a, 0x01, 0xff, 0xe6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xe5, 0xfd, 0xff, 0x47, 0xa4, 0xff, 0x89, 0x01, 0xff, 0xe9, 0x01, 0xff, 0xe9, 0x01, 0xff, 0xe9, 0x01, 0xff, 0xea, 0x01, 0xff, 0xea, 0x01, 0xff, 0xaa, 0x01, 0xff, 0xe8, 0x83, 0xff, 0x65, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xc6, 0xfd, 0xff, 0xe6, 0xfd, 0xff, 0x06, 0xfe, 0xff, 0x46, 0xfe, 0xff, 0x09, 0x4b, 0xff, 0x8a, 0x01, 0xff, 0xea, 0x01, 0xff, 0xea, 0x01, 0xff, 0x6a, 0x01, 0xff, 0x87, 0xac, 0xff, 0x05, 0xfe, 0xff, 0xc6, 0xfd, 0xff, 0xa6, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xe5, 0xfd, 0xff, 0x47, 0xa4, 0xff, 0x89, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xa9, 0x01, 0xff, 0xe9, 0x01, 0xff, 0xe9, 0x01, 0xff, 0x8a, 0x01, 0xff, 0x29, 0x12, 0xff, 0xc7, 0xbc, 0xff, 0x45, 0xfe, 0xff, 0x26, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0x26, 0xfe, 0xff, 0x25, 0xfe, 0xff, 0x47, 0x9c, 0xff, 0xca, 0x01, 0xff, 0xaa, 0x01, 0xff, 0xe9, 0x01, 0xff, 0xe9, 0x01, 0xff, 0x6a, 0x01, 0xff, 0x68, 0x6b, 0xff, 0x25, 0xfe, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xc5, 0xfd, 0xff, 0x26, 0xa4, 0xff, 0x69, 0x01, 0xff, 0xa9, 0x01, 0xff, 0x89, 0x01, 0xff, 0x88, 0x32, 0xff, 0xe8, 0x4a, 0xff, 0x69, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0x89, 0x01, 0xff, 0xa9, 0x01, 0xff, 0x28, 0x53, 0xff, 0x07, 0x8c, 0xff, 0x67, 0xa4, 0xff, 0x67, 0xa4, 0xff, 0xe7, 0x83, 0xff, 0xe8, 0x42, 0xff, 0x89, 0x01, 0xff, 0x89, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0x49, 0x01, 0xff, 0x67, 0x6b, 0xff, 0x25, 0xfe, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xc5, 0xfd, 0xff, 0x06, 0xa4, 0xff, 0x28, 0x01, 0xff, 0x68, 0x01, 0xff, 0x28, 0x22, 0xff, 0x25, 0xfe, 0xff, 0x25, 0xfe, 0xff, 0xa7, 0x7b, 0xff, 0x29, 0x01, 0xff, 0xa9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xa9, 0x01, 0xff, 0x89, 0x01, 0xff, 0x89, 0x01, 0xff, 0x89, 0x01, 0xff, 0x89, 0x01, 0xff, 0xa9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0xc9, 0x01, 0xff, 0x89, 0x01, 0xff, 0x49, 0x01, 0xff, 0x66, 0xac, 0xff, 0x25, 0xfe, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x65, 0xfd, 0xff, 0x88, 0x01, 0xff, 0x67, 0x32, 0xff, 0x04, 0xfe, 0xff, 0xa5, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0xe5, 0xfd, 0xff, 0x65, 0xed, 0xff, 0x68, 0x32, 0xff, 0x29, 0x01, 0xff, 0x69, 0x01, 0xff, 0x88, 0x01, 0xff, 0xa8, 0x01, 0xff, 0xa8, 0x01, 0xff, 0xa8, 0x01, 0xff, 0xa8, 0x01, 0xff, 0xa8, 0x01, 0xff, 0xa8, 0x01, 0xff, 0x88, 0x01, 0xff, 0x69, 0x01, 0xff, 0x29, 0x01, 0xff, 0xe7, 0x52, 0xff, 0xa5, 0xfd, 0xff, 0xc5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0xe4, 0xfd, 0xff, 0xe4, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x04, 0xfe, 0xff, 0x45, 0xed, 0xff, 0x67, 0x73, 0xff, 0xe8, 0x19, 0xff, 0x08, 0x01, 0xff, 0x28, 0x01, 0xff, 0x48, 0x01, 0xff, 0x48, 0x01, 0xff, 0x28, 0x01, 0xff, 0x28, 0x01, 0xff, 0x28, 0x22, 0xff, 0x86, 0x83, 0xff, 0x85, 0xfd, 0xff, 0xe4, 0xfd, 0xff, 0xa5, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0xa4, 0xfd, 0xff, 0xc4, 0xfd, 0xff, 0xe4, 0xfd, 0xff, 0xe4, 0xfd, 0xff, 0x25, 0xe5, 0xff, 0xc5, 0xd4, 0xff, 0xe5, 0xd4, 0xff, 0x45, 0xed, 0xff, 0xe4, 0xfd, 0xff, 0xe4, 0xfd, 0xff, 0xc4, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x85, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0xa4, 0xfd, 0xff, 0xa4, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x84, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x64, 0xfd, 0xff, 0x44, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x83, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x63, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfd, 0xff, 0x43, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x23, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x8e, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x8d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x4c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x6d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x4c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x4c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4c, 0xff, 0xff, 0x4c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xab, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xaa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0d, 0xff, 0xff, 0x0d, 0xff, 0xfe, 0xea, 0xff, 0xee, 0xe8, 0xff, 0xee, 0xe7, 0xff, 0xee, 0xe7, 0xff, 0xf6, 0xe8, 0xff, 0xfe, 0xea, 0xff, 0xff, 0x0d, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xec, 0xff, 0xee, 0xc7, 0xff, 0xd6, 0xa2, 0xff, 0xc6, 0x80, 0xff, 0xc6, 0x80, 0xff, 0xc6, 0x80, 0xff, 0xc6, 0x80, 0xff, 0xc6, 0x80, 0xff, 0xc6, 0x80, 0xff, 0xc6, 0x80, 0xff, 0xc6, 0x80, 0xff, 0xde, 0xa3, 0xff, 0xf6, 0xc9, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xeb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xcb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xa9, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xca, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xec, 0xff, 0xee, 0xa7, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x80, 0xff, 0xc6, 0x80, 0xff, 0xce, 0x80, 0xff, 0xce, 0x80, 0xff, 0xce, 0x80, 0xff, 0xce, 0x80, 0xff, 0xce, 0x80, 0xff, 0xce, 0x80, 0xff, 0xc6, 0x80, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xce, 0x81, 0xff, 0xf6, 0xc9, 0xff, 0xfe, 0xec, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcc, 0xff, 0xee, 0xa6, 0xff, 0xb6, 0x20, 0xff, 0xce, 0x42, 0xff, 0xfe, 0xab, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xa9, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xce, 0x62, 0xff, 0xbe, 0x40, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xbe, 0x60, 0xff, 0xbe, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xc6, 0x60, 0xff, 0xbe, 0x40, 0xff, 0xde, 0x84, 0xff, 0xfe, 0xcd, 0xff, 0xe6, 0x86, 0xff, 0xb6, 0x20, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x20, 0xff, 0xfe, 0xab, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xcb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xa9, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xab, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xc6, 0x40, 0xff, 0xc6, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xce, 0x62, 0xff, 0xe6, 0xa6, 0xff, 0xf6, 0xa8, 0xff, 0xfe, 0xc9, 0xff, 0xfe, 0xc9, 0xff, 0xf6, 0xa8, 0xff, 0xe6, 0x85, 0xff, 0xce, 0x61, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xc6, 0x40, 0xff, 0xc6, 0x40, 0xff, 0xbe, 0x40, 0xff, 0xc6, 0x41, 0xff, 0xb6, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xb6, 0x20, 0xff, 0xfe, 0xab, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x8a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc9, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xab, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x40, 0xff, 0xb6, 0x20, 0xff, 0xd6, 0x63, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xcc, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xcc, 0xff, 0xfe, 0xa9, 0xff, 0xc6, 0x41, 0xff, 0xb6, 0x20, 0xff, 0xbe, 0x40, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xb6, 0x20, 0xff, 0xb6, 0x00, 0xff, 0xfe, 0xab, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x88, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0xab, 0xff, 0xc6, 0x22, 0xff, 0xb6, 0x00, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xb6, 0x20, 0xff, 0xee, 0x87, 0xff, 0xfe, 0xcb, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xcb, 0xff, 0xe6, 0x66, 0xff, 0xb6, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xbe, 0x20, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x8a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x88, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x8a, 0xff, 0xee, 0x46, 0xff, 0xad, 0xe0, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xae, 0x00, 0xff, 0xf6, 0x88, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xaa, 0xff, 0xfe, 0xab, 0xff, 0xee, 0x67, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb5, 0xe0, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x6a, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x88, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x8a, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb6, 0x00, 0xff, 0xad, 0xe0, 0xff, 0xee, 0x67, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0xab, 0xff, 0xe6, 0x66, 0xff, 0xae, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xfe, 0x6a, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x69, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x88, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x69, 0xff, 0xe6, 0x26, 0xff, 0xa5, 0xc0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xc6, 0x02, 0xff, 0xfe, 0x8a, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xe6, 0x46, 0xff, 0xad, 0xe0, 0xff, 0xb6, 0x00, 0xff, 0xb6, 0x00, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xb5, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xc0, 0xff, 0xfe, 0x6a, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x48, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x48, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x69, 0xff, 0xbd, 0xe2, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xa5, 0xc0, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x89, 0xff, 0xfe, 0x8a, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xe0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xa5, 0xc0, 0xff, 0xa5, 0xa0, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0x00, 0x00, 0x00, 
-  0xfe, 0x88, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x49, 0xff, 0x9d, 0xa0, 0xff, 0xad, 0xc0, 0xff, 0xad, 0xc0, 0xff, 0xbd, 0xe1, 0xff, 0xfe, 0x6a, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xee, 0x46, 0xff, 0xc6, 0x02, 0xff, 0xc6, 0x02, 0xff, 0xc6, 0x02, 0xff, 0xc5, 0xe2, 0xff, 0xc5, 0xe2, 0xff, 0xc5, 0xe2, 0xff, 0xc5, 0xe2, 0xff, 0xbd, 0xe2, 0xff, 0xe6, 0x05, 0xff, 0xfe, 0x49, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x48, 0xff, 0x00, 0x00, 0x00, 
-  0xfe, 0x88, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xf6, 0x27, 0xff, 0x9d, 0x80, 0xff, 0xa5, 0xa0, 0xff, 0xa5, 0xa0, 0xff, 0xd6, 0x04, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0x69, 0xff, 0xfe, 0xa9, 0xff, 0xfe, 0xa8, 0xff, 0xfe, 0x88, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 
-  0xfe, 0x07, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xe6, 0x05, 0xff, 0x9d, 0x80, 0xff, 0xa5, 0xa0, 0xff, 0x9d, 0x80, 0xff, 0xee, 0x26, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x88, 0xff, 0x5b, 0xeb, 0xff, 0x02, 0x6d, 0xff, 0x74, 0x2b, 0xff, 0xfe, 0x87, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 
-  0xfe, 0x06, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x28, 0xff, 0xdd, 0xe5, 0xff, 0x9d, 0x60, 0xff, 0xa5, 0x80, 0xff, 0x9d, 0x80, 0xff, 0xf6, 0x27, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x68, 0xff, 0xc5, 0x49, 0xff, 0x02, 0x0d, 0xff, 0x02, 0x8d, 0xff, 0x01, 0xed, 0xff, 0xdd, 0xa8, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe7, 0xff, 
-  0xfd, 0xe6, 0xff, 0xfe, 0x06, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x27, 0xff, 0xe5, 0xe5, 0xff, 0x8d, 0x60, 0xff, 0x9d, 0x60, 0xff, 0x95, 0x60, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x48, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x67, 0xff, 0xa4, 0xc9, 0xff, 0x02, 0x4d, 0xff, 0x02, 0x6c, 0xff, 0x02, 0x0d, 0xff, 0xd5, 0x68, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 
-  0xfe, 0x06, 0xff, 0xfe, 0x06, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x28, 0xff, 0xcd, 0xc4, 0xff, 0xb5, 0x81, 0xff, 0xed, 0xe6, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x67, 0xff, 0x84, 0x6a, 0xff, 0x02, 0x2c, 0xff, 0x02, 0x6c, 0xff, 0x01, 0xec, 0xff, 0xed, 0xc7, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 
-  0xfd, 0xe6, 0xff, 0xfe, 0x06, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x67, 0xff, 0xfe, 0x87, 0xff, 0xfe, 0x87, 0xff, 0xfe, 0x87, 0xff, 0xfe, 0x87, 0xff, 0xfe, 0x87, 0xff, 0xfe, 0x87, 0xff, 0xfe, 0x87, 0xff, 0xfe, 0x87, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x28, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x67, 0xff, 0x43, 0x4b, 0xff, 0x02, 0x2c, 0xff, 0x02, 0x4c, 0xff, 0x01, 0xcc, 0xff, 0xfe, 0x66, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 
-  0xfd, 0xe6, 0xff, 0xfe, 0x06, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0x12, 0x8b, 0xff, 0x02, 0x4b, 0xff, 0x02, 0x4b, 0xff, 0x02, 0x4b, 0xff, 0x02, 0x6b, 0xff, 0x02, 0x6c, 0xff, 0x02, 0x6c, 0xff, 0x02, 0x6c, 0xff, 0x0a, 0x8c, 0xff, 0xed, 0xc8, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x67, 0xff, 0x02, 0x0c, 0xff, 0x02, 0x4b, 0xff, 0x02, 0x2b, 0xff, 0x22, 0xaa, 0xff, 0xfe, 0x46, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfe, 0x06, 0xff, 0xa4, 0x88, 0xff, 0x01, 0xcb, 0xff, 0x02, 0x2b, 0xff, 0x02, 0x2b, 0xff, 0x02, 0x2b, 0xff, 0x02, 0x2b, 0xff, 0x02, 0x2b, 0xff, 0x02, 0x4b, 0xff, 0x02, 0x4b, 0xff, 0x01, 0xcc, 0xff, 0x94, 0x69, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x27, 0xff, 0x9c, 0x88, 0xff, 0x01, 0xeb, 0xff, 0x02, 0x2b, 0xff, 0x01, 0xeb, 0xff, 0x84, 0x09, 0xff, 0xfe, 0x26, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0xa5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfe, 0x06, 0xff, 0xa4, 0x68, 0xff, 0x01, 0xcb, 0xff, 0x02, 0x2a, 0xff, 0x02, 0x2b, 0xff, 0x02, 0x2b, 0xff, 0x02, 0x2b, 0xff, 0x02, 0x2b, 0xff, 0x02, 0x2b, 0xff, 0x02, 0x0b, 0xff, 0x22, 0xaa, 0xff, 0xfe, 0x46, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x07, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfe, 0x07, 0xff, 0xfe, 0x66, 0xff, 0x02, 0x0b, 0xff, 0x02, 0x0b, 0xff, 0x02, 0x2b, 0xff, 0x01, 0xab, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0x64, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfe, 0x06, 0xff, 0xa4, 0x67, 0xff, 0x01, 0xaa, 0xff, 0x02, 0x0a, 0xff, 0x02, 0x0a, 0xff, 0x02, 0x0a, 0xff, 0x02, 0x0a, 0xff, 0x02, 0x2a, 0xff, 0x01, 0xeb, 0xff, 0x22, 0xaa, 0xff, 0xfe, 0x66, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe7, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfe, 0x66, 0xff, 0x4b, 0x29, 0xff, 0x01, 0xeb, 0xff, 0x02, 0x0a, 0xff, 0x01, 0xea, 0xff, 0x4b, 0x29, 0xff, 0xfe, 0x26, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe5, 0xff, 0xa4, 0x67, 0xff, 0x01, 0xaa, 0xff, 0x01, 0xea, 0xff, 0x02, 0x0a, 0xff, 0x02, 0x0a, 0xff, 0x02, 0x0a, 0xff, 0x01, 0xea, 0xff, 0x22, 0x8a, 0xff, 0xfe, 0xa5, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xe6, 0xff, 0xfe, 0x66, 0xff, 0x73, 0xc8, 0xff, 0x01, 0xaa, 0xff, 0x02, 0x0a, 0xff, 0x01, 0xea, 0xff, 0x01, 0x8a, 0xff, 0xfd, 0xe6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xe5, 0xff, 0xa4, 0x47, 0xff, 0x01, 0x89, 0xff, 0x01, 0xe9, 0xff, 0x01, 0xe9, 0xff, 0x01, 0xe9, 0xff, 0x01, 0xea, 0xff, 0x01, 0xea, 0xff, 0x01, 0xaa, 0xff, 0x83, 0xe8, 0xff, 0xfe, 0x65, 0xff, 0xfe, 0x06, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xe6, 0xff, 0xfe, 0x06, 0xff, 0xfe, 0x46, 0xff, 0x4b, 0x09, 0xff, 0x01, 0x8a, 0xff, 0x01, 0xea, 0xff, 0x01, 0xea, 0xff, 0x01, 0x6a, 0xff, 0xac, 0x87, 0xff, 0xfe, 0x05, 0xff, 0xfd, 0xc6, 0xff, 0xfd, 0xa6, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xe5, 0xff, 0xa4, 0x47, 0xff, 0x01, 0x89, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xa9, 0xff, 0x01, 0xe9, 0xff, 0x01, 0xe9, 0xff, 0x01, 0x8a, 0xff, 0x12, 0x29, 0xff, 0xbc, 0xc7, 0xff, 0xfe, 0x45, 0xff, 0xfe, 0x26, 0xff, 0xfe, 0x06, 0xff, 0xfe, 0x06, 0xff, 0xfe, 0x06, 0xff, 0xfe, 0x06, 0xff, 0xfe, 0x26, 0xff, 0xfe, 0x25, 0xff, 0x9c, 0x47, 0xff, 0x01, 0xca, 0xff, 0x01, 0xaa, 0xff, 0x01, 0xe9, 0xff, 0x01, 0xe9, 0xff, 0x01, 0x6a, 0xff, 0x6b, 0x68, 0xff, 0xfe, 0x25, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xc5, 0xff, 0xa4, 0x26, 0xff, 0x01, 0x69, 0xff, 0x01, 0xa9, 0xff, 0x01, 0x89, 0xff, 0x32, 0x88, 0xff, 0x4a, 0xe8, 0xff, 0x01, 0x69, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0x89, 0xff, 0x01, 0xa9, 0xff, 0x53, 0x28, 0xff, 0x8c, 0x07, 0xff, 0xa4, 0x67, 0xff, 0xa4, 0x67, 0xff, 0x83, 0xe7, 0xff, 0x42, 0xe8, 0xff, 0x01, 0x89, 0xff, 0x01, 0x89, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0x49, 0xff, 0x6b, 0x67, 0xff, 0xfe, 0x25, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xc5, 0xff, 0xa4, 0x06, 0xff, 0x01, 0x28, 0xff, 0x01, 0x68, 0xff, 0x22, 0x28, 0xff, 0xfe, 0x25, 0xff, 0xfe, 0x25, 0xff, 0x7b, 0xa7, 0xff, 0x01, 0x29, 0xff, 0x01, 0xa9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xa9, 0xff, 0x01, 0x89, 0xff, 0x01, 0x89, 0xff, 0x01, 0x89, 0xff, 0x01, 0x89, 0xff, 0x01, 0xa9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0xc9, 0xff, 0x01, 0x89, 0xff, 0x01, 0x49, 0xff, 0xac, 0x66, 0xff, 0xfe, 0x25, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x65, 0xff, 0x01, 0x88, 0xff, 0x32, 0x67, 0xff, 0xfe, 0x04, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xe5, 0xff, 0xed, 0x65, 0xff, 0x32, 0x68, 0xff, 0x01, 0x29, 0xff, 0x01, 0x69, 0xff, 0x01, 0x88, 0xff, 0x01, 0xa8, 0xff, 0x01, 0xa8, 0xff, 0x01, 0xa8, 0xff, 0x01, 0xa8, 0xff, 0x01, 0xa8, 0xff, 0x01, 0xa8, 0xff, 0x01, 0x88, 0xff, 0x01, 0x69, 0xff, 0x01, 0x29, 0xff, 0x52, 0xe7, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0xc5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x64, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0xe4, 0xff, 0xfd, 0xe4, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xa5, 0xff, 0xfe, 0x04, 0xff, 0xed, 0x45, 0xff, 0x73, 0x67, 0xff, 0x19, 0xe8, 0xff, 0x01, 0x08, 0xff, 0x01, 0x28, 0xff, 0x01, 0x48, 0xff, 0x01, 0x48, 0xff, 0x01, 0x28, 0xff, 0x01, 0x28, 0xff, 0x22, 0x28, 0xff, 0x83, 0x86, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xe4, 0xff, 0xfd, 0xa5, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0xa4, 0xff, 0xfd, 0xc4, 0xff, 0xfd, 0xe4, 0xff, 0xfd, 0xe4, 0xff, 0xe5, 0x25, 0xff, 0xd4, 0xc5, 0xff, 0xd4, 0xe5, 0xff, 0xed, 0x45, 0xff, 0xfd, 0xe4, 0xff, 0xfd, 0xe4, 0xff, 0xfd, 0xc4, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x85, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0xa4, 0xff, 0xfd, 0xa4, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x84, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x44, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x64, 0xff, 0xfd, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x43, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x83, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x63, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x43, 0xff, 0xfd, 0x43, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0xfd, 0x23, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xfd, 0xff, 0x6c, 0xed, 0xfe, 0xff, 0x6c, 0xec, 0xfd, 0xff, 0x6c, 0xec, 0xfd, 0xff, 0x6b, 0xea, 0xfd, 0xff, 0x6c, 0xeb, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xea, 0xfd, 0xff, 0x6a, 0xea, 0xfe, 0xff, 0x6b, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6f, 0xef, 0xff, 0xff, 0x6f, 0xf1, 0xff, 0xff, 0x6c, 0xec, 0xff, 0xff, 0x6c, 0xec, 0xff, 0xff, 0x6c, 0xec, 0xfd, 0xff, 0x6c, 0xeb, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xfd, 0xff, 0x6c, 0xec, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xe1, 0xfd, 0xff, 0x6b, 0xeb, 0xff, 0xff, 0x6a, 0xea, 0xfe, 0xff, 0x6a, 0xea, 0xfe, 0xff, 0x6a, 0xea, 0xff, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6b, 0xeb, 0xfe, 0xff, 0x6b, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xed, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6b, 0xec, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6c, 0xec, 0xfe, 0xff, 0x6c, 0xec, 0xff, 0xff, 0x6c, 0xef, 0xff, 0xff, 0x6c, 0xec, 0xfd, 0xff, 0x64, 0xe8, 0xfe, 0xff, 0x64, 0xe8, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xe0, 0xfc, 0xff, 0x5c, 0xe0, 0xfc, 0xff, 0x66, 0xe7, 0xff, 0xff, 0x6a, 0xea, 0xfe, 0xff, 0x68, 0xe8, 0xfd, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x67, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x69, 0xea, 0xfe, 0xff, 0x69, 0xea, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x6a, 0xeb, 0xfe, 0xff, 0x69, 0xea, 0xfe, 0xff, 0x69, 0xea, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x67, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x65, 0xe9, 0xff, 0xff, 0x64, 0xeb, 0xfd, 0xff, 0x64, 0xe8, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xde, 0xfc, 0xff, 0x5b, 0xe0, 0xfc, 0xff, 0x60, 0xe2, 0xfc, 0xff, 0x61, 0xe4, 0xfd, 0xff, 0x62, 0xe5, 0xfd, 0xff, 0x63, 0xe6, 0xfc, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x67, 0xe8, 0xfe, 0xff, 0x67, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x68, 0xe9, 0xfe, 0xff, 0x67, 0xe9, 0xfe, 0xff, 0x67, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x62, 0xe5, 0xfd, 0xff, 0x61, 0xe4, 0xfd, 0xff, 0x61, 0xe2, 0xfc, 0xff, 0x64, 0xe8, 0xfe, 0xff, 0x64, 0xe8, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xde, 0xfc, 0xff, 0x5c, 0xde, 0xfc, 0xff, 0x5c, 0xe1, 0xfc, 0xff, 0x5e, 0xe0, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x60, 0xe2, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfe, 0xff, 0x66, 0xe8, 0xfd, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x65, 0xe7, 0xfd, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x63, 0xe6, 0xfc, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x60, 0xe2, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x60, 0xe8, 0xff, 0xff, 0x64, 0xe8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xdd, 0xfc, 0xff, 0x5c, 0xde, 0xfc, 0xff, 0x5b, 0xdd, 0xfc, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x61, 0xe4, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x64, 0xe6, 0xfc, 0xff, 0x63, 0xe6, 0xfc, 0xff, 0x63, 0xe5, 0xfc, 0xff, 0x62, 0xe5, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x59, 0xdd, 0xfd, 0xff, 0x57, 0xd9, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xd5, 0xfc, 0xff, 0x51, 0xd5, 0xfc, 0xff, 0x5a, 0xdd, 0xfc, 0xff, 0x58, 0xdc, 0xfd, 0xff, 0x59, 0xdd, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5e, 0xe0, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x61, 0xe4, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x62, 0xe5, 0xfc, 0xff, 0x62, 0xe5, 0xfc, 0xff, 0x62, 0xe5, 0xfc, 0xff, 0x62, 0xe5, 0xfc, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x62, 0xe4, 0xfd, 0xff, 0x61, 0xe4, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x5f, 0xe1, 0xfd, 0xff, 0x5e, 0xe0, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x59, 0xdd, 0xfd, 0xff, 0x58, 0xdc, 0xfd, 0xff, 0x57, 0xdb, 0xfd, 0xff, 0x57, 0xda, 0xfc, 0xff, 0x56, 0xdb, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xd4, 0xfc, 0xff, 0x51, 0xd4, 0xfc, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x56, 0xd9, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x60, 0xe2, 0xfd, 0xff, 0x60, 0xe2, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x61, 0xe3, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x60, 0xe3, 0xfd, 0xff, 0x60, 0xe2, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x5f, 0xe2, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5e, 0xe0, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x53, 0xd5, 0xfd, 0xff, 0x56, 0xda, 0xfc, 0xff, 0x57, 0xda, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xd6, 0xfc, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x55, 0xd6, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5e, 0xe0, 0xfd, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x61, 0xe1, 0xfe, 0xff, 0x63, 0xe2, 0xff, 0xff, 0x63, 0xe2, 0xff, 0xff, 0x63, 0xe2, 0xff, 0xff, 0x62, 0xe2, 0xff, 0xff, 0x60, 0xe1, 0xfe, 0xff, 0x5e, 0xe1, 0xfd, 0xff, 0x5e, 0xe0, 0xfd, 0xff, 0x5d, 0xe0, 0xfd, 0xff, 0x5d, 0xdf, 0xfd, 0xff, 0x5c, 0xdf, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x59, 0xdd, 0xfd, 0xff, 0x58, 0xdc, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x52, 0xda, 0xfd, 0xff, 0x54, 0xd6, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xd5, 0xfc, 0xff, 0x50, 0xd5, 0xfc, 0xff, 0x50, 0xd5, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x57, 0xdb, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x60, 0xdf, 0xff, 0xff, 0x65, 0xe0, 0xff, 0xff, 0x65, 0xe0, 0xff, 0xff, 0x4f, 0xde, 0xf5, 0xff, 0x3d, 0xdc, 0xeb, 0xff, 0x39, 0xdb, 0xe9, 0xff, 0x3a, 0xdb, 0xea, 0xff, 0x40, 0xdc, 0xed, 0xff, 0x52, 0xde, 0xf7, 0xff, 0x67, 0xe1, 0xff, 0xff, 0x64, 0xe0, 0xff, 0xff, 0x5e, 0xdf, 0xfe, 0xff, 0x5b, 0xde, 0xfd, 0xff, 0x5a, 0xdd, 0xfd, 0xff, 0x59, 0xdd, 0xfd, 0xff, 0x59, 0xdc, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x51, 0xd6, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x50, 0xd0, 0xfc, 0xff, 0x51, 0xd0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xd4, 0xfc, 0xff, 0x50, 0xd6, 0xfd, 0xff, 0x4f, 0xd2, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x54, 0xd7, 0xfd, 0xff, 0x55, 0xd8, 0xfd, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x57, 0xdb, 0xfd, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x5d, 0xdd, 0xff, 0xff, 0x64, 0xde, 0xff, 0xff, 0x3c, 0xd9, 0xea, 0xff, 0x11, 0xd3, 0xd1, 0xff, 0x00, 0xd0, 0xc1, 0xff, 0x00, 0xd1, 0xc2, 0xff, 0x00, 0xd1, 0xc3, 0xff, 0x00, 0xd1, 0xc4, 0xff, 0x00, 0xd1, 0xc4, 0xff, 0x00, 0xd1, 0xc3, 0xff, 0x00, 0xd1, 0xc2, 0xff, 0x00, 0xd1, 0xc2, 0xff, 0x18, 0xd4, 0xd5, 0xff, 0x46, 0xda, 0xf1, 0xff, 0x64, 0xde, 0xff, 0xff, 0x5b, 0xdc, 0xfe, 0xff, 0x58, 0xdb, 0xfd, 0xff, 0x57, 0xda, 0xfd, 0xff, 0x56, 0xda, 0xfd, 0xff, 0x5a, 0xda, 0xff, 0xff, 0x58, 0xd9, 0xff, 0xff, 0x5a, 0xd8, 0xff, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x50, 0xd2, 0xfd, 0xff, 0x50, 0xd0, 0xfc, 0xff, 0x57, 0xd8, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xd6, 0xfe, 0xff, 0x4e, 0xd0, 0xf9, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x53, 0xd7, 0xfd, 0xff, 0x54, 0xd8, 0xfd, 0xff, 0x55, 0xd8, 0xfd, 0xff, 0x56, 0xd9, 0xfd, 0xff, 0x61, 0xdc, 0xff, 0xff, 0x3c, 0xd6, 0xeb, 0xff, 0x00, 0xce, 0xc1, 0xff, 0x00, 0xcd, 0xbe, 0xff, 0x00, 0xcf, 0xc2, 0xff, 0x00, 0xcf, 0xc4, 0xff, 0x00, 0xd0, 0xc5, 0xff, 0x00, 0xd0, 0xc5, 0xff, 0x00, 0xd0, 0xc5, 0xff, 0x00, 0xd0, 0xc5, 0xff, 0x00, 0xd0, 0xc5, 0xff, 0x00, 0xd0, 0xc5, 0xff, 0x00, 0xcf, 0xc4, 0xff, 0x00, 0xce, 0xc1, 0xff, 0x00, 0xcd, 0xbd, 0xff, 0x05, 0xcf, 0xc6, 0xff, 0x49, 0xd8, 0xf3, 0xff, 0x5f, 0xdb, 0xff, 0xff, 0x55, 0xd9, 0xfd, 0xff, 0x5d, 0xda, 0xff, 0xff, 0x34, 0xd3, 0xe5, 0xff, 0x00, 0xc6, 0xaf, 0xff, 0x0f, 0xca, 0xc7, 0xff, 0x58, 0xd6, 0xff, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x4e, 0xd3, 0xfd, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x50, 0xd0, 0xfc, 0xff, 0x50, 0xd0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xd4, 0xfd, 0xff, 0x49, 0xcf, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x4e, 0xd3, 0xfd, 0xff, 0x4f, 0xd4, 0xfd, 0xff, 0x50, 0xd5, 0xfd, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x55, 0xd7, 0xfe, 0xff, 0x5c, 0xd9, 0xff, 0xff, 0x12, 0xcd, 0xcc, 0xff, 0x00, 0xca, 0xb8, 0xff, 0x00, 0xcc, 0xbf, 0xff, 0x00, 0xcc, 0xc1, 0xff, 0x00, 0xcd, 0xc1, 0xff, 0x00, 0xcd, 0xc0, 0xff, 0x00, 0xcd, 0xbe, 0xff, 0x00, 0xcc, 0xbd, 0xff, 0x00, 0xcc, 0xbc, 0xff, 0x00, 0xcc, 0xbc, 0xff, 0x00, 0xcc, 0xbd, 0xff, 0x00, 0xcd, 0xbe, 0xff, 0x00, 0xcd, 0xc0, 0xff, 0x00, 0xcd, 0xc1, 0xff, 0x00, 0xcc, 0xc1, 0xff, 0x00, 0xcb, 0xbe, 0xff, 0x00, 0xc9, 0xb7, 0xff, 0x22, 0xd0, 0xd7, 0xff, 0x65, 0xda, 0xff, 0xff, 0x34, 0xd1, 0xe4, 0xff, 0x00, 0xc6, 0xb2, 0xff, 0x00, 0xc7, 0xb9, 0xff, 0x00, 0xc5, 0xb5, 0xff, 0x58, 0xd5, 0xff, 0xff, 0x4e, 0xd3, 0xfd, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4f, 0xd1, 0xff, 0xff, 0x56, 0xda, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xd6, 0xfe, 0xff, 0x4a, 0xcf, 0xfa, 0xff, 0x47, 0xcc, 0xfb, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x4a, 0xce, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4c, 0xd0, 0xfd, 0xff, 0x4d, 0xd1, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x52, 0xd5, 0xfe, 0xff, 0x56, 0xd6, 0xff, 0xff, 0x01, 0xc8, 0xbc, 0xff, 0x00, 0xc8, 0xb8, 0xff, 0x00, 0xc9, 0xbd, 0xff, 0x00, 0xca, 0xbd, 0xff, 0x00, 0xca, 0xbb, 0xff, 0x00, 0xc9, 0xb6, 0xff, 0x0f, 0xcd, 0xca, 0xff, 0x2e, 0xd3, 0xe1, 0xff, 0x42, 0xd6, 0xef, 0xff, 0x4c, 0xd8, 0xf6, 0xff, 0x4c, 0xd8, 0xf6, 0xff, 0x40, 0xd6, 0xed, 0xff, 0x2a, 0xd2, 0xde, 0xff, 0x08, 0xcc, 0xc5, 0xff, 0x00, 0xc9, 0xb7, 0xff, 0x00, 0xca, 0xbc, 0xff, 0x00, 0xca, 0xbd, 0xff, 0x00, 0xc9, 0xbd, 0xff, 0x00, 0xc7, 0xb7, 0xff, 0x0b, 0xc9, 0xc4, 0xff, 0x00, 0xc5, 0xb4, 0xff, 0x00, 0xc6, 0xb8, 0xff, 0x00, 0xc5, 0xb7, 0xff, 0x00, 0xc3, 0xb4, 0xff, 0x57, 0xd4, 0xff, 0xff, 0x4d, 0xd1, 0xfd, 0xff, 0x4c, 0xd0, 0xfd, 0xff, 0x4b, 0xcf, 0xfd, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x47, 0xcc, 0xfc, 0xff, 0x50, 0xd0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xd7, 0xff, 0xff, 0x45, 0xcc, 0xfd, 0xff, 0x46, 0xcb, 0xfc, 0xff, 0x47, 0xcc, 0xfb, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x56, 0xd5, 0xff, 0xff, 0x01, 0xc5, 0xb9, 0xff, 0x00, 0xc5, 0xb6, 0xff, 0x00, 0xc6, 0xb9, 0xff, 0x00, 0xc7, 0xba, 0xff, 0x00, 0xc6, 0xb3, 0xff, 0x15, 0xcc, 0xcd, 0xff, 0x50, 0xd6, 0xfa, 0xff, 0x5d, 0xd9, 0xff, 0xff, 0x58, 0xd8, 0xff, 0xff, 0x57, 0xd8, 0xff, 0xff, 0x56, 0xd8, 0xfe, 0xff, 0x56, 0xd8, 0xfe, 0xff, 0x57, 0xd8, 0xff, 0xff, 0x59, 0xd8, 0xff, 0xff, 0x5e, 0xd9, 0xff, 0xff, 0x49, 0xd5, 0xf5, 0xff, 0x0a, 0xca, 0xc4, 0xff, 0x00, 0xc6, 0xb4, 0xff, 0x00, 0xc7, 0xba, 0xff, 0x00, 0xc6, 0xb9, 0xff, 0x00, 0xc5, 0xb7, 0xff, 0x00, 0xc5, 0xb7, 0xff, 0x00, 0xc4, 0xb6, 0xff, 0x00, 0xc3, 0xb4, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x55, 0xd3, 0xff, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x50, 0xd0, 0xfc, 0xff, 0x50, 0xd0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xd0, 0xfd, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4b, 0xcf, 0xfd, 0xff, 0x4c, 0xd0, 0xfd, 0xff, 0x56, 0xd3, 0xff, 0xff, 0x10, 0xc5, 0xc4, 0xff, 0x00, 0xc2, 0xb1, 0xff, 0x00, 0xc4, 0xb6, 0xff, 0x00, 0xc4, 0xb6, 0xff, 0x00, 0xc3, 0xb0, 0xff, 0x3a, 0xd0, 0xe9, 0xff, 0x5b, 0xd7, 0xff, 0xff, 0x53, 0xd5, 0xfe, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x51, 0xd6, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x52, 0xd6, 0xfd, 0xff, 0x51, 0xd6, 0xfd, 0xff, 0x51, 0xd5, 0xfd, 0xff, 0x53, 0xd5, 0xfe, 0xff, 0x5c, 0xd7, 0xff, 0xff, 0x30, 0xce, 0xe2, 0xff, 0x00, 0xc4, 0xb3, 0xff, 0x00, 0xc4, 0xb7, 0xff, 0x00, 0xc3, 0xb6, 0xff, 0x00, 0xc3, 0xb5, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xbf, 0xb0, 0xff, 0x53, 0xd1, 0xff, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x48, 0xce, 0xfb, 0xff, 0x47, 0xcd, 0xfb, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x47, 0xcc, 0xfc, 0xff, 0x50, 0xd1, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3e, 0xd0, 0xfd, 0xff, 0x42, 0xc9, 0xff, 0xff, 0x41, 0xc8, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x47, 0xcc, 0xfb, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x4e, 0xd0, 0xff, 0xff, 0x34, 0xca, 0xe6, 0xff, 0x00, 0xbe, 0xa9, 0xff, 0x00, 0xc1, 0xb3, 0xff, 0x00, 0xc1, 0xb3, 0xff, 0x00, 0xc1, 0xac, 0xff, 0x44, 0xd0, 0xf3, 0xff, 0x54, 0xd4, 0xff, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x4f, 0xd4, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x50, 0xd4, 0xfd, 0xff, 0x4f, 0xd4, 0xfd, 0xff, 0x4f, 0xd3, 0xfd, 0xff, 0x57, 0xd5, 0xff, 0xff, 0x35, 0xce, 0xe6, 0xff, 0x00, 0xc2, 0xb0, 0xff, 0x00, 0xc2, 0xb4, 0xff, 0x00, 0xc1, 0xb3, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xc0, 0xb1, 0xff, 0x00, 0xbf, 0xaf, 0xff, 0x00, 0xbd, 0xad, 0xff, 0x51, 0xd0, 0xff, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x47, 0xcc, 0xfb, 0xff, 0x46, 0xcb, 0xfc, 0xff, 0x45, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x42, 0xc9, 0xfc, 0xff, 0x46, 0xcb, 0xfc, 0xff, 0x47, 0xca, 0xfc, 0xff, 0x4e, 0xcc, 0xf7, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3e, 0xd0, 0xfe, 0xff, 0x3f, 0xc7, 0xfd, 0xff, 0x40, 0xc6, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x47, 0xcd, 0xfc, 0xff, 0x51, 0xcf, 0xff, 0xff, 0x00, 0xbd, 0xad, 0xff, 0x00, 0xbe, 0xae, 0xff, 0x00, 0xbf, 0xb0, 0xff, 0x00, 0xbd, 0xa8, 0xff, 0x36, 0xcc, 0xe8, 0xff, 0x52, 0xd2, 0xff, 0xff, 0x4d, 0xd1, 0xfd, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x4d, 0xd2, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x4e, 0xd2, 0xfd, 0xff, 0x55, 0xd4, 0xff, 0xff, 0x30, 0xcc, 0xe1, 0xff, 0x00, 0xbf, 0xa9, 0xff, 0x00, 0xc1, 0xb2, 0xff, 0x00, 0xc0, 0xb1, 0xff, 0x00, 0xbf, 0xb1, 0xff, 0x00, 0xbe, 0xb0, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbd, 0xad, 0xff, 0x00, 0xbb, 0xab, 0xff, 0x4f, 0xce, 0xff, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x42, 0xc8, 0xfb, 0xff, 0x42, 0xc8, 0xfa, 0xff, 0x46, 0xcb, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3e, 0xd0, 0xfd, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x45, 0xca, 0xfc, 0xff, 0x49, 0xcc, 0xff, 0xff, 0x2f, 0xc6, 0xe1, 0xff, 0x00, 0xb9, 0xa4, 0xff, 0x00, 0xbc, 0xac, 0xff, 0x00, 0xbc, 0xaa, 0xff, 0x12, 0xc1, 0xc2, 0xff, 0x53, 0xd1, 0xff, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4b, 0xd0, 0xfd, 0xff, 0x4c, 0xd0, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4c, 0xd1, 0xfd, 0xff, 0x4f, 0xd1, 0xff, 0xff, 0x30, 0xca, 0xe2, 0xff, 0x00, 0xbd, 0xa6, 0xff, 0x00, 0xbf, 0xb0, 0xff, 0x00, 0xbf, 0xb0, 0xff, 0x00, 0xbe, 0xaf, 0xff, 0x00, 0xbd, 0xae, 0xff, 0x00, 0xbd, 0xad, 0xff, 0x00, 0xbc, 0xac, 0xff, 0x00, 0xbb, 0xaa, 0xff, 0x00, 0xb9, 0xa8, 0xff, 0x4d, 0xcd, 0xff, 0xff, 0x45, 0xca, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x42, 0xc9, 0xfc, 0xff, 0x46, 0xcc, 0xfb, 0xff, 0x42, 0xc8, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3f, 0xc9, 0xfd, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x4b, 0xcc, 0xff, 0xff, 0x0d, 0xbb, 0xb8, 0xff, 0x00, 0xb8, 0xa6, 0xff, 0x00, 0xba, 0xaa, 0xff, 0x00, 0xb8, 0xa1, 0xff, 0x45, 0xcc, 0xf9, 0xff, 0x49, 0xcd, 0xfd, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x49, 0xce, 0xfc, 0xff, 0x4a, 0xcf, 0xfc, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x4a, 0xcf, 0xfd, 0xff, 0x52, 0xd1, 0xff, 0xff, 0x00, 0xbd, 0xaa, 0xff, 0x00, 0xbc, 0xaa, 0xff, 0x00, 0xbc, 0xab, 0xff, 0x00, 0xbc, 0xaa, 0xff, 0x00, 0xbb, 0xa9, 0xff, 0x00, 0xba, 0xa8, 0xff, 0x00, 0xba, 0xa7, 0xff, 0x00, 0xb9, 0xa6, 0xff, 0x00, 0xb8, 0xa4, 0xff, 0x00, 0xb6, 0xa1, 0xff, 0x4c, 0xcc, 0xff, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3d, 0xc5, 0xfc, 0xff, 0x44, 0xc8, 0xfb, 0xff, 0x41, 0xc5, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x3e, 0xd0, 0xfe, 0xff, 0x3f, 0xc7, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x3b, 0xc3, 0xfc, 0xff, 0x3c, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x41, 0xc8, 0xfc, 0xff, 0x48, 0xca, 0xff, 0xff, 0x00, 0xb4, 0x9c, 0xff, 0x00, 0xb7, 0xa6, 0xff, 0x00, 0xb7, 0xa5, 0xff, 0x0b, 0xbc, 0xb7, 0xff, 0x4e, 0xcd, 0xff, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x47, 0xcc, 0xfb, 0xff, 0x47, 0xcc, 0xfb, 0xff, 0x47, 0xcd, 0xfb, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x48, 0xcd, 0xfc, 0xff, 0x48, 0xcd, 0xfc, 0xff, 0x48, 0xcd, 0xfc, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x48, 0xcd, 0xfb, 0xff, 0x4b, 0xce, 0xff, 0xff, 0x33, 0xc8, 0xe5, 0xff, 0x0f, 0xbf, 0xbd, 0xff, 0x12, 0xbf, 0xc0, 0xff, 0x12, 0xbf, 0xc0, 0xff, 0x12, 0xbe, 0xbf, 0xff, 0x12, 0xbe, 0xbf, 0xff, 0x12, 0xbd, 0xbe, 0xff, 0x12, 0xbc, 0xbe, 0xff, 0x0f, 0xbb, 0xb9, 0xff, 0x2c, 0xc2, 0xde, 0xff, 0x45, 0xc9, 0xff, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x3e, 0xc8, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x3e, 0xd0, 0xfe, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x39, 0xc0, 0xfc, 0xff, 0x3a, 0xc1, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x41, 0xc7, 0xfe, 0xff, 0x37, 0xc4, 0xef, 0xff, 0x00, 0xb2, 0x9a, 0xff, 0x00, 0xb5, 0xa4, 0xff, 0x00, 0xb5, 0x9f, 0xff, 0x24, 0xc1, 0xd4, 0xff, 0x48, 0xcb, 0xff, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x45, 0xcb, 0xfc, 0xff, 0x46, 0xcb, 0xfc, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x46, 0xcc, 0xfb, 0xff, 0x46, 0xcc, 0xfb, 0xff, 0x46, 0xcc, 0xfb, 0xff, 0x46, 0xcc, 0xfb, 0xff, 0x46, 0xcc, 0xfb, 0xff, 0x46, 0xcc, 0xfb, 0xff, 0x46, 0xcc, 0xfc, 0xff, 0x49, 0xcc, 0xff, 0xff, 0x4c, 0xcd, 0xff, 0xff, 0x4b, 0xcc, 0xff, 0xff, 0x4b, 0xcc, 0xff, 0xff, 0x4a, 0xcc, 0xff, 0xff, 0x4a, 0xcb, 0xff, 0xff, 0x49, 0xcb, 0xff, 0xff, 0x45, 0xd3, 0xff, 0xff, 0x43, 0xd6, 0xff, 0xff, 0x41, 0xd0, 0xff, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x38, 0xbe, 0xfc, 0xff, 
-  0x35, 0xc0, 0xfe, 0xff, 0x37, 0xc4, 0xff, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x3b, 0xc3, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x41, 0xc6, 0xff, 0xff, 0x2a, 0xbf, 0xdd, 0xff, 0x00, 0xb0, 0x99, 0xff, 0x00, 0xb3, 0xa1, 0xff, 0x00, 0xb2, 0x9b, 0xff, 0x32, 0xc4, 0xe7, 0xff, 0x44, 0xc9, 0xff, 0xff, 0x42, 0xc9, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xca, 0xfc, 0xff, 0x44, 0xc9, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x42, 0xc9, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x3e, 0xd2, 0xff, 0xff, 0x5b, 0x7d, 0x59, 0xff, 0x6b, 0x4d, 0x00, 0xff, 0x55, 0x86, 0x72, 0xff, 0x3b, 0xcf, 0xff, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x38, 0xbe, 0xfc, 0xff, 
-  0x34, 0xc0, 0xfe, 0xff, 0x36, 0xc2, 0xff, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x36, 0xbf, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x3a, 0xc1, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x3b, 0xc3, 0xfc, 0xff, 0x3f, 0xc4, 0xff, 0xff, 0x25, 0xbc, 0xd7, 0xff, 0x00, 0xae, 0x97, 0xff, 0x00, 0xb1, 0x9f, 0xff, 0x00, 0xaf, 0x96, 0xff, 0x38, 0xc3, 0xf1, 0xff, 0x42, 0xc7, 0xfe, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x41, 0xc8, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x42, 0xc9, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x43, 0xc9, 0xfc, 0xff, 0x42, 0xc9, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x42, 0xc8, 0xfc, 0xff, 0x41, 0xc8, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x3f, 0xcb, 0xff, 0xff, 0x49, 0xa9, 0xbd, 0xff, 0x6c, 0x41, 0x00, 0xff, 0x66, 0x4f, 0x00, 0xff, 0x6b, 0x3d, 0x00, 0xff, 0x41, 0xb5, 0xdb, 0xff, 0x3b, 0xc6, 0xff, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x35, 0xbe, 0xfc, 0xff, 0x34, 0xbc, 0xfb, 0xff, 0x38, 0xbe, 0xfc, 0xff, 
-  0x33, 0xbd, 0xfb, 0xff, 0x34, 0xc0, 0xff, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x39, 0xc0, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x3c, 0xc3, 0xff, 0xff, 0x2b, 0xbd, 0xe1, 0xff, 0x00, 0xab, 0x8c, 0xff, 0x00, 0xae, 0x98, 0xff, 0x00, 0xac, 0x8d, 0xff, 0x3f, 0xc5, 0xfe, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x40, 0xc6, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x41, 0xc7, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x40, 0xc7, 0xfc, 0xff, 0x40, 0xc6, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x3f, 0xc6, 0xfc, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3c, 0xcb, 0xff, 0xff, 0x4c, 0x9a, 0x9f, 0xff, 0x66, 0x47, 0x00, 0xff, 0x63, 0x4e, 0x00, 0xff, 0x65, 0x42, 0x00, 0xff, 0x41, 0xae, 0xd0, 0xff, 0x39, 0xc5, 0xff, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x39, 0xc0, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfb, 0xff, 0x35, 0xbc, 0xfc, 0xff, 0x37, 0xbe, 0xfb, 0xff, 
-  0x33, 0xbf, 0xfe, 0xff, 0x33, 0xc0, 0xff, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x35, 0xbe, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x39, 0xc0, 0xfc, 0xff, 0x3e, 0xc3, 0xff, 0xff, 0x1e, 0xb7, 0xcc, 0xff, 0x0c, 0xb1, 0xae, 0xff, 0x2d, 0xbe, 0xe5, 0xff, 0x3f, 0xc4, 0xff, 0xff, 0x3c, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3f, 0xc5, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3e, 0xc5, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3a, 0xcb, 0xff, 0xff, 0x4e, 0x8b, 0x83, 0xff, 0x63, 0x45, 0x00, 0xff, 0x60, 0x4c, 0x00, 0xff, 0x62, 0x3e, 0x00, 0xff, 0x3c, 0xb8, 0xe7, 0xff, 0x38, 0xc2, 0xff, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x31, 0xbb, 0xfb, 0xff, 0x30, 0xb8, 0xfc, 0xff, 0x2e, 0xb7, 0xfb, 0xff, 
-  0x33, 0xbe, 0xfe, 0xff, 0x31, 0xc0, 0xff, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x35, 0xbe, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x37, 0xc1, 0xff, 0xff, 0x38, 0xcd, 0xff, 0xff, 0x3a, 0xd0, 0xff, 0xff, 0x38, 0xcf, 0xff, 0xff, 0x36, 0xcf, 0xff, 0xff, 0x37, 0xcf, 0xff, 0xff, 0x37, 0xd0, 0xff, 0xff, 0x37, 0xd0, 0xff, 0xff, 0x38, 0xd0, 0xff, 0xff, 0x38, 0xcf, 0xff, 0xff, 0x3c, 0xc6, 0xff, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3d, 0xc4, 0xfc, 0xff, 0x3c, 0xc4, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3c, 0xc3, 0xfc, 0xff, 0x3b, 0xc3, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x37, 0xcd, 0xff, 0xff, 0x55, 0x6a, 0x41, 0xff, 0x5f, 0x46, 0x00, 0xff, 0x5d, 0x49, 0x00, 0xff, 0x60, 0x3a, 0x00, 0xff, 0x34, 0xcc, 0xff, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x35, 0xbe, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x30, 0xb8, 0xfc, 0xff, 0x30, 0xb9, 0xfb, 0xff, 0x2f, 0xb8, 0xfa, 0xff, 
-  0x32, 0xbe, 0xfe, 0xff, 0x31, 0xc2, 0xff, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x33, 0xbb, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x35, 0xbf, 0xff, 0xff, 0x36, 0xbd, 0xf9, 0xff, 0x56, 0x4f, 0x11, 0xff, 0x5a, 0x47, 0x00, 0xff, 0x5b, 0x4a, 0x02, 0xff, 0x5b, 0x4a, 0x02, 0xff, 0x5c, 0x4b, 0x02, 0xff, 0x5d, 0x4b, 0x02, 0xff, 0x5e, 0x4c, 0x02, 0xff, 0x5e, 0x4b, 0x00, 0xff, 0x5e, 0x4f, 0x06, 0xff, 0x3d, 0xba, 0xeb, 0xff, 0x3a, 0xc4, 0xff, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3b, 0xc2, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x3a, 0xc2, 0xfc, 0xff, 0x3a, 0xc1, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x39, 0xc2, 0xfd, 0xff, 0x35, 0xcd, 0xff, 0xff, 0x5e, 0x3f, 0x00, 0xff, 0x5b, 0x47, 0x00, 0xff, 0x5b, 0x44, 0x00, 0xff, 0x54, 0x56, 0x20, 0xff, 0x32, 0xca, 0xff, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x2f, 0xb9, 0xfc, 0xff, 0x30, 0xb9, 0xfb, 0xff, 0x30, 0xb9, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2d, 0xbd, 0xfd, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2f, 0xb9, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x32, 0xc2, 0xff, 0xff, 0x40, 0x8f, 0x9d, 0xff, 0x59, 0x38, 0x00, 0xff, 0x57, 0x44, 0x00, 0xff, 0x58, 0x44, 0x00, 0xff, 0x59, 0x45, 0x00, 0xff, 0x5a, 0x46, 0x00, 0xff, 0x5b, 0x46, 0x00, 0xff, 0x5b, 0x47, 0x00, 0xff, 0x5c, 0x47, 0x00, 0xff, 0x60, 0x39, 0x00, 0xff, 0x48, 0x8e, 0x92, 0xff, 0x37, 0xc6, 0xff, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x39, 0xc1, 0xfc, 0xff, 0x39, 0xc0, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x38, 0xc0, 0xfc, 0xff, 0x35, 0xc6, 0xff, 0xff, 0x44, 0x91, 0x9b, 0xff, 0x5b, 0x3d, 0x00, 0xff, 0x58, 0x46, 0x00, 0xff, 0x59, 0x3d, 0x00, 0xff, 0x45, 0x80, 0x7e, 0xff, 0x32, 0xc4, 0xff, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x32, 0xbb, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x2e, 0xb7, 0xfc, 0xff, 0x2d, 0xb6, 0xfc, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0xb4, 0xfa, 0xff, 0x2b, 0xb5, 0xfb, 0xff, 0x2a, 0xb5, 0xfb, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2f, 0xb9, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x30, 0xc0, 0xff, 0xff, 0x3e, 0x8e, 0x9f, 0xff, 0x55, 0x38, 0x00, 0xff, 0x54, 0x43, 0x00, 0xff, 0x55, 0x43, 0x00, 0xff, 0x56, 0x44, 0x00, 0xff, 0x56, 0x45, 0x00, 0xff, 0x57, 0x45, 0x00, 0xff, 0x58, 0x46, 0x00, 0xff, 0x5a, 0x3f, 0x00, 0xff, 0x54, 0x55, 0x1e, 0xff, 0x33, 0xc9, 0xff, 0xff, 0x37, 0xbf, 0xfd, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x37, 0xbf, 0xfc, 0xff, 0x36, 0xbf, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x36, 0xbe, 0xfc, 0xff, 0x35, 0xbf, 0xfd, 0xff, 0x32, 0xcb, 0xff, 0xff, 0x58, 0x3f, 0x00, 0xff, 0x56, 0x42, 0x00, 0xff, 0x55, 0x43, 0x00, 0xff, 0x58, 0x33, 0x00, 0xff, 0x33, 0xbb, 0xfb, 0xff, 0x31, 0xbd, 0xff, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2d, 0xb4, 0xfc, 0xff, 0x2d, 0xb6, 0xfc, 0xff, 0x1d, 0xae, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x28, 0xb4, 0xfa, 0xff, 0x29, 0xb3, 0xfa, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2d, 0xb6, 0xfb, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x2e, 0xbf, 0xff, 0xff, 0x3b, 0x8d, 0x9f, 0xff, 0x52, 0x36, 0x00, 0xff, 0x51, 0x40, 0x00, 0xff, 0x52, 0x41, 0x00, 0xff, 0x53, 0x42, 0x00, 0xff, 0x53, 0x42, 0x00, 0xff, 0x54, 0x43, 0x00, 0xff, 0x56, 0x3d, 0x00, 0xff, 0x51, 0x53, 0x1f, 0xff, 0x30, 0xcb, 0xff, 0xff, 0x34, 0xbe, 0xfe, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x35, 0xbd, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x34, 0xbd, 0xfc, 0xff, 0x2f, 0xcd, 0xff, 0xff, 0x4b, 0x64, 0x45, 0xff, 0x55, 0x3b, 0x00, 0xff, 0x52, 0x41, 0x00, 0xff, 0x53, 0x3b, 0x00, 0xff, 0x47, 0x64, 0x4b, 0xff, 0x2e, 0xc6, 0xff, 0xff, 0x30, 0xb9, 0xfc, 0xff, 0x2f, 0xb9, 0xfc, 0xff, 0x2f, 0xb8, 0xfc, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x28, 0xb1, 0xfa, 0xff, 0x26, 0xb0, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x28, 0xb4, 0xfa, 0xff, 0x28, 0xb3, 0xfa, 0xff, 0x29, 0xb4, 0xfb, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2c, 0xbe, 0xff, 0xff, 0x39, 0x8b, 0x9f, 0xff, 0x4f, 0x34, 0x00, 0xff, 0x4e, 0x3e, 0x00, 0xff, 0x4f, 0x3f, 0x00, 0xff, 0x50, 0x3f, 0x00, 0xff, 0x50, 0x40, 0x00, 0xff, 0x52, 0x3e, 0x00, 0xff, 0x4e, 0x50, 0x1f, 0xff, 0x2c, 0xd3, 0xff, 0xff, 0x32, 0xbd, 0xff, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x33, 0xbc, 0xfc, 0xff, 0x32, 0xbc, 0xfd, 0xff, 0x2e, 0xcc, 0xff, 0xff, 0x43, 0x77, 0x70, 0xff, 0x54, 0x34, 0x00, 0xff, 0x50, 0x40, 0x00, 0xff, 0x50, 0x3e, 0x00, 0xff, 0x52, 0x2f, 0x00, 0xff, 0x2f, 0xbc, 0xff, 0xff, 0x2f, 0xba, 0xff, 0xff, 0x2e, 0xb8, 0xfc, 0xff, 0x2e, 0xb7, 0xfc, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x27, 0xb1, 0xfb, 0xff, 0x27, 0xb1, 0xfa, 0xff, 0x1d, 0xb0, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xb4, 0xfa, 0xff, 0x28, 0xb4, 0xfa, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x29, 0xb4, 0xfb, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2b, 0xbc, 0xff, 0xff, 0x37, 0x89, 0x9f, 0xff, 0x4c, 0x31, 0x00, 0xff, 0x4b, 0x3b, 0x00, 0xff, 0x4c, 0x3c, 0x00, 0xff, 0x4c, 0x3d, 0x00, 0xff, 0x4d, 0x3d, 0x00, 0xff, 0x4e, 0x3e, 0x00, 0xff, 0x51, 0x35, 0x00, 0xff, 0x40, 0x7b, 0x7d, 0xff, 0x2c, 0xcc, 0xff, 0xff, 0x30, 0xbf, 0xff, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x31, 0xba, 0xfc, 0xff, 0x31, 0xbb, 0xfd, 0xff, 0x2f, 0xc1, 0xff, 0xff, 0x2d, 0xc7, 0xff, 0xff, 0x47, 0x61, 0x46, 0xff, 0x51, 0x32, 0x00, 0xff, 0x4e, 0x3e, 0x00, 0xff, 0x4d, 0x3d, 0x00, 0xff, 0x50, 0x2c, 0x00, 0xff, 0x38, 0x90, 0xab, 0xff, 0x2c, 0xbf, 0xff, 0xff, 0x2d, 0xb7, 0xfc, 0xff, 0x2d, 0xb6, 0xfb, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x27, 0xb3, 0xfb, 0xff, 0x27, 0xb3, 0xfb, 0xff, 0x27, 0xb1, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb0, 0xfa, 0xff, 0x1f, 0xac, 0xf9, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x29, 0xbb, 0xff, 0xff, 0x35, 0x87, 0x9f, 0xff, 0x49, 0x2f, 0x00, 0xff, 0x48, 0x39, 0x00, 0xff, 0x49, 0x3a, 0x00, 0xff, 0x4a, 0x37, 0x00, 0xff, 0x4b, 0x36, 0x00, 0xff, 0x4b, 0x3b, 0x00, 0xff, 0x4b, 0x3c, 0x00, 0xff, 0x4e, 0x32, 0x00, 0xff, 0x4b, 0x44, 0x0e, 0xff, 0x37, 0x99, 0xbc, 0xff, 0x2b, 0xc9, 0xff, 0xff, 0x2d, 0xc3, 0xff, 0xff, 0x2e, 0xc0, 0xff, 0xff, 0x2e, 0xbf, 0xff, 0xff, 0x2e, 0xbf, 0xff, 0xff, 0x2d, 0xc0, 0xff, 0xff, 0x2d, 0xc4, 0xff, 0xff, 0x2c, 0xc6, 0xff, 0xff, 0x3a, 0x88, 0x99, 0xff, 0x4e, 0x37, 0x00, 0xff, 0x4e, 0x35, 0x00, 0xff, 0x4b, 0x3c, 0x00, 0xff, 0x4b, 0x3b, 0x00, 0xff, 0x4d, 0x2d, 0x00, 0xff, 0x3e, 0x6d, 0x67, 0xff, 0x29, 0xc5, 0xff, 0xff, 0x2c, 0xb6, 0xfb, 0xff, 0x2b, 0xb5, 0xfb, 0xff, 0x2b, 0xb5, 0xfa, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb1, 0xfa, 0xff, 0x27, 0xb1, 0xfa, 0xff, 0x26, 0xb0, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xb3, 0xfb, 0xff, 0x25, 0xaf, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x28, 0xb2, 0xfb, 0xff, 0x27, 0xb9, 0xff, 0xff, 0x33, 0x85, 0x9f, 0xff, 0x46, 0x2c, 0x00, 0xff, 0x45, 0x36, 0x00, 0xff, 0x47, 0x2f, 0x00, 0xff, 0x41, 0x52, 0x33, 0xff, 0x3f, 0x5d, 0x4a, 0xff, 0x4a, 0x2c, 0x00, 0xff, 0x48, 0x39, 0x00, 0xff, 0x49, 0x3a, 0x00, 0xff, 0x4a, 0x37, 0x00, 0xff, 0x4c, 0x2f, 0x00, 0xff, 0x4b, 0x36, 0x00, 0xff, 0x40, 0x64, 0x53, 0xff, 0x3a, 0x80, 0x8c, 0xff, 0x38, 0x8b, 0xa2, 0xff, 0x37, 0x8b, 0xa3, 0xff, 0x3b, 0x7c, 0x84, 0xff, 0x42, 0x5b, 0x41, 0xff, 0x4c, 0x2f, 0x00, 0xff, 0x4c, 0x31, 0x00, 0xff, 0x4a, 0x38, 0x00, 0xff, 0x49, 0x3a, 0x00, 0xff, 0x48, 0x38, 0x00, 0xff, 0x4b, 0x28, 0x00, 0xff, 0x3c, 0x6c, 0x66, 0xff, 0x27, 0xc6, 0xff, 0xff, 0x2a, 0xb5, 0xfb, 0xff, 0x2a, 0xb4, 0xfa, 0xff, 0x29, 0xb4, 0xfa, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x28, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x25, 0xb1, 0xfb, 0xff, 0x27, 0xb1, 0xfa, 0xff, 0x27, 0xb1, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xaf, 0xf9, 0xff, 0x20, 0xac, 0xf9, 0xff, 0x21, 0xac, 0xf9, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x25, 0xb7, 0xff, 0xff, 0x30, 0x82, 0x9d, 0xff, 0x44, 0x26, 0x00, 0xff, 0x44, 0x2b, 0x00, 0xff, 0x3f, 0x44, 0x1f, 0xff, 0x26, 0xc3, 0xff, 0xff, 0x26, 0xc5, 0xff, 0xff, 0x38, 0x73, 0x78, 0xff, 0x49, 0x25, 0x00, 0xff, 0x47, 0x33, 0x00, 0xff, 0x46, 0x37, 0x00, 0xff, 0x46, 0x38, 0x00, 0xff, 0x47, 0x37, 0x00, 0xff, 0x48, 0x33, 0x00, 0xff, 0x49, 0x30, 0x00, 0xff, 0x49, 0x2f, 0x00, 0xff, 0x49, 0x2f, 0x00, 0xff, 0x49, 0x30, 0x00, 0xff, 0x48, 0x33, 0x00, 0xff, 0x47, 0x37, 0x00, 0xff, 0x46, 0x38, 0x00, 0xff, 0x46, 0x37, 0x00, 0xff, 0x47, 0x31, 0x00, 0xff, 0x48, 0x27, 0x00, 0xff, 0x32, 0x8c, 0xaa, 0xff, 0x26, 0xc3, 0xff, 0xff, 0x29, 0xb4, 0xfb, 0xff, 0x29, 0xb3, 0xfb, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x28, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x27, 0xb1, 0xfb, 0xff, 0x1d, 0xb0, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xa8, 0xf8, 0xff, 0x1d, 0xa9, 0xf9, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x24, 0xb2, 0xfe, 0xff, 0x26, 0xae, 0xf6, 0xff, 0x3e, 0x32, 0x00, 0xff, 0x3a, 0x4b, 0x32, 0xff, 0x24, 0xc0, 0xff, 0xff, 0x27, 0xb4, 0xfd, 0xff, 0x28, 0xb3, 0xfb, 0xff, 0x26, 0xbe, 0xff, 0xff, 0x2a, 0xab, 0xeb, 0xff, 0x3e, 0x4d, 0x2f, 0xff, 0x46, 0x24, 0x00, 0xff, 0x45, 0x2e, 0x00, 0xff, 0x44, 0x32, 0x00, 0xff, 0x44, 0x35, 0x00, 0xff, 0x44, 0x36, 0x00, 0xff, 0x44, 0x36, 0x00, 0xff, 0x44, 0x36, 0x00, 0xff, 0x44, 0x36, 0x00, 0xff, 0x44, 0x35, 0x00, 0xff, 0x44, 0x32, 0x00, 0xff, 0x45, 0x2d, 0x00, 0xff, 0x46, 0x24, 0x00, 0xff, 0x3b, 0x5b, 0x4d, 0xff, 0x28, 0xb6, 0xff, 0xff, 0x26, 0xba, 0xff, 0xff, 0x28, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x27, 0xb2, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x26, 0xb0, 0xfb, 0xff, 0x1e, 0xad, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xa8, 0xf8, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x1f, 0xaa, 0xf9, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x23, 0xb1, 0xfe, 0xff, 0x22, 0xbc, 0xff, 0xff, 0x22, 0xbb, 0xff, 0xff, 0x25, 0xb1, 0xfc, 0xff, 0x25, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb4, 0xff, 0xff, 0x24, 0xc0, 0xff, 0xff, 0x29, 0xa8, 0xe6, 0xff, 0x35, 0x6b, 0x6f, 0xff, 0x3e, 0x3e, 0x15, 0xff, 0x44, 0x22, 0x00, 0xff, 0x43, 0x26, 0x00, 0xff, 0x43, 0x27, 0x00, 0xff, 0x43, 0x27, 0x00, 0xff, 0x43, 0x25, 0x00, 0xff, 0x44, 0x24, 0x00, 0xff, 0x3d, 0x43, 0x20, 0xff, 0x34, 0x72, 0x7d, 0xff, 0x27, 0xb1, 0xf9, 0xff, 0x24, 0xbe, 0xff, 0xff, 0x26, 0xb3, 0xfe, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x26, 0xb1, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x27, 0xb1, 0xfa, 0xff, 0x1c, 0xad, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xaa, 0xf8, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x24, 0xb3, 0xff, 0xff, 0x24, 0xb9, 0xff, 0xff, 0x23, 0xbe, 0xff, 0xff, 0x23, 0xbb, 0xff, 0xff, 0x28, 0xa5, 0xe3, 0xff, 0x2a, 0x9a, 0xce, 0xff, 0x29, 0x9c, 0xd3, 0xff, 0x27, 0xa7, 0xe7, 0xff, 0x23, 0xbe, 0xff, 0xff, 0x23, 0xbd, 0xff, 0xff, 0x24, 0xb8, 0xff, 0xff, 0x25, 0xb2, 0xfe, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x25, 0xb0, 0xfb, 0xff, 0x24, 0xb0, 0xfb, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x1d, 0xa9, 0xfb, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xaa, 0xf8, 0xff, 0x1c, 0xaa, 0xfa, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xb0, 0xfc, 0xff, 0x23, 0xb2, 0xff, 0xff, 0x23, 0xb3, 0xff, 0xff, 0x23, 0xb3, 0xff, 0xff, 0x23, 0xb2, 0xff, 0xff, 0x24, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xaf, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x23, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1e, 0xab, 0xfb, 0xff, 0x1e, 0xab, 0xfc, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xa9, 0xf8, 0xff, 0x1c, 0xa9, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xae, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x22, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x21, 0xad, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1e, 0xab, 0xfb, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfb, 0xff, 0x1d, 0xa9, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xa9, 0xf8, 0xff, 0x18, 0xa8, 0xfe, 0xff, 0x19, 0xa9, 0xfb, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1d, 0xa9, 0xf9, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x20, 0xac, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1f, 0xab, 0xfb, 0xff, 0x1e, 0xab, 0xfb, 0xff, 0x1e, 0xab, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1d, 0xaa, 0xfb, 0xff, 0x1d, 0xa9, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xa8, 0xf9, 0xff, 0x16, 0xa8, 0xfe, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1c, 0xa8, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1d, 0xa9, 0xf9, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1e, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xaa, 0xfa, 0xff, 0x1d, 0xa9, 0xfa, 0xff, 0x1d, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1c, 0xa8, 0xf9, 0xff, 0x1d, 0xab, 0xfa, 0xff, 0x1d, 0xa9, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xa8, 0xff, 0xff, 0x16, 0xa8, 0xff, 0xff, 0x16, 0xa8, 0xfc, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1b, 0xa8, 0xf9, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x18, 0xa6, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xa8, 0xfe, 0xff, 0x16, 0xa8, 0xff, 0xff, 0x18, 0xa8, 0xfe, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x19, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x1a, 0xa7, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x19, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xa8, 0xfe, 0xff, 0x16, 0xab, 0xff, 0xff, 0x17, 0xa9, 0xff, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa6, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x18, 0xa5, 0xfa, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x17, 0xa5, 0xfa, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x1a, 0xaa, 0xfd, 0xff, 0x1c, 0xac, 0xf9, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xa8, 0xfe, 0xff, 0x17, 0xad, 0xff, 0xff, 0x16, 0xa8, 0xff, 0xff, 0x16, 0xa8, 0xff, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xf9, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x19, 0xa9, 0xfc, 0xff, 0x1c, 0xaa, 0xfa, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xa9, 0xff, 0xff, 0x15, 0xa8, 0xfc, 0xff, 0x15, 0xa7, 0xfd, 0xff, 0x16, 0xaf, 0xff, 0xff, 0x16, 0xad, 0xff, 0xff, 0x15, 0xa8, 0xff, 0xff, 0x15, 0xa7, 0xfa, 0xff, 0x15, 0xa4, 0xf9, 0xff, 0x15, 0xa8, 0xfe, 0xff, 0x16, 0xa4, 0xf9, 0xff, 0x1a, 0xaa, 0xfa, 0xff, 0x1b, 0xab, 0xfa, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x1c, 0xa9, 0xf8, 0xff, 0x1c, 0xa9, 0xf9, 0xff, 0x1c, 0xa8, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xa8, 0xfe, 0xff, 0x15, 0xa8, 0xfd, 0xff, 0x16, 0xa4, 0xf9, 0xff, 0x16, 0xa4, 0xf9, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x16, 0xa4, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t reset_timer = {
-  .header.always_zero = 0,
-  .header.w = 50,
-  .header.h = 50,
-  .data_size = 2500 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = reset_timer_map,
-};
-
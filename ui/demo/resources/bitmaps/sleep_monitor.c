@@ -1,250 +0,0 @@
-/**
- ****************************************************************************************
- *
- * @file sleep_monitor.c
- *
- * @brief Sleep monitor icon source file
- *
- * Copyright (C) 2021-2022 Dialog Semiconductor.
- * This computer program includes Confidential, Proprietary Information
- * of Dialog Semiconductor. All Rights Reserved.
- *
- ****************************************************************************************
- */
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_SLEEP_MONITOR
-#define LV_ATTRIBUTE_IMG_SLEEP_MONITOR
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_SLEEP_MONITOR uint8_t sleep_monitor_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x29, 0xff, 0x29, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x24, 0xff, 0x24, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x24, 0xff, 0x24, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x37, 0xff, 0x24, 0xff, 0x24, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x36, 0xff, 0x24, 0xff, 0x24, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x36, 0xff, 0x24, 0xff, 0x24, 0xff, 0x3b, 0xff, 0x9b, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x36, 0xff, 0x24, 0xff, 0x24, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x24, 0xff, 0x24, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x25, 0xff, 0x25, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 
-  0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x24, 0xff, 0x20, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x24, 0xff, 0x24, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 
-  0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x24, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x24, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 
-  0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x24, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 
-  0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x24, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 
-  0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x24, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 
-  0x00, 0x00, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x24, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x24, 0xff, 0x20, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x17, 0xff, 0x24, 0xff, 0x24, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x36, 0xff, 0x32, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x20, 0xff, 0x20, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x37, 0xff, 0x24, 0xff, 0x24, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x32, 0xff, 0x20, 0xff, 0x20, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x20, 0xff, 0x20, 0xff, 0x32, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x32, 0xff, 0x20, 0xff, 0x20, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x20, 0xff, 0x20, 0xff, 0x32, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x36, 0xff, 0x32, 0xff, 0x36, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x37, 0xff, 0x32, 0xff, 0x20, 0xff, 0x20, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x20, 0xff, 0x20, 0xff, 0x2e, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x32, 0xff, 0x25, 0xff, 0x25, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x37, 0xff, 0x25, 0xff, 0x25, 0xff, 0x32, 0xff, 0x37, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x36, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x32, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x32, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0x1d, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x3d, 0x4f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x1c, 0x4f, 0xff, 0x1c, 0x4f, 0xff, 0x3c, 0x4f, 0xff, 0x1d, 0x4f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x4e, 0xff, 0xfc, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xfc, 0x4e, 0xff, 0x1c, 0x4f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x4e, 0xff, 0x9b, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xfc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xdc, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdc, 0x4e, 0xff, 0xdc, 0x4e, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xdb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0xbb, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x3a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x9b, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x9b, 0x46, 0xff, 0x9b, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x3a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x9a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x3a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0x9b, 0x3e, 0xff, 0xbb, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x7a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0x9b, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x3a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x46, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0x9a, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x7a, 0x3e, 0xff, 0x7b, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x3a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x5a, 0x3e, 0xff, 0x3a, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf9, 0x35, 0xff, 0x35, 0x35, 0xff, 0xe7, 0x29, 0xff, 0xc7, 0x31, 0xff, 0x3a, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xf8, 0x35, 0xff, 0xf4, 0x34, 0xff, 0xc3, 0x28, 0xff, 0xa2, 0x28, 0xff, 0x3a, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x39, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf4, 0x34, 0xff, 0xe3, 0x28, 0xff, 0xc3, 0x28, 0xff, 0x39, 0x3e, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf4, 0x34, 0xff, 0xe3, 0x28, 0xff, 0xc3, 0x28, 0xff, 0x19, 0x36, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0x19, 0x3e, 0xff, 0x19, 0x3e, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf9, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x97, 0x2d, 0xff, 0x97, 0x35, 0xff, 0xb8, 0x35, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x56, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x76, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd4, 0x34, 0xff, 0xc3, 0x28, 0xff, 0xc3, 0x28, 0xff, 0x19, 0x36, 0xff, 0xb8, 0x2d, 0xff, 0xb7, 0x25, 0xff, 0xb8, 0x25, 0xff, 0xb8, 0x25, 0xff, 0xb8, 0x25, 0xff, 0xb8, 0x25, 0xff, 0xd8, 0x2d, 0xff, 0xd8, 0x35, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xf8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x97, 0x35, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xd4, 0x34, 0xff, 0xc3, 0x28, 0xff, 0xa3, 0x28, 0xff, 0xd8, 0x25, 0xff, 0x59, 0x76, 0xff, 0x1b, 0xcf, 0xff, 0x1b, 0xcf, 0xff, 0x1b, 0xcf, 0xff, 0x3b, 0xcf, 0xff, 0x3c, 0xcf, 0xff, 0xfb, 0xb6, 0xff, 0xd8, 0x3d, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x97, 0x35, 0xff, 0xb3, 0x2c, 0xff, 0xc3, 0x20, 0xff, 0x82, 0x20, 0xff, 0x7a, 0x76, 0xff, 0xbd, 0xff, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x9d, 0xf7, 0xff, 0x7c, 0xef, 0xff, 0x97, 0x25, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xd8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb8, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x97, 0x35, 0xff, 0x97, 0x35, 0xff, 0xf9, 0x35, 0xff, 0xf9, 0x35, 0xff, 0xb7, 0x35, 0xff, 0x77, 0x35, 0xff, 0x77, 0x2d, 0xff, 0x76, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0x36, 0x2d, 0xff, 0x00, 0x00, 0x00, 
-  0x16, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x97, 0x2d, 0xff, 0xb3, 0x2c, 0xff, 0xc3, 0x20, 0xff, 0x82, 0x20, 0xff, 0xf8, 0x45, 0xff, 0x9c, 0xff, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x7c, 0xf7, 0xff, 0x1b, 0xc7, 0xff, 0x77, 0x15, 0xff, 0x97, 0x25, 0xff, 0x97, 0x25, 0xff, 0x97, 0x25, 0xff, 0x97, 0x25, 0xff, 0x97, 0x25, 0xff, 0x97, 0x25, 0xff, 0x97, 0x25, 0xff, 0x97, 0x25, 0xff, 0x77, 0x25, 0xff, 0x77, 0x25, 0xff, 0x77, 0x25, 0xff, 0x77, 0x25, 0xff, 0x77, 0x25, 0xff, 0x77, 0x1d, 0xff, 0x57, 0x25, 0xff, 0xd8, 0x25, 0xff, 0x86, 0x29, 0xff, 0x66, 0x29, 0xff, 0x52, 0x2c, 0xff, 0x97, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x56, 0x2d, 0xff, 
-  0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x93, 0x2c, 0xff, 0xa3, 0x20, 0xff, 0x62, 0x18, 0xff, 0xfc, 0x8e, 0xff, 0xdc, 0xa6, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x7d, 0xdf, 0xff, 0x9b, 0x86, 0xff, 0xbb, 0x96, 0xff, 0x3b, 0xdf, 0xff, 0x3b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x1b, 0xd7, 0xff, 0x3b, 0xd7, 0xff, 0x1b, 0xc7, 0xff, 0x5e, 0x9f, 0xff, 0x82, 0x18, 0xff, 0xa2, 0x20, 0xff, 0x11, 0x2c, 0xff, 0x77, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 
-  0x35, 0x2d, 0xff, 0x15, 0x25, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x77, 0x2d, 0xff, 0x93, 0x2c, 0xff, 0xa2, 0x20, 0xff, 0x41, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x9d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x82, 0x10, 0xff, 0xa3, 0x20, 0xff, 0x11, 0x2c, 0xff, 0x77, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 
-  0x15, 0x25, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x25, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x16, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x56, 0x2d, 0xff, 0x73, 0x2c, 0xff, 0xa2, 0x20, 0xff, 0x41, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xe7, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xef, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x82, 0x10, 0xff, 0xa2, 0x20, 0xff, 0x11, 0x2c, 0xff, 0x57, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 
-  0xd4, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x72, 0x2c, 0xff, 0xa2, 0x20, 0xff, 0x21, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x7c, 0xef, 0xff, 0xff, 0xff, 0xff, 0x62, 0x10, 0xff, 0xa2, 0x20, 0xff, 0xf1, 0x2b, 0xff, 0x56, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 
-  0x15, 0x25, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x2d, 0xff, 0x36, 0x2d, 0xff, 0x52, 0x24, 0xff, 0x82, 0x20, 0xff, 0x21, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5c, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x7c, 0xef, 0xff, 0xff, 0xff, 0xff, 0x62, 0x10, 0xff, 0xa2, 0x20, 0xff, 0xf0, 0x23, 0xff, 0x36, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xb4, 0x24, 0xff, 
-  0x00, 0x00, 0x00, 0xb4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x16, 0x25, 0xff, 0x52, 0x24, 0xff, 0x82, 0x20, 0xff, 0x21, 0x08, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0x3b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x3b, 0xe7, 0xff, 0x7c, 0xef, 0xff, 0xff, 0xff, 0xff, 0x62, 0x10, 0xff, 0x82, 0x20, 0xff, 0xd0, 0x23, 0xff, 0x36, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xb4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x25, 0xff, 0x32, 0x24, 0xff, 0x82, 0x20, 0xff, 0x61, 0x20, 0xff, 0xf5, 0x14, 0xff, 0xd4, 0x14, 0xff, 0xd4, 0x14, 0xff, 0xd4, 0x14, 0xff, 0xd4, 0x14, 0xff, 0xd4, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xf5, 0x1c, 0xff, 0xbd, 0xff, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x9c, 0xff, 0xff, 0xda, 0xc6, 0xff, 0x16, 0x05, 0xff, 0x82, 0x18, 0xff, 0x82, 0x20, 0xff, 0xd0, 0x23, 0xff, 0x16, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x94, 0x24, 0xff, 0x73, 0x1c, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x32, 0x24, 0xff, 0x82, 0x18, 0xff, 0x61, 0x18, 0xff, 0x36, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x25, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x15, 0x2d, 0xff, 0x97, 0x55, 0xff, 0x76, 0x4d, 0xff, 0x77, 0x4d, 0xff, 0x77, 0x4d, 0xff, 0x76, 0x4d, 0xff, 0x77, 0x4d, 0xff, 0x76, 0x4d, 0xff, 0x76, 0x4d, 0xff, 0x76, 0x4d, 0xff, 0x76, 0x4d, 0xff, 0x76, 0x4d, 0xff, 0x76, 0x4d, 0xff, 0x76, 0x4d, 0xff, 0x76, 0x4d, 0xff, 0x56, 0x45, 0xff, 0x77, 0x25, 0xff, 0x82, 0x18, 0xff, 0x82, 0x18, 0xff, 0xb0, 0x23, 0xff, 0x15, 0x25, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x94, 0x24, 0xff, 0x73, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x11, 0x24, 0xff, 0x62, 0x18, 0xff, 0x61, 0x18, 0xff, 0x36, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0x15, 0x25, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0x57, 0x25, 0xff, 0x82, 0x18, 0xff, 0x82, 0x18, 0xff, 0xb0, 0x23, 0xff, 0xf5, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0x11, 0x24, 0xff, 0x61, 0x18, 0xff, 0x61, 0x18, 0xff, 0x15, 0x25, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0x57, 0x25, 0xff, 0x82, 0x18, 0xff, 0x82, 0x18, 0xff, 0x8f, 0x23, 0xff, 0xd5, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xf1, 0x23, 0xff, 0x41, 0x18, 0xff, 0x20, 0x18, 0xff, 0xf5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd5, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0x36, 0x25, 0xff, 0x61, 0x18, 0xff, 0x41, 0x18, 0xff, 0x8f, 0x1b, 0xff, 0xd5, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0xb4, 0x1c, 0xff, 0x11, 0x1c, 0xff, 0x25, 0x19, 0xff, 0x24, 0x19, 0xff, 0xd5, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xd4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x15, 0x25, 0xff, 0x45, 0x19, 0xff, 0x25, 0x19, 0xff, 0xb0, 0x1b, 0xff, 0xb4, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0xf5, 0x1c, 0xff, 0xf5, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0xf5, 0x24, 0xff, 0xf5, 0x1c, 0xff, 0xb4, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x33, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0xb4, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x24, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x33, 0x1c, 0xff, 0x33, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x94, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x93, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x33, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x52, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1c, 0xff, 0x33, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x52, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x52, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x73, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1c, 0xff, 0x33, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x33, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x33, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x52, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x53, 0x1c, 0xff, 0x52, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x13, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x32, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x14, 0xff, 0xf2, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x13, 0xff, 0x32, 0x14, 0xff, 0xf2, 0x13, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x1c, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0x12, 0x14, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0x12, 0x14, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x11, 0x14, 0xff, 0xf1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xf1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd2, 0x13, 0xff, 0xd2, 0x13, 0xff, 0xf2, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0xd1, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x1c, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1d, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x4f, 0x3d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x1c, 0xff, 0x4f, 0x3c, 0xff, 0x4f, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xfc, 0xff, 0x46, 0xfc, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x4e, 0xfc, 0xff, 0x4f, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xdb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xfc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x4e, 0xdc, 0xff, 0x4e, 0xdc, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xdb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x5a, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0xbb, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x3a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x46, 0x9b, 0xff, 0x46, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x3d, 0xd9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x3a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x9a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x3a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x9b, 0xff, 0x46, 0xbb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xb7, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x7a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x46, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x3a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x46, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x46, 0x9a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x7a, 0xff, 0x3e, 0x7b, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x3a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x5a, 0xff, 0x3e, 0x3a, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xf9, 0xff, 0x35, 0x35, 0xff, 0x29, 0xe7, 0xff, 0x31, 0xc7, 0xff, 0x3e, 0x3a, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xf8, 0xff, 0x34, 0xf4, 0xff, 0x28, 0xc3, 0xff, 0x28, 0xa2, 0xff, 0x3e, 0x3a, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x39, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xd8, 0xff, 0x34, 0xf4, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xc3, 0xff, 0x3e, 0x39, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xd8, 0xff, 0x34, 0xf4, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xc3, 0xff, 0x36, 0x19, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3e, 0x19, 0xff, 0x3e, 0x19, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf9, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb8, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x56, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xb8, 0xff, 0x34, 0xd4, 0xff, 0x28, 0xc3, 0xff, 0x28, 0xc3, 0xff, 0x36, 0x19, 0xff, 0x2d, 0xb8, 0xff, 0x25, 0xb7, 0xff, 0x25, 0xb8, 0xff, 0x25, 0xb8, 0xff, 0x25, 0xb8, 0xff, 0x25, 0xb8, 0xff, 0x2d, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x3d, 0xf8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x56, 0xff, 0x35, 0x97, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x77, 0xff, 0x35, 0xb8, 0xff, 0x34, 0xd4, 0xff, 0x28, 0xc3, 0xff, 0x28, 0xa3, 0xff, 0x25, 0xd8, 0xff, 0x76, 0x59, 0xff, 0xcf, 0x1b, 0xff, 0xcf, 0x1b, 0xff, 0xcf, 0x1b, 0xff, 0xcf, 0x3b, 0xff, 0xcf, 0x3c, 0xff, 0xb6, 0xfb, 0xff, 0x3d, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x56, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x77, 0xff, 0x35, 0x97, 0xff, 0x2c, 0xb3, 0xff, 0x20, 0xc3, 0xff, 0x20, 0x82, 0xff, 0x76, 0x7a, 0xff, 0xff, 0xbd, 0xff, 0xf7, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x9d, 0xff, 0xef, 0x7c, 0xff, 0x25, 0x97, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xd8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb8, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x97, 0xff, 0x35, 0x97, 0xff, 0x35, 0xf9, 0xff, 0x35, 0xf9, 0xff, 0x35, 0xb7, 0xff, 0x35, 0x77, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x76, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x36, 0xff, 0x00, 0x00, 0x00, 
-  0x2d, 0x16, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x97, 0xff, 0x2c, 0xb3, 0xff, 0x20, 0xc3, 0xff, 0x20, 0x82, 0xff, 0x45, 0xf8, 0xff, 0xff, 0x9c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xf7, 0x7c, 0xff, 0xc7, 0x1b, 0xff, 0x15, 0x77, 0xff, 0x25, 0x97, 0xff, 0x25, 0x97, 0xff, 0x25, 0x97, 0xff, 0x25, 0x97, 0xff, 0x25, 0x97, 0xff, 0x25, 0x97, 0xff, 0x25, 0x97, 0xff, 0x25, 0x97, 0xff, 0x25, 0x77, 0xff, 0x25, 0x77, 0xff, 0x25, 0x77, 0xff, 0x25, 0x77, 0xff, 0x25, 0x77, 0xff, 0x1d, 0x77, 0xff, 0x25, 0x57, 0xff, 0x25, 0xd8, 0xff, 0x29, 0x86, 0xff, 0x29, 0x66, 0xff, 0x2c, 0x52, 0xff, 0x2d, 0x97, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x56, 0xff, 
-  0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x77, 0xff, 0x2c, 0x93, 0xff, 0x20, 0xa3, 0xff, 0x18, 0x62, 0xff, 0x8e, 0xfc, 0xff, 0xa6, 0xdc, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xdf, 0x7d, 0xff, 0x86, 0x9b, 0xff, 0x96, 0xbb, 0xff, 0xdf, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x3b, 0xff, 0xd7, 0x1b, 0xff, 0xd7, 0x3b, 0xff, 0xc7, 0x1b, 0xff, 0x9f, 0x5e, 0xff, 0x18, 0x82, 0xff, 0x20, 0xa2, 0xff, 0x2c, 0x11, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x36, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 
-  0x2d, 0x35, 0xff, 0x25, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x77, 0xff, 0x2c, 0x93, 0xff, 0x20, 0xa2, 0xff, 0x08, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x7c, 0xff, 0xef, 0x5c, 0xff, 0xf7, 0x9d, 0xff, 0xff, 0xff, 0xff, 0x10, 0x82, 0xff, 0x20, 0xa3, 0xff, 0x2c, 0x11, 0xff, 0x2d, 0x77, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 
-  0x25, 0x15, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x25, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x16, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x56, 0xff, 0x2c, 0x73, 0xff, 0x20, 0xa2, 0xff, 0x08, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5b, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5b, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x10, 0x82, 0xff, 0x20, 0xa2, 0xff, 0x2c, 0x11, 0xff, 0x2d, 0x57, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 
-  0x24, 0xd4, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x2c, 0x72, 0xff, 0x20, 0xa2, 0xff, 0x08, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3b, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5b, 0xff, 0xef, 0x7c, 0xff, 0xff, 0xff, 0xff, 0x10, 0x62, 0xff, 0x20, 0xa2, 0xff, 0x2b, 0xf1, 0xff, 0x2d, 0x56, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 
-  0x25, 0x15, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x36, 0xff, 0x24, 0x52, 0xff, 0x20, 0x82, 0xff, 0x08, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3b, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5c, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xef, 0x7c, 0xff, 0xff, 0xff, 0xff, 0x10, 0x62, 0xff, 0x20, 0xa2, 0xff, 0x23, 0xf0, 0xff, 0x2d, 0x36, 0xff, 0x2d, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xb4, 0xff, 
-  0x00, 0x00, 0x00, 0x24, 0xb4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x25, 0x16, 0xff, 0x24, 0x52, 0xff, 0x20, 0x82, 0xff, 0x08, 0x21, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xe7, 0x3b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x5b, 0xff, 0xe7, 0x3b, 0xff, 0xef, 0x7c, 0xff, 0xff, 0xff, 0xff, 0x10, 0x62, 0xff, 0x20, 0x82, 0xff, 0x23, 0xd0, 0xff, 0x25, 0x36, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0xb4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x25, 0x15, 0xff, 0x24, 0x32, 0xff, 0x20, 0x82, 0xff, 0x20, 0x61, 0xff, 0x14, 0xf5, 0xff, 0x14, 0xd4, 0xff, 0x14, 0xd4, 0xff, 0x14, 0xd4, 0xff, 0x14, 0xd4, 0xff, 0x14, 0xd4, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x1c, 0xf5, 0xff, 0xff, 0xbd, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xff, 0x9c, 0xff, 0xc6, 0xda, 0xff, 0x05, 0x16, 0xff, 0x18, 0x82, 0xff, 0x20, 0x82, 0xff, 0x23, 0xd0, 0xff, 0x25, 0x16, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0x94, 0xff, 0x1c, 0x73, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xf5, 0xff, 0x24, 0x32, 0xff, 0x18, 0x82, 0xff, 0x18, 0x61, 0xff, 0x25, 0x36, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x25, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x2d, 0x15, 0xff, 0x55, 0x97, 0xff, 0x4d, 0x76, 0xff, 0x4d, 0x77, 0xff, 0x4d, 0x77, 0xff, 0x4d, 0x76, 0xff, 0x4d, 0x77, 0xff, 0x4d, 0x76, 0xff, 0x4d, 0x76, 0xff, 0x4d, 0x76, 0xff, 0x4d, 0x76, 0xff, 0x4d, 0x76, 0xff, 0x4d, 0x76, 0xff, 0x4d, 0x76, 0xff, 0x4d, 0x76, 0xff, 0x45, 0x56, 0xff, 0x25, 0x77, 0xff, 0x18, 0x82, 0xff, 0x18, 0x82, 0xff, 0x23, 0xb0, 0xff, 0x25, 0x15, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd4, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x24, 0x94, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xf5, 0xff, 0x24, 0x11, 0xff, 0x18, 0x62, 0xff, 0x18, 0x61, 0xff, 0x25, 0x36, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x25, 0x15, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x25, 0x57, 0xff, 0x18, 0x82, 0xff, 0x18, 0x82, 0xff, 0x23, 0xb0, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0x11, 0xff, 0x18, 0x61, 0xff, 0x18, 0x61, 0xff, 0x25, 0x15, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x25, 0x57, 0xff, 0x18, 0x82, 0xff, 0x18, 0x82, 0xff, 0x23, 0x8f, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0xd4, 0xff, 0x23, 0xf1, 0xff, 0x18, 0x41, 0xff, 0x18, 0x20, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x25, 0x36, 0xff, 0x18, 0x61, 0xff, 0x18, 0x41, 0xff, 0x1b, 0x8f, 0xff, 0x24, 0xd5, 0xff, 0x24, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x94, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0xb4, 0xff, 0x1c, 0x11, 0xff, 0x19, 0x25, 0xff, 0x19, 0x24, 0xff, 0x24, 0xd5, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xd4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x25, 0x15, 0xff, 0x19, 0x45, 0xff, 0x19, 0x25, 0xff, 0x1b, 0xb0, 0xff, 0x1c, 0xb4, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x24, 0x94, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0xf5, 0xff, 0x24, 0xf5, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0xf5, 0xff, 0x1c, 0xf5, 0xff, 0x1c, 0xb4, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x33, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0xb4, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x24, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x33, 0xff, 0x1c, 0x33, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x94, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x93, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x33, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x52, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x1c, 0x33, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x52, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x52, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x73, 0xff, 0x1c, 0x53, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x53, 0xff, 0x1c, 0x33, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x33, 0xff, 0x14, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x33, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x52, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x53, 0xff, 0x1c, 0x52, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x14, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf1, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x32, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x14, 0x12, 0xff, 0x13, 0xf2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xd1, 0xff, 0x14, 0x32, 0xff, 0x13, 0xf2, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x1c, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x14, 0x12, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x14, 0x12, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x14, 0x11, 0xff, 0x13, 0xf1, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd2, 0xff, 0x13, 0xd2, 0xff, 0x13, 0xf2, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x13, 0xd1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe5, 0xe2, 0x48, 0xff, 0xe5, 0xe4, 0x4a, 0xff, 0xe0, 0xe0, 0x48, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe1, 0x4a, 0xff, 0xe6, 0xe3, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe7, 0xe5, 0x4b, 0xff, 0xe7, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4b, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe7, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xe0, 0x4a, 0xff, 0xe4, 0xe1, 0x4a, 0xff, 0xe4, 0xe1, 0x4b, 0xff, 0xe4, 0xe2, 0x4a, 0xff, 0xe4, 0xe2, 0x4b, 0xff, 0xe4, 0xe2, 0x49, 0xff, 0xe6, 0xe3, 0x4b, 0xff, 0xe6, 0xe3, 0x4b, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe6, 0xe3, 0x4b, 0xff, 0xe6, 0xe3, 0x4b, 0xff, 0xe6, 0xe3, 0x4a, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe7, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe6, 0xe3, 0x4a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xdc, 0x46, 0xff, 0xe4, 0xdd, 0x48, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe1, 0xdd, 0x48, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xde, 0x48, 0xff, 0xe2, 0xdf, 0x48, 0xff, 0xe3, 0xe0, 0x49, 0xff, 0xe4, 0xe1, 0x49, 0xff, 0xe4, 0xe1, 0x4a, 0xff, 0xe5, 0xe1, 0x4a, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe5, 0xe2, 0x4a, 0xff, 0xe5, 0xe1, 0x4a, 0xff, 0xe4, 0xe1, 0x4a, 0xff, 0xe4, 0xe1, 0x49, 0xff, 0xe3, 0xe0, 0x49, 0xff, 0xe2, 0xdf, 0x48, 0xff, 0xe2, 0xde, 0x48, 0xff, 0xe4, 0xdf, 0x49, 0xff, 0xe5, 0xe1, 0x48, 0xff, 0xe7, 0xe4, 0x4b, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0xe6, 0xe4, 0x4a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xdc, 0x47, 0xff, 0xdf, 0xdc, 0x47, 0xff, 0xdd, 0xdb, 0x46, 0xff, 0xdb, 0xd7, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xde, 0xd9, 0x45, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xde, 0x48, 0xff, 0xe2, 0xde, 0x48, 0xff, 0xe2, 0xdf, 0x48, 0xff, 0xe3, 0xdf, 0x48, 0xff, 0xe3, 0xdf, 0x49, 0xff, 0xe3, 0xdf, 0x49, 0xff, 0xe3, 0xdf, 0x49, 0xff, 0xe2, 0xdf, 0x48, 0xff, 0xe2, 0xde, 0x48, 0xff, 0xe1, 0xde, 0x48, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe0, 0xdc, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xe4, 0xe1, 0x49, 0xff, 0xe4, 0xe2, 0x48, 0xff, 0xe4, 0xe3, 0x4a, 0xff, 0xe5, 0xe2, 0x48, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xdc, 0x47, 0xff, 0xdd, 0xdc, 0x44, 0xff, 0xdb, 0xd6, 0x44, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd9, 0xd5, 0x43, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xdc, 0xd7, 0x44, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xde, 0xda, 0x45, 0xff, 0xdf, 0xda, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xe0, 0xdc, 0x47, 0xff, 0xe0, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe1, 0xdd, 0x47, 0xff, 0xe0, 0xdd, 0x47, 0xff, 0xe0, 0xdc, 0x47, 0xff, 0xdf, 0xdc, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xde, 0xda, 0x45, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xdc, 0xd7, 0x44, 0xff, 0xd9, 0xd5, 0x43, 0xff, 0xd9, 0xd5, 0x43, 0xff, 0xd9, 0xd3, 0x42, 0xff, 0xd9, 0xd3, 0x42, 0xff, 0xe2, 0xdd, 0x46, 0xff, 0xe3, 0xdf, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xda, 0x45, 0xff, 0xd5, 0xd2, 0x43, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd7, 0xd1, 0x41, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xdb, 0xd6, 0x44, 0xff, 0xdc, 0xd7, 0x44, 0xff, 0xdd, 0xd8, 0x45, 0xff, 0xdd, 0xd9, 0x45, 0xff, 0xde, 0xda, 0x45, 0xff, 0xde, 0xda, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xdf, 0xdb, 0x46, 0xff, 0xde, 0xda, 0x46, 0xff, 0xde, 0xda, 0x45, 0xff, 0xde, 0xd9, 0x45, 0xff, 0xdd, 0xd8, 0x45, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdb, 0xd7, 0x44, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xda, 0xd3, 0x43, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd2, 0x42, 0xff, 0xd8, 0xd2, 0x42, 0xff, 0xdf, 0xda, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0x3c, 0xff, 0xcf, 0xca, 0x3c, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd2, 0xcd, 0x3e, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd5, 0xcf, 0x40, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xdb, 0xd7, 0x44, 0xff, 0xdc, 0xd7, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdd, 0xd8, 0x45, 0xff, 0xdd, 0xd8, 0x45, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdc, 0xd8, 0x44, 0xff, 0xdb, 0xd7, 0x44, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd3, 0xd0, 0x3e, 0xff, 0xd8, 0xd0, 0x3d, 0xff, 0xd9, 0xd3, 0x43, 0xff, 0xd9, 0xd3, 0x42, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xc9, 0x3c, 0xff, 0xc9, 0xc1, 0x37, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xd9, 0xd5, 0x43, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xdb, 0xd6, 0x43, 0xff, 0xda, 0xd6, 0x43, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xda, 0xd5, 0x43, 0xff, 0xd9, 0xd5, 0x43, 0xff, 0xd9, 0xd4, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd6, 0xd0, 0x40, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd0, 0xc9, 0x3d, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xd8, 0xd2, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xc4, 0x3a, 0xff, 0xca, 0xc6, 0x38, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xcc, 0xc6, 0x3b, 0xff, 0xce, 0xc8, 0x3b, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd1, 0xcc, 0x3e, 0xff, 0xd2, 0xcd, 0x3e, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd4, 0xcf, 0x40, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd4, 0x42, 0xff, 0xd8, 0xd4, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd7, 0xd2, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd5, 0xcf, 0x40, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd1, 0xcc, 0x3e, 0xff, 0xd0, 0xcb, 0x3d, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcd, 0xc6, 0x3b, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xd0, 0xc9, 0x3a, 0xff, 0xd6, 0xd0, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xbe, 0x36, 0xff, 0xc8, 0xc1, 0x39, 0xff, 0xc7, 0xbf, 0x37, 0xff, 0xc9, 0xc3, 0x39, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xcc, 0xc6, 0x3a, 0xff, 0xcd, 0xc7, 0x3b, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd5, 0xcf, 0x40, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd6, 0xd0, 0x40, 0xff, 0xd6, 0xd1, 0x40, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd6, 0xd1, 0x41, 0xff, 0xd6, 0xd1, 0x40, 0xff, 0xd6, 0xd1, 0x40, 0xff, 0xd5, 0xd0, 0x40, 0xff, 0xd5, 0xcf, 0x40, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xcf, 0xc8, 0x3c, 0xff, 0xcd, 0xc7, 0x3b, 0xff, 0xcc, 0xc6, 0x3a, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xd8, 0xd0, 0x3e, 0xff, 0xd8, 0xd2, 0x42, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xb6, 0x31, 0xff, 0xc0, 0xb6, 0x32, 0xff, 0xc5, 0xba, 0x35, 0xff, 0xc7, 0xbf, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc9, 0xc2, 0x39, 0xff, 0xca, 0xc4, 0x39, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcd, 0xc6, 0x3b, 0xff, 0xce, 0xc8, 0x3b, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd1, 0xcc, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xcf, 0x3f, 0xff, 0xd4, 0xce, 0x3f, 0xff, 0xd3, 0xce, 0x3f, 0xff, 0xd3, 0xcd, 0x3e, 0xff, 0xd2, 0xcd, 0x3e, 0xff, 0xd1, 0xcc, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcd, 0xc6, 0x3b, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcb, 0xc4, 0x39, 0xff, 0xc9, 0xc2, 0x39, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xd8, 0xd0, 0x3b, 0xff, 0xd8, 0xd3, 0x42, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xb5, 0x30, 0xff, 0xc3, 0xb9, 0x33, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc8, 0xc0, 0x38, 0xff, 0xc9, 0xc2, 0x38, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xcc, 0xc6, 0x3a, 0xff, 0xcd, 0xc7, 0x3b, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xcf, 0xca, 0x3c, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd1, 0xcc, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd2, 0xcc, 0x3e, 0xff, 0xd1, 0xcc, 0x3e, 0xff, 0xd1, 0xcb, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd0, 0xc9, 0x3d, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcd, 0xc7, 0x3b, 0xff, 0xcc, 0xc6, 0x3a, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xc9, 0xc2, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xd8, 0xd2, 0x42, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xb6, 0x32, 0xff, 0xc1, 0xb6, 0x32, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc5, 0xbd, 0x36, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc9, 0xc2, 0x39, 0xff, 0xca, 0xc4, 0x39, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xcc, 0xc6, 0x3a, 0xff, 0xcd, 0xc6, 0x3b, 0xff, 0xce, 0xc7, 0x3b, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xd0, 0xc9, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xd0, 0xca, 0x3d, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xcf, 0xc9, 0x3c, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xce, 0xc7, 0x3b, 0xff, 0xcd, 0xc7, 0x3b, 0xff, 0xcc, 0xc6, 0x3a, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xca, 0xc4, 0x39, 0xff, 0xc9, 0xc3, 0x39, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc5, 0xbd, 0x36, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x34, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xd2, 0xcf, 0x42, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xb4, 0x30, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xc0, 0xb9, 0x33, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc8, 0xc0, 0x36, 0xff, 0xd4, 0xcc, 0x37, 0xff, 0xd5, 0xcd, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc9, 0xc2, 0x39, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xcc, 0xc6, 0x3a, 0xff, 0xcd, 0xc6, 0x3b, 0xff, 0xcd, 0xc7, 0x3b, 0xff, 0xce, 0xc7, 0x3b, 0xff, 0xce, 0xc8, 0x3b, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xce, 0xc8, 0x3c, 0xff, 0xce, 0xc8, 0x3b, 0xff, 0xce, 0xc8, 0x3b, 0xff, 0xce, 0xc7, 0x3b, 0xff, 0xcd, 0xc7, 0x3b, 0xff, 0xcd, 0xc6, 0x3b, 0xff, 0xcc, 0xc6, 0x3a, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xca, 0xc4, 0x39, 0xff, 0xc9, 0xc3, 0x39, 0xff, 0xc8, 0xc2, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc4, 0xbd, 0x36, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xbf, 0xb7, 0x33, 0xff, 0xbe, 0xb5, 0x31, 0xff, 0xbe, 0xb5, 0x31, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xb2, 0x30, 0xff, 0xba, 0xb0, 0x30, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xc5, 0xbd, 0x34, 0xff, 0xab, 0xa5, 0x33, 0xff, 0x3c, 0x3b, 0x2c, 0xff, 0x3a, 0x39, 0x2d, 0xff, 0xcd, 0xc5, 0x37, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc9, 0xc2, 0x38, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xcb, 0xc4, 0x39, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcc, 0xc5, 0x3a, 0xff, 0xcb, 0xc5, 0x3a, 0xff, 0xcb, 0xc4, 0x3a, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xc9, 0xc2, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc7, 0xc0, 0x38, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc6, 0xbe, 0x36, 0xff, 0xc5, 0xbd, 0x36, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc2, 0xbb, 0x35, 0xff, 0xc1, 0xb9, 0x34, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbe, 0xb5, 0x31, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xbd, 0xb5, 0x30, 0xff, 0xbd, 0xb4, 0x30, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xaf, 0x2e, 0xff, 0xb8, 0xae, 0x2e, 0xff, 0xba, 0xb2, 0x2f, 0xff, 0xbc, 0xb3, 0x30, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xc4, 0xbc, 0x33, 0xff, 0xa4, 0x9d, 0x32, 0xff, 0x17, 0x18, 0x29, 0xff, 0x14, 0x15, 0x29, 0xff, 0xcd, 0xc5, 0x36, 0xff, 0xc6, 0xbe, 0x36, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc9, 0xc2, 0x38, 0xff, 0xc9, 0xc2, 0x39, 0xff, 0xc9, 0xc3, 0x39, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xca, 0xc3, 0x39, 0xff, 0xc9, 0xc3, 0x39, 0xff, 0xc9, 0xc2, 0x39, 0xff, 0xc9, 0xc2, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc6, 0xbe, 0x36, 0xff, 0xc5, 0xbd, 0x36, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbc, 0xb3, 0x30, 0xff, 0xbb, 0xb2, 0x2f, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xbe, 0xb5, 0x30, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb8, 0xaf, 0x2e, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb8, 0xae, 0x2e, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xbb, 0xb3, 0x30, 0xff, 0xbd, 0xb4, 0x31, 0xff, 0xc2, 0xba, 0x32, 0xff, 0xa4, 0x9d, 0x31, 0xff, 0x1b, 0x1c, 0x28, 0xff, 0x18, 0x18, 0x28, 0xff, 0xcb, 0xc3, 0x35, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc4, 0xbd, 0x36, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc6, 0xbe, 0x36, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc7, 0xbf, 0x37, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc8, 0xc0, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc8, 0xc1, 0x38, 0xff, 0xc8, 0xc0, 0x38, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc7, 0xc0, 0x37, 0xff, 0xc6, 0xbf, 0x37, 0xff, 0xc6, 0xbe, 0x36, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc4, 0xbd, 0x36, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x34, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbd, 0xb4, 0x31, 0xff, 0xbc, 0xb3, 0x30, 0xff, 0xba, 0xb2, 0x2f, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xb8, 0xaf, 0x2d, 0xff, 0xc0, 0xb5, 0x30, 0xff, 0xbe, 0xb5, 0x30, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb8, 0xaf, 0x2e, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb8, 0xac, 0x2c, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xbb, 0xb2, 0x30, 0xff, 0xc1, 0xb8, 0x31, 0xff, 0xa2, 0x9b, 0x2f, 0xff, 0x1a, 0x1b, 0x27, 0xff, 0x17, 0x18, 0x27, 0xff, 0xca, 0xc1, 0x34, 0xff, 0xc2, 0xba, 0x33, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc2, 0xbb, 0x34, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc4, 0xbd, 0x36, 0xff, 0xc5, 0xbd, 0x36, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc6, 0xbe, 0x36, 0xff, 0xc6, 0xbf, 0x36, 0xff, 0xc6, 0xbf, 0x36, 0xff, 0xc6, 0xbe, 0x36, 0xff, 0xc6, 0xbe, 0x36, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc5, 0xbe, 0x36, 0xff, 0xc5, 0xbd, 0x36, 0xff, 0xc4, 0xbd, 0x36, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc2, 0xbb, 0x34, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x34, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xbb, 0xb2, 0x30, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xb8, 0xb0, 0x2e, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb8, 0xb0, 0x2c, 0xff, 0xb8, 0xb0, 0x2e, 0xff, 0xbe, 0xb4, 0x30, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb2, 0xa7, 0x28, 0xff, 0xb8, 0xae, 0x2e, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb7, 0xad, 0x2d, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xbf, 0xb6, 0x2f, 0xff, 0xa0, 0x99, 0x2e, 0xff, 0x19, 0x1a, 0x26, 0xff, 0x16, 0x17, 0x26, 0xff, 0xc8, 0xbf, 0x33, 0xff, 0xbe, 0xb5, 0x29, 0xff, 0xbc, 0xb3, 0x22, 0xff, 0xbd, 0xb3, 0x22, 0xff, 0xbe, 0xb4, 0x23, 0xff, 0xbe, 0xb5, 0x23, 0xff, 0xbf, 0xb5, 0x23, 0xff, 0xc0, 0xb7, 0x27, 0xff, 0xc2, 0xba, 0x32, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc4, 0xbc, 0x35, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc3, 0xbc, 0x35, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc3, 0xbb, 0x35, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x34, 0xff, 0xc0, 0xb9, 0x33, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbc, 0xb4, 0x31, 0xff, 0xbb, 0xb3, 0x30, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xb9, 0xb0, 0x2e, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb3, 0xa9, 0x2a, 0xff, 0xb7, 0xaf, 0x2d, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xae, 0xa3, 0x27, 0xff, 0xaf, 0xa7, 0x28, 0xff, 0xb2, 0xa9, 0x2a, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb6, 0xad, 0x2c, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xbd, 0xb4, 0x2e, 0xff, 0x9e, 0x97, 0x2d, 0xff, 0x18, 0x19, 0x25, 0xff, 0x15, 0x16, 0x25, 0xff, 0xc2, 0xb7, 0x21, 0xff, 0xcc, 0xca, 0x74, 0xff, 0xdb, 0xe2, 0xc6, 0xff, 0xdc, 0xe2, 0xc7, 0xff, 0xdc, 0xe2, 0xc6, 0xff, 0xdc, 0xe3, 0xc7, 0xff, 0xdd, 0xe4, 0xca, 0xff, 0xd8, 0xdc, 0xad, 0xff, 0xc1, 0xba, 0x38, 0xff, 0xc1, 0xb8, 0x31, 0xff, 0xc1, 0xba, 0x34, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xba, 0x34, 0xff, 0xc1, 0xba, 0x34, 0xff, 0xc2, 0xba, 0x34, 0xff, 0xc1, 0xba, 0x34, 0xff, 0xc1, 0xb9, 0x34, 0xff, 0xc1, 0xb9, 0x33, 0xff, 0xc0, 0xb9, 0x33, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xc0, 0xb8, 0x33, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbf, 0xb6, 0x32, 0xff, 0xbe, 0xb5, 0x31, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbc, 0xb4, 0x30, 0xff, 0xbb, 0xb3, 0x30, 0xff, 0xba, 0xb2, 0x2f, 0xff, 0xb9, 0xb0, 0x2f, 0xff, 0xb8, 0xaf, 0x2e, 0xff, 0xb7, 0xae, 0x2d, 0xff, 0xb6, 0xad, 0x2c, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb3, 0xac, 0x2a, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xae, 0xa3, 0x27, 0xff, 0xaf, 0xa5, 0x27, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb3, 0xa9, 0x2a, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xbb, 0xb1, 0x2d, 0xff, 0x9c, 0x95, 0x2c, 0xff, 0x17, 0x18, 0x24, 0xff, 0x12, 0x12, 0x1d, 0xff, 0xd1, 0xce, 0x6f, 0xff, 0xe8, 0xf4, 0xff, 0xff, 0xe2, 0xed, 0xed, 0xff, 0xe3, 0xed, 0xec, 0xff, 0xe3, 0xed, 0xed, 0xff, 0xe3, 0xed, 0xed, 0xff, 0xe3, 0xed, 0xed, 0xff, 0xe5, 0xef, 0xf4, 0xff, 0xe3, 0xed, 0xea, 0xff, 0xbb, 0xb1, 0x1f, 0xff, 0xbf, 0xb7, 0x33, 0xff, 0xbf, 0xb7, 0x33, 0xff, 0xbf, 0xb7, 0x33, 0xff, 0xbf, 0xb7, 0x33, 0xff, 0xbf, 0xb7, 0x33, 0xff, 0xbf, 0xb7, 0x33, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbf, 0xb7, 0x32, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbe, 0xb6, 0x32, 0xff, 0xbe, 0xb5, 0x31, 0xff, 0xbd, 0xb5, 0x31, 0xff, 0xbd, 0xb4, 0x31, 0xff, 0xbc, 0xb3, 0x30, 0xff, 0xbb, 0xb2, 0x30, 0xff, 0xba, 0xb1, 0x2f, 0xff, 0xc7, 0xbe, 0x30, 0xff, 0xc7, 0xbd, 0x2f, 0xff, 0xbc, 0xb3, 0x2e, 0xff, 0xb6, 0xad, 0x2d, 0xff, 0xb5, 0xac, 0x2c, 0xff, 0xb4, 0xab, 0x2b, 0xff, 0xb3, 0xaa, 0x2b, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xa9, 0x9f, 0x23, 0xff, 0xa9, 0x9d, 0x23, 0xff, 0xaf, 0xa6, 0x26, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xaf, 0xa2, 0x25, 0xff, 0xaf, 0xa3, 0x27, 0xff, 0xae, 0xa3, 0x27, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb2, 0xa9, 0x2a, 0xff, 0xb3, 0xaa, 0x2b, 0xff, 0xb9, 0xaf, 0x2c, 0xff, 0x9b, 0x93, 0x2a, 0xff, 0x16, 0x17, 0x23, 0xff, 0x12, 0x12, 0x1e, 0xff, 0xc4, 0xbe, 0x44, 0xff, 0xe3, 0xf1, 0xf8, 0xff, 0xdf, 0xea, 0xe5, 0xff, 0xdf, 0xe9, 0xe5, 0xff, 0xdf, 0xe9, 0xe5, 0xff, 0xdf, 0xea, 0xe5, 0xff, 0xdf, 0xea, 0xe5, 0xff, 0xe1, 0xed, 0xee, 0xff, 0xd8, 0xe0, 0xc2, 0xff, 0xb6, 0xab, 0x13, 0xff, 0xb9, 0xaf, 0x1f, 0xff, 0xb9, 0xaf, 0x1f, 0xff, 0xba, 0xaf, 0x1f, 0xff, 0xba, 0xaf, 0x1f, 0xff, 0xb9, 0xaf, 0x1f, 0xff, 0xb9, 0xaf, 0x1f, 0xff, 0xb9, 0xaf, 0x1f, 0xff, 0xb9, 0xaf, 0x1f, 0xff, 0xb8, 0xae, 0x1e, 0xff, 0xb8, 0xae, 0x1e, 0xff, 0xb8, 0xad, 0x1e, 0xff, 0xb7, 0xad, 0x1d, 0xff, 0xb6, 0xac, 0x1d, 0xff, 0xb6, 0xab, 0x1c, 0xff, 0xb5, 0xaa, 0x1e, 0xff, 0xc2, 0xb7, 0x22, 0xff, 0x30, 0x2f, 0x25, 0xff, 0x2f, 0x2e, 0x25, 0xff, 0x91, 0x8a, 0x2a, 0xff, 0xb9, 0xb0, 0x2c, 0xff, 0xb4, 0xaa, 0x2b, 0xff, 0xb2, 0xa9, 0x2a, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xb0, 0xa6, 0x29, 0xff, 0xb0, 0xa6, 0x26, 0xff, 0xa9, 0x9c, 0x23, 0xff, 0xa7, 0x9d, 0x23, 0xff, 0xb2, 0xa9, 0x28, 0xff, 
-  0xaf, 0xa4, 0x28, 0xff, 0xaf, 0xa4, 0x27, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xad, 0xa3, 0x27, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xb0, 0xa5, 0x28, 0xff, 0xb0, 0xa7, 0x29, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb7, 0xad, 0x2a, 0xff, 0x99, 0x91, 0x29, 0xff, 0x15, 0x16, 0x23, 0xff, 0x0e, 0x0e, 0x17, 0xff, 0xe2, 0xdb, 0x8c, 0xff, 0xdd, 0xda, 0xa1, 0xff, 0xee, 0xf4, 0xf3, 0xff, 0xee, 0xf4, 0xf2, 0xff, 0xee, 0xf4, 0xf1, 0xff, 0xef, 0xf4, 0xf1, 0xff, 0xef, 0xf5, 0xf4, 0xff, 0xea, 0xec, 0xda, 0xff, 0xd7, 0xd1, 0x80, 0xff, 0xdb, 0xd6, 0x92, 0xff, 0xdc, 0xe5, 0xd6, 0xff, 0xdc, 0xe4, 0xd0, 0xff, 0xdc, 0xe4, 0xd0, 0xff, 0xdc, 0xe4, 0xd0, 0xff, 0xdc, 0xe4, 0xd0, 0xff, 0xdc, 0xe4, 0xd0, 0xff, 0xdc, 0xe4, 0xd0, 0xff, 0xdc, 0xe4, 0xd0, 0xff, 0xdc, 0xe4, 0xd0, 0xff, 0xdc, 0xe4, 0xd0, 0xff, 0xdc, 0xe3, 0xd0, 0xff, 0xdb, 0xe3, 0xcf, 0xff, 0xdb, 0xe2, 0xcf, 0xff, 0xdb, 0xe3, 0xd1, 0xff, 0xda, 0xdf, 0xbf, 0xff, 0xee, 0xe8, 0x98, 0xff, 0x11, 0x11, 0x1a, 0xff, 0x12, 0x14, 0x22, 0xff, 0x89, 0x82, 0x28, 0xff, 0xb9, 0xae, 0x2b, 0xff, 0xb2, 0xa8, 0x2a, 0xff, 0xb1, 0xa7, 0x29, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xaa, 0xa0, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9c, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 
-  0xac, 0xa3, 0x25, 0xff, 0xa8, 0xa0, 0x24, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xab, 0xa1, 0x25, 0xff, 0xac, 0xa2, 0x26, 0xff, 0xae, 0xa3, 0x27, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xb5, 0xab, 0x29, 0xff, 0x97, 0x8f, 0x28, 0xff, 0x14, 0x15, 0x22, 0xff, 0x08, 0x08, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xe9, 0xe7, 0xff, 0xe1, 0xeb, 0xea, 0xff, 0xe1, 0xeb, 0xea, 0xff, 0xe1, 0xeb, 0xea, 0xff, 0xe1, 0xeb, 0xea, 0xff, 0xe1, 0xeb, 0xea, 0xff, 0xe1, 0xeb, 0xea, 0xff, 0xe1, 0xeb, 0xea, 0xff, 0xe0, 0xeb, 0xea, 0xff, 0xe0, 0xeb, 0xea, 0xff, 0xe0, 0xeb, 0xea, 0xff, 0xe0, 0xeb, 0xe9, 0xff, 0xe0, 0xeb, 0xe9, 0xff, 0xde, 0xea, 0xe8, 0xff, 0xe7, 0xf0, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x10, 0x11, 0xff, 0x15, 0x16, 0x21, 0xff, 0x89, 0x82, 0x28, 0xff, 0xb7, 0xac, 0x29, 0xff, 0xb0, 0xa6, 0x28, 0xff, 0xaf, 0xa5, 0x28, 0xff, 0xae, 0xa3, 0x27, 0xff, 0xac, 0xa2, 0x26, 0xff, 0xa8, 0x9c, 0x23, 0xff, 0xa9, 0xa2, 0x23, 0xff, 0xa8, 0x9c, 0x23, 0xff, 0xa8, 0x9b, 0x22, 0xff, 
-  0xa9, 0xa0, 0x24, 0xff, 0xa8, 0x9f, 0x24, 0xff, 0xa7, 0x9d, 0x23, 0xff, 0xa8, 0x9f, 0x24, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xad, 0xa2, 0x26, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xb3, 0xa9, 0x28, 0xff, 0x95, 0x8d, 0x27, 0xff, 0x13, 0x14, 0x21, 0xff, 0x07, 0x07, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xdb, 0xe7, 0xe2, 0xff, 0xdf, 0xea, 0xe5, 0xff, 0xdf, 0xea, 0xe5, 0xff, 0xdf, 0xea, 0xe5, 0xff, 0xdf, 0xea, 0xe5, 0xff, 0xdf, 0xea, 0xe5, 0xff, 0xdf, 0xea, 0xe5, 0xff, 0xdf, 0xe9, 0xe4, 0xff, 0xdf, 0xe9, 0xe4, 0xff, 0xdf, 0xe9, 0xe5, 0xff, 0xde, 0xe9, 0xe4, 0xff, 0xde, 0xe9, 0xe4, 0xff, 0xde, 0xe8, 0xe4, 0xff, 0xdc, 0xe8, 0xe3, 0xff, 0xe5, 0xed, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x15, 0x20, 0xff, 0x87, 0x80, 0x26, 0xff, 0xb5, 0xaa, 0x28, 0xff, 0xae, 0xa4, 0x27, 0xff, 0xad, 0xa3, 0x26, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xaa, 0x9f, 0x24, 0xff, 0xa8, 0x9e, 0x23, 0xff, 0xa8, 0x9c, 0x23, 0xff, 0xa8, 0x9b, 0x23, 0xff, 
-  0xa3, 0x97, 0x1d, 0xff, 0xa8, 0x9e, 0x24, 0xff, 0xa7, 0x9c, 0x22, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa8, 0x9d, 0x24, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xb1, 0xa6, 0x26, 0xff, 0x94, 0x8b, 0x25, 0xff, 0x12, 0x13, 0x20, 0xff, 0x06, 0x06, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xda, 0xe6, 0xe1, 0xff, 0xde, 0xe9, 0xe4, 0xff, 0xde, 0xe9, 0xe4, 0xff, 0xde, 0xe9, 0xe4, 0xff, 0xde, 0xe9, 0xe4, 0xff, 0xde, 0xe9, 0xe4, 0xff, 0xde, 0xe8, 0xe4, 0xff, 0xde, 0xe8, 0xe4, 0xff, 0xde, 0xe8, 0xe4, 0xff, 0xdd, 0xe9, 0xe4, 0xff, 0xdd, 0xe9, 0xe3, 0xff, 0xdd, 0xe8, 0xe4, 0xff, 0xdd, 0xe8, 0xe3, 0xff, 0xdb, 0xe7, 0xe2, 0xff, 0xe3, 0xec, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x13, 0x14, 0x1f, 0xff, 0x85, 0x7e, 0x25, 0xff, 0xb3, 0xa8, 0x27, 0xff, 0xac, 0xa1, 0x26, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa7, 0x9b, 0x22, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9b, 0x21, 0xff, 
-  0xa8, 0x9f, 0x24, 0xff, 0xa8, 0x9f, 0x24, 0xff, 0xa7, 0x9b, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa7, 0x9c, 0x22, 0xff, 0xa7, 0x9b, 0x23, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xaf, 0xa4, 0x25, 0xff, 0x92, 0x89, 0x24, 0xff, 0x11, 0x12, 0x1f, 0xff, 0x05, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xe6, 0xe0, 0xff, 0xdd, 0xe8, 0xe3, 0xff, 0xdd, 0xe8, 0xe4, 0xff, 0xdd, 0xe8, 0xe4, 0xff, 0xdd, 0xe8, 0xe3, 0xff, 0xdd, 0xe8, 0xe4, 0xff, 0xdd, 0xe8, 0xe3, 0xff, 0xdd, 0xe8, 0xe3, 0xff, 0xdd, 0xe8, 0xe3, 0xff, 0xdd, 0xe8, 0xe3, 0xff, 0xdc, 0xe8, 0xe3, 0xff, 0xdc, 0xe7, 0xe2, 0xff, 0xdc, 0xe8, 0xe3, 0xff, 0xda, 0xe7, 0xe1, 0xff, 0xe4, 0xed, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x12, 0x13, 0x1e, 0xff, 0x84, 0x7c, 0x24, 0xff, 0xb1, 0xa6, 0x25, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa8, 0x9c, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa0, 0x94, 0x1f, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x9e, 0x93, 0x1d, 0xff, 0xa5, 0x9a, 0x24, 0xff, 0xa7, 0x9b, 0x22, 0xff, 0xa7, 0x9c, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xad, 0xa2, 0x24, 0xff, 0x90, 0x87, 0x24, 0xff, 0x10, 0x11, 0x1e, 0xff, 0x05, 0x05, 0x08, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfb, 0xfa, 0xf3, 0xff, 0xfa, 0xf9, 0xf2, 0xff, 0xfa, 0xf9, 0xf2, 0xff, 0xfa, 0xf9, 0xf2, 0xff, 0xfa, 0xf9, 0xf2, 0xff, 0xfa, 0xf9, 0xf2, 0xff, 0xfa, 0xf9, 0xf2, 0xff, 0xfa, 0xf9, 0xf2, 0xff, 0xf9, 0xf8, 0xf0, 0xff, 0xda, 0xe6, 0xe3, 0xff, 0xdc, 0xe7, 0xe2, 0xff, 0xdc, 0xe7, 0xe3, 0xff, 0xdc, 0xe7, 0xe3, 0xff, 0xdc, 0xe7, 0xe2, 0xff, 0xdc, 0xe7, 0xe2, 0xff, 0xdc, 0xe7, 0xe2, 0xff, 0xdc, 0xe8, 0xe3, 0xff, 0xdc, 0xe8, 0xe3, 0xff, 0xdc, 0xe8, 0xe2, 0xff, 0xdc, 0xe7, 0xe2, 0xff, 0xdb, 0xe7, 0xe2, 0xff, 0xdb, 0xe7, 0xe2, 0xff, 0xda, 0xe6, 0xe2, 0xff, 0xe2, 0xec, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x0d, 0x0f, 0xff, 0x11, 0x12, 0x1d, 0xff, 0x82, 0x7a, 0x23, 0xff, 0xaf, 0xa3, 0x24, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa8, 0x9b, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9e, 0x93, 0x1d, 0xff, 0xa5, 0x9a, 0x22, 0xff, 0xa2, 0x98, 0x1f, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xab, 0xa0, 0x23, 0xff, 0x8e, 0x85, 0x22, 0xff, 0x0f, 0x11, 0x1d, 0xff, 0x0c, 0x0d, 0x1d, 0xff, 0xaa, 0x9e, 0x0f, 0xff, 0xa3, 0x97, 0x0e, 0xff, 0xa3, 0x97, 0x0e, 0xff, 0xa3, 0x98, 0x0f, 0xff, 0xa4, 0x98, 0x0f, 0xff, 0xa4, 0x99, 0x0f, 0xff, 0xa5, 0x99, 0x10, 0xff, 0xa5, 0x9a, 0x10, 0xff, 0xa5, 0x99, 0x0e, 0xff, 0xa8, 0x9e, 0x18, 0xff, 0xe5, 0xf5, 0xff, 0xff, 0xe0, 0xee, 0xf4, 0xff, 0xe0, 0xee, 0xf3, 0xff, 0xe0, 0xee, 0xf3, 0xff, 0xe0, 0xee, 0xf4, 0xff, 0xe0, 0xed, 0xf3, 0xff, 0xdf, 0xed, 0xf3, 0xff, 0xdf, 0xed, 0xf3, 0xff, 0xdf, 0xed, 0xf3, 0xff, 0xdf, 0xed, 0xf3, 0xff, 0xdf, 0xed, 0xf3, 0xff, 0xdf, 0xed, 0xf3, 0xff, 0xdf, 0xed, 0xf3, 0xff, 0xe0, 0xf0, 0xf9, 0xff, 0xd0, 0xd8, 0xbd, 0xff, 0xae, 0x9f, 0x00, 0xff, 0x12, 0x12, 0x1c, 0xff, 0x11, 0x12, 0x1d, 0xff, 0x80, 0x78, 0x21, 0xff, 0xad, 0xa1, 0x23, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa5, 0x99, 0x22, 0xff, 0xa5, 0x9b, 0x22, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9e, 0x91, 0x1d, 0xff, 0x9b, 0x8d, 0x1b, 0xff, 0xa0, 0x93, 0x1e, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa9, 0x9d, 0x21, 0xff, 0x8d, 0x83, 0x21, 0xff, 0x0e, 0x0f, 0x1c, 0xff, 0x0b, 0x0c, 0x1c, 0xff, 0xb1, 0xa5, 0x24, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xaa, 0x9f, 0x24, 0xff, 0xaa, 0x9f, 0x25, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xab, 0xa0, 0x25, 0xff, 0xab, 0xa1, 0x25, 0xff, 0xab, 0xa1, 0x25, 0xff, 0xac, 0xa1, 0x25, 0xff, 0xb6, 0xb0, 0x4d, 0xff, 0xb4, 0xae, 0x48, 0xff, 0xb5, 0xae, 0x48, 0xff, 0xb5, 0xae, 0x48, 0xff, 0xb4, 0xae, 0x48, 0xff, 0xb5, 0xae, 0x48, 0xff, 0xb4, 0xae, 0x48, 0xff, 0xb4, 0xae, 0x48, 0xff, 0xb4, 0xae, 0x48, 0xff, 0xb4, 0xad, 0x47, 0xff, 0xb3, 0xad, 0x47, 0xff, 0xb3, 0xac, 0x47, 0xff, 0xb2, 0xac, 0x47, 0xff, 0xb2, 0xac, 0x48, 0xff, 0xb0, 0xa8, 0x3f, 0xff, 0xb8, 0xab, 0x20, 0xff, 0x11, 0x11, 0x1c, 0xff, 0x10, 0x11, 0x1c, 0xff, 0x7f, 0x76, 0x20, 0xff, 0xab, 0x9f, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa2, 0x97, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa1, 0x99, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9e, 0x92, 0x1d, 0xff, 0x9a, 0x8b, 0x1a, 0xff, 0x9d, 0x8f, 0x1c, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa7, 0x9b, 0x20, 0xff, 0x8b, 0x81, 0x1f, 0xff, 0x0d, 0x0e, 0x1b, 0xff, 0x0a, 0x0c, 0x1b, 0xff, 0xaf, 0xa3, 0x23, 0xff, 0xa7, 0x9c, 0x22, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9e, 0x24, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa9, 0x9e, 0x24, 0xff, 0xa9, 0x9f, 0x24, 0xff, 0xa8, 0x9d, 0x1f, 0xff, 0xa8, 0x9d, 0x1f, 0xff, 0xa9, 0x9d, 0x1f, 0xff, 0xa9, 0x9d, 0x1f, 0xff, 0xa8, 0x9d, 0x1f, 0xff, 0xa8, 0x9d, 0x1f, 0xff, 0xa8, 0x9d, 0x1f, 0xff, 0xa8, 0x9c, 0x1e, 0xff, 0xa8, 0x9c, 0x1e, 0xff, 0xa7, 0x9c, 0x1e, 0xff, 0xa7, 0x9b, 0x1e, 0xff, 0xa7, 0x9b, 0x1d, 0xff, 0xa6, 0x9a, 0x1d, 0xff, 0xa6, 0x9a, 0x1d, 0xff, 0xa5, 0x9a, 0x1e, 0xff, 0xb7, 0xaa, 0x23, 0xff, 0x10, 0x10, 0x1b, 0xff, 0x0f, 0x10, 0x1b, 0xff, 0x7d, 0x75, 0x1f, 0xff, 0xa9, 0x9d, 0x20, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0xa0, 0x92, 0x1d, 0xff, 0x9d, 0x92, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9d, 0x8f, 0x1c, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa5, 0x99, 0x1f, 0xff, 0x89, 0x7f, 0x1e, 0xff, 0x0c, 0x0e, 0x1a, 0xff, 0x09, 0x0b, 0x1a, 0xff, 0xac, 0xa1, 0x21, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa6, 0x9a, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa7, 0x9b, 0x22, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa7, 0x9d, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa8, 0x9d, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa7, 0x9c, 0x23, 0xff, 0xa7, 0x9c, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa6, 0x9a, 0x22, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xb5, 0xa8, 0x21, 0xff, 0x0f, 0x0f, 0x1a, 0xff, 0x0e, 0x0f, 0x1a, 0xff, 0x7b, 0x72, 0x1d, 0xff, 0xa7, 0x9a, 0x1f, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0x9d, 0x90, 0x1d, 0xff, 0x9f, 0x91, 0x1d, 0xff, 0x9d, 0x90, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x18, 0xff, 0x99, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x9d, 0x8f, 0x1c, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0xa3, 0x97, 0x1d, 0xff, 0x86, 0x7c, 0x1d, 0xff, 0x07, 0x09, 0x19, 0xff, 0x04, 0x06, 0x19, 0xff, 0xaa, 0x9e, 0x20, 0xff, 0xa3, 0x97, 0x20, 0xff, 0xa3, 0x97, 0x20, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa4, 0x98, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa5, 0x99, 0x21, 0xff, 0xa5, 0x99, 0x21, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa6, 0x9a, 0x22, 0xff, 0xa6, 0x9a, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa6, 0x9b, 0x22, 0xff, 0xa6, 0x9a, 0x22, 0xff, 0xa6, 0x9a, 0x22, 0xff, 0xa5, 0x9a, 0x22, 0xff, 0xa5, 0x9a, 0x21, 0xff, 0xa5, 0x99, 0x21, 0xff, 0xa5, 0x99, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa4, 0x99, 0x21, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa3, 0x97, 0x20, 0xff, 0xa2, 0x97, 0x20, 0xff, 0xb2, 0xa5, 0x20, 0xff, 0x09, 0x0b, 0x19, 0xff, 0x09, 0x0a, 0x19, 0xff, 0x78, 0x6f, 0x1c, 0xff, 0xa5, 0x98, 0x1e, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9e, 0x90, 0x1c, 0xff, 0x9a, 0x8b, 0x1a, 0xff, 0x9e, 0x90, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0xa0, 0x93, 0x1c, 0xff, 0x89, 0x7f, 0x1c, 0xff, 0x26, 0x25, 0x19, 0xff, 0x24, 0x23, 0x19, 0xff, 0xa6, 0x99, 0x1e, 0xff, 0xa1, 0x95, 0x1e, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa3, 0x97, 0x20, 0xff, 0xa3, 0x97, 0x20, 0xff, 0xa3, 0x97, 0x20, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa4, 0x98, 0x20, 0xff, 0xa4, 0x98, 0x20, 0xff, 0xa4, 0x98, 0x20, 0xff, 0xa4, 0x98, 0x20, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa3, 0x98, 0x20, 0xff, 0xa3, 0x97, 0x20, 0xff, 0xa3, 0x97, 0x20, 0xff, 0xa3, 0x97, 0x20, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa2, 0x96, 0x1f, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xac, 0x9f, 0x1e, 0xff, 0x28, 0x27, 0x19, 0xff, 0x27, 0x26, 0x19, 0xff, 0x7e, 0x75, 0x1c, 0xff, 0xa1, 0x94, 0x1c, 0xff, 0x9c, 0x90, 0x1c, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0xa0, 0x90, 0x1b, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x87, 0x17, 0xff, 0x97, 0x88, 0x17, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x97, 0x88, 0x17, 0xff, 0x97, 0x88, 0x17, 0xff, 0x9b, 0x8f, 0x1b, 0xff, 0x9f, 0x92, 0x1b, 0xff, 0xa9, 0x9b, 0x1c, 0xff, 0xaa, 0x9c, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa1, 0x95, 0x1e, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa1, 0x96, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa1, 0x95, 0x1f, 0xff, 0xa1, 0x95, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0xa0, 0x94, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9e, 0x91, 0x1d, 0xff, 0xaa, 0x9c, 0x1d, 0xff, 0xa9, 0x9c, 0x1c, 0xff, 0xa0, 0x93, 0x1c, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x99, 0x8f, 0x1c, 0xff, 0x97, 0x8b, 0x19, 0xff, 0x98, 0x88, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x87, 0x17, 0xff, 0x95, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x97, 0x89, 0x17, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9c, 0x90, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9e, 0x91, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9f, 0x93, 0x1e, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9f, 0x93, 0x1d, 0xff, 0x9f, 0x92, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9e, 0x92, 0x1d, 0xff, 0x9e, 0x91, 0x1d, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9c, 0x90, 0x1c, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x97, 0x8b, 0x19, 0xff, 0x96, 0x8a, 0x19, 0xff, 0x97, 0x8b, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x86, 0x17, 0xff, 0x95, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x99, 0x8b, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9c, 0x8f, 0x1c, 0xff, 0x9c, 0x90, 0x1c, 0xff, 0x9c, 0x90, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9d, 0x91, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9d, 0x90, 0x1c, 0xff, 0x9c, 0x90, 0x1c, 0xff, 0x9c, 0x90, 0x1c, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9c, 0x8f, 0x1b, 0xff, 0x9b, 0x8f, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x88, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x89, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x87, 0x17, 0xff, 0x95, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x97, 0x87, 0x17, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8b, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x9a, 0x8c, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8d, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9b, 0x8e, 0x1b, 0xff, 0x9a, 0x8d, 0x1b, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8d, 0x1a, 0xff, 0x9a, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8b, 0x1a, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x95, 0x88, 0x17, 0xff, 0x95, 0x88, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x8b, 0x19, 0xff, 0x94, 0x89, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x86, 0x17, 0xff, 0x95, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x96, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x99, 0x8c, 0x1a, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8b, 0x19, 0xff, 0x98, 0x8a, 0x19, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x89, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x87, 0x18, 0xff, 0x97, 0x8a, 0x19, 0xff, 0x97, 0x8b, 0x19, 0xff, 0x97, 0x8a, 0x1a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x88, 0x17, 0xff, 0x95, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x93, 0x84, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x88, 0x17, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x97, 0x89, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x96, 0x89, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x96, 0x88, 0x18, 0xff, 0x95, 0x88, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x84, 0x16, 0xff, 0x96, 0x86, 0x17, 0xff, 0x90, 0x80, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x85, 0x17, 0xff, 0x93, 0x85, 0x15, 0xff, 0x95, 0x86, 0x17, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x92, 0x83, 0x15, 0xff, 0x92, 0x84, 0x15, 0xff, 0x93, 0x84, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x94, 0x86, 0x16, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x95, 0x87, 0x17, 0xff, 0x94, 0x87, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x17, 0xff, 0x94, 0x86, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x83, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x8f, 0x84, 0x16, 0xff, 0x91, 0x83, 0x15, 0xff, 0x90, 0x81, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x7c, 0x10, 0xff, 0x8f, 0x80, 0x10, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x92, 0x83, 0x15, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x84, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x93, 0x85, 0x16, 0xff, 0x93, 0x84, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x92, 0x84, 0x16, 0xff, 0x92, 0x84, 0x15, 0xff, 0x92, 0x83, 0x15, 0xff, 0x91, 0x83, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x92, 0x82, 0x15, 0xff, 0x92, 0x82, 0x13, 0xff, 0x90, 0x7e, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x78, 0x0f, 0xff, 0x8f, 0x83, 0x0f, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x14, 0xff, 0x8f, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x91, 0x82, 0x15, 0xff, 0x90, 0x82, 0x14, 0xff, 0x90, 0x82, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x90, 0x81, 0x14, 0xff, 0x8f, 0x81, 0x14, 0xff, 0x8f, 0x80, 0x14, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8f, 0x80, 0x14, 0xff, 0x92, 0x82, 0x15, 0xff, 0x90, 0x7f, 0x14, 0xff, 0x8e, 0x80, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x78, 0x0f, 0xff, 0x8b, 0x7c, 0x0f, 0xff, 0x8d, 0x7d, 0x0f, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8d, 0x7d, 0x12, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7e, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8e, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8f, 0x80, 0x13, 0xff, 0x8e, 0x80, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8e, 0x7f, 0x13, 0xff, 0x8d, 0x7e, 0x13, 0xff, 0x8d, 0x7e, 0x12, 0xff, 0x8d, 0x7d, 0x12, 0xff, 0x8f, 0x7e, 0x12, 0xff, 0x8c, 0x7e, 0x13, 0xff, 0x8d, 0x7d, 0x13, 0xff, 0x8c, 0x7d, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x89, 0x79, 0x0f, 0xff, 0x8a, 0x7a, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8b, 0x7c, 0x11, 0xff, 0x8c, 0x7c, 0x11, 0xff, 0x8c, 0x7c, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8d, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7d, 0x12, 0xff, 0x8c, 0x7c, 0x12, 0xff, 0x8c, 0x7c, 0x11, 0xff, 0x8b, 0x7c, 0x11, 0xff, 0x8b, 0x7b, 0x11, 0xff, 0x8d, 0x7d, 0x13, 0xff, 0x8d, 0x7e, 0x13, 0xff, 0x8c, 0x7e, 0x13, 0xff, 0x8c, 0x7e, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x8f, 0x7f, 0x0f, 0xff, 0x89, 0x7a, 0x0f, 0xff, 0x89, 0x7a, 0x0f, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7b, 0x11, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x8a, 0x7a, 0x10, 0xff, 0x89, 0x7a, 0x10, 0xff, 0x8a, 0x7b, 0x10, 0xff, 0x8c, 0x80, 0x13, 0xff, 0x8c, 0x7d, 0x13, 0xff, 0x8c, 0x7e, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x78, 0x0e, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x89, 0x79, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x79, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x10, 0xff, 0x88, 0x78, 0x10, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x79, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x8b, 0x7a, 0x0f, 0xff, 0x8d, 0x7b, 0x0f, 0xff, 0x89, 0x79, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x8c, 0x7e, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x89, 0x78, 0x0f, 0xff, 0x8e, 0x7a, 0x0f, 0xff, 0x8d, 0x7a, 0x0f, 0xff, 0x8d, 0x7b, 0x0f, 0xff, 0x89, 0x79, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x8b, 0x7a, 0x0f, 0xff, 0x88, 0x79, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x88, 0x78, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t sleep_monitor = {
-  .header.always_zero = 0,
-  .header.w = 50,
-  .header.h = 50,
-  .data_size = 2500 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = sleep_monitor_map,
-};
-
@@ -1,622 +0,0 @@
-/**
- ****************************************************************************************
- *
- * @file tick_second.c
- *
- * @brief Second hand source file
- *
- * Copyright (C) 2021-2022 Dialog Semiconductor.
- * This computer program includes Confidential, Proprietary Information
- * of Dialog Semiconductor. All Rights Reserved.
- *
- ****************************************************************************************
- */
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_TICK_SECOND
-#define LV_ATTRIBUTE_IMG_TICK_SECOND
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_TICK_SECOND uint8_t tick_second_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x00, 0x01, 
-  0x00, 0x02, 0x17, 0xff, 0x17, 0xff, 0x00, 0x10, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x00, 0x00, 0x01, 
-  0x00, 0x00, 0x02, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x00, 0x00, 0x10, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 0x7a, 0x05, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x00, 0x00, 0x01, 
-  0x00, 0x00, 0x02, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x00, 0x00, 0x10, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 0x05, 0x7a, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 
-  0x00, 0x00, 0x00, 0x02, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0x00, 0x00, 0x00, 0x10, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xcd, 0xac, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t tick_second = {
-  .header.always_zero = 0,
-  .header.w = 4,
-  .header.h = 143,
-  .data_size = 572 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = tick_second_map,
-};
-
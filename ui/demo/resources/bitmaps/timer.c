@@ -1,248 +0,0 @@
-/**
- ****************************************************************************************
- *
- * @file timer.c
- *
- * @brief Timer icon source file
- *
- * Copyright (C) 2021-2022 Dialog Semiconductor.
- * This computer program includes Confidential, Proprietary Information
- * of Dialog Semiconductor. All Rights Reserved.
- *
- ****************************************************************************************
- */
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-#ifndef LV_ATTRIBUTE_IMG_TIMER
-#define LV_ATTRIBUTE_IMG_TIMER
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_TIMER uint8_t timer_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x91, 0xff, 0x2d, 0xff, 0x2d, 0xff, 0x95, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x09, 0xff, 0x06, 0xff, 0x29, 0xff, 0x09, 0xff, 0x06, 0xff, 0x09, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x4d, 0xff, 0x06, 0xff, 0xd8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xd4, 0xff, 0x06, 0xff, 0x71, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x06, 0xff, 0x71, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x4d, 0xff, 0x09, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x06, 0xff, 0x91, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x71, 0xff, 0x05, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0x09, 0xff, 0x29, 0xff, 0x4d, 0xff, 0x05, 0xff, 0x05, 0xff, 0x71, 0xff, 0x09, 0xff, 0x2d, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xd4, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0xd8, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xd4, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xd4, 0xff, 0x91, 0xff, 0x29, 0xff, 0x09, 0xff, 0x09, 0xff, 0x29, 0xff, 0x91, 0xff, 0xd4, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xb0, 0xff, 0x09, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x09, 0xff, 0xb4, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x09, 0xff, 0x05, 0xff, 0x05, 0xff, 0x09, 0xff, 0x92, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0x72, 0xff, 0x09, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x05, 0xff, 0x05, 0xff, 0x09, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x05, 0xff, 0x05, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0xff, 0x05, 0xff, 0x05, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x00, 0x00, 
-  0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x09, 0xff, 0x05, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0xff, 0x05, 0xff, 0x29, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0x00, 0x00, 
-  0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb0, 0xff, 0x05, 0xff, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x05, 0xff, 0xd4, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 
-  0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x05, 0xff, 0x05, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x05, 0xff, 0x29, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 
-  0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0x05, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x05, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 
-  0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x8c, 0xff, 0x05, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x05, 0xff, 0xb0, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 
-  0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0x4d, 0xff, 0x05, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xff, 0x05, 0xff, 0x6d, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 
-  0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0x49, 0xff, 0x05, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x53, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0x77, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x05, 0xff, 0x4d, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 
-  0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0x49, 0xff, 0x01, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xff, 0x92, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x97, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x01, 0xff, 0x6d, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0x69, 0xff, 0x01, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x01, 0xff, 0x6c, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0x8c, 0xff, 0x01, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x05, 0xff, 0xb0, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x01, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0x25, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x01, 0xff, 0x49, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xd0, 0xff, 0x01, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0x49, 0xff, 0x01, 0xff, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x01, 0xff, 0x48, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x05, 0xff, 0x01, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x01, 0xff, 0x05, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x05, 0xff, 0x01, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x00, 0xff, 0x01, 0xff, 0x05, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x48, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x92, 0xff, 0x96, 0xff, 0x96, 0xff, 0x92, 0xff, 0x49, 0xff, 0x00, 0xff, 0x00, 0xff, 0x01, 0xff, 0x68, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xd0, 0xff, 0x28, 0xff, 0x01, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x01, 0xff, 0x01, 0xff, 0x48, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xac, 0xff, 0x8c, 0xff, 0x68, 0xff, 0x68, 0xff, 0x8c, 0xff, 0xb0, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x60, 0xff, 0xff, 0x60, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0x40, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x60, 0xff, 0xff, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0xff, 0x60, 0xff, 0xff, 0x60, 0xff, 0xff, 0x20, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xff, 0x46, 0x7c, 0xff, 0xaa, 0x22, 0xff, 0xca, 0x22, 0xff, 0x85, 0x84, 0xff, 0x40, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xec, 0x01, 0xff, 0x2d, 0x01, 0xff, 0x6a, 0x12, 0xff, 0x4b, 0x0a, 0xff, 0x2d, 0x01, 0xff, 0x2b, 0x0a, 0xff, 0x20, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x48, 0x43, 0xff, 0x4d, 0x01, 0xff, 0xc2, 0xcd, 0xff, 0x60, 0xff, 0xff, 0x60, 0xff, 0xff, 0x43, 0xb5, 0xff, 0x2d, 0x01, 0xff, 0xc7, 0x63, 0xff, 0x00, 0xff, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0x20, 0xff, 0xff, 0x4c, 0x01, 0xff, 0xa7, 0x5b, 0xff, 0x40, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0xff, 0x08, 0x3b, 0xff, 0xcb, 0x01, 0xff, 0x20, 0xff, 0xff, 0xa0, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x0c, 0x01, 0xff, 0x45, 0x84, 0xff, 0x40, 0xff, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x40, 0xff, 0xff, 0xc6, 0x63, 0xff, 0x4c, 0x01, 0xff, 0x20, 0xff, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xea, 0x01, 0xff, 0x49, 0x1a, 0xff, 0x47, 0x53, 0xff, 0x2c, 0x01, 0xff, 0x2c, 0x01, 0xff, 0xa6, 0x63, 0xff, 0xea, 0x01, 0xff, 0x89, 0x22, 0xff, 0xe0, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0xa0, 0xfe, 0xff, 0x43, 0xbd, 0xff, 0x0c, 0x01, 0xff, 0xaa, 0x01, 0xff, 0xea, 0x01, 0xff, 0xea, 0x01, 0xff, 0xaa, 0x01, 0xff, 0x0c, 0x01, 0xff, 0xa2, 0xd5, 0xff, 0x80, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x42, 0xc5, 0xff, 0xca, 0x01, 0xff, 0xca, 0x01, 0xff, 0xca, 0x01, 0xff, 0xea, 0x09, 0xff, 0xa2, 0xd5, 0xff, 0xe0, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfe, 0xff, 0xc0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x62, 0xcd, 0xff, 0x24, 0x8c, 0xff, 0x09, 0x12, 0xff, 0xca, 0x01, 0xff, 0xaa, 0x01, 0xff, 0x48, 0x1a, 0xff, 0x44, 0x8c, 0xff, 0x82, 0xd5, 0xff, 0xe0, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x64, 0x9c, 0xff, 0x89, 0x01, 0xff, 0x2a, 0x01, 0xff, 0x29, 0x01, 0xff, 0x28, 0x01, 0xff, 0x27, 0x01, 0xff, 0x27, 0x01, 0xff, 0x28, 0x01, 0xff, 0x29, 0x01, 0xff, 0x2a, 0x01, 0xff, 0xa9, 0x01, 0xff, 0xa3, 0xa4, 0xff, 0xc0, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xc0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0xc9, 0x09, 0xff, 0x29, 0x01, 0xff, 0x07, 0x01, 0xff, 0x0a, 0x12, 0xff, 0x73, 0x74, 0xff, 0xd8, 0xad, 0xff, 0xbb, 0xce, 0xff, 0x9a, 0xce, 0xff, 0xd8, 0xad, 0xff, 0x52, 0x6c, 0xff, 0xc9, 0x09, 0xff, 0x07, 0x01, 0xff, 0x2a, 0x01, 0xff, 0x28, 0x1a, 0xff, 0x20, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x20, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0x81, 0xe5, 0xff, 0x2a, 0x01, 0xff, 0x28, 0x01, 0xff, 0xc9, 0x09, 0xff, 0x39, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb5, 0xff, 0x88, 0x01, 0xff, 0x28, 0x01, 0xff, 0x49, 0x01, 0xff, 0xc1, 0xf5, 0xff, 0x20, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x80, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0xe0, 0xfd, 0xff, 0x09, 0x01, 0xff, 0x07, 0x01, 0xff, 0x2e, 0x43, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xde, 0xff, 0xff, 0x5b, 0x55, 0xff, 0xbb, 0x75, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x2a, 0xff, 0x07, 0x01, 0xff, 0x29, 0x01, 0xff, 0x20, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0xa0, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x60, 0xfe, 0xff, 0xc8, 0x11, 0xff, 0x07, 0x01, 0xff, 0x0e, 0x43, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xe7, 0xff, 0x5b, 0x9e, 0xff, 0x7e, 0xef, 0xff, 0xde, 0xff, 0xff, 0x5d, 0x9e, 0xff, 0x7d, 0xa6, 0xff, 0x9e, 0xff, 0xff, 0x3d, 0xdf, 0xff, 0x7b, 0x9e, 0xff, 0x3d, 0xe7, 0xff, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x2a, 0xff, 0x08, 0x01, 0xff, 0x27, 0x2a, 0xff, 0x60, 0xfe, 0xff, 0xe0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x00, 0x00, 0x00, 
-  0x60, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x23, 0x9c, 0xff, 0xe8, 0x00, 0xff, 0x88, 0x01, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x9e, 0xef, 0xff, 0xdc, 0xbe, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x59, 0xd6, 0xff, 0x9a, 0xde, 0xff, 0xdf, 0xff, 0xff, 0x5d, 0xef, 0xff, 0xbc, 0xbe, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xdf, 0xff, 0xff, 0x27, 0x01, 0xff, 0xe8, 0x00, 0xff, 0x82, 0xbc, 0xff, 0x00, 0xfe, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 
-  0x40, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0x40, 0xfe, 0xff, 0x68, 0x01, 0xff, 0xc6, 0x00, 0xff, 0xf8, 0xb5, 0xff, 0xbe, 0xff, 0xff, 0x5d, 0xdf, 0xff, 0x7e, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x76, 0xb5, 0xff, 0xd7, 0xbd, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x1c, 0xdf, 0xff, 0x9e, 0xff, 0xff, 0x35, 0x9d, 0xff, 0xc6, 0x00, 0xff, 0xc7, 0x19, 0xff, 0x40, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 
-  0x40, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0xe1, 0xd4, 0xff, 0xc8, 0x00, 0xff, 0x88, 0x09, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x3a, 0x96, 0xff, 0xbc, 0xb6, 0xff, 0xbe, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x76, 0xb5, 0xff, 0xd7, 0xbd, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x9b, 0xae, 0xff, 0x7b, 0xa6, 0xff, 0x5d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x06, 0x01, 0xff, 0xc8, 0x00, 0xff, 0x60, 0xf5, 0xff, 0xc0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x80, 0xfd, 0xff, 
-  0x40, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x64, 0x83, 0xff, 0xc6, 0x00, 0xff, 0xf1, 0x6b, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x75, 0xb5, 0xff, 0xd7, 0xbd, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0xbe, 0xff, 0xff, 0x6f, 0x53, 0xff, 0xc7, 0x00, 0xff, 0xe3, 0x9b, 0xff, 0xc0, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x40, 0xfd, 0xff, 
-  0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x85, 0x4a, 0xff, 0xa5, 0x00, 0xff, 0x56, 0xa5, 0xff, 0x7d, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0xde, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xb6, 0xbd, 0xff, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xd4, 0x8c, 0xff, 0xa6, 0x00, 0xff, 0xe4, 0x62, 0xff, 0xc0, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x40, 0xfd, 0xff, 
-  0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0xe0, 0xfd, 0xff, 0x25, 0x32, 0xff, 0x85, 0x00, 0xff, 0x19, 0xbe, 0xff, 0x9d, 0xff, 0xff, 0x7a, 0x4c, 0xff, 0x7b, 0x7d, 0xff, 0xbe, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x41, 0xff, 0x28, 0x4a, 0xff, 0x55, 0xad, 0xff, 0xf4, 0xa4, 0xff, 0x55, 0xad, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0xda, 0x5c, 0xff, 0xfa, 0x64, 0xff, 0xbe, 0xff, 0xff, 0x76, 0xa5, 0xff, 0x85, 0x00, 0xff, 0xa4, 0x52, 0xff, 0xc0, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0x00, 0xfd, 0xff, 
-  0x00, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0xc0, 0xfd, 0xff, 0x25, 0x3a, 0xff, 0x85, 0x00, 0xff, 0xf8, 0xbd, 0xff, 0x9d, 0xff, 0xff, 0x1a, 0x75, 0xff, 0xdc, 0x9d, 0xff, 0xbe, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x73, 0xff, 0xaf, 0x7b, 0xff, 0x18, 0xc6, 0xff, 0xb7, 0xbd, 0xff, 0x18, 0xc6, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xf7, 0xff, 0x7b, 0x85, 0xff, 0x7b, 0x85, 0xff, 0x9d, 0xff, 0xff, 0x55, 0x9d, 0xff, 0x85, 0x00, 0xff, 0xa4, 0x52, 0xff, 0xc0, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x60, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x84, 0x52, 0xff, 0x85, 0x00, 0xff, 0x15, 0x9d, 0xff, 0x7d, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x5c, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x73, 0x84, 0xff, 0x85, 0x00, 0xff, 0x04, 0x6b, 0xff, 0xa0, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x80, 0xfd, 0xff, 0x63, 0x8b, 0xff, 0x85, 0x00, 0xff, 0x6f, 0x5b, 0xff, 0x9e, 0xf7, 0xff, 0x1c, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0x1c, 0xdf, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xd6, 0xff, 0x1c, 0xe7, 0xff, 0xbe, 0xff, 0xff, 0xcc, 0x42, 0xff, 0x86, 0x00, 0xff, 0xc2, 0xa3, 0xff, 0x80, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0xe1, 0xec, 0xff, 0x86, 0x00, 0xff, 0xe5, 0x00, 0xff, 0xdf, 0xff, 0xff, 0x3c, 0xef, 0xff, 0xf9, 0x7d, 0xff, 0x5a, 0xa6, 0xff, 0x1c, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x3a, 0x96, 0xff, 0x1a, 0x86, 0xff, 0x3c, 0xef, 0xff, 0x9e, 0xff, 0xff, 0x84, 0x00, 0xff, 0x86, 0x00, 0xff, 0x40, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x45, 0x11, 0xff, 0x64, 0x00, 0xff, 0xf4, 0x94, 0xff, 0x7d, 0xf7, 0xff, 0xfc, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x9e, 0xf7, 0xff, 0x31, 0x7c, 0xff, 0x84, 0x00, 0xff, 0xe4, 0x31, 0xff, 0xa0, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0x01, 0xbc, 0xff, 0x66, 0x00, 0xff, 0xa4, 0x00, 0xff, 0x7d, 0xf7, 0xff, 0x3c, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xd6, 0xff, 0x1a, 0x8e, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x5c, 0xf7, 0xff, 0x5c, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x1a, 0x8e, 0xff, 0xfc, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x63, 0x00, 0xff, 0x66, 0x00, 0xff, 0x81, 0xd4, 0xff, 0x40, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0x00, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc4, 0x31, 0xff, 0x85, 0x00, 0xff, 0x88, 0x19, 0xff, 0xdf, 0xff, 0xff, 0x3c, 0xef, 0xff, 0xdb, 0xd6, 0xff, 0xf9, 0x85, 0xff, 0xfc, 0xde, 0xff, 0x5c, 0xf7, 0xff, 0x39, 0x54, 0xff, 0xda, 0x74, 0xff, 0x5c, 0xf7, 0xff, 0xfc, 0xd6, 0xff, 0xf9, 0x85, 0xff, 0xfc, 0xde, 0xff, 0x3c, 0xef, 0xff, 0xbe, 0xff, 0xff, 0x26, 0x09, 0xff, 0x85, 0x00, 0xff, 0x44, 0x52, 0xff, 0x80, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0xc5, 0x00, 0xff, 0x64, 0x00, 0xff, 0x67, 0x11, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x3c, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0xda, 0x74, 0xff, 0x1a, 0x7d, 0xff, 0x3c, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0xfc, 0xe6, 0xff, 0x06, 0x01, 0xff, 0x84, 0x00, 0xff, 0x25, 0x09, 0xff, 0x60, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xc0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xe5, 0x00, 0xff, 0x64, 0x00, 0xff, 0x63, 0x00, 0xff, 0x52, 0x84, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0xf0, 0x73, 0xff, 0x42, 0x00, 0xff, 0x65, 0x00, 0xff, 0x05, 0x09, 0xff, 0x20, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0x00, 0xfd, 0xff, 0x40, 0xfd, 0xff, 0xc4, 0x39, 0xff, 0x45, 0x00, 0xff, 0x43, 0x00, 0xff, 0x43, 0x00, 0xff, 0x8b, 0x42, 0xff, 0x11, 0x74, 0xff, 0xd4, 0x94, 0xff, 0xd3, 0x8c, 0xff, 0xf0, 0x73, 0xff, 0x4a, 0x32, 0xff, 0x22, 0x00, 0xff, 0x43, 0x00, 0xff, 0x45, 0x00, 0xff, 0x23, 0x52, 0xff, 0x60, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0x60, 0xfd, 0xff, 0x21, 0xcc, 0xff, 0x84, 0x29, 0xff, 0x45, 0x00, 0xff, 0x44, 0x00, 0xff, 0x23, 0x00, 0xff, 0x23, 0x00, 0xff, 0x23, 0x00, 0xff, 0x23, 0x00, 0xff, 0x44, 0x00, 0xff, 0x45, 0x00, 0xff, 0xc3, 0x39, 0xff, 0x40, 0xdc, 0xff, 0x40, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0x40, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0x81, 0xab, 0xff, 0xa2, 0x72, 0xff, 0x43, 0x62, 0xff, 0x63, 0x62, 0xff, 0xc2, 0x7a, 0xff, 0x81, 0xab, 0xff, 0x00, 0xfd, 0xff, 0x20, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xe0, 0xfc, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0x00, 0xfd, 0xff, 0xe0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfc, 0xff, 0xc0, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfc, 0xff, 0xa0, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x80, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x60, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x40, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x60, 0xff, 0xff, 0x60, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x60, 0xff, 0xff, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x60, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0xff, 0xff, 0x60, 0xff, 0xff, 0x60, 0xff, 0xff, 0x20, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xff, 0x7c, 0x46, 0xff, 0x22, 0xaa, 0xff, 0x22, 0xca, 0xff, 0x84, 0x85, 0xff, 0xff, 0x40, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x40, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0x01, 0xec, 0xff, 0x01, 0x2d, 0xff, 0x12, 0x6a, 0xff, 0x0a, 0x4b, 0xff, 0x01, 0x2d, 0xff, 0x0a, 0x2b, 0xff, 0xff, 0x20, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xff, 0x00, 0xff, 0x43, 0x48, 0xff, 0x01, 0x4d, 0xff, 0xcd, 0xc2, 0xff, 0xff, 0x60, 0xff, 0xff, 0x60, 0xff, 0xb5, 0x43, 0xff, 0x01, 0x2d, 0xff, 0x63, 0xc7, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xff, 0x20, 0xff, 0x01, 0x4c, 0xff, 0x5b, 0xa7, 0xff, 0xff, 0x40, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0xff, 0x3b, 0x08, 0xff, 0x01, 0xcb, 0xff, 0xff, 0x20, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0xa0, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0xe0, 0xff, 0x01, 0x0c, 0xff, 0x84, 0x45, 0xff, 0xff, 0x40, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xff, 0x40, 0xff, 0x63, 0xc6, 0xff, 0x01, 0x4c, 0xff, 0xff, 0x20, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xff, 0x00, 0xff, 0x01, 0xea, 0xff, 0x1a, 0x49, 0xff, 0x53, 0x47, 0xff, 0x01, 0x2c, 0xff, 0x01, 0x2c, 0xff, 0x63, 0xa6, 0xff, 0x01, 0xea, 0xff, 0x22, 0x89, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0xa0, 0xff, 0xbd, 0x43, 0xff, 0x01, 0x0c, 0xff, 0x01, 0xaa, 0xff, 0x01, 0xea, 0xff, 0x01, 0xea, 0xff, 0x01, 0xaa, 0xff, 0x01, 0x0c, 0xff, 0xd5, 0xa2, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0xe0, 0xff, 0xc5, 0x42, 0xff, 0x01, 0xca, 0xff, 0x01, 0xca, 0xff, 0x01, 0xca, 0xff, 0x09, 0xea, 0xff, 0xd5, 0xa2, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x60, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x20, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0xe0, 0xff, 0xcd, 0x62, 0xff, 0x8c, 0x24, 0xff, 0x12, 0x09, 0xff, 0x01, 0xca, 0xff, 0x01, 0xaa, 0xff, 0x1a, 0x48, 0xff, 0x8c, 0x44, 0xff, 0xd5, 0x82, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0xc0, 0xff, 0x9c, 0x64, 0xff, 0x01, 0x89, 0xff, 0x01, 0x2a, 0xff, 0x01, 0x29, 0xff, 0x01, 0x28, 0xff, 0x01, 0x27, 0xff, 0x01, 0x27, 0xff, 0x01, 0x28, 0xff, 0x01, 0x29, 0xff, 0x01, 0x2a, 0xff, 0x01, 0xa9, 0xff, 0xa4, 0xa3, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x20, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x00, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x00, 0xff, 0x09, 0xc9, 0xff, 0x01, 0x29, 0xff, 0x01, 0x07, 0xff, 0x12, 0x0a, 0xff, 0x74, 0x73, 0xff, 0xad, 0xd8, 0xff, 0xce, 0xbb, 0xff, 0xce, 0x9a, 0xff, 0xad, 0xd8, 0xff, 0x6c, 0x52, 0xff, 0x09, 0xc9, 0xff, 0x01, 0x07, 0xff, 0x01, 0x2a, 0xff, 0x1a, 0x28, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x40, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xe0, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x20, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x40, 0xff, 0xe5, 0x81, 0xff, 0x01, 0x2a, 0xff, 0x01, 0x28, 0xff, 0x09, 0xc9, 0xff, 0xbe, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xf8, 0xff, 0x01, 0x88, 0xff, 0x01, 0x28, 0xff, 0x01, 0x49, 0xff, 0xf5, 0xc1, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xe0, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0x00, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfe, 0x00, 0xff, 0xfd, 0xe0, 0xff, 0x01, 0x09, 0xff, 0x01, 0x07, 0xff, 0x43, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xde, 0xff, 0x55, 0x5b, 0xff, 0x75, 0xbb, 0xff, 0xff, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xac, 0xff, 0x01, 0x07, 0xff, 0x01, 0x29, 0xff, 0xfe, 0x20, 0xff, 0xfe, 0x00, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc0, 0xff, 0x00, 0x00, 0x00, 
-  0xfd, 0xa0, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xe0, 0xff, 0xfe, 0x60, 0xff, 0x11, 0xc8, 0xff, 0x01, 0x07, 0xff, 0x43, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x7e, 0xff, 0x9e, 0x5b, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xde, 0xff, 0x9e, 0x5d, 0xff, 0xa6, 0x7d, 0xff, 0xff, 0x9e, 0xff, 0xdf, 0x3d, 0xff, 0x9e, 0x7b, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x8c, 0xff, 0x01, 0x08, 0xff, 0x2a, 0x27, 0xff, 0xfe, 0x60, 0xff, 0xfd, 0xe0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0xa0, 0xff, 0x00, 0x00, 0x00, 
-  0xfd, 0x60, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfe, 0x00, 0xff, 0x9c, 0x23, 0xff, 0x00, 0xe8, 0xff, 0x01, 0x88, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x9e, 0xff, 0xbe, 0xdc, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xd6, 0x59, 0xff, 0xde, 0x9a, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x5d, 0xff, 0xbe, 0xbc, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xff, 0xdf, 0xff, 0x01, 0x27, 0xff, 0x00, 0xe8, 0xff, 0xbc, 0x82, 0xff, 0xfe, 0x00, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0xa0, 0xff, 
-  0xfd, 0x40, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc0, 0xff, 0xfe, 0x40, 0xff, 0x01, 0x68, 0xff, 0x00, 0xc6, 0xff, 0xb5, 0xf8, 0xff, 0xff, 0xbe, 0xff, 0xdf, 0x5d, 0xff, 0xef, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xb5, 0x76, 0xff, 0xbd, 0xd7, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x1c, 0xff, 0xff, 0x9e, 0xff, 0x9d, 0x35, 0xff, 0x00, 0xc6, 0xff, 0x19, 0xc7, 0xff, 0xfe, 0x40, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0xa0, 0xff, 
-  0xfd, 0x40, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc0, 0xff, 0xd4, 0xe1, 0xff, 0x00, 0xc8, 0xff, 0x09, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x96, 0x3a, 0xff, 0xb6, 0xbc, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xb5, 0x76, 0xff, 0xbd, 0xd7, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xae, 0x9b, 0xff, 0xa6, 0x7b, 0xff, 0xf7, 0x5d, 0xff, 0xff, 0xff, 0xff, 0x01, 0x06, 0xff, 0x00, 0xc8, 0xff, 0xf5, 0x60, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x80, 0xff, 
-  0xfd, 0x40, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0xe0, 0xff, 0x83, 0x64, 0xff, 0x00, 0xc6, 0xff, 0x6b, 0xf1, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xb5, 0x75, 0xff, 0xbd, 0xd7, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xff, 0xbe, 0xff, 0x53, 0x6f, 0xff, 0x00, 0xc7, 0xff, 0x9b, 0xe3, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x40, 0xff, 
-  0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0xe0, 0xff, 0x4a, 0x85, 0xff, 0x00, 0xa5, 0xff, 0xa5, 0x56, 0xff, 0xf7, 0x7d, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xde, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xbd, 0xb6, 0xff, 0xc6, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0x8c, 0xd4, 0xff, 0x00, 0xa6, 0xff, 0x62, 0xe4, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x40, 0xff, 
-  0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0xe0, 0xff, 0x32, 0x25, 0xff, 0x00, 0x85, 0xff, 0xbe, 0x19, 0xff, 0xff, 0x9d, 0xff, 0x4c, 0x7a, 0xff, 0x7d, 0x7b, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x41, 0xe8, 0xff, 0x4a, 0x28, 0xff, 0xad, 0x55, 0xff, 0xa4, 0xf4, 0xff, 0xad, 0x55, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0x5c, 0xda, 0xff, 0x64, 0xfa, 0xff, 0xff, 0xbe, 0xff, 0xa5, 0x76, 0xff, 0x00, 0x85, 0xff, 0x52, 0xa4, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfc, 0xe0, 0xff, 0xfd, 0x00, 0xff, 
-  0xfd, 0x00, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0xc0, 0xff, 0x3a, 0x25, 0xff, 0x00, 0x85, 0xff, 0xbd, 0xf8, 0xff, 0xff, 0x9d, 0xff, 0x75, 0x1a, 0xff, 0x9d, 0xdc, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x73, 0x8e, 0xff, 0x7b, 0xaf, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xb7, 0xff, 0xc6, 0x18, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x5d, 0xff, 0x85, 0x7b, 0xff, 0x85, 0x7b, 0xff, 0xff, 0x9d, 0xff, 0x9d, 0x55, 0xff, 0x00, 0x85, 0xff, 0x52, 0xa4, 0xff, 0xfd, 0xc0, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0xa0, 0xff, 0x52, 0x84, 0xff, 0x00, 0x85, 0xff, 0x9d, 0x15, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x7e, 0xff, 0x84, 0x73, 0xff, 0x00, 0x85, 0xff, 0x6b, 0x04, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x80, 0xff, 0x8b, 0x63, 0xff, 0x00, 0x85, 0xff, 0x5b, 0x6f, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x1c, 0xff, 0xd6, 0xdc, 0xff, 0xdf, 0x1c, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xff, 0xbe, 0xff, 0x42, 0xcc, 0xff, 0x00, 0x86, 0xff, 0xa3, 0xc2, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xe0, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x40, 0xff, 0xec, 0xe1, 0xff, 0x00, 0x86, 0xff, 0x00, 0xe5, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x3c, 0xff, 0x7d, 0xf9, 0xff, 0xa6, 0x5a, 0xff, 0xef, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0x96, 0x3a, 0xff, 0x86, 0x1a, 0xff, 0xef, 0x3c, 0xff, 0xff, 0x9e, 0xff, 0x00, 0x84, 0xff, 0x00, 0x86, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0xa0, 0xff, 0x11, 0x45, 0xff, 0x00, 0x64, 0xff, 0x94, 0xf4, 0xff, 0xf7, 0x7d, 0xff, 0xde, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xfc, 0xff, 0xf7, 0x9e, 0xff, 0x7c, 0x31, 0xff, 0x00, 0x84, 0xff, 0x31, 0xe4, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x40, 0xff, 0xbc, 0x01, 0xff, 0x00, 0x66, 0xff, 0x00, 0xa4, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xd6, 0xfc, 0xff, 0x8e, 0x1a, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xfc, 0xff, 0x8e, 0x1a, 0xff, 0xde, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x00, 0x63, 0xff, 0x00, 0x66, 0xff, 0xd4, 0x81, 0xff, 0xfd, 0x40, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xe0, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xe0, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0xa0, 0xff, 0x31, 0xc4, 0xff, 0x00, 0x85, 0xff, 0x19, 0x88, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x3c, 0xff, 0xd6, 0xdb, 0xff, 0x85, 0xf9, 0xff, 0xde, 0xfc, 0xff, 0xf7, 0x5c, 0xff, 0x54, 0x39, 0xff, 0x74, 0xda, 0xff, 0xf7, 0x5c, 0xff, 0xd6, 0xfc, 0xff, 0x85, 0xf9, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x3c, 0xff, 0xff, 0xbe, 0xff, 0x09, 0x26, 0xff, 0x00, 0x85, 0xff, 0x52, 0x44, 0xff, 0xfd, 0x80, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x40, 0xff, 0x00, 0xc5, 0xff, 0x00, 0x64, 0xff, 0x11, 0x67, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0x74, 0xda, 0xff, 0x7d, 0x1a, 0xff, 0xef, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0xfc, 0xff, 0x01, 0x06, 0xff, 0x00, 0x84, 0xff, 0x09, 0x25, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0x00, 0xe5, 0xff, 0x00, 0x64, 0xff, 0x00, 0x63, 0xff, 0x84, 0x52, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0x73, 0xf0, 0xff, 0x00, 0x42, 0xff, 0x00, 0x65, 0xff, 0x09, 0x05, 0xff, 0xfd, 0x20, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x40, 0xff, 0x39, 0xc4, 0xff, 0x00, 0x45, 0xff, 0x00, 0x43, 0xff, 0x00, 0x43, 0xff, 0x42, 0x8b, 0xff, 0x74, 0x11, 0xff, 0x94, 0xd4, 0xff, 0x8c, 0xd3, 0xff, 0x73, 0xf0, 0xff, 0x32, 0x4a, 0xff, 0x00, 0x22, 0xff, 0x00, 0x43, 0xff, 0x00, 0x45, 0xff, 0x52, 0x23, 0xff, 0xfd, 0x60, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc0, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfd, 0x60, 0xff, 0xcc, 0x21, 0xff, 0x29, 0x84, 0xff, 0x00, 0x45, 0xff, 0x00, 0x44, 0xff, 0x00, 0x23, 0xff, 0x00, 0x23, 0xff, 0x00, 0x23, 0xff, 0x00, 0x23, 0xff, 0x00, 0x44, 0xff, 0x00, 0x45, 0xff, 0x39, 0xc3, 0xff, 0xdc, 0x40, 0xff, 0xfd, 0x40, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe0, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xe0, 0xff, 0xfd, 0x40, 0xff, 0xfc, 0xe0, 0xff, 0xab, 0x81, 0xff, 0x72, 0xa2, 0xff, 0x62, 0x43, 0xff, 0x62, 0x63, 0xff, 0x7a, 0xc2, 0xff, 0xab, 0x81, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x20, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe0, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xe0, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xfc, 0xe0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xa0, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xa0, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x80, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x80, 0xff, 0xfc, 0xa0, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x80, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x80, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x60, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0xfc, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x03, 0xe7, 0xff, 0xff, 0x03, 0xe8, 0xfe, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe7, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x02, 0xe6, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x02, 0xe5, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8, 0xfe, 0xff, 0x03, 0xe9, 0xff, 0xff, 0x03, 0xeb, 0xff, 0xff, 0x03, 0xeb, 0xff, 0xff, 0x03, 0xe8, 0xfe, 0xff, 0x03, 0xe8, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x03, 0xe8, 0xfe, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xff, 0x03, 0xe6, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x02, 0xe1, 0xff, 0xff, 0x03, 0xe8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xdf, 0xfe, 0xff, 0x02, 0xee, 0xff, 0xff, 0x01, 0xe6, 0xff, 0xff, 0x02, 0xe0, 0xfd, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xff, 0x03, 0xe4, 0xfe, 0xff, 0x03, 0xe5, 0xfe, 0xff, 0x03, 0xe5, 0xfe, 0xff, 0x03, 0xe5, 0xfe, 0xff, 0x03, 0xe5, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xff, 0x03, 0xe5, 0xfe, 0xff, 0x03, 0xe5, 0xfe, 0xff, 0x03, 0xe4, 0xfe, 0xff, 0x03, 0xe4, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x02, 0xe0, 0xfd, 0xff, 0x02, 0xe2, 0xff, 0xff, 0x02, 0xdb, 0xff, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xdf, 0xff, 0xff, 0x02, 0xe4, 0xff, 0xff, 0x02, 0xe0, 0xff, 0xff, 0x02, 0xdc, 0xfd, 0xff, 0x02, 0xdd, 0xfd, 0xff, 0x01, 0xdf, 0xfc, 0xff, 0x02, 0xe0, 0xfd, 0xff, 0x02, 0xe1, 0xfd, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xff, 0x03, 0xe4, 0xfe, 0xff, 0x03, 0xe4, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x02, 0xe1, 0xfd, 0xff, 0x02, 0xe0, 0xfd, 0xff, 0x01, 0xde, 0xfc, 0xff, 0x02, 0xdd, 0xfd, 0xff, 0x02, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xff, 0xff, 0x02, 0xd8, 0xff, 0xff, 0x02, 0xe1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xde, 0xff, 0xff, 0x02, 0xe3, 0xff, 0xff, 0x02, 0xd8, 0xfd, 0xff, 0x02, 0xd9, 0xfd, 0xff, 0x02, 0xda, 0xfd, 0xff, 0x02, 0xdc, 0xfd, 0xff, 0x02, 0xdd, 0xfd, 0xff, 0x01, 0xde, 0xfc, 0xff, 0x01, 0xdf, 0xfc, 0xff, 0x02, 0xe0, 0xfd, 0xff, 0x02, 0xe0, 0xfd, 0xff, 0x02, 0xe1, 0xfd, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x02, 0xe1, 0xfd, 0xff, 0x02, 0xe0, 0xfd, 0xff, 0x02, 0xdf, 0xfd, 0xff, 0x01, 0xdf, 0xfc, 0xff, 0x01, 0xde, 0xfc, 0xff, 0x02, 0xdd, 0xfd, 0xff, 0x02, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfd, 0xff, 0x02, 0xd9, 0xfd, 0xff, 0x02, 0xd8, 0xfd, 0xff, 0x02, 0xd8, 0xff, 0xff, 0x02, 0xd8, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd6, 0xfd, 0xff, 0x02, 0xd6, 0xff, 0xff, 0x02, 0xd5, 0xfd, 0xff, 0x02, 0xd6, 0xfd, 0xff, 0x02, 0xd7, 0xfd, 0xff, 0x02, 0xd9, 0xfd, 0xff, 0x02, 0xda, 0xfd, 0xff, 0x02, 0xdb, 0xfd, 0xff, 0x02, 0xdc, 0xfd, 0xff, 0x02, 0xdd, 0xfd, 0xff, 0x01, 0xdd, 0xfc, 0xff, 0x01, 0xde, 0xfc, 0xff, 0x01, 0xdf, 0xfc, 0xff, 0x01, 0xdf, 0xfc, 0xff, 0x02, 0xdf, 0xfd, 0xff, 0x02, 0xe0, 0xfd, 0xff, 0x02, 0xe0, 0xfd, 0xff, 0x02, 0xdf, 0xfd, 0xff, 0x01, 0xdf, 0xfc, 0xff, 0x01, 0xdf, 0xfc, 0xff, 0x01, 0xde, 0xfc, 0xff, 0x01, 0xde, 0xfc, 0xff, 0x02, 0xdd, 0xfd, 0xff, 0x02, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfd, 0xff, 0x02, 0xd8, 0xfd, 0xff, 0x02, 0xd7, 0xfd, 0xff, 0x02, 0xd6, 0xfd, 0xff, 0x02, 0xd4, 0xfd, 0xff, 0x02, 0xd9, 0xff, 0xff, 0x02, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcd, 0xfc, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd1, 0xfe, 0xff, 0x02, 0xd2, 0xfd, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd4, 0xfd, 0xff, 0x02, 0xd6, 0xfd, 0xff, 0x02, 0xd7, 0xfd, 0xff, 0x02, 0xd8, 0xfd, 0xff, 0x02, 0xd9, 0xfd, 0xff, 0x02, 0xda, 0xfd, 0xff, 0x02, 0xdb, 0xfd, 0xff, 0x02, 0xdc, 0xfd, 0xff, 0x02, 0xdc, 0xfd, 0xff, 0x02, 0xdd, 0xfd, 0xff, 0x01, 0xde, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x01, 0xde, 0xfe, 0xff, 0x02, 0xdc, 0xfd, 0xff, 0x02, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfd, 0xff, 0x02, 0xd9, 0xfd, 0xff, 0x02, 0xd8, 0xfd, 0xff, 0x02, 0xd7, 0xfd, 0xff, 0x02, 0xd5, 0xfd, 0xff, 0x02, 0xd4, 0xfd, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd5, 0xff, 0xff, 0x02, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xce, 0xff, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd4, 0xfd, 0xff, 0x02, 0xd5, 0xfd, 0xff, 0x02, 0xd6, 0xfd, 0xff, 0x02, 0xd7, 0xfd, 0xff, 0x02, 0xd8, 0xfd, 0xff, 0x02, 0xd9, 0xfd, 0xff, 0x02, 0xd9, 0xfd, 0xff, 0x02, 0xda, 0xfd, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x32, 0x89, 0x75, 0xff, 0x50, 0x56, 0x20, 0xff, 0x4f, 0x58, 0x23, 0xff, 0x2c, 0x92, 0x83, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x02, 0xda, 0xfd, 0xff, 0x02, 0xd9, 0xfd, 0xff, 0x02, 0xd9, 0xfd, 0xff, 0x02, 0xd8, 0xfd, 0xff, 0x02, 0xd7, 0xfd, 0xff, 0x02, 0xd6, 0xfd, 0xff, 0x02, 0xd5, 0xfd, 0xff, 0x02, 0xd4, 0xfd, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xd6, 0xfe, 0xff, 0x02, 0xda, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc8, 0xfc, 0xff, 0x02, 0xcb, 0xfe, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd2, 0xfd, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd4, 0xfd, 0xff, 0x02, 0xd5, 0xfd, 0xff, 0x02, 0xd6, 0xfd, 0xff, 0x02, 0xd7, 0xfd, 0xff, 0x02, 0xd7, 0xfd, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x5d, 0x3b, 0x00, 0xff, 0x69, 0x26, 0x00, 0xff, 0x52, 0x4d, 0x14, 0xff, 0x55, 0x48, 0x0b, 0xff, 0x69, 0x26, 0x00, 0xff, 0x57, 0x45, 0x07, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x01, 0xd9, 0xff, 0xff, 0x02, 0xd7, 0xfd, 0xff, 0x02, 0xd7, 0xfd, 0xff, 0x02, 0xd6, 0xfd, 0xff, 0x02, 0xd5, 0xfd, 0xff, 0x02, 0xd4, 0xfd, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd2, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xd4, 0xff, 0xff, 0x02, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc8, 0xfc, 0xff, 0x02, 0xca, 0xff, 0xff, 0x02, 0xc9, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd2, 0xfd, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd4, 0xfd, 0xff, 0x02, 0xd5, 0xfd, 0xff, 0x02, 0xd5, 0xfd, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x40, 0x68, 0x44, 0xff, 0x65, 0x28, 0x00, 0xff, 0x13, 0xb8, 0xca, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x1b, 0xa9, 0xb1, 0xff, 0x66, 0x25, 0x00, 0xff, 0x36, 0x7a, 0x62, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x02, 0xd5, 0xfd, 0xff, 0x02, 0xd5, 0xfd, 0xff, 0x02, 0xd4, 0xfd, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd2, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xd0, 0xfe, 0xff, 0x02, 0xc7, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc0, 0xfc, 0xff, 0x02, 0xc1, 0xfc, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd2, 0xfd, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x01, 0xd4, 0xfd, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x62, 0x27, 0x00, 0xff, 0x38, 0x74, 0x5a, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x01, 0xd7, 0xff, 0xff, 0x01, 0xd7, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x43, 0x5f, 0x37, 0xff, 0x59, 0x37, 0x00, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd3, 0xfd, 0xff, 0x02, 0xd2, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc4, 0xfc, 0xff, 0x02, 0xc4, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc1, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc9, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x01, 0xd2, 0xfd, 0xff, 0x00, 0xde, 0xff, 0xff, 0x63, 0x20, 0x00, 0xff, 0x2b, 0x87, 0x7f, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x02, 0xd2, 0xfb, 0xff, 0x02, 0xd2, 0xfb, 0xff, 0x00, 0xea, 0xff, 0xff, 0x34, 0x77, 0x63, 0xff, 0x5f, 0x27, 0x00, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd1, 0xfd, 0xff, 0x02, 0xd0, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xc9, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc3, 0xfd, 0xff, 0x02, 0xc6, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc0, 0xfc, 0xff, 0x02, 0xc1, 0xfc, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc6, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc9, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x50, 0x3e, 0x04, 0xff, 0x4b, 0x48, 0x16, 0xff, 0x3a, 0x69, 0x4e, 0xff, 0x5e, 0x26, 0x00, 0xff, 0x5f, 0x25, 0x00, 0xff, 0x34, 0x74, 0x60, 0xff, 0x52, 0x3c, 0x01, 0xff, 0x46, 0x51, 0x24, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x02, 0xce, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc6, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc3, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x01, 0xc6, 0xfe, 0xff, 0x02, 0xc7, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc3, 0xfe, 0xff, 0x00, 0xc5, 0xfb, 0xff, 0x00, 0xbf, 0xfb, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc3, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc6, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc9, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x16, 0xa7, 0xb9, 0xff, 0x5d, 0x22, 0x00, 0xff, 0x53, 0x34, 0x00, 0xff, 0x50, 0x3b, 0x01, 0xff, 0x50, 0x3b, 0x01, 0xff, 0x54, 0x33, 0x00, 0xff, 0x5d, 0x22, 0x00, 0xff, 0x0f, 0xb4, 0xd0, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x02, 0xcd, 0xfd, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcc, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc3, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x00, 0xbf, 0xfb, 0xff, 0x01, 0xc3, 0xfb, 0xff, 0x02, 0xc7, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xfe, 0xff, 0x01, 0xc1, 0xff, 0xff, 0x01, 0xbc, 0xfc, 0xff, 0x00, 0xbe, 0xfb, 0xff, 0x00, 0xbf, 0xfb, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x02, 0xc3, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc6, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc9, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x01, 0xcc, 0xfd, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x14, 0xa8, 0xbe, 0xff, 0x4f, 0x38, 0x00, 0xff, 0x4f, 0x39, 0x00, 0xff, 0x4f, 0x38, 0x00, 0xff, 0x4d, 0x3c, 0x05, 0xff, 0x0f, 0xb3, 0xd1, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x01, 0xcb, 0xfd, 0xff, 0x02, 0xcb, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xca, 0xfd, 0xff, 0x02, 0xc9, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc6, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc3, 0xfd, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x00, 0xbf, 0xfa, 0xff, 0x00, 0xbf, 0xfa, 0xff, 0x01, 0xbf, 0xfa, 0xff, 0x02, 0xc2, 0xfc, 0xff, 0x02, 0xc2, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc3, 0xff, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xbb, 0xfc, 0xff, 0x01, 0xbc, 0xfc, 0xff, 0x01, 0xbd, 0xfc, 0xff, 0x00, 0xbf, 0xfb, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc3, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc6, 0xfd, 0xff, 0x02, 0xc6, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x01, 0xc9, 0xfd, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x11, 0xac, 0xc9, 0xff, 0x24, 0x86, 0x88, 0xff, 0x48, 0x42, 0x11, 0xff, 0x4d, 0x37, 0x00, 0xff, 0x4e, 0x36, 0x00, 0xff, 0x44, 0x48, 0x1b, 0xff, 0x23, 0x87, 0x89, 0xff, 0x0f, 0xb0, 0xd0, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x01, 0xc9, 0xfd, 0xff, 0x02, 0xc8, 0xfd, 0xff, 0x02, 0xc7, 0xfd, 0xff, 0x02, 0xc6, 0xfd, 0xff, 0x02, 0xc6, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc3, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x00, 0xbe, 0xfb, 0xff, 0x01, 0xbd, 0xfc, 0xff, 0x01, 0xbd, 0xfb, 0xff, 0x01, 0xbe, 0xfa, 0xff, 0x02, 0xc2, 0xfc, 0xff, 0x02, 0xc2, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xc1, 0xff, 0xff, 0x01, 0xc2, 0xff, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb9, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xbc, 0xfc, 0xff, 0x01, 0xbd, 0xfc, 0xff, 0x00, 0xbe, 0xfb, 0xff, 0x00, 0xbf, 0xfb, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc3, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x1f, 0x8c, 0x96, 0xff, 0x4c, 0x32, 0x00, 0xff, 0x4f, 0x24, 0x00, 0xff, 0x45, 0x23, 0x00, 0xff, 0x3e, 0x26, 0x00, 0xff, 0x3b, 0x25, 0x00, 0xff, 0x3b, 0x25, 0x00, 0xff, 0x3e, 0x26, 0x00, 0xff, 0x46, 0x24, 0x00, 0xff, 0x50, 0x24, 0x00, 0xff, 0x4a, 0x36, 0x00, 0xff, 0x1b, 0x93, 0xa3, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x02, 0xc5, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc4, 0xfd, 0xff, 0x02, 0xc3, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x00, 0xbf, 0xfb, 0xff, 0x00, 0xbe, 0xfb, 0xff, 0x01, 0xbd, 0xfc, 0xff, 0x01, 0xbc, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xb9, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x02, 0xc2, 0xfc, 0xff, 0x02, 0xc3, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xc1, 0xff, 0xff, 0x01, 0xba, 0xff, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x01, 0xb7, 0xfc, 0xff, 0x01, 0xb9, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xbb, 0xfc, 0xff, 0x01, 0xbc, 0xfc, 0xff, 0x01, 0xbd, 0xfc, 0xff, 0x00, 0xbe, 0xfb, 0xff, 0x00, 0xbf, 0xfb, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x00, 0xca, 0xff, 0xff, 0x03, 0xc0, 0xf6, 0xff, 0x45, 0x3a, 0x0a, 0xff, 0x4c, 0x24, 0x00, 0xff, 0x37, 0x1f, 0x00, 0xff, 0x52, 0x40, 0x0e, 0xff, 0x98, 0x8e, 0x73, 0xff, 0xc0, 0xba, 0xac, 0xff, 0xd6, 0xd3, 0xcc, 0xff, 0xd4, 0xd1, 0xc9, 0xff, 0xbd, 0xb8, 0xa8, 0xff, 0x93, 0x89, 0x6c, 0xff, 0x4c, 0x39, 0x06, 0xff, 0x39, 0x20, 0x00, 0xff, 0x4d, 0x23, 0x00, 0xff, 0x40, 0x43, 0x1a, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc2, 0xfd, 0xff, 0x02, 0xc1, 0xfd, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x00, 0xbf, 0xfb, 0xff, 0x00, 0xbe, 0xfb, 0xff, 0x01, 0xbd, 0xfc, 0xff, 0x01, 0xbc, 0xfc, 0xff, 0x01, 0xbb, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xb9, 0xfc, 0xff, 0x01, 0xb7, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xba, 0xfb, 0xff, 0x01, 0xbe, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xc4, 0xff, 0xff, 0x01, 0xb4, 0xfc, 0xff, 0x01, 0xb5, 0xfc, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x01, 0xb7, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb9, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xbb, 0xfc, 0xff, 0x01, 0xbc, 0xfc, 0xff, 0x00, 0xbd, 0xfb, 0xff, 0x00, 0xbe, 0xfb, 0xff, 0x00, 0xbf, 0xfb, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x09, 0xb2, 0xe2, 0xff, 0x4d, 0x23, 0x00, 0xff, 0x3e, 0x24, 0x00, 0xff, 0x4a, 0x38, 0x06, 0xff, 0xc8, 0xc4, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf0, 0xf1, 0xf3, 0xff, 0xf0, 0xf6, 0xff, 0xff, 0xf0, 0xf5, 0xfd, 0xff, 0xf1, 0xf2, 0xf4, 0xff, 0xf5, 0xf7, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xbc, 0xaf, 0xff, 0x42, 0x2f, 0x00, 0xff, 0x40, 0x24, 0x00, 0xff, 0x4a, 0x28, 0x00, 0xff, 0x05, 0xba, 0xf0, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x01, 0xc0, 0xfc, 0xff, 0x00, 0xbf, 0xfb, 0xff, 0x00, 0xbe, 0xfb, 0xff, 0x00, 0xbd, 0xfb, 0xff, 0x01, 0xbc, 0xfc, 0xff, 0x01, 0xbb, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xb9, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb7, 0xfc, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x01, 0xb5, 0xfc, 0xff, 0x01, 0xb7, 0xfe, 0xff, 0x02, 0xbd, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xc2, 0xff, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb3, 0xfc, 0xff, 0x01, 0xb4, 0xfc, 0xff, 0x01, 0xb5, 0xfc, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb9, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xbb, 0xfc, 0xff, 0x01, 0xbc, 0xfc, 0xff, 0x01, 0xbd, 0xfc, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x02, 0xbc, 0xf7, 0xff, 0x4b, 0x21, 0x00, 0xff, 0x36, 0x20, 0x00, 0xff, 0x72, 0x65, 0x41, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf2, 0xf3, 0xff, 0xf3, 0xf8, 0xff, 0xff, 0xd9, 0xa7, 0x54, 0xff, 0xdb, 0xb4, 0x74, 0xff, 0xea, 0xee, 0xf5, 0xff, 0xea, 0xea, 0xeb, 0xff, 0xeb, 0xec, 0xf1, 0xff, 0xf2, 0xf3, 0xf6, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0x63, 0x54, 0x2c, 0xff, 0x3a, 0x22, 0x00, 0xff, 0x48, 0x26, 0x00, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x01, 0xbd, 0xfc, 0xff, 0x01, 0xbc, 0xfc, 0xff, 0x01, 0xbb, 0xfc, 0xff, 0x01, 0xbb, 0xfc, 0xff, 0x01, 0xb9, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x01, 0xb5, 0xfc, 0xff, 0x01, 0xb4, 0xfc, 0xff, 0x01, 0xb3, 0xfc, 0xff, 0x01, 0xb5, 0xfd, 0xff, 0x01, 0xb7, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0xb5, 0xfe, 0xff, 0x01, 0xae, 0xfb, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb4, 0xfc, 0xff, 0x01, 0xb5, 0xfc, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x01, 0xb7, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb9, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x00, 0xbb, 0xfc, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x3d, 0x38, 0x0e, 0xff, 0x39, 0x20, 0x00, 0xff, 0x6f, 0x62, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf3, 0xff, 0xee, 0xec, 0xe4, 0xff, 0xd6, 0xc9, 0x96, 0xff, 0xf0, 0xee, 0xea, 0xff, 0xf4, 0xf7, 0xfd, 0xff, 0xe8, 0xca, 0x9b, 0xff, 0xe8, 0xcc, 0x9f, 0xff, 0xee, 0xf1, 0xf7, 0xff, 0xe5, 0xe4, 0xdc, 0xff, 0xd8, 0xcb, 0x98, 0xff, 0xe7, 0xe6, 0xe2, 0xff, 0xeb, 0xeb, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0x4f, 0x26, 0xff, 0x3d, 0x21, 0x00, 0xff, 0x37, 0x46, 0x27, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xbb, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xba, 0xfc, 0xff, 0x01, 0xb9, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb7, 0xfc, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x01, 0xb5, 0xfc, 0xff, 0x01, 0xb3, 0xfc, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb5, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0xae, 0xfb, 0xff, 0x01, 0xaf, 0xfe, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb3, 0xfc, 0xff, 0x01, 0xb4, 0xfc, 0xff, 0x01, 0xb5, 0xfc, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x01, 0xb7, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x19, 0x83, 0x99, 0xff, 0x42, 0x1d, 0x00, 0xff, 0x42, 0x31, 0x02, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xf1, 0xf2, 0xf4, 0xff, 0xf3, 0xf3, 0xf5, 0xff, 0xf0, 0xef, 0xeb, 0xff, 0xe0, 0xd8, 0xba, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xc5, 0xc8, 0xce, 0xff, 0xcf, 0xd2, 0xd7, 0xff, 0xf7, 0xf7, 0xf8, 0xff, 0xea, 0xea, 0xe9, 0xff, 0xdd, 0xd5, 0xb7, 0xff, 0xe8, 0xe7, 0xe6, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xea, 0xea, 0xec, 0xff, 0xf7, 0xf9, 0xfd, 0xff, 0x37, 0x25, 0x00, 0xff, 0x44, 0x1c, 0x00, 0xff, 0x12, 0x92, 0xb5, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb8, 0xfc, 0xff, 0x01, 0xb7, 0xfc, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x01, 0xb5, 0xfc, 0xff, 0x01, 0xb4, 0xfc, 0xff, 0x01, 0xb3, 0xfc, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb0, 0xfb, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb5, 0xfe, 0xff, 
-  0x01, 0xaa, 0xfc, 0xff, 0x01, 0xaf, 0xff, 0xff, 0x01, 0xaa, 0xfc, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xaf, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb3, 0xfc, 0xff, 0x01, 0xb4, 0xfc, 0xff, 0x01, 0xb5, 0xfc, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x00, 0xb7, 0xfc, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x3d, 0x2c, 0x00, 0xff, 0x2d, 0x18, 0x00, 0xff, 0xbf, 0xbb, 0xb0, 0xff, 0xf1, 0xf3, 0xf6, 0xff, 0xeb, 0xe8, 0xdc, 0xff, 0xee, 0xed, 0xe8, 0xff, 0xf1, 0xf2, 0xf3, 0xff, 0xf2, 0xf3, 0xf6, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xae, 0xae, 0xaf, 0xff, 0xb9, 0xb9, 0xba, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf1, 0xf1, 0xf2, 0xff, 0xe7, 0xe8, 0xeb, 0xff, 0xe8, 0xe8, 0xe9, 0xff, 0xe5, 0xe3, 0xdd, 0xff, 0xe4, 0xe1, 0xd6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xac, 0xa6, 0x97, 0xff, 0x31, 0x1a, 0x00, 0xff, 0x37, 0x3a, 0x17, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xb6, 0xfc, 0xff, 0x01, 0xb6, 0xfc, 0xff, 0x01, 0xb5, 0xfc, 0xff, 0x01, 0xb4, 0xfc, 0xff, 0x01, 0xb3, 0xfc, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb2, 0xfb, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb0, 0xfb, 0xff, 0x01, 0xb0, 0xfb, 0xff, 0x00, 0xb5, 0xfd, 0xff, 
-  0x01, 0xaa, 0xfc, 0xff, 0x01, 0xab, 0xfb, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xac, 0xfc, 0xff, 0x01, 0xad, 0xfc, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xaf, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb3, 0xfc, 0xff, 0x01, 0xb4, 0xfc, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x0a, 0x9e, 0xd1, 0xff, 0x3f, 0x18, 0x00, 0xff, 0x40, 0x30, 0x05, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf0, 0xf1, 0xf6, 0xff, 0xd3, 0xc5, 0x90, 0xff, 0xdd, 0xd5, 0xb2, 0xff, 0xf3, 0xf3, 0xf7, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xae, 0xae, 0xaf, 0xff, 0xba, 0xba, 0xba, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe8, 0xe9, 0xec, 0xff, 0xd9, 0xcf, 0xa7, 0xff, 0xd7, 0xcc, 0x9e, 0xff, 0xe8, 0xe9, 0xed, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0x32, 0x20, 0x00, 0xff, 0x41, 0x17, 0x00, 0xff, 0x03, 0xae, 0xef, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x01, 0xb4, 0xfc, 0xff, 0x01, 0xb3, 0xfc, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xaf, 0xfc, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xaf, 0xfc, 0xff, 
-  0x01, 0xaa, 0xfc, 0xff, 0x01, 0xab, 0xfb, 0xff, 0x01, 0xab, 0xfb, 0xff, 0x01, 0xab, 0xfb, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xac, 0xfc, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xaf, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x1d, 0x6e, 0x7d, 0xff, 0x34, 0x17, 0x00, 0xff, 0x87, 0x7e, 0x67, 0xff, 0xf0, 0xf1, 0xf4, 0xff, 0xee, 0xee, 0xef, 0xff, 0xef, 0xee, 0xec, 0xff, 0xf0, 0xef, 0xf0, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xac, 0xac, 0xad, 0xff, 0xb8, 0xb8, 0xb9, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe5, 0xe5, 0xe6, 0xff, 0xe5, 0xe5, 0xe4, 0xff, 0xe5, 0xe5, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0x75, 0x6b, 0x4f, 0xff, 0x36, 0x17, 0x00, 0xff, 0x17, 0x7d, 0x98, 0xff, 0x00, 0xba, 0xff, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xaf, 0xfc, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xad, 0xfc, 0xff, 0x01, 0xac, 0xfc, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xb0, 0xfb, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 
-  0x00, 0xaa, 0xfb, 0xff, 0x00, 0xa9, 0xfb, 0xff, 0x01, 0xaa, 0xfc, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xae, 0xfb, 0xff, 0x01, 0xae, 0xfb, 0xff, 0x01, 0xad, 0xfc, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xaf, 0xfc, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x27, 0x51, 0x4b, 0xff, 0x2c, 0x14, 0x00, 0xff, 0xae, 0xaa, 0x9d, 0xff, 0xeb, 0xec, 0xee, 0xff, 0xf0, 0xf6, 0xfd, 0xff, 0xf3, 0xf7, 0xfd, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xb4, 0xb4, 0xb5, 0xff, 0xc1, 0xc1, 0xc2, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xee, 0xee, 0xee, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe7, 0xec, 0xf3, 0xff, 0xe6, 0xec, 0xf2, 0xff, 0xee, 0xef, 0xf1, 0xff, 0x9d, 0x97, 0x86, 0xff, 0x2f, 0x14, 0x00, 0xff, 0x22, 0x5e, 0x64, 0xff, 0x00, 0xba, 0xff, 0xff, 0x01, 0xb0, 0xfc, 0xff, 0x01, 0xaf, 0xfc, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xad, 0xfc, 0xff, 0x01, 0xad, 0xfc, 0xff, 0x01, 0xac, 0xfc, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xaa, 0xfc, 0xff, 0x01, 0xa9, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0xa5, 0xfb, 0xff, 0x00, 0xaa, 0xfd, 0xff, 
-  0x00, 0xa8, 0xfb, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0xa9, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0xac, 0xfb, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xab, 0xfb, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xac, 0xfc, 0xff, 0x01, 0xac, 0xfc, 0xff, 0x01, 0xad, 0xfc, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x2b, 0x43, 0x32, 0xff, 0x28, 0x11, 0x00, 0xff, 0xc5, 0xc2, 0xbb, 0xff, 0xeb, 0xf2, 0xfa, 0xff, 0xce, 0x8e, 0x48, 0xff, 0xd9, 0xad, 0x7c, 0xff, 0xf1, 0xf5, 0xfa, 0xff, 0xef, 0xef, 0xef, 0xff, 0xef, 0xef, 0xef, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x3e, 0x42, 0xff, 0x44, 0x44, 0x47, 0xff, 0xa9, 0xa9, 0xaa, 0xff, 0x9f, 0x9e, 0xa0, 0xff, 0xa7, 0xa7, 0xa8, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe6, 0xec, 0xf2, 0xff, 0xd1, 0x98, 0x5a, 0xff, 0xd1, 0x9b, 0x5f, 0xff, 0xed, 0xf3, 0xfb, 0xff, 0xb0, 0xab, 0x9e, 0xff, 0x2a, 0x12, 0x00, 0xff, 0x24, 0x53, 0x50, 0xff, 0x00, 0xba, 0xff, 0xff, 0x01, 0xae, 0xfc, 0xff, 0x01, 0xad, 0xfc, 0xff, 0x01, 0xad, 0xfc, 0xff, 0x01, 0xac, 0xfc, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xaa, 0xfc, 0xff, 0x01, 0xa9, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0x9d, 0xfb, 0xff, 0x00, 0xa1, 0xfb, 0xff, 
-  0x00, 0xa1, 0xfb, 0xff, 0x01, 0xa9, 0xfc, 0xff, 0x01, 0xaa, 0xfb, 0xff, 0x01, 0xa2, 0xfb, 0xff, 0x01, 0xa7, 0xfc, 0xff, 0x01, 0xab, 0xfb, 0xff, 0x01, 0xa9, 0xfb, 0xff, 0x01, 0xac, 0xfc, 0xff, 0x01, 0xaa, 0xfc, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xac, 0xfc, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x28, 0x44, 0x38, 0xff, 0x26, 0x10, 0x00, 0xff, 0xc0, 0xbd, 0xb5, 0xff, 0xea, 0xf0, 0xf6, 0xff, 0xd1, 0xa2, 0x6f, 0xff, 0xde, 0xba, 0x95, 0xff, 0xf0, 0xf4, 0xf8, 0xff, 0xef, 0xef, 0xef, 0xff, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0x71, 0x70, 0x72, 0xff, 0x75, 0x75, 0x77, 0xff, 0xc2, 0xc2, 0xc3, 0xff, 0xb6, 0xb6, 0xb7, 0xff, 0xbf, 0xbf, 0xc0, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe5, 0xe9, 0xee, 0xff, 0xd5, 0xab, 0x7f, 0xff, 0xd5, 0xad, 0x82, 0xff, 0xec, 0xf1, 0xf7, 0xff, 0xac, 0xa7, 0x9b, 0xff, 0x29, 0x10, 0x00, 0xff, 0x23, 0x53, 0x53, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x01, 0xac, 0xfc, 0xff, 0x01, 0xab, 0xfc, 0xff, 0x01, 0xaa, 0xfc, 0xff, 0x01, 0xaa, 0xfc, 0xff, 0x01, 0xa9, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0xa7, 0xfc, 0xff, 0x01, 0xa6, 0xfc, 0xff, 0x01, 0xa5, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x01, 0x98, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xfc, 0xff, 0x01, 0xa3, 0xfb, 0xff, 0x01, 0xa2, 0xfc, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa7, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0xa9, 0xfc, 0xff, 0x01, 0xa9, 0xfc, 0xff, 0x01, 0xaa, 0xfc, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x22, 0x50, 0x51, 0xff, 0x27, 0x10, 0x00, 0xff, 0xa6, 0xa1, 0x95, 0xff, 0xeb, 0xeb, 0xed, 0xff, 0xe4, 0xe9, 0xee, 0xff, 0xe8, 0xec, 0xf2, 0xff, 0xf0, 0xf0, 0xf1, 0xff, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe3, 0xe3, 0xe4, 0xff, 0xe4, 0xe9, 0xef, 0xff, 0xe4, 0xe8, 0xed, 0xff, 0xed, 0xed, 0xf0, 0xff, 0x95, 0x8e, 0x7e, 0xff, 0x2a, 0x10, 0x00, 0xff, 0x1d, 0x5f, 0x6c, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x01, 0xaa, 0xfc, 0xff, 0x01, 0xa9, 0xfc, 0xff, 0x01, 0xa9, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0xa7, 0xfc, 0xff, 0x01, 0xa6, 0xfc, 0xff, 0x01, 0xa5, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0x99, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xfb, 0xff, 0x00, 0xa2, 0xfb, 0xff, 0x01, 0xa2, 0xfa, 0xff, 0x01, 0xa1, 0xfb, 0xff, 0x01, 0xa2, 0xfb, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa2, 0xfb, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x16, 0x6c, 0x88, 0xff, 0x2b, 0x10, 0x00, 0xff, 0x76, 0x6d, 0x58, 0xff, 0xef, 0xf0, 0xf3, 0xff, 0xe2, 0xe2, 0xe4, 0xff, 0xdd, 0xda, 0xcf, 0xff, 0xe2, 0xe0, 0xda, 0xff, 0xed, 0xee, 0xef, 0xff, 0xef, 0xef, 0xef, 0xff, 0xee, 0xee, 0xee, 0xff, 0xef, 0xef, 0xef, 0xff, 0xef, 0xef, 0xef, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe3, 0xe4, 0xff, 0xdf, 0xdd, 0xd6, 0xff, 0xde, 0xdc, 0xd2, 0xff, 0xe2, 0xe2, 0xe4, 0xff, 0xf2, 0xf3, 0xf6, 0xff, 0x62, 0x58, 0x3e, 0xff, 0x2e, 0x11, 0x00, 0xff, 0x11, 0x7a, 0xa2, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x01, 0xa8, 0xfc, 0xff, 0x01, 0xa7, 0xfc, 0xff, 0x01, 0xa7, 0xfc, 0xff, 0x01, 0xa6, 0xfc, 0xff, 0x01, 0xa5, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa2, 0xfc, 0xff, 0x00, 0xa1, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xfa, 0xff, 0x00, 0xa2, 0xfb, 0xff, 0x00, 0x9d, 0xfa, 0xff, 0x00, 0xa0, 0xfb, 0xff, 0x00, 0xa2, 0xfa, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x01, 0xa2, 0xfc, 0xff, 0x01, 0xa2, 0xfb, 0xff, 0x01, 0xa6, 0xfc, 0xff, 0x01, 0xa6, 0xfc, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x05, 0x9b, 0xe5, 0xff, 0x33, 0x0f, 0x00, 0xff, 0x29, 0x1b, 0x00, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xe3, 0xe5, 0xeb, 0xff, 0xcb, 0xbb, 0x7c, 0xff, 0xd4, 0xca, 0xa1, 0xff, 0xe1, 0xe2, 0xe6, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe3, 0xe4, 0xe9, 0xff, 0xd0, 0xc4, 0x92, 0xff, 0xce, 0xbf, 0x84, 0xff, 0xe4, 0xe6, 0xeb, 0xff, 0xf1, 0xf2, 0xf5, 0xff, 0x1f, 0x10, 0x00, 0xff, 0x34, 0x0f, 0x00, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x01, 0xa6, 0xfc, 0xff, 0x01, 0xa6, 0xfc, 0xff, 0x01, 0xa5, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa2, 0xfc, 0xff, 0x00, 0xa1, 0xfb, 0xff, 0x00, 0xa0, 0xfb, 0xff, 0x00, 0xa1, 0xfa, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x98, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xfa, 0xff, 0x00, 0xa1, 0xfa, 0xff, 0x00, 0xa2, 0xfa, 0xff, 0x00, 0xa0, 0xfa, 0xff, 0x00, 0xa2, 0xfa, 0xff, 0x01, 0xa2, 0xfc, 0xff, 0x00, 0xa2, 0xfc, 0xff, 0x01, 0xa2, 0xfb, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x00, 0xa5, 0xfc, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x2a, 0x2a, 0x12, 0xff, 0x1f, 0x0d, 0x00, 0xff, 0xa2, 0x9e, 0x92, 0xff, 0xec, 0xed, 0xf0, 0xff, 0xdf, 0xdd, 0xd8, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe1, 0xe1, 0xe3, 0xff, 0xe2, 0xe3, 0xe8, 0xff, 0xe0, 0xe0, 0xe1, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe1, 0xe1, 0xe2, 0xff, 0xe2, 0xe4, 0xe9, 0xff, 0xe1, 0xe1, 0xe3, 0xff, 0xe0, 0xe0, 0xde, 0xff, 0xdf, 0xde, 0xda, 0xff, 0xef, 0xf0, 0xf3, 0xff, 0x8b, 0x85, 0x75, 0xff, 0x23, 0x0f, 0x00, 0xff, 0x24, 0x3b, 0x32, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x01, 0xa5, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa2, 0xfc, 0xff, 0x00, 0xa1, 0xfb, 0xff, 0x00, 0xa0, 0xfb, 0xff, 0x00, 0xa0, 0xfa, 0xff, 0x00, 0x9f, 0xfa, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x98, 0xfa, 0xff, 0x00, 0x99, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xfa, 0xff, 0x00, 0x9f, 0xfb, 0xff, 0x00, 0xa1, 0xfa, 0xff, 0x01, 0xa3, 0xfd, 0xff, 0x00, 0xa0, 0xfa, 0xff, 0x00, 0x9f, 0xf8, 0xff, 0x00, 0xa0, 0xfa, 0xff, 0x00, 0xa1, 0xfb, 0xff, 0x00, 0xa2, 0xfb, 0xff, 0x01, 0xa2, 0xfc, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x0b, 0x82, 0xbb, 0xff, 0x2f, 0x0d, 0x00, 0xff, 0x21, 0x13, 0x00, 0xff, 0xeb, 0xec, 0xed, 0xff, 0xe3, 0xe3, 0xe5, 0xff, 0xe0, 0xe1, 0xe2, 0xff, 0xdd, 0xdb, 0xd3, 0xff, 0xcd, 0xbf, 0x88, 0xff, 0xdf, 0xdf, 0xdd, 0xff, 0xe0, 0xe0, 0xe1, 0xff, 0xe2, 0xe9, 0xee, 0xff, 0xe2, 0xe7, 0xec, 0xff, 0xe0, 0xe1, 0xe2, 0xff, 0xde, 0xdc, 0xd5, 0xff, 0xcd, 0xbf, 0x87, 0xff, 0xde, 0xdd, 0xd8, 0xff, 0xe0, 0xe0, 0xe2, 0xff, 0xe5, 0xe5, 0xe7, 0xff, 0xdf, 0xe0, 0xdf, 0xff, 0x1a, 0x0b, 0x00, 0xff, 0x31, 0x0c, 0x00, 0xff, 0x07, 0x8f, 0xd3, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x01, 0xa3, 0xfc, 0xff, 0x01, 0xa2, 0xfc, 0xff, 0x00, 0xa2, 0xfb, 0xff, 0x00, 0xa1, 0xfb, 0xff, 0x00, 0xa0, 0xfa, 0xff, 0x00, 0x9f, 0xfa, 0xff, 0x00, 0x9f, 0xfa, 0xff, 0x00, 0x9e, 0xfb, 0xff, 0x00, 0x9d, 0xfb, 0xff, 0x01, 0x99, 0xfa, 0xff, 0x00, 0x98, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xfa, 0xff, 0x00, 0x9c, 0xfa, 0xff, 0x01, 0x9d, 0xfa, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9d, 0xf9, 0xff, 0x00, 0x9f, 0xf9, 0xff, 0x00, 0x9e, 0xfa, 0xff, 0x00, 0x9f, 0xfa, 0xff, 0x00, 0xa0, 0xfa, 0xff, 0x00, 0xa0, 0xfb, 0xff, 0x00, 0xa1, 0xfb, 0xff, 0x00, 0xa1, 0xfb, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x22, 0x38, 0x31, 0xff, 0x26, 0x10, 0x00, 0xff, 0x3d, 0x32, 0x16, 0xff, 0xf6, 0xf8, 0xfc, 0xff, 0xe3, 0xe4, 0xe5, 0xff, 0xdc, 0xda, 0xd2, 0xff, 0xcb, 0xbd, 0x83, 0xff, 0xdf, 0xde, 0xdb, 0xff, 0xe2, 0xe8, 0xee, 0xff, 0xc8, 0x85, 0x4e, 0xff, 0xcd, 0x98, 0x6d, 0xff, 0xe2, 0xe7, 0xed, 0xff, 0xdd, 0xdb, 0xd4, 0xff, 0xcb, 0xbd, 0x83, 0xff, 0xdd, 0xdc, 0xd6, 0xff, 0xe4, 0xe5, 0xe7, 0xff, 0xf2, 0xf4, 0xf7, 0xff, 0x30, 0x24, 0x06, 0xff, 0x29, 0x10, 0x00, 0xff, 0x1d, 0x47, 0x4e, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xa1, 0xfb, 0xff, 0x00, 0xa1, 0xfb, 0xff, 0x00, 0xa0, 0xfb, 0xff, 0x00, 0xa0, 0xfa, 0xff, 0x00, 0x9f, 0xfa, 0xff, 0x00, 0x9e, 0xfa, 0xff, 0x00, 0x9d, 0xfb, 0xff, 0x00, 0x9d, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x98, 0xfa, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xfc, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x9d, 0xfb, 0xff, 0x00, 0x9e, 0xfb, 0xff, 0x00, 0x9e, 0xfa, 0xff, 0x00, 0x9f, 0xfa, 0xff, 0x00, 0x9f, 0xfa, 0xff, 0x00, 0xa1, 0xfd, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x2a, 0x1a, 0x00, 0xff, 0x21, 0x0e, 0x00, 0xff, 0x39, 0x2e, 0x13, 0xff, 0xe6, 0xe7, 0xe8, 0xff, 0xec, 0xed, 0xf0, 0xff, 0xe2, 0xe3, 0xe9, 0xff, 0xdf, 0xdf, 0xe0, 0xff, 0xe0, 0xe5, 0xea, 0xff, 0xce, 0x9a, 0x72, 0xff, 0xcf, 0x9f, 0x79, 0xff, 0xe0, 0xe5, 0xe9, 0xff, 0xdf, 0xdf, 0xe0, 0xff, 0xe2, 0xe4, 0xe9, 0xff, 0xee, 0xef, 0xf2, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0x2d, 0x21, 0x04, 0xff, 0x23, 0x0f, 0x00, 0xff, 0x27, 0x23, 0x0b, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xa1, 0xfc, 0xff, 0x00, 0x9f, 0xfa, 0xff, 0x00, 0x9f, 0xfa, 0xff, 0x00, 0x9e, 0xfa, 0xff, 0x00, 0x9e, 0xfb, 0xff, 0x00, 0x9d, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x98, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xfa, 0xff, 0x00, 0x98, 0xfe, 0xff, 0x00, 0x9b, 0xfa, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x9d, 0xfb, 0xff, 0x00, 0x9d, 0xfb, 0xff, 0x00, 0x9e, 0xfb, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa0, 0xfd, 0xff, 0x28, 0x1b, 0x00, 0xff, 0x24, 0x0e, 0x00, 0xff, 0x18, 0x0b, 0x00, 0xff, 0x8f, 0x8a, 0x7d, 0xff, 0xef, 0xf0, 0xf3, 0xff, 0xef, 0xf0, 0xf2, 0xff, 0xe9, 0xe9, 0xeb, 0xff, 0xe8, 0xee, 0xf4, 0xff, 0xe8, 0xee, 0xf3, 0xff, 0xe9, 0xea, 0xec, 0xff, 0xf0, 0xf1, 0xf3, 0xff, 0xeb, 0xec, 0xee, 0xff, 0x81, 0x7c, 0x6d, 0xff, 0x14, 0x07, 0x00, 0xff, 0x26, 0x0e, 0x00, 0xff, 0x25, 0x22, 0x0c, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0x9e, 0xfb, 0xff, 0x00, 0x9d, 0xfb, 0xff, 0x00, 0x9d, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x98, 0xfa, 0xff, 0x01, 0x98, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x1d, 0x3a, 0x3c, 0xff, 0x29, 0x08, 0x00, 0xff, 0x1a, 0x09, 0x00, 0xff, 0x15, 0x08, 0x00, 0xff, 0x59, 0x51, 0x3d, 0xff, 0x87, 0x81, 0x74, 0xff, 0x9d, 0x99, 0x8f, 0xff, 0x9b, 0x97, 0x8c, 0xff, 0x84, 0x7e, 0x71, 0xff, 0x52, 0x49, 0x34, 0xff, 0x13, 0x06, 0x00, 0xff, 0x1c, 0x09, 0x00, 0xff, 0x2a, 0x08, 0x00, 0xff, 0x19, 0x46, 0x53, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x98, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xfa, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9c, 0xfd, 0xff, 0x00, 0xab, 0xff, 0xff, 0x07, 0x83, 0xca, 0xff, 0x1e, 0x31, 0x2c, 0xff, 0x28, 0x08, 0x00, 0xff, 0x21, 0x08, 0x00, 0xff, 0x1b, 0x06, 0x00, 0xff, 0x19, 0x05, 0x00, 0xff, 0x19, 0x05, 0x00, 0xff, 0x1c, 0x06, 0x00, 0xff, 0x21, 0x08, 0x00, 0xff, 0x29, 0x08, 0x00, 0xff, 0x1c, 0x38, 0x3a, 0xff, 0x04, 0x8a, 0xd8, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0x9c, 0xfc, 0xff, 0x00, 0x9b, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x9a, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x98, 0xfa, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xfb, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0x9c, 0xfe, 0xff, 0x0b, 0x70, 0xa8, 0xff, 0x13, 0x54, 0x73, 0xff, 0x16, 0x49, 0x5e, 0xff, 0x15, 0x4b, 0x61, 0xff, 0x12, 0x57, 0x77, 0xff, 0x0b, 0x72, 0xac, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x99, 0xfb, 0xff, 0x01, 0x95, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xfb, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x99, 0xfe, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x99, 0xfd, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x98, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x97, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x92, 0xfb, 0xff, 0x00, 0x94, 0xfe, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff, 0x00, 0x92, 0xfe, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x96, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x95, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x92, 0xfb, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x92, 0xfc, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xff, 0xff, 0x00, 0x90, 0xfc, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x94, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x93, 0xfb, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x91, 0xfd, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x90, 0xfc, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x91, 0xf9, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x91, 0xfa, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0x8b, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfc, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x8e, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x8e, 0xf9, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x89, 0xf9, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xfe, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x8e, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x8f, 0xfb, 0xff, 0x00, 0x8b, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xfe, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x8a, 0xfa, 0xff, 0x00, 0x8d, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xfe, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8a, 0xfb, 0xff, 0x00, 0x89, 0xfa, 0xff, 0x00, 0x89, 0xfa, 0xff, 0x00, 0x89, 0xfa, 0xff, 0x00, 0x8a, 0xfa, 0xff, 0x00, 0x8a, 0xfa, 0xff, 0x00, 0x8a, 0xfa, 0xff, 0x00, 0x8a, 0xfa, 0xff, 0x00, 0x89, 0xfa, 0xff, 0x00, 0x89, 0xfa, 0xff, 0x00, 0x89, 0xf9, 0xff, 0x00, 0x8a, 0xfc, 0xff, 0x00, 0x8d, 0xfe, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x92, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfc, 0xff, 0x00, 0x8b, 0xf9, 0xff, 0x00, 0x8a, 0xf9, 0xff, 0x00, 0x89, 0xfa, 0xff, 0x00, 0x8a, 0xf9, 0xff, 0x00, 0x8a, 0xfa, 0xff, 0x00, 0x8b, 0xf9, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8a, 0xf9, 0xff, 0x00, 0x8a, 0xf9, 0xff, 0x00, 0x8a, 0xfa, 0xff, 0x00, 0x89, 0xf9, 0xff, 0x00, 0x89, 0xf9, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x00, 0x89, 0xf9, 0xff, 0x00, 0x8a, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xf9, 0xff, 0x00, 0x8c, 0xf6, 0xff, 0x00, 0x8b, 0xfa, 0xff, 0x00, 0x8a, 0xf9, 0xff, 0x00, 0x8a, 0xf9, 0xff, 0x00, 0x8a, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t timer = {
-  .header.always_zero = 0,
-  .header.w = 50,
-  .header.h = 50,
-  .data_size = 2500 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = timer_map,
-};
-
@@ -1,250 +0,0 @@
-/**
- ****************************************************************************************
- *
- * @file weather.c
- *
- * @brief Weather icon source file
- *
- * Copyright (C) 2021-2022 Dialog Semiconductor.
- * This computer program includes Confidential, Proprietary Information
- * of Dialog Semiconductor. All Rights Reserved.
- *
- ****************************************************************************************
- */
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_WEATHER
-#define LV_ATTRIBUTE_IMG_WEATHER
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_WEATHER uint8_t weather_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3b, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x7f, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x7f, 0xff, 0x1b, 0xff, 0x3b, 0xff, 0x1b, 0xff, 0xbe, 0xff, 0xfd, 0xff, 0x1b, 0xff, 0x3b, 0xff, 0x1b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x1b, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x3b, 0xff, 0x1b, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x7b, 0xff, 0x1b, 0xff, 0xbe, 0xff, 0xfd, 0xff, 0x1b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x1b, 0xff, 0xde, 0xff, 0xfd, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x7a, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x1b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x7a, 0xff, 0x5b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3f, 0xff, 0x3b, 0xff, 0x36, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0x76, 0xff, 0x7e, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd9, 0xff, 0x3b, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x9a, 0xff, 0x1b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x2e, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x91, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x9a, 0xff, 0xde, 0xff, 0xfd, 0xff, 0x1b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x05, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x29, 0xff, 0x29, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0x09, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x05, 0xff, 0x09, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x2e, 0xff, 0x29, 0xff, 0x05, 0xff, 0x29, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x7a, 0xff, 0x5b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x09, 0xff, 0x05, 0xff, 0x29, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x29, 0xff, 0x29, 0xff, 0x09, 0xff, 0x29, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0x29, 0xff, 0x05, 0xff, 0x91, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x9a, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x7a, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x32, 0xff, 0x32, 0xff, 0x05, 0xff, 0x05, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0x29, 0xff, 0x4e, 0xff, 0x05, 0xff, 0x05, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x7a, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 
-  0x00, 0x00, 0x37, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x0e, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0x2a, 0xff, 0x29, 0xff, 0x05, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x5a, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 
-  0x00, 0x00, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x29, 0xff, 0x05, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x05, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x05, 0xff, 0xb0, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x2a, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x4e, 0xff, 0x09, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x2e, 0xff, 0x05, 0xff, 0x91, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x76, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x3b, 0xff, 0x09, 0xff, 0x05, 0xff, 0x05, 0xff, 0x2a, 0xff, 0x09, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0xf4, 0xff, 0xb9, 0xff, 0x37, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x7a, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xff, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0x2e, 0xff, 0x29, 0xff, 0x29, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x52, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x0e, 0xff, 0x05, 0xff, 0x29, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x2a, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x29, 0xff, 0x05, 0xff, 0x05, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x0e, 0xff, 0x05, 0xff, 0x25, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0x29, 0xff, 0x05, 0xff, 0x09, 0xff, 0x37, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 
-  0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x0e, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x29, 0xff, 0x05, 0xff, 0x05, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x0e, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x25, 0xff, 0x05, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x12, 0xff, 0x04, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x04, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x12, 0xff, 0x00, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x04, 0xff, 0x0e, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x12, 0xff, 0x05, 0xff, 0x04, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x00, 0xff, 0x09, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x12, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x12, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0x12, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0x13, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x13, 0xff, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x13, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x5e, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x7e, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x5d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0x1d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x5e, 0x27, 0xff, 0x3e, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0xfc, 0x26, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x1e, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0x1d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0xfd, 0x26, 0xff, 0x1d, 0x27, 0xff, 0x3d, 0x27, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfd, 0x26, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0x1d, 0x27, 0xff, 0xfd, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0xbb, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfd, 0x26, 0xff, 0xfd, 0x26, 0xff, 0xfd, 0x26, 0xff, 0xfd, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0x9b, 0x26, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0xbb, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xfc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbb, 0x1e, 0xff, 0xdb, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0x9b, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x1e, 0xff, 0x5b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x26, 0xff, 0xbb, 0x1e, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbb, 0x1e, 0xff, 0x9b, 0x26, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x26, 0xff, 0x7b, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x26, 0xff, 0x9b, 0x26, 0xff, 0xbb, 0x1e, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xdc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbb, 0x26, 0xff, 0xbb, 0x1e, 0xff, 0x9b, 0x26, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x26, 0xff, 0xbb, 0x1e, 0xff, 0xbb, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbc, 0x26, 0xff, 0xbb, 0x26, 0xff, 0xbb, 0x1e, 0xff, 0x9b, 0x26, 0xff, 0x9b, 0x26, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x5b, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x3b, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x26, 0xff, 0x9b, 0x26, 0xff, 0x9b, 0x26, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x26, 0xff, 0x9b, 0x26, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9c, 0x16, 0xff, 0x9b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1e, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9c, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x9b, 0x26, 0xff, 0xb5, 0x76, 0xff, 0x7c, 0x16, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x5b, 0x1e, 0xff, 0x5b, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0xd9, 0x1d, 0xff, 0x98, 0x15, 0xff, 0x3a, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0xb6, 0x5e, 0xff, 0x7d, 0x06, 0xff, 0x7b, 0x1e, 0xff, 0x7c, 0x0e, 0xff, 0xd1, 0xa6, 0xff, 0x29, 0xff, 0xff, 0x5d, 0x06, 0xff, 0x5b, 0x1e, 0xff, 0x5c, 0x0e, 0xff, 0x77, 0x46, 0xff, 0x5a, 0x26, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x19, 0x1e, 0xff, 0xfa, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x15, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0x19, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x5c, 0x0e, 0xff, 0xed, 0xde, 0xff, 0x0b, 0xf7, 0xff, 0x79, 0x2e, 0xff, 0x5c, 0x16, 0xff, 0x29, 0xff, 0xff, 0x29, 0xff, 0xff, 0x95, 0x66, 0xff, 0x3c, 0x0e, 0xff, 0xb0, 0xae, 0xff, 0x24, 0xff, 0xff, 0x1c, 0x06, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xb9, 0x1d, 0xff, 0x98, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x15, 0xff, 0xb8, 0x15, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0x19, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x5c, 0x0e, 0xff, 0xce, 0xc6, 0xff, 0x08, 0xff, 0xff, 0x98, 0x4e, 0xff, 0x59, 0x2e, 0xff, 0x54, 0x56, 0xff, 0x53, 0x5e, 0xff, 0x56, 0x46, 0xff, 0x5b, 0x1e, 0xff, 0xcc, 0xd6, 0xff, 0x06, 0xff, 0xff, 0x1c, 0x06, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x19, 0x1e, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xb8, 0x15, 0xff, 0xd8, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x15, 0xff, 0xb8, 0x15, 0xff, 0xb8, 0x15, 0xff, 0xb9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0x19, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x5a, 0x1e, 0xff, 0x7b, 0x1e, 0xff, 0x7c, 0x16, 0xff, 0x7c, 0x16, 0xff, 0x5c, 0x0e, 0xff, 0x78, 0x46, 0xff, 0x38, 0x2e, 0xff, 0x84, 0xee, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x31, 0x66, 0xff, 0x58, 0x3e, 0xff, 0x1b, 0x0e, 0xff, 0xfb, 0x05, 0xff, 0xfb, 0x05, 0xff, 0xfa, 0x15, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x15, 0xff, 0x98, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0x19, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x1a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x9b, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0xf3, 0x2c, 0xff, 0x88, 0xa4, 0xff, 0xc9, 0x9c, 0xff, 0x50, 0x65, 0xff, 0x94, 0x66, 0xff, 0xe0, 0xfe, 0xff, 0x82, 0xfe, 0xff, 0xa5, 0xfe, 0xff, 0xa5, 0xfe, 0xff, 0x62, 0xfe, 0xff, 0x62, 0xfe, 0xff, 0x62, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0x48, 0xc6, 0xff, 0x1a, 0x1e, 0xff, 0xe7, 0xfe, 0xff, 0xe6, 0xfe, 0xff, 0x52, 0x7e, 0xff, 0xda, 0x15, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xb9, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x15, 0xff, 0x98, 0x15, 0xff, 0xb8, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0x19, 0x1e, 0xff, 0x19, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0x3a, 0x1e, 0xff, 0xed, 0x12, 0xff, 0x27, 0x11, 0xff, 0x68, 0x11, 0xff, 0x69, 0x01, 0xff, 0x69, 0x01, 0xff, 0x69, 0x09, 0xff, 0x68, 0x09, 0xff, 0xc6, 0x7b, 0xff, 0x89, 0xff, 0xff, 0x09, 0xff, 0xff, 0xe9, 0xfe, 0xff, 0xe9, 0xfe, 0xff, 0x63, 0xfe, 0xff, 0x62, 0xfe, 0xff, 0x62, 0xfe, 0xff, 0x60, 0xfe, 0xff, 0x0f, 0x76, 0xff, 0x8d, 0xc6, 0xff, 0xab, 0xde, 0xff, 0xbb, 0x05, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x15, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x77, 0x15, 0xff, 0xb9, 0x15, 0xff, 0x78, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0x3a, 0x1e, 0xff, 0x57, 0x1d, 0xff, 0x47, 0x11, 0xff, 0x88, 0x11, 0xff, 0xa8, 0x11, 0xff, 0xc9, 0x11, 0xff, 0x0b, 0x1a, 0xff, 0x0b, 0x1a, 0xff, 0xc9, 0x11, 0xff, 0x88, 0x09, 0xff, 0x69, 0x01, 0xff, 0xc9, 0x11, 0xff, 0xe8, 0xfe, 0xff, 0xe8, 0xfe, 0xff, 0xe9, 0xfe, 0xff, 0xc8, 0xfe, 0xff, 0x41, 0xfe, 0xff, 0x42, 0xfe, 0xff, 0x42, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0xf9, 0x25, 0xff, 0xd8, 0x1d, 0xff, 0xd9, 0x15, 0xff, 0xb9, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x15, 0xff, 0x98, 0x1d, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x78, 0x15, 0xff, 0xb8, 0x15, 0xff, 0x98, 0x15, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x77, 0x15, 0xff, 0x98, 0x15, 0xff, 0x77, 0x15, 0xff, 0x78, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0x27, 0x11, 0xff, 0x88, 0x11, 0xff, 0xc9, 0x11, 0xff, 0xef, 0x2a, 0xff, 0x72, 0x3b, 0xff, 0x72, 0x3b, 0xff, 0x72, 0x3b, 0xff, 0x92, 0x3b, 0xff, 0xef, 0x32, 0xff, 0xc9, 0x11, 0xff, 0x69, 0x01, 0xff, 0xc9, 0x11, 0xff, 0x48, 0xff, 0xff, 0xc8, 0xfe, 0xff, 0xe9, 0xfe, 0xff, 0x42, 0xfe, 0xff, 0x42, 0xfe, 0xff, 0x42, 0xfe, 0xff, 0x40, 0xfe, 0xff, 0xf2, 0x5d, 0xff, 0xf7, 0x3d, 0xff, 0x9a, 0x05, 0xff, 0xb9, 0x0d, 0xff, 0xb8, 0x1d, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x78, 0x15, 0xff, 0x78, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x78, 0x15, 0xff, 0x78, 0x15, 0xff, 0x57, 0x15, 0xff, 0x77, 0x15, 0xff, 0x78, 0x15, 0xff, 0x78, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0xb8, 0x1d, 0xff, 0xd9, 0x1d, 0xff, 0xf9, 0x1d, 0xff, 0x7b, 0x1e, 0xff, 0x2b, 0x12, 0xff, 0x68, 0x11, 0xff, 0xca, 0x11, 0xff, 0x51, 0x3b, 0xff, 0x10, 0x33, 0xff, 0x2b, 0x1a, 0xff, 0xa9, 0x11, 0xff, 0x88, 0x11, 0xff, 0xc9, 0x11, 0xff, 0x6d, 0x22, 0xff, 0x72, 0x3b, 0xff, 0xea, 0x11, 0xff, 0x28, 0x01, 0xff, 0xe8, 0x7b, 0xff, 0x28, 0xff, 0xff, 0xc9, 0xfe, 0xff, 0x21, 0xfe, 0xff, 0x22, 0xfe, 0xff, 0x22, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0xcf, 0x75, 0xff, 0x8a, 0xe6, 0xff, 0xa8, 0xfe, 0xff, 0xf3, 0x65, 0xff, 0x99, 0x0d, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x78, 0x15, 0xff, 0x77, 0x15, 0xff, 0x77, 0x15, 0xff, 0x17, 0x15, 0xff, 0x37, 0x15, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x78, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x77, 0x15, 0xff, 0x78, 0x15, 0xff, 0x78, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0x98, 0x15, 0xff, 0xb8, 0x1d, 0xff, 0xfa, 0x1d, 0xff, 0xfa, 0x1d, 0xff, 0x94, 0x14, 0xff, 0xb1, 0x13, 0xff, 0x27, 0x11, 0xff, 0x88, 0x09, 0xff, 0x31, 0x33, 0xff, 0x8d, 0x22, 0xff, 0x67, 0x09, 0xff, 0x88, 0x11, 0xff, 0xa8, 0x11, 0xff, 0xa8, 0x11, 0xff, 0xa8, 0x11, 0xff, 0x88, 0x09, 0xff, 0xc9, 0x11, 0xff, 0x51, 0x3b, 0xff, 0x88, 0x09, 0xff, 0x08, 0x01, 0xff, 0x68, 0xff, 0xff, 0x65, 0xfe, 0xff, 0x21, 0xfe, 0xff, 0x22, 0xfe, 0xff, 0x22, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0xcf, 0x75, 0xff, 0x89, 0xee, 0xff, 0x6a, 0xd6, 0xff, 0xb5, 0x45, 0xff, 0x78, 0x15, 0xff, 0x78, 0x15, 0xff, 0x78, 0x15, 0xff, 0x77, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x37, 0x15, 0xff, 0x78, 0x15, 0xff, 
-  0x00, 0x00, 0x00, 0x57, 0x15, 0xff, 0x37, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x77, 0x15, 0xff, 0x78, 0x15, 0xff, 0x78, 0x15, 0xff, 0x98, 0x15, 0xff, 0xb8, 0x15, 0xff, 0xd9, 0x15, 0xff, 0xee, 0x12, 0xff, 0x06, 0x11, 0xff, 0x26, 0x11, 0xff, 0x47, 0x11, 0xff, 0x67, 0x09, 0xff, 0x4c, 0x22, 0xff, 0xcf, 0x2a, 0xff, 0x67, 0x09, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x68, 0x09, 0xff, 0x6c, 0x22, 0xff, 0x4c, 0x22, 0xff, 0x08, 0x01, 0xff, 0x25, 0xc5, 0xff, 0x41, 0xfe, 0xff, 0x22, 0xfe, 0xff, 0x22, 0xfe, 0xff, 0x02, 0xfe, 0xff, 0x20, 0xfe, 0xff, 0xb2, 0x55, 0xff, 0x98, 0x1d, 0xff, 0x7a, 0x05, 0xff, 0x78, 0x15, 0xff, 0x78, 0x15, 0xff, 0x77, 0x15, 0xff, 0x77, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x17, 0x15, 0xff, 0x16, 0x15, 0xff, 0x17, 0x15, 0xff, 
-  0x00, 0x00, 0x00, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x77, 0x15, 0xff, 0x77, 0x15, 0xff, 0x98, 0x15, 0xff, 0x57, 0x15, 0xff, 0x27, 0x11, 0xff, 0x26, 0x11, 0xff, 0x47, 0x09, 0xff, 0x68, 0x11, 0xff, 0xc9, 0x11, 0xff, 0xa9, 0x11, 0xff, 0xae, 0x2a, 0xff, 0xea, 0x19, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0xa9, 0x11, 0xff, 0xce, 0x2a, 0xff, 0x08, 0x01, 0xff, 0x44, 0xa4, 0xff, 0x61, 0xfe, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xfe, 0xff, 0x01, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0xb7, 0x25, 0xff, 0x96, 0x35, 0xff, 0x78, 0x15, 0xff, 0x77, 0x15, 0xff, 0x77, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x16, 0x15, 0xff, 0xf6, 0x14, 0xff, 
-  0xf6, 0x14, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x77, 0x15, 0xff, 0x98, 0x15, 0xff, 0x26, 0x09, 0xff, 0x47, 0x09, 0xff, 0x67, 0x11, 0xff, 0x6d, 0x2a, 0xff, 0xce, 0x32, 0xff, 0x8d, 0x2a, 0xff, 0xae, 0x2a, 0xff, 0x10, 0x33, 0xff, 0x88, 0x11, 0xff, 0x68, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0xef, 0x32, 0xff, 0x07, 0x01, 0xff, 0xa5, 0x83, 0xff, 0x61, 0xfe, 0xff, 0x81, 0xfe, 0xff, 0x21, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0x90, 0x5d, 0xff, 0x6a, 0xde, 0xff, 0x67, 0xf6, 0xff, 0x59, 0x05, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x57, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 
-  0xf6, 0x14, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x57, 0x15, 0xff, 0xb9, 0x15, 0xff, 0x6b, 0x12, 0xff, 0x06, 0x09, 0xff, 0x88, 0x11, 0xff, 0x8d, 0x2a, 0xff, 0x88, 0x11, 0xff, 0x46, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x88, 0x11, 0xff, 0x88, 0x11, 0xff, 0x67, 0x11, 0xff, 0x68, 0x11, 0xff, 0x68, 0x11, 0xff, 0x68, 0x11, 0xff, 0x68, 0x11, 0xff, 0x68, 0x11, 0xff, 0x68, 0x11, 0xff, 0x67, 0x11, 0xff, 0xa8, 0x11, 0xff, 0x8d, 0x2a, 0xff, 0x46, 0x09, 0xff, 0x27, 0x01, 0xff, 0xc8, 0x00, 0xff, 0x07, 0x32, 0xff, 0x61, 0xed, 0xff, 0x0b, 0xa6, 0xff, 0x78, 0x1d, 0xff, 0x49, 0xe6, 0xff, 0x68, 0xf6, 0xff, 0xd0, 0x75, 0xff, 0x38, 0x0d, 0xff, 0x57, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x36, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 
-  0xb5, 0x14, 0xff, 0x16, 0x15, 0xff, 0x37, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x36, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0xc4, 0x08, 0xff, 0x46, 0x09, 0xff, 0x2b, 0x22, 0xff, 0x26, 0x09, 0xff, 0x47, 0x09, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x09, 0xff, 0x67, 0x09, 0xff, 0x67, 0x09, 0xff, 0x67, 0x09, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x47, 0x09, 0xff, 0x4c, 0x22, 0xff, 0xae, 0x2a, 0xff, 0x2b, 0x22, 0xff, 0xea, 0x19, 0xff, 0x47, 0x09, 0xff, 0x27, 0x01, 0xff, 0xa7, 0x00, 0xff, 0x50, 0x3c, 0xff, 0x99, 0x0d, 0xff, 0x39, 0x05, 0xff, 0x39, 0x05, 0xff, 0x38, 0x0d, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0xf6, 0x14, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 
-  0x00, 0x00, 0x00, 0xb5, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x57, 0x15, 0xff, 0x90, 0x13, 0xff, 0xe5, 0x08, 0xff, 0xc9, 0x19, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x11, 0xff, 0x47, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x67, 0x11, 0xff, 0x47, 0x09, 0xff, 0xa8, 0x11, 0xff, 0x4c, 0x22, 0xff, 0x2b, 0x22, 0xff, 0x4c, 0x22, 0xff, 0xae, 0x2a, 0xff, 0xce, 0x32, 0xff, 0xea, 0x19, 0xff, 0x26, 0x09, 0xff, 0xa5, 0x08, 0xff, 0xd5, 0x14, 0xff, 0x57, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x37, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0x17, 0x15, 0xff, 0x16, 0x15, 0xff, 
-  0x00, 0x00, 0x00, 0xb5, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0x16, 0x15, 0xff, 0x57, 0x15, 0xff, 0xed, 0x0a, 0xff, 0xe5, 0x08, 0xff, 0x88, 0x11, 0xff, 0x26, 0x09, 0xff, 0x46, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x46, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x88, 0x11, 0xff, 0x4c, 0x22, 0xff, 0x0a, 0x22, 0xff, 0x05, 0x09, 0xff, 0x0a, 0x12, 0xff, 0x98, 0x15, 0xff, 0x37, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xd6, 0x14, 0xff, 0x37, 0x15, 0xff, 0x16, 0x15, 0xff, 
-  0x00, 0x00, 0x00, 0xb5, 0x14, 0xff, 0xb5, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0x57, 0x15, 0xff, 0xac, 0x0a, 0xff, 0xe5, 0x08, 0xff, 0x47, 0x11, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x47, 0x09, 0xff, 0x26, 0x09, 0xff, 0x06, 0x09, 0xff, 0xea, 0x19, 0xff, 0x67, 0x11, 0xff, 0xa4, 0x08, 0xff, 0x78, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xd5, 0x14, 0xff, 0x58, 0x15, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xb5, 0x14, 0xff, 0xb5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0x37, 0x15, 0xff, 0x2e, 0x0b, 0xff, 0xe5, 0x08, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x46, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x88, 0x11, 0xff, 0xc4, 0x08, 0xff, 0xb5, 0x14, 0xff, 0x16, 0x15, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0x17, 0x15, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xb5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xb5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0x74, 0x14, 0xff, 0xa4, 0x08, 0xff, 0x06, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0xa4, 0x08, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xd6, 0x14, 0xff, 0x16, 0x15, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0x57, 0x15, 0xff, 0x47, 0x09, 0xff, 0xe5, 0x08, 0xff, 0x05, 0x09, 0xff, 0x06, 0x09, 0xff, 0x06, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x58, 0x15, 0xff, 0xf6, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xd6, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x14, 0xff, 0x16, 0x15, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xd6, 0x14, 0xff, 0x53, 0x14, 0xff, 0x83, 0x08, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x06, 0x09, 0xff, 0x06, 0x09, 0xff, 0x06, 0x09, 0xff, 0x06, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x26, 0x09, 0xff, 0x06, 0x09, 0xff, 0x06, 0x09, 0xff, 0x06, 0x09, 0xff, 0x06, 0x09, 0xff, 0x05, 0x09, 0xff, 0xc4, 0x08, 0xff, 0xed, 0x0a, 0xff, 0x17, 0x15, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x17, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x14, 0xff, 0x16, 0x15, 0xff, 0x70, 0x0b, 0xff, 0x63, 0x08, 0xff, 0xe5, 0x08, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0x05, 0x09, 0xff, 0xc4, 0x08, 0xff, 0x46, 0x09, 0xff, 0x37, 0x15, 0xff, 0xd5, 0x14, 0xff, 0xb5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0xd5, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x14, 0xff, 0x12, 0x0c, 0xff, 0xe5, 0x08, 0xff, 0x83, 0x08, 0xff, 0xc4, 0x08, 0xff, 0xe4, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xe5, 0x08, 0xff, 0xc4, 0x08, 0xff, 0x83, 0x08, 0xff, 0x88, 0x09, 0xff, 0xf6, 0x14, 0xff, 0xd5, 0x14, 0xff, 0xb5, 0x14, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x14, 0xff, 0x74, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0x17, 0x0d, 0xff, 0xb0, 0x0b, 0xff, 0x4b, 0x0a, 0xff, 0xc8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0xa8, 0x09, 0xff, 0x4b, 0x0a, 0xff, 0xd1, 0x0b, 0xff, 0x37, 0x15, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xd6, 0x0c, 0xff, 0xf6, 0x0c, 0xff, 0xf6, 0x0c, 0xff, 0xf6, 0x0c, 0xff, 0xf6, 0x0c, 0xff, 0x16, 0x0d, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0x17, 0x15, 0xff, 0x17, 0x15, 0xff, 0x17, 0x15, 0xff, 0x17, 0x15, 0xff, 0x16, 0x15, 0xff, 0x16, 0x15, 0xff, 0xf6, 0x14, 0xff, 0xf6, 0x0c, 0xff, 0xf6, 0x0c, 0xff, 0xf6, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x53, 0x0c, 0xff, 0x53, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x95, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x94, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x74, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x54, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x34, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x0b, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x33, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0x13, 0x0c, 0xff, 0x14, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0c, 0xff, 0x14, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0x13, 0x0c, 0xff, 0xf3, 0x0b, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0x13, 0x0c, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0c, 0xff, 0x13, 0x0c, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x0b, 0xff, 0x13, 0x0c, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0xf3, 0x0b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x1d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x1d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x5e, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x7e, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x5d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xbc, 0xff, 0x26, 0xdc, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x5e, 0xff, 0x27, 0x3e, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x26, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x9b, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xfc, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x3d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x26, 0xfd, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x3d, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x7a, 0xff, 0x1e, 0x5a, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfd, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x27, 0x1d, 0xff, 0x26, 0xfd, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x7a, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x26, 0xbb, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfd, 0xff, 0x26, 0xfd, 0xff, 0x26, 0xfd, 0xff, 0x26, 0xfd, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x26, 0xbb, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x1e, 0xbb, 0xff, 0x26, 0xdb, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x1e, 0x9b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3a, 0xff, 0x1e, 0x5b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x1e, 0xbb, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x1e, 0xbb, 0xff, 0x26, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x1e, 0xbb, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xdc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbb, 0xff, 0x1e, 0xbb, 0xff, 0x26, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x1e, 0xbb, 0xff, 0x26, 0xbb, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbc, 0xff, 0x26, 0xbb, 0xff, 0x1e, 0xbb, 0xff, 0x26, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x5b, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x3b, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x16, 0x9c, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x19, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9c, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x9b, 0xff, 0x26, 0x9b, 0xff, 0x76, 0xb5, 0xff, 0x16, 0x7c, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x5b, 0xff, 0x1e, 0x5b, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1d, 0xd9, 0xff, 0x15, 0x98, 0xff, 0x1e, 0x3a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x5e, 0xb6, 0xff, 0x06, 0x7d, 0xff, 0x1e, 0x7b, 0xff, 0x0e, 0x7c, 0xff, 0xa6, 0xd1, 0xff, 0xff, 0x29, 0xff, 0x06, 0x5d, 0xff, 0x1e, 0x5b, 0xff, 0x0e, 0x5c, 0xff, 0x46, 0x77, 0xff, 0x26, 0x5a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x19, 0xff, 0x1d, 0xfa, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xb8, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1e, 0x19, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x1e, 0x7b, 0xff, 0x0e, 0x5c, 0xff, 0xde, 0xed, 0xff, 0xf7, 0x0b, 0xff, 0x2e, 0x79, 0xff, 0x16, 0x5c, 0xff, 0xff, 0x29, 0xff, 0xff, 0x29, 0xff, 0x66, 0x95, 0xff, 0x0e, 0x3c, 0xff, 0xae, 0xb0, 0xff, 0xff, 0x24, 0xff, 0x06, 0x1c, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xb9, 0xff, 0x15, 0x98, 0xff, 0x1d, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xb8, 0xff, 0x15, 0xb8, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1e, 0x19, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x5a, 0xff, 0x0e, 0x5c, 0xff, 0xc6, 0xce, 0xff, 0xff, 0x08, 0xff, 0x4e, 0x98, 0xff, 0x2e, 0x59, 0xff, 0x56, 0x54, 0xff, 0x5e, 0x53, 0xff, 0x46, 0x56, 0xff, 0x1e, 0x5b, 0xff, 0xd6, 0xcc, 0xff, 0xff, 0x06, 0xff, 0x06, 0x1c, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x19, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x15, 0xb8, 0xff, 0x1d, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x98, 0xff, 0x15, 0xb8, 0xff, 0x15, 0xb8, 0xff, 0x1d, 0xb9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1e, 0x19, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x5a, 0xff, 0x1e, 0x7b, 0xff, 0x16, 0x7c, 0xff, 0x16, 0x7c, 0xff, 0x0e, 0x5c, 0xff, 0x46, 0x78, 0xff, 0x2e, 0x38, 0xff, 0xee, 0x84, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0xfe, 0x80, 0xff, 0x66, 0x31, 0xff, 0x3e, 0x58, 0xff, 0x0e, 0x1b, 0xff, 0x05, 0xfb, 0xff, 0x05, 0xfb, 0xff, 0x15, 0xfa, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xb8, 0xff, 0x1d, 0x98, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0xb8, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1e, 0x19, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x1a, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x9b, 0xff, 0x1e, 0x3a, 0xff, 0x2c, 0xf3, 0xff, 0xa4, 0x88, 0xff, 0x9c, 0xc9, 0xff, 0x65, 0x50, 0xff, 0x66, 0x94, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0x82, 0xff, 0xfe, 0xa5, 0xff, 0xfe, 0xa5, 0xff, 0xfe, 0x62, 0xff, 0xfe, 0x62, 0xff, 0xfe, 0x62, 0xff, 0xfe, 0x80, 0xff, 0xc6, 0x48, 0xff, 0x1e, 0x1a, 0xff, 0xfe, 0xe7, 0xff, 0xfe, 0xe6, 0xff, 0x7e, 0x52, 0xff, 0x15, 0xda, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xb9, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0xb8, 0xff, 0x15, 0x98, 0xff, 0x15, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xb8, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0xb8, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1e, 0x19, 0xff, 0x1e, 0x19, 0xff, 0x1e, 0x3a, 0xff, 0x1e, 0x3a, 0xff, 0x12, 0xed, 0xff, 0x11, 0x27, 0xff, 0x11, 0x68, 0xff, 0x01, 0x69, 0xff, 0x01, 0x69, 0xff, 0x09, 0x69, 0xff, 0x09, 0x68, 0xff, 0x7b, 0xc6, 0xff, 0xff, 0x89, 0xff, 0xff, 0x09, 0xff, 0xfe, 0xe9, 0xff, 0xfe, 0xe9, 0xff, 0xfe, 0x63, 0xff, 0xfe, 0x62, 0xff, 0xfe, 0x62, 0xff, 0xfe, 0x60, 0xff, 0x76, 0x0f, 0xff, 0xc6, 0x8d, 0xff, 0xde, 0xab, 0xff, 0x05, 0xbb, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0xb8, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0xb8, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x15, 0x77, 0xff, 0x15, 0xb9, 0xff, 0x15, 0x78, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xf9, 0xff, 0x1e, 0x3a, 0xff, 0x1d, 0x57, 0xff, 0x11, 0x47, 0xff, 0x11, 0x88, 0xff, 0x11, 0xa8, 0xff, 0x11, 0xc9, 0xff, 0x1a, 0x0b, 0xff, 0x1a, 0x0b, 0xff, 0x11, 0xc9, 0xff, 0x09, 0x88, 0xff, 0x01, 0x69, 0xff, 0x11, 0xc9, 0xff, 0xfe, 0xe8, 0xff, 0xfe, 0xe8, 0xff, 0xfe, 0xe9, 0xff, 0xfe, 0xc8, 0xff, 0xfe, 0x41, 0xff, 0xfe, 0x42, 0xff, 0xfe, 0x42, 0xff, 0xfe, 0x40, 0xff, 0x25, 0xf9, 0xff, 0x1d, 0xd8, 0xff, 0x15, 0xd9, 0xff, 0x1d, 0xb9, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0xb8, 0xff, 0x1d, 0x98, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x15, 0x78, 0xff, 0x15, 0xb8, 0xff, 0x15, 0x98, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x15, 0x77, 0xff, 0x15, 0x98, 0xff, 0x15, 0x77, 0xff, 0x15, 0x78, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0xb8, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xf9, 0xff, 0x1d, 0xb8, 0xff, 0x11, 0x27, 0xff, 0x11, 0x88, 0xff, 0x11, 0xc9, 0xff, 0x2a, 0xef, 0xff, 0x3b, 0x72, 0xff, 0x3b, 0x72, 0xff, 0x3b, 0x72, 0xff, 0x3b, 0x92, 0xff, 0x32, 0xef, 0xff, 0x11, 0xc9, 0xff, 0x01, 0x69, 0xff, 0x11, 0xc9, 0xff, 0xff, 0x48, 0xff, 0xfe, 0xc8, 0xff, 0xfe, 0xe9, 0xff, 0xfe, 0x42, 0xff, 0xfe, 0x42, 0xff, 0xfe, 0x42, 0xff, 0xfe, 0x40, 0xff, 0x5d, 0xf2, 0xff, 0x3d, 0xf7, 0xff, 0x05, 0x9a, 0xff, 0x0d, 0xb9, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x15, 0x78, 0xff, 0x15, 0x78, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x15, 0x78, 0xff, 0x15, 0x78, 0xff, 0x15, 0x57, 0xff, 0x15, 0x77, 0xff, 0x15, 0x78, 0xff, 0x15, 0x78, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x1d, 0xb8, 0xff, 0x15, 0xb8, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xd9, 0xff, 0x1d, 0xf9, 0xff, 0x1e, 0x7b, 0xff, 0x12, 0x2b, 0xff, 0x11, 0x68, 0xff, 0x11, 0xca, 0xff, 0x3b, 0x51, 0xff, 0x33, 0x10, 0xff, 0x1a, 0x2b, 0xff, 0x11, 0xa9, 0xff, 0x11, 0x88, 0xff, 0x11, 0xc9, 0xff, 0x22, 0x6d, 0xff, 0x3b, 0x72, 0xff, 0x11, 0xea, 0xff, 0x01, 0x28, 0xff, 0x7b, 0xe8, 0xff, 0xff, 0x28, 0xff, 0xfe, 0xc9, 0xff, 0xfe, 0x21, 0xff, 0xfe, 0x22, 0xff, 0xfe, 0x22, 0xff, 0xfe, 0x20, 0xff, 0x75, 0xcf, 0xff, 0xe6, 0x8a, 0xff, 0xfe, 0xa8, 0xff, 0x65, 0xf3, 0xff, 0x0d, 0x99, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x15, 0x78, 0xff, 0x15, 0x77, 0xff, 0x15, 0x77, 0xff, 0x15, 0x17, 0xff, 0x15, 0x37, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x15, 0x78, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x77, 0xff, 0x15, 0x78, 0xff, 0x15, 0x78, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x15, 0x98, 0xff, 0x1d, 0xb8, 0xff, 0x1d, 0xfa, 0xff, 0x1d, 0xfa, 0xff, 0x14, 0x94, 0xff, 0x13, 0xb1, 0xff, 0x11, 0x27, 0xff, 0x09, 0x88, 0xff, 0x33, 0x31, 0xff, 0x22, 0x8d, 0xff, 0x09, 0x67, 0xff, 0x11, 0x88, 0xff, 0x11, 0xa8, 0xff, 0x11, 0xa8, 0xff, 0x11, 0xa8, 0xff, 0x09, 0x88, 0xff, 0x11, 0xc9, 0xff, 0x3b, 0x51, 0xff, 0x09, 0x88, 0xff, 0x01, 0x08, 0xff, 0xff, 0x68, 0xff, 0xfe, 0x65, 0xff, 0xfe, 0x21, 0xff, 0xfe, 0x22, 0xff, 0xfe, 0x22, 0xff, 0xfe, 0x20, 0xff, 0x75, 0xcf, 0xff, 0xee, 0x89, 0xff, 0xd6, 0x6a, 0xff, 0x45, 0xb5, 0xff, 0x15, 0x78, 0xff, 0x15, 0x78, 0xff, 0x15, 0x78, 0xff, 0x15, 0x77, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x37, 0xff, 0x15, 0x78, 0xff, 
-  0x00, 0x00, 0x00, 0x15, 0x57, 0xff, 0x15, 0x37, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x77, 0xff, 0x15, 0x78, 0xff, 0x15, 0x78, 0xff, 0x15, 0x98, 0xff, 0x15, 0xb8, 0xff, 0x15, 0xd9, 0xff, 0x12, 0xee, 0xff, 0x11, 0x06, 0xff, 0x11, 0x26, 0xff, 0x11, 0x47, 0xff, 0x09, 0x67, 0xff, 0x22, 0x4c, 0xff, 0x2a, 0xcf, 0xff, 0x09, 0x67, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x09, 0x68, 0xff, 0x22, 0x6c, 0xff, 0x22, 0x4c, 0xff, 0x01, 0x08, 0xff, 0xc5, 0x25, 0xff, 0xfe, 0x41, 0xff, 0xfe, 0x22, 0xff, 0xfe, 0x22, 0xff, 0xfe, 0x02, 0xff, 0xfe, 0x20, 0xff, 0x55, 0xb2, 0xff, 0x1d, 0x98, 0xff, 0x05, 0x7a, 0xff, 0x15, 0x78, 0xff, 0x15, 0x78, 0xff, 0x15, 0x77, 0xff, 0x15, 0x77, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x17, 0xff, 0x15, 0x16, 0xff, 0x15, 0x17, 0xff, 
-  0x00, 0x00, 0x00, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x77, 0xff, 0x15, 0x77, 0xff, 0x15, 0x98, 0xff, 0x15, 0x57, 0xff, 0x11, 0x27, 0xff, 0x11, 0x26, 0xff, 0x09, 0x47, 0xff, 0x11, 0x68, 0xff, 0x11, 0xc9, 0xff, 0x11, 0xa9, 0xff, 0x2a, 0xae, 0xff, 0x19, 0xea, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0xa9, 0xff, 0x2a, 0xce, 0xff, 0x01, 0x08, 0xff, 0xa4, 0x44, 0xff, 0xfe, 0x61, 0xff, 0xfe, 0x02, 0xff, 0xfe, 0x02, 0xff, 0xfe, 0x01, 0xff, 0xfe, 0x00, 0xff, 0x25, 0xb7, 0xff, 0x35, 0x96, 0xff, 0x15, 0x78, 0xff, 0x15, 0x77, 0xff, 0x15, 0x77, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x16, 0xff, 0x14, 0xf6, 0xff, 
-  0x14, 0xf6, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x77, 0xff, 0x15, 0x98, 0xff, 0x09, 0x26, 0xff, 0x09, 0x47, 0xff, 0x11, 0x67, 0xff, 0x2a, 0x6d, 0xff, 0x32, 0xce, 0xff, 0x2a, 0x8d, 0xff, 0x2a, 0xae, 0xff, 0x33, 0x10, 0xff, 0x11, 0x88, 0xff, 0x11, 0x68, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x32, 0xef, 0xff, 0x01, 0x07, 0xff, 0x83, 0xa5, 0xff, 0xfe, 0x61, 0xff, 0xfe, 0x81, 0xff, 0xfe, 0x21, 0xff, 0xfe, 0x00, 0xff, 0x5d, 0x90, 0xff, 0xde, 0x6a, 0xff, 0xf6, 0x67, 0xff, 0x05, 0x59, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x57, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 
-  0x14, 0xf6, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x57, 0xff, 0x15, 0xb9, 0xff, 0x12, 0x6b, 0xff, 0x09, 0x06, 0xff, 0x11, 0x88, 0xff, 0x2a, 0x8d, 0xff, 0x11, 0x88, 0xff, 0x09, 0x46, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x11, 0x88, 0xff, 0x11, 0x88, 0xff, 0x11, 0x67, 0xff, 0x11, 0x68, 0xff, 0x11, 0x68, 0xff, 0x11, 0x68, 0xff, 0x11, 0x68, 0xff, 0x11, 0x68, 0xff, 0x11, 0x68, 0xff, 0x11, 0x67, 0xff, 0x11, 0xa8, 0xff, 0x2a, 0x8d, 0xff, 0x09, 0x46, 0xff, 0x01, 0x27, 0xff, 0x00, 0xc8, 0xff, 0x32, 0x07, 0xff, 0xed, 0x61, 0xff, 0xa6, 0x0b, 0xff, 0x1d, 0x78, 0xff, 0xe6, 0x49, 0xff, 0xf6, 0x68, 0xff, 0x75, 0xd0, 0xff, 0x0d, 0x38, 0xff, 0x15, 0x57, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x36, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 
-  0x14, 0xb5, 0xff, 0x15, 0x16, 0xff, 0x15, 0x37, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x36, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x08, 0xc4, 0xff, 0x09, 0x46, 0xff, 0x22, 0x2b, 0xff, 0x09, 0x26, 0xff, 0x09, 0x47, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x09, 0x67, 0xff, 0x09, 0x67, 0xff, 0x09, 0x67, 0xff, 0x09, 0x67, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x09, 0x47, 0xff, 0x22, 0x4c, 0xff, 0x2a, 0xae, 0xff, 0x22, 0x2b, 0xff, 0x19, 0xea, 0xff, 0x09, 0x47, 0xff, 0x01, 0x27, 0xff, 0x00, 0xa7, 0xff, 0x3c, 0x50, 0xff, 0x0d, 0x99, 0xff, 0x05, 0x39, 0xff, 0x05, 0x39, 0xff, 0x0d, 0x38, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x14, 0xf6, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 
-  0x00, 0x00, 0x00, 0x14, 0xb5, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x57, 0xff, 0x13, 0x90, 0xff, 0x08, 0xe5, 0xff, 0x19, 0xc9, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x11, 0x47, 0xff, 0x11, 0x47, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x11, 0x67, 0xff, 0x09, 0x47, 0xff, 0x11, 0xa8, 0xff, 0x22, 0x4c, 0xff, 0x22, 0x2b, 0xff, 0x22, 0x4c, 0xff, 0x2a, 0xae, 0xff, 0x32, 0xce, 0xff, 0x19, 0xea, 0xff, 0x09, 0x26, 0xff, 0x08, 0xa5, 0xff, 0x14, 0xd5, 0xff, 0x15, 0x57, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x37, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x15, 0x17, 0xff, 0x15, 0x16, 0xff, 
-  0x00, 0x00, 0x00, 0x14, 0xb5, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x15, 0x16, 0xff, 0x15, 0x57, 0xff, 0x0a, 0xed, 0xff, 0x08, 0xe5, 0xff, 0x11, 0x88, 0xff, 0x09, 0x26, 0xff, 0x09, 0x46, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x46, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x11, 0x88, 0xff, 0x22, 0x4c, 0xff, 0x22, 0x0a, 0xff, 0x09, 0x05, 0xff, 0x12, 0x0a, 0xff, 0x15, 0x98, 0xff, 0x15, 0x37, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xd6, 0xff, 0x15, 0x37, 0xff, 0x15, 0x16, 0xff, 
-  0x00, 0x00, 0x00, 0x14, 0xb5, 0xff, 0x14, 0xb5, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x15, 0x57, 0xff, 0x0a, 0xac, 0xff, 0x08, 0xe5, 0xff, 0x11, 0x47, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x47, 0xff, 0x09, 0x26, 0xff, 0x09, 0x06, 0xff, 0x19, 0xea, 0xff, 0x11, 0x67, 0xff, 0x08, 0xa4, 0xff, 0x15, 0x78, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xd5, 0xff, 0x15, 0x58, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x14, 0xb5, 0xff, 0x14, 0xb5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xf6, 0xff, 0x15, 0x37, 0xff, 0x0b, 0x2e, 0xff, 0x08, 0xe5, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x46, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x11, 0x88, 0xff, 0x08, 0xc4, 0xff, 0x14, 0xb5, 0xff, 0x15, 0x16, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x15, 0x17, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x14, 0xb5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0x74, 0xff, 0x08, 0xa4, 0xff, 0x09, 0x06, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x08, 0xa4, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xd6, 0xff, 0x15, 0x16, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x15, 0x57, 0xff, 0x09, 0x47, 0xff, 0x08, 0xe5, 0xff, 0x09, 0x05, 0xff, 0x09, 0x06, 0xff, 0x09, 0x06, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x15, 0x58, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xd6, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xf6, 0xff, 0x15, 0x16, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xd6, 0xff, 0x14, 0x53, 0xff, 0x08, 0x83, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x06, 0xff, 0x09, 0x06, 0xff, 0x09, 0x06, 0xff, 0x09, 0x06, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x26, 0xff, 0x09, 0x06, 0xff, 0x09, 0x06, 0xff, 0x09, 0x06, 0xff, 0x09, 0x06, 0xff, 0x09, 0x05, 0xff, 0x08, 0xc4, 0xff, 0x0a, 0xed, 0xff, 0x15, 0x17, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xd5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x15, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xb5, 0xff, 0x15, 0x16, 0xff, 0x0b, 0x70, 0xff, 0x08, 0x63, 0xff, 0x08, 0xe5, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x09, 0x05, 0xff, 0x08, 0xc4, 0xff, 0x09, 0x46, 0xff, 0x15, 0x37, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x14, 0xd5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0xb5, 0xff, 0x14, 0xf6, 0xff, 0x0c, 0x12, 0xff, 0x08, 0xe5, 0xff, 0x08, 0x83, 0xff, 0x08, 0xc4, 0xff, 0x08, 0xe4, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xe5, 0xff, 0x08, 0xc4, 0xff, 0x08, 0x83, 0xff, 0x09, 0x88, 0xff, 0x14, 0xf6, 0xff, 0x14, 0xd5, 0xff, 0x14, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x14, 0x95, 0xff, 0x0c, 0x74, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0xb5, 0xff, 0x0d, 0x17, 0xff, 0x0b, 0xb0, 0xff, 0x0a, 0x4b, 0xff, 0x09, 0xc8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x09, 0xa8, 0xff, 0x0a, 0x4b, 0xff, 0x0b, 0xd1, 0xff, 0x15, 0x37, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xd6, 0xff, 0x0c, 0xf6, 0xff, 0x0c, 0xf6, 0xff, 0x0c, 0xf6, 0xff, 0x0c, 0xf6, 0xff, 0x0d, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x15, 0x17, 0xff, 0x15, 0x17, 0xff, 0x15, 0x17, 0xff, 0x15, 0x17, 0xff, 0x15, 0x16, 0xff, 0x15, 0x16, 0xff, 0x14, 0xf6, 0xff, 0x0c, 0xf6, 0xff, 0x0c, 0xf6, 0xff, 0x0c, 0xf6, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x53, 0xff, 0x0c, 0x53, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x95, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x94, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x54, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x74, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x07, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x54, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x07, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x34, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf3, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x33, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x13, 0xff, 0x0c, 0x14, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0c, 0x13, 0xff, 0x0b, 0xf3, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0c, 0x13, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x13, 0xff, 0x0c, 0x13, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf3, 0xff, 0x0c, 0x13, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x0b, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe2, 0x1f, 0xff, 0xea, 0xe4, 0x20, 0xff, 0xe9, 0xe4, 0x1f, 0xff, 0xe8, 0xe4, 0x1f, 0xff, 0xe8, 0xe3, 0x1f, 0xff, 0xea, 0xe5, 0x21, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xe2, 0x1f, 0xff, 0xe9, 0xe4, 0x1f, 0xff, 0xe9, 0xe4, 0x21, 0xff, 0xeb, 0xe4, 0x21, 0xff, 0xea, 0xe5, 0x21, 0xff, 0xeb, 0xe6, 0x21, 0xff, 0xee, 0xe7, 0x22, 0xff, 0xe9, 0xe4, 0x21, 0xff, 0xef, 0xeb, 0x23, 0xff, 0xe9, 0xe4, 0x21, 0xff, 0xeb, 0xe4, 0x22, 0xff, 0xea, 0xe4, 0x20, 0xff, 0xea, 0xe7, 0x22, 0xff, 0xea, 0xe4, 0x20, 0xff, 0xe9, 0xe4, 0x1f, 0xff, 0xe8, 0xe2, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xd6, 0x1f, 0xff, 0xe0, 0xd8, 0x1f, 0xff, 0xe8, 0xe2, 0x1f, 0xff, 0xe9, 0xe4, 0x21, 0xff, 0xe9, 0xe4, 0x21, 0xff, 0xea, 0xe4, 0x21, 0xff, 0xe9, 0xe4, 0x21, 0xff, 0xe9, 0xe4, 0x22, 0xff, 0xea, 0xe5, 0x21, 0xff, 0xea, 0xe5, 0x21, 0xff, 0xea, 0xe5, 0x21, 0xff, 0xea, 0xe5, 0x21, 0xff, 0xea, 0xe4, 0x22, 0xff, 0xe9, 0xe4, 0x22, 0xff, 0xe9, 0xe4, 0x21, 0xff, 0xed, 0xe7, 0x21, 0xff, 0xef, 0xe5, 0x22, 0xff, 0xea, 0xe4, 0x21, 0xff, 0xea, 0xe4, 0x21, 0xff, 0xe0, 0xdb, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd1, 0x1a, 0xff, 0xdf, 0xd7, 0x1f, 0xff, 0xde, 0xd8, 0x1f, 0xff, 0xdf, 0xd8, 0x1f, 0xff, 0xe4, 0xdc, 0x20, 0xff, 0xe8, 0xe2, 0x20, 0xff, 0xe8, 0xe4, 0x20, 0xff, 0xe7, 0xe1, 0x21, 0xff, 0xe7, 0xe1, 0x20, 0xff, 0xe8, 0xe2, 0x21, 0xff, 0xe8, 0xe2, 0x21, 0xff, 0xe8, 0xe3, 0x21, 0xff, 0xe8, 0xe3, 0x21, 0xff, 0xe8, 0xe3, 0x21, 0xff, 0xe8, 0xe2, 0x21, 0xff, 0xe7, 0xe2, 0x20, 0xff, 0xe7, 0xe1, 0x21, 0xff, 0xe6, 0xe0, 0x20, 0xff, 0xe6, 0xdf, 0x20, 0xff, 0xe5, 0xde, 0x1f, 0xff, 0xe6, 0xdf, 0x20, 0xff, 0xea, 0xe4, 0x20, 0xff, 0xe0, 0xd7, 0x1e, 0xff, 0xdd, 0xd8, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xcb, 0x1b, 0xff, 0xd3, 0xc7, 0x1b, 0xff, 0xde, 0xd8, 0x1f, 0xff, 0xe1, 0xd8, 0x1e, 0xff, 0xe1, 0xd8, 0x1f, 0xff, 0xe2, 0xda, 0x1e, 0xff, 0xe3, 0xdb, 0x1f, 0xff, 0xe4, 0xdd, 0x20, 0xff, 0xe4, 0xde, 0x1f, 0xff, 0xe5, 0xde, 0x1f, 0xff, 0xe6, 0xdf, 0x20, 0xff, 0xe6, 0xe0, 0x20, 0xff, 0xe6, 0xe0, 0x20, 0xff, 0xe6, 0xe0, 0x20, 0xff, 0xe7, 0xe0, 0x20, 0xff, 0xe6, 0xe0, 0x20, 0xff, 0xe6, 0xe0, 0x20, 0xff, 0xe6, 0xdf, 0x20, 0xff, 0xe5, 0xdf, 0x20, 0xff, 0xe5, 0xde, 0x1f, 0xff, 0xe4, 0xdd, 0x20, 0xff, 0xe3, 0xdc, 0x1f, 0xff, 0xe2, 0xdb, 0x1e, 0xff, 0xe1, 0xd9, 0x1f, 0xff, 0xe0, 0xd8, 0x1e, 0xff, 0xe0, 0xd8, 0x1e, 0xff, 0xe0, 0xd8, 0x1e, 0xff, 0xde, 0xd8, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xcb, 0x1b, 0xff, 0xd5, 0xcc, 0x1b, 0xff, 0xd5, 0xcd, 0x1b, 0xff, 0xdc, 0xd5, 0x1d, 0xff, 0xde, 0xd7, 0x1e, 0xff, 0xdf, 0xd7, 0x1d, 0xff, 0xe0, 0xd8, 0x1e, 0xff, 0xe1, 0xda, 0x1f, 0xff, 0xe2, 0xdb, 0x1e, 0xff, 0xe3, 0xdc, 0x1f, 0xff, 0xe3, 0xdd, 0x1f, 0xff, 0xe4, 0xdd, 0x20, 0xff, 0xe4, 0xde, 0x20, 0xff, 0xe5, 0xde, 0x1f, 0xff, 0xe5, 0xde, 0x1f, 0xff, 0xe5, 0xde, 0x1f, 0xff, 0xe5, 0xde, 0x1f, 0xff, 0xe4, 0xde, 0x20, 0xff, 0xe4, 0xdd, 0x20, 0xff, 0xe4, 0xdd, 0x1f, 0xff, 0xe3, 0xdc, 0x1f, 0xff, 0xe2, 0xdb, 0x1e, 0xff, 0xe1, 0xda, 0x1f, 0xff, 0xe0, 0xd9, 0x1e, 0xff, 0xe0, 0xd8, 0x1e, 0xff, 0xde, 0xd6, 0x1d, 0xff, 0xdd, 0xd8, 0x1d, 0xff, 0xde, 0xd8, 0x1e, 0xff, 0xe1, 0xd8, 0x20, 0xff, 0xd8, 0xd2, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xcb, 0x1b, 0xff, 0xd5, 0xcc, 0x1b, 0xff, 0xd5, 0xcc, 0x1b, 0xff, 0xd5, 0xcf, 0x1b, 0xff, 0xdb, 0xd2, 0x1c, 0xff, 0xdc, 0xd4, 0x1d, 0xff, 0xde, 0xd5, 0x1e, 0xff, 0xde, 0xd6, 0x1d, 0xff, 0xdf, 0xd7, 0x1e, 0xff, 0xe0, 0xd9, 0x1e, 0xff, 0xe1, 0xd9, 0x1f, 0xff, 0xe2, 0xda, 0x1e, 0xff, 0xe2, 0xdb, 0x1e, 0xff, 0xe2, 0xdb, 0x1f, 0xff, 0xe3, 0xdc, 0x1f, 0xff, 0xe3, 0xdc, 0x1f, 0xff, 0xe3, 0xdc, 0x1f, 0xff, 0xe3, 0xdc, 0x1f, 0xff, 0xe3, 0xdb, 0x1f, 0xff, 0xe2, 0xdb, 0x1e, 0xff, 0xe2, 0xda, 0x1e, 0xff, 0xe1, 0xda, 0x1f, 0xff, 0xe1, 0xd9, 0x1f, 0xff, 0xe0, 0xd8, 0x1e, 0xff, 0xdf, 0xd7, 0x1d, 0xff, 0xde, 0xd6, 0x1e, 0xff, 0xdd, 0xd4, 0x1d, 0xff, 0xdc, 0xd3, 0x1c, 0xff, 0xdb, 0xd8, 0x1d, 0xff, 0xdf, 0xd8, 0x1e, 0xff, 0xe1, 0xd7, 0x1e, 0xff, 0xd9, 0xcf, 0x1c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xc6, 0x19, 0xff, 0xd5, 0xca, 0x1b, 0xff, 0xd6, 0xcc, 0x1b, 0xff, 0xd7, 0xce, 0x1c, 0xff, 0xd9, 0xcf, 0x1b, 0xff, 0xda, 0xd0, 0x1c, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xdc, 0xd3, 0x1c, 0xff, 0xdd, 0xd4, 0x1d, 0xff, 0xde, 0xd5, 0x1e, 0xff, 0xde, 0xd6, 0x1d, 0xff, 0xdf, 0xd7, 0x1e, 0xff, 0xe0, 0xd8, 0x1e, 0xff, 0xe0, 0xd8, 0x1e, 0xff, 0xe1, 0xd9, 0x1e, 0xff, 0xe1, 0xd9, 0x1f, 0xff, 0xe1, 0xda, 0x1f, 0xff, 0xe1, 0xd9, 0x1f, 0xff, 0xe1, 0xd9, 0x1f, 0xff, 0xe1, 0xd9, 0x1f, 0xff, 0xe0, 0xd9, 0x1e, 0xff, 0xe0, 0xd8, 0x1e, 0xff, 0xdf, 0xd7, 0x1e, 0xff, 0xdf, 0xd7, 0x1d, 0xff, 0xde, 0xd6, 0x1e, 0xff, 0xdd, 0xd5, 0x1d, 0xff, 0xdc, 0xd4, 0x1c, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xda, 0xd1, 0x1c, 0xff, 0xd9, 0xd0, 0x1b, 0xff, 0xd9, 0xd1, 0x1c, 0xff, 0xda, 0xd1, 0x1d, 0xff, 0xd8, 0xce, 0x1b, 0xff, 0xd0, 0xc3, 0x18, 0xff, 0xd0, 0xc4, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xc6, 0x19, 0xff, 0xd1, 0xc7, 0x19, 0xff, 0xd4, 0xc9, 0x1a, 0xff, 0xd5, 0xca, 0x1b, 0xff, 0xd6, 0xcc, 0x1b, 0xff, 0xd7, 0xcd, 0x1c, 0xff, 0xd8, 0xcf, 0x1b, 0xff, 0xd9, 0xd0, 0x1c, 0xff, 0xda, 0xd1, 0x1d, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xdc, 0xd3, 0x1c, 0xff, 0xdd, 0xd4, 0x1d, 0xff, 0xdd, 0xd5, 0x1d, 0xff, 0xde, 0xd6, 0x1e, 0xff, 0xde, 0xd6, 0x1d, 0xff, 0xdf, 0xd7, 0x1d, 0xff, 0xdf, 0xd7, 0x1d, 0xff, 0xdf, 0xd7, 0x1e, 0xff, 0xdf, 0xd7, 0x1e, 0xff, 0xdf, 0xd7, 0x1d, 0xff, 0xdf, 0xd7, 0x1d, 0xff, 0xdf, 0xd7, 0x1d, 0xff, 0xde, 0xd6, 0x1e, 0xff, 0xde, 0xd5, 0x1e, 0xff, 0xdd, 0xd4, 0x1d, 0xff, 0xdc, 0xd4, 0x1d, 0xff, 0xdb, 0xd3, 0x1c, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xda, 0xd0, 0x1c, 0xff, 0xd9, 0xcf, 0x1b, 0xff, 0xd8, 0xce, 0x1c, 0xff, 0xd6, 0xcc, 0x1b, 0xff, 0xd5, 0xcb, 0x1a, 0xff, 0xd4, 0xc9, 0x1b, 0xff, 0xd0, 0xc4, 0x18, 0xff, 0xd0, 0xc4, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xc7, 0x19, 0xff, 0xd1, 0xc7, 0x1a, 0xff, 0xd1, 0xc6, 0x19, 0xff, 0xd2, 0xc7, 0x19, 0xff, 0xd3, 0xc9, 0x1a, 0xff, 0xd4, 0xca, 0x1b, 0xff, 0xd6, 0xcb, 0x1a, 0xff, 0xd7, 0xcd, 0x1b, 0xff, 0xd8, 0xce, 0x1c, 0xff, 0xd9, 0xcf, 0x1b, 0xff, 0xd9, 0xd0, 0x1c, 0xff, 0xda, 0xd1, 0x1c, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xdc, 0xd3, 0x1c, 0xff, 0xdc, 0xd3, 0x1d, 0xff, 0xdd, 0xd4, 0x1d, 0xff, 0xdd, 0xd4, 0x1d, 0xff, 0xdd, 0xd5, 0x1d, 0xff, 0xdd, 0xd5, 0x1d, 0xff, 0xdd, 0xd5, 0x1d, 0xff, 0xdd, 0xd5, 0x1d, 0xff, 0xdd, 0xd4, 0x1d, 0xff, 0xdd, 0xd4, 0x1d, 0xff, 0xdc, 0xd4, 0x1d, 0xff, 0xdc, 0xd3, 0x1c, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xdb, 0xd1, 0x1d, 0xff, 0xda, 0xd1, 0x1c, 0xff, 0xd9, 0xd0, 0x1b, 0xff, 0xd8, 0xce, 0x1c, 0xff, 0xd7, 0xcd, 0x1b, 0xff, 0xd6, 0xcc, 0x1b, 0xff, 0xd5, 0xca, 0x1b, 0xff, 0xd4, 0xc9, 0x1a, 0xff, 0xd3, 0xc8, 0x19, 0xff, 0xd7, 0xc6, 0x1a, 0xff, 0xd0, 0xc4, 0x18, 0xff, 0xd0, 0xc4, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xbc, 0x17, 0xff, 0xcb, 0xbe, 0x17, 0xff, 0xd0, 0xc3, 0x1a, 0xff, 0xd1, 0xc6, 0x18, 0xff, 0xd1, 0xc5, 0x19, 0xff, 0xd2, 0xc7, 0x19, 0xff, 0xd3, 0xc8, 0x1a, 0xff, 0xd4, 0xc9, 0x1b, 0xff, 0xd5, 0xcb, 0x1a, 0xff, 0xd6, 0xcc, 0x1b, 0xff, 0xd7, 0xcd, 0x1b, 0xff, 0xd8, 0xce, 0x1c, 0xff, 0xd9, 0xcf, 0x1b, 0xff, 0xd9, 0xd0, 0x1c, 0xff, 0xda, 0xd1, 0x1c, 0xff, 0xda, 0xd1, 0x1c, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xdb, 0xd2, 0x1c, 0xff, 0xdb, 0xd2, 0x1c, 0xff, 0xdb, 0xd2, 0x1c, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xdb, 0xd2, 0x1d, 0xff, 0xda, 0xd1, 0x1c, 0xff, 0xdc, 0xd0, 0x1a, 0xff, 0xdf, 0xcf, 0x13, 0xff, 0xd9, 0xcf, 0x1b, 0xff, 0xd8, 0xce, 0x1c, 0xff, 0xd7, 0xcd, 0x1c, 0xff, 0xd6, 0xcc, 0x1b, 0xff, 0xd5, 0xcb, 0x1a, 0xff, 0xd4, 0xca, 0x1b, 0xff, 0xd3, 0xc8, 0x1a, 0xff, 0xd2, 0xc7, 0x19, 0xff, 0xd1, 0xc6, 0x1a, 0xff, 0xd0, 0xc4, 0x18, 0xff, 0xd0, 0xc4, 0x19, 0xff, 0xd0, 0xc4, 0x18, 0xff, 0xce, 0xc3, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xbf, 0x17, 0xff, 0xca, 0xbc, 0x17, 0xff, 0xca, 0xbd, 0x17, 0xff, 0xcd, 0xc0, 0x18, 0xff, 0xce, 0xc2, 0x19, 0xff, 0xcf, 0xc3, 0x18, 0xff, 0xd0, 0xc5, 0x19, 0xff, 0xd2, 0xc6, 0x1a, 0xff, 0xd3, 0xc7, 0x19, 0xff, 0xd3, 0xc9, 0x1a, 0xff, 0xd5, 0xca, 0x1b, 0xff, 0xd5, 0xcb, 0x1a, 0xff, 0xd6, 0xcc, 0x1b, 0xff, 0xd7, 0xcd, 0x1b, 0xff, 0xd8, 0xce, 0x1c, 0xff, 0xd8, 0xce, 0x1c, 0xff, 0xd8, 0xcf, 0x1b, 0xff, 0xd9, 0xcf, 0x1b, 0xff, 0xd9, 0xd0, 0x1c, 0xff, 0xd9, 0xd0, 0x1c, 0xff, 0xd9, 0xd0, 0x1c, 0xff, 0xd9, 0xd0, 0x1c, 0xff, 0xde, 0xcf, 0x15, 0xff, 0xd9, 0xd0, 0x1b, 0xff, 0xd9, 0xcf, 0x1c, 0xff, 0xda, 0xcf, 0x19, 0xff, 0xd5, 0xcf, 0x21, 0xff, 0xa5, 0xd6, 0x6f, 0xff, 0xdd, 0xcc, 0x12, 0xff, 0xd6, 0xcc, 0x1b, 0xff, 0xd5, 0xcb, 0x1a, 0xff, 0xd8, 0xca, 0x15, 0xff, 0xd5, 0xc9, 0x19, 0xff, 0xd3, 0xc8, 0x19, 0xff, 0xd2, 0xc7, 0x1a, 0xff, 0xd1, 0xc5, 0x19, 0xff, 0xd0, 0xc4, 0x18, 0xff, 0xce, 0xc2, 0x19, 0xff, 0xcd, 0xc1, 0x18, 0xff, 0xc5, 0xb8, 0x16, 0xff, 0xc2, 0xb2, 0x14, 0xff, 0xd0, 0xc4, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xbc, 0x17, 0xff, 0xcb, 0xbd, 0x17, 0xff, 0xca, 0xbd, 0x17, 0xff, 0xcb, 0xbe, 0x18, 0xff, 0xcd, 0xc0, 0x17, 0xff, 0xce, 0xc1, 0x19, 0xff, 0xcf, 0xc3, 0x18, 0xff, 0xd0, 0xc4, 0x19, 0xff, 0xd1, 0xc5, 0x19, 0xff, 0xd2, 0xc7, 0x1a, 0xff, 0xd3, 0xc8, 0x19, 0xff, 0xd4, 0xc9, 0x1a, 0xff, 0xd4, 0xca, 0x1b, 0xff, 0xd5, 0xca, 0x1b, 0xff, 0xd6, 0xcb, 0x1a, 0xff, 0xd6, 0xcc, 0x1b, 0xff, 0xd7, 0xcd, 0x1b, 0xff, 0xd7, 0xcd, 0x1b, 0xff, 0xd7, 0xcd, 0x1b, 0xff, 0xd7, 0xce, 0x1c, 0xff, 0xd8, 0xce, 0x1c, 0xff, 0xdc, 0xcd, 0x15, 0xff, 0xb1, 0xd4, 0x5b, 0xff, 0xe7, 0xcb, 0x01, 0xff, 0xda, 0xcd, 0x17, 0xff, 0xe1, 0xcb, 0x0a, 0xff, 0x85, 0xd9, 0xa2, 0xff, 0x46, 0xe3, 0xff, 0xff, 0xe6, 0xc8, 0x00, 0xff, 0xd6, 0xca, 0x19, 0xff, 0xe1, 0xc7, 0x05, 0xff, 0xba, 0xcd, 0x44, 0xff, 0xcd, 0xc8, 0x22, 0xff, 0xd2, 0xc6, 0x18, 0xff, 0xd0, 0xc5, 0x19, 0xff, 0xcf, 0xc3, 0x18, 0xff, 0xce, 0xc2, 0x19, 0xff, 0xcd, 0xc0, 0x18, 0xff, 0xcc, 0xbf, 0x17, 0xff, 0xcf, 0xbd, 0x18, 0xff, 0xc2, 0xb3, 0x15, 0xff, 0xc1, 0xb3, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xb5, 0x14, 0xff, 0xc6, 0xb7, 0x15, 0xff, 0xc8, 0xba, 0x17, 0xff, 0xc9, 0xbb, 0x16, 0xff, 0xca, 0xbd, 0x17, 0xff, 0xcb, 0xbe, 0x18, 0xff, 0xcc, 0xc0, 0x17, 0xff, 0xcd, 0xc1, 0x18, 0xff, 0xce, 0xc2, 0x19, 0xff, 0xcf, 0xc3, 0x18, 0xff, 0xd0, 0xc5, 0x19, 0xff, 0xd1, 0xc6, 0x1a, 0xff, 0xd2, 0xc7, 0x1a, 0xff, 0xd3, 0xc8, 0x19, 0xff, 0xd3, 0xc8, 0x1a, 0xff, 0xd4, 0xc9, 0x1a, 0xff, 0xd4, 0xca, 0x1b, 0xff, 0xd5, 0xca, 0x1b, 0xff, 0xd5, 0xcb, 0x1a, 0xff, 0xd5, 0xcb, 0x1a, 0xff, 0xd6, 0xcb, 0x1a, 0xff, 0xd6, 0xcb, 0x1a, 0xff, 0xe1, 0xca, 0x07, 0xff, 0x66, 0xde, 0xd5, 0xff, 0x57, 0xe0, 0xed, 0xff, 0xcc, 0xcc, 0x2a, 0xff, 0xdd, 0xca, 0x0f, 0xff, 0x45, 0xe3, 0xff, 0xff, 0x45, 0xe3, 0xff, 0xff, 0xac, 0xd0, 0x5f, 0xff, 0xdd, 0xc6, 0x0a, 0xff, 0x7e, 0xd6, 0xa6, 0xff, 0x24, 0xe5, 0xff, 0xff, 0xe1, 0xc2, 0x00, 0xff, 0xd0, 0xc4, 0x18, 0xff, 0xcf, 0xc3, 0x19, 0xff, 0xce, 0xc1, 0x18, 0xff, 0xcd, 0xc0, 0x17, 0xff, 0xcb, 0xbe, 0x18, 0xff, 0xca, 0xbd, 0x17, 0xff, 0xc9, 0xbc, 0x16, 0xff, 0xc7, 0xb6, 0x16, 0xff, 0xc1, 0xb2, 0x14, 0xff, 0xc1, 0xb5, 0x16, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xb5, 0x14, 0xff, 0xc3, 0xb6, 0x14, 0xff, 0xc6, 0xb8, 0x15, 0xff, 0xc7, 0xb9, 0x16, 0xff, 0xc8, 0xbb, 0x17, 0xff, 0xca, 0xbc, 0x16, 0xff, 0xcb, 0xbe, 0x18, 0xff, 0xcc, 0xbf, 0x17, 0xff, 0xcd, 0xc0, 0x18, 0xff, 0xce, 0xc1, 0x18, 0xff, 0xcf, 0xc2, 0x19, 0xff, 0xcf, 0xc3, 0x18, 0xff, 0xd0, 0xc4, 0x19, 0xff, 0xd1, 0xc5, 0x19, 0xff, 0xd1, 0xc6, 0x1a, 0xff, 0xd2, 0xc7, 0x19, 0xff, 0xd3, 0xc7, 0x19, 0xff, 0xd3, 0xc8, 0x1a, 0xff, 0xd3, 0xc8, 0x1a, 0xff, 0xd4, 0xc9, 0x1a, 0xff, 0xd4, 0xc9, 0x1a, 0xff, 0xd4, 0xc9, 0x1a, 0xff, 0xdf, 0xc7, 0x08, 0xff, 0x70, 0xda, 0xc1, 0xff, 0x44, 0xe2, 0xff, 0xff, 0xbe, 0xcf, 0x49, 0xff, 0xc7, 0xc8, 0x25, 0xff, 0xa1, 0xc9, 0x4d, 0xff, 0x98, 0xc9, 0x57, 0xff, 0xaf, 0xc8, 0x3f, 0xff, 0xd6, 0xc7, 0x1a, 0xff, 0x64, 0xda, 0xd4, 0xff, 0x30, 0xe2, 0xff, 0xff, 0xdf, 0xc0, 0x00, 0xff, 0xce, 0xc2, 0x19, 0xff, 0xcd, 0xc0, 0x18, 0xff, 0xcc, 0xbf, 0x17, 0xff, 0xcb, 0xbe, 0x18, 0xff, 0xca, 0xbd, 0x17, 0xff, 0xc9, 0xbb, 0x16, 0xff, 0xc8, 0xba, 0x17, 0xff, 0xc7, 0xb8, 0x15, 0xff, 0xc8, 0xb7, 0x17, 0xff, 0xc3, 0xb3, 0x14, 0xff, 0xc3, 0xb7, 0x16, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xb0, 0x13, 0xff, 0xc2, 0xb5, 0x14, 0xff, 0xc3, 0xb5, 0x14, 0xff, 0xc5, 0xb6, 0x16, 0xff, 0xc6, 0xb8, 0x15, 0xff, 0xc7, 0xb9, 0x16, 0xff, 0xc8, 0xba, 0x17, 0xff, 0xc9, 0xbc, 0x16, 0xff, 0xca, 0xbd, 0x17, 0xff, 0xcb, 0xbe, 0x18, 0xff, 0xcc, 0xbf, 0x17, 0xff, 0xcd, 0xc0, 0x18, 0xff, 0xce, 0xc1, 0x18, 0xff, 0xce, 0xc2, 0x19, 0xff, 0xcf, 0xc3, 0x18, 0xff, 0xd0, 0xc4, 0x19, 0xff, 0xd0, 0xc5, 0x19, 0xff, 0xd1, 0xc5, 0x19, 0xff, 0xd1, 0xc6, 0x19, 0xff, 0xd3, 0xc8, 0x1a, 0xff, 0xd9, 0xcc, 0x17, 0xff, 0xe1, 0xcd, 0x0d, 0xff, 0xe1, 0xcc, 0x0d, 0xff, 0xdf, 0xca, 0x0c, 0xff, 0xc2, 0xcc, 0x3d, 0xff, 0xc1, 0xc6, 0x28, 0xff, 0x21, 0xd0, 0xe7, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x03, 0xd2, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x02, 0xd1, 0xff, 0xff, 0x8b, 0xc5, 0x63, 0xff, 0xc2, 0xc7, 0x37, 0xff, 0xd5, 0xbf, 0x0b, 0xff, 0xdb, 0xbd, 0x00, 0xff, 0xdb, 0xbb, 0x00, 0xff, 0xd0, 0xbc, 0x0d, 0xff, 0xc9, 0xbc, 0x16, 0xff, 0xc8, 0xbb, 0x17, 0xff, 0xc7, 0xb9, 0x16, 0xff, 0xc6, 0xb8, 0x15, 0xff, 0xc5, 0xb7, 0x16, 0xff, 0xc4, 0xb5, 0x15, 0xff, 0xc2, 0xb2, 0x14, 0xff, 0xc2, 0xb2, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xb5, 0x14, 0xff, 0xc3, 0xb2, 0x15, 0xff, 0xc2, 0xb3, 0x15, 0xff, 0xc3, 0xb4, 0x14, 0xff, 0xc4, 0xb6, 0x15, 0xff, 0xc5, 0xb7, 0x16, 0xff, 0xc7, 0xb8, 0x16, 0xff, 0xc8, 0xba, 0x17, 0xff, 0xc8, 0xbb, 0x17, 0xff, 0xca, 0xbc, 0x16, 0xff, 0xca, 0xbd, 0x17, 0xff, 0xcb, 0xbe, 0x18, 0xff, 0xcc, 0xbf, 0x17, 0xff, 0xcd, 0xc0, 0x18, 0xff, 0xcd, 0xc1, 0x18, 0xff, 0xce, 0xc2, 0x18, 0xff, 0xce, 0xc2, 0x19, 0xff, 0xd1, 0xc5, 0x19, 0xff, 0xdc, 0xd1, 0x19, 0xff, 0xd3, 0xc5, 0x16, 0xff, 0x9c, 0x9c, 0x2b, 0xff, 0x3d, 0x91, 0xa2, 0xff, 0x4a, 0x9a, 0x9b, 0xff, 0x83, 0xa7, 0x60, 0xff, 0x9d, 0xd1, 0x5e, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x0e, 0xd1, 0xff, 0xff, 0x28, 0xd5, 0xfd, 0xff, 0x25, 0xd4, 0xfd, 0xff, 0x0f, 0xce, 0xfc, 0xff, 0x10, 0xce, 0xfc, 0xff, 0x10, 0xce, 0xfe, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x42, 0xc8, 0xbd, 0xff, 0xd2, 0xc0, 0x18, 0xff, 0x3c, 0xdb, 0xff, 0xff, 0x34, 0xdc, 0xff, 0xff, 0x91, 0xc7, 0x75, 0xff, 0xce, 0xb9, 0x0d, 0xff, 0xc7, 0xb9, 0x16, 0xff, 0xc6, 0xb8, 0x15, 0xff, 0xc5, 0xb6, 0x16, 0xff, 0xc4, 0xb5, 0x15, 0xff, 0xc2, 0xb3, 0x14, 0xff, 0xc1, 0xb2, 0x14, 0xff, 0xc1, 0xb3, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xb5, 0x14, 0xff, 0xbf, 0xb0, 0x13, 0xff, 0xc1, 0xb1, 0x14, 0xff, 0xc2, 0xb3, 0x15, 0xff, 0xc3, 0xb4, 0x14, 0xff, 0xc4, 0xb5, 0x15, 0xff, 0xc5, 0xb7, 0x16, 0xff, 0xc6, 0xb8, 0x15, 0xff, 0xc7, 0xb9, 0x16, 0xff, 0xc8, 0xba, 0x17, 0xff, 0xc9, 0xbb, 0x16, 0xff, 0xc9, 0xbc, 0x16, 0xff, 0xca, 0xbd, 0x17, 0xff, 0xcb, 0xbe, 0x18, 0xff, 0xcb, 0xbf, 0x18, 0xff, 0xcc, 0xbf, 0x17, 0xff, 0xd3, 0xc6, 0x18, 0xff, 0xd0, 0xc4, 0x18, 0xff, 0x6c, 0x5c, 0x13, 0xff, 0x39, 0x26, 0x0f, 0xff, 0x42, 0x2d, 0x0d, 0xff, 0x49, 0x2d, 0x02, 0xff, 0x48, 0x2d, 0x02, 0xff, 0x45, 0x2b, 0x06, 0xff, 0x43, 0x2b, 0x0a, 0xff, 0x33, 0x7a, 0x76, 0xff, 0x4c, 0xef, 0xff, 0xff, 0x4a, 0xe0, 0xff, 0xff, 0x4b, 0xdd, 0xfe, 0xff, 0x4b, 0xdd, 0xfe, 0xff, 0x16, 0xce, 0xfc, 0xff, 0x0f, 0xcc, 0xfc, 0xff, 0x10, 0xcc, 0xfd, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x7a, 0xc0, 0x73, 0xff, 0x69, 0xd2, 0xc0, 0xff, 0x55, 0xd3, 0xdc, 0xff, 0xd8, 0xb6, 0x00, 0xff, 0xc6, 0xb8, 0x15, 0xff, 0xc5, 0xb7, 0x16, 0xff, 0xc4, 0xb6, 0x15, 0xff, 0xc3, 0xb4, 0x14, 0xff, 0xc2, 0xb3, 0x15, 0xff, 0xc1, 0xb2, 0x14, 0xff, 0xc1, 0xb2, 0x14, 0xff, 0xc2, 0xb4, 0x15, 0xff, 0xc1, 0xb3, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xbc, 0xac, 0x13, 0xff, 0xca, 0xb4, 0x14, 0xff, 0xbe, 0xae, 0x13, 0xff, 0xbf, 0xaf, 0x14, 0xff, 0xc0, 0xb1, 0x14, 0xff, 0xc1, 0xb2, 0x14, 0xff, 0xc2, 0xb3, 0x15, 0xff, 0xc3, 0xb5, 0x15, 0xff, 0xc4, 0xb6, 0x15, 0xff, 0xc5, 0xb7, 0x16, 0xff, 0xc6, 0xb8, 0x15, 0xff, 0xc7, 0xb9, 0x16, 0xff, 0xc8, 0xba, 0x17, 0xff, 0xc8, 0xbb, 0x17, 0xff, 0xc9, 0xbc, 0x16, 0xff, 0xca, 0xbc, 0x17, 0xff, 0xd1, 0xc4, 0x18, 0xff, 0xb6, 0xa8, 0x16, 0xff, 0x3a, 0x28, 0x0f, 0xff, 0x42, 0x30, 0x0f, 0xff, 0x43, 0x33, 0x0d, 0xff, 0x48, 0x37, 0x10, 0xff, 0x57, 0x42, 0x18, 0xff, 0x56, 0x41, 0x17, 0xff, 0x49, 0x37, 0x10, 0xff, 0x44, 0x32, 0x0c, 0xff, 0x4c, 0x2b, 0x00, 0xff, 0x4a, 0x37, 0x10, 0xff, 0x44, 0xde, 0xff, 0xff, 0x44, 0xde, 0xff, 0xff, 0x45, 0xdb, 0xfe, 0xff, 0x41, 0xd9, 0xfe, 0xff, 0x0b, 0xc9, 0xfc, 0xff, 0x11, 0xca, 0xfd, 0xff, 0x0f, 0xc9, 0xfe, 0xff, 0x00, 0xc9, 0xff, 0xff, 0xc6, 0xbb, 0x1e, 0xff, 0xc3, 0xb9, 0x1c, 0xff, 0xc8, 0xb7, 0x12, 0xff, 0xc5, 0xb6, 0x16, 0xff, 0xc4, 0xb5, 0x15, 0xff, 0xc3, 0xb4, 0x14, 0xff, 0xc2, 0xb2, 0x15, 0xff, 0xc1, 0xb1, 0x14, 0xff, 0xbf, 0xb0, 0x13, 0xff, 0xbe, 0xae, 0x14, 0xff, 0xc4, 0xb3, 0x13, 0xff, 0xc2, 0xb2, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xbb, 0xac, 0x12, 0xff, 0xc3, 0xb0, 0x14, 0xff, 0xbc, 0xac, 0x12, 0xff, 0xbe, 0xae, 0x13, 0xff, 0xbf, 0xaf, 0x14, 0xff, 0xc0, 0xb0, 0x13, 0xff, 0xc1, 0xb1, 0x14, 0xff, 0xc2, 0xb3, 0x15, 0xff, 0xc3, 0xb4, 0x14, 0xff, 0xc4, 0xb5, 0x15, 0xff, 0xc4, 0xb6, 0x15, 0xff, 0xc5, 0xb7, 0x16, 0xff, 0xc6, 0xb8, 0x15, 0xff, 0xc7, 0xb9, 0x16, 0xff, 0xc7, 0xb9, 0x16, 0xff, 0xcb, 0xbd, 0x17, 0xff, 0xc3, 0xb6, 0x16, 0xff, 0x37, 0x25, 0x0f, 0xff, 0x42, 0x32, 0x0e, 0xff, 0x4a, 0x38, 0x11, 0xff, 0x79, 0x5c, 0x2c, 0xff, 0x91, 0x6e, 0x3a, 0xff, 0x90, 0x6e, 0x39, 0xff, 0x91, 0x6e, 0x3a, 0xff, 0x92, 0x70, 0x3a, 0xff, 0x7c, 0x5e, 0x2d, 0xff, 0x4b, 0x39, 0x11, 0xff, 0x45, 0x2e, 0x04, 0xff, 0x48, 0x38, 0x13, 0xff, 0x42, 0xe9, 0xff, 0xff, 0x42, 0xda, 0xff, 0xff, 0x49, 0xdb, 0xfe, 0xff, 0x0e, 0xc8, 0xfc, 0xff, 0x0f, 0xc8, 0xfd, 0xff, 0x0f, 0xc7, 0xfd, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x92, 0xbb, 0x55, 0xff, 0xb5, 0xbb, 0x35, 0xff, 0xd4, 0xb1, 0x00, 0xff, 0xc8, 0xb3, 0x0c, 0xff, 0xc2, 0xb3, 0x15, 0xff, 0xc1, 0xb2, 0x14, 0xff, 0xc0, 0xb1, 0x13, 0xff, 0xbf, 0xaf, 0x14, 0xff, 0xbe, 0xae, 0x13, 0xff, 0xbd, 0xad, 0x12, 0xff, 0xbd, 0xb0, 0x13, 0xff, 0xc1, 0xb2, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xbd, 0xad, 0x12, 0xff, 0xbd, 0xad, 0x13, 0xff, 0xbb, 0xaa, 0x12, 0xff, 0xbc, 0xac, 0x13, 0xff, 0xbd, 0xad, 0x12, 0xff, 0xbe, 0xae, 0x13, 0xff, 0xbf, 0xb0, 0x14, 0xff, 0xc0, 0xb1, 0x13, 0xff, 0xc1, 0xb2, 0x14, 0xff, 0xc2, 0xb3, 0x15, 0xff, 0xc3, 0xb4, 0x14, 0xff, 0xc3, 0xb5, 0x15, 0xff, 0xc4, 0xb6, 0x15, 0xff, 0xc6, 0xb8, 0x16, 0xff, 0xcb, 0xbc, 0x16, 0xff, 0xdb, 0xcd, 0x17, 0xff, 0x56, 0x45, 0x10, 0xff, 0x3e, 0x2d, 0x0d, 0xff, 0x4d, 0x3a, 0x14, 0xff, 0x8b, 0x6a, 0x37, 0xff, 0x80, 0x61, 0x31, 0xff, 0x5b, 0x45, 0x1c, 0xff, 0x48, 0x36, 0x11, 0xff, 0x42, 0x32, 0x0d, 0xff, 0x4b, 0x39, 0x12, 0xff, 0x66, 0x4d, 0x22, 0xff, 0x8d, 0x6b, 0x38, 0xff, 0x4e, 0x3b, 0x14, 0xff, 0x44, 0x26, 0x00, 0xff, 0x43, 0x7e, 0x7a, 0xff, 0x40, 0xe3, 0xff, 0xff, 0x45, 0xd9, 0xfe, 0xff, 0x0a, 0xc5, 0xfc, 0xff, 0x10, 0xc6, 0xfd, 0xff, 0x0f, 0xc6, 0xfd, 0xff, 0x03, 0xc6, 0xff, 0xff, 0x76, 0xba, 0x72, 0xff, 0x4d, 0xd1, 0xe4, 0xff, 0x3f, 0xd3, 0xf6, 0xff, 0x96, 0xbd, 0x5f, 0xff, 0xc5, 0xb0, 0x0b, 0xff, 0xc0, 0xb0, 0x13, 0xff, 0xbe, 0xaf, 0x14, 0xff, 0xbe, 0xae, 0x13, 0xff, 0xbc, 0xac, 0x12, 0xff, 0xbb, 0xab, 0x13, 0xff, 0xb7, 0xa2, 0x12, 0xff, 0xb5, 0xa3, 0x11, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xbe, 0xae, 0x13, 0xff, 0xba, 0xa8, 0x11, 0xff, 0xb9, 0xa8, 0x11, 0xff, 0xba, 0xaa, 0x12, 0xff, 0xbc, 0xab, 0x13, 0xff, 0xbd, 0xac, 0x12, 0xff, 0xbe, 0xae, 0x13, 0xff, 0xbe, 0xaf, 0x14, 0xff, 0xc0, 0xb0, 0x13, 0xff, 0xc0, 0xb1, 0x14, 0xff, 0xc1, 0xb2, 0x14, 0xff, 0xc3, 0xb4, 0x15, 0xff, 0xcd, 0xbe, 0x15, 0xff, 0xcd, 0xbe, 0x15, 0xff, 0x9f, 0x90, 0x13, 0xff, 0x85, 0x76, 0x12, 0xff, 0x37, 0x26, 0x0e, 0xff, 0x40, 0x30, 0x0c, 0xff, 0x85, 0x65, 0x34, 0xff, 0x6a, 0x50, 0x24, 0xff, 0x3c, 0x2d, 0x0a, 0xff, 0x41, 0x31, 0x0d, 0xff, 0x44, 0x33, 0x0e, 0xff, 0x44, 0x33, 0x0e, 0xff, 0x43, 0x33, 0x0e, 0xff, 0x3f, 0x30, 0x0c, 0xff, 0x4a, 0x38, 0x12, 0xff, 0x87, 0x67, 0x36, 0xff, 0x40, 0x2f, 0x0b, 0xff, 0x44, 0x20, 0x00, 0xff, 0x44, 0xeb, 0xff, 0xff, 0x26, 0xce, 0xfe, 0xff, 0x0c, 0xc4, 0xfc, 0xff, 0x0f, 0xc4, 0xfd, 0xff, 0x0e, 0xc4, 0xfd, 0xff, 0x03, 0xc4, 0xff, 0xff, 0x78, 0xb8, 0x6f, 0xff, 0x49, 0xd1, 0xe9, 0xff, 0x51, 0xcd, 0xd4, 0xff, 0xa7, 0xb6, 0x3d, 0xff, 0xc2, 0xae, 0x0e, 0xff, 0xbe, 0xae, 0x13, 0xff, 0xbd, 0xad, 0x12, 0xff, 0xbc, 0xac, 0x13, 0xff, 0xbb, 0xaa, 0x12, 0xff, 0xba, 0xa9, 0x11, 0xff, 0xb8, 0xa7, 0x12, 0xff, 0xb7, 0xa5, 0x12, 0xff, 0xbd, 0xad, 0x14, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0xbc, 0xa8, 0x12, 0xff, 0xb5, 0xa4, 0x10, 0xff, 0xb8, 0xa7, 0x11, 0xff, 0xb9, 0xa8, 0x12, 0xff, 0xba, 0xa9, 0x12, 0xff, 0xbb, 0xaa, 0x12, 0xff, 0xbc, 0xab, 0x13, 0xff, 0xbd, 0xad, 0x12, 0xff, 0xbe, 0xae, 0x13, 0xff, 0xbf, 0xaf, 0x14, 0xff, 0xc4, 0xb4, 0x14, 0xff, 0xc6, 0xb7, 0x14, 0xff, 0x6d, 0x5d, 0x10, 0xff, 0x2f, 0x1f, 0x0d, 0xff, 0x34, 0x24, 0x0d, 0xff, 0x37, 0x28, 0x0d, 0xff, 0x3c, 0x2d, 0x0c, 0xff, 0x5e, 0x48, 0x1f, 0xff, 0x76, 0x5a, 0x2c, 0xff, 0x3a, 0x2c, 0x0a, 0xff, 0x42, 0x32, 0x0e, 0xff, 0x43, 0x32, 0x0f, 0xff, 0x43, 0x32, 0x0e, 0xff, 0x43, 0x32, 0x0e, 0xff, 0x43, 0x32, 0x0e, 0xff, 0x43, 0x32, 0x0e, 0xff, 0x3d, 0x2e, 0x0c, 0xff, 0x64, 0x4b, 0x22, 0xff, 0x5f, 0x49, 0x1f, 0xff, 0x42, 0x21, 0x00, 0xff, 0x27, 0xa6, 0xc4, 0xff, 0x09, 0xc7, 0xff, 0xff, 0x0e, 0xc3, 0xfd, 0xff, 0x0f, 0xc3, 0xfd, 0xff, 0x0f, 0xc2, 0xfd, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x91, 0xb4, 0x50, 0xff, 0xc1, 0xb1, 0x15, 0xff, 0xcd, 0xac, 0x00, 0xff, 0xc1, 0xad, 0x0d, 0xff, 0xbd, 0xad, 0x13, 0xff, 0xbc, 0xac, 0x12, 0xff, 0xbb, 0xab, 0x13, 0xff, 0xba, 0xaa, 0x12, 0xff, 0xb9, 0xa8, 0x11, 0xff, 0xb8, 0xa7, 0x12, 0xff, 0xb7, 0xa2, 0x11, 0xff, 0xb4, 0xa1, 0x11, 0xff, 0xb5, 0xa2, 0x11, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0xba, 0xa6, 0x10, 0xff, 0xb5, 0xa4, 0x11, 0xff, 0xb6, 0xa4, 0x10, 0xff, 0xb7, 0xa6, 0x11, 0xff, 0xb8, 0xa7, 0x12, 0xff, 0xb9, 0xa8, 0x11, 0xff, 0xba, 0xaa, 0x12, 0xff, 0xbb, 0xab, 0x13, 0xff, 0xbc, 0xac, 0x13, 0xff, 0xc2, 0xb1, 0x13, 0xff, 0xb7, 0xa7, 0x13, 0xff, 0x35, 0x26, 0x0d, 0xff, 0x34, 0x25, 0x0d, 0xff, 0x38, 0x2a, 0x0b, 0xff, 0x3d, 0x2e, 0x0d, 0xff, 0x4b, 0x39, 0x14, 0xff, 0x48, 0x36, 0x12, 0xff, 0x71, 0x56, 0x2a, 0xff, 0x4e, 0x3b, 0x16, 0xff, 0x3e, 0x2f, 0x0d, 0xff, 0x40, 0x31, 0x0e, 0xff, 0x41, 0x31, 0x0e, 0xff, 0x41, 0x31, 0x0e, 0xff, 0x41, 0x31, 0x0e, 0xff, 0x41, 0x31, 0x0e, 0xff, 0x41, 0x31, 0x0e, 0xff, 0x3f, 0x30, 0x0e, 0xff, 0x47, 0x36, 0x12, 0xff, 0x73, 0x57, 0x2b, 0xff, 0x3f, 0x21, 0x00, 0xff, 0x20, 0x8a, 0xa3, 0xff, 0x0c, 0xcb, 0xff, 0xff, 0x0e, 0xc1, 0xfd, 0xff, 0x0e, 0xc1, 0xfd, 0xff, 0x0c, 0xc0, 0xfe, 0xff, 0x00, 0xc1, 0xff, 0xff, 0xb9, 0xb3, 0x24, 0xff, 0xae, 0xb2, 0x2f, 0xff, 0xc0, 0xac, 0x0d, 0xff, 0xbc, 0xac, 0x12, 0xff, 0xbb, 0xab, 0x13, 0xff, 0xbb, 0xaa, 0x12, 0xff, 0xba, 0xa9, 0x11, 0xff, 0xb9, 0xa8, 0x12, 0xff, 0xb8, 0xa6, 0x11, 0xff, 0xb7, 0xa5, 0x10, 0xff, 0xb6, 0xa4, 0x11, 0xff, 0xb4, 0xa1, 0x11, 0xff, 0xb4, 0x9d, 0x10, 0xff, 
-  0xb0, 0x9e, 0x0e, 0xff, 0xb5, 0xa4, 0x10, 0xff, 0xb6, 0xa4, 0x10, 0xff, 0xb5, 0xa4, 0x10, 0xff, 0xb6, 0xa4, 0x11, 0xff, 0xb7, 0xa5, 0x10, 0xff, 0xb8, 0xa6, 0x11, 0xff, 0xb9, 0xa8, 0x12, 0xff, 0xba, 0xa9, 0x11, 0xff, 0xbc, 0xab, 0x12, 0xff, 0xc0, 0xaf, 0x13, 0xff, 0x31, 0x23, 0x0c, 0xff, 0x35, 0x27, 0x0b, 0xff, 0x3c, 0x2d, 0x0d, 0xff, 0x67, 0x4e, 0x26, 0xff, 0x74, 0x58, 0x2d, 0xff, 0x6a, 0x51, 0x27, 0xff, 0x72, 0x56, 0x2c, 0xff, 0x7e, 0x60, 0x32, 0xff, 0x41, 0x31, 0x0e, 0xff, 0x3d, 0x2e, 0x0d, 0xff, 0x3f, 0x2f, 0x0d, 0xff, 0x3f, 0x2f, 0x0d, 0xff, 0x3f, 0x2f, 0x0d, 0xff, 0x3f, 0x30, 0x0d, 0xff, 0x3f, 0x30, 0x0d, 0xff, 0x3f, 0x2f, 0x0d, 0xff, 0x3e, 0x2f, 0x0d, 0xff, 0x3f, 0x2f, 0x0d, 0xff, 0x77, 0x5b, 0x2e, 0xff, 0x3b, 0x22, 0x00, 0xff, 0x26, 0x76, 0x82, 0xff, 0x0a, 0xcc, 0xff, 0xff, 0x09, 0xcf, 0xff, 0xff, 0x0c, 0xc3, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x84, 0xb0, 0x58, 0xff, 0x4d, 0xcc, 0xda, 0xff, 0x3c, 0xce, 0xf2, 0xff, 0xcc, 0xa7, 0x00, 0xff, 0xbb, 0xaa, 0x12, 0xff, 0xba, 0xa9, 0x11, 0xff, 0xb9, 0xa8, 0x12, 0xff, 0xb8, 0xa7, 0x12, 0xff, 0xb7, 0xa6, 0x11, 0xff, 0xb6, 0xa4, 0x10, 0xff, 0xb5, 0xa3, 0x11, 0xff, 0xb4, 0xa2, 0x10, 0xff, 0xb4, 0xa2, 0x10, 0xff, 0xb4, 0xa2, 0x10, 0xff, 
-  0xb0, 0x9d, 0x0e, 0xff, 0xb5, 0xa4, 0x10, 0xff, 0xb5, 0xa3, 0x10, 0xff, 0xb3, 0xa1, 0x10, 0xff, 0xb4, 0xa2, 0x10, 0xff, 0xb5, 0xa3, 0x11, 0xff, 0xb6, 0xa4, 0x10, 0xff, 0xb7, 0xa6, 0x11, 0xff, 0xb8, 0xa7, 0x11, 0xff, 0xc5, 0xb4, 0x12, 0xff, 0x5a, 0x4c, 0x0e, 0xff, 0x30, 0x22, 0x0c, 0xff, 0x3f, 0x30, 0x10, 0xff, 0x68, 0x4f, 0x27, 0xff, 0x41, 0x31, 0x10, 0xff, 0x34, 0x27, 0x09, 0xff, 0x36, 0x29, 0x0a, 0xff, 0x35, 0x28, 0x09, 0xff, 0x40, 0x30, 0x0f, 0xff, 0x40, 0x30, 0x0f, 0xff, 0x3c, 0x2d, 0x0d, 0xff, 0x3d, 0x2e, 0x0e, 0xff, 0x3d, 0x2e, 0x0e, 0xff, 0x3d, 0x2e, 0x0e, 0xff, 0x3d, 0x2e, 0x0e, 0xff, 0x3d, 0x2e, 0x0e, 0xff, 0x3d, 0x2e, 0x0e, 0xff, 0x3c, 0x2d, 0x0d, 0xff, 0x43, 0x33, 0x11, 0xff, 0x6c, 0x52, 0x29, 0xff, 0x34, 0x27, 0x08, 0xff, 0x3c, 0x23, 0x00, 0xff, 0x42, 0x19, 0x00, 0xff, 0x35, 0x40, 0x2d, 0xff, 0x0a, 0xac, 0xec, 0xff, 0x5a, 0xbf, 0xa1, 0xff, 0xbe, 0xae, 0x18, 0xff, 0x47, 0xca, 0xdd, 0xff, 0x3d, 0xcc, 0xee, 0xff, 0x84, 0xb7, 0x6f, 0xff, 0xbf, 0xa6, 0x08, 0xff, 0xb8, 0xa7, 0x11, 0xff, 0xb7, 0xa6, 0x11, 0xff, 0xb6, 0xa5, 0x10, 0xff, 0xb5, 0xa4, 0x11, 0xff, 0xb4, 0xa3, 0x10, 0xff, 0xb3, 0xa1, 0x0f, 0xff, 0xb2, 0xa0, 0x10, 0xff, 0xb4, 0xa1, 0x10, 0xff, 0xb4, 0xa1, 0x10, 0xff, 
-  0xa6, 0x95, 0x0d, 0xff, 0xb3, 0xa2, 0x0f, 0xff, 0xb6, 0xa4, 0x11, 0xff, 0xb2, 0x9f, 0x10, 0xff, 0xb3, 0xa0, 0x10, 0xff, 0xb4, 0xa1, 0x0f, 0xff, 0xb4, 0xa3, 0x10, 0xff, 0xb5, 0xa4, 0x11, 0xff, 0xb8, 0xa6, 0x11, 0xff, 0xb6, 0xa5, 0x11, 0xff, 0x23, 0x17, 0x0b, 0xff, 0x33, 0x27, 0x0a, 0xff, 0x5c, 0x45, 0x21, 0xff, 0x31, 0x25, 0x09, 0xff, 0x37, 0x29, 0x0c, 0xff, 0x39, 0x2b, 0x0d, 0xff, 0x39, 0x2b, 0x0d, 0xff, 0x3a, 0x2b, 0x0c, 0xff, 0x39, 0x2b, 0x0c, 0xff, 0x3a, 0x2c, 0x0c, 0xff, 0x3b, 0x2c, 0x0c, 0xff, 0x3b, 0x2c, 0x0d, 0xff, 0x3b, 0x2d, 0x0d, 0xff, 0x3b, 0x2d, 0x0d, 0xff, 0x3b, 0x2d, 0x0d, 0xff, 0x3b, 0x2d, 0x0d, 0xff, 0x3b, 0x2d, 0x0d, 0xff, 0x36, 0x29, 0x0a, 0xff, 0x5e, 0x47, 0x20, 0xff, 0x6d, 0x53, 0x2a, 0xff, 0x5a, 0x44, 0x1f, 0xff, 0x4d, 0x3b, 0x18, 0xff, 0x37, 0x2a, 0x0b, 0xff, 0x37, 0x24, 0x03, 0xff, 0x36, 0x14, 0x00, 0xff, 0x7d, 0x87, 0x36, 0xff, 0xc9, 0xb1, 0x09, 0xff, 0xc5, 0xa5, 0x00, 0xff, 0xc6, 0xa4, 0x00, 0xff, 0xbe, 0xa5, 0x08, 0xff, 0xb7, 0xa6, 0x11, 0xff, 0xb6, 0xa5, 0x10, 0xff, 0xb6, 0xa4, 0x11, 0xff, 0xb5, 0xa3, 0x10, 0xff, 0xb4, 0xa2, 0x10, 0xff, 0xb3, 0xa1, 0x0f, 0xff, 0xb2, 0x9f, 0x10, 0xff, 0xb1, 0x9e, 0x0f, 0xff, 0xb3, 0xa2, 0x10, 0xff, 0xb3, 0xa1, 0x10, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0xa8, 0x95, 0x0d, 0xff, 0xaf, 0x99, 0x0f, 0xff, 0xb0, 0x9d, 0x0e, 0xff, 0xb1, 0x9e, 0x0f, 0xff, 0xb2, 0x9f, 0x10, 0xff, 0xb3, 0xa1, 0x10, 0xff, 0xb4, 0xa2, 0x0f, 0xff, 0xbb, 0xa9, 0x10, 0xff, 0x80, 0x70, 0x0e, 0xff, 0x29, 0x1c, 0x0a, 0xff, 0x49, 0x37, 0x17, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x36, 0x29, 0x0c, 0xff, 0x37, 0x29, 0x0c, 0xff, 0x37, 0x2a, 0x0c, 0xff, 0x38, 0x2a, 0x0d, 0xff, 0x38, 0x2a, 0x0d, 0xff, 0x39, 0x2b, 0x0d, 0xff, 0x39, 0x2b, 0x0d, 0xff, 0x39, 0x2b, 0x0d, 0xff, 0x39, 0x2b, 0x0d, 0xff, 0x39, 0x2b, 0x0d, 0xff, 0x39, 0x2b, 0x0d, 0xff, 0x39, 0x2b, 0x0d, 0xff, 0x38, 0x2a, 0x0c, 0xff, 0x43, 0x33, 0x12, 0xff, 0x60, 0x49, 0x23, 0xff, 0x5a, 0x45, 0x20, 0xff, 0x62, 0x4a, 0x24, 0xff, 0x6e, 0x53, 0x2b, 0xff, 0x72, 0x57, 0x2d, 0xff, 0x4f, 0x3c, 0x1a, 0xff, 0x31, 0x25, 0x09, 0xff, 0x25, 0x15, 0x06, 0xff, 0xaa, 0x99, 0x11, 0xff, 0xbb, 0xaa, 0x11, 0xff, 0xb7, 0xa5, 0x11, 0xff, 0xb6, 0xa5, 0x10, 0xff, 0xb5, 0xa4, 0x11, 0xff, 0xb5, 0xa3, 0x10, 0xff, 0xb4, 0xa2, 0x10, 0xff, 0xb3, 0xa1, 0x0f, 0xff, 0xb2, 0xa0, 0x10, 0xff, 0xb1, 0x9e, 0x0f, 0xff, 0xb0, 0x9e, 0x0e, 0xff, 0xaf, 0x9c, 0x0f, 0xff, 0xb7, 0xa2, 0x10, 0xff, 0xb3, 0xa2, 0x10, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0xa9, 0x96, 0x0d, 0xff, 0xae, 0x99, 0x0e, 0xff, 0xae, 0x9b, 0x0e, 0xff, 0xaf, 0x9c, 0x0f, 0xff, 0xb0, 0x9d, 0x0e, 0xff, 0xb1, 0x9e, 0x0f, 0xff, 0xb2, 0x9f, 0x10, 0xff, 0xbc, 0xa9, 0x10, 0xff, 0x6a, 0x5b, 0x0c, 0xff, 0x2a, 0x1e, 0x0a, 0xff, 0x3f, 0x30, 0x12, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x34, 0x27, 0x0c, 0xff, 0x35, 0x28, 0x0c, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x36, 0x28, 0x0b, 0xff, 0x36, 0x29, 0x0b, 0xff, 0x36, 0x29, 0x0c, 0xff, 0x37, 0x29, 0x0c, 0xff, 0x37, 0x29, 0x0c, 0xff, 0x37, 0x2a, 0x0c, 0xff, 0x37, 0x2a, 0x0c, 0xff, 0x37, 0x2a, 0x0c, 0xff, 0x37, 0x2a, 0x0c, 0xff, 0x37, 0x2a, 0x0c, 0xff, 0x37, 0x2a, 0x0c, 0xff, 0x36, 0x29, 0x0c, 0xff, 0x33, 0x27, 0x0a, 0xff, 0x33, 0x26, 0x0a, 0xff, 0x32, 0x26, 0x09, 0xff, 0x30, 0x24, 0x08, 0xff, 0x3f, 0x2f, 0x10, 0xff, 0x60, 0x49, 0x24, 0xff, 0x54, 0x3f, 0x1d, 0xff, 0x2c, 0x20, 0x09, 0xff, 0x4e, 0x40, 0x0d, 0xff, 0xc2, 0xb0, 0x11, 0xff, 0xb5, 0xa3, 0x10, 0xff, 0xb4, 0xa2, 0x10, 0xff, 0xb4, 0xa2, 0x10, 0xff, 0xb3, 0xa1, 0x0f, 0xff, 0xb2, 0xa0, 0x10, 0xff, 0xb1, 0x9f, 0x0f, 0xff, 0xb1, 0x9e, 0x0e, 0xff, 0xb0, 0x9d, 0x0f, 0xff, 0xaf, 0x9b, 0x0e, 0xff, 0xae, 0x9a, 0x0e, 0xff, 0xb7, 0xa3, 0x10, 0xff, 0xb3, 0xa1, 0x10, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0xa9, 0x95, 0x0d, 0xff, 0xa8, 0x95, 0x0d, 0xff, 0xad, 0x99, 0x0d, 0xff, 0xae, 0x9a, 0x0e, 0xff, 0xaf, 0x9b, 0x0e, 0xff, 0xaf, 0x9c, 0x0f, 0xff, 0xb0, 0x9d, 0x0e, 0xff, 0xba, 0xa7, 0x0f, 0xff, 0x64, 0x56, 0x0c, 0xff, 0x29, 0x1e, 0x0a, 0xff, 0x36, 0x28, 0x0d, 0xff, 0x31, 0x25, 0x0a, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x33, 0x26, 0x0b, 0xff, 0x33, 0x27, 0x0c, 0xff, 0x34, 0x27, 0x0c, 0xff, 0x34, 0x27, 0x0c, 0xff, 0x35, 0x28, 0x0c, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x36, 0x28, 0x0b, 0xff, 0x36, 0x28, 0x0b, 0xff, 0x36, 0x28, 0x0b, 0xff, 0x36, 0x28, 0x0b, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x35, 0x28, 0x0b, 0xff, 0x33, 0x26, 0x0b, 0xff, 0x2d, 0x22, 0x08, 0xff, 0x4e, 0x3c, 0x1b, 0xff, 0x3b, 0x2d, 0x10, 0xff, 0x22, 0x16, 0x0a, 0xff, 0xc0, 0xad, 0x10, 0xff, 0xb4, 0xa2, 0x0f, 0xff, 0xb3, 0xa0, 0x10, 0xff, 0xb2, 0xa0, 0x10, 0xff, 0xb1, 0x9f, 0x0f, 0xff, 0xb1, 0x9e, 0x0e, 0xff, 0xb0, 0x9d, 0x0e, 0xff, 0xaf, 0x9c, 0x0f, 0xff, 0xae, 0x9b, 0x0e, 0xff, 0xad, 0x99, 0x0d, 0xff, 0xac, 0x98, 0x0e, 0xff, 0xbd, 0xa7, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa8, 0x95, 0x0d, 0xff, 0xa8, 0x95, 0x0d, 0xff, 0xab, 0x97, 0x0d, 0xff, 0xac, 0x98, 0x0e, 0xff, 0xad, 0x99, 0x0d, 0xff, 0xae, 0x9a, 0x0e, 0xff, 0xae, 0x9b, 0x0e, 0xff, 0xb7, 0xa3, 0x0f, 0xff, 0x73, 0x63, 0x0c, 0xff, 0x26, 0x1b, 0x0a, 0xff, 0x2f, 0x23, 0x0a, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x30, 0x25, 0x0a, 0xff, 0x31, 0x25, 0x0a, 0xff, 0x31, 0x25, 0x0a, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x33, 0x26, 0x0b, 0xff, 0x33, 0x26, 0x0b, 0xff, 0x33, 0x27, 0x0c, 0xff, 0x33, 0x27, 0x0c, 0xff, 0x33, 0x27, 0x0c, 0xff, 0x34, 0x27, 0x0c, 0xff, 0x34, 0x27, 0x0c, 0xff, 0x34, 0x27, 0x0c, 0xff, 0x34, 0x27, 0x0c, 0xff, 0x34, 0x27, 0x0c, 0xff, 0x33, 0x27, 0x0c, 0xff, 0x33, 0x27, 0x0c, 0xff, 0x33, 0x26, 0x0b, 0xff, 0x33, 0x26, 0x0b, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x2e, 0x23, 0x08, 0xff, 0x3d, 0x2f, 0x11, 0xff, 0x21, 0x17, 0x09, 0xff, 0xa7, 0x95, 0x0f, 0xff, 0xb4, 0xa1, 0x0f, 0xff, 0xb1, 0x9e, 0x0f, 0xff, 0xb0, 0x9d, 0x0e, 0xff, 0xaf, 0x9c, 0x0f, 0xff, 0xaf, 0x9c, 0x0e, 0xff, 0xae, 0x9b, 0x0e, 0xff, 0xad, 0x9a, 0x0d, 0xff, 0xac, 0x99, 0x0e, 0xff, 0xab, 0x98, 0x0d, 0xff, 0xab, 0x97, 0x0d, 0xff, 0xb6, 0xa2, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa9, 0x95, 0x0d, 0xff, 0xac, 0x98, 0x0d, 0xff, 0xa9, 0x95, 0x0d, 0xff, 0xaa, 0x96, 0x0c, 0xff, 0xab, 0x97, 0x0d, 0xff, 0xac, 0x98, 0x0e, 0xff, 0xad, 0x99, 0x0d, 0xff, 0xb1, 0x9d, 0x0e, 0xff, 0x9f, 0x8c, 0x0e, 0xff, 0x1d, 0x13, 0x09, 0xff, 0x2e, 0x22, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2f, 0x23, 0x0b, 0xff, 0x2f, 0x24, 0x0b, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x30, 0x24, 0x0a, 0xff, 0x30, 0x25, 0x0a, 0xff, 0x31, 0x25, 0x0a, 0xff, 0x31, 0x25, 0x0a, 0xff, 0x31, 0x25, 0x0a, 0xff, 0x32, 0x25, 0x0a, 0xff, 0x32, 0x25, 0x0a, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x32, 0x26, 0x0b, 0xff, 0x32, 0x25, 0x0a, 0xff, 0x31, 0x25, 0x0a, 0xff, 0x31, 0x25, 0x0a, 0xff, 0x31, 0x25, 0x0a, 0xff, 0x30, 0x25, 0x0a, 0xff, 0x30, 0x24, 0x0a, 0xff, 0x30, 0x24, 0x0a, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x1e, 0x14, 0x0a, 0xff, 0xb0, 0x9d, 0x0f, 0xff, 0xb1, 0x9e, 0x0f, 0xff, 0xaf, 0x9c, 0x0f, 0xff, 0xae, 0x9b, 0x0e, 0xff, 0xae, 0x9a, 0x0e, 0xff, 0xad, 0x9a, 0x0d, 0xff, 0xac, 0x98, 0x0e, 0xff, 0xac, 0x98, 0x0d, 0xff, 0xab, 0x97, 0x0d, 0xff, 0xaa, 0x95, 0x0c, 0xff, 0xb0, 0x99, 0x10, 0xff, 0xb4, 0xa1, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x93, 0x0d, 0xff, 0xa8, 0x93, 0x0c, 0xff, 0xa9, 0x94, 0x0d, 0xff, 0xaa, 0x95, 0x0c, 0xff, 0xaa, 0x96, 0x0c, 0xff, 0xab, 0x97, 0x0d, 0xff, 0xac, 0x98, 0x0e, 0xff, 0xbc, 0xa8, 0x0e, 0xff, 0x35, 0x2a, 0x0a, 0xff, 0x28, 0x1e, 0x09, 0xff, 0x2c, 0x22, 0x09, 0xff, 0x2d, 0x22, 0x09, 0xff, 0x2d, 0x22, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2f, 0x23, 0x0b, 0xff, 0x2f, 0x23, 0x0b, 0xff, 0x2f, 0x24, 0x0b, 0xff, 0x2f, 0x24, 0x0b, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x30, 0x24, 0x0b, 0xff, 0x2f, 0x24, 0x0b, 0xff, 0x2f, 0x24, 0x0b, 0xff, 0x2f, 0x24, 0x0b, 0xff, 0x2f, 0x23, 0x0b, 0xff, 0x2e, 0x23, 0x0b, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2c, 0x21, 0x0a, 0xff, 0x2b, 0x20, 0x09, 0xff, 0xbd, 0xa9, 0x0f, 0xff, 0xae, 0x9b, 0x0e, 0xff, 0xad, 0x9a, 0x0d, 0xff, 0xad, 0x99, 0x0d, 0xff, 0xac, 0x98, 0x0e, 0xff, 0xab, 0x97, 0x0d, 0xff, 0xab, 0x97, 0x0d, 0xff, 0xaa, 0x95, 0x0c, 0xff, 0xa9, 0x94, 0x0d, 0xff, 0xa8, 0x93, 0x0c, 0xff, 0xb3, 0x9d, 0x10, 0xff, 0xb4, 0xa1, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x8e, 0x0a, 0xff, 0xa7, 0x8f, 0x0c, 0xff, 0xa7, 0x92, 0x0b, 0xff, 0xa8, 0x93, 0x0c, 0xff, 0xa9, 0x94, 0x0c, 0xff, 0xa9, 0x95, 0x0d, 0xff, 0xaa, 0x96, 0x0c, 0xff, 0xaf, 0x9a, 0x0d, 0xff, 0x9b, 0x88, 0x0d, 0xff, 0x18, 0x0f, 0x09, 0xff, 0x2a, 0x20, 0x0a, 0xff, 0x2b, 0x21, 0x0a, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x22, 0x09, 0xff, 0x2d, 0x22, 0x09, 0xff, 0x2d, 0x22, 0x0a, 0xff, 0x2d, 0x22, 0x0a, 0xff, 0x2e, 0x22, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2e, 0x23, 0x0a, 0xff, 0x2d, 0x22, 0x0a, 0xff, 0x2d, 0x22, 0x0a, 0xff, 0x2d, 0x22, 0x09, 0xff, 0x2d, 0x22, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x20, 0x17, 0x09, 0xff, 0x6c, 0x5d, 0x0b, 0xff, 0xb5, 0xa1, 0x0e, 0xff, 0xac, 0x98, 0x0e, 0xff, 0xab, 0x98, 0x0d, 0xff, 0xab, 0x97, 0x0d, 0xff, 0xaa, 0x96, 0x0c, 0xff, 0xaa, 0x95, 0x0c, 0xff, 0xa9, 0x94, 0x0d, 0xff, 0xa8, 0x93, 0x0c, 0xff, 0xa7, 0x92, 0x0c, 0xff, 0xa7, 0x92, 0x0c, 0xff, 0xb5, 0xa0, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x8d, 0x0b, 0xff, 0xa3, 0x8f, 0x0b, 0xff, 0xa5, 0x90, 0x0b, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa7, 0x92, 0x0b, 0xff, 0xa8, 0x93, 0x0c, 0xff, 0xa8, 0x94, 0x0c, 0xff, 0xa9, 0x95, 0x0d, 0xff, 0xb4, 0x9f, 0x0d, 0xff, 0x7e, 0x6d, 0x0b, 0xff, 0x15, 0x0d, 0x08, 0xff, 0x27, 0x1d, 0x09, 0xff, 0x2a, 0x20, 0x09, 0xff, 0x2a, 0x20, 0x0a, 0xff, 0x2b, 0x20, 0x0a, 0xff, 0x2b, 0x20, 0x0a, 0xff, 0x2b, 0x21, 0x0a, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2c, 0x21, 0x09, 0xff, 0x2b, 0x21, 0x0a, 0xff, 0x2b, 0x20, 0x0a, 0xff, 0x2b, 0x20, 0x0a, 0xff, 0x23, 0x19, 0x09, 0xff, 0x32, 0x27, 0x0a, 0xff, 0xb9, 0xa4, 0x0e, 0xff, 0xac, 0x97, 0x0d, 0xff, 0xaa, 0x96, 0x0d, 0xff, 0xaa, 0x95, 0x0c, 0xff, 0xa9, 0x95, 0x0d, 0xff, 0xa8, 0x94, 0x0c, 0xff, 0xa8, 0x93, 0x0c, 0xff, 0xa7, 0x92, 0x0b, 0xff, 0xa6, 0x91, 0x0b, 0xff, 0xa7, 0x90, 0x0c, 0xff, 0xa7, 0x90, 0x0c, 0xff, 0xaa, 0x97, 0x0d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8f, 0x0b, 0xff, 0xa4, 0x8f, 0x0b, 0xff, 0xa5, 0x90, 0x0b, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa6, 0x91, 0x0b, 0xff, 0xa7, 0x92, 0x0c, 0xff, 0xa8, 0x93, 0x0c, 0xff, 0xb3, 0x9e, 0x0d, 0xff, 0x93, 0x80, 0x0c, 0xff, 0x26, 0x1c, 0x08, 0xff, 0x1b, 0x12, 0x08, 0xff, 0x22, 0x18, 0x08, 0xff, 0x24, 0x1b, 0x09, 0xff, 0x25, 0x1b, 0x09, 0xff, 0x25, 0x1b, 0x09, 0xff, 0x25, 0x1c, 0x09, 0xff, 0x26, 0x1c, 0x09, 0xff, 0x26, 0x1c, 0x0a, 0xff, 0x26, 0x1c, 0x09, 0xff, 0x26, 0x1c, 0x09, 0xff, 0x26, 0x1c, 0x09, 0xff, 0x26, 0x1c, 0x09, 0xff, 0x26, 0x1c, 0x09, 0xff, 0x26, 0x1c, 0x09, 0xff, 0x26, 0x1c, 0x09, 0xff, 0x26, 0x1c, 0x0a, 0xff, 0x26, 0x1c, 0x09, 0xff, 0x25, 0x1b, 0x09, 0xff, 0x23, 0x19, 0x09, 0xff, 0x19, 0x10, 0x08, 0xff, 0x3d, 0x32, 0x09, 0xff, 0xb2, 0x9d, 0x0d, 0xff, 0xac, 0x97, 0x0d, 0xff, 0xa9, 0x95, 0x0d, 0xff, 0xa9, 0x94, 0x0c, 0xff, 0xa8, 0x93, 0x0c, 0xff, 0xa7, 0x93, 0x0c, 0xff, 0xa7, 0x92, 0x0b, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa5, 0x90, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa6, 0x90, 0x0c, 0xff, 0xa5, 0x8f, 0x0f, 0xff, 0xa3, 0x8c, 0x0b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x8d, 0x0b, 0xff, 0xa3, 0x8e, 0x09, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8e, 0x0a, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa5, 0x90, 0x0b, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa7, 0x92, 0x0b, 0xff, 0xac, 0x96, 0x0c, 0xff, 0xb8, 0xa1, 0x0c, 0xff, 0x84, 0x73, 0x0b, 0xff, 0x55, 0x48, 0x0a, 0xff, 0x44, 0x38, 0x09, 0xff, 0x40, 0x35, 0x09, 0xff, 0x41, 0x35, 0x09, 0xff, 0x41, 0x35, 0x09, 0xff, 0x42, 0x36, 0x09, 0xff, 0x42, 0x36, 0x09, 0xff, 0x42, 0x36, 0x09, 0xff, 0x42, 0x36, 0x09, 0xff, 0x42, 0x36, 0x09, 0xff, 0x42, 0x36, 0x09, 0xff, 0x42, 0x36, 0x09, 0xff, 0x42, 0x36, 0x09, 0xff, 0x42, 0x36, 0x09, 0xff, 0x42, 0x36, 0x09, 0xff, 0x41, 0x35, 0x09, 0xff, 0x41, 0x36, 0x09, 0xff, 0x56, 0x48, 0x0a, 0xff, 0x8c, 0x7a, 0x0c, 0xff, 0xb9, 0xa3, 0x0d, 0xff, 0xaa, 0x95, 0x0c, 0xff, 0xa8, 0x93, 0x0c, 0xff, 0xa7, 0x92, 0x0c, 0xff, 0xa7, 0x92, 0x0b, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa6, 0x90, 0x0c, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa4, 0x8f, 0x0b, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa4, 0x8e, 0x0b, 0xff, 0xa3, 0x8c, 0x0b, 0xff, 0xa1, 0x8b, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x8e, 0x0a, 0xff, 0xa3, 0x8e, 0x0a, 0xff, 0xa2, 0x8b, 0x0a, 0xff, 0xa2, 0x8c, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa4, 0x8f, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa5, 0x90, 0x0b, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xab, 0x96, 0x0c, 0xff, 0xb0, 0x9a, 0x0c, 0xff, 0xb3, 0x9d, 0x0c, 0xff, 0xb3, 0x9d, 0x0c, 0xff, 0xb4, 0x9e, 0x0c, 0xff, 0xb4, 0x9e, 0x0c, 0xff, 0xb4, 0x9f, 0x0c, 0xff, 0xb4, 0x9f, 0x0d, 0xff, 0xb4, 0x9f, 0x0d, 0xff, 0xb5, 0x9f, 0x0d, 0xff, 0xb5, 0x9f, 0x0d, 0xff, 0xb5, 0x9f, 0x0d, 0xff, 0xb5, 0x9f, 0x0d, 0xff, 0xb4, 0x9f, 0x0d, 0xff, 0xb4, 0x9f, 0x0d, 0xff, 0xb4, 0x9e, 0x0d, 0xff, 0xb4, 0x9e, 0x0c, 0xff, 0xb4, 0x9e, 0x0c, 0xff, 0xb1, 0x9b, 0x0c, 0xff, 0xac, 0x96, 0x0c, 0xff, 0xa7, 0x92, 0x0b, 0xff, 0xa6, 0x91, 0x0b, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa5, 0x90, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa4, 0x8f, 0x0b, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8c, 0x0b, 0xff, 0xa3, 0x8c, 0x0b, 0xff, 0xa2, 0x8c, 0x0b, 0xff, 0xa3, 0x8c, 0x0a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x8d, 0x0b, 0xff, 0x9d, 0x88, 0x08, 0xff, 0xa2, 0x8a, 0x0a, 0xff, 0xa1, 0x8a, 0x09, 0xff, 0xa1, 0x8b, 0x0a, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa3, 0x8c, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa4, 0x8f, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa5, 0x90, 0x0b, 0xff, 0xa5, 0x90, 0x0b, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa6, 0x91, 0x0b, 0xff, 0xa7, 0x91, 0x0b, 0xff, 0xa7, 0x92, 0x0b, 0xff, 0xa7, 0x92, 0x0b, 0xff, 0xa7, 0x91, 0x0b, 0xff, 0xa7, 0x92, 0x0b, 0xff, 0xa7, 0x91, 0x0b, 0xff, 0xa6, 0x91, 0x0b, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa6, 0x91, 0x0c, 0xff, 0xa6, 0x90, 0x0c, 0xff, 0xa6, 0x90, 0x0c, 0xff, 0xa5, 0x90, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa4, 0x8e, 0x0b, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa1, 0x8b, 0x0a, 0xff, 0xa2, 0x8c, 0x0b, 0xff, 0xa3, 0x8c, 0x0a, 0xff, 0x9b, 0x88, 0x08, 0xff, 0x9c, 0x88, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x8c, 0x0b, 0xff, 0xa2, 0x8c, 0x0b, 0xff, 0x9f, 0x88, 0x09, 0xff, 0xa0, 0x89, 0x0a, 0xff, 0xa0, 0x89, 0x0a, 0xff, 0xa1, 0x8a, 0x09, 0xff, 0xa1, 0x8b, 0x0a, 0xff, 0xa2, 0x8b, 0x0a, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8d, 0x0a, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa4, 0x8e, 0x0b, 0xff, 0xa4, 0x8f, 0x0b, 0xff, 0xa4, 0x8f, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa5, 0x8f, 0x0b, 0xff, 0xa4, 0x8f, 0x0b, 0xff, 0xa4, 0x8f, 0x0b, 0xff, 0xa4, 0x8e, 0x0b, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa4, 0x8e, 0x0a, 0xff, 0xa3, 0x8d, 0x0a, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa1, 0x8b, 0x0a, 0xff, 0xa1, 0x8a, 0x09, 0xff, 0xa0, 0x8a, 0x09, 0xff, 0xa0, 0x8a, 0x0a, 0xff, 0xa0, 0x8b, 0x0a, 0xff, 0xa2, 0x8c, 0x0b, 0xff, 0xa3, 0x8c, 0x0b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x8a, 0x0a, 0xff, 0xa2, 0x8b, 0x0b, 0xff, 0x9e, 0x86, 0x08, 0xff, 0x9e, 0x87, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x0a, 0xff, 0xa0, 0x89, 0x0a, 0xff, 0xa0, 0x8a, 0x09, 0xff, 0xa1, 0x8a, 0x09, 0xff, 0xa1, 0x8b, 0x0a, 0xff, 0xa1, 0x8b, 0x0a, 0xff, 0xa2, 0x8b, 0x0a, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa3, 0x8c, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8d, 0x0b, 0xff, 0xa3, 0x8c, 0x0a, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa2, 0x8c, 0x0a, 0xff, 0xa2, 0x8b, 0x0a, 0xff, 0xa1, 0x8b, 0x0a, 0xff, 0xa1, 0x8a, 0x09, 0xff, 0xa0, 0x8a, 0x09, 0xff, 0xa0, 0x89, 0x0a, 0xff, 0xa0, 0x89, 0x0a, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9e, 0x87, 0x09, 0xff, 0x9b, 0x84, 0x07, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9a, 0x86, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x8e, 0x0a, 0xff, 0x9e, 0x83, 0x07, 0xff, 0x9d, 0x85, 0x09, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9e, 0x86, 0x08, 0xff, 0x9e, 0x87, 0x09, 0xff, 0x9e, 0x87, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0xa0, 0x89, 0x0a, 0xff, 0xa0, 0x89, 0x0a, 0xff, 0xa0, 0x89, 0x0a, 0xff, 0xa0, 0x8a, 0x09, 0xff, 0xa1, 0x8a, 0x09, 0xff, 0xa1, 0x8a, 0x09, 0xff, 0xa1, 0x8a, 0x0a, 0xff, 0xa1, 0x8a, 0x0a, 0xff, 0xa1, 0x8a, 0x09, 0xff, 0xa1, 0x8b, 0x0a, 0xff, 0xa1, 0x8a, 0x0a, 0xff, 0xa1, 0x8a, 0x0a, 0xff, 0xa1, 0x8a, 0x09, 0xff, 0xa1, 0x8a, 0x09, 0xff, 0xa0, 0x8a, 0x09, 0xff, 0xa0, 0x8a, 0x09, 0xff, 0xa0, 0x89, 0x0a, 0xff, 0xa0, 0x89, 0x0a, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x87, 0x09, 0xff, 0x9e, 0x87, 0x09, 0xff, 0x9e, 0x86, 0x08, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9a, 0x81, 0x07, 0xff, 0x9a, 0x81, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x7f, 0x06, 0xff, 0x9c, 0x82, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9c, 0x84, 0x08, 0xff, 0x9c, 0x85, 0x08, 0xff, 0x9d, 0x85, 0x09, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9e, 0x86, 0x08, 0xff, 0x9e, 0x87, 0x09, 0xff, 0x9e, 0x87, 0x09, 0xff, 0x9f, 0x87, 0x09, 0xff, 0x9f, 0x87, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9f, 0x88, 0x09, 0xff, 0x9e, 0x87, 0x09, 0xff, 0x9e, 0x87, 0x09, 0xff, 0x9e, 0x87, 0x08, 0xff, 0x9e, 0x86, 0x08, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9d, 0x85, 0x09, 0xff, 0x9c, 0x85, 0x09, 0xff, 0x9c, 0x84, 0x08, 0xff, 0x9b, 0x82, 0x07, 0xff, 0x9a, 0x81, 0x07, 0xff, 0x9a, 0x82, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x7f, 0x07, 0xff, 0x9b, 0x81, 0x07, 0xff, 0x9a, 0x82, 0x08, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x84, 0x08, 0xff, 0x9c, 0x84, 0x08, 0xff, 0x9c, 0x85, 0x08, 0xff, 0x9c, 0x85, 0x09, 0xff, 0x9d, 0x85, 0x09, 0xff, 0x9d, 0x85, 0x09, 0xff, 0x9d, 0x86, 0x09, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9d, 0x86, 0x08, 0xff, 0x9d, 0x85, 0x09, 0xff, 0x9d, 0x85, 0x09, 0xff, 0x9d, 0x85, 0x09, 0xff, 0x9c, 0x85, 0x09, 0xff, 0x9c, 0x84, 0x09, 0xff, 0x9c, 0x84, 0x08, 0xff, 0x9c, 0x84, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x7c, 0x06, 0xff, 0x9c, 0x81, 0x06, 0xff, 0x9b, 0x82, 0x07, 0xff, 0x99, 0x80, 0x07, 0xff, 0x99, 0x81, 0x08, 0xff, 0x9a, 0x81, 0x08, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9b, 0x82, 0x07, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x84, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x83, 0x08, 0xff, 0x9b, 0x82, 0x07, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9a, 0x81, 0x08, 0xff, 0x99, 0x81, 0x08, 0xff, 0x99, 0x81, 0x08, 0xff, 0x99, 0x80, 0x07, 0xff, 0x9a, 0x82, 0x07, 0xff, 0x9a, 0x83, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x7f, 0x07, 0xff, 0x9b, 0x80, 0x06, 0xff, 0x9b, 0x80, 0x07, 0xff, 0x98, 0x7f, 0x06, 0xff, 0x98, 0x7f, 0x07, 0xff, 0x98, 0x7f, 0x07, 0xff, 0x98, 0x80, 0x07, 0xff, 0x99, 0x80, 0x07, 0xff, 0x99, 0x80, 0x07, 0xff, 0x99, 0x81, 0x07, 0xff, 0x99, 0x81, 0x08, 0xff, 0x99, 0x81, 0x08, 0xff, 0x99, 0x81, 0x08, 0xff, 0x99, 0x81, 0x08, 0xff, 0x99, 0x81, 0x08, 0xff, 0x99, 0x81, 0x08, 0xff, 0x99, 0x81, 0x08, 0xff, 0x99, 0x81, 0x08, 0xff, 0x99, 0x81, 0x07, 0xff, 0x99, 0x80, 0x07, 0xff, 0x99, 0x80, 0x07, 0xff, 0x98, 0x80, 0x07, 0xff, 0x98, 0x80, 0x07, 0xff, 0x98, 0x7f, 0x07, 0xff, 0x97, 0x7e, 0x06, 0xff, 0x97, 0x7e, 0x07, 0xff, 0x9b, 0x82, 0x07, 0xff, 0x9d, 0x82, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x7f, 0x06, 0xff, 0x9d, 0x81, 0x06, 0xff, 0x9c, 0x81, 0x06, 0xff, 0x9b, 0x7f, 0x07, 0xff, 0x97, 0x7d, 0x07, 0xff, 0x97, 0x7e, 0x06, 0xff, 0x97, 0x7e, 0x06, 0xff, 0x97, 0x7e, 0x06, 0xff, 0x97, 0x7e, 0x06, 0xff, 0x97, 0x7f, 0x06, 0xff, 0x97, 0x7e, 0x07, 0xff, 0x98, 0x7f, 0x07, 0xff, 0x98, 0x7f, 0x07, 0xff, 0x98, 0x7f, 0x07, 0xff, 0x97, 0x7f, 0x07, 0xff, 0x97, 0x7e, 0x06, 0xff, 0x97, 0x7e, 0x06, 0xff, 0x97, 0x7e, 0x06, 0xff, 0x97, 0x7e, 0x06, 0xff, 0x97, 0x7e, 0x07, 0xff, 0x97, 0x7e, 0x07, 0xff, 0x97, 0x7c, 0x06, 0xff, 0x97, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x7f, 0x06, 0xff, 0x9b, 0x7f, 0x06, 0xff, 0x97, 0x7d, 0x06, 0xff, 0x95, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x97, 0x7f, 0x06, 0xff, 0x9a, 0x7e, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x95, 0x7c, 0x06, 0xff, 0x97, 0x7d, 0x06, 0xff, 0x97, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x97, 0x7d, 0x06, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x7f, 0x06, 0xff, 0x9b, 0x7f, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x97, 0x7e, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x95, 0x7c, 0x06, 0xff, 0x97, 0x7c, 0x06, 0xff, 0x95, 0x7c, 0x06, 0xff, 0x95, 0x7c, 0x06, 0xff, 0x97, 0x7d, 0x07, 0xff, 0x97, 0x7d, 0x06, 0xff, 0x97, 0x7c, 0x06, 0xff, 0x97, 0x7c, 0x06, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x7e, 0x06, 0xff, 0x98, 0x7f, 0x06, 0xff, 0x97, 0x7d, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x95, 0x7c, 0x06, 0xff, 0x96, 0x7c, 0x06, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t weather = {
-  .header.always_zero = 0,
-  .header.w = 50,
-  .header.h = 50,
-  .data_size = 2500 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = weather_map,
-};
-
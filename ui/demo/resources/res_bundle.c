@@ -0,0 +1,112 @@
+/**
+ ****************************************************************************************
+ *
+ * @file res_bundle.c
+ *
+ * @brief Resource bundle checks, shared by the firmware and the host packer
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#include "res_bundle.h"
+
+/*
+ *       Static data
+ *****************************************************************************************
+ */
+/* One entry per nibble: 64 bytes instead of the 1 KB of a byte table, the check is only run at start-up */
+static const uint32_t crc32_nibble[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+/*
+ *       Static code
+ *****************************************************************************************
+ */
+static res_bundle_err_t check_entry(const res_bundle_header_t *bundle, const res_bundle_entry_t *e,
+        bool check_data)
+{
+        uint32_t data_start = sizeof(res_bundle_header_t) + bundle->count * sizeof(res_bundle_entry_t);
+
+        if (e->offset % RES_BUNDLE_ALIGN || e->offset < data_start || e->offset > bundle->size ||
+                        e->size > bundle->size - e->offset || !e->w || !e->h) {
+                return RES_BUNDLE_ERR_ENTRY;
+        }
+
+        switch (e->comp) {
+        case RES_BUNDLE_COMP_NONE:
+                if (!e->stride || (uint32_t)e->stride * e->h != e->size) {
+                        return RES_BUNDLE_ERR_ENTRY;
+                }
+                break;
+        case RES_BUNDLE_COMP_RLE:
+                if (e->stride || !e->size) {
+                        return RES_BUNDLE_ERR_ENTRY;
+                }
+                break;
+        default:
+                return RES_BUNDLE_ERR_ENTRY;
+        }
+
+        if (check_data && res_bundle_crc32(0, (const uint8_t *)bundle + e->offset, e->size) != e->crc) {
+                return RES_BUNDLE_ERR_DATA;
+        }
+
+        return RES_BUNDLE_OK;
+}
+
+/*
+ *       Public code
+ *****************************************************************************************
+ */
+uint32_t res_bundle_crc32(uint32_t crc, const void *data, size_t size)
+{
+        const uint8_t *p = data;
+
+        crc = ~crc;
+        while (size--) {
+                crc ^= *p++;
+                crc = (crc >> 4) ^ crc32_nibble[crc & 0xF];
+                crc = (crc >> 4) ^ crc32_nibble[crc & 0xF];
+        }
+
+        return ~crc;
+}
+
+res_bundle_err_t res_bundle_check(const res_bundle_header_t *bundle, size_t area_size, bool check_data)
+{
+        const res_bundle_entry_t *index = res_bundle_index(bundle);
+        size_t index_size;
+
+        if (area_size < sizeof(*bundle)) {
+                return RES_BUNDLE_ERR_SIZE;
+        }
+        if (bundle->magic != RES_BUNDLE_MAGIC) {
+                return RES_BUNDLE_ERR_MAGIC;
+        }
+        if (bundle->version != RES_BUNDLE_VERSION) {
+                return RES_BUNDLE_ERR_VERSION;
+        }
+
+        index_size = bundle->count * sizeof(res_bundle_entry_t);
+        if (bundle->size > area_size || bundle->size < sizeof(*bundle) + index_size) {
+                return RES_BUNDLE_ERR_SIZE;
+        }
+        if (res_bundle_crc32(0, index, index_size) != bundle->index_crc) {
+                return RES_BUNDLE_ERR_INDEX;
+        }
+
+        for (int i = 0; i < bundle->count; i++) {
+                res_bundle_err_t err = check_entry(bundle, &index[i], check_data);
+
+                if (err != RES_BUNDLE_OK) {
+                        return err;
+                }
+        }
+
+        return RES_BUNDLE_OK;
+}
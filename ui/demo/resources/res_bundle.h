@@ -0,0 +1,108 @@
+/**
+ ****************************************************************************************
+ *
+ * @file res_bundle.h
+ *
+ * @brief Resource bundle format
+ *
+ * A bundle is a header, an index with one entry per image and the pixels of the images, each
+ * aligned to RES_BUNDLE_ALIGN bytes. It is written by the host packer (simulator/tools/res_pack.c)
+ * and read in place from the flash by Resources.c: the image descriptors point to the pixels of
+ * the bundle, which the GPU and LVGL read without copying them.
+ *
+ * The images are found by their index in the manifest of the packer, the ID generated in
+ * WatchDemoColoredResources.h. All the fields are little endian.
+ *
+ * Copyright (C) 2022 Dialog Semiconductor.
+ * This computer program includes Confidential, Proprietary Information
+ * of Dialog Semiconductor. All Rights Reserved.
+ *
+ ****************************************************************************************
+ */
+#ifndef RES_BUNDLE_H__
+#define RES_BUNDLE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ *       Defines
+ *****************************************************************************************
+ */
+#define RES_BUNDLE_MAGIC                (0x53455244)    /* "DRES" */
+#define RES_BUNDLE_VERSION              (1)
+
+/* Alignment of the pixels of each image, in bytes */
+#define RES_BUNDLE_ALIGN                (16)
+
+/* Header flags. The pixels of the 1, 2 and 4 bpp images are stored first pixel in the low bits
+ * (D/AVE2D order, read directly by the GPU), or first pixel in the high bits with this flag
+ * (LVGL order, for the builds with DLG_LVGL_CF_SUB_BYTE_SWAP) */
+#define RES_BUNDLE_FLAG_MSB_FIRST       (1 << 0)
+
+/*
+ *       Types
+ *****************************************************************************************
+ */
+typedef enum {
+        RES_BUNDLE_COMP_NONE = 0,
+        RES_BUNDLE_COMP_RLE = 1,        /* D/AVE2D RLE, the packets never cross a row */
+} res_bundle_comp_t;
+
+typedef enum {
+        RES_BUNDLE_OK = 0,
+        RES_BUNDLE_ERR_MAGIC,           /* Not a bundle, e.g. an old resources binary */
+        RES_BUNDLE_ERR_VERSION,
+        RES_BUNDLE_ERR_SIZE,            /* Larger than the area it was found in */
+        RES_BUNDLE_ERR_INDEX,           /* Corrupted index */
+        RES_BUNDLE_ERR_ENTRY,           /* Image out of the bundle or inconsistent with its size */
+        RES_BUNDLE_ERR_DATA,            /* Corrupted pixels */
+} res_bundle_err_t;
+
+typedef struct {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t count;                 /* Of index entries */
+        uint32_t size;                  /* Of the whole bundle, in bytes */
+        uint32_t ids_crc;               /* CRC32 of the image names, in ID order */
+        uint32_t index_crc;             /* CRC32 of the index */
+        uint32_t flags;                 /* RES_BUNDLE_FLAG_... */
+        uint32_t reserved[2];
+} res_bundle_header_t;
+
+typedef struct {
+        uint32_t offset;                /* Of the pixels, from the start of the bundle */
+        uint32_t size;                  /* Of the pixels, in bytes */
+        uint32_t crc;                   /* CRC32 of the pixels */
+        uint16_t w;
+        uint16_t h;
+        uint16_t stride;                /* Bytes per row, 0 if compressed */
+        uint8_t cf;                     /* lv_img_cf_t */
+        uint8_t comp;                   /* res_bundle_comp_t */
+} res_bundle_entry_t;
+
+/*
+ *       Public functions
+ *****************************************************************************************
+ */
+/**
+ * CRC32 (IEEE 802.3) of a buffer, continuing from crc (0 for the first buffer)
+ */
+uint32_t res_bundle_crc32(uint32_t crc, const void *data, size_t size);
+
+/**
+ * Index of a bundle, entry i is the image of ID i
+ */
+static inline const res_bundle_entry_t *res_bundle_index(const res_bundle_header_t *bundle)
+{
+        return (const res_bundle_entry_t *)(bundle + 1);
+}
+
+/**
+ * Check the header and the index of a bundle found in an area of area_size bytes, and with
+ * check_data the CRC of every image. The bundle must be 4 bytes aligned.
+ */
+res_bundle_err_t res_bundle_check(const res_bundle_header_t *bundle, size_t area_size, bool check_data);
+
+#endif /* RES_BUNDLE_H__ */
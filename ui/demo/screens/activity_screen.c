@@ -18,6 +18,8 @@
  */
 #include <stdio.h>
 #include "Resources.h"
+#include "lv_port_disp.h"
+#include "demo.h"
 
 /*
  *      DEFINES
@@ -42,7 +44,6 @@ static lv_obj_t *prev_active;
  *      MACROS
  *****************************************************************************************
  */
-LV_IMG_DECLARE(track);
 
 /*
  *   GLOBAL FUNCTIONS
@@ -91,7 +92,7 @@ static void show_activity_screen()
         lv_obj_set_pos(activity_label, 71, 119);
 
         track_obj = lv_img_create(activity_screen_obj);
-        lv_img_set_src(track_obj, &track);
+        lv_img_set_src(track_obj, RES_IMG(RES_ID_TRACK));
         lv_obj_set_pos(track_obj, 72, 143);
 
         duration_label = lv_label_create(activity_screen_obj);
@@ -136,16 +137,16 @@ static void show_activity_screen()
         lv_label_set_text(consumption_label, "#ffffff Consumption\n#ffffff       260 kcal");
         lv_obj_set_pos(consumption_label, 135, 1130);
 
-        lv_scr_load(activity_screen_obj);
+        lv_port_disp_scr_load(activity_screen_obj, LV_PORT_DISP_TRANS_ZOOM, LV_DIR_NONE, SCREEN_TRANSITION_TIME,
+                false);
 }
 
 static void gesture_event_cb(lv_event_t *e)
 {
         lv_dir_t dir = lv_indev_get_gesture_dir(lv_indev_get_act());
-        lv_obj_t *screen_obj = lv_event_get_user_data(e);
 
         if (dir == LV_DIR_RIGHT) {
-                lv_scr_load(prev_active);
-                lv_obj_del(screen_obj);
+                lv_port_disp_scr_load(prev_active, LV_PORT_DISP_TRANS_UNCOVER, LV_DIR_LEFT, SCREEN_TRANSITION_TIME,
+                        true);
         }
 }
@@ -18,6 +18,8 @@
  */
 #include <stdio.h>
 #include "Resources.h"
+#include "lv_port_disp.h"
+#include "demo.h"
 
 extern void start_compass_data();
 extern void stop_compass_data();
@@ -42,9 +44,7 @@ static lv_obj_t *compass_obj, *compass_txt, *prev_active;
  *      MACROS
  *****************************************************************************************
  */
-LV_IMG_DECLARE(compass);
-LV_IMG_DECLARE(compass_earth);
-LV_IMG_DECLARE(compass_index);
+#define COMPASS_IMG             RES_IMG(RES_ID_COMPASS)
 
 /*
  *   GLOBAL FUNCTIONS
@@ -61,33 +61,33 @@ void show_compass_cb(lv_event_t *e)
 
 void compass_rotate(int16_t angle)
 {
-        uint8_t text[17];
+        uint8_t text[24];
 
         if (!compass_obj || !compass_txt) {
                 return;
         }
 
         /* Set the rotation center of the image. */
-        lv_img_set_pivot(compass_obj, compass.header.w / 2, compass.header.h / 2);
+        lv_img_set_pivot(compass_obj, COMPASS_IMG->header.w / 2, COMPASS_IMG->header.h / 2);
 
         /* Angle has 0.1 degree precision, so for 45.8 set 458. */
         lv_img_set_angle(compass_obj, (360 - angle) * 10);
         if ((angle < 45) || (angle == 360)) {
-                sprintf((char*)text, "%s %d", "#FF4500 N ", (angle == 360) ? 0 : angle);
+                snprintf((char*)text, sizeof(text), "%s %d", "#FF4500 N ", (angle == 360) ? 0 : angle);
         } else if ((angle >= 45) && (angle < 90)) {
-                sprintf((char*)text, "%s %d", "#FF4500 NE ", angle);
+                snprintf((char*)text, sizeof(text), "%s %d", "#FF4500 NE ", angle);
         } else if ((angle >= 90) && (angle < 135)) {
-                sprintf((char*)text, "%s %d", "#FF4500 E ", angle - 90);
+                snprintf((char*)text, sizeof(text), "%s %d", "#FF4500 E ", angle - 90);
         } else if ((angle >= 135) && (angle < 180)) {
-                sprintf((char*)text, "%s %d", "#FF4500 SE ", angle - 90);
+                snprintf((char*)text, sizeof(text), "%s %d", "#FF4500 SE ", angle - 90);
         } else if ((angle >= 180) && (angle < 225)) {
-                sprintf((char*)text, "%s %d", "#FF4500 S ", angle - 180);
+                snprintf((char*)text, sizeof(text), "%s %d", "#FF4500 S ", angle - 180);
         } else if ((angle >= 225) && (angle < 270)) {
-                sprintf((char*)text, "%s %d", "#FF4500 SW ", angle - 180);
+                snprintf((char*)text, sizeof(text), "%s %d", "#FF4500 SW ", angle - 180);
         } else if ((angle >= 270) && (angle < 315)) {
-                sprintf((char*)text, "%s %d", "#FF4500 W ", angle - 270);
+                snprintf((char*)text, sizeof(text), "%s %d", "#FF4500 W ", angle - 270);
         } else if ((angle >= 315) && (angle < 360)) {
-                sprintf((char*)text, "%s %d", "#FF4500 NW ", angle - 270);
+                snprintf((char*)text, sizeof(text), "%s %d", "#FF4500 NW ", angle - 270);
         }
         lv_label_set_text(compass_txt, (char*)text);
 }
@@ -111,23 +111,23 @@ static void show_compass_screen()
 
         /* Create the required objects for the compass */
 #if COMPASS_ROTATION_USES_CANVAS
-        lv_color_t *cbuf = lv_mem_alloc(lv_img_buf_get_img_size(compass.header.w, compass.header.h, compass.header.cf));
+        lv_color_t *cbuf = lv_mem_alloc(lv_img_buf_get_img_size(COMPASS_IMG->header.w, COMPASS_IMG->header.h, COMPASS_IMG->header.cf));
         compass_obj = lv_canvas_create(compass_screen_obj);
 
-        lv_canvas_set_buffer(compass_obj, cbuf, compass.header.w, compass.header.h, compass.header.cf);
+        lv_canvas_set_buffer(compass_obj, cbuf, COMPASS_IMG->header.w, COMPASS_IMG->header.h, COMPASS_IMG->header.cf);
         lv_obj_add_event_cb(compass_obj, compass_delete_event_cb, LV_EVENT_DELETE, compass_obj);
 
         lv_draw_img_dsc_t img_dsc;
         lv_draw_img_dsc_init(&img_dsc);
-        lv_canvas_draw_img(compass_obj, 0, 0, &compass, &img_dsc);
+        lv_canvas_draw_img(compass_obj, 0, 0, COMPASS_IMG, &img_dsc);
 #else
         compass_obj = lv_img_create(compass_screen_obj);
-        lv_img_set_src(compass_obj, &compass);
+        lv_img_set_src(compass_obj, COMPASS_IMG);
 #endif
         lv_obj_align(compass_obj, LV_ALIGN_CENTER, 0, 0);
 
         compass_earth_obj = lv_img_create(compass_screen_obj);
-        lv_img_set_src(compass_earth_obj, &compass_earth);
+        lv_img_set_src(compass_earth_obj, RES_IMG(RES_ID_COMPASS_EARTH));
         lv_obj_align(compass_earth_obj, LV_ALIGN_CENTER, 0, 0);
         compass_txt = lv_label_create(compass_screen_obj);
         lv_label_set_recolor(compass_txt, true);
@@ -136,10 +136,11 @@ static void show_compass_screen()
         lv_obj_align(compass_txt, LV_ALIGN_CENTER, 0, 0);
 
         compass_index_obj = lv_img_create(compass_screen_obj);
-        lv_img_set_src(compass_index_obj, &compass_index);
-        lv_obj_set_pos(compass_index_obj, (DEMO_RESX - compass_index.header.w) / 2, 0);
+        lv_img_set_src(compass_index_obj, RES_IMG(RES_ID_COMPASS_INDEX));
+        lv_obj_set_pos(compass_index_obj, (DEMO_RESX - RES_IMG(RES_ID_COMPASS_INDEX)->header.w) / 2, 0);
 
-        lv_scr_load(compass_screen_obj);
+        lv_port_disp_scr_load(compass_screen_obj, LV_PORT_DISP_TRANS_ZOOM, LV_DIR_NONE, SCREEN_TRANSITION_TIME,
+                false);
 
         start_compass_data();
 }
@@ -157,11 +158,10 @@ static void compass_delete_event_cb(lv_event_t *e)
 static void gesture_event_cb(lv_event_t *e)
 {
         lv_dir_t dir = lv_indev_get_gesture_dir(lv_indev_get_act());
-        lv_obj_t *screen_obj = lv_event_get_user_data(e);
 
         if (dir == LV_DIR_RIGHT) {
                 stop_compass_data();
-                lv_scr_load(prev_active);
-                lv_obj_del(screen_obj);
+                lv_port_disp_scr_load(prev_active, LV_PORT_DISP_TRANS_UNCOVER, LV_DIR_LEFT, SCREEN_TRANSITION_TIME,
+                        true);
         }
 }
@@ -55,13 +55,6 @@ typedef struct
  *      MACROS
  *****************************************************************************************
  */
-LV_IMG_DECLARE(timer);
-LV_IMG_DECLARE(activity);
-LV_IMG_DECLARE(compass_menu_icon);
-LV_IMG_DECLARE(heart_rate);
-LV_IMG_DECLARE(messages);
-LV_IMG_DECLARE(sleep_monitor);
-LV_IMG_DECLARE(weather);
 
 /*
  *  STATIC PROTOTYPES
@@ -81,13 +74,13 @@ static void create_item_text(lv_obj_t *title_obj, const lv_img_dsc_t item_img, l
  */
 static const ITEM item_list[] =
 {
-        { &timer,              "Timer",       show_timer_cb },
-        { &activity,           "Activity",    show_activity_cb },
-        { &compass_menu_icon,  "Compass",     show_compass_cb },
-        { &heart_rate,         "Heart Rate",  NULL },
-        { &messages,           "Messages",    NULL },
-        { &sleep_monitor,      "Sleep",       NULL },
-        { &weather,            "Weather",     NULL }
+        { RES_IMG(RES_ID_TIMER),          "Timer",       show_timer_cb },
+        { RES_IMG(RES_ID_ACTIVITY),       "Activity",    show_activity_cb },
+        { RES_IMG(RES_ID_COMPASS_MENU),   "Compass",     show_compass_cb },
+        { RES_IMG(RES_ID_HEART_RATE),     "Heart Rate",  NULL },
+        { RES_IMG(RES_ID_MESSAGES),       "Messages",    NULL },
+        { RES_IMG(RES_ID_SLEEP_MONITOR),  "Sleep",       NULL },
+        { RES_IMG(RES_ID_WEATHER),        "Weather",     NULL }
 };
 
 /*
@@ -141,7 +134,7 @@ void menu_list_screen(lv_obj_t *parent_obj, lv_style_t *style_screen, lv_coord_t
                 img_obj = lv_img_create(cell_obj);
                 lv_img_set_src(img_obj, item_list[i].src);
                 sprintf((char*)text, "#ffffff %s", item_list[i].pText);
-                create_cell(cell_obj, img_obj, timer, (char*)text, item_x, item_y);
+                create_cell(cell_obj, img_obj, *RES_IMG(RES_ID_TIMER), (char*)text, item_x, item_y);
                 if (item_list[i].event_cb != NULL) {
                         lv_obj_add_event_cb(cell_obj, item_list[i].event_cb, LV_EVENT_CLICKED, NULL);
                         lv_obj_add_flag(cell_obj, LV_OBJ_FLAG_CLICKABLE);
@@ -18,6 +18,8 @@
  */
 #include <stdio.h>
 #include "Resources.h"
+#include "lv_port_disp.h"
+#include "demo.h"
 /*
  *  STATIC PROTOTYPES
  *****************************************************************************************
@@ -41,8 +43,6 @@ static uint32_t start_time, total_elapsed_time;
  *      MACROS
  *****************************************************************************************
  */
-LV_IMG_DECLARE(timer);
-LV_IMG_DECLARE(reset_timer);
 
 /*
  *   GLOBAL FUNCTIONS
@@ -92,7 +92,7 @@ static void show_timer_screen()
         lv_obj_add_flag(timer_area_obj, LV_OBJ_FLAG_CLICKABLE);
 
         show_timer_obj = lv_img_create(timer_area_obj);
-        lv_img_set_src(show_timer_obj, &timer);
+        lv_img_set_src(show_timer_obj, RES_IMG(RES_ID_TIMER));
         lv_obj_align(show_timer_obj, LV_ALIGN_CENTER, 0, 0);
 
         stopwatch_label = lv_label_create(timer_screen_obj);
@@ -108,23 +108,23 @@ static void show_timer_screen()
         lv_obj_add_flag(reset_area_obj, LV_OBJ_FLAG_CLICKABLE);
 
         reset_obj = lv_img_create(reset_area_obj);
-        lv_img_set_src(reset_obj, &reset_timer);
+        lv_img_set_src(reset_obj, RES_IMG(RES_ID_RESET_TIMER));
         lv_obj_align(reset_obj, LV_ALIGN_CENTER, 0, 0);
 
-        lv_scr_load(timer_screen_obj);
+        lv_port_disp_scr_load(timer_screen_obj, LV_PORT_DISP_TRANS_ZOOM, LV_DIR_NONE, SCREEN_TRANSITION_TIME,
+                false);
 }
 
 static void gesture_event_cb(lv_event_t *e)
 {
         lv_dir_t dir = lv_indev_get_gesture_dir(lv_indev_get_act());
-        lv_obj_t *screen_obj = lv_event_get_user_data(e);
 
         if (dir == LV_DIR_RIGHT) {
                 if (counter_timer && !counter_timer->paused) {
                         lv_timer_pause(counter_timer);
                 }
-                lv_scr_load(prev_active);
-                lv_obj_del(screen_obj);
+                lv_port_disp_scr_load(prev_active, LV_PORT_DISP_TRANS_UNCOVER, LV_DIR_LEFT, SCREEN_TRANSITION_TIME,
+                        true);
                 lv_timer_del(counter_timer);
         }
 }
@@ -18,6 +18,7 @@
  */
 #include "Resources.h"
 #include "module.h"
+#include "lv_port_disp.h"
 
 /*
  *      DEFINES
@@ -89,11 +90,6 @@ static RTC_TimeTypeDef current_time = { DEFAULT_TIME_HOUR, DEFAULT_TIME_MINUTES,
  *      MACROS
  *****************************************************************************************
  */
-LV_IMG_DECLARE(clock_bg);
-LV_IMG_DECLARE(stamens);
-LV_IMG_DECLARE(tick_hour);
-LV_IMG_DECLARE(tick_minute);
-LV_IMG_DECLARE(tick_second);
 
 /*
  *   GLOBAL FUNCTIONS
@@ -129,24 +125,39 @@ void watch_face_screen(lv_obj_t *parent_obj, lv_style_t *style_screen, lv_coord_
 
         /*Create the required objects for the watch*/
         clock_bg_obj = lv_img_create(watch_face_screen_obj);
-        lv_img_set_src(clock_bg_obj, &clock_bg);
+        lv_img_set_src(clock_bg_obj, RES_IMG(RES_ID_CLOCK_BG));
         lv_obj_align(clock_bg_obj, LV_ALIGN_CENTER, 0, 0);
+#if LV_PORT_DISP_RETAINED_BG
+        lv_obj_add_flag(clock_bg_obj, LV_PORT_DISP_FLAG_STATIC);
+#endif
 
         tick_hour_obj = lv_img_create(watch_face_screen_obj);
-        lv_img_set_src(tick_hour_obj, &tick_hour);
+        lv_img_set_src(tick_hour_obj, RES_IMG(RES_ID_HOUR));
 
         tick_minute_obj = lv_img_create(watch_face_screen_obj);
-        lv_img_set_src(tick_minute_obj, &tick_minute);
+        lv_img_set_src(tick_minute_obj, RES_IMG(RES_ID_MINUTE));
 
         tick_second_obj = lv_img_create(watch_face_screen_obj);
-        lv_img_set_src(tick_second_obj, &tick_second);
+        lv_img_set_src(tick_second_obj, RES_IMG(RES_ID_SECOND));
+
+#if DLG_LVGL_USE_IMG_CACHE
+        /* The needles are drawn every second whatever else is on the screen */
+        lv_img_cache_pin(RES_IMG(RES_ID_HOUR));
+        lv_img_cache_pin(RES_IMG(RES_ID_MINUTE));
+        lv_img_cache_pin(RES_IMG(RES_ID_SECOND));
+#endif
 
         stamens_obj = lv_img_create(watch_face_screen_obj);
-        lv_img_set_src(stamens_obj, &stamens);
+        lv_img_set_src(stamens_obj, RES_IMG(RES_ID_STAMENS));
         lv_obj_align(stamens_obj, LV_ALIGN_CENTER, 0, 0);
 
         lv_DrawClock();
 
+#if LV_PORT_DISP_RETAINED_BG
+        /* The stamens are in front of the needles, only the clock background is static */
+        lv_port_disp_retain_bg(watch_face_screen_obj);
+#endif
+
         /*Create a timer to update the displayed time*/
         update_time_timer = lv_timer_create(lv_UpdateTime, (uint32_t)(1000 / TIMER_DIVISOR), NULL);
         lv_timer_set_repeat_count(update_time_timer, -1);
@@ -249,17 +260,17 @@ static void lv_DrawClock()
 
         /* Draw the hour needle */
         if (angle_hour != angle_hour_prev) {
-                rotate_image(tick_hour_obj, angle_hour, &tick_hour);
+                rotate_image(tick_hour_obj, angle_hour, RES_IMG(RES_ID_HOUR));
         }
 
         /* Draw the minutes needle */
         if (angle_min != angle_min_prev) {
-                rotate_image(tick_minute_obj, angle_min, &tick_minute);
+                rotate_image(tick_minute_obj, angle_min, RES_IMG(RES_ID_MINUTE));
         }
 
         /* Draw the seconds needle */
         if (angle_sec != angle_sec_prev) {
-                rotate_image(tick_second_obj, angle_sec, &tick_second);
+                rotate_image(tick_second_obj, angle_sec, RES_IMG(RES_ID_SECOND));
         }
 
         angle_hour_prev = angle_hour;
@@ -269,7 +280,9 @@ static void lv_DrawClock()
 
 static void rotate_image(void *img_obj, int32_t angle, const lv_img_dsc_t *img_dsc)
 {
-        lv_obj_set_pos(img_obj, (clock_bg.header.w - img_dsc->header.w) / 2, (clock_bg.header.h / 2) - img_dsc->header.h);
+        const lv_img_dsc_t *bg_dsc = RES_IMG(RES_ID_CLOCK_BG);
+
+        lv_obj_set_pos(img_obj, (bg_dsc->header.w - img_dsc->header.w) / 2, (bg_dsc->header.h / 2) - img_dsc->header.h);
         /* Set the rotation center of the image. */
         lv_img_set_pivot(img_obj, img_dsc->header.w / 2, img_dsc->header.h);
         /* Angle has 0.1 degree precision, so for 45.8 set 458. */
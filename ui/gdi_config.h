@@ -71,6 +71,8 @@
 #include "boe139f454sm.h"
 #elif dg_configUSE_E120A390QSR
 #include "e120a390qsr.h"
+#elif dg_configUSE_SIM_DISPLAY
+#include "sim_display.h"
 #endif
 #if dg_configUSE_FT6206
 #include "ft6206.h"
@@ -75,6 +75,41 @@
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #define LV_MEMCPY_MEMSET_STD    0
 
+/* Temporal buffers of lv_mem_buf_get(): while an area is refreshed they are stacked in an arena of
+ * DLG_LVGL_MEM_BUF_ARENA_SIZE bytes outside the GUI heap, emptied at the end of the area. The other
+ * ones are kept on free lists of DLG_LVGL_MEM_BUF_CLASSES size classes (64 bytes doubling), at most
+ * DLG_LVGL_MEM_BUF_CLASS_KEEP released buffers per class. */
+#ifndef DLG_LVGL_USE_MEM_BUF_POOL
+#define DLG_LVGL_USE_MEM_BUF_POOL       1
+#endif
+#if DLG_LVGL_USE_MEM_BUF_POOL
+#  define DLG_LVGL_MEM_BUF_ARENA_SIZE   (4 * 1024)
+#  define DLG_LVGL_MEM_BUF_CLASSES      7
+#  define DLG_LVGL_MEM_BUF_CLASS_KEEP   4
+#endif
+
+/* Telemetry of the GUI heap: peak usage, smallest largest free block, fragmentation index and the
+ * maps of lv_mem_map_dump(), each used block tagged with the address of its caller if
+ * DLG_LVGL_MEM_TAG_SITES (one pointer more per block). */
+#ifndef DLG_LVGL_USE_MEM_TELEMETRY
+#define DLG_LVGL_USE_MEM_TELEMETRY      1
+#endif
+#if DLG_LVGL_USE_MEM_TELEMETRY
+#  ifndef DLG_LVGL_MEM_TAG_SITES
+#  define DLG_LVGL_MEM_TAG_SITES        0
+#  endif
+#endif
+
+/* Blocks of DLG_LVGL_MEM_LARGE_THRESHOLD bytes or more are allocated from a region of their own, so
+ * that they do not split the free space of the objects */
+#ifndef DLG_LVGL_USE_MEM_LARGE
+#define DLG_LVGL_USE_MEM_LARGE          COMPASS_ROTATION_USES_CANVAS
+#endif
+#if DLG_LVGL_USE_MEM_LARGE
+#  define DLG_LVGL_MEM_LARGE_SIZE       DEMO_GUI_LARGE_HEAP_SIZE
+#  define DLG_LVGL_MEM_LARGE_THRESHOLD  (4 * 1024)
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -85,6 +120,22 @@
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD    15      /*[ms]*/
 
+/* Keep in `refr_stat` of the display what joining the invalidated areas by pixel count would have
+ * flushed, next to the cost model of `refr_cost_cb`. Joins a copy of the areas once more per refresh. */
+#ifndef DLG_LVGL_USE_REFR_STAT
+#  ifdef PERFORMANCE_METRICS
+#  define DLG_LVGL_USE_REFR_STAT    1
+#  else
+#  define DLG_LVGL_USE_REFR_STAT    0
+#  endif
+#endif
+
+/* The running timers are kept in a binary min-heap ordered by their next run: lv_timer_handler()
+ * only looks at the timers that are due and returns the exact time until the next one. */
+#ifndef DLG_LVGL_USE_TIMER_HEAP
+#define DLG_LVGL_USE_TIMER_HEAP     1
+#endif
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #define LV_TICK_CUSTOM              1
@@ -121,12 +172,46 @@
 #define LV_CIRCLE_CACHE_SIZE 4
 #endif /*LV_DRAW_COMPLEX*/
 
+/* Vectorize the software blending that is left to the CPU (blend modes, opacity, A8 masks).
+ * The kernels are picked at compile time: DSP extension on the Cortex-M33, SSE2 or NEON on
+ * host builds. The output is identical to the scalar loops. */
+#ifndef DLG_LVGL_USE_BLEND_SIMD
+#define DLG_LVGL_USE_BLEND_SIMD         1
+#endif
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
  *However the opened images might consume additional RAM.
  *0: to disable caching*/
-#define LV_IMG_CACHE_DEF_SIZE       0
+#define LV_IMG_CACHE_DEF_SIZE       16
+
+/* Cache of opened images: the LV_IMG_CACHE_DEF_SIZE entries are replaced least recently used first,
+ * and the images the draw path would convert at every draw (read line by line, true color with alpha
+ * byte for the GPU, indexed with DLG_LVGL_CF_SUB_BYTE_SWAP) are converted once into a memory of
+ * DLG_LVGL_IMG_CACHE_SIZE bytes, a static array in SysRAM or the memory at DLG_LVGL_IMG_CACHE_ADR
+ * (e.g. QSPI RAM). lv_img_cache_pin() keeps an image from being replaced. The images of the demo are
+ * all drawn as they are stored, none is converted: the memory is left out (size 0) and the cache only
+ * keeps the images opened. */
+#ifndef DLG_LVGL_USE_IMG_CACHE
+#define DLG_LVGL_USE_IMG_CACHE          1
+#endif
+#if DLG_LVGL_USE_IMG_CACHE
+#  define DLG_LVGL_IMG_CACHE_SIZE       0
+#  define DLG_LVGL_IMG_CACHE_ADR        0
+#endif
+
+/* Cache of the style properties resolved by lv_obj_get_style_prop(): DLG_LVGL_STYLE_CACHE_ENTRIES
+ * values per object, part, property and state, in sets of 2 (16 bytes each on the target). The
+ * inherited properties are taken from the cached value of the parent. An entry is dropped when a
+ * property of its group changes in any style, and all of them when the styles, the state or the
+ * parent of an object change. */
+#ifndef DLG_LVGL_USE_STYLE_CACHE
+#define DLG_LVGL_USE_STYLE_CACHE        1
+#endif
+#if DLG_LVGL_USE_STYLE_CACHE
+#  define DLG_LVGL_STYLE_CACHE_ENTRIES  512
+#endif
 
 /*Maximum buffer size to allocate for rotation. Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF         (10*1024)
@@ -157,9 +242,13 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #define LV_USE_GPU_NXP_VG_LITE   0
 
 /*Use external renderer*/
+#ifndef LV_USE_EXTERNAL_RENDERER
 #define LV_USE_EXTERNAL_RENDERER 1
+#endif
 
+#ifndef DLG_LVGL_USE_GPU_DA1470X
 #define DLG_LVGL_USE_GPU_DA1470X 1
+#endif
 #if DLG_LVGL_USE_GPU_DA1470X
 #  define DLG_LVGL_GPU_DA1470X_INCLUDE_PATH "dave_driver.h"
 
@@ -171,8 +260,60 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 /* Set the low limit in pixels that a BLIT operation with mask is performed by the GPU. SW is faster
  * in smaller areas whereas the GPU is faster in larger areas. Recommended value of 2000 */
 #  define DLG_LVGL_GPU_BLIT_MASK_SIZE_LIMIT     2000
+
+/* Cache of rotated/zoomed images: the GPU renders a transformed image once per angle, rounded to
+ * DLG_LVGL_IMG_ROT_CACHE_ANGLE_STEP (0.1 degree unit), into an ARGB8888 sprite that is blit unrotated
+ * afterwards. The sprites are held in a pool of DLG_LVGL_IMG_ROT_CACHE_SIZE bytes, a static array or
+ * the memory at DLG_LVGL_IMG_ROT_CACHE_ADR (e.g. QSPI RAM), and the least recently used ones are
+ * dropped when it is full. A sprite takes at most half of the pool: 96 KB hold the sprites of the
+ * three hands of the watch face (16.5, 16.2 and 46.4 KB at most), the second hand included. */
+#  ifndef DLG_LVGL_USE_IMG_ROT_CACHE
+#  define DLG_LVGL_USE_IMG_ROT_CACHE            1
+#  endif
+#  if DLG_LVGL_USE_IMG_ROT_CACHE
+#    define DLG_LVGL_IMG_ROT_CACHE_SIZE         (96 * 1024)
+#    define DLG_LVGL_IMG_ROT_CACHE_ADR          0
+#    define DLG_LVGL_IMG_ROT_CACHE_ENTRIES      8
+#    define DLG_LVGL_IMG_ROT_CACHE_ANGLE_STEP   6
+#  endif
+
+/* Cache of decoded glyphs: the letters are expanded once to 8-bit opacities into an atlas of
+ * DLG_LVGL_GLYPH_CACHE_SIZE bytes, a static array or the memory at DLG_LVGL_GLYPH_CACHE_ADR, and
+ * drawn by the GPU with a colorized A8 blit each. The atlas is filled page by page, the least
+ * recently used of the DLG_LVGL_GLYPH_CACHE_PAGES pages is cleared when it is full. */
+#  ifndef DLG_LVGL_USE_GLYPH_CACHE
+#  define DLG_LVGL_USE_GLYPH_CACHE              1
+#  endif
+#  if DLG_LVGL_USE_GLYPH_CACHE
+#    define DLG_LVGL_GLYPH_CACHE_SIZE           (24 * 1024)
+#    define DLG_LVGL_GLYPH_CACHE_ADR            0
+#    define DLG_LVGL_GLYPH_CACHE_PAGES          4
+#    define DLG_LVGL_GLYPH_CACHE_ENTRIES        128
+/* The cached letters of a label are drawn by one GPU job for up to this many letters of the same color */
+#    define DLG_LVGL_TEXT_BATCH_SIZE            32
+#  endif
+
+/* Cache of shadow corners: the blurred corners of shadows are computed once per radius and shadow
+ * width into DLG_LVGL_CORNER_CACHE_SIZE bytes, a static array or the memory at DLG_LVGL_CORNER_CACHE_ADR,
+ * and drawn by the GPU as A8 textures, the same one mirrored for the four corners. The least recently
+ * used ones are dropped when it is full. The rounded backgrounds are drawn with the GPU shapes. */
+#  ifndef DLG_LVGL_USE_CORNER_CACHE
+#  define DLG_LVGL_USE_CORNER_CACHE             1
+#  endif
+#  if DLG_LVGL_USE_CORNER_CACHE
+#    define DLG_LVGL_CORNER_CACHE_SIZE          (16 * 1024)
+#    define DLG_LVGL_CORNER_CACHE_ADR           0
+#    define DLG_LVGL_CORNER_CACHE_ENTRIES       16
+#  endif
 #endif
 
+/* Static RAM of the caches with these defaults, all in SysRAM as their _ADR are 0: rotated sprites
+ * 96 KB, glyphs 24 KB, shadow corners 16 KB, style properties 8 KB and the arena of lv_mem_buf_get()
+ * 4 KB, 148 KB in all (no memory for converted images, and the GPU texture cache of lv_port_gpu.c is
+ * only built with DLG_LVGL_CF_SUB_BYTE_SWAP). With the two frame buffers (594 KB), the OS heap
+ * (36 KB), the GUI heap (15 KB) and the GPU mask buffer (20 KB), 813 KB of the 1088 KB of RAMS are
+ * taken. */
+
 /*Use SDL renderer API*/
 #define LV_USE_GPU_SDL 0
 #if LV_USE_GPU_SDL
@@ -250,6 +391,23 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG       0
 
+/* Event profiler: the refreshes, the areas, the lv_draw_* calls, the flushes and the scopes added by
+ * the port (GPU jobs, LCDC transfers) are recorded as begin/end events with a time stamp in ns, into
+ * a ring of DLG_LVGL_PROFILER_EVENTS (a power of 2). lv_profiler_dump() writes them for
+ * simulator/tools/trace_conv.c, which converts them to a Chrome trace / Perfetto JSON. The time
+ * stamps have the resolution of DLG_LVGL_PROFILER_TIME_EXPR. The profiler is host-only: it is
+ * enabled by the simulator build (SIM_PROFILER), which dumps it with -p, the target has no dump path. */
+#ifndef DLG_LVGL_USE_PROFILER
+#define DLG_LVGL_USE_PROFILER   0
+#endif
+#if DLG_LVGL_USE_PROFILER
+#  ifndef DLG_LVGL_PROFILER_EVENTS
+#  define DLG_LVGL_PROFILER_EVENTS      4096
+#  endif
+#  define DLG_LVGL_PROFILER_TIME_INCLUDE "gdi.h"
+#  define DLG_LVGL_PROFILER_TIME_EXPR   (gdi_get_sys_uptime_ns())
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #define LV_SPRINTF_CUSTOM   0
 #if LV_SPRINTF_CUSTOM